@@ -1005,6 +1005,12 @@ typedef error_t (*PrngAlgoRead)(void *context, uint8_t *output, size_t length);
 
 typedef void (*PrngAlgoDeinit)(void *context);
 
+//Common API for worker pools
+typedef void (*WorkerTask)(void *param);
+
+typedef error_t (*WorkerPoolRun)(void *context, WorkerTask task, void *params,
+   size_t paramSize, uint_t numTasks);
+
 
 /**
  * @brief Common interface for hash algorithms
@@ -1080,6 +1086,22 @@ struct _PrngAlgo
 };
 
 
+/**
+ * @brief Common interface for worker pools
+ *
+ * The run callback executes task(params + i * paramSize) for each i in the
+ * range 0 to numTasks - 1, possibly concurrently, and returns once all the
+ * tasks have completed. Tasks report their own status through their
+ * parameter block
+ **/
+
+typedef struct
+{
+   const char_t *name;
+   WorkerPoolRun run;
+} WorkerPool;
+
+
 //C++ guard
 #ifdef __cplusplus
 }
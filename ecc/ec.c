@@ -34,6 +34,10 @@
 //Dependencies
 #include "core/crypto.h"
 #include "ecc/ec.h"
+#include "ecc/p256.h"
+#include "ecc/p384.h"
+#include "ecc/p521.h"
+#include "ecc/secp256k1.h"
 #include "debug.h"
 
 //Check crypto library configuration
@@ -145,6 +149,89 @@ end:
 }
 
 
+/**
+ * @brief Get the preloaded EC domain parameters that match the specified OID
+ *
+ * The preloaded domain parameters are immutable and shared by all the
+ * callers, hence they can be used concurrently without any allocation. They
+ * must not be passed to ecFreeDomainParameters
+ *
+ * @param[in] oid Object identifier of the elliptic curve
+ * @param[in] length OID length
+ * @return Pointer to the EC domain parameters (NULL if the curve is not
+ *   supported or if no preloaded domain parameters are available)
+ **/
+
+const EcDomainParameters *ecGetDomainParameters(const uint8_t *oid,
+   size_t length)
+{
+   const EcCurveInfo *curveInfo;
+   const EcDomainParameters *params;
+
+   //Retrieve the elliptic curve that matches the specified OID
+   curveInfo = ecGetCurveInfo(oid, length);
+
+   //Make sure the elliptic curve is supported
+   if(curveInfo != NULL)
+   {
+      //Point to the preloaded domain parameters, if any
+      params = curveInfo->params;
+   }
+   else
+   {
+      //Unknown elliptic curve
+      params = NULL;
+   }
+
+   //Return a pointer to the EC domain parameters
+   return params;
+}
+
+
+/**
+ * @brief Retrieve the EC domain parameters of a given curve
+ *
+ * The preloaded domain parameters are used when available. Otherwise the
+ * domain parameters are loaded into the structure provided by the caller,
+ * which must have been initialized with ecInitDomainParameters and must be
+ * released with ecFreeDomainParameters in both cases
+ *
+ * @param[in] curveInfo Elliptic curve parameters
+ * @param[in,out] ecParams Storage for the loaded domain parameters
+ * @param[out] params Pointer to the EC domain parameters to be used
+ * @return Error code
+ **/
+
+error_t ecRetrieveDomainParameters(const EcCurveInfo *curveInfo,
+   EcDomainParameters *ecParams, const EcDomainParameters **params)
+{
+   error_t error;
+
+   //Check parameters
+   if(curveInfo == NULL || ecParams == NULL || params == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Use the preloaded EC domain parameters, if available
+   *params = ecGetDomainParameters(curveInfo->oid, curveInfo->oidSize);
+
+   //No preloaded EC domain parameters?
+   if(*params == NULL)
+   {
+      //Load EC domain parameters
+      error = ecLoadDomainParameters(ecParams, curveInfo);
+      *params = ecParams;
+   }
+   else
+   {
+      //Successful processing
+      error = NO_ERROR;
+   }
+
+   //Return status code
+   return error;
+}
+
+
 /**
  * @brief Initialize an EC public key
  * @param[in] key Pointer to the EC public key to initialize
@@ -154,6 +241,14 @@ void ecInitPublicKey(EcPublicKey *key)
 {
    //Initialize EC point
    ecInit(&key->q);
+
+#if (EC_BASE_TABLE_SUPPORT == ENABLED)
+   //No multiples of the public key have been precomputed yet
+   key->cache.curveName = NULL;
+   key->cache.table.ready = FALSE;
+   key->cache.table.numWindows = 0;
+   key->cache.table.data = NULL;
+#endif
 }
 
 
@@ -166,6 +261,20 @@ void ecFreePublicKey(EcPublicKey *key)
 {
    //Free EC point
    ecFree(&key->q);
+
+#if (EC_BASE_TABLE_SUPPORT == ENABLED)
+   //Release the precomputed multiples of the public key, if any
+   if(key->cache.table.data != NULL)
+   {
+      cryptoFreeMem(key->cache.table.data);
+   }
+
+   //Invalidate the cache
+   key->cache.curveName = NULL;
+   key->cache.table.ready = FALSE;
+   key->cache.table.numWindows = 0;
+   key->cache.table.data = NULL;
+#endif
 }
 
 
@@ -282,7 +391,7 @@ error_t ecGeneratePublicKey(const EcDomainParameters *params,
       return ERROR_INVALID_PARAMETER;
 
    //Compute Q = d.G
-   EC_CHECK(ecMult(params, &publicKey->q, &privateKey->d, &params->g));
+   EC_CHECK(ecMultBase(params, &publicKey->q, &privateKey->d));
 
    //Convert the public key to affine representation
    EC_CHECK(ecAffinify(params, &publicKey->q, &publicKey->q));
@@ -522,17 +631,25 @@ __weak_func error_t ecAffinify(const EcDomainParameters *params, EcPoint *r,
    error_t error;
    Mpi a;
    Mpi b;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
 
    //Point at the infinity?
    if(mpiCompInt(&s->z, 0) == 0)
       return ERROR_INVALID_PARAMETER;
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
+
    //Initialize multiple precision integers
    mpiInit(&a);
    mpiInit(&b);
 
    //Compute a = 1/Sz mod p
-   MPI_CHECK(mpiInvMod(&a, &s->z, &params->p));
+   MPI_CHECK(mpiInvModRegular(&a, &s->z, &params->p));
 
    //Set Rx = a^2 * Sx mod p
    EC_CHECK(ecSqrMod(params, &b, &a));
@@ -550,11 +667,189 @@ end:
    mpiFree(&a);
    mpiFree(&b);
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
+   //Return status code
+   return error;
+}
+
+/**
+ * @brief Recover affine representation of a batch of points
+ * @param[in] params EC domain parameters
+ * @param[out] r Affine representation of the points
+ * @param[in] s Projective representation of the points
+ * @param[in] n Number of points
+ * @param[in] c Scratch integers (n entries)
+ * @return Error code
+ **/
+
+static error_t ecAffinifyBatchChunk(const EcDomainParameters *params,
+   EcPoint *r, const EcPoint *s, uint_t n, Mpi *c)
+{
+   error_t error;
+   uint_t i;
+   Mpi a;
+   Mpi b;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
+
+   //Initialize multiple precision integers
+   mpiInit(&a);
+   mpiInit(&b);
+
+   for(i = 0; i < n; i++)
+   {
+      mpiInit(&c[i]);
+   }
+
+   //Compute the partial products c[i] = Z[0] * ... * Z[i] of the non-zero
+   //z-coordinates
+   MPI_CHECK(mpiSetValue(&a, 1));
+
+   for(i = 0; i < n; i++)
+   {
+      //The points at the infinity are skipped
+      if(mpiCompInt(&s[i].z, 0) != 0)
+      {
+         EC_CHECK(ecMulMod(params, &a, &a, &s[i].z));
+      }
+
+      //Save the current partial product
+      MPI_CHECK(mpiCopy(&c[i], &a));
+   }
+
+   //Compute a = 1 / (Z[0] * ... * Z[n - 1])
+   MPI_CHECK(mpiInvModRegular(&b, &a, &params->p));
+   MPI_CHECK(mpiCopy(&a, &b));
+
+   //Process the points in reverse order
+   for(i = n; i > 0; i--)
+   {
+      //Point at the infinity?
+      if(mpiCompInt(&s[i - 1].z, 0) == 0)
+      {
+         //The point is left unchanged
+         EC_CHECK(ecCopy(&r[i - 1], &s[i - 1]));
+      }
+      else
+      {
+         //Compute b = 1 / Z[i - 1]
+         if(i > 1)
+         {
+            EC_CHECK(ecMulMod(params, &b, &a, &c[i - 2]));
+         }
+         else
+         {
+            MPI_CHECK(mpiCopy(&b, &a));
+         }
+
+         //Compute a = 1 / (Z[0] * ... * Z[i - 2])
+         EC_CHECK(ecMulMod(params, &a, &a, &s[i - 1].z));
+
+         //Set Rx = b^2 * Sx mod p
+         EC_CHECK(ecSqrMod(params, &c[i - 1], &b));
+         EC_CHECK(ecMulMod(params, &r[i - 1].x, &c[i - 1], &s[i - 1].x));
+
+         //Set Ry = b^3 * Sy mod p
+         EC_CHECK(ecMulMod(params, &c[i - 1], &c[i - 1], &b));
+         EC_CHECK(ecMulMod(params, &r[i - 1].y, &c[i - 1], &s[i - 1].y));
+
+         //Set Rz = 1
+         MPI_CHECK(mpiSetValue(&r[i - 1].z, 1));
+      }
+   }
+
+end:
+   //Release multiple precision integers
+   mpiFree(&a);
+   mpiFree(&b);
+
+   for(i = 0; i < n; i++)
+   {
+      mpiFree(&c[i]);
+   }
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Recover affine representation of several points
+ *
+ * Montgomery's trick is used, so that the whole batch costs a single modular
+ * inversion and 3.(n - 1) modular multiplications, instead of one inversion
+ * per point. The points at the infinity are left unchanged
+ *
+ * @param[in] params EC domain parameters
+ * @param[out] r Affine representation of the points (may be the same array
+ *   as S)
+ * @param[in] s Projective representation of the points
+ * @param[in] n Number of points
+ * @return Error code
+ **/
+
+error_t ecAffinifyBatch(const EcDomainParameters *params, EcPoint *r,
+   const EcPoint *s, uint_t n)
+{
+   error_t error;
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   Mpi *c;
+#else
+   uint_t i;
+   uint_t k;
+   Mpi c[1 << (EC_MULT_WINDOW_SIZE - 1)];
+#endif
+
+   //Empty batch?
+   if(n == 0)
+      return NO_ERROR;
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Allocate the partial products
+   c = cryptoAllocMem(n * sizeof(Mpi));
+   //Failed to allocate memory?
+   if(c == NULL)
+      return ERROR_OUT_OF_MEMORY;
+
+   //Convert the whole batch at once
+   error = ecAffinifyBatchChunk(params, r, s, n, c);
+
+   //Release the partial products
+   cryptoFreeMem(c);
+#else
+   //Initialize status code
+   error = NO_ERROR;
+
+   //The partial products are kept on the stack, hence the points are
+   //processed by chunks of fixed size
+   for(i = 0; i < n && !error; i += k)
+   {
+      k = MIN(n - i, arraysize(c));
+      error = ecAffinifyBatchChunk(params, r + i, s + i, k, c);
+   }
+#endif
+
    //Return status code
    return error;
 }
 
 
+
 /**
  * @brief Check whether the affine point S is on the curve
  * @param[in] params EC domain parameters
@@ -613,6 +908,14 @@ error_t ecDouble(const EcDomainParameters *params, EcPoint *r,
    Mpi t3;
    Mpi t4;
    Mpi t5;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
 
    //Initialize multiple precision integers
    mpiInit(&t1);
@@ -722,6 +1025,11 @@ end:
    mpiFree(&t4);
    mpiFree(&t5);
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
    //Return status code
    return error;
 }
@@ -747,6 +1055,14 @@ error_t ecAdd(const EcDomainParameters *params, EcPoint *r,
    Mpi t5;
    Mpi t6;
    Mpi t7;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
 
    //Initialize multiple precision integers
    mpiInit(&t1);
@@ -882,6 +1198,11 @@ end:
    mpiFree(&t6);
    mpiFree(&t7);
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
    //Return status code
    return error;
 }
@@ -917,6 +1238,12 @@ error_t ecFullAdd(const EcDomainParameters *params, EcPoint *r,
       MPI_CHECK(mpiCopy(&r->y, &s->y));
       MPI_CHECK(mpiCopy(&r->z, &s->z));
    }
+   //Check whether S and T are the same variable
+   else if(s == t)
+   {
+      //Compute R = 2 * S
+      EC_CHECK(ecDouble(params, r, s));
+   }
    else
    {
       //Compute R = S + T
@@ -927,8 +1254,9 @@ error_t ecFullAdd(const EcDomainParameters *params, EcPoint *r,
          mpiCompInt(&r->y, 0) == 0 &&
          mpiCompInt(&r->z, 0) == 0)
       {
-         //Compute R = 2 * S
-         EC_CHECK(ecDouble(params, r, s));
+         //S and T are equal, hence R = 2 * S. Either operand may share its
+         //storage with R, which has just been overwritten
+         EC_CHECK(ecDouble(params, r, (r != s) ? s : t));
       }
    }
 
@@ -974,8 +1302,62 @@ end:
 }
 
 
+/**
+ * @brief Grow the coordinates of an EC point
+ * @param[in,out] r EC point
+ * @param[in] n Desired size of the coordinates, in words
+ * @return Error code
+ **/
+
+error_t ecGrowPoint(EcPoint *r, uint_t n)
+{
+   error_t error;
+
+   //Adjust the size of the coordinates
+   MPI_CHECK(mpiGrow(&r->x, n));
+   MPI_CHECK(mpiGrow(&r->y, n));
+   MPI_CHECK(mpiGrow(&r->z, n));
+
+end:
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Conditional copy of an EC point (constant time)
+ * @param[in,out] r Destination point
+ * @param[in] s Source point
+ * @param[in] n Size of the coordinates of both points, in words
+ * @param[in] mask The all-1 word to copy S into R, the all-0 word to leave
+ *   R unchanged
+ **/
+
+void ecCondCopy(EcPoint *r, const EcPoint *s, uint_t n, uint_t mask)
+{
+   uint_t i;
+
+   //Process the coordinates word by word
+   for(i = 0; i < n; i++)
+   {
+      r->x.data[i] = (r->x.data[i] & ~mask) | (s->x.data[i] & mask);
+      r->y.data[i] = (r->y.data[i] & ~mask) | (s->y.data[i] & mask);
+      r->z.data[i] = (r->z.data[i] & ~mask) | (s->z.data[i] & mask);
+   }
+}
+
+
 /**
  * @brief Scalar multiplication
+ *
+ * The scalar is recoded with odd signed digits in a window of w bits, so
+ * that only the odd multiples of S need to be precomputed. This gives a
+ * regular operation sequence (w doublings and one addition per window,
+ * whatever the scalar) and the table entries are selected by a full scan.
+ * Note that the point operations and the underlying multiple precision
+ * arithmetic are not constant-time, hence this function does not claim to
+ * run in constant time
+ *
  * @param[in] params EC domain parameters
  * @param[out] r Resulting point R = d.S
  * @param[in] d An integer d such as 0 <= d < p
@@ -987,11 +1369,81 @@ __weak_func error_t ecMult(const EcDomainParameters *params, EcPoint *r, const M
    const EcPoint *s)
 {
    error_t error;
-   uint_t i;
-   Mpi h;
+   int_t i;
+   uint_t j;
+   uint_t l;
+   uint_t m;
+   uint_t n;
+   uint_t c;
+   uint_t index;
+   uint_t sign;
+   uint_t parity;
+   int_t digit;
+   Mpi k;
+   Mpi e;
+   EcPoint t;
+   EcPoint u;
+   EcPoint table[1 << (EC_MULT_WINDOW_SIZE - 1)];
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
 
-   //Initialize multiple precision integer
-   mpiInit(&h);
+#if (SECP256R1_SUPPORT == ENABLED && P256_SUPPORT == ENABLED)
+   //secp256r1 elliptic curve?
+   if(p256IsCurve(params))
+   {
+      //Use the dedicated implementation
+      return p256Mult(r, d, s);
+   }
+#endif
+
+#if (SECP384R1_SUPPORT == ENABLED && P384_SUPPORT == ENABLED)
+   //secp384r1 elliptic curve?
+   if(p384IsCurve(params))
+   {
+      //Use the dedicated implementation
+      return p384Mult(r, d, s);
+   }
+#endif
+
+#if (SECP521R1_SUPPORT == ENABLED && P521_SUPPORT == ENABLED)
+   //secp521r1 elliptic curve?
+   if(p521IsCurve(params))
+   {
+      //Use the dedicated implementation
+      return p521Mult(r, d, s);
+   }
+#endif
+
+#if (SECP256K1_SUPPORT == ENABLED && SECP256K1_GLV_SUPPORT == ENABLED)
+   //secp256k1 elliptic curve?
+   if(secp256k1IsCurve(params))
+   {
+      //Take advantage of the efficiently computable endomorphism
+      return secp256k1Mult(params, r, d, s);
+   }
+#endif
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
+
+   //Number of points in the table
+   n = 1 << (EC_MULT_WINDOW_SIZE - 1);
+
+   //Initialize multiple precision integers
+   mpiInit(&k);
+   mpiInit(&e);
+
+   //Initialize EC points
+   ecInit(&t);
+   ecInit(&u);
+
+   for(j = 0; j < n; j++)
+   {
+      ecInit(&table[j]);
+   }
 
    //Check whether d == 0
    if(mpiCompInt(d, 0) == 0)
@@ -1019,79 +1471,470 @@ __weak_func error_t ecMult(const EcDomainParameters *params, EcPoint *r, const M
    }
    else
    {
-      //Check whether Sz != 1
-      if(mpiCompInt(&s->z, 1) != 0)
+      //Set T[0] = S (S is normalized together with the other entries)
+      EC_CHECK(ecCopy(&table[0], s));
+
+      //Compute U = 2.S
+      EC_CHECK(ecDouble(params, &u, &table[0]));
+
+      //Precompute the odd multiples T[j] = (2.j + 1).S
+      for(j = 1; j < n; j++)
       {
-         //Normalize S
-         EC_CHECK(ecAffinify(params, r, s));
-         EC_CHECK(ecProjectify(params, r, r));
+         EC_CHECK(ecFullAdd(params, &table[j], &table[j - 1], &u));
       }
-      else
+
+      //Convert the table to affine representation, so that mixed additions
+      //can be used
+      EC_CHECK(ecAffinifyBatch(params, table, table, n));
+
+      //Length of the coordinates, in words
+      l = mpiGetLength(&params->p);
+
+      //The table is scanned word by word, hence all the coordinates must
+      //have the same size
+      for(j = 0; j < n; j++)
       {
-         //Set R = S
-         MPI_CHECK(mpiCopy(&r->x, &s->x));
-         MPI_CHECK(mpiCopy(&r->y, &s->y));
-         MPI_CHECK(mpiCopy(&r->z, &s->z));
+         EC_CHECK(ecGrowPoint(&table[j], l));
       }
 
-//Left-to-right binary method
-#if 0
-      for(i = mpiGetBitLength(d) - 1; i >= 1; i--)
+      EC_CHECK(ecGrowPoint(&t, l));
+
+      //The recoding requires an odd scalar. When d is even, (d + 1).S is
+      //computed instead and S is subtracted at the end
+      parity = mpiGetBitValue(d, 0);
+      MPI_CHECK(mpiAddInt(&k, d, 1 - parity));
+
+      //The number of windows only depends on the domain parameters, as long
+      //as the scalar is in the expected range
+      m = MAX(mpiGetBitLength(&params->p), mpiGetBitLength(&params->q));
+      m = MAX(m, mpiGetBitLength(&k)) / EC_MULT_WINDOW_SIZE + 1;
+
+      //Loop through the windows, starting with the most significant one
+      for(i = m - 1; i >= 0; i--)
       {
-         //Point doubling
-         EC_CHECK(ecDouble(params, r, r));
+         //Extract w + 1 bits, the least significant one being forced to 1
+         for(c = 1, j = 1; j <= EC_MULT_WINDOW_SIZE; j++)
+         {
+            c |= mpiGetBitValue(&k, i * EC_MULT_WINDOW_SIZE + j) << j;
+         }
 
-         if(mpiGetBitValue(d, i - 1))
+         //The most significant digit is always positive
+         if(i < (int_t) (m - 1))
          {
-            //Compute R = R + S
-            EC_CHECK(ecFullAdd(params, r, r, s));
+            digit = (int_t) c - (1 << EC_MULT_WINDOW_SIZE);
+         }
+         else
+         {
+            digit = (int_t) c;
          }
-      }
-//Fast left-to-right binary method
-#else
-      //Precompute h = 3 * d
-      MPI_CHECK(mpiAdd(&h, d, d));
-      MPI_CHECK(mpiAdd(&h, &h, d));
 
-      //Scalar multiplication
-      for(i = mpiGetBitLength(&h) - 2; i >= 1; i--)
-      {
-         //Point doubling
-         EC_CHECK(ecDouble(params, r, r));
+         //The digit is odd and its absolute value is (2.index + 1)
+         sign = (uint_t) digit >> (sizeof(uint_t) * 8 - 1);
+         index = (((uint_t) digit ^ (0U - sign)) + sign) >> 1;
+
+         //Scan the whole table so that the memory access pattern does not
+         //depend on the value of the digit
+         for(j = 0; j < n; j++)
+         {
+            //Build a mask that selects the current entry if j == index
+            c = j ^ index;
+            c = ((c | (0U - c)) >> (sizeof(uint_t) * 8 - 1)) - 1;
 
-         //Check whether h(i) == 1 and k(i) == 0
-         if(mpiGetBitValue(&h, i) && !mpiGetBitValue(d, i))
+            //Conditional copy
+            ecCondCopy(&t, &table[j], l, c);
+         }
+
+         //Compute p - Ty
+         MPI_CHECK(mpiSub(&e, &params->p, &t.y));
+         MPI_CHECK(mpiGrow(&e, l));
+
+         //Negate the selected point if the digit is negative
+         for(j = 0; j < l; j++)
+         {
+            t.y.data[j] = (t.y.data[j] & (sign - 1)) | (e.data[j] & (0U - sign));
+         }
+
+         //Most significant window?
+         if(i == (int_t) (m - 1))
          {
-            //Compute R = R + S
-            EC_CHECK(ecFullAdd(params, r, r, s));
+            //Set R = T
+            EC_CHECK(ecCopy(r, &t));
          }
-         //Check whether h(i) == 0 and k(i) == 1
-         else if(!mpiGetBitValue(&h, i) && mpiGetBitValue(d, i))
+         else
          {
-            //Compute R = R - S
-            EC_CHECK(ecFullSub(params, r, r, s));
+            //Compute R = 2^w.R
+            for(j = 0; j < EC_MULT_WINDOW_SIZE; j++)
+            {
+               EC_CHECK(ecDouble(params, r, r));
+            }
+
+            //Compute R = R + T
+            EC_CHECK(ecFullAdd(params, r, r, &t));
          }
       }
-#endif
+
+      //Compute U = R - S
+      EC_CHECK(ecFullSub(params, &u, r, &table[0]));
+
+      //If d is even, then R = U
+      EC_CHECK(ecGrowPoint(r, l));
+      EC_CHECK(ecGrowPoint(&u, l));
+      ecCondCopy(r, &u, l, parity - 1);
    }
 
 end:
+   //Erase the recoded scalar
+   mpiFree(&k);
    //Release multiple precision integer
-   mpiFree(&h);
+   mpiFree(&e);
+
+   //Release EC points
+   ecFree(&t);
+   ecFree(&u);
+
+   for(j = 0; j < n; j++)
+   {
+      ecFree(&table[j]);
+   }
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
 
    //Return status code
    return error;
 }
 
 
-/**
- * @brief An auxiliary function for the twin multiplication
- * @param[in] t An integer T such as 0 <= T <= 31
- * @return Output value
- **/
+#if (EC_BASE_TABLE_SUPPORT == ENABLED)
 
-uint_t ecTwinMultF(uint_t t)
-{
+/**
+ * @brief Build a table of precomputed multiples of a point
+ *
+ * For each window i, the table holds the affine points (2.j + 1).2^(w.i).S,
+ * where 0 <= j < 2^(w - 1) and w is the window size
+ *
+ * @param[in] params EC domain parameters
+ * @param[out] table Table to be built
+ * @param[in] s Affine point S
+ * @param[in] m Number of windows
+ * @return Error code
+ **/
+
+static error_t ecBuildBaseTable(const EcDomainParameters *params,
+   EcBaseTable *table, const EcPoint *s, uint_t m)
+{
+   error_t error;
+   uint_t i;
+   uint_t j;
+   uint_t n;
+   size_t pLen;
+   uint8_t *data;
+   uint8_t *p;
+   EcPoint *t;
+   EcPoint u;
+
+   //Length of the coordinates, in bytes
+   pLen = mpiGetByteLength(&params->p);
+   //Number of points per window
+   n = 1 << (EC_BASE_TABLE_WINDOW_SIZE - 1);
+
+   //Allocate a memory buffer to hold the table
+   data = cryptoAllocMem(m * n * 2 * pLen);
+   //Failed to allocate memory?
+   if(data == NULL)
+      return ERROR_OUT_OF_MEMORY;
+
+   //The points of the current window are followed by the base of the next
+   //window, so that they can all be normalized at once
+   t = cryptoAllocMem((n + 1) * sizeof(EcPoint));
+   //Failed to allocate memory?
+   if(t == NULL)
+   {
+      cryptoFreeMem(data);
+      return ERROR_OUT_OF_MEMORY;
+   }
+
+   //Initialize EC points
+   for(j = 0; j <= n; j++)
+   {
+      ecInit(&t[j]);
+   }
+
+   ecInit(&u);
+
+   //Set B = S
+   EC_CHECK(ecCopy(&t[n], s));
+
+   //Loop through the windows
+   for(i = 0; i < m; i++)
+   {
+      //Compute U = 2.B
+      EC_CHECK(ecDouble(params, &u, &t[n]));
+
+      //Set T[0] = B
+      EC_CHECK(ecCopy(&t[0], &t[n]));
+
+      //Compute the odd multiples T[j] = (2.j + 1).B
+      for(j = 1; j < n; j++)
+      {
+         EC_CHECK(ecFullAdd(params, &t[j], &t[j - 1], &u));
+      }
+
+      //The base of the next window is 2^w.B = (2^w - 1).B + B
+      EC_CHECK(ecFullAdd(params, &t[n], &t[n - 1], &t[0]));
+
+      //Convert the points to affine representation, using a single modular
+      //inversion per window
+      EC_CHECK(ecAffinifyBatch(params, t, t, n + 1));
+
+      //Store the odd multiples of B
+      for(j = 0; j < n; j++)
+      {
+         //The point at the infinity has no affine representation
+         if(mpiCompInt(&t[j].z, 0) == 0)
+         {
+            EC_CHECK(ERROR_INVALID_PARAMETER);
+         }
+
+         //Point to the current entry
+         p = data + (i * n + j) * 2 * pLen;
+
+         //Store the affine coordinates of T[j]
+         MPI_CHECK(mpiExport(&t[j].x, p, pLen, MPI_FORMAT_BIG_ENDIAN));
+         MPI_CHECK(mpiExport(&t[j].y, p + pLen, pLen, MPI_FORMAT_BIG_ENDIAN));
+      }
+   }
+
+   //The table is now ready for use
+   table->numWindows = m;
+   table->data = data;
+   table->ready = TRUE;
+
+end:
+   //Release EC points
+   for(j = 0; j <= n; j++)
+   {
+      ecFree(&t[j]);
+   }
+
+   ecFree(&u);
+   cryptoFreeMem(t);
+
+   //Clean up side effects if necessary
+   if(error)
+   {
+      //Release the partially built table
+      cryptoFreeMem(data);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Retrieve the precomputed multiples of a public key
+ * @param[in] params EC domain parameters
+ * @param[in] key EC public key
+ * @return Pointer to the table, or NULL if no valid table is attached to
+ *   the public key
+ **/
+
+static const EcBaseTable *ecGetPublicKeyTable(const EcDomainParameters *params,
+   const EcPublicKey *key)
+{
+   error_t error;
+   size_t n;
+   uint8_t buffer[2 * EC_MAX_MODULUS_SIZE];
+
+   //The table is only built on request
+   if(!key->cache.table.ready || key->cache.curveName == NULL ||
+      params->name == NULL)
+   {
+      return NULL;
+   }
+
+   //Make sure the table was built for the same curve
+   if(osStrcmp(key->cache.curveName, params->name) != 0)
+      return NULL;
+
+   //Length of the coordinates, in bytes
+   n = mpiGetByteLength(&params->p);
+
+   //Retrieve the affine coordinates of the public key
+   error = mpiExport(&key->q.x, buffer, n, MPI_FORMAT_BIG_ENDIAN);
+
+   //Check status code
+   if(!error)
+   {
+      error = mpiExport(&key->q.y, buffer + n, n, MPI_FORMAT_BIG_ENDIAN);
+   }
+
+   //The table is no longer valid if the public key has been modified
+   if(error || osMemcmp(buffer, key->cache.q, 2 * n) != 0)
+      return NULL;
+
+   //Return a pointer to the table
+   return &key->cache.table;
+}
+
+#endif
+
+
+/**
+ * @brief Fixed-base scalar multiplication
+ *
+ * The computation is delegated to ecMult, so that the hardware accelerator
+ * is used when available. The software implementation switches to the
+ * fixed-base method for the curves that have a dedicated implementation
+ *
+ * @param[in] params EC domain parameters
+ * @param[out] r Resulting point R = d.G
+ * @param[in] d An integer d such as 0 <= d < q
+ * @return Error code
+ **/
+
+error_t ecMultBase(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d)
+{
+   //Check parameters
+   if(params == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Compute R = d.G
+   return ecMult(params, r, d, &params->g);
+}
+
+
+/**
+ * @brief Precompute multiples of a public key
+ *
+ * The table is attached to the public key and is used by subsequent
+ * signature verifications, as long as the public key is unchanged. It is
+ * worth building when many signatures are expected from the same signer
+ * (CA certificates, OCSP responders), since its computation costs several
+ * verifications. The table is released by ecFreePublicKey. No table is
+ * built for secp256k1, whose implementation uses the endomorphism instead
+ *
+ * @param[in] params EC domain parameters
+ * @param[in,out] key EC public key
+ * @return Error code
+ **/
+
+error_t ecPrecomputePublicKey(const EcDomainParameters *params,
+   EcPublicKey *key)
+{
+#if (EC_BASE_TABLE_SUPPORT == ENABLED)
+   error_t error;
+   size_t n;
+   EcPoint t;
+
+   //Check parameters
+   if(params == NULL || key == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Length of the coordinates, in bytes
+   n = mpiGetByteLength(&params->p);
+
+   //Check the length of the domain parameters
+   if(n > EC_MAX_MODULUS_SIZE || mpiGetByteLength(&params->q) > EC_MAX_MODULUS_SIZE)
+      return ERROR_INVALID_PARAMETER;
+
+   //Release the previously computed table, if any
+   if(key->cache.table.data != NULL)
+   {
+      cryptoFreeMem(key->cache.table.data);
+   }
+
+   //Invalidate the cache
+   key->cache.curveName = NULL;
+   key->cache.table.ready = FALSE;
+   key->cache.table.numWindows = 0;
+   key->cache.table.data = NULL;
+
+#if (SECP256K1_SUPPORT == ENABLED && SECP256K1_GLV_SUPPORT == ENABLED)
+   //The secp256k1 implementation relies on the endomorphism and does not
+   //make use of the table
+   if(secp256k1IsCurve(params))
+      return NO_ERROR;
+#endif
+
+   //Initialize EC point
+   ecInit(&t);
+
+   //Save the affine coordinates of the public key
+   MPI_CHECK(mpiExport(&key->q.x, key->cache.q, n, MPI_FORMAT_BIG_ENDIAN));
+   MPI_CHECK(mpiExport(&key->q.y, key->cache.q + n, n, MPI_FORMAT_BIG_ENDIAN));
+
+#if (SECP256R1_SUPPORT == ENABLED && P256_SUPPORT == ENABLED)
+   //secp256r1 elliptic curve?
+   if(p256IsCurve(params))
+   {
+      //Use the dedicated implementation
+      error = p256BuildTable(&key->cache.table, &key->q);
+   }
+   else
+#endif
+#if (SECP384R1_SUPPORT == ENABLED && P384_SUPPORT == ENABLED)
+   //secp384r1 elliptic curve?
+   if(p384IsCurve(params))
+   {
+      //Use the dedicated implementation
+      error = p384BuildTable(&key->cache.table, &key->q);
+   }
+   else
+#endif
+#if (SECP521R1_SUPPORT == ENABLED && P521_SUPPORT == ENABLED)
+   //secp521r1 elliptic curve?
+   if(p521IsCurve(params))
+   {
+      //Use the dedicated implementation
+      error = p521BuildTable(&key->cache.table, &key->q);
+   }
+   else
+#endif
+   {
+      //Convert the public key to projective representation
+      error = ecProjectify(params, &t, &key->q);
+
+      //Check status code
+      if(!error)
+      {
+         //The odd multiples of the public key (first window) are enough
+         error = ecBuildBaseTable(params, &key->cache.table, &t, 1);
+      }
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Remember the curve for which the table was built
+      key->cache.curveName = params->name;
+   }
+
+end:
+   //Release EC point
+   ecFree(&t);
+
+   //Return status code
+   return error;
+#else
+   //The table requires dynamic memory allocation
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+/**
+ * @brief An auxiliary function for the twin multiplication
+ * @param[in] t An integer T such as 0 <= T <= 31
+ * @return Output value
+ **/
+
+uint_t ecTwinMultF(uint_t t)
+{
    uint_t h;
 
    //Check the value of T
@@ -1148,6 +1991,23 @@ error_t ecTwinMult(const EcDomainParameters *params, EcPoint *r,
    int_t u1;
    EcPoint spt;
    EcPoint smt;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
+
+#if (SECP256K1_SUPPORT == ENABLED && SECP256K1_GLV_SUPPORT == ENABLED)
+   //secp256k1 elliptic curve?
+   if(secp256k1IsCurve(params))
+   {
+      //Take advantage of the efficiently computable endomorphism
+      return secp256k1TwinMult(params, r, d0, s, d1, t);
+   }
+#endif
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
 
    //Initialize EC points
    ecInit(&spt);
@@ -1288,11 +2148,342 @@ end:
    ecFree(&spt);
    ecFree(&smt);
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
    //Return status code
    return error;
 }
 
 
+/**
+ * @brief Twin multiplication with the base point
+ *
+ * The computation of d0.G + d1.Q is needed by signature verification. Both
+ * scalars are public, hence the computation does not need to run in constant
+ * time. The scalars are recoded in width-w non-adjacent form and the two
+ * multiplications are interleaved so that they share the same doublings.
+ * The odd multiples of Q are taken from the table attached to the public key,
+ * if any (refer to ecPrecomputePublicKey). The function only reads shared
+ * data. The resulting point is not normalized
+ *
+ * @param[in] params EC domain parameters
+ * @param[out] r Resulting point R = d0.G + d1.Q (Jacobian coordinates)
+ * @param[in] d0 An integer d0 such as 0 <= d0 < q
+ * @param[in] d1 An integer d1 such as 0 <= d1 < q
+ * @param[in] key EC public key Q
+ * @return Error code
+ **/
+
+error_t ecTwinMultBase(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d0, const Mpi *d1, const EcPublicKey *key)
+{
+   error_t error;
+   uint_t i;
+   uint_t j;
+   uint_t m;
+   uint_t n;
+   int_t digit;
+   size_t qLen;
+   const EcBaseTable *table;
+   int8_t naf[2][EC_MAX_MODULUS_SIZE * 8 + 1];
+   uint8_t k[2][EC_MAX_MODULUS_SIZE];
+   EcPoint s[2][1 << (EC_MULT_WINDOW_SIZE - 1)];
+   EcPoint t;
+#if (EC_BASE_TABLE_SUPPORT == ENABLED)
+   uint_t index;
+   size_t pLen;
+   const uint8_t *entry;
+#endif
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
+
+   //Check parameters
+   if(params == NULL || r == NULL || d0 == NULL || d1 == NULL || key == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+#if (SECP256K1_SUPPORT == ENABLED && SECP256K1_GLV_SUPPORT == ENABLED)
+   //secp256k1 elliptic curve?
+   if(secp256k1IsCurve(params))
+   {
+      //Take advantage of the efficiently computable endomorphism
+      return secp256k1TwinMultBase(params, r, d0, d1, &key->q);
+   }
+#endif
+
+#if (EC_BASE_TABLE_SUPPORT == ENABLED)
+   //Retrieve the precomputed multiples of the public key, if any
+   table = ecGetPublicKeyTable(params, key);
+#else
+   //No precomputed table is available
+   table = NULL;
+#endif
+
+#if (SECP256R1_SUPPORT == ENABLED && P256_SUPPORT == ENABLED)
+   //secp256r1 elliptic curve?
+   if(p256IsCurve(params))
+   {
+      //Use the dedicated implementation
+      return p256TwinMultBase(r, d0, d1, &key->q, table);
+   }
+#endif
+
+#if (SECP384R1_SUPPORT == ENABLED && P384_SUPPORT == ENABLED)
+   //secp384r1 elliptic curve?
+   if(p384IsCurve(params))
+   {
+      //Use the dedicated implementation
+      return p384TwinMultBase(r, d0, d1, &key->q, table);
+   }
+#endif
+
+#if (SECP521R1_SUPPORT == ENABLED && P521_SUPPORT == ENABLED)
+   //secp521r1 elliptic curve?
+   if(p521IsCurve(params))
+   {
+      //Use the dedicated implementation
+      return p521TwinMultBase(r, d0, d1, &key->q, table);
+   }
+#endif
+
+   //Length of the scalars, in bytes
+   qLen = mpiGetByteLength(&params->q);
+
+   //Check the length of the domain parameters
+   if(mpiGetByteLength(&params->p) > EC_MAX_MODULUS_SIZE ||
+      qLen > EC_MAX_MODULUS_SIZE)
+   {
+      return ERROR_INVALID_PARAMETER;
+   }
+
+   //The scalars must be in the range 0 <= d < q
+   if(d0->sign < 0 || mpiComp(d0, &params->q) >= 0 ||
+      d1->sign < 0 || mpiComp(d1, &params->q) >= 0)
+   {
+      return ERROR_INVALID_PARAMETER;
+   }
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
+
+   //Number of digits of the recoded scalars
+   m = qLen * 8 + 1;
+   //Number of precomputed odd multiples
+   n = 1 << (EC_MULT_WINDOW_SIZE - 1);
+
+   //Initialize EC points
+   for(j = 0; j < 2; j++)
+   {
+      for(i = 0; i < n; i++)
+      {
+         ecInit(&s[j][i]);
+      }
+   }
+
+   ecInit(&t);
+
+   //Export the scalars
+   MPI_CHECK(mpiExport(d0, k[0], qLen, MPI_FORMAT_BIG_ENDIAN));
+   MPI_CHECK(mpiExport(d1, k[1], qLen, MPI_FORMAT_BIG_ENDIAN));
+
+   //Set R = (1, 1, 0)
+   MPI_CHECK(mpiSetValue(&r->x, 1));
+   MPI_CHECK(mpiSetValue(&r->y, 1));
+   MPI_CHECK(mpiSetValue(&r->z, 0));
+
+   //Set S0 = G and S1 = Q
+   EC_CHECK(ecCopy(&s[0][0], &params->g));
+   EC_CHECK(ecProjectify(params, &s[1][0], &key->q));
+
+   //Prepare the interleaved multiplication
+   for(j = 0; j < 2; j++)
+   {
+      //The precomputed table holds the odd multiples of the public key
+      if(j == 1 && table != NULL)
+      {
+         //Recode the scalar in width-(w + 1) non-adjacent form
+         ecComputeWnaf(naf[j], k[j], qLen, EC_BASE_TABLE_WINDOW_SIZE + 1);
+      }
+      else
+      {
+         //Recode the scalar in width-(w + 1) non-adjacent form
+         ecComputeWnaf(naf[j], k[j], qLen, EC_MULT_WINDOW_SIZE + 1);
+
+         //Compute T = 2.S
+         EC_CHECK(ecDouble(params, &t, &s[j][0]));
+
+         //Precompute the odd multiples (2.i + 1).S
+         for(i = 1; i < n; i++)
+         {
+            EC_CHECK(ecFullAdd(params, &s[j][i], &s[j][i - 1], &t));
+         }
+
+         //Convert the table to affine representation
+         EC_CHECK(ecAffinifyBatch(params, s[j], s[j], n));
+      }
+   }
+
+   //Set the z-coordinate of the points retrieved from the table
+   MPI_CHECK(mpiSetValue(&t.z, 1));
+
+   //Process the digits from the most significant one
+   for(i = m; i > 0; i--)
+   {
+      //Point doubling (not needed as long as R is the point at infinity)
+      if(mpiCompInt(&r->z, 0) != 0)
+      {
+         EC_CHECK(ecDouble(params, r, r));
+      }
+
+      //Loop through the products
+      for(j = 0; j < 2; j++)
+      {
+         //Retrieve the current digit
+         digit = naf[j][i - 1];
+
+         //Zero digits do not require any point addition
+         if(digit != 0)
+         {
+#if (EC_BASE_TABLE_SUPPORT == ENABLED)
+            //Precomputed table?
+            if(j == 1 && table != NULL)
+            {
+               //Length of the coordinates, in bytes
+               pLen = mpiGetByteLength(&params->p);
+
+               //The digit is odd and its absolute value is (2.index + 1)
+               index = (digit < 0) ? (uint_t) (-digit) >> 1 : (uint_t) digit >> 1;
+               //Point to the corresponding entry
+               entry = table->data + index * 2 * pLen;
+
+               //Import the selected point
+               MPI_CHECK(mpiImport(&t.x, entry, pLen, MPI_FORMAT_BIG_ENDIAN));
+               MPI_CHECK(mpiImport(&t.y, entry + pLen, pLen,
+                  MPI_FORMAT_BIG_ENDIAN));
+
+               //Compute R = R + digit.S
+               if(digit > 0)
+               {
+                  EC_CHECK(ecFullAdd(params, r, r, &t));
+               }
+               else
+               {
+                  EC_CHECK(ecFullSub(params, r, r, &t));
+               }
+            }
+            else
+#endif
+            {
+               //Compute R = R + digit.S
+               if(digit > 0)
+               {
+                  EC_CHECK(ecFullAdd(params, r, r, &s[j][digit >> 1]));
+               }
+               else
+               {
+                  EC_CHECK(ecFullSub(params, r, r, &s[j][(-digit) >> 1]));
+               }
+            }
+         }
+      }
+   }
+
+end:
+   //Release EC points
+   for(j = 0; j < 2; j++)
+   {
+      for(i = 0; i < n; i++)
+      {
+         ecFree(&s[j][i]);
+      }
+   }
+
+   ecFree(&t);
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Width-w non-adjacent form of a scalar
+ *
+ * Every non-zero digit is odd, lies in the range -2^(w - 1) < digit < 2^(w - 1)
+ * and is followed by at least w - 1 zero digits
+ *
+ * @param[out] naf Recoded scalar (8 * length + 1 digits, the least
+ *   significant one first)
+ * @param[in] k Scalar, in big-endian format
+ * @param[in] length Length of the scalar, in bytes
+ * @param[in] w Width of the recoding (2 <= w <= 7)
+ **/
+
+void ecComputeWnaf(int8_t *naf, const uint8_t *k, size_t length, uint_t w)
+{
+   uint_t i;
+   uint_t j;
+   uint_t n;
+   uint_t c;
+   uint_t bit;
+   uint_t carry;
+
+   //Number of bits of the scalar
+   n = length * 8;
+
+   //Clear the recoded scalar
+   osMemset(naf, 0, n + 1);
+
+   //Scan the scalar from the least significant bit
+   for(carry = 0, i = 0; i <= n; )
+   {
+      //Retrieve the current bit
+      bit = (i < n) ? (k[length - 1 - i / 8] >> (i % 8)) & 1 : 0;
+
+      //The current digit is zero if the sum of the bit and the carry is even
+      if(bit == carry)
+      {
+         i++;
+      }
+      else
+      {
+         //Extract a window of w bits
+         for(c = 0, j = 0; j < w && (i + j) < n; j++)
+         {
+            c |= ((k[length - 1 - (i + j) / 8] >> ((i + j) % 8)) & 1) << j;
+         }
+
+         //Add the carry
+         c = (c + carry) & ((1 << w) - 1);
+
+         //Select the digit of smallest absolute value
+         if(c >= (1U << (w - 1)))
+         {
+            naf[i] = (int8_t) ((int_t) c - (1 << w));
+            carry = 1;
+         }
+         else
+         {
+            naf[i] = (int8_t) c;
+            carry = 0;
+         }
+
+         //The next w - 1 digits are zero
+         i += w;
+      }
+   }
+}
+
+
 /**
  * @brief Fast modular addition
  * @param[in] params EC domain parameters
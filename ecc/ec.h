@@ -35,6 +35,45 @@
 #include "core/crypto.h"
 #include "ecc/ec_curves.h"
 
+//Precomputed multiples of public keys (signature verification)
+#ifndef EC_BASE_TABLE_SUPPORT
+   #define EC_BASE_TABLE_SUPPORT DISABLED
+#elif (EC_BASE_TABLE_SUPPORT != ENABLED && EC_BASE_TABLE_SUPPORT != DISABLED)
+   #error EC_BASE_TABLE_SUPPORT parameter is not valid
+#elif (EC_BASE_TABLE_SUPPORT == ENABLED && CRYPTO_STATIC_MEM_SUPPORT == ENABLED)
+   #error EC_BASE_TABLE_SUPPORT requires dynamic memory allocation
+#endif
+
+//Preloaded EC domain parameters
+#ifndef EC_PRELOADED_PARAMS_SUPPORT
+   #if (CRYPTO_STATIC_MEM_SUPPORT == ENABLED)
+      #define EC_PRELOADED_PARAMS_SUPPORT DISABLED
+   #else
+      #define EC_PRELOADED_PARAMS_SUPPORT ENABLED
+   #endif
+#elif (EC_PRELOADED_PARAMS_SUPPORT != ENABLED && EC_PRELOADED_PARAMS_SUPPORT != DISABLED)
+   #error EC_PRELOADED_PARAMS_SUPPORT parameter is not valid
+#elif (EC_PRELOADED_PARAMS_SUPPORT == ENABLED && CRYPTO_STATIC_MEM_SUPPORT == ENABLED)
+   #error EC_PRELOADED_PARAMS_SUPPORT requires dynamic memory allocation
+#endif
+
+//Window size used by the fixed-base scalar multiplication
+#ifndef EC_BASE_TABLE_WINDOW_SIZE
+   #define EC_BASE_TABLE_WINDOW_SIZE 4
+#elif (EC_BASE_TABLE_WINDOW_SIZE < 2 || EC_BASE_TABLE_WINDOW_SIZE > 7)
+   #error EC_BASE_TABLE_WINDOW_SIZE parameter is not valid
+#endif
+
+//Window size used by the variable-base scalar multiplication
+#ifndef EC_MULT_WINDOW_SIZE
+   #define EC_MULT_WINDOW_SIZE 4
+#elif (EC_MULT_WINDOW_SIZE < 2 || EC_MULT_WINDOW_SIZE > 6)
+   #error EC_MULT_WINDOW_SIZE parameter is not valid
+#endif
+
+//Maximum size, in bytes, of the prime modulus and of the order
+#define EC_MAX_MODULUS_SIZE 66
+
 //Error code checking
 #define EC_CHECK(f) if((error = f) != NO_ERROR) goto end
 
@@ -72,7 +111,7 @@ typedef struct
  * @brief EC domain parameters
  **/
 
-typedef struct
+typedef struct _EcDomainParameters
 {
    const char_t *name; ///<Curve name
    EcCurveType type;   ///<Curve type
@@ -86,13 +125,33 @@ typedef struct
 } EcDomainParameters;
 
 
+/**
+ * @brief Precomputed multiples of an EC public key
+ *
+ * The table speeds up the verification of the signatures generated with the
+ * same key. Since its computation costs several signature verifications,
+ * the table is only built on request (refer to ecPrecomputePublicKey)
+ *
+ **/
+
+typedef struct
+{
+   const char_t *curveName;            ///<Curve for which the table was built
+   uint8_t q[2 * EC_MAX_MODULUS_SIZE]; ///<Affine coordinates of the public key
+   EcBaseTable table;                  ///<Precomputed multiples of the public key
+} EcPublicKeyCache;
+
+
 /**
  * @brief EC public key
  **/
 
 typedef struct
 {
-   EcPoint q; ///<Public key
+   EcPoint q;              ///<Public key
+#if (EC_BASE_TABLE_SUPPORT == ENABLED)
+   EcPublicKeyCache cache; ///<Precomputed multiples of the public key (optional)
+#endif
 } EcPublicKey;
 
 
@@ -117,9 +176,18 @@ void ecFreeDomainParameters(EcDomainParameters *params);
 error_t ecLoadDomainParameters(EcDomainParameters *params,
    const EcCurveInfo *curveInfo);
 
+const EcDomainParameters *ecGetDomainParameters(const uint8_t *oid,
+   size_t length);
+
+error_t ecRetrieveDomainParameters(const EcCurveInfo *curveInfo,
+   EcDomainParameters *ecParams, const EcDomainParameters **params);
+
 void ecInitPublicKey(EcPublicKey *key);
 void ecFreePublicKey(EcPublicKey *key);
 
+error_t ecPrecomputePublicKey(const EcDomainParameters *params,
+   EcPublicKey *key);
+
 void ecInitPrivateKey(EcPrivateKey *key);
 void ecFreePrivateKey(EcPrivateKey *key);
 
@@ -137,6 +205,8 @@ void ecInit(EcPoint *r);
 void ecFree(EcPoint *r);
 
 error_t ecCopy(EcPoint *r, const EcPoint *s);
+error_t ecGrowPoint(EcPoint *r, uint_t n);
+void ecCondCopy(EcPoint *r, const EcPoint *s, uint_t n, uint_t mask);
 
 error_t ecImport(const EcDomainParameters *params, EcPoint *r,
    const uint8_t *data, size_t length);
@@ -150,6 +220,9 @@ error_t ecProjectify(const EcDomainParameters *params, EcPoint *r,
 error_t ecAffinify(const EcDomainParameters *params, EcPoint *r,
    const EcPoint *s);
 
+error_t ecAffinifyBatch(const EcDomainParameters *params, EcPoint *r,
+   const EcPoint *s, uint_t n);
+
 bool_t ecIsPointAffine(const EcDomainParameters *params, const EcPoint *s);
 
 error_t ecDouble(const EcDomainParameters *params, EcPoint *r,
@@ -167,9 +240,17 @@ error_t ecFullSub(const EcDomainParameters *params, EcPoint *r,
 error_t ecMult(const EcDomainParameters *params, EcPoint *r, const Mpi *d,
    const EcPoint *s);
 
+error_t ecMultBase(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d);
+
 error_t ecTwinMult(const EcDomainParameters *params, EcPoint *r,
    const Mpi *d0, const EcPoint *s, const Mpi *d1, const EcPoint *t);
 
+error_t ecTwinMultBase(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d0, const Mpi *d1, const EcPublicKey *key);
+
+void ecComputeWnaf(int8_t *naf, const uint8_t *k, size_t length, uint_t w);
+
 error_t ecAddMod(const EcDomainParameters *params, Mpi *r, const Mpi *a,
    const Mpi *b);
 
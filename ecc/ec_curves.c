@@ -33,6 +33,7 @@
 
 //Dependencies
 #include "core/crypto.h"
+#include "ecc/ec.h"
 #include "ecc/ec_curves.h"
 #include "encoding/oid.h"
 #include "debug.h"
@@ -44,6 +45,21 @@
 #define CLEAR_WORD32(a, i, n) osMemset((a)->data + i, 0, n * MPI_INT_SIZE);
 #define COPY_WORD32(a, i, b, j, n) osMemcpy((a)->data + i, (b)->data + j, n * MPI_INT_SIZE);
 
+//Preloaded EC domain parameters
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Read-only multiple precision integer pointing to a constant array of words
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   #define EC_PRELOADED_MPI(a) {1, sizeof(a) / MPI_INT_SIZE, (uint_t *) (a), NULL, 0, FALSE}
+#else
+   #define EC_PRELOADED_MPI(a) {1, sizeof(a) / MPI_INT_SIZE, (uint_t *) (a)}
+#endif
+
+//The z-coordinate of the base point is 1
+static const uint_t EC_PRELOADED_ONE[1] = {1};
+
+#endif
+
 //secp112r1 OID (1.3.132.0.6)
 const uint8_t SECP112R1_OID[5] = {0x2B, 0x81, 0x04, 0x00, 0x06};
 //secp112r2 OID (1.3.132.0.7)
@@ -102,6 +118,76 @@ const uint8_t ED448_OID[3] = {0x2B, 0x65, 0x71};
 
 #if (SECP112R1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP112R1_P[4] =
+{
+   0xBEAD208B, 0x5E668076, 0x2ABF62E3, 0x0000DB7C
+};
+
+//Curve parameter a
+static const uint_t SECP112R1_A[4] =
+{
+   0xBEAD2088, 0x5E668076, 0x2ABF62E3, 0x0000DB7C
+};
+
+//Curve parameter b
+static const uint_t SECP112R1_B[4] =
+{
+   0x11702B22, 0x16EEDE89, 0xF8BA0439, 0x0000659E
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP112R1_GX[4] =
+{
+   0xF9C2F098, 0x5EE76B55, 0x7239995A, 0x00000948
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP112R1_GY[4] =
+{
+   0x0FF77500, 0xC0A23E0E, 0xE5AF8724, 0x0000A89C
+};
+
+//Base point order q
+static const uint_t SECP112R1_Q[4] =
+{
+   0xAC6561C5, 0x5E7628DF, 0x2ABF62E3, 0x0000DB7C
+};
+
+/**
+ * @brief Preloaded secp112r1 domain parameters
+ **/
+
+static const EcDomainParameters secp112r1Params =
+{
+   //Curve name
+   "secp112r1",
+   //Curve type
+   EC_CURVE_TYPE_SECP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP112R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP112R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP112R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP112R1_GX),
+      EC_PRELOADED_MPI(SECP112R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP112R1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   NULL
+};
+
+#endif
+
 /**
  * @brief secp112r1 elliptic curve
  **/
@@ -136,12 +222,86 @@ const EcCurveInfo secp112r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   NULL
+   NULL,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp112r1Params
+#endif
 };
 
 #endif
 #if (SECP112R2_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP112R2_P[4] =
+{
+   0xBEAD208B, 0x5E668076, 0x2ABF62E3, 0x0000DB7C
+};
+
+//Curve parameter a
+static const uint_t SECP112R2_A[4] =
+{
+   0x5C0EF02C, 0x8A0AAAF6, 0xC24C05F3, 0x00006127
+};
+
+//Curve parameter b
+static const uint_t SECP112R2_B[4] =
+{
+   0x4C85D709, 0xED74FCC3, 0xF1815DB5, 0x000051DE
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP112R2_GX[4] =
+{
+   0xD0928643, 0xB4E1649D, 0x0AB5E892, 0x00004BA3
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP112R2_GY[4] =
+{
+   0x6E956E97, 0x3747DEF3, 0x46F5882E, 0x0000ADCD
+};
+
+//Base point order q
+static const uint_t SECP112R2_Q[4] =
+{
+   0x0520D04B, 0xD7597CA1, 0x0AAFD8B8, 0x000036DF
+};
+
+/**
+ * @brief Preloaded secp112r2 domain parameters
+ **/
+
+static const EcDomainParameters secp112r2Params =
+{
+   //Curve name
+   "secp112r2",
+   //Curve type
+   EC_CURVE_TYPE_SECP_R2,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP112R2_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP112R2_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP112R2_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP112R2_GX),
+      EC_PRELOADED_MPI(SECP112R2_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP112R2_Q),
+   //Cofactor
+   4,
+   //Fast modular reduction
+   NULL
+};
+
+#endif
+
 /**
  * @brief secp112r2 elliptic curve
  **/
@@ -176,12 +336,86 @@ const EcCurveInfo secp112r2Curve =
    //Cofactor
    4,
    //Fast modular reduction
-   NULL
+   NULL,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp112r2Params
+#endif
 };
 
 #endif
 #if (SECP128R1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP128R1_P[4] =
+{
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFD
+};
+
+//Curve parameter a
+static const uint_t SECP128R1_A[4] =
+{
+   0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFD
+};
+
+//Curve parameter b
+static const uint_t SECP128R1_B[4] =
+{
+   0x2CEE5ED3, 0xD824993C, 0x1079F43D, 0xE87579C1
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP128R1_GX[4] =
+{
+   0xA52C5B86, 0x0C28607C, 0x8B899B2D, 0x161FF752
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP128R1_GY[4] =
+{
+   0xDDED7A83, 0xC02DA292, 0x5BAFEB13, 0xCF5AC839
+};
+
+//Base point order q
+static const uint_t SECP128R1_Q[4] =
+{
+   0x9038A115, 0x75A30D1B, 0x00000000, 0xFFFFFFFE
+};
+
+/**
+ * @brief Preloaded secp128r1 domain parameters
+ **/
+
+static const EcDomainParameters secp128r1Params =
+{
+   //Curve name
+   "secp128r1",
+   //Curve type
+   EC_CURVE_TYPE_SECP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP128R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP128R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP128R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP128R1_GX),
+      EC_PRELOADED_MPI(SECP128R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP128R1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   secp128r1Mod
+};
+
+#endif
+
 /**
  * @brief secp128r1 elliptic curve
  **/
@@ -216,12 +450,86 @@ const EcCurveInfo secp128r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp128r1Mod
+   secp128r1Mod,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp128r1Params
+#endif
 };
 
 #endif
 #if (SECP128R2_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP128R2_P[4] =
+{
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFD
+};
+
+//Curve parameter a
+static const uint_t SECP128R2_A[4] =
+{
+   0xBFF9AEE1, 0xBF59CC9B, 0xD1B3BBFE, 0xD6031998
+};
+
+//Curve parameter b
+static const uint_t SECP128R2_B[4] =
+{
+   0xBB6D8A5D, 0xDC2C6558, 0x80D02919, 0x5EEEFCA3
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP128R2_GX[4] =
+{
+   0xCDEBC140, 0xE6FB32A7, 0x5E572983, 0x7B6AA5D8
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP128R2_GY[4] =
+{
+   0x5FC34B44, 0x7106FE80, 0x894D3AEE, 0x27B6916A
+};
+
+//Base point order q
+static const uint_t SECP128R2_Q[4] =
+{
+   0x0613B5A3, 0xBE002472, 0x7FFFFFFF, 0x3FFFFFFF
+};
+
+/**
+ * @brief Preloaded secp128r2 domain parameters
+ **/
+
+static const EcDomainParameters secp128r2Params =
+{
+   //Curve name
+   "secp128r2",
+   //Curve type
+   EC_CURVE_TYPE_SECP_R2,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP128R2_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP128R2_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP128R2_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP128R2_GX),
+      EC_PRELOADED_MPI(SECP128R2_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP128R2_Q),
+   //Cofactor
+   4,
+   //Fast modular reduction
+   secp128r2Mod
+};
+
+#endif
+
 /**
  * @brief secp128r2 elliptic curve
  **/
@@ -256,12 +564,92 @@ const EcCurveInfo secp128r2Curve =
    //Cofactor
    4,
    //Fast modular reduction
-   secp128r2Mod
+   secp128r2Mod,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp128r2Params
+#endif
 };
 
 #endif
 #if (SECP160K1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP160K1_P[5] =
+{
+   0xFFFFAC73, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF
+};
+
+//Curve parameter a
+static const uint_t SECP160K1_A[5] =
+{
+   0x00000000, 0x00000000, 0x00000000, 0x00000000,
+   0x00000000
+};
+
+//Curve parameter b
+static const uint_t SECP160K1_B[5] =
+{
+   0x00000007, 0x00000000, 0x00000000, 0x00000000,
+   0x00000000
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP160K1_GX[5] =
+{
+   0xDD4D7EBB, 0x3036F4F5, 0xA4019E76, 0xE37AA192,
+   0x3B4C382C
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP160K1_GY[5] =
+{
+   0xF03C4FEE, 0x531733C3, 0x6BC28286, 0x318FDCED,
+   0x938CF935
+};
+
+//Base point order q
+static const uint_t SECP160K1_Q[6] =
+{
+   0xCA16B6B3, 0x16DFAB9A, 0x0001B8FA, 0x00000000,
+   0x00000000, 0x00000001
+};
+
+/**
+ * @brief Preloaded secp160k1 domain parameters
+ **/
+
+static const EcDomainParameters secp160k1Params =
+{
+   //Curve name
+   "secp160k1",
+   //Curve type
+   EC_CURVE_TYPE_SECP_K1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP160K1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP160K1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP160K1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP160K1_GX),
+      EC_PRELOADED_MPI(SECP160K1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP160K1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   secp160k1Mod
+};
+
+#endif
+
 /**
  * @brief secp160k1 elliptic curve
  **/
@@ -302,12 +690,92 @@ const EcCurveInfo secp160k1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp160k1Mod
+   secp160k1Mod,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp160k1Params
+#endif
 };
 
 #endif
 #if (SECP160R1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP160R1_P[5] =
+{
+   0x7FFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF
+};
+
+//Curve parameter a
+static const uint_t SECP160R1_A[5] =
+{
+   0x7FFFFFFC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF
+};
+
+//Curve parameter b
+static const uint_t SECP160R1_B[5] =
+{
+   0xC565FA45, 0x81D4D4AD, 0x65ACF89F, 0x54BD7A8B,
+   0x1C97BEFC
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP160R1_GX[5] =
+{
+   0x13CBFC82, 0x68C38BB9, 0x46646989, 0x8EF57328,
+   0x4A96B568
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP160R1_GY[5] =
+{
+   0x7AC5FB32, 0x04235137, 0x59DCC912, 0x3168947D,
+   0x23A62855
+};
+
+//Base point order q
+static const uint_t SECP160R1_Q[6] =
+{
+   0xCA752257, 0xF927AED3, 0x0001F4C8, 0x00000000,
+   0x00000000, 0x00000001
+};
+
+/**
+ * @brief Preloaded secp160r1 domain parameters
+ **/
+
+static const EcDomainParameters secp160r1Params =
+{
+   //Curve name
+   "secp160r1",
+   //Curve type
+   EC_CURVE_TYPE_SECP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP160R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP160R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP160R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP160R1_GX),
+      EC_PRELOADED_MPI(SECP160R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP160R1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   secp160r1Mod
+};
+
+#endif
+
 /**
  * @brief secp160r1 elliptic curve
  **/
@@ -348,12 +816,92 @@ const EcCurveInfo secp160r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp160r1Mod
+   secp160r1Mod,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp160r1Params
+#endif
 };
 
 #endif
 #if (SECP160R2_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP160R2_P[5] =
+{
+   0xFFFFAC73, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF
+};
+
+//Curve parameter a
+static const uint_t SECP160R2_A[5] =
+{
+   0xFFFFAC70, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF
+};
+
+//Curve parameter b
+static const uint_t SECP160R2_B[5] =
+{
+   0xF50388BA, 0x04664D5A, 0xAB572749, 0xFB59EB8B,
+   0xB4E134D3
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP160R2_GX[5] =
+{
+   0x3144CE6D, 0x30F7199D, 0x1F4FF11B, 0x293A117E,
+   0x52DCB034
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP160R2_GY[5] =
+{
+   0xA7D43F2E, 0xF9982CFE, 0xE071FA0D, 0xE331F296,
+   0xFEAFFEF2
+};
+
+//Base point order q
+static const uint_t SECP160R2_Q[6] =
+{
+   0xF3A1A16B, 0xE786A818, 0x0000351E, 0x00000000,
+   0x00000000, 0x00000001
+};
+
+/**
+ * @brief Preloaded secp160r2 domain parameters
+ **/
+
+static const EcDomainParameters secp160r2Params =
+{
+   //Curve name
+   "secp160r2",
+   //Curve type
+   EC_CURVE_TYPE_SECP_R2,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP160R2_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP160R2_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP160R2_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP160R2_GX),
+      EC_PRELOADED_MPI(SECP160R2_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP160R2_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   secp160r2Mod
+};
+
+#endif
+
 /**
  * @brief secp160r2 elliptic curve
  **/
@@ -394,12 +942,92 @@ const EcCurveInfo secp160r2Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp160r2Mod
+   secp160r2Mod,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp160r2Params
+#endif
 };
 
 #endif
 #if (SECP192K1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP192K1_P[6] =
+{
+   0xFFFFEE37, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF
+};
+
+//Curve parameter a
+static const uint_t SECP192K1_A[6] =
+{
+   0x00000000, 0x00000000, 0x00000000, 0x00000000,
+   0x00000000, 0x00000000
+};
+
+//Curve parameter b
+static const uint_t SECP192K1_B[6] =
+{
+   0x00000003, 0x00000000, 0x00000000, 0x00000000,
+   0x00000000, 0x00000000
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP192K1_GX[6] =
+{
+   0xEAE06C7D, 0x1DA5D1B1, 0x80B7F434, 0x26B07D02,
+   0xC057E9AE, 0xDB4FF10E
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP192K1_GY[6] =
+{
+   0xD95E2F9D, 0x4082AA88, 0x15BE8634, 0x844163D0,
+   0x9C5628A7, 0x9B2F2F6D
+};
+
+//Base point order q
+static const uint_t SECP192K1_Q[6] =
+{
+   0x74DEFD8D, 0x0F69466A, 0x26F2FC17, 0xFFFFFFFE,
+   0xFFFFFFFF, 0xFFFFFFFF
+};
+
+/**
+ * @brief Preloaded secp192k1 domain parameters
+ **/
+
+static const EcDomainParameters secp192k1Params =
+{
+   //Curve name
+   "secp192k1",
+   //Curve type
+   EC_CURVE_TYPE_SECP_K1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP192K1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP192K1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP192K1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP192K1_GX),
+      EC_PRELOADED_MPI(SECP192K1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP192K1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   secp192k1Mod
+};
+
+#endif
+
 /**
  * @brief secp192k1 elliptic curve
  **/
@@ -440,12 +1068,92 @@ const EcCurveInfo secp192k1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp192k1Mod
+   secp192k1Mod,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp192k1Params
+#endif
 };
 
 #endif
 #if (SECP192R1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP192R1_P[6] =
+{
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF
+};
+
+//Curve parameter a
+static const uint_t SECP192R1_A[6] =
+{
+   0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFE, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF
+};
+
+//Curve parameter b
+static const uint_t SECP192R1_B[6] =
+{
+   0xC146B9B1, 0xFEB8DEEC, 0x72243049, 0x0FA7E9AB,
+   0xE59C80E7, 0x64210519
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP192R1_GX[6] =
+{
+   0x82FF1012, 0xF4FF0AFD, 0x43A18800, 0x7CBF20EB,
+   0xB03090F6, 0x188DA80E
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP192R1_GY[6] =
+{
+   0x1E794811, 0x73F977A1, 0x6B24CDD5, 0x631011ED,
+   0xFFC8DA78, 0x07192B95
+};
+
+//Base point order q
+static const uint_t SECP192R1_Q[6] =
+{
+   0xB4D22831, 0x146BC9B1, 0x99DEF836, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF
+};
+
+/**
+ * @brief Preloaded secp192r1 domain parameters
+ **/
+
+static const EcDomainParameters secp192r1Params =
+{
+   //Curve name
+   "secp192r1",
+   //Curve type
+   EC_CURVE_TYPE_SECP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP192R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP192R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP192R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP192R1_GX),
+      EC_PRELOADED_MPI(SECP192R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP192R1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   secp192r1Mod
+};
+
+#endif
+
 /**
  * @brief secp192r1 elliptic curve
  **/
@@ -486,12 +1194,92 @@ const EcCurveInfo secp192r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp192r1Mod
+   secp192r1Mod,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp192r1Params
+#endif
 };
 
 #endif
 #if (SECP224K1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP224K1_P[7] =
+{
+   0xFFFFE56D, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+//Curve parameter a
+static const uint_t SECP224K1_A[7] =
+{
+   0x00000000, 0x00000000, 0x00000000, 0x00000000,
+   0x00000000, 0x00000000, 0x00000000
+};
+
+//Curve parameter b
+static const uint_t SECP224K1_B[7] =
+{
+   0x00000005, 0x00000000, 0x00000000, 0x00000000,
+   0x00000000, 0x00000000, 0x00000000
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP224K1_GX[7] =
+{
+   0xB6B7A45C, 0x0F7E650E, 0xE47075A9, 0x69A467E9,
+   0x30FC28A1, 0x4DF099DF, 0xA1455B33
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP224K1_GY[7] =
+{
+   0x556D61A5, 0xE2CA4BDB, 0xC0B0BD59, 0xF7E319F7,
+   0x82CAFBD6, 0x7FBA3442, 0x7E089FED
+};
+
+//Base point order q
+static const uint_t SECP224K1_Q[8] =
+{
+   0x769FB1F7, 0xCAF0A971, 0xD2EC6184, 0x0001DCE8,
+   0x00000000, 0x00000000, 0x00000000, 0x00000001
+};
+
+/**
+ * @brief Preloaded secp224k1 domain parameters
+ **/
+
+static const EcDomainParameters secp224k1Params =
+{
+   //Curve name
+   "secp224k1",
+   //Curve type
+   EC_CURVE_TYPE_SECP_K1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP224K1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP224K1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP224K1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP224K1_GX),
+      EC_PRELOADED_MPI(SECP224K1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP224K1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   secp224k1Mod
+};
+
+#endif
+
 /**
  * @brief secp224k1 elliptic curve
  **/
@@ -532,12 +1320,92 @@ const EcCurveInfo secp224k1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp224k1Mod
+   secp224k1Mod,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp224k1Params
+#endif
 };
 
 #endif
 #if (SECP224R1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP224R1_P[7] =
+{
+   0x00000001, 0x00000000, 0x00000000, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+//Curve parameter a
+static const uint_t SECP224R1_A[7] =
+{
+   0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+//Curve parameter b
+static const uint_t SECP224R1_B[7] =
+{
+   0x2355FFB4, 0x270B3943, 0xD7BFD8BA, 0x5044B0B7,
+   0xF5413256, 0x0C04B3AB, 0xB4050A85
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP224R1_GX[7] =
+{
+   0x115C1D21, 0x343280D6, 0x56C21122, 0x4A03C1D3,
+   0x321390B9, 0x6BB4BF7F, 0xB70E0CBD
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP224R1_GY[7] =
+{
+   0x85007E34, 0x44D58199, 0x5A074764, 0xCD4375A0,
+   0x4C22DFE6, 0xB5F723FB, 0xBD376388
+};
+
+//Base point order q
+static const uint_t SECP224R1_Q[7] =
+{
+   0x5C5C2A3D, 0x13DD2945, 0xE0B8F03E, 0xFFFF16A2,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+/**
+ * @brief Preloaded secp224r1 domain parameters
+ **/
+
+static const EcDomainParameters secp224r1Params =
+{
+   //Curve name
+   "secp224r1",
+   //Curve type
+   EC_CURVE_TYPE_SECP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP224R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP224R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP224R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP224R1_GX),
+      EC_PRELOADED_MPI(SECP224R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP224R1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   secp224r1Mod
+};
+
+#endif
+
 /**
  * @brief secp224r1 elliptic curve
  **/
@@ -578,12 +1446,92 @@ const EcCurveInfo secp224r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp224r1Mod
+   secp224r1Mod,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp224r1Params
+#endif
 };
 
 #endif
 #if (SECP256K1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP256K1_P[8] =
+{
+   0xFFFFFC2F, 0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+//Curve parameter a
+static const uint_t SECP256K1_A[8] =
+{
+   0x00000000, 0x00000000, 0x00000000, 0x00000000,
+   0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+
+//Curve parameter b
+static const uint_t SECP256K1_B[8] =
+{
+   0x00000007, 0x00000000, 0x00000000, 0x00000000,
+   0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP256K1_GX[8] =
+{
+   0x16F81798, 0x59F2815B, 0x2DCE28D9, 0x029BFCDB,
+   0xCE870B07, 0x55A06295, 0xF9DCBBAC, 0x79BE667E
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP256K1_GY[8] =
+{
+   0xFB10D4B8, 0x9C47D08F, 0xA6855419, 0xFD17B448,
+   0x0E1108A8, 0x5DA4FBFC, 0x26A3C465, 0x483ADA77
+};
+
+//Base point order q
+static const uint_t SECP256K1_Q[8] =
+{
+   0xD0364141, 0xBFD25E8C, 0xAF48A03B, 0xBAAEDCE6,
+   0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+/**
+ * @brief Preloaded secp256k1 domain parameters
+ **/
+
+static const EcDomainParameters secp256k1Params =
+{
+   //Curve name
+   "secp256k1",
+   //Curve type
+   EC_CURVE_TYPE_SECP_K1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP256K1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP256K1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP256K1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP256K1_GX),
+      EC_PRELOADED_MPI(SECP256K1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP256K1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   secp256k1Mod
+};
+
+#endif
+
 /**
  * @brief secp256k1 elliptic curve
  **/
@@ -624,12 +1572,92 @@ const EcCurveInfo secp256k1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp256k1Mod
+   secp256k1Mod,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp256k1Params
+#endif
 };
 
 #endif
 #if (SECP256R1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP256R1_P[8] =
+{
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000,
+   0x00000000, 0x00000000, 0x00000001, 0xFFFFFFFF
+};
+
+//Curve parameter a
+static const uint_t SECP256R1_A[8] =
+{
+   0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000,
+   0x00000000, 0x00000000, 0x00000001, 0xFFFFFFFF
+};
+
+//Curve parameter b
+static const uint_t SECP256R1_B[8] =
+{
+   0x27D2604B, 0x3BCE3C3E, 0xCC53B0F6, 0x651D06B0,
+   0x769886BC, 0xB3EBBD55, 0xAA3A93E7, 0x5AC635D8
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP256R1_GX[8] =
+{
+   0xD898C296, 0xF4A13945, 0x2DEB33A0, 0x77037D81,
+   0x63A440F2, 0xF8BCE6E5, 0xE12C4247, 0x6B17D1F2
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP256R1_GY[8] =
+{
+   0x37BF51F5, 0xCBB64068, 0x6B315ECE, 0x2BCE3357,
+   0x7C0F9E16, 0x8EE7EB4A, 0xFE1A7F9B, 0x4FE342E2
+};
+
+//Base point order q
+static const uint_t SECP256R1_Q[8] =
+{
+   0xFC632551, 0xF3B9CAC2, 0xA7179E84, 0xBCE6FAAD,
+   0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0xFFFFFFFF
+};
+
+/**
+ * @brief Preloaded secp256r1 domain parameters
+ **/
+
+static const EcDomainParameters secp256r1Params =
+{
+   //Curve name
+   "secp256r1",
+   //Curve type
+   EC_CURVE_TYPE_SECP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP256R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP256R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP256R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP256R1_GX),
+      EC_PRELOADED_MPI(SECP256R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP256R1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   secp256r1Mod
+};
+
+#endif
+
 /**
  * @brief secp256r1 elliptic curve
  **/
@@ -670,12 +1698,98 @@ const EcCurveInfo secp256r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp256r1Mod
+   secp256r1Mod,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp256r1Params
+#endif
 };
 
 #endif
 #if (SECP384R1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP384R1_P[12] =
+{
+   0xFFFFFFFF, 0x00000000, 0x00000000, 0xFFFFFFFF,
+   0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+//Curve parameter a
+static const uint_t SECP384R1_A[12] =
+{
+   0xFFFFFFFC, 0x00000000, 0x00000000, 0xFFFFFFFF,
+   0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+//Curve parameter b
+static const uint_t SECP384R1_B[12] =
+{
+   0xD3EC2AEF, 0x2A85C8ED, 0x8A2ED19D, 0xC656398D,
+   0x5013875A, 0x0314088F, 0xFE814112, 0x181D9C6E,
+   0xE3F82D19, 0x988E056B, 0xE23EE7E4, 0xB3312FA7
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP384R1_GX[12] =
+{
+   0x72760AB7, 0x3A545E38, 0xBF55296C, 0x5502F25D,
+   0x82542A38, 0x59F741E0, 0x8BA79B98, 0x6E1D3B62,
+   0xF320AD74, 0x8EB1C71E, 0xBE8B0537, 0xAA87CA22
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP384R1_GY[12] =
+{
+   0x90EA0E5F, 0x7A431D7C, 0x1D7E819D, 0x0A60B1CE,
+   0xB5F0B8C0, 0xE9DA3113, 0x289A147C, 0xF8F41DBD,
+   0x9292DC29, 0x5D9E98BF, 0x96262C6F, 0x3617DE4A
+};
+
+//Base point order q
+static const uint_t SECP384R1_Q[12] =
+{
+   0xCCC52973, 0xECEC196A, 0x48B0A77A, 0x581A0DB2,
+   0xF4372DDF, 0xC7634D81, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+/**
+ * @brief Preloaded secp384r1 domain parameters
+ **/
+
+static const EcDomainParameters secp384r1Params =
+{
+   //Curve name
+   "secp384r1",
+   //Curve type
+   EC_CURVE_TYPE_SECP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP384R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP384R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP384R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP384R1_GX),
+      EC_PRELOADED_MPI(SECP384R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP384R1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   secp384r1Mod
+};
+
+#endif
+
 /**
  * @brief secp384r1 elliptic curve
  **/
@@ -722,12 +1836,110 @@ const EcCurveInfo secp384r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp384r1Mod
+   secp384r1Mod,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp384r1Params
+#endif
 };
 
 #endif
 #if (SECP521R1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SECP521R1_P[17] =
+{
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0x000001FF
+};
+
+//Curve parameter a
+static const uint_t SECP521R1_A[17] =
+{
+   0xFFFFFFFC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0x000001FF
+};
+
+//Curve parameter b
+static const uint_t SECP521R1_B[17] =
+{
+   0x6B503F00, 0xEF451FD4, 0x3D2C34F1, 0x3573DF88,
+   0x3BB1BF07, 0x1652C0BD, 0xEC7E937B, 0x56193951,
+   0x8EF109E1, 0xB8B48991, 0x99B315F3, 0xA2DA725B,
+   0xB68540EE, 0x929A21A0, 0x8E1C9A1F, 0x953EB961,
+   0x00000051
+};
+
+//x-coordinate of the base point G
+static const uint_t SECP521R1_GX[17] =
+{
+   0xC2E5BD66, 0xF97E7E31, 0x856A429B, 0x3348B3C1,
+   0xA2FFA8DE, 0xFE1DC127, 0xEFE75928, 0xA14B5E77,
+   0x6B4D3DBA, 0xF828AF60, 0x053FB521, 0x9C648139,
+   0x2395B442, 0x9E3ECB66, 0x0404E9CD, 0x858E06B7,
+   0x000000C6
+};
+
+//y-coordinate of the base point G
+static const uint_t SECP521R1_GY[17] =
+{
+   0x9FD16650, 0x88BE9476, 0xA272C240, 0x353C7086,
+   0x3FAD0761, 0xC550B901, 0x5EF42640, 0x97EE7299,
+   0x273E662C, 0x17AFBD17, 0x579B4468, 0x98F54449,
+   0x2C7D1BD9, 0x5C8A5FB4, 0x9A3BC004, 0x39296A78,
+   0x00000118
+};
+
+//Base point order q
+static const uint_t SECP521R1_Q[17] =
+{
+   0x91386409, 0xBB6FB71E, 0x899C47AE, 0x3BB5C9B8,
+   0xF709A5D0, 0x7FCC0148, 0xBF2F966B, 0x51868783,
+   0xFFFFFFFA, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0x000001FF
+};
+
+/**
+ * @brief Preloaded secp521r1 domain parameters
+ **/
+
+static const EcDomainParameters secp521r1Params =
+{
+   //Curve name
+   "secp521r1",
+   //Curve type
+   EC_CURVE_TYPE_SECP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SECP521R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SECP521R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SECP521R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SECP521R1_GX),
+      EC_PRELOADED_MPI(SECP521R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SECP521R1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   secp521r1Mod
+};
+
+#endif
+
 /**
  * @brief secp521r1 elliptic curve
  **/
@@ -786,12 +1998,92 @@ const EcCurveInfo secp521r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   secp521r1Mod
+   secp521r1Mod,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &secp521r1Params
+#endif
 };
 
 #endif
 #if (BRAINPOOLP160R1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t BRAINPOOLP160R1_P[5] =
+{
+   0x9515620F, 0x95B3D813, 0x60DFC7AD, 0x737059DC,
+   0xE95E4A5F
+};
+
+//Curve parameter a
+static const uint_t BRAINPOOLP160R1_A[5] =
+{
+   0xE8F7C300, 0xDA745D97, 0xE2BE61BA, 0xA280EB74,
+   0x340E7BE2
+};
+
+//Curve parameter b
+static const uint_t BRAINPOOLP160R1_B[5] =
+{
+   0xD8675E58, 0xBDEC95C8, 0x134FAA2D, 0x95423412,
+   0x1E589A85
+};
+
+//x-coordinate of the base point G
+static const uint_t BRAINPOOLP160R1_GX[5] =
+{
+   0xBDBCDBC3, 0x31EB5AF7, 0x62938C46, 0xEA3F6A4F,
+   0xBED5AF16
+};
+
+//y-coordinate of the base point G
+static const uint_t BRAINPOOLP160R1_GY[5] =
+{
+   0x16DA6321, 0x669C9763, 0x38F94741, 0x7A1A8EC3,
+   0x1667CB47
+};
+
+//Base point order q
+static const uint_t BRAINPOOLP160R1_Q[5] =
+{
+   0x9E60FC09, 0xD4502940, 0x60DF5991, 0x737059DC,
+   0xE95E4A5F
+};
+
+/**
+ * @brief Preloaded brainpoolP160r1 domain parameters
+ **/
+
+static const EcDomainParameters brainpoolP160r1Params =
+{
+   //Curve name
+   "brainpoolP160r1",
+   //Curve type
+   EC_CURVE_TYPE_BRAINPOOLP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(BRAINPOOLP160R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(BRAINPOOLP160R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(BRAINPOOLP160R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(BRAINPOOLP160R1_GX),
+      EC_PRELOADED_MPI(BRAINPOOLP160R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(BRAINPOOLP160R1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   NULL
+};
+
+#endif
+
 /**
  * @brief brainpoolP160r1 elliptic curve
  **/
@@ -832,12 +2124,92 @@ const EcCurveInfo brainpoolP160r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   NULL
+   NULL,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &brainpoolP160r1Params
+#endif
 };
 
 #endif
 #if (BRAINPOOLP192R1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t BRAINPOOLP192R1_P[6] =
+{
+   0xE1A86297, 0x8FCE476D, 0x93D18DB7, 0xA7A34630,
+   0x932A36CD, 0xC302F41D
+};
+
+//Curve parameter a
+static const uint_t BRAINPOOLP192R1_A[6] =
+{
+   0xC69A28EF, 0xCAE040E5, 0xFE8685C1, 0x9C39C031,
+   0x76B1E0E1, 0x6A911740
+};
+
+//Curve parameter b
+static const uint_t BRAINPOOLP192R1_B[6] =
+{
+   0x6FBF25C9, 0xCA7EF414, 0x4F4496BC, 0xDC721D04,
+   0x7C28CCA3, 0x469A28EF
+};
+
+//x-coordinate of the base point G
+static const uint_t BRAINPOOLP192R1_GX[6] =
+{
+   0x53375FD6, 0x0A2F5C48, 0x6CB0F090, 0x53B033C5,
+   0xAAB6A487, 0xC0A0647E
+};
+
+//y-coordinate of the base point G
+static const uint_t BRAINPOOLP192R1_GY[6] =
+{
+   0xFA299B8F, 0xE6773FA2, 0xC1490002, 0x8B5F4828,
+   0x6ABD5BB8, 0x14B69086
+};
+
+//Base point order q
+static const uint_t BRAINPOOLP192R1_Q[6] =
+{
+   0x9AC4ACC1, 0x5BE8F102, 0x9E9E916B, 0xA7A3462F,
+   0x932A36CD, 0xC302F41D
+};
+
+/**
+ * @brief Preloaded brainpoolP192r1 domain parameters
+ **/
+
+static const EcDomainParameters brainpoolP192r1Params =
+{
+   //Curve name
+   "brainpoolP192r1",
+   //Curve type
+   EC_CURVE_TYPE_BRAINPOOLP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(BRAINPOOLP192R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(BRAINPOOLP192R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(BRAINPOOLP192R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(BRAINPOOLP192R1_GX),
+      EC_PRELOADED_MPI(BRAINPOOLP192R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(BRAINPOOLP192R1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   NULL
+};
+
+#endif
+
 /**
  * @brief brainpoolP192r1 elliptic curve
  **/
@@ -872,9 +2244,90 @@ const EcCurveInfo brainpoolP192r1Curve =
     0xE6, 0x77, 0x3F, 0xA2, 0xFA, 0x29, 0x9B, 0x8F},
    24,
    //Base point order q
-   {0xC3, 0x02, 0xF4, 0x1D, 0x93, 0x2A, 0x36, 0xCD, 0xA7, 0xA3, 0x46, 0x2F, 0x9E, 0x9E, 0x91, 0x6B,
-    0x5B, 0xE8, 0xF1, 0x02, 0x9A, 0xC4, 0xAC, 0xC1},
-   24,
+   {0xC3, 0x02, 0xF4, 0x1D, 0x93, 0x2A, 0x36, 0xCD, 0xA7, 0xA3, 0x46, 0x2F, 0x9E, 0x9E, 0x91, 0x6B,
+    0x5B, 0xE8, 0xF1, 0x02, 0x9A, 0xC4, 0xAC, 0xC1},
+   24,
+   //Cofactor
+   1,
+   //Fast modular reduction
+   NULL,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &brainpoolP192r1Params
+#endif
+};
+
+#endif
+#if (BRAINPOOLP224R1_SUPPORT == ENABLED)
+
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t BRAINPOOLP224R1_P[7] =
+{
+   0x7EC8C0FF, 0x97DA89F5, 0xB09F0757, 0x75D1D787,
+   0x2A183025, 0x26436686, 0xD7C134AA
+};
+
+//Curve parameter a
+static const uint_t BRAINPOOLP224R1_A[7] =
+{
+   0xCAD29F43, 0xB0042A59, 0x4E182AD8, 0xC1530B51,
+   0x299803A6, 0xA9CE6C1C, 0x68A5E62C
+};
+
+//Curve parameter b
+static const uint_t BRAINPOOLP224R1_B[7] =
+{
+   0x386C400B, 0x66DBB372, 0x3E2135D2, 0xA92369E3,
+   0x870713B1, 0xCFE44138, 0x2580F63C
+};
+
+//x-coordinate of the base point G
+static const uint_t BRAINPOOLP224R1_GX[7] =
+{
+   0xEE12C07D, 0x4C1E6EFD, 0x9E4CE317, 0xA87DC68C,
+   0x340823B2, 0x2C7E5CF4, 0x0D9029AD
+};
+
+//y-coordinate of the base point G
+static const uint_t BRAINPOOLP224R1_GY[7] =
+{
+   0x761402CD, 0xCAA3F6D3, 0x354B9E99, 0x4ECDAC24,
+   0x24C6B89E, 0x72C0726F, 0x58AA56F7
+};
+
+//Base point order q
+static const uint_t BRAINPOOLP224R1_Q[7] =
+{
+   0xA5A7939F, 0x6DDEBCA3, 0xD116BC4B, 0x75D0FB98,
+   0x2A183025, 0x26436686, 0xD7C134AA
+};
+
+/**
+ * @brief Preloaded brainpoolP224r1 domain parameters
+ **/
+
+static const EcDomainParameters brainpoolP224r1Params =
+{
+   //Curve name
+   "brainpoolP224r1",
+   //Curve type
+   EC_CURVE_TYPE_BRAINPOOLP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(BRAINPOOLP224R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(BRAINPOOLP224R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(BRAINPOOLP224R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(BRAINPOOLP224R1_GX),
+      EC_PRELOADED_MPI(BRAINPOOLP224R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(BRAINPOOLP224R1_Q),
    //Cofactor
    1,
    //Fast modular reduction
@@ -882,7 +2335,6 @@ const EcCurveInfo brainpoolP192r1Curve =
 };
 
 #endif
-#if (BRAINPOOLP224R1_SUPPORT == ENABLED)
 
 /**
  * @brief brainpoolP224r1 elliptic curve
@@ -924,12 +2376,92 @@ const EcCurveInfo brainpoolP224r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   NULL
+   NULL,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &brainpoolP224r1Params
+#endif
 };
 
 #endif
 #if (BRAINPOOLP256R1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t BRAINPOOLP256R1_P[8] =
+{
+   0x1F6E5377, 0x2013481D, 0xD5262028, 0x6E3BF623,
+   0x9D838D72, 0x3E660A90, 0xA1EEA9BC, 0xA9FB57DB
+};
+
+//Curve parameter a
+static const uint_t BRAINPOOLP256R1_A[8] =
+{
+   0xF330B5D9, 0xE94A4B44, 0x26DC5C6C, 0xFB8055C1,
+   0x417AFFE7, 0xEEF67530, 0xFC2C3057, 0x7D5A0975
+};
+
+//Curve parameter b
+static const uint_t BRAINPOOLP256R1_B[8] =
+{
+   0xFF8C07B6, 0x6BCCDC18, 0x5CF7E1CE, 0x95841629,
+   0xBBD77CBF, 0xF330B5D9, 0xE94A4B44, 0x26DC5C6C
+};
+
+//x-coordinate of the base point G
+static const uint_t BRAINPOOLP256R1_GX[8] =
+{
+   0x9ACE3262, 0x3A4453BD, 0xE3BD23C2, 0xB9DE27E1,
+   0xFC81B7AF, 0x2C4B482F, 0xCB7E57CB, 0x8BD2AEB9
+};
+
+//y-coordinate of the base point G
+static const uint_t BRAINPOOLP256R1_GY[8] =
+{
+   0x2F046997, 0x5C1D54C7, 0x2DED8E54, 0xC2774513,
+   0x14611DC9, 0x97F8461A, 0xC3DAC4FD, 0x547EF835
+};
+
+//Base point order q
+static const uint_t BRAINPOOLP256R1_Q[8] =
+{
+   0x974856A7, 0x901E0E82, 0xB561A6F7, 0x8C397AA3,
+   0x9D838D71, 0x3E660A90, 0xA1EEA9BC, 0xA9FB57DB
+};
+
+/**
+ * @brief Preloaded brainpoolP256r1 domain parameters
+ **/
+
+static const EcDomainParameters brainpoolP256r1Params =
+{
+   //Curve name
+   "brainpoolP256r1",
+   //Curve type
+   EC_CURVE_TYPE_BRAINPOOLP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(BRAINPOOLP256R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(BRAINPOOLP256R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(BRAINPOOLP256R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(BRAINPOOLP256R1_GX),
+      EC_PRELOADED_MPI(BRAINPOOLP256R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(BRAINPOOLP256R1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   NULL
+};
+
+#endif
+
 /**
  * @brief brainpoolP256r1 elliptic curve
  **/
@@ -970,12 +2502,98 @@ const EcCurveInfo brainpoolP256r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   NULL
+   NULL,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &brainpoolP256r1Params
+#endif
 };
 
 #endif
 #if (BRAINPOOLP320R1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t BRAINPOOLP320R1_P[10] =
+{
+   0xF1B32E27, 0xFCD412B1, 0x7893EC28, 0x4F92B9EC,
+   0xF6F40DEF, 0xF98FCFA6, 0xD201E065, 0xE13C785E,
+   0x36BC4FB7, 0xD35E4720
+};
+
+//Curve parameter a
+static const uint_t BRAINPOOLP320R1_A[10] =
+{
+   0x7D860EB4, 0x92F375A9, 0x85FFA9F4, 0x66190EB0,
+   0xF5EB79DA, 0xA2A73513, 0x6D3F3BB8, 0x83CCEBD4,
+   0x8FBAB0F8, 0x3EE30B56
+};
+
+//Curve parameter b
+static const uint_t BRAINPOOLP320R1_B[10] =
+{
+   0x8FB1F1A6, 0x6F5EB4AC, 0x88453981, 0xCC31DCCD,
+   0x9554B49A, 0xE13F4134, 0x40688A6F, 0xD3AD1986,
+   0x9DFDBC42, 0x52088394
+};
+
+//x-coordinate of the base point G
+static const uint_t BRAINPOOLP320R1_GX[10] =
+{
+   0x39E20611, 0x10AF8D0D, 0x10A599C7, 0xE7871E2A,
+   0x0A087EB6, 0xF20137D1, 0x8EE5BFE6, 0x5289BCC4,
+   0xFB53D8B8, 0x43BD7E9A
+};
+
+//y-coordinate of the base point G
+static const uint_t BRAINPOOLP320R1_GY[10] =
+{
+   0x692E8EE1, 0xD35245D1, 0xAAAC6AC7, 0xA9C77877,
+   0x117182EA, 0x0743FFED, 0x7F77275E, 0xAB409324,
+   0x45EC1CC8, 0x14FDD055
+};
+
+//Base point order q
+static const uint_t BRAINPOOLP320R1_Q[10] =
+{
+   0x44C59311, 0x8691555B, 0xEE8658E9, 0x2D482EC7,
+   0xB68F12A3, 0xF98FCFA5, 0xD201E065, 0xE13C785E,
+   0x36BC4FB7, 0xD35E4720
+};
+
+/**
+ * @brief Preloaded brainpoolP320r1 domain parameters
+ **/
+
+static const EcDomainParameters brainpoolP320r1Params =
+{
+   //Curve name
+   "brainpoolP320r1",
+   //Curve type
+   EC_CURVE_TYPE_BRAINPOOLP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(BRAINPOOLP320R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(BRAINPOOLP320R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(BRAINPOOLP320R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(BRAINPOOLP320R1_GX),
+      EC_PRELOADED_MPI(BRAINPOOLP320R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(BRAINPOOLP320R1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   NULL
+};
+
+#endif
+
 /**
  * @brief brainpoolP320r1 elliptic curve
  **/
@@ -1022,12 +2640,98 @@ const EcCurveInfo brainpoolP320r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   NULL
+   NULL,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &brainpoolP320r1Params
+#endif
 };
 
 #endif
 #if (BRAINPOOLP384R1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t BRAINPOOLP384R1_P[12] =
+{
+   0x3107EC53, 0x87470013, 0x901D1A71, 0xACD3A729,
+   0x7FB71123, 0x12B1DA19, 0xED5456B4, 0x152F7109,
+   0x50E641DF, 0x0F5D6F7E, 0xA3386D28, 0x8CB91E82
+};
+
+//Curve parameter a
+static const uint_t BRAINPOOLP384R1_A[12] =
+{
+   0x22CE2826, 0x04A8C7DD, 0x503AD4EB, 0x8AA5814A,
+   0xBA91F90F, 0x139165EF, 0x4FB22787, 0xC2BEA28E,
+   0xCE05AFA0, 0x3C72080A, 0x3D8C150C, 0x7BC382C6
+};
+
+//Curve parameter b
+static const uint_t BRAINPOOLP384R1_B[12] =
+{
+   0xFA504C11, 0x3AB78696, 0x95DBC994, 0x7CB43902,
+   0x3EEB62D5, 0x2E880EA5, 0x07DCD2A6, 0x2FB77DE1,
+   0x16F0447C, 0x8B39B554, 0x22CE2826, 0x04A8C7DD
+};
+
+//x-coordinate of the base point G
+static const uint_t BRAINPOOLP384R1_GX[12] =
+{
+   0x47D4AF1E, 0xEF87B2E2, 0x36D646AA, 0xE826E034,
+   0x0CBD10E8, 0xDB7FCAFE, 0x7EF14FE3, 0x8847A3E7,
+   0xB7C13F6B, 0xA2A63A81, 0x68CF45FF, 0x1D1C64F0
+};
+
+//y-coordinate of the base point G
+static const uint_t BRAINPOOLP384R1_GY[12] =
+{
+   0x263C5315, 0x42820341, 0x77918111, 0x0E464621,
+   0xF9912928, 0xE19C054F, 0xFEEC5864, 0x62B70B29,
+   0x95CFD552, 0x5CB1EB8E, 0x20F9C2A4, 0x8ABE1D75
+};
+
+//Base point order q
+static const uint_t BRAINPOOLP384R1_Q[12] =
+{
+   0xE9046565, 0x3B883202, 0x6B7FC310, 0xCF3AB6AF,
+   0xAC0425A7, 0x1F166E6C, 0xED5456B3, 0x152F7109,
+   0x50E641DF, 0x0F5D6F7E, 0xA3386D28, 0x8CB91E82
+};
+
+/**
+ * @brief Preloaded brainpoolP384r1 domain parameters
+ **/
+
+static const EcDomainParameters brainpoolP384r1Params =
+{
+   //Curve name
+   "brainpoolP384r1",
+   //Curve type
+   EC_CURVE_TYPE_BRAINPOOLP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(BRAINPOOLP384R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(BRAINPOOLP384R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(BRAINPOOLP384R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(BRAINPOOLP384R1_GX),
+      EC_PRELOADED_MPI(BRAINPOOLP384R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(BRAINPOOLP384R1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   NULL
+};
+
+#endif
+
 /**
  * @brief brainpoolP384r1 elliptic curve
  **/
@@ -1074,12 +2778,104 @@ const EcCurveInfo brainpoolP384r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   NULL
+   NULL,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &brainpoolP384r1Params
+#endif
 };
 
 #endif
 #if (BRAINPOOLP512R1_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t BRAINPOOLP512R1_P[16] =
+{
+   0x583A48F3, 0x28AA6056, 0x2D82C685, 0x2881FF2F,
+   0xE6A380E6, 0xAECDA12A, 0x9BC66842, 0x7D4D9B00,
+   0x70330871, 0xD6639CCA, 0xB3C9D20E, 0xCB308DB3,
+   0x33C9FC07, 0x3FD4E6AE, 0xDBE9C48B, 0xAADD9DB8
+};
+
+//Curve parameter a
+static const uint_t BRAINPOOLP512R1_A[16] =
+{
+   0x77FC94CA, 0xE7C1AC4D, 0x2BF2C7B9, 0x7F1117A7,
+   0x8B9AC8B5, 0x0A2EF1C9, 0xA8253AA1, 0x2DED5D5A,
+   0xEA9863BC, 0xA83441CA, 0x3DF91610, 0x94CBDD8D,
+   0xAC234CC5, 0xE2327145, 0x8B603B89, 0x7830A331
+};
+
+//Curve parameter b
+static const uint_t BRAINPOOLP512R1_B[16] =
+{
+   0x8016F723, 0x2809BD63, 0x5EBAE5DD, 0x984050B7,
+   0xDC083E67, 0x77FC94CA, 0xE7C1AC4D, 0x2BF2C7B9,
+   0x7F1117A7, 0x8B9AC8B5, 0x0A2EF1C9, 0xA8253AA1,
+   0x2DED5D5A, 0xEA9863BC, 0xA83441CA, 0x3DF91610
+};
+
+//x-coordinate of the base point G
+static const uint_t BRAINPOOLP512R1_GX[16] =
+{
+   0xBCB9F822, 0x8B352209, 0x406A5E68, 0x7C6D5047,
+   0x93B97D5F, 0x50D1687B, 0xE2D0D48D, 0xFF3B1F78,
+   0xF4D0098E, 0xB43B62EE, 0xB5D916C1, 0x85ED9F70,
+   0x9C4C6A93, 0x5A21322E, 0xD82ED964, 0x81AEE4BD
+};
+
+//y-coordinate of the base point G
+static const uint_t BRAINPOOLP512R1_GY[16] =
+{
+   0x3AD80892, 0x78CD1E0F, 0xA8F05406, 0xD1CA2B2F,
+   0x8A2763AE, 0x5BCA4BD8, 0x4A5F485E, 0xB2DCDE49,
+   0x881F8111, 0xA000C55B, 0x24A57B1A, 0xF209F700,
+   0xCF7822FD, 0xC0EABFA9, 0x566332EC, 0x7DDE385D
+};
+
+//Base point order q
+static const uint_t BRAINPOOLP512R1_Q[16] =
+{
+   0x9CA90069, 0xB5879682, 0x085DDADD, 0x1DB1D381,
+   0x7FAC1047, 0x41866119, 0x4CA92619, 0x553E5C41,
+   0x70330870, 0xD6639CCA, 0xB3C9D20E, 0xCB308DB3,
+   0x33C9FC07, 0x3FD4E6AE, 0xDBE9C48B, 0xAADD9DB8
+};
+
+/**
+ * @brief Preloaded brainpoolP512r1 domain parameters
+ **/
+
+static const EcDomainParameters brainpoolP512r1Params =
+{
+   //Curve name
+   "brainpoolP512r1",
+   //Curve type
+   EC_CURVE_TYPE_BRAINPOOLP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(BRAINPOOLP512R1_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(BRAINPOOLP512R1_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(BRAINPOOLP512R1_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(BRAINPOOLP512R1_GX),
+      EC_PRELOADED_MPI(BRAINPOOLP512R1_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(BRAINPOOLP512R1_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   NULL
+};
+
+#endif
+
 /**
  * @brief brainpoolP512r1 elliptic curve
  **/
@@ -1132,12 +2928,92 @@ const EcCurveInfo brainpoolP512r1Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   NULL
+   NULL,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &brainpoolP512r1Params
+#endif
 };
 
 #endif
 #if (SM2_SUPPORT == ENABLED)
 
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+
+//Prime modulus p
+static const uint_t SM2_P[8] =
+{
+   0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE
+};
+
+//Curve parameter a
+static const uint_t SM2_A[8] =
+{
+   0xFFFFFFFC, 0xFFFFFFFF, 0x00000000, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE
+};
+
+//Curve parameter b
+static const uint_t SM2_B[8] =
+{
+   0x4D940E93, 0xDDBCBD41, 0x15AB8F92, 0xF39789F5,
+   0xCF6509A7, 0x4D5A9E4B, 0x9D9F5E34, 0x28E9FA9E
+};
+
+//x-coordinate of the base point G
+static const uint_t SM2_GX[8] =
+{
+   0x334C74C7, 0x715A4589, 0xF2660BE1, 0x8FE30BBF,
+   0x6A39C994, 0x5F990446, 0x1F198119, 0x32C4AE2C
+};
+
+//y-coordinate of the base point G
+static const uint_t SM2_GY[8] =
+{
+   0x2139F0A0, 0x02DF32E5, 0xC62A4740, 0xD0A9877C,
+   0x6B692153, 0x59BDCEE3, 0xF4F6779C, 0xBC3736A2
+};
+
+//Base point order q
+static const uint_t SM2_Q[8] =
+{
+   0x39D54123, 0x53BBF409, 0x21C6052B, 0x7203DF6B,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE
+};
+
+/**
+ * @brief Preloaded SM2 domain parameters
+ **/
+
+static const EcDomainParameters sm2Params =
+{
+   //Curve name
+   "curveSM2",
+   //Curve type
+   EC_CURVE_TYPE_SECP_R1,
+   //Prime modulus p
+   EC_PRELOADED_MPI(SM2_P),
+   //Curve parameter a
+   EC_PRELOADED_MPI(SM2_A),
+   //Curve parameter b
+   EC_PRELOADED_MPI(SM2_B),
+   //Base point G
+   {
+      EC_PRELOADED_MPI(SM2_GX),
+      EC_PRELOADED_MPI(SM2_GY),
+      EC_PRELOADED_MPI(EC_PRELOADED_ONE)
+   },
+   //Base point order q
+   EC_PRELOADED_MPI(SM2_Q),
+   //Cofactor
+   1,
+   //Fast modular reduction
+   sm2Mod
+};
+
+#endif
+
 /**
  * @brief SM2 elliptic curve
  **/
@@ -1178,7 +3054,11 @@ const EcCurveInfo sm2Curve =
    //Cofactor
    1,
    //Fast modular reduction
-   sm2Mod
+   sm2Mod,
+#if (EC_PRELOADED_PARAMS_SUPPORT == ENABLED)
+   //Preloaded domain parameters
+   &sm2Params
+#endif
 };
 
 #endif
@@ -1427,7 +3307,14 @@ error_t secp128r1Mod(Mpi *a, const Mpi *p)
       MPI_CHECK(mpiAdd(a, a, &t));
 
       //Check for end condition
-   } while(mpiComp(a, p) > 0);
+   } while(mpiGetBitLength(a) > mpiGetBitLength(p));
+
+   //Since A < 2^k < 2p, where k is the bit length of p, a single subtraction
+   //is enough to complete the reduction
+   if(mpiComp(a, p) >= 0)
+   {
+      MPI_CHECK(mpiSub(a, a, p));
+   }
 
 end:
    //Release multiple precision integers
@@ -1475,7 +3362,14 @@ error_t secp128r2Mod(Mpi *a, const Mpi *p)
       MPI_CHECK(mpiAdd(a, a, &t));
 
       //Check for end condition
-   } while(mpiComp(a, p) > 0);
+   } while(mpiGetBitLength(a) > mpiGetBitLength(p));
+
+   //Since A < 2^k < 2p, where k is the bit length of p, a single subtraction
+   //is enough to complete the reduction
+   if(mpiComp(a, p) >= 0)
+   {
+      MPI_CHECK(mpiSub(a, a, p));
+   }
 
 end:
    //Release multiple precision integers
@@ -1526,7 +3420,14 @@ error_t secp160k1Mod(Mpi *a, const Mpi *p)
       MPI_CHECK(mpiAdd(a, a, &t));
 
       //Check for end condition
-   } while(mpiComp(a, p) > 0);
+   } while(mpiGetBitLength(a) > mpiGetBitLength(p));
+
+   //Since A < 2^k < 2p, where k is the bit length of p, a single subtraction
+   //is enough to complete the reduction
+   if(mpiComp(a, p) >= 0)
+   {
+      MPI_CHECK(mpiSub(a, a, p));
+   }
 
 end:
    //Release multiple precision integers
@@ -1574,7 +3475,14 @@ error_t secp160r1Mod(Mpi *a, const Mpi *p)
       MPI_CHECK(mpiAdd(a, a, &t));
 
       //Check for end condition
-   } while(mpiComp(a, p) > 0);
+   } while(mpiGetBitLength(a) > mpiGetBitLength(p));
+
+   //Since A < 2^k < 2p, where k is the bit length of p, a single subtraction
+   //is enough to complete the reduction
+   if(mpiComp(a, p) >= 0)
+   {
+      MPI_CHECK(mpiSub(a, a, p));
+   }
 
 end:
    //Release multiple precision integers
@@ -1625,7 +3533,14 @@ error_t secp160r2Mod(Mpi *a, const Mpi *p)
       MPI_CHECK(mpiAdd(a, a, &t));
 
       //Check for end condition
-   } while(mpiComp(a, p) > 0);
+   } while(mpiGetBitLength(a) > mpiGetBitLength(p));
+
+   //Since A < 2^k < 2p, where k is the bit length of p, a single subtraction
+   //is enough to complete the reduction
+   if(mpiComp(a, p) >= 0)
+   {
+      MPI_CHECK(mpiSub(a, a, p));
+   }
 
 end:
    //Release multiple precision integers
@@ -1676,7 +3591,14 @@ error_t secp192k1Mod(Mpi *a, const Mpi *p)
       MPI_CHECK(mpiAdd(a, a, &t));
 
       //Check for end condition
-   } while(mpiComp(a, p) > 0);
+   } while(mpiGetBitLength(a) > mpiGetBitLength(p));
+
+   //Since A < 2^k < 2p, where k is the bit length of p, a single subtraction
+   //is enough to complete the reduction
+   if(mpiComp(a, p) >= 0)
+   {
+      MPI_CHECK(mpiSub(a, a, p));
+   }
 
 end:
    //Release multiple precision integers
@@ -1794,7 +3716,14 @@ error_t secp224k1Mod(Mpi *a, const Mpi *p)
       MPI_CHECK(mpiAdd(a, a, &t));
 
       //Check for end condition
-   } while(mpiComp(a, p) > 0);
+   } while(mpiGetBitLength(a) > mpiGetBitLength(p));
+
+   //Since A < 2^k < 2p, where k is the bit length of p, a single subtraction
+   //is enough to complete the reduction
+   if(mpiComp(a, p) >= 0)
+   {
+      MPI_CHECK(mpiSub(a, a, p));
+   }
 
 end:
    //Release multiple precision integers
@@ -1920,7 +3849,14 @@ error_t secp256k1Mod(Mpi *a, const Mpi *p)
       MPI_CHECK(mpiAdd(a, a, &t));
 
       //Check for end condition
-   } while(mpiComp(a, p) > 0);
+   } while(mpiGetBitLength(a) > mpiGetBitLength(p));
+
+   //Since A < 2^k < 2p, where k is the bit length of p, a single subtraction
+   //is enough to complete the reduction
+   if(mpiComp(a, p) >= 0)
+   {
+      MPI_CHECK(mpiSub(a, a, p));
+   }
 
 end:
    //Release multiple precision integers
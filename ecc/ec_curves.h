@@ -287,6 +287,21 @@ typedef enum
 typedef error_t (*EcFastModAlgo)(Mpi *a, const Mpi *p);
 
 
+/**
+ * @brief Precomputed multiples of a point
+ *
+ * The table is built once, before it is used, and is only read afterwards
+ *
+ **/
+
+typedef struct
+{
+   bool_t ready;       ///<The table is valid
+   uint_t numWindows;  ///<Number of windows
+   uint8_t *data;      ///<Affine coordinates of the precomputed points
+} EcBaseTable;
+
+
 /**
  * @brief Elliptic curve parameters
  **/
@@ -311,6 +326,7 @@ typedef struct
    size_t qLen;          ///<Length of q
    uint32_t h;           ///<Cofactor h
    EcFastModAlgo mod;    ///<Fast modular reduction
+   const struct _EcDomainParameters *params; ///<Preloaded domain parameters (optional)
 } EcCurveInfo;
 
 
@@ -0,0 +1,1488 @@
+/**
+ * @file ec_nist.c
+ * @brief Common layer of the dedicated NIST curve implementations
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * The dedicated secp256r1, secp384r1 and secp521r1 implementations only
+ * differ by their field arithmetic, which is provided through an EcNistCurve
+ * structure. Points are represented in homogeneous projective coordinates
+ * and combined with the complete addition formulas of Renes, Costello and
+ * Batina, so that the group law has no exceptional case. Scalars are recoded
+ * with odd signed digits and table entries are selected in constant time.
+ * The fixed-base scalar multiplication reads the multiples of the base point
+ * from constant tables, which are generated by ec_nist_tables.py. Refer to
+ * the following paper for more details:
+ * - Complete addition formulas for prime order elliptic curves (2015)
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec.h"
+#include "ecc/ec_nist.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (EC_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Set integer value
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] a Pointer to the integer to be initialized
+ * @param[in] b Initial value
+ **/
+
+static void ecNistSetInt(const EcNistCurve *curve, uint32_t *a, uint32_t b)
+{
+   uint_t i;
+
+   //Set the value of the least significant word
+   a[0] = b;
+
+   //Initialize the rest of the integer
+   for(i = 1; i < curve->wordLen; i++)
+   {
+      a[i] = 0;
+   }
+}
+
+
+/**
+ * @brief Copy an integer
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] a Pointer to the destination integer
+ * @param[in] b Pointer to the source integer
+ **/
+
+static void ecNistCopy(const EcNistCurve *curve, uint32_t *a,
+   const uint32_t *b)
+{
+   uint_t i;
+
+   //Copy the value of the integer
+   for(i = 0; i < curve->wordLen; i++)
+   {
+      a[i] = b[i];
+   }
+}
+
+
+/**
+ * @brief Select an integer
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Pointer to the destination integer
+ * @param[in] a Pointer to the first source integer
+ * @param[in] b Pointer to the second source integer
+ * @param[in] c Condition variable
+ **/
+
+static void ecNistSelect(const EcNistCurve *curve, uint32_t *r,
+   const uint32_t *a, const uint32_t *b, uint32_t c)
+{
+   uint_t i;
+   uint32_t mask;
+
+   //The mask is the all-1 or all-0 word
+   mask = c - 1;
+
+   //Select between A and B
+   for(i = 0; i < curve->wordLen; i++)
+   {
+      //Constant time implementation
+      r[i] = (a[i] & mask) | (b[i] & ~mask);
+   }
+}
+
+
+/**
+ * @brief Point addition (complete formula)
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting point R = S + T
+ * @param[in] s First operand
+ * @param[in] t Second operand
+ **/
+
+static void ecNistPointAdd(const EcNistCurve *curve, EcNistPoint *r,
+   const EcNistPoint *s, const EcNistPoint *t)
+{
+   uint32_t t0[EC_NIST_MAX_WORD_LEN];
+   uint32_t t1[EC_NIST_MAX_WORD_LEN];
+   uint32_t t2[EC_NIST_MAX_WORD_LEN];
+   uint32_t t3[EC_NIST_MAX_WORD_LEN];
+   uint32_t t4[EC_NIST_MAX_WORD_LEN];
+   uint32_t x3[EC_NIST_MAX_WORD_LEN];
+   uint32_t y3[EC_NIST_MAX_WORD_LEN];
+   uint32_t z3[EC_NIST_MAX_WORD_LEN];
+
+   //Compute t0 = X1 * X2, t1 = Y1 * Y2 and t2 = Z1 * Z2
+   curve->mul(t0, s->x, t->x);
+   curve->mul(t1, s->y, t->y);
+   curve->mul(t2, s->z, t->z);
+   //Compute t3 = (X1 + Y1) * (X2 + Y2) - (t0 + t1)
+   curve->add(t3, s->x, s->y);
+   curve->add(t4, t->x, t->y);
+   curve->mul(t3, t3, t4);
+   curve->add(t4, t0, t1);
+   curve->sub(t3, t3, t4);
+   //Compute t4 = (Y1 + Z1) * (Y2 + Z2) - (t1 + t2)
+   curve->add(t4, s->y, s->z);
+   curve->add(x3, t->y, t->z);
+   curve->mul(t4, t4, x3);
+   curve->add(x3, t1, t2);
+   curve->sub(t4, t4, x3);
+   //Compute Y3 = (X1 + Z1) * (X2 + Z2) - (t0 + t2)
+   curve->add(x3, s->x, s->z);
+   curve->add(y3, t->x, t->z);
+   curve->mul(x3, x3, y3);
+   curve->add(y3, t0, t2);
+   curve->sub(y3, x3, y3);
+   //Compute X3 = 3 * (Y3 - b * t2)
+   curve->mul(z3, curve->b, t2);
+   curve->sub(x3, y3, z3);
+   curve->add(z3, x3, x3);
+   curve->add(x3, x3, z3);
+   //Compute Z3 = t1 - X3 and X3 = t1 + X3
+   curve->sub(z3, t1, x3);
+   curve->add(x3, t1, x3);
+   //Compute Y3 = 3 * (b * Y3 - 3 * t2 - t0)
+   curve->mul(y3, curve->b, y3);
+   curve->add(t1, t2, t2);
+   curve->add(t2, t1, t2);
+   curve->sub(y3, y3, t2);
+   curve->sub(y3, y3, t0);
+   curve->add(t1, y3, y3);
+   curve->add(y3, t1, y3);
+   //Compute t0 = 3 * t0 - t2
+   curve->add(t1, t0, t0);
+   curve->add(t0, t1, t0);
+   curve->sub(t0, t0, t2);
+   //Compute t1 = t4 * Y3 and t2 = t0 * Y3
+   curve->mul(t1, t4, y3);
+   curve->mul(t2, t0, y3);
+   //Compute Y3 = X3 * Z3 + t2
+   curve->mul(y3, x3, z3);
+   curve->add(r->y, y3, t2);
+   //Compute X3 = t3 * X3 - t1
+   curve->mul(x3, t3, x3);
+   curve->sub(r->x, x3, t1);
+   //Compute Z3 = t4 * Z3 + t3 * t0
+   curve->mul(z3, t4, z3);
+   curve->mul(t1, t3, t0);
+   curve->add(r->z, z3, t1);
+}
+
+
+#if (EC_NIST_BASE_TABLE_SUPPORT == ENABLED)
+
+/**
+ * @brief Mixed point addition (complete formula)
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting point R = S + T
+ * @param[in] s First operand
+ * @param[in] t Second operand (Z = 1, must not be the point at infinity)
+ **/
+
+static void ecNistPointAddMixed(const EcNistCurve *curve, EcNistPoint *r,
+   const EcNistPoint *s, const EcNistPoint *t)
+{
+   uint32_t t0[EC_NIST_MAX_WORD_LEN];
+   uint32_t t1[EC_NIST_MAX_WORD_LEN];
+   uint32_t t2[EC_NIST_MAX_WORD_LEN];
+   uint32_t t3[EC_NIST_MAX_WORD_LEN];
+   uint32_t t4[EC_NIST_MAX_WORD_LEN];
+   uint32_t x3[EC_NIST_MAX_WORD_LEN];
+   uint32_t y3[EC_NIST_MAX_WORD_LEN];
+   uint32_t z3[EC_NIST_MAX_WORD_LEN];
+
+   //Compute t0 = X1 * X2 and t1 = Y1 * Y2
+   curve->mul(t0, s->x, t->x);
+   curve->mul(t1, s->y, t->y);
+   //Compute t3 = (X2 + Y2) * (X1 + Y1) - (t0 + t1)
+   curve->add(t3, t->x, t->y);
+   curve->add(t4, s->x, s->y);
+   curve->mul(t3, t3, t4);
+   curve->add(t4, t0, t1);
+   curve->sub(t3, t3, t4);
+   //Compute t4 = Y2 * Z1 + Y1
+   curve->mul(t4, t->y, s->z);
+   curve->add(t4, t4, s->y);
+   //Compute Y3 = X2 * Z1 + X1
+   curve->mul(y3, t->x, s->z);
+   curve->add(y3, y3, s->x);
+   //Compute X3 = 3 * (Y3 - b * Z1)
+   curve->mul(z3, curve->b, s->z);
+   curve->sub(x3, y3, z3);
+   curve->add(z3, x3, x3);
+   curve->add(x3, x3, z3);
+   //Compute Z3 = t1 - X3 and X3 = t1 + X3
+   curve->sub(z3, t1, x3);
+   curve->add(x3, t1, x3);
+   //Compute Y3 = 3 * (b * Y3 - 3 * Z1 - t0)
+   curve->mul(y3, curve->b, y3);
+   curve->add(t1, s->z, s->z);
+   curve->add(t2, t1, s->z);
+   curve->sub(y3, y3, t2);
+   curve->sub(y3, y3, t0);
+   curve->add(t1, y3, y3);
+   curve->add(y3, t1, y3);
+   //Compute t0 = 3 * t0 - t2
+   curve->add(t1, t0, t0);
+   curve->add(t0, t1, t0);
+   curve->sub(t0, t0, t2);
+   //Compute t1 = t4 * Y3 and t2 = t0 * Y3
+   curve->mul(t1, t4, y3);
+   curve->mul(t2, t0, y3);
+   //Compute Y3 = X3 * Z3 + t2
+   curve->mul(y3, x3, z3);
+   curve->add(r->y, y3, t2);
+   //Compute X3 = t3 * X3 - t1
+   curve->mul(x3, t3, x3);
+   curve->sub(r->x, x3, t1);
+   //Compute Z3 = t4 * Z3 + t3 * t0
+   curve->mul(z3, t4, z3);
+   curve->mul(t1, t3, t0);
+   curve->add(r->z, z3, t1);
+}
+
+#endif
+
+
+/**
+ * @brief Point doubling (complete formula)
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting point R = 2 * S
+ * @param[in] s Point S
+ **/
+
+static void ecNistPointDouble(const EcNistCurve *curve, EcNistPoint *r,
+   const EcNistPoint *s)
+{
+   uint32_t t0[EC_NIST_MAX_WORD_LEN];
+   uint32_t t1[EC_NIST_MAX_WORD_LEN];
+   uint32_t t2[EC_NIST_MAX_WORD_LEN];
+   uint32_t t3[EC_NIST_MAX_WORD_LEN];
+   uint32_t x3[EC_NIST_MAX_WORD_LEN];
+   uint32_t y3[EC_NIST_MAX_WORD_LEN];
+   uint32_t z3[EC_NIST_MAX_WORD_LEN];
+
+   //Compute t0 = X^2, t1 = Y^2 and t2 = Z^2
+   curve->mul(t0, s->x, s->x);
+   curve->mul(t1, s->y, s->y);
+   curve->mul(t2, s->z, s->z);
+   //Compute t3 = 2 * X * Y
+   curve->mul(t3, s->x, s->y);
+   curve->add(t3, t3, t3);
+   //Compute Z3 = 2 * X * Z
+   curve->mul(z3, s->x, s->z);
+   curve->add(z3, z3, z3);
+   //Compute Y3 = 3 * (b * t2 - Z3)
+   curve->mul(y3, curve->b, t2);
+   curve->sub(y3, y3, z3);
+   curve->add(x3, y3, y3);
+   curve->add(y3, x3, y3);
+   //Compute X3 = t1 - Y3 and Y3 = t1 + Y3
+   curve->sub(x3, t1, y3);
+   curve->add(y3, t1, y3);
+   //Compute Y3 = X3 * Y3 and X3 = X3 * t3
+   curve->mul(y3, x3, y3);
+   curve->mul(x3, x3, t3);
+   //Compute t2 = 3 * t2
+   curve->add(t3, t2, t2);
+   curve->add(t2, t2, t3);
+   //Compute Z3 = 3 * (b * Z3 - t2 - t0)
+   curve->mul(z3, curve->b, z3);
+   curve->sub(z3, z3, t2);
+   curve->sub(z3, z3, t0);
+   curve->add(t3, z3, z3);
+   curve->add(z3, z3, t3);
+   //Compute t0 = 3 * t0 - t2
+   curve->add(t3, t0, t0);
+   curve->add(t0, t3, t0);
+   curve->sub(t0, t0, t2);
+   //Compute Y3 = Y3 + t0 * Z3
+   curve->mul(t0, t0, z3);
+   curve->add(y3, y3, t0);
+   //Compute t0 = 2 * Y * Z
+   curve->mul(t0, s->y, s->z);
+   curve->add(t0, t0, t0);
+   //Compute X3 = X3 - t0 * Z3
+   curve->mul(z3, t0, z3);
+   curve->sub(r->x, x3, z3);
+   //Compute Z3 = 4 * t0 * t1
+   curve->mul(z3, t0, t1);
+   curve->add(z3, z3, z3);
+   curve->add(r->z, z3, z3);
+   //Copy the y-coordinate
+   ecNistCopy(curve, r->y, y3);
+}
+
+
+/**
+ * @brief Negate a point if requested (constant time)
+ * @param[in] curve Dedicated curve implementation
+ * @param[in,out] r Point to be negated
+ * @param[in] sign Set to 1 to negate the point
+ **/
+
+static void ecNistCondNegate(const EcNistCurve *curve, EcNistPoint *r,
+   uint32_t sign)
+{
+   uint32_t y[EC_NIST_MAX_WORD_LEN];
+
+   //Compute -Y
+   ecNistSetInt(curve, y, 0);
+   curve->sub(y, y, r->y);
+
+   //Negate the point if necessary
+   ecNistSelect(curve, r->y, r->y, y, sign);
+}
+
+
+/**
+ * @brief Constant-time table lookup
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Selected point, negated if requested
+ * @param[in] table Table of points
+ * @param[in] n Number of points in the table
+ * @param[in] index Index of the point to be selected
+ * @param[in] sign Set to 1 to negate the selected point
+ **/
+
+static void ecNistSelectPoint(const EcNistCurve *curve, EcNistPoint *r,
+   const EcNistPoint *table, uint_t n, uint32_t index, uint32_t sign)
+{
+   uint_t i;
+   uint32_t c;
+
+   //Initialize the resulting point
+   ecNistSetInt(curve, r->x, 0);
+   ecNistSetInt(curve, r->y, 0);
+   ecNistSetInt(curve, r->z, 0);
+
+   //Scan the whole table so that the memory access pattern does not depend
+   //on the value of the index
+   for(i = 0; i < n; i++)
+   {
+      //Check whether the current entry is the one to be selected
+      c = i ^ index;
+      c = ((c | (~c + 1)) >> 31) ^ 1;
+
+      //Constant time implementation
+      ecNistSelect(curve, r->x, r->x, table[i].x, c);
+      ecNistSelect(curve, r->y, r->y, table[i].y, c);
+      ecNistSelect(curve, r->z, r->z, table[i].z, c);
+   }
+
+   //Negate the point if necessary
+   ecNistCondNegate(curve, r, sign);
+}
+
+
+/**
+ * @brief Prepare a scalar for the odd signed-digit recoding
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] k Odd scalar to be recoded
+ * @param[out] mask Set to 1 if the sign of every digit must be flipped
+ * @param[in] d Scalar such as 0 <= d < 2^n, where n is the bit length of
+ *   the order
+ * @return Error code
+ **/
+
+static error_t ecNistPrepareScalar(const EcNistCurve *curve, uint32_t *k,
+   uint32_t *mask, const Mpi *d)
+{
+   error_t error;
+   uint_t i;
+   uint_t n;
+   int64_t temp;
+   uint32_t e[EC_NIST_MAX_WORD_LEN];
+   uint8_t buffer[EC_MAX_MODULUS_SIZE];
+
+   //Length of the scalar, in words
+   n = curve->wordLen;
+
+   //Convert the scalar to an array of words
+   error = mpiExport(d, buffer, curve->byteLen, MPI_FORMAT_BIG_ENDIAN);
+
+   //Check status code
+   if(!error)
+   {
+      curve->importInt(k, buffer);
+
+      //The octet string may hold more bits than the order
+      if((curve->bitLen % 32) != 0 && (k[n - 1] >> (curve->bitLen % 32)) != 0)
+      {
+         error = ERROR_INVALID_PARAMETER;
+      }
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Compute e = d - q
+      for(temp = 0, i = 0; i < n; i++)
+      {
+         temp += k[i];
+         temp -= curve->q[i];
+         e[i] = temp & 0xFFFFFFFF;
+         temp >>= 32;
+      }
+
+      //Since d < 2^n < 2q, a single subtraction is enough to reduce d
+      //modulo q
+      ecNistSelect(curve, k, e, k, temp & 1);
+
+      //Compute e = q - d
+      for(temp = 0, i = 0; i < n; i++)
+      {
+         temp += curve->q[i];
+         temp -= k[i];
+         e[i] = temp & 0xFFFFFFFF;
+         temp >>= 32;
+      }
+
+      //The recoding requires an odd scalar. When d is even, q - d is recoded
+      //instead, since (q - d).S = -d.S
+      *mask = (k[0] & 1) ^ 1;
+      ecNistSelect(curve, k, k, e, *mask);
+   }
+
+   //Erase the temporary buffers
+   osMemset(buffer, 0, sizeof(buffer));
+   osMemset(e, 0, sizeof(e));
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Extract a digit from the recoded scalar
+ * @param[in] curve Dedicated curve implementation
+ * @param[in] k Odd scalar
+ * @param[in] i Index of the window
+ * @param[out] index Position of the point (2 * index + 1) in the table
+ * @param[out] sign 1 if the digit is negative, else 0
+ **/
+
+static void ecNistGetDigit(const EcNistCurve *curve, const uint32_t *k,
+   uint_t i, uint32_t *index, uint32_t *sign)
+{
+   uint_t n;
+   uint32_t c;
+
+   //Position of the window
+   n = i * 4;
+
+   //Extract 5 bits, the least significant one being forced to 1
+   c = k[n / 32] >> (n % 32);
+
+   //The window may span two words
+   if((n % 32) > 27 && (n / 32) < (curve->wordLen - 1))
+   {
+      c |= k[n / 32 + 1] << (32 - (n % 32));
+   }
+
+   c = (c & 0x1F) | 1;
+
+   //The last digit is always positive
+   if(i < (curve->numWindows - 1))
+   {
+      //Compute the digit c - 16, whose sign is given by the bit 4 of c
+      *sign = ((c >> 4) & 1) ^ 1;
+      //The absolute value of the digit is 16 - c if c < 16, else c - 16
+      c = (c & 0x0F) ^ (0U - *sign);
+      *index = (c & 0x0F) >> 1;
+   }
+   else
+   {
+      //The digit is c
+      *sign = 0;
+      *index = c >> 1;
+   }
+}
+
+
+/**
+ * @brief Import a coordinate to the internal representation
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting field element
+ * @param[in] a Multiple precision integer
+ * @return Error code
+ **/
+
+static error_t ecNistImportCoordinate(const EcNistCurve *curve, uint32_t *r,
+   const Mpi *a)
+{
+   error_t error;
+   uint8_t buffer[EC_MAX_MODULUS_SIZE];
+
+   //Convert the integer to an octet string
+   error = mpiExport(a, buffer, curve->byteLen, MPI_FORMAT_BIG_ENDIAN);
+
+   //Check status code
+   if(!error)
+   {
+      curve->importInt(r, buffer);
+
+      //Convert the value to the Montgomery domain, if necessary
+      if(curve->r2 != NULL)
+      {
+         curve->mul(r, r, curve->r2);
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Convert a field element out of the Montgomery domain
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting value
+ * @param[in] a Field element (internal representation)
+ **/
+
+static void ecNistFromInternal(const EcNistCurve *curve, uint32_t *r,
+   const uint32_t *a)
+{
+   uint32_t b[EC_NIST_MAX_WORD_LEN];
+
+   //Montgomery representation?
+   if(curve->r2 != NULL)
+   {
+      //Compute r = a * 1 / R
+      ecNistSetInt(curve, b, 1);
+      curve->mul(r, a, b);
+   }
+   else
+   {
+      //The internal representation is the value itself
+      ecNistCopy(curve, r, a);
+   }
+}
+
+
+/**
+ * @brief Export a coordinate
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting multiple precision integer
+ * @param[in] a Field element (not in the Montgomery domain)
+ * @return Error code
+ **/
+
+static error_t ecNistExportCoordinate(const EcNistCurve *curve, Mpi *r,
+   const uint32_t *a)
+{
+   uint8_t buffer[EC_MAX_MODULUS_SIZE];
+
+   //Convert the field element to an octet string
+   curve->exportInt(a, buffer);
+
+   //Convert the octet string to a multiple precision integer
+   return mpiImport(r, buffer, curve->byteLen, MPI_FORMAT_BIG_ENDIAN);
+}
+
+
+/**
+ * @brief Convert an EC point to the internal representation
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting point
+ * @param[in] s EC point (Jacobian coordinates)
+ * @return Error code
+ **/
+
+static error_t ecNistImportPoint(const EcNistCurve *curve, EcNistPoint *r,
+   const EcPoint *s)
+{
+   error_t error;
+   uint32_t z2[EC_NIST_MAX_WORD_LEN];
+
+   //Import the coordinates
+   MPI_CHECK(ecNistImportCoordinate(curve, r->x, &s->x));
+   MPI_CHECK(ecNistImportCoordinate(curve, r->y, &s->y));
+   MPI_CHECK(ecNistImportCoordinate(curve, r->z, &s->z));
+
+   //The Jacobian point (X, Y, Z) is mapped to the projective point
+   //(X * Z, Y, Z^3). In particular, (1, 1, 0) is mapped to (0, 1, 0)
+   curve->mul(z2, r->z, r->z);
+   curve->mul(r->x, r->x, r->z);
+   curve->mul(r->z, r->z, z2);
+
+end:
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Convert an affine point to the internal representation
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting point
+ * @param[in] s EC point (affine coordinates)
+ * @return Error code
+ **/
+
+static error_t ecNistImportAffinePoint(const EcNistCurve *curve,
+   EcNistPoint *r, const EcPoint *s)
+{
+   error_t error;
+
+   //Import the coordinates
+   MPI_CHECK(ecNistImportCoordinate(curve, r->x, &s->x));
+   MPI_CHECK(ecNistImportCoordinate(curve, r->y, &s->y));
+
+   //Set Z = 1
+   ecNistCopy(curve, r->z, curve->one);
+
+end:
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Load the base point
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Base point G (internal representation)
+ **/
+
+static void ecNistLoadBasePoint(const EcNistCurve *curve, EcNistPoint *r)
+{
+   //Load the affine coordinates of G
+   curve->importInt(r->x, curve->g);
+   curve->importInt(r->y, curve->g + curve->byteLen);
+
+   //Convert the coordinates to the Montgomery domain, if necessary
+   if(curve->r2 != NULL)
+   {
+      curve->mul(r->x, r->x, curve->r2);
+      curve->mul(r->y, r->y, curve->r2);
+   }
+
+   //Set Z = 1
+   ecNistCopy(curve, r->z, curve->one);
+}
+
+
+/**
+ * @brief Check whether a point is the point at the infinity
+ * @param[in] curve Dedicated curve implementation
+ * @param[in] s Point in projective coordinates
+ * @return TRUE if Z = 0, else FALSE
+ **/
+
+static bool_t ecNistIsInfinity(const EcNistCurve *curve, const EcNistPoint *s)
+{
+   uint_t i;
+   uint32_t c;
+
+   //Check whether Z == 0
+   for(c = 0, i = 0; i < curve->wordLen; i++)
+   {
+      c |= s->z[i];
+   }
+
+   //Return TRUE if the point is the point at the infinity
+   return (c == 0) ? TRUE : FALSE;
+}
+
+
+/**
+ * @brief Convert a point from the internal representation
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting EC point
+ * @param[in] s Point in projective coordinates
+ * @return Error code
+ **/
+
+static error_t ecNistExportPoint(const EcNistCurve *curve, EcPoint *r,
+   const EcNistPoint *s)
+{
+   error_t error;
+   uint32_t a[EC_NIST_MAX_WORD_LEN];
+   uint32_t b[EC_NIST_MAX_WORD_LEN];
+
+   //Point at the infinity?
+   if(ecNistIsInfinity(curve, s))
+   {
+      //Set R = (1, 1, 0)
+      MPI_CHECK(mpiSetValue(&r->x, 1));
+      MPI_CHECK(mpiSetValue(&r->y, 1));
+      MPI_CHECK(mpiSetValue(&r->z, 0));
+   }
+   else
+   {
+      //Compute a = 1 / Z and convert it out of the Montgomery domain
+      curve->inv(a, s->z);
+      ecNistFromInternal(curve, a, a);
+
+      //Recover the x-coordinate
+      curve->mul(b, s->x, a);
+      MPI_CHECK(ecNistExportCoordinate(curve, &r->x, b));
+
+      //Recover the y-coordinate
+      curve->mul(b, s->y, a);
+      MPI_CHECK(ecNistExportCoordinate(curve, &r->y, b));
+
+      //The resulting point is in affine representation
+      MPI_CHECK(mpiSetValue(&r->z, 1));
+   }
+
+end:
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Export a point to Jacobian coordinates
+ *
+ * The homogeneous coordinates (X : Y : Z) are mapped to the Jacobian
+ * coordinates (X.Z : Y.Z^2 : Z), so that no modular inversion is required
+ *
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting point, in Jacobian coordinates
+ * @param[in] s Point to be exported, in homogeneous coordinates
+ * @return Error code
+ **/
+
+static error_t ecNistExportJacobianPoint(const EcNistCurve *curve,
+   EcPoint *r, const EcNistPoint *s)
+{
+   error_t error;
+   uint32_t a[EC_NIST_MAX_WORD_LEN];
+
+   //Point at the infinity?
+   if(ecNistIsInfinity(curve, s))
+   {
+      //Set R = (1, 1, 0)
+      MPI_CHECK(mpiSetValue(&r->x, 1));
+      MPI_CHECK(mpiSetValue(&r->y, 1));
+      MPI_CHECK(mpiSetValue(&r->z, 0));
+   }
+   else
+   {
+      //Compute X' = X.Z
+      curve->mul(a, s->x, s->z);
+      ecNistFromInternal(curve, a, a);
+      MPI_CHECK(ecNistExportCoordinate(curve, &r->x, a));
+
+      //Compute Y' = Y.Z^2
+      curve->mul(a, s->z, s->z);
+      curve->mul(a, s->y, a);
+      ecNistFromInternal(curve, a, a);
+      MPI_CHECK(ecNistExportCoordinate(curve, &r->y, a));
+
+      //Set Z' = Z
+      ecNistFromInternal(curve, a, s->z);
+      MPI_CHECK(ecNistExportCoordinate(curve, &r->z, a));
+   }
+
+end:
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Variable-base scalar multiplication (internal representation)
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting point R = d.S
+ * @param[in] k Recoded scalar
+ * @param[in] mask Sign of the recoded scalar
+ * @param[in] s Point S
+ **/
+
+static void ecNistMultInternal(const EcNistCurve *curve, EcNistPoint *r,
+   const uint32_t *k, uint32_t mask, const EcNistPoint *s)
+{
+   int_t i;
+   uint32_t index;
+   uint32_t sign;
+   EcNistPoint t;
+   EcNistPoint table[EC_NIST_WINDOW_POINTS];
+
+   //Precompute the odd multiples (2.j + 1).S
+   ecNistPointDouble(curve, &t, s);
+   table[0] = *s;
+
+   for(i = 1; i < EC_NIST_WINDOW_POINTS; i++)
+   {
+      ecNistPointAdd(curve, &table[i], &table[i - 1], &t);
+   }
+
+   //The most significant digit is always positive
+   ecNistGetDigit(curve, k, curve->numWindows - 1, &index, &sign);
+   ecNistSelectPoint(curve, r, table, EC_NIST_WINDOW_POINTS, index,
+      sign ^ mask);
+
+   //Process the remaining digits
+   for(i = curve->numWindows - 2; i >= 0; i--)
+   {
+      //Compute R = 16.R
+      ecNistPointDouble(curve, r, r);
+      ecNistPointDouble(curve, r, r);
+      ecNistPointDouble(curve, r, r);
+      ecNistPointDouble(curve, r, r);
+
+      //Compute R = R + digit.S
+      ecNistGetDigit(curve, k, i, &index, &sign);
+      ecNistSelectPoint(curve, &t, table, EC_NIST_WINDOW_POINTS, index,
+         sign ^ mask);
+      ecNistPointAdd(curve, r, r, &t);
+   }
+}
+
+
+#if (EC_BASE_TABLE_SUPPORT == ENABLED)
+
+/**
+ * @brief Compute the multiples of a point used by the fixed-base method
+ *
+ * For each window i, the table holds the affine coordinates of the points
+ * (2.j + 1).2^(4.i).S, where 0 <= j < 8
+ *
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] table Table of points
+ * @param[in] s Point S
+ **/
+
+static void ecNistComputeTable(const EcNistCurve *curve, uint32_t *table,
+   const EcNistPoint *s)
+{
+   uint_t i;
+   uint_t j;
+   uint_t n;
+   uint32_t *entry;
+   uint32_t a[EC_NIST_MAX_WORD_LEN];
+   uint32_t c[EC_NIST_WINDOW_POINTS][EC_NIST_MAX_WORD_LEN];
+   EcNistPoint b;
+   EcNistPoint u;
+   EcNistPoint t[EC_NIST_WINDOW_POINTS];
+
+   //Length of a field element, in words
+   n = curve->wordLen;
+
+   //Set B = S
+   b = *s;
+
+   //Loop through the windows
+   for(i = 0; i < curve->numWindows; i++)
+   {
+      //Compute U = 2.B
+      ecNistPointDouble(curve, &u, &b);
+      //The first entry is B
+      t[0] = b;
+
+      //Compute the odd multiples of B
+      for(j = 1; j < EC_NIST_WINDOW_POINTS; j++)
+      {
+         ecNistPointAdd(curve, &t[j], &t[j - 1], &u);
+      }
+
+      //The base of the next window is 16.B = 15.B + B
+      ecNistPointAdd(curve, &b, &t[j - 1], &b);
+
+      //Compute the partial products of the z-coordinates
+      ecNistCopy(curve, c[0], t[0].z);
+
+      for(j = 1; j < EC_NIST_WINDOW_POINTS; j++)
+      {
+         curve->mul(c[j], c[j - 1], t[j].z);
+      }
+
+      //A single inversion is needed to convert the whole window to
+      //affine representation (Montgomery's trick)
+      curve->inv(a, c[EC_NIST_WINDOW_POINTS - 1]);
+
+      for(j = EC_NIST_WINDOW_POINTS - 1; j > 0; j--)
+      {
+         //Compute the inverse of the z-coordinate of the current entry
+         curve->mul(c[j], a, c[j - 1]);
+         curve->mul(a, a, t[j].z);
+      }
+
+      //Inverse of the z-coordinate of the first entry
+      ecNistCopy(curve, c[0], a);
+
+      //Store the affine coordinates
+      for(j = 0; j < EC_NIST_WINDOW_POINTS; j++)
+      {
+         //Point to the current entry
+         entry = table + (i * EC_NIST_WINDOW_POINTS + j) * 2 * n;
+
+         //Recover the affine coordinates
+         curve->mul(entry, t[j].x, c[j]);
+         curve->mul(entry + n, t[j].y, c[j]);
+      }
+   }
+}
+
+#endif
+
+
+#if (EC_NIST_BASE_TABLE_SUPPORT == ENABLED)
+
+/**
+ * @brief Constant-time lookup in a table of affine points
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Selected point, negated if requested
+ * @param[in] table Affine coordinates of the points of the window
+ * @param[in] index Index of the point to be selected
+ * @param[in] sign Set to 1 to negate the selected point
+ **/
+
+static void ecNistSelectAffinePoint(const EcNistCurve *curve, EcNistPoint *r,
+   const uint32_t *table, uint32_t index, uint32_t sign)
+{
+   uint_t i;
+   uint_t n;
+   uint32_t c;
+
+   //Length of a field element, in words
+   n = curve->wordLen;
+
+   //Initialize the resulting point
+   ecNistSetInt(curve, r->x, 0);
+   ecNistSetInt(curve, r->y, 0);
+
+   //Scan the whole window so that the memory access pattern does not depend
+   //on the value of the index
+   for(i = 0; i < EC_NIST_WINDOW_POINTS; i++)
+   {
+      //Check whether the current entry is the one to be selected
+      c = i ^ index;
+      c = ((c | (~c + 1)) >> 31) ^ 1;
+
+      //Constant time implementation
+      ecNistSelect(curve, r->x, r->x, table + i * 2 * n, c);
+      ecNistSelect(curve, r->y, r->y, table + i * 2 * n + n, c);
+   }
+
+   //The selected point is in affine representation
+   ecNistCopy(curve, r->z, curve->one);
+
+   //Negate the point if necessary
+   ecNistCondNegate(curve, r, sign);
+}
+
+
+/**
+ * @brief Fixed-base scalar multiplication using a table (internal
+ *   representation)
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting point R = d.S
+ * @param[in] k Recoded scalar
+ * @param[in] mask Sign of the recoded scalar
+ * @param[in] table Precomputed multiples of S
+ **/
+
+static void ecNistMultTableInternal(const EcNistCurve *curve, EcNistPoint *r,
+   const uint32_t *k, uint32_t mask, const uint32_t *table)
+{
+   uint_t i;
+   uint32_t index;
+   uint32_t sign;
+   EcNistPoint t;
+
+   //Select the point corresponding to the first digit
+   ecNistGetDigit(curve, k, 0, &index, &sign);
+   ecNistSelectAffinePoint(curve, r, table, index, sign ^ mask);
+
+   //Process the remaining digits (no point doubling is required)
+   for(i = 1; i < curve->numWindows; i++)
+   {
+      //Compute R = R + digit.2^(4.i).S
+      ecNistGetDigit(curve, k, i, &index, &sign);
+      ecNistSelectAffinePoint(curve, &t, table + i * EC_NIST_WINDOW_POINTS *
+         2 * curve->wordLen, index, sign ^ mask);
+      ecNistPointAddMixed(curve, r, r, &t);
+   }
+}
+
+#endif
+
+
+#if (EC_NIST_BASE_TABLE_SUPPORT == ENABLED && EC_BASE_TABLE_SUPPORT == ENABLED)
+
+/**
+ * @brief Variable-time lookup in a table of affine points
+ *
+ * The index is derived from a public scalar, hence the selected entry can be
+ * read directly
+ *
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Selected point, negated if requested
+ * @param[in] table Affine coordinates of the points of the window
+ * @param[in] index Index of the point to be selected
+ * @param[in] sign Set to 1 to negate the selected point
+ **/
+
+static void ecNistLoadAffinePoint(const EcNistCurve *curve, EcNistPoint *r,
+   const uint32_t *table, uint32_t index, uint32_t sign)
+{
+   //Point to the selected entry
+   table += index * 2 * curve->wordLen;
+
+   //Load the affine coordinates
+   ecNistCopy(curve, r->x, table);
+   ecNistCopy(curve, r->y, table + curve->wordLen);
+   ecNistCopy(curve, r->z, curve->one);
+
+   //Negate the point if necessary
+   if(sign != 0)
+   {
+      ecNistCondNegate(curve, r, sign);
+   }
+}
+
+
+/**
+ * @brief Twin multiplication using two tables (internal representation)
+ *
+ * The scalars are public, hence the table entries are read directly
+ *
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting point R = d0.S + d1.T
+ * @param[in] k0 Recoded scalar d0
+ * @param[in] mask0 Sign of the recoded scalar d0
+ * @param[in] table0 Precomputed multiples of S
+ * @param[in] k1 Recoded scalar d1
+ * @param[in] mask1 Sign of the recoded scalar d1
+ * @param[in] table1 Precomputed multiples of T
+ **/
+
+static void ecNistTwinMultTableInternal(const EcNistCurve *curve,
+   EcNistPoint *r, const uint32_t *k0, uint32_t mask0, const uint32_t *table0,
+   const uint32_t *k1, uint32_t mask1, const uint32_t *table1)
+{
+   uint_t i;
+   size_t offset;
+   uint32_t index;
+   uint32_t sign;
+   EcNistPoint t;
+
+   //Set R = (0, 1, 0)
+   ecNistSetInt(curve, r->x, 0);
+   ecNistCopy(curve, r->y, curve->one);
+   ecNistSetInt(curve, r->z, 0);
+
+   //Both scalars share the same windows (no point doubling is required)
+   for(i = 0; i < curve->numWindows; i++)
+   {
+      //Offset of the current window in the tables
+      offset = i * EC_NIST_WINDOW_POINTS * 2 * curve->wordLen;
+
+      //Compute R = R + digit.2^(4.i).S
+      ecNistGetDigit(curve, k0, i, &index, &sign);
+      ecNistLoadAffinePoint(curve, &t, table0 + offset, index, sign ^ mask0);
+      ecNistPointAddMixed(curve, r, r, &t);
+
+      //Compute R = R + digit.2^(4.i).T
+      ecNistGetDigit(curve, k1, i, &index, &sign);
+      ecNistLoadAffinePoint(curve, &t, table1 + offset, index, sign ^ mask1);
+      ecNistPointAddMixed(curve, r, r, &t);
+   }
+}
+
+#endif
+
+
+/**
+ * @brief Fixed-base scalar multiplication (internal representation)
+ *
+ * The precomputed multiples of G are used when the tables are compiled in.
+ * Otherwise the computation falls back to the variable-base method
+ *
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting point R = d.G
+ * @param[in] k Recoded scalar
+ * @param[in] mask Sign of the recoded scalar
+ **/
+
+static void ecNistMultBaseInternal(const EcNistCurve *curve, EcNistPoint *r,
+   const uint32_t *k, uint32_t mask)
+{
+   EcNistPoint g;
+
+#if (EC_NIST_BASE_TABLE_SUPPORT == ENABLED)
+   //Precomputed multiples of G available?
+   if(curve->baseTable != NULL)
+   {
+      //Compute R = d.G
+      ecNistMultTableInternal(curve, r, k, mask, curve->baseTable);
+   }
+   else
+#endif
+   {
+      //Load the base point G
+      ecNistLoadBasePoint(curve, &g);
+      //Fall back to the variable-base scalar multiplication
+      ecNistMultInternal(curve, r, k, mask, &g);
+   }
+}
+
+
+/**
+ * @brief Interleaved multiplication (internal representation)
+ *
+ * The scalars are public, hence the sequence of point operations and the
+ * table accesses may depend on their value
+ *
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting point R = d0.S + d1.T
+ * @param[in] naf0 Width-5 NAF of the scalar d0
+ * @param[in] s Odd multiples of S
+ * @param[in] naf1 Width-5 NAF of the scalar d1
+ * @param[in] t Odd multiples of T
+ **/
+
+static void ecNistTwinMultInternal(const EcNistCurve *curve, EcNistPoint *r,
+   const int8_t *naf0, const EcNistPoint *s, const int8_t *naf1,
+   const EcNistPoint *t)
+{
+   int_t i;
+   EcNistPoint u;
+
+   //Set R = (0, 1, 0)
+   ecNistSetInt(curve, r->x, 0);
+   ecNistCopy(curve, r->y, curve->one);
+   ecNistSetInt(curve, r->z, 0);
+
+   //Skip the leading zero digits
+   i = curve->byteLen * 8;
+
+   while(i >= 0 && naf0[i] == 0 && naf1[i] == 0)
+   {
+      i--;
+   }
+
+   //Process the remaining digits
+   for(; i >= 0; i--)
+   {
+      //Compute R = 2.R
+      ecNistPointDouble(curve, r, r);
+
+      //Non-zero digit?
+      if(naf0[i] != 0)
+      {
+         //Compute R = R + digit.S
+         u = s[((naf0[i] < 0) ? -naf0[i] : naf0[i]) >> 1];
+         ecNistCondNegate(curve, &u, naf0[i] < 0);
+         ecNistPointAdd(curve, r, r, &u);
+      }
+
+      //Non-zero digit?
+      if(naf1[i] != 0)
+      {
+         //Compute R = R + digit.T
+         u = t[((naf1[i] < 0) ? -naf1[i] : naf1[i]) >> 1];
+         ecNistCondNegate(curve, &u, naf1[i] < 0);
+         ecNistPointAdd(curve, r, r, &u);
+      }
+   }
+}
+
+
+/**
+ * @brief Scalar multiplication
+ *
+ * Key pair generation and signature generation compute d.G, hence the
+ * fixed-base method is used when S is the base point
+ *
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting point R = d.S
+ * @param[in] d An integer d such as 0 <= d < 2^n, where n is the bit length
+ *   of the order
+ * @param[in] s EC point
+ * @return Error code
+ **/
+
+error_t ecNistMult(const EcNistCurve *curve, EcPoint *r, const Mpi *d,
+   const EcPoint *s)
+{
+   error_t error;
+   uint32_t mask;
+   uint32_t k[EC_NIST_MAX_WORD_LEN];
+   uint8_t buffer[2 * EC_MAX_MODULUS_SIZE];
+   EcNistPoint a;
+   EcNistPoint b;
+
+   //Prepare the scalar
+   error = ecNistPrepareScalar(curve, k, &mask, d);
+
+   //Check status code
+   if(!error)
+   {
+      //Retrieve the coordinates of S
+      error = mpiExport(&s->x, buffer, curve->byteLen, MPI_FORMAT_BIG_ENDIAN);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      error = mpiExport(&s->y, buffer + curve->byteLen, curve->byteLen,
+         MPI_FORMAT_BIG_ENDIAN);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Multiplication of the base point?
+      if(mpiCompInt(&s->z, 1) == 0 &&
+         osMemcmp(buffer, curve->g, 2 * curve->byteLen) == 0)
+      {
+         //Compute R = d.G
+         ecNistMultBaseInternal(curve, &b, k, mask);
+      }
+      else
+      {
+         //Convert S to the internal representation
+         error = ecNistImportPoint(curve, &a, s);
+
+         //Check status code
+         if(!error)
+         {
+            //Compute R = d.S
+            ecNistMultInternal(curve, &b, k, mask, &a);
+         }
+      }
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Convert R to affine representation
+      error = ecNistExportPoint(curve, r, &b);
+   }
+
+   //Erase the recoded scalar
+   osMemset(k, 0, sizeof(k));
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Precompute the multiples of a point
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] table Table of precomputed multiples
+ * @param[in] s EC point (affine coordinates)
+ * @return Error code
+ **/
+
+error_t ecNistBuildTable(const EcNistCurve *curve, EcBaseTable *table,
+   const EcPoint *s)
+{
+#if (EC_BASE_TABLE_SUPPORT == ENABLED)
+   error_t error;
+   uint32_t *data;
+   EcNistPoint a;
+
+   //Convert S to the internal representation
+   error = ecNistImportAffinePoint(curve, &a, s);
+
+   //Check status code
+   if(!error)
+   {
+      //Allocate a memory buffer to hold the table
+      data = cryptoAllocMem(curve->numWindows * EC_NIST_WINDOW_POINTS * 2 *
+         curve->wordLen * sizeof(uint32_t));
+
+      //Successful memory allocation?
+      if(data != NULL)
+      {
+         //Compute the multiples of S
+         ecNistComputeTable(curve, data, &a);
+
+         //The table is now ready for use
+         table->numWindows = curve->numWindows;
+         table->data = (uint8_t *) data;
+         table->ready = TRUE;
+      }
+      else
+      {
+         //Failed to allocate memory
+         error = ERROR_OUT_OF_MEMORY;
+      }
+   }
+
+   //Return status code
+   return error;
+#else
+   //Not implemented
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
+/**
+ * @brief Twin multiplication with the base point
+ *
+ * The scalars are public (signature verification), hence a width-5 NAF
+ * is used and the two multiplications share the same point doublings.
+ * When the multiples of both G and T have been precomputed, no doubling is
+ * needed
+ *
+ * @param[in] curve Dedicated curve implementation
+ * @param[out] r Resulting point R = d0.G + d1.T (Jacobian coordinates)
+ * @param[in] d0 An integer d such as 0 <= d0 < 2^n
+ * @param[in] d1 An integer d such as 0 <= d1 < 2^n
+ * @param[in] t EC point (affine coordinates)
+ * @param[in] table Precomputed multiples of T (optional parameter)
+ * @return Error code
+ **/
+
+error_t ecNistTwinMultBase(const EcNistCurve *curve, EcPoint *r,
+   const Mpi *d0, const Mpi *d1, const EcPoint *t, const EcBaseTable *table)
+{
+   error_t error;
+   uint_t i;
+   int8_t naf0[EC_MAX_MODULUS_SIZE * 8 + 1];
+   int8_t naf1[EC_MAX_MODULUS_SIZE * 8 + 1];
+   uint8_t buffer[EC_MAX_MODULUS_SIZE];
+   EcNistPoint a;
+   EcNistPoint b;
+   EcNistPoint s[EC_NIST_WINDOW_POINTS];
+   EcNistPoint u[EC_NIST_WINDOW_POINTS];
+#if (EC_NIST_BASE_TABLE_SUPPORT == ENABLED && EC_BASE_TABLE_SUPPORT == ENABLED)
+   uint32_t mask0;
+   uint32_t mask1;
+   uint32_t k0[EC_NIST_MAX_WORD_LEN];
+   uint32_t k1[EC_NIST_MAX_WORD_LEN];
+
+   //Precomputed multiples of both G and T available? Otherwise the
+   //interleaved method is faster than two separate multiplications
+   if(table != NULL && curve->baseTable != NULL)
+   {
+      //Prepare the scalars
+      error = ecNistPrepareScalar(curve, k0, &mask0, d0);
+
+      //Check status code
+      if(!error)
+      {
+         error = ecNistPrepareScalar(curve, k1, &mask1, d1);
+      }
+
+      //Check status code
+      if(!error)
+      {
+         //Compute R = d0.G + d1.T
+         ecNistTwinMultTableInternal(curve, &a, k0, mask0, curve->baseTable,
+            k1, mask1, (const uint32_t *) table->data);
+
+         //Return R in Jacobian coordinates
+         error = ecNistExportJacobianPoint(curve, r, &a);
+      }
+   }
+   else
+#endif
+   {
+      //Recode the scalar d0
+      error = mpiExport(d0, buffer, curve->byteLen, MPI_FORMAT_BIG_ENDIAN);
+
+      //Check status code
+      if(!error)
+      {
+         ecComputeWnaf(naf0, buffer, curve->byteLen, EC_NIST_NAF_WIDTH);
+
+         //Recode the scalar d1
+         error = mpiExport(d1, buffer, curve->byteLen, MPI_FORMAT_BIG_ENDIAN);
+      }
+
+      //Check status code
+      if(!error)
+      {
+         ecComputeWnaf(naf1, buffer, curve->byteLen, EC_NIST_NAF_WIDTH);
+
+         //Convert T to the internal representation
+         error = ecNistImportAffinePoint(curve, &a, t);
+      }
+
+      //Check status code
+      if(!error)
+      {
+         //Precompute the odd multiples (2.i + 1).T
+         ecNistPointDouble(curve, &b, &a);
+         u[0] = a;
+
+         for(i = 1; i < EC_NIST_WINDOW_POINTS; i++)
+         {
+            ecNistPointAdd(curve, &u[i], &u[i - 1], &b);
+         }
+
+#if (EC_NIST_BASE_TABLE_SUPPORT == ENABLED)
+         //The first window of the fixed-base table holds the odd multiples
+         //of G
+         if(curve->baseTable != NULL)
+         {
+            //Retrieve the odd multiples (2.i + 1).G
+            for(i = 0; i < EC_NIST_WINDOW_POINTS; i++)
+            {
+               ecNistCopy(curve, s[i].x, curve->baseTable +
+                  i * 2 * curve->wordLen);
+               ecNistCopy(curve, s[i].y, curve->baseTable +
+                  i * 2 * curve->wordLen + curve->wordLen);
+               ecNistCopy(curve, s[i].z, curve->one);
+            }
+         }
+         else
+#endif
+         {
+            //Load the base point G
+            ecNistLoadBasePoint(curve, &a);
+
+            //Precompute the odd multiples (2.i + 1).G
+            ecNistPointDouble(curve, &b, &a);
+            s[0] = a;
+
+            for(i = 1; i < EC_NIST_WINDOW_POINTS; i++)
+            {
+               ecNistPointAdd(curve, &s[i], &s[i - 1], &b);
+            }
+         }
+
+         //Compute R = d0.G + d1.T
+         ecNistTwinMultInternal(curve, &a, naf0, s, naf1, u);
+         //Return R in Jacobian coordinates
+         error = ecNistExportJacobianPoint(curve, r, &a);
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+#endif
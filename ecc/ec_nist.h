@@ -0,0 +1,141 @@
+/**
+ * @file ec_nist.h
+ * @brief Common layer of the dedicated NIST curve implementations
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+#ifndef _EC_NIST_H
+#define _EC_NIST_H
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec.h"
+
+//Precomputed multiples of the base points (read-only tables)
+#ifndef EC_NIST_BASE_TABLE_SUPPORT
+   #define EC_NIST_BASE_TABLE_SUPPORT ENABLED
+#elif (EC_NIST_BASE_TABLE_SUPPORT != ENABLED && EC_NIST_BASE_TABLE_SUPPORT != DISABLED)
+   #error EC_NIST_BASE_TABLE_SUPPORT parameter is not valid
+#endif
+
+//Maximum length of a field element, in words
+#define EC_NIST_MAX_WORD_LEN 17
+//Number of points per window
+#define EC_NIST_WINDOW_POINTS 8
+//Width of the NAF used by the twin multiplication
+#define EC_NIST_NAF_WIDTH 5
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Modular operation with two operands
+ **/
+
+typedef void (*EcNistFieldOp)(uint32_t *r, const uint32_t *a,
+   const uint32_t *b);
+
+
+/**
+ * @brief Modular operation with a single operand
+ **/
+
+typedef void (*EcNistFieldUnaryOp)(uint32_t *r, const uint32_t *a);
+
+
+/**
+ * @brief Conversion between an octet string and a field element
+ **/
+
+typedef void (*EcNistImportFunc)(uint32_t *a, const uint8_t *data);
+typedef void (*EcNistExportFunc)(const uint32_t *a, uint8_t *data);
+
+
+/**
+ * @brief Point in homogeneous projective coordinates
+ *
+ * The coordinates (X : Y : Z), with x = X / Z and y = Y / Z, are stored in
+ * the internal representation of the field
+ *
+ **/
+
+typedef struct
+{
+   uint32_t x[EC_NIST_MAX_WORD_LEN]; ///<x-coordinate
+   uint32_t y[EC_NIST_MAX_WORD_LEN]; ///<y-coordinate
+   uint32_t z[EC_NIST_MAX_WORD_LEN]; ///<z-coordinate
+} EcNistPoint;
+
+
+/**
+ * @brief Dedicated implementation of a NIST curve
+ *
+ * The curves have a = -3 and a prime order. Only the field arithmetic is
+ * specific to each curve
+ *
+ **/
+
+typedef struct
+{
+   uint_t wordLen;              ///<Length of a field element, in words
+   size_t byteLen;              ///<Length of a field element, in bytes
+   uint_t bitLen;               ///<Length of the order, in bits
+   uint_t numWindows;           ///<Number of 4-bit windows of the scalars
+   const uint32_t *q;           ///<Order of the base point
+   const uint32_t *b;           ///<Curve parameter b (internal representation)
+   const uint32_t *one;         ///<Value 1 (internal representation)
+   const uint32_t *r2;          ///<Conversion to the Montgomery domain (optional)
+   const uint8_t *g;            ///<Base point G (affine coordinates)
+   const uint32_t *baseTable;   ///<Precomputed multiples of G (optional)
+   EcNistFieldOp add;           ///<Modular addition
+   EcNistFieldOp sub;           ///<Modular subtraction
+   EcNistFieldOp mul;           ///<Modular multiplication
+   EcNistFieldUnaryOp inv;      ///<Modular inversion
+   EcNistImportFunc importInt;  ///<Octet string to field element conversion
+   EcNistExportFunc exportInt;  ///<Field element to octet string conversion
+} EcNistCurve;
+
+
+//Dedicated NIST curve related functions
+error_t ecNistMult(const EcNistCurve *curve, EcPoint *r, const Mpi *d,
+   const EcPoint *s);
+
+error_t ecNistBuildTable(const EcNistCurve *curve, EcBaseTable *table,
+   const EcPoint *s);
+
+error_t ecNistTwinMultBase(const EcNistCurve *curve, EcPoint *r,
+   const Mpi *d0, const Mpi *d1, const EcPoint *t, const EcBaseTable *table);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
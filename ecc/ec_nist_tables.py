@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+#
+# @file ec_nist_tables.py
+# @brief Generate the precomputed multiples of the NIST base points
+#
+# @section License
+#
+# SPDX-License-Identifier: GPL-2.0-or-later
+#
+# Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+#
+# This file is part of CycloneCRYPTO Open.
+#
+# This program is free software; you can redistribute it and/or
+# modify it under the terms of the GNU General Public License
+# as published by the Free Software Foundation; either version 2
+# of the License, or (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program; if not, write to the Free Software Foundation,
+# Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+#
+# @section Description
+#
+# The fixed-base scalar multiplication of the dedicated secp256r1, secp384r1
+# and secp521r1 implementations (refer to ec_nist.c) reads the multiples of
+# the base point from constant tables. This script computes them and writes
+# p256_table.h, p384_table.h and p521_table.h to the directory that contains
+# the script:
+#
+#    python3 ec_nist_tables.py
+#
+# For each 4-bit window i, the table holds the affine coordinates of the
+# points (2.j + 1).2^(4.i).G, where 0 <= j < 8. Each coordinate is stored as
+# an array of 32-bit words (least significant word first), in the internal
+# representation of the field (Montgomery domain for secp256r1, plain value
+# for secp384r1 and secp521r1)
+#
+# @author Oryx Embedded SARL (www.oryx-embedded.com)
+# @version 2.4.0
+#
+
+import os
+
+#Dedicated NIST curve implementations
+CURVES = [
+   {
+      'name': 'secp256r1',
+      'prefix': 'P256',
+      'file': 'p256_table.h',
+      'p': 0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF,
+      'b': 0x5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B,
+      'gx': 0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296,
+      'gy': 0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5,
+      'wordLen': 8,
+      'numWindows': 64,
+      'montgomery': True
+   },
+   {
+      'name': 'secp384r1',
+      'prefix': 'P384',
+      'file': 'p384_table.h',
+      'p': 0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFF0000000000000000FFFFFFFF,
+      'b': 0xB3312FA7E23EE7E4988E056BE3F82D19181D9C6EFE8141120314088F5013875AC656398D8A2ED19D2A85C8EDD3EC2AEF,
+      'gx': 0xAA87CA22BE8B05378EB1C71EF320AD746E1D3B628BA79B9859F741E082542A385502F25DBF55296C3A545E3872760AB7,
+      'gy': 0x3617DE4A96262C6F5D9E98BF9292DC29F8F41DBD289A147CE9DA3113B5F0B8C00A60B1CE1D7E819D7A431D7C90EA0E5F,
+      'wordLen': 12,
+      'numWindows': 96,
+      'montgomery': False
+   },
+   {
+      'name': 'secp521r1',
+      'prefix': 'P521',
+      'file': 'p521_table.h',
+      'p': (1 << 521) - 1,
+      'b': 0x0051953EB9618E1C9A1F929A21A0B68540EEA2DA725B99B315F3B8B489918EF109E156193951EC7E937B1652C0BD3BB1BF073573DF883D2C34F1EF451FD46B503F00,
+      'gx': 0x00C6858E06B70404E9CD9E3ECB662395B4429C648139053FB521F828AF606B4D3DBAA14B5E77EFE75928FE1DC127A2FFA8DE3348B3C1856A429BF97E7E31C2E5BD66,
+      'gy': 0x011839296A789A3BC0045C8A5FB42C7D1BD998F54449579B446817AFBD17273E662C97EE72995EF42640C550B9013FAD0761353C7086A272C24088BE94769FD16650,
+      'wordLen': 17,
+      'numWindows': 131,
+      'montgomery': False
+   }
+]
+
+#License header of the generated files
+LICENSE = '''/**
+ * @file {file}
+ * @brief Precomputed multiples of the {name} base point
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * This file is generated by ec_nist_tables.py and must not be edited. For
+ * each 4-bit window i, the table holds the affine coordinates of the points
+ * (2.j + 1).2^(4.i).G, where 0 <= j < 8, in the internal representation of
+ * the field ({representation})
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+'''
+
+
+def point_add(c, s, t):
+   #Affine point addition (the operands are distinct and not opposite)
+   p = c['p']
+   l = (t[1] - s[1]) * pow(t[0] - s[0], -1, p) % p
+   x = (l * l - s[0] - t[0]) % p
+   return (x, (l * (s[0] - x) - s[1]) % p)
+
+
+def point_double(c, s):
+   #Affine point doubling (a = -3)
+   p = c['p']
+   l = (3 * s[0] * s[0] - 3) * pow(2 * s[1], -1, p) % p
+   x = (l * l - 2 * s[0]) % p
+   return (x, (l * (s[0] - x) - s[1]) % p)
+
+
+def to_words(c, a):
+   #Convert a field element to the internal representation
+   if c['montgomery']:
+      a = (a << (32 * c['wordLen'])) % c['p']
+   return [(a >> (32 * i)) & 0xFFFFFFFF for i in range(c['wordLen'])]
+
+
+def generate(c):
+   lines = []
+   b = (c['gx'], c['gy'])
+
+   #Make sure the base point lies on the curve
+   assert (b[1] ** 2 - b[0] ** 3 + 3 * b[0] - c['b']) % c['p'] == 0
+
+   #Loop through the windows
+   for i in range(c['numWindows']):
+      lines.append('   //Window {}'.format(i))
+
+      #Compute the odd multiples of B
+      u = point_double(c, b)
+      t = [b]
+      for j in range(1, 8):
+         t.append(point_add(c, t[j - 1], u))
+
+      #Store the affine coordinates
+      for j in range(8):
+         words = to_words(c, t[j][0]) + to_words(c, t[j][1])
+         for k in range(0, len(words), 4):
+            lines.append('   ' + ', '.join('0x{:08X}'.format(w)
+               for w in words[k:k + 4]) + ',')
+
+      #The base of the next window is 16.B = 15.B + B
+      b = point_add(c, t[7], b)
+
+   #The last entry has no trailing comma
+   lines[-1] = lines[-1].rstrip(',')
+
+   guard = '_{}_TABLE_H'.format(c['prefix'])
+   size = c['numWindows'] * 8 * 2 * c['wordLen']
+   representation = 'Montgomery domain' if c['montgomery'] else 'plain value'
+
+   text = LICENSE.format(file=c['file'], name=c['name'],
+      representation=representation)
+   text += '\n#ifndef {0}\n#define {0}\n\n'.format(guard)
+   text += '//Dependencies\n#include "core/crypto.h"\n'
+   text += '#include "ecc/ec_nist.h"\n#include "ecc/{}.h"\n\n'.format(
+      c['prefix'].lower())
+   text += '//Check crypto library configuration\n'
+   text += '#if (EC_SUPPORT == ENABLED && {}_SUPPORT == ENABLED && \\\n'.format(
+      c['name'].upper())
+   text += '   {}_SUPPORT == ENABLED && EC_NIST_BASE_TABLE_SUPPORT == ENABLED)\n\n'.format(
+      c['prefix'])
+   text += '//Precomputed multiples of the base point\n'
+   text += 'static const uint32_t {}_BASE_TABLE[{}] =\n{{\n'.format(
+      c['prefix'], size)
+   text += '\n'.join(lines)
+   text += '\n};\n\n#endif\n#endif\n'
+   return text
+
+
+if __name__ == '__main__':
+   path = os.path.dirname(os.path.abspath(__file__))
+
+   for c in CURVES:
+      with open(os.path.join(path, c['file']), 'w', newline='\n') as f:
+         f.write(generate(c))
@@ -403,6 +403,9 @@ __weak_func error_t ecdsaGenerateSignature(const PrngAlgo *prngAlgo, void *prngC
    Mpi k;
    Mpi z;
    EcPoint r1;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
 
    //Check parameters
    if(params == NULL || privateKey == NULL || digest == NULL || signature == NULL)
@@ -415,6 +418,11 @@ __weak_func error_t ecdsaGenerateSignature(const PrngAlgo *prngAlgo, void *prngC
    TRACE_DEBUG("  digest:\r\n");
    TRACE_DEBUG_ARRAY("    ", digest, digestLen);
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
+
    //Initialize multiple precision integers
    mpiInit(&k);
    mpiInit(&z);
@@ -447,7 +455,7 @@ __weak_func error_t ecdsaGenerateSignature(const PrngAlgo *prngAlgo, void *prngC
    TRACE_DEBUG_MPI("    ", &z);
 
    //Compute R1 = (x1, y1) = k.G
-   EC_CHECK(ecMult(params, &r1, &k, &params->g));
+   EC_CHECK(ecMultBase(params, &r1, &k));
    EC_CHECK(ecAffinify(params, &r1, &r1));
 
    //Debug message
@@ -460,7 +468,7 @@ __weak_func error_t ecdsaGenerateSignature(const PrngAlgo *prngAlgo, void *prngC
    MPI_CHECK(mpiMod(&signature->r, &r1.x, &params->q));
 
    //Compute k ^ -1 mod q
-   MPI_CHECK(mpiInvMod(&k, &k, &params->q));
+   MPI_CHECK(mpiInvModRegular(&k, &k, &params->q));
 
    //Compute s = k ^ -1 * (z + x * r) mod q
    MPI_CHECK(mpiMul(&signature->s, &privateKey->d, &signature->r));
@@ -489,6 +497,122 @@ end:
       mpiFree(&signature->s);
    }
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Convert a digest to an integer
+ * @param[in] params EC domain parameters
+ * @param[out] z Leftmost N bits of the digest, where N is the bit length of q
+ * @param[in] digest Digest of the message
+ * @param[in] digestLen Length in octets of the digest
+ * @return Error code
+ **/
+
+static error_t ecdsaReadDigest(const EcDomainParameters *params, Mpi *z,
+   const uint8_t *digest, size_t digestLen)
+{
+   error_t error;
+   uint_t n;
+
+   //Let N be the bit length of q
+   n = mpiGetBitLength(&params->q);
+   //Compute N = MIN(N, outlen)
+   n = MIN(n, digestLen * 8);
+
+   //Convert the digest to a multiple precision integer
+   error = mpiReadRaw(z, digest, (n + 7) / 8);
+
+   //Check status code
+   if(!error)
+   {
+      //Keep the leftmost N bits of the hash value
+      if((n % 8) != 0)
+      {
+         error = mpiShiftRight(z, 8 - (n % 8));
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Compare the x-coordinate of V0 with r
+ *
+ * Let (X, Y, Z) be the Jacobian coordinates of V0. Since x0 = X / Z^2 and
+ * 0 <= x0 < p, the condition x0 mod q = r holds if and only if
+ * X = (r + k.q) * Z^2 mod p for some k >= 0 such that r + k.q < p. Hence V0
+ * does not need to be converted to affine representation
+ *
+ * @param[in] params EC domain parameters
+ * @param[in] v0 EC point V0 (Jacobian coordinates)
+ * @param[in] r Integer r such as 0 < r < q
+ * @return Error code
+ **/
+
+static error_t ecdsaCheckPoint(const EcDomainParameters *params,
+   const EcPoint *v0, const Mpi *r)
+{
+   error_t error;
+   bool_t valid;
+   Mpi c;
+   Mpi t;
+   Mpi u;
+
+   //The point at the infinity cannot match r
+   if(!mpiCompInt(&v0->z, 0))
+      return ERROR_INVALID_SIGNATURE;
+
+   //Initialize multiple precision integers
+   mpiInit(&c);
+   mpiInit(&t);
+   mpiInit(&u);
+
+   //Compute t = Z^2 mod p
+   MPI_CHECK(ecSqrMod(params, &t, &v0->z));
+   //The first candidate for x0 is r
+   MPI_CHECK(mpiCopy(&c, r));
+
+   //Loop through the candidates
+   for(valid = FALSE; !valid && mpiComp(&c, &params->p) < 0; )
+   {
+      //Compute u = c * Z^2 mod p
+      MPI_CHECK(ecMulMod(params, &u, &c, &t));
+
+      //Check whether X = u
+      if(!mpiComp(&u, &v0->x))
+      {
+         valid = TRUE;
+      }
+      else
+      {
+         //Try the next candidate
+         MPI_CHECK(mpiAdd(&c, &c, &params->q));
+      }
+   }
+
+   //If v = r, then the signature is verified. If v does not equal r,
+   //then the message or the signature may have been modified
+   if(!valid)
+   {
+      error = ERROR_INVALID_SIGNATURE;
+   }
+
+end:
+   //Release multiple precision integers
+   mpiFree(&c);
+   mpiFree(&t);
+   mpiFree(&u);
+
    //Return status code
    return error;
 }
@@ -509,14 +633,14 @@ __weak_func error_t ecdsaVerifySignature(const EcDomainParameters *params,
    const EcdsaSignature *signature)
 {
    error_t error;
-   uint_t n;
    Mpi w;
    Mpi z;
    Mpi u1;
    Mpi u2;
-   Mpi v;
    EcPoint v0;
-   EcPoint v1;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
 
    //Check parameters
    if(params == NULL || publicKey == NULL || digest == NULL || signature == NULL)
@@ -551,79 +675,318 @@ __weak_func error_t ecdsaVerifySignature(const EcDomainParameters *params,
       return ERROR_INVALID_SIGNATURE;
    }
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
+
    //Initialize multiple precision integers
    mpiInit(&w);
    mpiInit(&z);
    mpiInit(&u1);
    mpiInit(&u2);
-   mpiInit(&v);
    //Initialize EC points
    ecInit(&v0);
-   ecInit(&v1);
 
-   //Let N be the bit length of q
-   n = mpiGetBitLength(&params->q);
-   //Compute N = MIN(N, outlen)
-   n = MIN(n, digestLen * 8);
-
-   //Convert the digest to a multiple precision integer
-   MPI_CHECK(mpiReadRaw(&z, digest, (n + 7) / 8));
-
-   //Keep the leftmost N bits of the hash value
-   if((n % 8) != 0)
-   {
-      MPI_CHECK(mpiShiftRight(&z, 8 - (n % 8)));
-   }
+   //Convert the digest to an integer
+   MPI_CHECK(ecdsaReadDigest(params, &z, digest, digestLen));
 
    //Compute w = s ^ -1 mod q
-   MPI_CHECK(mpiInvMod(&w, &signature->s, &params->q));
+   MPI_CHECK(mpiInvModRegular(&w, &signature->s, &params->q));
    //Compute u1 = z * w mod q
    MPI_CHECK(mpiMulMod(&u1, &z, &w, &params->q));
    //Compute u2 = r * w mod q
    MPI_CHECK(mpiMulMod(&u2, &signature->r, &w, &params->q));
 
    //Compute V0 = (x0, y0) = u1.G + u2.Q
-   EC_CHECK(ecProjectify(params, &v1, &publicKey->q));
-   EC_CHECK(ecTwinMult(params, &v0, &u1, &params->g, &u2, &v1));
-   EC_CHECK(ecAffinify(params, &v0, &v0));
+   EC_CHECK(ecTwinMultBase(params, &v0, &u1, &u2, publicKey));
 
    //Debug message
-   TRACE_DEBUG("  x0:\r\n");
+   TRACE_DEBUG("  X0:\r\n");
    TRACE_DEBUG_MPI("    ", &v0.x);
-   TRACE_DEBUG("  y0:\r\n");
-   TRACE_DEBUG_MPI("    ", &v0.y);
+   TRACE_DEBUG("  Z0:\r\n");
+   TRACE_DEBUG_MPI("    ", &v0.z);
 
-   //Compute v = x0 mod q
-   MPI_CHECK(mpiMod(&v, &v0.x, &params->q));
+   //Check whether x0 mod q = r
+   error = ecdsaCheckPoint(params, &v0, &signature->r);
+
+end:
+   //Release multiple precision integers
+   mpiFree(&w);
+   mpiFree(&z);
+   mpiFree(&u1);
+   mpiFree(&u2);
+   //Release EC point
+   ecFree(&v0);
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief ECDSA batch signature verification (one signature at a time)
+ *
+ * Each signature is verified by ecdsaVerifySignature, so that the hardware
+ * accelerator is used when available. Hardware ports that override
+ * ecdsaVerifySignature therefore implement ecdsaVerifySignatureBatch with
+ * this function
+ *
+ * @param[in] params EC domain parameters
+ * @param[in,out] items Signatures to be verified
+ * @param[in] numItems Number of signatures in the batch
+ * @return Error code
+ **/
+
+error_t ecdsaVerifySignatureSequence(const EcDomainParameters *params,
+   EcdsaVerifyItem *items, uint_t numItems)
+{
+   error_t error;
+   error_t status;
+   uint_t i;
+
+   //Check parameters
+   if(params == NULL || (items == NULL && numItems != 0))
+      return ERROR_INVALID_PARAMETER;
+
+   //The batch is valid only if all the signatures are valid
+   status = NO_ERROR;
+
+   //Loop through the signatures
+   for(i = 0; i < numItems; i++)
+   {
+      //Verify the current signature
+      error = ecdsaVerifySignature(params, items[i].publicKey,
+         items[i].digest, items[i].digestLen, items[i].signature);
+
+      //Save the result of the verification
+      items[i].error = error;
+
+      //The batch is valid only if all the signatures are valid
+      if(error)
+      {
+         status = ERROR_INVALID_SIGNATURE;
+      }
+   }
+
+   //Return status code
+   return status;
+}
+
+
+/**
+ * @brief ECDSA batch signature verification
+ *
+ * The signatures may have been generated with distinct keys. The inverses
+ * of the integers s are computed all at once using Montgomery's trick (refer
+ * to mpiInvModBatch), so that a single modular inversion is shared by the
+ * whole batch. The result of each individual verification is stored in the
+ * corresponding item of the batch. When no memory can be allocated for the
+ * batch, the signatures are verified one at a time
+ *
+ * @param[in] params EC domain parameters
+ * @param[in,out] items Signatures to be verified
+ * @param[in] numItems Number of signatures in the batch
+ * @return Error code
+ **/
+
+__weak_func error_t ecdsaVerifySignatureBatch(const EcDomainParameters *params,
+   EcdsaVerifyItem *items, uint_t numItems)
+{
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   error_t error;
+   error_t status;
+   uint_t i;
+   uint_t k;
+   uint_t n;
+   Mpi *s;
+   Mpi *w;
+   const EcdsaSignature *signature;
+   Mpi z;
+   Mpi u1;
+   Mpi u2;
+   EcPoint v0;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
+
+   //Check parameters
+   if(params == NULL || (items == NULL && numItems != 0))
+      return ERROR_INVALID_PARAMETER;
+
+   //Empty batch?
+   if(numItems == 0)
+      return NO_ERROR;
+
+   //Allocate the integers s and their inverses
+   s = cryptoAllocMem(2 * numItems * sizeof(Mpi));
+   //Failed to allocate memory?
+   if(s == NULL)
+      return ecdsaVerifySignatureSequence(params, items, numItems);
+
+   //Point to the inverses
+   w = s + numItems;
 
    //Debug message
-   TRACE_DEBUG("  v:\r\n");
-   TRACE_DEBUG_MPI("    ", &v);
+   TRACE_DEBUG("ECDSA batch signature verification (%u signatures)...\r\n",
+      numItems);
 
-   //If v = r, then the signature is verified. If v does not equal r,
-   //then the message or the signature may have been modified
-   if(!mpiComp(&v, &signature->r))
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
+
+   //Initialize multiple precision integers
+   for(i = 0; i < (2 * numItems); i++)
    {
-      error = NO_ERROR;
+      mpiInit(&s[i]);
    }
-   else
+
+   mpiInit(&z);
+   mpiInit(&u1);
+   mpiInit(&u2);
+   //Initialize EC point
+   ecInit(&v0);
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Collect the integers s of the signatures to be verified
+   for(k = 0, i = 0; i < numItems; i++)
    {
-      error = ERROR_INVALID_SIGNATURE;
+      //Point to the current signature
+      signature = items[i].signature;
+
+      //The verifier shall check that 0 < r < q and 0 < s < q
+      if(items[i].publicKey == NULL || items[i].digest == NULL ||
+         signature == NULL)
+      {
+         items[i].error = ERROR_INVALID_SIGNATURE;
+      }
+      else if(mpiCompInt(&signature->r, 0) <= 0 ||
+         mpiComp(&signature->r, &params->q) >= 0 ||
+         mpiCompInt(&signature->s, 0) <= 0 ||
+         mpiComp(&signature->s, &params->q) >= 0)
+      {
+         items[i].error = ERROR_INVALID_SIGNATURE;
+      }
+      else
+      {
+         //Check status code
+         if(!error)
+         {
+            error = mpiCopy(&s[k++], &signature->s);
+         }
+
+         //The signature remains to be verified
+         items[i].error = NO_ERROR;
+      }
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Compute w = s ^ -1 mod q for all the signatures at once
+      error = mpiInvModBatch(w, s, k, &params->q);
+   }
+
+   //The batch is valid only if all the signatures are valid
+   status = NO_ERROR;
+
+   //Loop through the signatures
+   for(n = 0, i = 0; i < numItems; i++)
+   {
+      //Any signature to be verified?
+      if(items[i].error == NO_ERROR)
+      {
+         //Any error while inverting s?
+         if(error)
+         {
+            items[i].error = error;
+         }
+         else
+         {
+            //Point to the current signature
+            signature = items[i].signature;
+
+            //Convert the digest to an integer
+            items[i].error = ecdsaReadDigest(params, &z, items[i].digest,
+               items[i].digestLen);
+
+            //Check status code
+            if(!items[i].error)
+            {
+               //Compute u1 = z * w mod q
+               items[i].error = mpiMulMod(&u1, &z, &w[n], &params->q);
+            }
+
+            //Check status code
+            if(!items[i].error)
+            {
+               //Compute u2 = r * w mod q
+               items[i].error = mpiMulMod(&u2, &signature->r, &w[n],
+                  &params->q);
+            }
+
+            //Check status code
+            if(!items[i].error)
+            {
+               //Compute V0 = (x0, y0) = u1.G + u2.Q
+               items[i].error = ecTwinMultBase(params, &v0, &u1, &u2,
+                  items[i].publicKey);
+            }
+
+            //Check status code
+            if(!items[i].error)
+            {
+               //Check whether x0 mod q = r
+               items[i].error = ecdsaCheckPoint(params, &v0, &signature->r);
+            }
+         }
+
+         //Next inverse
+         n++;
+      }
+
+      //The batch is valid only if all the signatures are valid
+      if(items[i].error)
+      {
+         status = ERROR_INVALID_SIGNATURE;
+      }
    }
 
-end:
    //Release multiple precision integers
-   mpiFree(&w);
+   for(i = 0; i < (2 * numItems); i++)
+   {
+      mpiFree(&s[i]);
+   }
+
    mpiFree(&z);
    mpiFree(&u1);
    mpiFree(&u2);
-   mpiFree(&v);
-   //Release EC points
+   //Release EC point
    ecFree(&v0);
-   ecFree(&v1);
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
+   //Release the array of integers
+   cryptoFreeMem(s);
 
    //Return status code
-   return error;
+   return status;
+#else
+   //Verify the signatures one at a time
+   return ecdsaVerifySignatureSequence(params, items, numItems);
+#endif
 }
 
+
 #endif
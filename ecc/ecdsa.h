@@ -52,6 +52,20 @@ typedef struct
 } EcdsaSignature;
 
 
+/**
+ * @brief ECDSA signature to be verified as part of a batch
+ **/
+
+typedef struct
+{
+   const EcPublicKey *publicKey;    ///<Signer's EC public key
+   const uint8_t *digest;           ///<Digest of the message
+   size_t digestLen;                ///<Length in octets of the digest
+   const EcdsaSignature *signature; ///<Signature to be verified
+   error_t error;                   ///<Result of the verification
+} EcdsaVerifyItem;
+
+
 //ECDSA related constants
 extern const uint8_t ECDSA_WITH_SHA1_OID[7];
 extern const uint8_t ECDSA_WITH_SHA224_OID[8];
@@ -81,6 +95,12 @@ error_t ecdsaVerifySignature(const EcDomainParameters *params,
    const EcPublicKey *publicKey, const uint8_t *digest, size_t digestLen,
    const EcdsaSignature *signature);
 
+error_t ecdsaVerifySignatureSequence(const EcDomainParameters *params,
+   EcdsaVerifyItem *items, uint_t numItems);
+
+error_t ecdsaVerifySignatureBatch(const EcDomainParameters *params,
+   EcdsaVerifyItem *items, uint_t numItems);
+
 //C++ guard
 #ifdef __cplusplus
 }
@@ -0,0 +1,507 @@
+/**
+ * @file p256.c
+ * @brief Dedicated secp256r1 (NIST P-256) implementation
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * Field elements are stored as 8 words of 32 bits in the Montgomery domain.
+ * The point arithmetic and the scalar multiplication are shared with the
+ * other NIST curves (refer to ec_nist.c)
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec.h"
+#include "ecc/ec_nist.h"
+#include "ecc/p256.h"
+#include "ecc/p256_table.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (EC_SUPPORT == ENABLED && SECP256R1_SUPPORT == ENABLED && \
+   P256_SUPPORT == ENABLED)
+
+//Number of windows used by the scalar multiplication
+#define P256_NUM_WINDOWS 64
+
+//Prime modulus p
+static const uint32_t P256_P[8] =
+{
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000,
+   0x00000000, 0x00000000, 0x00000001, 0xFFFFFFFF
+};
+
+//Exponent used to compute modular inverses (p - 2)
+static const uint32_t P256_P_MINUS_2[8] =
+{
+   0xFFFFFFFD, 0xFFFFFFFF, 0xFFFFFFFF, 0x00000000,
+   0x00000000, 0x00000000, 0x00000001, 0xFFFFFFFF
+};
+
+//R^2 mod p, where R = 2^256
+static const uint32_t P256_R2[8] =
+{
+   0x00000003, 0x00000000, 0xFFFFFFFF, 0xFFFFFFFB,
+   0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFD, 0x00000004
+};
+
+//R mod p (the value 1 in the Montgomery domain)
+static const uint32_t P256_ONE[8] =
+{
+   0x00000001, 0x00000000, 0x00000000, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE, 0x00000000
+};
+
+//Curve parameter b (Montgomery domain)
+static const uint32_t P256_B[8] =
+{
+   0x29C4BDDF, 0xD89CDF62, 0x78843090, 0xACF005CD,
+   0xF7212ED6, 0xE5A220AB, 0x04874834, 0xDC30061D
+};
+
+//Order of the base point q
+static const uint32_t P256_Q[8] =
+{
+   0xFC632551, 0xF3B9CAC2, 0xA7179E84, 0xBCE6FAAD,
+   0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0xFFFFFFFF
+};
+
+//Base point G (affine coordinates)
+static const uint8_t P256_G[64] =
+{
+   0x6B, 0x17, 0xD1, 0xF2, 0xE1, 0x2C, 0x42, 0x47, 0xF8, 0xBC, 0xE6, 0xE5, 0x63, 0xA4, 0x40, 0xF2,
+   0x77, 0x03, 0x7D, 0x81, 0x2D, 0xEB, 0x33, 0xA0, 0xF4, 0xA1, 0x39, 0x45, 0xD8, 0x98, 0xC2, 0x96,
+   0x4F, 0xE3, 0x42, 0xE2, 0xFE, 0x1A, 0x7F, 0x9B, 0x8E, 0xE7, 0xEB, 0x4A, 0x7C, 0x0F, 0x9E, 0x16,
+   0x2B, 0xCE, 0x33, 0x57, 0x6B, 0x31, 0x5E, 0xCE, 0xCB, 0xB6, 0x40, 0x68, 0x37, 0xBF, 0x51, 0xF5
+};
+
+//Dedicated secp256r1 implementation
+static const EcNistCurve p256Curve =
+{
+   P256_WORD_LEN,
+   P256_BYTE_LEN,
+   P256_BIT_LEN,
+   P256_NUM_WINDOWS,
+   P256_Q,
+   P256_B,
+   P256_ONE,
+   P256_R2,
+   P256_G,
+#if (EC_NIST_BASE_TABLE_SUPPORT == ENABLED)
+   P256_BASE_TABLE,
+#else
+   NULL,
+#endif
+   p256Add,
+   p256Sub,
+   p256Mul,
+   p256Inv,
+   p256Import,
+   p256Export
+};
+
+
+/**
+ * @brief Check whether the domain parameters match secp256r1
+ * @param[in] params EC domain parameters
+ * @return TRUE if the dedicated implementation can be used, else FALSE
+ **/
+
+bool_t p256IsCurve(const EcDomainParameters *params)
+{
+   bool_t res;
+
+   //Check curve name
+   if(params->name != NULL && !osStrcmp(params->name, "secp256r1"))
+   {
+      res = TRUE;
+   }
+   else
+   {
+      res = FALSE;
+   }
+
+   //Return TRUE if the domain parameters match secp256r1
+   return res;
+}
+
+
+/**
+ * @brief Set integer value
+ * @param[out] a Pointer to the integer to be initialized
+ * @param[in] b Initial value
+ **/
+
+void p256SetInt(uint32_t *a, uint32_t b)
+{
+   uint_t i;
+
+   //Set the value of the least significant word
+   a[0] = b;
+
+   //Initialize the rest of the integer
+   for(i = 1; i < 8; i++)
+   {
+      a[i] = 0;
+   }
+}
+
+
+/**
+ * @brief Modular reduction
+ * @param[out] r Resulting integer R = (H * 2^256 + A) mod p
+ * @param[in] a Low part of the integer
+ * @param[in] h High part of the integer (0 or 1)
+ **/
+
+static void p256Red(uint32_t *r, const uint32_t *a, uint32_t h)
+{
+   uint_t i;
+   int64_t temp;
+   uint32_t b[8];
+
+   //Compute B = A - P
+   for(temp = 0, i = 0; i < 8; i++)
+   {
+      temp += a[i];
+      temp -= P256_P[i];
+      b[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //Take into account the high part of the integer
+   temp += h;
+
+   //If H * 2^256 + A < P then R = A, else R = B
+   p256Select(r, b, a, temp & 1);
+}
+
+
+/**
+ * @brief Modular addition
+ * @param[out] r Resulting integer R = (A + B) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void p256Add(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+   uint64_t temp;
+   uint32_t u[8];
+
+   //Compute U = A + B
+   for(temp = 0, i = 0; i < 8; i++)
+   {
+      temp += a[i];
+      temp += b[i];
+      u[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //Perform modular reduction
+   p256Red(r, u, (uint32_t) temp);
+}
+
+
+/**
+ * @brief Modular subtraction
+ * @param[out] r Resulting integer R = (A - B) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void p256Sub(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+   int64_t temp;
+   uint32_t mask;
+   uint32_t u[8];
+
+   //Compute U = A - B
+   for(temp = 0, i = 0; i < 8; i++)
+   {
+      temp += a[i];
+      temp -= b[i];
+      u[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //The mask is the all-1 word if the result is negative
+   mask = (uint32_t) temp;
+
+   //If U < 0 then R = U + P, else R = U
+   for(temp = 0, i = 0; i < 8; i++)
+   {
+      temp += u[i];
+      temp += P256_P[i] & mask;
+      r[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+}
+
+
+/**
+ * @brief Montgomery multiplication
+ * @param[out] r Resulting integer R = (A * B / 2^256) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void p256Mul(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+   uint_t j;
+   uint32_t m;
+   uint64_t c;
+   uint32_t u[10];
+
+   //Initialize accumulator
+   for(i = 0; i < 10; i++)
+   {
+      u[i] = 0;
+   }
+
+   //Word-by-word Montgomery multiplication
+   for(i = 0; i < 8; i++)
+   {
+      //Compute U = U + A * B[i]
+      for(c = 0, j = 0; j < 8; j++)
+      {
+         c += (uint64_t) a[j] * b[i] + u[j];
+         u[j] = c & 0xFFFFFFFF;
+         c >>= 32;
+      }
+
+      //Propagate the carry
+      c += u[8];
+      u[8] = c & 0xFFFFFFFF;
+      u[9] = (uint32_t) (c >> 32);
+
+      //Since -1/p mod 2^32 = 1, the multiplier is the least significant
+      //word of the accumulator
+      m = u[0];
+
+      //Compute U = (U + M * P) / 2^32
+      c = (uint64_t) m * P256_P[0] + u[0];
+      c >>= 32;
+
+      for(j = 1; j < 8; j++)
+      {
+         c += (uint64_t) m * P256_P[j] + u[j];
+         u[j - 1] = c & 0xFFFFFFFF;
+         c >>= 32;
+      }
+
+      //Propagate the carry
+      c += u[8];
+      u[7] = c & 0xFFFFFFFF;
+      u[8] = u[9] + (uint32_t) (c >> 32);
+   }
+
+   //The accumulator is in the range 0 <= U < 2p
+   p256Red(r, u, u[8]);
+}
+
+
+/**
+ * @brief Montgomery squaring
+ * @param[out] r Resulting integer R = (A ^ 2 / 2^256) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ **/
+
+void p256Sqr(uint32_t *r, const uint32_t *a)
+{
+   //Compute R = A ^ 2
+   p256Mul(r, a, a);
+}
+
+
+/**
+ * @brief Modular multiplicative inverse
+ * @param[out] r Resulting integer R = A^-1 mod p (Montgomery domain)
+ * @param[in] a An integer such as 0 <= A < p (Montgomery domain)
+ **/
+
+void p256Inv(uint32_t *r, const uint32_t *a)
+{
+   int_t i;
+   uint32_t u[8];
+
+   //The exponent p - 2 is public, hence a plain square-and-multiply does not
+   //leak any information about A. The most significant bit is set
+   p256Copy(u, a);
+
+   //Compute R = A^(p - 2) mod p
+   for(i = 254; i >= 0; i--)
+   {
+      //Square
+      p256Sqr(u, u);
+
+      //Multiply
+      if(((P256_P_MINUS_2[i / 32] >> (i % 32)) & 1) != 0)
+      {
+         p256Mul(u, u, a);
+      }
+   }
+
+   //Copy the resulting value
+   p256Copy(r, u);
+}
+
+
+/**
+ * @brief Copy an integer
+ * @param[out] a Pointer to the destination integer
+ * @param[in] b Pointer to the source integer
+ **/
+
+void p256Copy(uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+
+   //Copy the value of the integer
+   for(i = 0; i < 8; i++)
+   {
+      a[i] = b[i];
+   }
+}
+
+
+/**
+ * @brief Select an integer
+ * @param[out] r Pointer to the destination integer
+ * @param[in] a Pointer to the first source integer
+ * @param[in] b Pointer to the second source integer
+ * @param[in] c Condition variable
+ **/
+
+void p256Select(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   uint32_t c)
+{
+   uint_t i;
+   uint32_t mask;
+
+   //The mask is the all-1 or all-0 word
+   mask = c - 1;
+
+   //Select between A and B
+   for(i = 0; i < 8; i++)
+   {
+      //Constant time implementation
+      r[i] = (a[i] & mask) | (b[i] & ~mask);
+   }
+}
+
+
+/**
+ * @brief Import an octet string
+ * @param[out] a Pointer to resulting integer
+ * @param[in] data Octet string to be converted (big-endian)
+ **/
+
+void p256Import(uint32_t *a, const uint8_t *data)
+{
+   uint_t i;
+
+   //Convert from big-endian byte order to host byte order
+   for(i = 0; i < 8; i++)
+   {
+      a[i] = LOAD32BE(data + 28 - i * 4);
+   }
+}
+
+
+/**
+ * @brief Export an octet string
+ * @param[in] a Pointer to the integer to be exported
+ * @param[out] data Octet string resulting from the conversion (big-endian)
+ **/
+
+void p256Export(const uint32_t *a, uint8_t *data)
+{
+   uint_t i;
+
+   //Convert from host byte order to big-endian byte order
+   for(i = 0; i < 8; i++)
+   {
+      STORE32BE(a[i], data + 28 - i * 4);
+   }
+}
+
+
+/**
+ * @brief Scalar multiplication
+ * @param[out] r Resulting point R = d.S
+ * @param[in] d An integer d such as 0 <= d < 2^256
+ * @param[in] s EC point
+ * @return Error code
+ **/
+
+error_t p256Mult(EcPoint *r, const Mpi *d, const EcPoint *s)
+{
+   //Use the common NIST curve layer
+   return ecNistMult(&p256Curve, r, d, s);
+}
+
+
+/**
+ * @brief Precompute the multiples of a point
+ * @param[out] table Table of precomputed multiples
+ * @param[in] s EC point (affine coordinates)
+ * @return Error code
+ **/
+
+error_t p256BuildTable(EcBaseTable *table, const EcPoint *s)
+{
+   //Use the common NIST curve layer
+   return ecNistBuildTable(&p256Curve, table, s);
+}
+
+
+/**
+ * @brief Twin multiplication with the base point
+ * @param[out] r Resulting point R = d0.G + d1.T (Jacobian coordinates)
+ * @param[in] d0 An integer d such as 0 <= d0 < 2^256
+ * @param[in] d1 An integer d such as 0 <= d1 < 2^256
+ * @param[in] t EC point (affine coordinates)
+ * @param[in] table Precomputed multiples of T (optional parameter)
+ * @return Error code
+ **/
+
+error_t p256TwinMultBase(EcPoint *r, const Mpi *d0, const Mpi *d1,
+   const EcPoint *t, const EcBaseTable *table)
+{
+   //Use the common NIST curve layer
+   return ecNistTwinMultBase(&p256Curve, r, d0, d1, t, table);
+}
+
+#endif
@@ -0,0 +1,86 @@
+/**
+ * @file p256.h
+ * @brief Dedicated secp256r1 (NIST P-256) implementation
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+#ifndef _P256_H
+#define _P256_H
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec.h"
+
+//Dedicated secp256r1 implementation
+#ifndef P256_SUPPORT
+   #define P256_SUPPORT ENABLED
+#elif (P256_SUPPORT != ENABLED && P256_SUPPORT != DISABLED)
+   #error P256_SUPPORT parameter is not valid
+#endif
+
+//Length of the elliptic curve
+#define P256_BIT_LEN 256
+#define P256_BYTE_LEN 32
+#define P256_WORD_LEN 8
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+//secp256r1 related functions
+bool_t p256IsCurve(const EcDomainParameters *params);
+
+error_t p256Mult(EcPoint *r, const Mpi *d, const EcPoint *s);
+
+error_t p256BuildTable(EcBaseTable *table, const EcPoint *s);
+
+error_t p256TwinMultBase(EcPoint *r, const Mpi *d0, const Mpi *d1,
+   const EcPoint *t, const EcBaseTable *table);
+
+void p256SetInt(uint32_t *a, uint32_t b);
+void p256Add(uint32_t *r, const uint32_t *a, const uint32_t *b);
+void p256Sub(uint32_t *r, const uint32_t *a, const uint32_t *b);
+void p256Mul(uint32_t *r, const uint32_t *a, const uint32_t *b);
+void p256Sqr(uint32_t *r, const uint32_t *a);
+void p256Inv(uint32_t *r, const uint32_t *a);
+
+void p256Copy(uint32_t *a, const uint32_t *b);
+
+void p256Select(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   uint32_t c);
+
+void p256Import(uint32_t *a, const uint8_t *data);
+void p256Export(const uint32_t *a, uint8_t *data);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
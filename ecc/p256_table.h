@@ -0,0 +1,2168 @@
+/**
+ * @file p256_table.h
+ * @brief Precomputed multiples of the secp256r1 base point
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * This file is generated by ec_nist_tables.py and must not be edited. For
+ * each 4-bit window i, the table holds the affine coordinates of the points
+ * (2.j + 1).2^(4.i).G, where 0 <= j < 8, in the internal representation of
+ * the field (Montgomery domain)
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+#ifndef _P256_TABLE_H
+#define _P256_TABLE_H
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec_nist.h"
+#include "ecc/p256.h"
+
+//Check crypto library configuration
+#if (EC_SUPPORT == ENABLED && SECP256R1_SUPPORT == ENABLED && \
+   P256_SUPPORT == ENABLED && EC_NIST_BASE_TABLE_SUPPORT == ENABLED)
+
+//Precomputed multiples of the base point
+static const uint32_t P256_BASE_TABLE[8192] =
+{
+   //Window 0
+   0x18A9143C, 0x79E730D4, 0x5FEDB601, 0x75BA95FC,
+   0x77622510, 0x79FB732B, 0xA53755C6, 0x18905F76,
+   0xCE95560A, 0xDDF25357, 0xBA19E45C, 0x8B4AB8E4,
+   0xDD21F325, 0xD2E88688, 0x25885D85, 0x8571FF18,
+   0x4EEBC127, 0xFFAC3F90, 0x087D81FB, 0xB027F84A,
+   0x87CBBC98, 0x66AD77DD, 0xB6FF747E, 0x26936A3F,
+   0xC983A7EB, 0xB04C5C1F, 0x0861FE1A, 0x583E47AD,
+   0x1A2EE98E, 0x78820831, 0xE587CC07, 0xD5F06A29,
+   0xC45C61F5, 0xBE1B8AAE, 0x94B9537D, 0x90EC649A,
+   0xD076C20C, 0x941CB5AA, 0x890523C8, 0xC9079605,
+   0xE7BA4F10, 0xEB309B4A, 0xE5EB882B, 0x73C568EF,
+   0x7E7A1F68, 0x3540A987, 0x2DD1E916, 0x73A076BB,
+   0xA0173B4F, 0x0746354E, 0xD23C00F7, 0x2BD20213,
+   0x0C23BB08, 0xF43EAAB5, 0xC3123E03, 0x13BA5119,
+   0x3F5B9D4D, 0x2847D030, 0x5DA67BDD, 0x6742F2F2,
+   0x77C94195, 0xEF933BDC, 0x6E240867, 0xEAEDD915,
+   0x264E20E8, 0x75C96E8F, 0x59A7A841, 0xABE6BFED,
+   0x44C8EB00, 0x2CC09C04, 0xF0C4E16B, 0xE05B3080,
+   0xA45F3314, 0x1EB7777A, 0xCE5D45E3, 0x56AF7BED,
+   0x88B12F1A, 0x2B6E019A, 0xFD835F9B, 0x086659CD,
+   0x6245E404, 0xEA7D260A, 0x6E7FDFE0, 0x9DE40795,
+   0x8DAC1AB5, 0x1FF3A415, 0x649C9073, 0x3E7090F1,
+   0x2B944E88, 0x1A768561, 0xE57F61C8, 0x250F939E,
+   0x1EAD643D, 0x0C0DAA89, 0xE125B88E, 0x68930023,
+   0x4B2ED709, 0xCCC42563, 0x856FD30D, 0x0E356769,
+   0x559E9811, 0xBCBCD43F, 0x5395B759, 0x738477AC,
+   0xC00EE17F, 0x35752B90, 0x742ED2E3, 0x68748390,
+   0xBD1F5BC1, 0x7CD06422, 0xC9E7B797, 0xFBC08769,
+   0xBC60055B, 0x72BCD8B7, 0x56E27E4B, 0x03CC23EE,
+   0xE4819370, 0xEE337424, 0x0AD3DA09, 0xE2AA0E43,
+   0x6383C45D, 0x40B8524F, 0x42A41B25, 0xD7663554,
+   0x778A4797, 0x64EFA6DE, 0x7079ADF4, 0x2042170A,
+   //Window 1
+   0x0BC6FB80, 0x808B0B65, 0x3FFE2E6B, 0x5882E075,
+   0x2C83F549, 0xD5EF2F7C, 0x9103B723, 0x54D63C80,
+   0x52A23F9B, 0xF2F11BD6, 0x4B0B6587, 0x3670C319,
+   0xB1580E9E, 0x55C4623B, 0x01EFE220, 0x64EDF7B2,
+   0x77ADC612, 0x6B344130, 0xBBD803A0, 0xA7496529,
+   0x6D8805BD, 0x1A1BAAA7, 0x470343AD, 0xC8403902,
+   0x175ADFF1, 0x39F59F66, 0xB7D8C5B7, 0x0B26D7FB,
+   0x529D75E3, 0xA875F5CE, 0x41325CC2, 0x85EFC7E9,
+   0x52B3E584, 0x492BDC07, 0xB5F86A2C, 0x35FF9AA8,
+   0xB27DE573, 0x2074213D, 0x5263832A, 0xC0BFFFC4,
+   0x1D49C605, 0x2429C22A, 0xB320EBFB, 0x1B037D75,
+   0x9220F428, 0x52B6A173, 0xA4CD2660, 0x2995919C,
+   0x0A99CBCA, 0x6A950576, 0x04A428F2, 0x94E258F6,
+   0x7832BA0C, 0x45AB5A4D, 0x8938C167, 0x71704D00,
+   0xF88B8B70, 0xDB97AB0E, 0xC00EB207, 0x56FEB92E,
+   0x7D367D80, 0xE7035268, 0xC7973A41, 0x65000C24,
+   0x58654FEB, 0x11BA0B81, 0xC40973C6, 0x83D0C099,
+   0xC0AF37CE, 0x4ABB178B, 0xBD1662AB, 0x18B621E8,
+   0xDB878B55, 0x77F15C29, 0x1BC0B40F, 0x8716F078,
+   0x5A27182C, 0x475F0507, 0x6C77B89E, 0xC039BAB4,
+   0xD5C74B93, 0x414D3313, 0xDB6D9A91, 0xF14256EC,
+   0x43F2C9EC, 0x3E4FCAB8, 0x22BA1D4F, 0x14F49598,
+   0xAFA4716D, 0xBBF13474, 0x41976280, 0xD23899E0,
+   0x1C794FA1, 0x8AFC3854, 0xE78B6E92, 0x4C298B97,
+   0xFD52CED4, 0x9B6130A2, 0x5D50773E, 0x9BC0B8B6,
+   0x9BFCC8DB, 0xDD08F94F, 0xED190168, 0xDD33197C,
+   0x07F21414, 0x3062B5C7, 0x19839DDB, 0x7244234E,
+   0x9877267C, 0x630F6AD8, 0xC868A7D3, 0xB283DDCD,
+   0xD295A458, 0x85CC1158, 0xA81821F7, 0x52625915,
+   0xDABF3D08, 0xEAE65A00, 0x2D2DB6D9, 0x8567E049,
+   0x3565303B, 0xF6C9D65B, 0xA7CB419F, 0x3928349B,
+   0x1275714C, 0x4AA7CD7A, 0xEC0FDCDA, 0x921EF60B,
+   //Window 2
+   0x696946FC, 0x486D8FFA, 0xB9CBA56D, 0x50FBC6D8,
+   0x90F35A15, 0x7E3D423E, 0xC0DD962C, 0x7C3DA195,
+   0x3CFD5D8B, 0xE673FDB0, 0x889DFCA5, 0x0704B7C2,
+   0xF52305AA, 0xF6CE581F, 0x914D5E53, 0x399D49EB,
+   0xED4C3717, 0x35D6A53E, 0x3D0ED2A3, 0x9F8240CF,
+   0xE5543AA5, 0x8C0D4D05, 0xDD33B4B4, 0x45D5BBFB,
+   0x137FD28E, 0xFA04CC73, 0xC73B3FFD, 0x862AC6EF,
+   0x31F51EF2, 0x403FF9F5, 0xBC73F5A2, 0x34D5E0FC,
+   0x08369A90, 0x33B2385C, 0x190EB4F8, 0x2990C59B,
+   0xC68EAC80, 0x819A6145, 0x2EC4A014, 0x7A786D62,
+   0x20AC3A8D, 0x33FAADBE, 0x5ABA2D30, 0x31A21781,
+   0xDBA4F565, 0x209D2742, 0x55AA0FBB, 0xDB2CE9E3,
+   0x74A86108, 0x0C4A58D4, 0xEE4C5D90, 0xF8048A8F,
+   0xE86D4C80, 0xE3C7C924, 0x056A1E60, 0x28C889DE,
+   0xB214A040, 0x57E2662E, 0x37E10347, 0xE8C48E98,
+   0x80AC748A, 0x87742862, 0x186B06F2, 0xF1C24022,
+   0xD5923359, 0xE8CBF1E5, 0x539B9FB0, 0xDB0CEA9D,
+   0x49859B98, 0x0C5B34CF, 0xA4403CC6, 0x5E583C56,
+   0xD48185B7, 0x11FC1A2D, 0x6E521787, 0xC93FBC7E,
+   0x05105B8B, 0x47E7A058, 0xDB8260C8, 0x7B4D4D58,
+   0x39842194, 0xC5106109, 0x49D05295, 0xB7E2353E,
+   0xEFB42EE0, 0xFC8C1D5C, 0x08CE811C, 0xE04884EB,
+   0x7419F40E, 0xF1F75D81, 0xA995C241, 0x5B0AC162,
+   0xC4C55646, 0x120921BB, 0x8D33CF97, 0x713520C2,
+   0x1726931A, 0x41D04EE2, 0x3660ECFD, 0x0BBBB2C8,
+   0x24818E18, 0xA6EF6DE5, 0xE7D57887, 0xE421CC51,
+   0xBEA87BE6, 0xF127D208, 0xB1CDD682, 0x16A475D3,
+   0x439B63F7, 0x9DB1B684, 0xF0F113B6, 0x5359B3DB,
+   0xDCC18770, 0x3A5C752E, 0x8825C3A5, 0x4BAF1F2F,
+   0x21B153ED, 0xEBD63F74, 0xB2F64723, 0xA2383E47,
+   0x2646D19A, 0xE7BF620A, 0x03C83FFD, 0x56CB44EC,
+   0x4F6BE9F1, 0xAF7267C9, 0xC06BB5E9, 0x8B2DFD7B,
+   //Window 3
+   0xAB4B35A2, 0x6772B0E5, 0xF5EEAACF, 0x1D8B6001,
+   0x795B9580, 0x728F7CE4, 0x41FB81DA, 0x4A20ED2A,
+   0x4FEC01E6, 0x9F685CD4, 0xA7FF50AD, 0x3ED7DDCC,
+   0x0C2D97FD, 0x460FD264, 0xEB82F4F9, 0x3A241426,
+   0xAAE6EE70, 0x6FAF68FE, 0x5602B0C9, 0x78F4CC15,
+   0x6E94052A, 0x7E3321A8, 0x734D5D80, 0x2FB3A0D6,
+   0xB25A43BA, 0xF3B98F3B, 0x19EE2951, 0x30BF8031,
+   0x21B0612A, 0x7FFEE433, 0x2EB821D0, 0x12F775E4,
+   0x37A929A9, 0x46F70080, 0x19FEC6BD, 0x65601A8E,
+   0x12AB8B62, 0x537F5EDC, 0x5E5990CF, 0xE497CD95,
+   0x9AA5B2F9, 0x2FCD387F, 0x67B78FE8, 0xE5FAA3FF,
+   0x295D5E30, 0x1BCF538D, 0xA813A7EC, 0x3A573239,
+   0xD0A917B4, 0x33E2CB51, 0x4899F931, 0xC2CFA3F3,
+   0xE9A2F6B6, 0xB2C94F4B, 0x7CA162B7, 0x9707B181,
+   0xD5F8B10D, 0xB602A172, 0x4FD4542A, 0xFD307835,
+   0xDD996992, 0xEEF226DD, 0xEB0A15E1, 0x221FA989,
+   0xDE1132A3, 0x73628677, 0x2FA88847, 0x75127E64,
+   0x5B49E660, 0x192F7A30, 0x11436AA9, 0x1A063CFE,
+   0x4B710189, 0x72001457, 0x2A57378D, 0xFAA946DE,
+   0x191C3066, 0x5C495C63, 0x6B7DB4DB, 0x2B4B7E65,
+   0xFE5C62ED, 0x08190A49, 0x3691183D, 0x2C57543D,
+   0xA9044823, 0x75EE318B, 0xAEF28F58, 0xD20CE09E,
+   0x848A4A66, 0x10613D50, 0x9FCF2EFB, 0x4B98A1A8,
+   0x98FC6427, 0x415F1ED9, 0xE3852B50, 0x086ABB56,
+   0x19EDA9DE, 0x5A768CD9, 0x8E2A51D2, 0x6E3206F4,
+   0x8678A3EF, 0xD356E8C0, 0x543F91C9, 0x93F8D36D,
+   0xA4086743, 0xFEF231F4, 0x9148C6C9, 0x4D379A11,
+   0xDC8232CE, 0x00B5581D, 0xD702214B, 0xA67A72EF,
+   0xCF9FB480, 0x554D883D, 0x0DFB9A4D, 0x76CA71C5,
+   0xE04240EA, 0xC251142B, 0xFA7AFC99, 0x899BA63D,
+   0x9FBBCDA3, 0xED945B12, 0xA299A4CC, 0x3C4DD528,
+   0x8A63C092, 0x68E8B609, 0x3F40621B, 0xECF50A6C,
+   //Window 4
+   0xE3779EE3, 0x0F0165FC, 0xBD495D9E, 0xE00E7F9D,
+   0x20284E7A, 0x1FA4EFA2, 0x47AC6219, 0x4564BADE,
+   0xC4708E8E, 0x90E6312A, 0xA71E9ADF, 0x4F5725FB,
+   0x3D684B9F, 0xE95F55AE, 0x1E94B415, 0x47F7CCB1,
+   0xBE7A2AF3, 0xBD9B8B1D, 0x4FB74A72, 0xEC51CAA9,
+   0x63879697, 0xB9937A4B, 0xEC2687D5, 0x7C9A9D20,
+   0x6EF5F014, 0x1773E44F, 0xE90C6900, 0x8ABCF412,
+   0x8142161E, 0x387BD022, 0xFCB6FF2A, 0x50393755,
+   0x59145A65, 0x3D613339, 0xFA406337, 0xCD9BC368,
+   0x2D8A52A0, 0x82D11BE3, 0x97A1C590, 0xF6877B27,
+   0xF5CBDB25, 0x837A819B, 0xDE090249, 0x2A4FD1D8,
+   0x74990E5F, 0x622A7DE7, 0x7945511B, 0x840FA5A0,
+   0xE3533D77, 0x26E08C07, 0x2E341C99, 0xD7222E6A,
+   0x8D2DC4ED, 0x9D60EC3D, 0x7C476CF8, 0xBDFE0D8F,
+   0x1D056605, 0x1FE59AB6, 0x86A8551F, 0xA9EA9DF6,
+   0x47FB8D8C, 0x8489941E, 0x4A7F1B10, 0xFEB874EB,
+   0x977EAB40, 0x9164088D, 0x2760B390, 0x51F4C5B6,
+   0x340DD553, 0xD238238F, 0xDB1D31C9, 0x358566C3,
+   0x5068F5FF, 0x3A5AD69E, 0xDAFF6B06, 0xF31435FC,
+   0xD6DEBFF0, 0xAE549A5B, 0x75E01331, 0x59E5F0B7,
+   0x5958CD79, 0xD5D5CDD3, 0x1D373114, 0x3580A1B5,
+   0xFA935726, 0xA36E4C91, 0xEF20D760, 0xA38C534D,
+   0x2FF5845B, 0x7088E40A, 0xBD78177F, 0xE5BB40BD,
+   0x857F9920, 0x4F06A7A8, 0xE968F05D, 0xE3CC3E50,
+   0x96A71CBA, 0x10595B56, 0xFDCADEB7, 0x944938B2,
+   0xFCCD8471, 0xA282DA4C, 0x0D37BFE1, 0x98EC05F3,
+   0x0698304A, 0xE171CE1B, 0x21BDF79B, 0x2D691444,
+   0x1B21DEC1, 0xD0CD3B74, 0x16A15F71, 0x712ECD8B,
+   0x5963A46E, 0xE89F48C8, 0xA99E61C7, 0x658AB875,
+   0x4B8517B4, 0x6E296F87, 0xFC1BC656, 0x36C4FCDC,
+   0xA3906DEF, 0xDE5227A1, 0x62418945, 0x9FE95F57,
+   0xFDD96CDE, 0x20C91E81, 0xDA4480DE, 0x5ADBE47E,
+   //Window 5
+   0x584C5E20, 0xA7A8746A, 0xB9DC7035, 0x267E4EA1,
+   0xB9548C9B, 0x593A15CF, 0x4BD012F3, 0x5E6E2135,
+   0x8C8F936E, 0xDF31CC6A, 0xB5C241DC, 0x8AF84D04,
+   0x345EFB86, 0x63990A6F, 0xB9B962CB, 0x6FEF4E61,
+   0x442A8AD1, 0xF2EFE23D, 0x06B9C164, 0xC3816A7D,
+   0xDC0AA5E5, 0xA9DF2D8B, 0x120A8E65, 0x191AE46F,
+   0x00611C5B, 0x83667F87, 0xFF109948, 0x83171ED7,
+   0xCA695952, 0x33A2ECF8, 0xF48D1A13, 0xFA4A73EE,
+   0x82DD1B6A, 0x48FC4ED0, 0x67B703AF, 0x5783A138,
+   0x005D6AAA, 0x2463CB9A, 0x706ECD43, 0xD31EC55C,
+   0x8E9A7641, 0x9F8ED33F, 0x098D9E7A, 0x625453ED,
+   0xEC887493, 0xA3BEADE4, 0x5A795566, 0x442B8050,
+   0x3BFAB839, 0x46DF582D, 0x2F8ADADE, 0x92474E04,
+   0x147A1BC3, 0x36A7766A, 0x0DC0F979, 0xB6940F54,
+   0xF2759F25, 0x44738EF2, 0xA719F4C6, 0x9DD95789,
+   0x0750C345, 0x2859B7F4, 0xB22180D5, 0x5E788BF2,
+   0xFD67CA25, 0xA839C9FD, 0x60F2015C, 0x023E6268,
+   0x0E7B2A65, 0x2414A793, 0xB13EDCBB, 0x92DBE372,
+   0x64C2200F, 0xF64981EE, 0x8446F2F3, 0x94FB9CDF,
+   0x3F1367BB, 0x01411A6A, 0x5A1E8331, 0x7985C191,
+   0x37E2EFEA, 0xC8123C60, 0x034A96F6, 0x8D49B502,
+   0x973E4A95, 0x466A346B, 0xB7DE00FF, 0xF176B5BA,
+   0x82DFA945, 0x1C58FA3B, 0x09E429AE, 0x2EB27A96,
+   0xA12B187C, 0x57C67A67, 0xE2298BBA, 0xB155BA82,
+   0x3D99BCFA, 0xF1A54207, 0xE8BECF6D, 0x59DB703C,
+   0xD2459569, 0x2E455142, 0xA901B910, 0xB0EE5143,
+   0xE26D994F, 0xFC05D451, 0x1360CAAF, 0x7A6062B4,
+   0x4FA639B1, 0xDF1DED5F, 0xD335B8B0, 0xAF930348,
+   0x21FD0861, 0x3D8F248A, 0x9BD5A4B6, 0xADE3BD64,
+   0xC2E2A6BF, 0xCB56C953, 0x287D6C5F, 0x699CD2B5,
+   0x47D05E8F, 0xDEBCE1BE, 0xA8F53732, 0x1A4FBB13,
+   0xA5852B08, 0x97163BEA, 0xEEC6987A, 0x92C49E6C,
+   //Window 6
+   0x868AF75D, 0xD9D0C8C4, 0x45C8C7EA, 0xD7325CFF,
+   0xCC81ECB0, 0xAB471996, 0x611824ED, 0xFF5D55F3,
+   0x1977A0EE, 0xBE314541, 0x722038C6, 0x5085C4C5,
+   0xF94BB495, 0x2D5335BF, 0xC8E2A082, 0x894AD8A6,
+   0x1994EF20, 0xD1E059B2, 0x638AE318, 0x2A653B69,
+   0x2F699010, 0x70D5EB58, 0x09F5F84A, 0x279739F7,
+   0x8B799336, 0x5DA4663C, 0x203C37EB, 0xFDFDF14D,
+   0xA1DBFB2D, 0x32D8A9DC, 0x77D48F9B, 0xAB40CFF0,
+   0xFBAF50A5, 0xF61790AB, 0x684E0750, 0xDF55E76B,
+   0xF176B005, 0xEC516DA7, 0x7A2DDDC7, 0x575553BB,
+   0x553AFA73, 0x37C87CA3, 0x4D55C251, 0x315F3FFC,
+   0xAF3E5D35, 0xE846442A, 0x6495FF28, 0x61B91149,
+   0x56F90823, 0x4BDF3A49, 0x741D777B, 0xBA0F5080,
+   0xF38BF760, 0x091D71C3, 0x9B625B02, 0x9633D50F,
+   0xB8C9DE61, 0x03ECB743, 0x5DE74720, 0xB4751254,
+   0x74CE1CB2, 0x9F9DEFC9, 0x00BD32EF, 0x774A4F6A,
+   0xB0131E5B, 0x327BC002, 0xCB2514D9, 0x1739E6D5,
+   0x55A81543, 0xC8CBDAFE, 0xE1137243, 0x5BB1A36C,
+   0x17325327, 0x205DA3C5, 0x515A057E, 0xC35C1A36,
+   0x42925F9B, 0xF00F64C9, 0xB7D59F7A, 0xBD14633C,
+   0x41F37DBD, 0x47C10043, 0x6168ECF6, 0x96ECCAE3,
+   0x1CA46AA3, 0x65BDE59D, 0xB8698FFA, 0x38A7027A,
+   0x6DC34437, 0xA2B89DC8, 0x43A4153F, 0x5A0A118D,
+   0x1CE22FD8, 0x9E330A86, 0xB3BBD3BC, 0x28382AF6,
+   0xD81E0271, 0x0B2E27C0, 0x117A317C, 0xA67A7596,
+   0xA6723D99, 0x17F08928, 0x485310A3, 0x71A75681,
+   0xAFB66CA9, 0x90465462, 0xFBBE229D, 0x185E97CC,
+   0xDDAD8FC2, 0x6A1A606A, 0xB3C797CF, 0x2431F316,
+   0x93529432, 0x47034011, 0x30743462, 0x1F106BDD,
+   0xCD66D8CA, 0xABFB9964, 0xE9BDADD5, 0x934D9D5A,
+   0x908E3D22, 0x5976D815, 0x28E057BD, 0x344A362F,
+   0x5443DFB3, 0xF92CDADC, 0xF089603B, 0x001297AD,
+   //Window 7
+   0x20151427, 0x7F99824F, 0x92430206, 0x206828B6,
+   0xE1112357, 0xAA9097D7, 0x09E414EC, 0xACF9A2F2,
+   0x27915356, 0xDBDAC9DA, 0x001EFEE3, 0x7E0734B7,
+   0xD2B288E2, 0x54FAB5BB, 0xF62DD09C, 0x4C630FC4,
+   0x5FA067D1, 0xAE915F5D, 0x9668960C, 0x4134B57F,
+   0xA48EDAAC, 0xBD3656D6, 0xFC1D7436, 0xDAC1E3E4,
+   0xD81FBB26, 0x674FF869, 0xB26C33D4, 0x449ED3EC,
+   0xD94203E8, 0x85138705, 0xBEEB6F4A, 0xCCDE538B,
+   0x019F2A59, 0x7BDFF8C2, 0xCB4FBC74, 0xB3CE5BB3,
+   0x8A9173DD, 0xEA907F68, 0x95A75439, 0x6CD3D0D3,
+   0xEFED021C, 0x92ECC4D6, 0x6A77339A, 0x09A9F9B0,
+   0x7188C64A, 0x87CA6B15, 0x44899158, 0x10C29968,
+   0x88FBD381, 0x342AC06E, 0x5C35A493, 0x02CD4A84,
+   0x54F1BBCD, 0xE8FA89DE, 0x2575ED4C, 0x341D6367,
+   0xD238202B, 0xEBE357FB, 0xA984EAD9, 0x600B4D1A,
+   0x52436EA0, 0xC35C9F44, 0xA370751B, 0x96FE0A39,
+   0x87E9189F, 0x81FE7B50, 0xF42DDA27, 0xDB17375C,
+   0xCF0A5904, 0x22F7D896, 0xEBE348E6, 0xA0E57C5A,
+   0xF40E3C80, 0xA61011D3, 0x8DB705C5, 0xB1189321,
+   0x50FEDEC3, 0x4ED9309E, 0x4D6D5C1D, 0xDCF14A10,
+   0x38DFE7E8, 0x21372682, 0x2BB79D4B, 0xEA417E15,
+   0x76E7CF2D, 0x59641F1C, 0xEA0BCFCC, 0x271E3059,
+   0x7253ECBD, 0x624C7DFD, 0x4FCA6186, 0x2F552E25,
+   0x4D866E9C, 0xCBF84ECD, 0xF68D4610, 0x73967709,
+   0x0D188DAB, 0x5E78E2F2, 0xF4B885EF, 0xE3968ED0,
+   0x7314570F, 0x46C0568E, 0x01170521, 0x31616338,
+   0x4F0C8AFE, 0x18E1E7E2, 0xDEEA78DA, 0x4CAA75FF,
+   0x7C5D8A51, 0x82DB67F2, 0x6F505370, 0x36A44D86,
+   0x6C2F5226, 0xB6A9B88D, 0x550D7CA8, 0x14D1B944,
+   0x1FC41709, 0x580C85FC, 0x54C6D519, 0xC1DA368B,
+   0xD5113CF7, 0x2B0785CE, 0x5A34708F, 0x0670F633,
+   0x15CC3F88, 0x46E23767, 0x50C72C8F, 0x1B480CFA,
+   //Window 8
+   0x4147519A, 0x20288602, 0x26B372F0, 0xD0981EAC,
+   0xA785EBC8, 0xA9D4A7CA, 0xDBDF58E9, 0xD953C50D,
+   0xFD590F8F, 0x9D6361CC, 0x44E6C917, 0x72E9626B,
+   0x22EB64CF, 0x7FD96110, 0x9EB288F3, 0x863EBB7E,
+   0xE90FB21E, 0xA18F07E0, 0xBBA7FCA1, 0x00FD2B80,
+   0x95CD67B5, 0x20387F27, 0xD39707F7, 0x5B89A4E7,
+   0x894407CE, 0x8F83AD3F, 0x6C226132, 0xA0025B94,
+   0xF906C13B, 0xC79563C7, 0x4E7BB025, 0x5F548F31,
+   0x31B85F09, 0xC1B3D3D3, 0xA88AE64A, 0x0F45354A,
+   0x2FEC50FD, 0xA8B626D3, 0xE828834F, 0x1BDCFBD4,
+   0xCD522539, 0xE45A2866, 0x810F7AB3, 0xFA9D4732,
+   0xC905F293, 0xD8C1D6B4, 0x3461B597, 0x10AC8047,
+   0x6FC627E2, 0xBBB17514, 0x91573A51, 0xA0569BC5,
+   0x358243D5, 0xA7016D9E, 0xAC1D6692, 0x0DAC0C56,
+   0xDA590D5F, 0x993833B5, 0xDE817491, 0xA8067803,
+   0x4DBF75D0, 0x65B4F212, 0xCCF80CFB, 0xCC960232,
+   0x6CF3D65B, 0x35D74280, 0x78B28DD9, 0x4B7C7906,
+   0x95E1F85F, 0xC4FCDD2F, 0x591350B6, 0xCF6FB7BA,
+   0xEDFC26AF, 0x9F8E3287, 0xC2D0ED9A, 0xE2DD9E73,
+   0x24CBB703, 0xEAB5D67F, 0x9A759A5A, 0x60C29399,
+   0x7CA53D5F, 0xFB93CA3D, 0x04379CBF, 0x432649F0,
+   0xCBA2FF75, 0xF506113A, 0x03718B35, 0x4594AE21,
+   0x0D044627, 0x1AA6CEE5, 0xF5C94AA2, 0xC0E0D2B7,
+   0xEE4DD3F5, 0x0BF33D3D, 0x8477C97A, 0xACA96E28,
+   0x6861A713, 0x995C068E, 0x63DE88DC, 0xA9BA3394,
+   0x689A964F, 0xAB954344, 0x0F5A0D6C, 0x58195AEC,
+   0xC98F8B50, 0xC5F207D5, 0x0C98CCF6, 0x6600CD28,
+   0x39C3E6C2, 0x1A680FE3, 0x660E87C0, 0xA23F3931,
+   0xC78440A1, 0x43BC1B42, 0x32AC6C3F, 0x9A07E226,
+   0x0F4BCD15, 0xAF3D7BA1, 0xA36814C6, 0x3AD43C9D,
+   0xA0C9C162, 0xCA11F742, 0xC90B96EC, 0xD3E06FC6,
+   0x6BF2D03F, 0xEACE6E76, 0xF8032795, 0x8BCD98E8,
+   //Window 9
+   0x305406DD, 0xE27A6DBE, 0xDD5D1957, 0x8EB7DC7F,
+   0x387D4D8F, 0xF54A6876, 0xC7762DE4, 0x9C479409,
+   0x99B30778, 0xBE4D5B5D, 0x6E793682, 0x25380C56,
+   0xDAC740E3, 0x602D37F3, 0x1566E4AE, 0x140DEABE,
+   0x1782269B, 0x958381DB, 0x2597E550, 0xAE34BF79,
+   0x5F385153, 0xBB5C6064, 0xE3088048, 0x6F0E96AF,
+   0x77884456, 0xBF6A0215, 0x69310EA7, 0xB3B5688C,
+   0x04FAD2DE, 0x17C94295, 0x17896D4D, 0xE020F0E5,
+   0x0F82B214, 0x03B0D8DD, 0xF103CBC6, 0x460C34F9,
+   0x18D79E19, 0xF32E5C03, 0xA84117F8, 0x8B8888BA,
+   0xC0722677, 0x8F3C37DC, 0x1C1C0F27, 0x10D21BE9,
+   0xE0F7A0C6, 0xD47C8468, 0xADECC0E0, 0x9BF02213,
+   0xE0AC2941, 0x03B5D21A, 0xC2D31937, 0x279B0254,
+   0xCAC992D0, 0x3307C052, 0xEFA8B1F3, 0x6AA7CB92,
+   0x0D37C7A5, 0x5A182580, 0x342D5422, 0x13380C37,
+   0xD5D2EF92, 0x92AC2D66, 0x030C63C6, 0x035A70C9,
+   0xF74CFF17, 0x14EBA133, 0xECB813F2, 0x240AAA03,
+   0x6F665BEE, 0xCFBB6540, 0xA425AD73, 0x084B1FE4,
+   0xD081F6A6, 0x009D5D16, 0xEEF82C90, 0x35304FE8,
+   0xAA9EAA22, 0xF20346D5, 0xAC1C91E3, 0x0ADA9F07,
+   0x0F3E4834, 0x30417758, 0x17A9AFCB, 0xFDBB21C2,
+   0x2F9A67B3, 0x756FA17F, 0xA245C1A8, 0x2A6B2421,
+   0x4AF02291, 0x64BE2794, 0x2A5804FE, 0xADE465C6,
+   0xA6F08FD7, 0x8DFFBD39, 0xAA14403B, 0xC4EFA84C,
+   0x065FEF4A, 0xCDBEF1C2, 0xFD5B92E3, 0x77E60F7D,
+   0x26708350, 0xD7C549F0, 0x34F121BF, 0x201B3AD0,
+   0x0334FC14, 0x5FCAC2A1, 0x344552F6, 0x8A9A9E09,
+   0x97653082, 0x7DD8A1D3, 0x79D4F289, 0x5FC0738F,
+   0x7CAE440C, 0xC1258D5B, 0x402B7531, 0x21C08B41,
+   0xDE932321, 0xF61A8955, 0x2D1408AF, 0x3568FAF8,
+   0x9ECF965B, 0x71B15E99, 0xE917276F, 0xF14ED248,
+   0x820CF9E2, 0xC6F4CAA1, 0x18D83C7E, 0x681B20B2,
+   //Window 10
+   0x533EF217, 0x889F6D65, 0xC3CA2E87, 0x7158C7E4,
+   0xDC2B4167, 0xFB670DFB, 0x844C257F, 0x75910A01,
+   0xCF88577D, 0xF336BF07, 0xE45E2ACE, 0x22245250,
+   0x7CA23D85, 0x2ED92E8D, 0x2B812F58, 0x29F8BE4C,
+   0x51FACC61, 0xC51E4143, 0xE68A25BC, 0xBAF2647D,
+   0x0FF872ED, 0x8F5271A0, 0x3D2D9659, 0x8F32EF99,
+   0x7593CBD4, 0xCA12488C, 0x02B82FAB, 0xED266C5D,
+   0x14EB3F16, 0x0A2F78AD, 0x4D47AFE3, 0xC3404948,
+   0x09470496, 0x09C16702, 0xEBD23815, 0xA489A5ED,
+   0x8EDD4398, 0xC4DDE464, 0x80111696, 0x3CA7B94A,
+   0x2AD636A4, 0x3C385D68, 0x08DC5F1E, 0x67027025,
+   0xAFA21943, 0x0C1965DE, 0x610BE69E, 0x18666E16,
+   0x2A604B3B, 0x45BEB4CA, 0x3A616762, 0x56F65184,
+   0x978B806E, 0xF52F5A70, 0x11DC4480, 0x7AA39787,
+   0x0E01FABC, 0xE13FAC2A, 0x237D99F9, 0x7C6EE8A5,
+   0x05211FFE, 0x251384EE, 0x1BC9D3EB, 0x4FF6976D,
+   0x16E043A2, 0xDDE04923, 0x1DD3D209, 0x98A45261,
+   0xD431EBE8, 0xEAF9F61B, 0xBAF56ABD, 0x00919F4D,
+   0x6D8774B1, 0xE42417DB, 0x58E0E309, 0x5FC5279C,
+   0x3ADF81EA, 0x64AA4061, 0xBC627C7F, 0xEF419EDA,
+   0x7A4AF00F, 0xFA24D053, 0xCA294614, 0x3F938926,
+   0x3982182E, 0x0D700C18, 0x4CC59947, 0x80133443,
+   0xEC87C925, 0xF0397106, 0x0ED6665C, 0x62BD59FC,
+   0xC7CCA8B5, 0xE8414348, 0x9F9F0A30, 0x574C7620,
+   0xBB8B6A07, 0x95BE42E2, 0xCA23F86A, 0x64BE74EE,
+   0x154CE470, 0xA73D74FD, 0xD8DC076A, 0x1C2D2857,
+   0x5A887868, 0xB1FA1C57, 0x3DE64818, 0x38DF8E0B,
+   0xC34E8967, 0xD88E52F9, 0x8B4CC76C, 0x274B4F01,
+   0xF8B7559D, 0x3F5C05B4, 0xFAE29200, 0x0BE4C7AC,
+   0x56532ACC, 0xDD6D3EF7, 0xEEA7A285, 0xF6C3ED87,
+   0xF46EC59B, 0xE463B0A8, 0xECEA6C83, 0x531D9B14,
+   0xC2DC836B, 0x3D6BDBAF, 0x2AB27F0B, 0x3EE501E9,
+   //Window 11
+   0x5922AC1C, 0x8DF27545, 0xA52B3F63, 0xA7B3EF5C,
+   0x71DE57C4, 0x8E77B214, 0x834C008B, 0x31682C10,
+   0x4BD55D31, 0xC76824F0, 0x17B61C71, 0xB6D1C086,
+   0xC2A5089D, 0x31DB0903, 0x184E5D3F, 0x9C092172,
+   0x768FCCFC, 0xCA2EB690, 0xB835B362, 0xF402D37D,
+   0xE2FDFCCE, 0x0EFAC0D0, 0xB638D990, 0xEFC9CDEF,
+   0xD1669A8B, 0x2AF12B72, 0x5774CCBD, 0x33C536BC,
+   0xFB34870E, 0x30B21909, 0x7DF25ACA, 0xC38FA2F7,
+   0xB2C69DBC, 0x7BFC5E75, 0x03C3DA6C, 0x3AA77A29,
+   0xCA910271, 0xDE0DF03C, 0x7806DC55, 0xCBD5CA4A,
+   0x6DB476CB, 0xE1CA5807, 0x5F37A31E, 0xFDE15D62,
+   0xF41AF416, 0xF49AF520, 0x7D342DB5, 0x96C5C5B1,
+   0xDB22B94B, 0xC792E02A, 0xA1EAA45B, 0x993D8AE9,
+   0xCD1E1C63, 0x8AAD6CD3, 0xC5CE688A, 0x89529CA7,
+   0xE572A253, 0x2CCEE3AA, 0x02A21EFB, 0xE02B6438,
+   0xC9430358, 0xA7091B6E, 0x9D7DB504, 0x06D1B1FA,
+   0x58854BE1, 0x7945EAD8, 0xCBD4D49D, 0x4111C12E,
+   0x3A29C2EF, 0xECE3B1EC, 0x8D3616F5, 0x6356D404,
+   0x594D320E, 0x9F0D6A8F, 0xF651CCD2, 0x0989316D,
+   0x0F8FDDE4, 0x6C32117A, 0xA26A9BBC, 0x9ABE5CC5,
+   0x2D2CE811, 0x36BE15B3, 0xF8291D21, 0x846DC0C2,
+   0x789FCFDB, 0x5CFA0ECB, 0xD7535B9A, 0x45A0BEED,
+   0x96D69AF1, 0xEC8E9F07, 0x599AB6DC, 0x31A7C5B8,
+   0xF9E2E09F, 0xD36D45EF, 0xDCEE954B, 0x3CF49EF1,
+   0x7A3CD22A, 0x726F9729, 0x4A628397, 0x9F8CD5DC,
+   0xC23165ED, 0x17B93AB9, 0x122823D4, 0xFF5F5DBF,
+   0x654A446D, 0xC1E4E4B5, 0x677257BA, 0xD1A9496F,
+   0xDE766A56, 0x6387BA94, 0x521EC74A, 0x23608BC8,
+   0xCA84BAD7, 0xE065D190, 0xAD58E65C, 0xFB13919F,
+   0xF1CB6E31, 0x3C41718B, 0x06D05C3F, 0x688969F0,
+   0x21264D45, 0xD4F94CE7, 0x7367532B, 0xFDFB65E9,
+   0x0945A39D, 0x5B1BE8B1, 0x2B8BAF3B, 0x229F789C,
+   //Window 12
+   0x0A750C0F, 0xCC7A6488, 0x4E548E83, 0x39BACFE3,
+   0x0C110F05, 0x3D418C76, 0xB1F11588, 0x3E4DAA4C,
+   0x5FFC69FF, 0x2733E7B5, 0x92053127, 0x46F147BC,
+   0xD722DF94, 0x885B2434, 0xE6FC6B7C, 0x6A444F65,
+   0xBDAEDFBD, 0x6D0B16F4, 0x86746CED, 0x23FD3260,
+   0xFF4B3E17, 0x8BFB1D2F, 0x019C14C8, 0xC7F2EC2D,
+   0x45104B0D, 0x3E0832F2, 0xADEA2B7E, 0x5F00DAFB,
+   0x99FBFB0F, 0x29E5CF66, 0x61827CDA, 0x264F9723,
+   0xE30BC27F, 0x6EB1A2F3, 0xB0836511, 0xE5F0C05A,
+   0x4965AB0E, 0x4D741BBF, 0x83464BBD, 0xFEEC41CA,
+   0x99D0B09F, 0x1ACA705F, 0xF42DA5FA, 0xC5D6CC56,
+   0xCC52B931, 0x49964EDD, 0xC884D8D8, 0x8AE59615,
+   0x39F8868A, 0xF634B57B, 0x75CC69AF, 0xE27F4FD4,
+   0xD0D5496E, 0xA47E58CB, 0xD323E07F, 0x8A26793F,
+   0xFA30F349, 0xC61A9B72, 0xB696D134, 0x94C9D9C9,
+   0x5880A6D1, 0x792BECA8, 0xAF039995, 0xBDCC4645,
+   0x8C796C3C, 0xCE7EF8E5, 0xDD66E57A, 0x9ADAAE84,
+   0x45227F33, 0x784AE13E, 0x2A85E757, 0xB046C5B8,
+   0xEC37631F, 0xB7AA50AE, 0x3B300758, 0xBEDC4FCA,
+   0x0AC9700B, 0x0F82567E, 0x4FF5F8D2, 0x1071D9D4,
+   0xE51A2811, 0xD09EF6C4, 0xB8FB66B9, 0x39F6862B,
+   0x22DFAA99, 0x64E77F8D, 0x61B08AAC, 0x7B105044,
+   0x4A7DF332, 0x71704E4C, 0x2FFE015B, 0xD0973434,
+   0x08D3020E, 0xAB0EAF44, 0xED63B97A, 0x28B1909E,
+   0xCDADCD4F, 0x2F3FA882, 0x5F631995, 0xA4EF6859,
+   0xE531766F, 0xE52CA2F9, 0x57E2C1D3, 0x20AF5C30,
+   0xE51E94B8, 0x1E4828F6, 0x1A2F5D4F, 0xF900A175,
+   0x392C58A0, 0xE831ADB3, 0x1B6E5866, 0x4C5A90CA,
+   0x6182827C, 0x5F3DCBA8, 0xBD7E7252, 0xD1A448DD,
+   0xF493B815, 0x2D8F96FC, 0x3B0AA95F, 0xBA0A4C26,
+   0x63A0007F, 0x88A15140, 0x6A9C5846, 0x9564C25E,
+   0xDC0FCBCA, 0x5A4D7B0F, 0x3F8A740E, 0x2275DAA3,
+   //Window 13
+   0xCECA9754, 0x83F49167, 0x4B7939A0, 0x426D2CF6,
+   0x723FD0BF, 0x2555E355, 0xC4F144E2, 0xA96E6D06,
+   0x87880E61, 0x4768A8DD, 0xE508E4D5, 0x15543815,
+   0xB1B65E15, 0x09D7E772, 0xAC302FA0, 0x63439DD6,
+   0xADD70482, 0x6AAC688E, 0x7B4A4E8A, 0x708DE92A,
+   0x758A6EEF, 0x75B6DD73, 0x725B3C43, 0xEA4BF352,
+   0x87912868, 0x10041F2C, 0xEF09297A, 0xB1B1BE95,
+   0xA9F3860A, 0x19AE23C5, 0x515DCF4B, 0xC4F0F839,
+   0x16A66E91, 0xD730049F, 0xFA1B0E0D, 0xE97F2820,
+   0x304C28EA, 0x4131E003, 0x526BAC62, 0x820AB732,
+   0x28714423, 0xB2AC9EF9, 0xADB10CB2, 0x54ECFFFA,
+   0xF886A4CC, 0x8781476E, 0xDB2F8D49, 0x4B2C87B5,
+   0x5F520698, 0x0E6EC096, 0x44F7B8D9, 0x640631FE,
+   0xA35A68B9, 0x92FD34FC, 0x4D40CF4E, 0x9C5A4B66,
+   0x80B6783D, 0x949454BF, 0x3A320A10, 0x80E701FE,
+   0x1A0A39B2, 0x8D1A564A, 0x320587DB, 0x1436D53D,
+   0x8E081F1D, 0x8B51E579, 0xAE7C1D2C, 0x63DBC649,
+   0x8AF7C5E8, 0xF597E5F0, 0x0CA823D7, 0x32E84188,
+   0xE8B1186E, 0x2DAE4826, 0x7061B8FC, 0xCA5A5CB9,
+   0x11DDB233, 0x8C3A8D44, 0x8F0BEB23, 0x4B95D5BD,
+   0x59E38272, 0x508214EE, 0xD9D11B4B, 0xC18BA1C1,
+   0x5B3D94C9, 0x1F9440FB, 0xE6F1D3CE, 0x2D087D5B,
+   0x00A7AB36, 0x834B26FD, 0x56A5F0E6, 0xCD806101,
+   0xC3568612, 0x55C4244A, 0xCBE51B2F, 0x412B48A4,
+   0x9BA1B996, 0x669DDD2E, 0x5E8144F5, 0x4A94DB46,
+   0x7E34C0CF, 0x265AEE92, 0xCB79AE88, 0x8DC3912F,
+   0x3EAF2365, 0x96BE4B6B, 0x56CEFFE5, 0xE95685AF,
+   0x79E932ED, 0x4074D0DC, 0xA952D2E3, 0xD4565B7D,
+   0x2B0DA620, 0x2C9F9C76, 0xCD4457AF, 0xB505A12C,
+   0xACFB7718, 0x1153D4A1, 0x8926C1E2, 0x50912ECD,
+   0xF8A5ED8E, 0xEB06231C, 0x259667C2, 0xC6C81301,
+   0x9A65DC35, 0x396A4AA4, 0x4116CD48, 0x808AD315,
+   //Window 14
+   0x991724F3, 0xC7913E91, 0x39CBD686, 0x5EDA799C,
+   0x63D4FC1E, 0xDDB595C7, 0xAC4FED54, 0x6B63B80B,
+   0x7E5FB516, 0x6EA0FC69, 0xD0F1C964, 0x737708BA,
+   0x11A92CA5, 0x9628745F, 0x9A86967A, 0x61F37958,
+   0x0D738DED, 0x46A8C418, 0xE0DE5729, 0x6F1A5BB0,
+   0x8BA81675, 0xF10230B9, 0x112B33D4, 0x32C6F30C,
+   0xD8FFFB62, 0x7559129D, 0xB459BF05, 0x6A281B47,
+   0xFA3B6776, 0x77C1BD3A, 0x7829973A, 0x0709B380,
+   0x877A21EC, 0x0B825852, 0x0F537A94, 0x300414A7,
+   0x21A9A6A2, 0x3F1CBA40, 0x76943C00, 0x50824EEE,
+   0xF83CBA5D, 0xA0DBFCEC, 0x93B4F3C0, 0xF9538148,
+   0x48F24DD7, 0x61744162, 0xE4FB09DD, 0x5322D64D,
+   0xF1F0CED1, 0xA337C447, 0x9492DD2B, 0x800CC793,
+   0xBEA08EFA, 0x4B93151D, 0xDE0A741E, 0x820CF3F8,
+   0x1C0F7D13, 0xFF1982DC, 0x84DDE6CA, 0xEF921960,
+   0x45F96EE3, 0x1AD7D972, 0x29DEA0C7, 0x319C8DBE,
+   0x0EB919B0, 0x0AE1D63B, 0xA74B9620, 0xD74EE51D,
+   0xA674290C, 0x395458D0, 0x4620A510, 0x324C930F,
+   0xFBAC27D4, 0x2D1F4D19, 0x9BEDEEAC, 0x4086E8CA,
+   0x9B679AB8, 0x0CDD211B, 0x7090FEC4, 0x5970167D,
+   0x6224408A, 0xB7FF1BA1, 0x247CFC5E, 0xCC856E92,
+   0xC18BC493, 0x01F102E7, 0x2091C727, 0x4613AB74,
+   0xC420BF2B, 0xAA25E89C, 0x90337EC2, 0x00A53176,
+   0x7D025FC7, 0xD2BE9F43, 0x6E6FE3DC, 0x3316FB85,
+   0x2064CFD1, 0x67332CFC, 0xB0651934, 0x339C31DE,
+   0x2A3BCBEA, 0x719B28D5, 0x9D6AE5C6, 0xEE74C82B,
+   0xBAF28EE6, 0x0927D05E, 0x9D719028, 0x82CECF2C,
+   0xDDB30289, 0x0B0D353E, 0xFDDB2E29, 0xFE4BB977,
+   0x17A91CAE, 0xE10B2AB8, 0x08E27F63, 0xB89AAB65,
+   0xDBA3DDF9, 0x7B3074A7, 0x330C2972, 0x1C20CE09,
+   0x5FCF7E33, 0x6B9917B4, 0x945CEB42, 0xE6793743,
+   0x5C633D19, 0x18FC2215, 0xC7485474, 0xAD1ADB3C,
+   //Window 15
+   0x6424C49B, 0x646F9679, 0x67C241C9, 0xF888DFE8,
+   0x24F68B49, 0xE12D4B93, 0xA571DF20, 0x9A6B62D8,
+   0x179483CB, 0x81B4B26D, 0x9511FAE2, 0x666F9632,
+   0xD53AA51F, 0xD281B3E4, 0x7F3DBD16, 0x7F96A765,
+   0xBDEFDD4F, 0xF167B4E0, 0xF366E401, 0x69958465,
+   0xA73BBEC0, 0x5AA368AB, 0x7B240C21, 0x12148709,
+   0x18969006, 0x378C3233, 0xE1FE53D1, 0xCB4D73CE,
+   0x130C4361, 0x5F50A80E, 0x7EF5212B, 0xD67F5951,
+   0x4573EAB0, 0xEB443743, 0xD1AC6031, 0x11570DFB,
+   0x44DD9AFD, 0xF7D9B45B, 0x22067231, 0xB8066ADD,
+   0xF8A3F0B4, 0x15F92AD8, 0xE0ACE2A2, 0x9E0E4899,
+   0xFAB38B80, 0xBDCD0AAD, 0x17020052, 0x46506AE9,
+   0x352C4B5C, 0x5A059565, 0x590BC3E2, 0x49261531,
+   0xF66F9F5F, 0x809F7521, 0xC70A4A9B, 0x2BAEF6BF,
+   0x09ED3561, 0xE7E6FA65, 0x984B230C, 0x11370233,
+   0xD04CDC69, 0x2151659B, 0xF007D416, 0xBDB83C63,
+   0x5CA37FF0, 0xCB35A1A8, 0xCD2F1C8F, 0xE1A04F1C,
+   0x15A26112, 0x238816CE, 0x095B177E, 0xE206A111,
+   0x8A424149, 0x3C10B604, 0x74752CFB, 0xC6A3F567,
+   0x47F1DBB8, 0xBF16A37A, 0xD31A3DFB, 0x7C372F9A,
+   0x864AC537, 0xF84B48F7, 0xA6940D3D, 0x04713409,
+   0x6174C7AE, 0x014DB22D, 0x8C213034, 0xC73A1C43,
+   0xFFDD93EC, 0x18AC4EA5, 0x6102783E, 0x724FC757,
+   0x91C3E83F, 0x9FE13FCC, 0xF08F0BF5, 0x92A8C2C8,
+   0xE255D7EC, 0xA72CF82A, 0xA460E204, 0x52025C23,
+   0x7D5B0A44, 0x10AE542D, 0x9305AEDA, 0xA8514310,
+   0xA14BBFE8, 0x958315F5, 0x385365FE, 0x3F361826,
+   0x66D95040, 0xC2B3A36B, 0x7CF4EDA2, 0x12C7B334,
+   0xA3D24F6A, 0xBDB9E57C, 0xF345A763, 0x8A8246D7,
+   0x98CFBB5F, 0x73BD2A6D, 0x86ED04DB, 0x1DD8E85E,
+   0xC01F420B, 0x76F2DA42, 0x64407BC7, 0x7EF05473,
+   0xAFF548F5, 0x7E98BA7F, 0xFD30B64A, 0x6B7AFBEE,
+   //Window 16
+   0x16A0D2BB, 0x4F922FC5, 0x1A623499, 0x0D5CC16C,
+   0x57C62C8B, 0x9241CF3A, 0xFD1B667F, 0x2F5E6961,
+   0xF5A01797, 0x5C15C70B, 0x60956192, 0x3D20B44D,
+   0x071FDB52, 0x04911B37, 0x8D6F0F7B, 0xF648F916,
+   0xB5DEF996, 0x4090914B, 0x233DD1E7, 0x1CB69C83,
+   0x9B3D5E76, 0xC1E9C1D3, 0xFCCF6012, 0x1F3338ED,
+   0x2F5378A8, 0xB1E95D0D, 0x2F00CD21, 0xACF4C2C7,
+   0xEB5FE290, 0x6E984240, 0x248088AE, 0xD66C038D,
+   0x614C0900, 0xD4992B30, 0xBD00C24B, 0xDA98D121,
+   0x7EC4BFA1, 0x7F534DC8, 0x37DC34BC, 0x4A5FF674,
+   0x1D7EA1D7, 0x68C196B8, 0x80A6D208, 0x38CF2893,
+   0xE3CBBD6E, 0xFD56CD09, 0x4205A5B6, 0xEC72E27E,
+   0xB88756DD, 0xE8B97932, 0xF17E3E61, 0xED4E8652,
+   0x3EE1C4A4, 0xC2DD1499, 0x597F8C0E, 0xC0AAEE17,
+   0x6C168AF3, 0x15C4EDB9, 0xB39AE875, 0x6563C7BF,
+   0x20ADB436, 0xADFADB6F, 0x9A042AC0, 0xAD55E8C9,
+   0x909523C8, 0x65C29219, 0xA3A1C741, 0xA62F648F,
+   0x60C9E55A, 0x88598D4F, 0x0E4F347A, 0xBCE9141B,
+   0x35F9B988, 0x9AF97D84, 0x320475B6, 0x0210DA62,
+   0x9191476C, 0x3C076E22, 0x44FC7834, 0x7520DBD9,
+   0x7850EC06, 0x664300B0, 0x7D3A10CF, 0xAC5A38B9,
+   0xE34AB39D, 0x9233188D, 0x5072CBB9, 0xE77057E4,
+   0xB59E78DF, 0xBCF0C042, 0x1D97DE52, 0x4CFC91E8,
+   0x3EE0CA4A, 0x4661A26C, 0xFB8507BC, 0x5620A4C1,
+   0x04B6C5A0, 0x84B9CA15, 0x18F0E3A3, 0x35216F39,
+   0xBD986C00, 0x3EC2D2BC, 0xD19228FE, 0x8BF546D9,
+   0x4CD623C3, 0xD1C655A4, 0x502B8E5A, 0x366CE718,
+   0xEEA0BFE7, 0x2CFC84B4, 0xCF443E8E, 0xE01D5CEE,
+   0xBE063F64, 0xA75FEACA, 0xBCE47A09, 0x9B392F43,
+   0x1AD07ACA, 0xD4241509, 0x8D26CD0F, 0x4B0C591B,
+   0x92F1169A, 0x2D42DDFD, 0x4CBF2392, 0x63AEB1AC,
+   0x0691A2AF, 0x1DE9E877, 0xD98021DA, 0xEBE79AF7,
+   //Window 17
+   0xF5B343BC, 0x58AF2010, 0xF2F142FE, 0x0F2E400A,
+   0xA85F4BDF, 0x3483BFDE, 0x03BFEAA9, 0xF0B1D093,
+   0xC7081603, 0x2EA01B95, 0x3DBA1097, 0xE943E4C9,
+   0xB438F3A6, 0x47BE92AD, 0xE5BF6636, 0x00BB7742,
+   0x31815E69, 0x3A63C397, 0xDCDD2802, 0x6DF9CBD6,
+   0x15B4F6AF, 0x4C47ED4A, 0x6AC0F978, 0x62009D82,
+   0x8B898FC7, 0x664D80D2, 0x2C17C91F, 0x72F1EEDA,
+   0x7AAE6609, 0x9E84D3BC, 0x28376895, 0x58C7C195,
+   0xA8271D7E, 0xA752C905, 0x58E5810B, 0x4735DFA5,
+   0x5D925AEB, 0xE18A44EE, 0x13C8A853, 0x9708697F,
+   0xBFCC9A0B, 0x8377D540, 0xE574D403, 0x7B27E01C,
+   0xCF60A8A6, 0x3D3D180C, 0xF1C298BF, 0xE48EF152,
+   0xC880E5CA, 0xCCBF7AC2, 0x8D11C450, 0x8299DBEE,
+   0x0F77A6BF, 0xBB27D11B, 0x5EDCE793, 0xC601630B,
+   0x79E7F8EA, 0xDB73B9FB, 0xF4367288, 0xE448BBA7,
+   0xB035571B, 0xF5B6416F, 0xA48891A2, 0x981B8F5D,
+   0xA26A3132, 0x30268C47, 0x6CE92605, 0xFAA24BA4,
+   0x9C8184A6, 0x080E3933, 0xB44FEF0C, 0x2E53814F,
+   0x46E604CF, 0x88A12645, 0x10C8CC08, 0xB7E29B62,
+   0xD2323E0A, 0x99786232, 0x3F46E27E, 0x8621CD5A,
+   0xF9A92333, 0xEA4F5E09, 0x5CB3BD9F, 0x4C24B97C,
+   0x39CB87FC, 0xD30068E2, 0xEE80C7F0, 0xEEAFF323,
+   0x27429E07, 0xDD78DE47, 0x648EB245, 0x4CE46496,
+   0x0FC62D56, 0xDCDAE2F0, 0x03913C29, 0xA9A81D60,
+   0xE380A61B, 0xCE9CF0C3, 0xB46206F6, 0x9BE54396,
+   0x1E6ABDE0, 0x09D7C575, 0xF335BABE, 0xF47427FF,
+   0x43E9153C, 0x96A068A8, 0xE3CDABD6, 0x2978F85C,
+   0xDD3D907F, 0x12A44E36, 0x38C641BD, 0x3E566855,
+   0x4261867F, 0x4A9C94E2, 0xD3539FEF, 0xB6B24EC9,
+   0x6BB3FEF3, 0x5F03E700, 0x69A0F34A, 0x4C480BC9,
+   0xA001F9D9, 0x1BE1DF5B, 0xCDC2BE56, 0xEF662CB4,
+   0x9135E8FD, 0x2021DE7D, 0x710E6751, 0x01F892F8,
+   //Window 18
+   0xD005832A, 0x0DB2FB5E, 0x91042E4F, 0x5F5EFD3B,
+   0xED70F8CA, 0x8C4FFDC6, 0xB52DA9CC, 0xE4645D0B,
+   0xC9001D1F, 0x9596F58B, 0x4E117205, 0x52C8F0BC,
+   0xE398A084, 0xFD4AA0D2, 0x104F49DE, 0x815BFE3A,
+   0xD7AB9A2D, 0x524D226A, 0x7DFAE958, 0x9C00090D,
+   0x8751D8C2, 0x0BA5F539, 0x3AB8262D, 0x8AFCBCDD,
+   0xE99D043B, 0x57392729, 0xAEBC943A, 0xEF51263B,
+   0x20862935, 0x9FEACE93, 0xB06C817B, 0x639EFC03,
+   0xC3B81990, 0xDEC98D4A, 0x9E0CC8FE, 0x1CB83722,
+   0xD2B427B9, 0xFE0B0491, 0xE983A66C, 0x0F2386AC,
+   0xB3291213, 0x930C4D1E, 0x59A62AE4, 0xA2F82B2E,
+   0xF93E89E3, 0x77233853, 0x11777C7F, 0x7F8063AC,
+   0x02FF6072, 0x36E607CF, 0x8AD98CDC, 0xA47D2CA9,
+   0xF5F56609, 0xBF471D1E, 0xF264ADA0, 0xBCF86623,
+   0xAA9E5CB6, 0xB70C0687, 0x17401C6C, 0xC98124F2,
+   0xD4A61435, 0x8189635F, 0xA9D98EA6, 0xD28FB8AF,
+   0x017025F3, 0x3D4DA8C3, 0xFB9579B4, 0xEFCF628C,
+   0x1F3716EC, 0x5C4D0016, 0x6801116E, 0x9C27EBC4,
+   0x1DA1767E, 0x5EBA0EA1, 0x47004C57, 0xFE151452,
+   0x8C2373B7, 0x3ACE6DF6, 0x5DBC37AC, 0x75C3DFFE,
+   0x80101B98, 0xB57276D9, 0xB82F0F66, 0x760883FD,
+   0x4BC3EFF3, 0x89D7DE75, 0x5DC2AB40, 0x03B60643,
+   0xE05BEEAC, 0xCD6E53DF, 0xBC3325CD, 0xF2F1E862,
+   0x774F03C3, 0xDD0F7921, 0x4552CC1B, 0x97CA7221,
+   0xE224C5D7, 0x760CB3B5, 0x68616919, 0xFA3BAF8C,
+   0x8D142552, 0x9FBCA113, 0x7669EBF5, 0x1AB18BF1,
+   0x9BDF25DD, 0x55E6F53E, 0xCB6CD154, 0x04CC0BF3,
+   0x95E89080, 0x595BEF49, 0x104A9AC1, 0xFE9459A8,
+   0xABB020E8, 0x694B64C5, 0x19C4EEC7, 0x3D18C184,
+   0x1C4793E5, 0x9C4673EF, 0x056092E6, 0xC7B8AEB5,
+   0xF0F8C16B, 0x3AA1CA43, 0xD679B2F6, 0x224ED5EC,
+   0x55A205C9, 0x0D56EEAF, 0x4B8E028B, 0xBFE115BA,
+   //Window 19
+   0x97ACF4EC, 0x3E22A7B3, 0x5EA8B640, 0x0426C400,
+   0x4E969285, 0x5E3295A6, 0xA6A45670, 0x22AABC59,
+   0x5F5942BC, 0xB929714C, 0xFA3182ED, 0x9A6168BD,
+   0x104152BA, 0x2216A665, 0xB6926368, 0x46908D03,
+   0x10395755, 0xCE06B882, 0x5EC1DF80, 0x117CE634,
+   0xEFF55E96, 0xFEFAE513, 0xFD7FED1E, 0xCF36CBA6,
+   0xA40EBF88, 0x7340ECA9, 0xB3D37E12, 0xE6EC1BCF,
+   0x86BBF9FF, 0xCA51B64E, 0x8B40E05E, 0x4E0DBB58,
+   0x7EA2EE34, 0x359D7B9C, 0x09CC3A71, 0x3FD0D94C,
+   0x3A1EA37A, 0xBB53C31C, 0xCF818C87, 0x533425FA,
+   0x810156E0, 0x7CD199C3, 0x30C16448, 0x0EA020E4,
+   0x4A642542, 0xE557BA09, 0x9465F5EA, 0xE657E7E7,
+   0x593D070F, 0x59CD0E8B, 0x5255625D, 0x43757516,
+   0x5B7A0399, 0x551FDDA7, 0x2DEC1EEB, 0x7BB6E6B0,
+   0x334C0922, 0x729BB662, 0x0CF41B79, 0x3DF631DF,
+   0x78F32402, 0x01ABF3C5, 0x9CD33C88, 0xFCB4666C,
+   0x3E775810, 0x2EDA49F3, 0x4221330D, 0xA99A9E11,
+   0xAEAA3943, 0x4950E422, 0x1824EA7C, 0x9DD4DF58,
+   0xDFBE0F02, 0x71A21DCD, 0x6FBB081D, 0x36C417B1,
+   0xF1A3D306, 0xE6F90483, 0x5C500CD5, 0x515118FB,
+   0xAE037562, 0x73BDFF5C, 0xEB56D4CD, 0x4AF7123F,
+   0x796BDFE6, 0xAF2042D4, 0xFDC548D3, 0xE11CDF88,
+   0x16A048C8, 0x1139FA49, 0xC6276A86, 0x7EE12A2F,
+   0xB5062F0B, 0xC7E286BB, 0xD0ADE296, 0xA88E1E89,
+   0x5CCEE85C, 0x65059741, 0xB5577607, 0x92D24C0E,
+   0xF63D9B4C, 0x3C97AB26, 0xD7E1CB68, 0x609E521F,
+   0xEF326143, 0xE33685C5, 0xFCE7E5A0, 0x3FCBE499,
+   0xF9C1E69C, 0xB76CBFAD, 0xDFDB6724, 0x643B6DE4,
+   0xCBA8C05E, 0xDC6BA4F6, 0x7CCEA6E3, 0x512C615F,
+   0x8840EC5B, 0x8BB9168E, 0x6AF43F4B, 0xB63C2E0B,
+   0xE2AA567A, 0x9064B6E1, 0x7B504205, 0x71CBC712,
+   0x6187DE4F, 0x0E53FA50, 0xF2E5DEE8, 0xD83ED1CC,
+   //Window 20
+   0xF1C367CA, 0xE4050F1C, 0xC90FBC7D, 0x9BC85A9B,
+   0xE1A11032, 0xA373C4A2, 0xAD0393A9, 0xB64232B7,
+   0x167DAD29, 0xF5577EB0, 0x94B78AB2, 0x1604F301,
+   0xE829348B, 0x0BAA94AF, 0x41654342, 0x77FBD8DD,
+   0x68AF43EE, 0xA2F7932C, 0x703D00BD, 0x5502468E,
+   0x2FB061F5, 0xE5DC978F, 0x28C815AD, 0xC9A1904A,
+   0x470C56A4, 0xD3AF538D, 0x193D8CED, 0x159ABC5F,
+   0x20108EF3, 0x2A37245F, 0x223F7178, 0xFA17081E,
+   0x8E2F7D90, 0x5C18ACF8, 0x77BE32CD, 0xFDBF33D7,
+   0xD2EB5EE9, 0x0A085CD7, 0xB3201115, 0x2D702CFB,
+   0x85C88CE8, 0xB6E0EBDB, 0x1E01D617, 0x23A3CE3C,
+   0x567333AC, 0x3041618E, 0x157EDB6B, 0x9DD0FD8F,
+   0x6FA6110C, 0x516FF3A3, 0xFB93561F, 0x74FB1EB1,
+   0x8457522B, 0x6C0C9047, 0x6BB8BDC6, 0xCFD32104,
+   0xCC80AD57, 0x2D6884A2, 0x86A9B637, 0x7C27FC35,
+   0xADF4E8CD, 0x3461BAED, 0x617242F0, 0x1D56251A,
+   0x21175EC1, 0x892C81A3, 0xEE018109, 0x9159A505,
+   0x2D8BE316, 0xC7013053, 0x426FA2E5, 0x76060C21,
+   0x6B6F0F22, 0x074D2DFC, 0xCA01A671, 0x9725FC64,
+   0x2770BD8E, 0x3F6679B9, 0xD7C9B3FE, 0x8FE6604F,
+   0x73204349, 0x71D530CC, 0x94A0679C, 0xC9DF473D,
+   0x4261E031, 0xC572F001, 0x22F135FE, 0x9786B71F,
+   0x6B64E56F, 0xED6505FA, 0x05219C46, 0xE2FB48E9,
+   0xEDF53D71, 0x0DBEC45B, 0xC589F406, 0xD7D782F2,
+   0x446CD7F4, 0x06513C8A, 0x906D52A6, 0x158C423B,
+   0xC423866C, 0x71503261, 0x93C148EE, 0x4B96F570,
+   0x239A8523, 0x5DAF9CC7, 0x95AC4B8B, 0x611B5976,
+   0x724BF7F6, 0xDE3981DB, 0x67AFC443, 0x7E7D0F78,
+   0x8CE59954, 0x3D1AB80C, 0x78222AC0, 0x742C5A94,
+   0x94F878DD, 0x3DDACBF8, 0xE7D54A99, 0xFC085117,
+   0x21E38EC2, 0xFB0F1DFA, 0x16F4FF7F, 0x1C7B59CB,
+   0x7EA888FE, 0x98875239, 0xB10DC889, 0x705D270C,
+   //Window 21
+   0x87DEC0E1, 0xE5AA692A, 0xF7B39D00, 0x010DED8D,
+   0x54CFA0B5, 0x7B1B80C8, 0xA0F8EA28, 0x66BEB876,
+   0x3476CD0E, 0x50D7F531, 0xB08D3949, 0xA63D0E65,
+   0x53479FC6, 0x1A09EEA9, 0xF499E742, 0x82AE9891,
+   0x214AEB18, 0x90FE7A1D, 0x741432F7, 0x1506AF3C,
+   0xE591A0C4, 0xBB5565F9, 0xB44F1BC3, 0x10D41A77,
+   0xA84BDE96, 0xA09D65E4, 0xF20A6A1C, 0x42F060D8,
+   0xF27F9CE7, 0x652A3BFD, 0x3B3D739F, 0xB6BDB65C,
+   0x753B9371, 0x2F682343, 0x5F1F9CD7, 0x29CAB45A,
+   0xB245DB96, 0x571623AB, 0x3FD79999, 0xC507DB09,
+   0xAF036C32, 0x4E2EF652, 0x05018E5C, 0x86F0CC78,
+   0xAB8BE350, 0xC10A73D4, 0x7E826327, 0x6519B397,
+   0x173E460C, 0xB2AB1957, 0x30704590, 0x1BBBCE75,
+   0xDB1C7162, 0xC0A90DBD, 0x15CDD65D, 0x505E399E,
+   0x57797AB7, 0x68434DCB, 0x6A2CA8E8, 0x60AD35BA,
+   0xDE3336C1, 0x4BFDB1E0, 0xD8B39015, 0xBBEF99EB,
+   0x8DB60E35, 0xA93CC5F0, 0xFA833319, 0x743E3CD6,
+   0xF81683C9, 0x7DAD5C41, 0x9C34107E, 0x70C1E7D9,
+   0xA6BE0907, 0x0EDC4A39, 0x86D0B7D3, 0x36D47035,
+   0x272BFA60, 0x8C76DA03, 0x0F08A414, 0x0B4A07EA,
+   0x089808EF, 0xD225CB2E, 0xD59E4107, 0xF1F7A27D,
+   0x8211B9C9, 0x53AFC761, 0xE6819159, 0x0361BC67,
+   0x7F071426, 0x2A865D0B, 0xE7072567, 0x6A3C1810,
+   0x0D6BCABD, 0x3E3BCA1E, 0x408591BC, 0xA1B02BC1,
+   0x36F5DEFE, 0x5F6D2D72, 0x56F99176, 0xFA9922DC,
+   0xF78CE0C7, 0x6C8C5ECE, 0xBE09B55E, 0x7B44589D,
+   0x9EA83770, 0xE11B3BCA, 0x2AB71547, 0xD7FA2C7F,
+   0x2A1DDCC0, 0x2A3DD6FA, 0x5A7B7707, 0x09ACB430,
+   0xC093C171, 0x65587DC3, 0x24F42B65, 0xAE7ACB24,
+   0x955996CB, 0x5A338ADB, 0x6051F91B, 0xC8E65675,
+   0x28B8D0B1, 0x66711FBA, 0xB6C10A90, 0x15D74137,
+   0x3A232A80, 0x70CDD7EB, 0x6191ED24, 0xC9E2F07F,
+   //Window 22
+   0xF79588C0, 0xA80D1DB6, 0xB55768CC, 0xFA52FC69,
+   0x7F54438A, 0x0B4DF1AE, 0xF9B46A4F, 0x0CADD1A7,
+   0x1803DD6F, 0xB40EA6B3, 0x55EAAE35, 0x488E4FA5,
+   0x382E4E16, 0x9F047D55, 0x2F6E0C98, 0xC9B5B7E0,
+   0x83A7337B, 0x4B7D0E06, 0xFFECF249, 0x1E3416D4,
+   0x66A2B71F, 0x24840EFF, 0xB37CC26D, 0xD0D9A50A,
+   0x6FE28EF7, 0xE2198150, 0x23324C7F, 0x3CC5EF16,
+   0x769B5263, 0x220F3455, 0xA10BF475, 0xE2ADE2F1,
+   0xDACDDB7D, 0x03B6C8C7, 0x7E1EDCAD, 0x92ED5004,
+   0x54080633, 0xA0E46C2F, 0x46DEC1CE, 0xCD37663D,
+   0xF365B7CC, 0x396984C5, 0xE79BB95D, 0x294E3A2A,
+   0x27B1D3C1, 0x9AA17D77, 0xE49440F5, 0x3FFD3CFA,
+   0x399F9CF3, 0x26679D11, 0x1E3C4394, 0x78E7A48E,
+   0x0D98DAF1, 0x08722DEA, 0x80030EA3, 0x37E7ED58,
+   0x3C8AAE72, 0xF3731AD4, 0xAC729695, 0x7878BE95,
+   0xBBC28352, 0x6A643AFF, 0x78759B61, 0xEF8B801B,
+   0xB63AFE75, 0xDCDD3709, 0x3F1AF8FF, 0xAD9D7F0B,
+   0x194F4BEE, 0xDD6A8045, 0x2F7D998C, 0x867724CC,
+   0x837751BE, 0xD51D0AA5, 0x959A0658, 0x21D6754A,
+   0x695F7E58, 0xD2212611, 0x297363EF, 0xEC4B93C2,
+   0xB9D1A70F, 0x8165EC11, 0x384F6CAE, 0x01347EFC,
+   0xAB7AECA9, 0xE95C01A0, 0xC6C99530, 0x459BA1C5,
+   0x5CF3416B, 0x38967A63, 0x1E5457E2, 0x5C3761FD,
+   0xF03E9DF6, 0x43E6077A, 0x8BD1C7F6, 0xB15D3462,
+   0x35A75C49, 0xAD87D3DB, 0x61AF03C5, 0xC69D8009,
+   0x3A6A6C4C, 0x31AEF61A, 0xAA10A993, 0xB3292640,
+   0xAAEE340F, 0x959AAE80, 0x7F381A3B, 0xF900528E,
+   0x853691A3, 0x44ECF76E, 0xE749E68E, 0xA081663C,
+   0x6283E34A, 0x4F278213, 0xFBFA315F, 0x6F9FCF60,
+   0x9B701364, 0x224A2AB9, 0xF9FECADC, 0xB4B1B418,
+   0x50BA1B9A, 0xBF7280FE, 0x33F36DB9, 0x7E68259C,
+   0x154C9FB0, 0x8CCB754E, 0xDB2328F1, 0xF281ADB1,
+   //Window 23
+   0xBE24319A, 0xF92DDA31, 0xE095A8E7, 0x03F7D28B,
+   0x98782185, 0xA52FE840, 0x29C24DBC, 0x276DDAFE,
+   0x1D7A64EB, 0x80CD5496, 0x7F1DBE42, 0xE4360889,
+   0x8438D2D5, 0x2F81A877, 0x85169036, 0x7E4D52A8,
+   0x3D30A2C5, 0x1FE647D8, 0xF78A81DC, 0x0857F77E,
+   0x131A4A9B, 0x11D5A334, 0x29D393F5, 0xC0A94AF9,
+   0xDAA6EC1A, 0xBC3A5C0B, 0x88D2D7ED, 0xBA9FE493,
+   0xBB614797, 0xBB4335B4, 0x72F83533, 0x991C4D68,
+   0x3D34A2E3, 0x1FD84CE4, 0xB43B5D61, 0xEE3759CE,
+   0x619186C7, 0x895BC78C, 0xCBB9725A, 0xF19C3809,
+   0xDE744B1F, 0xC0BE21AA, 0x60F8056B, 0xA7D222B0,
+   0xB23EFE11, 0x74BE6157, 0x0CD68253, 0x6FAB2B4F,
+   0xB99A72CB, 0x2101A522, 0x87618016, 0x06DE6E67,
+   0xE6F3653E, 0x5FF8C7CD, 0xC7A6754A, 0x0A821AB5,
+   0x7CB0B5A2, 0x7E3FA52B, 0xC9048790, 0xA7FB121C,
+   0x06CE053A, 0x1A725020, 0x04E929B0, 0xB490A31F,
+   0xFB167583, 0x4239D571, 0xD16C8F8A, 0xDD011C78,
+   0x69A27519, 0x271C2895, 0xD2D64B6A, 0x9CE0A3B7,
+   0xD5EC6738, 0x8C977289, 0x8840EF6B, 0xA3B49F9A,
+   0x9A453419, 0x808C14C9, 0x0CF0A2D5, 0x5C00295B,
+   0x19ABD09E, 0xA83CCF6E, 0x4FF17EDB, 0x0B4097C1,
+   0xD64A06CE, 0x58A5C478, 0x544A58FD, 0x2DDCC3FD,
+   0x9E8153B8, 0xD449503D, 0x7774179B, 0x3324FD02,
+   0xDBD9120C, 0xAF5D47C8, 0x34FA94DB, 0xEB860162,
+   0x6D671192, 0xF85C974E, 0xDE16F60F, 0x1E14100A,
+   0x95C38797, 0x45CB0D5A, 0x9B022DA4, 0x18923BBA,
+   0xBBE7E86E, 0xEF2BE899, 0x216067BF, 0x4A1510EE,
+   0x84D5CE3E, 0xD98C8154, 0xF92A2B90, 0x1AF777F0,
+   0xC9F84296, 0x1ED46585, 0x3BC278B0, 0x7FBAA8FB,
+   0x6C4FCBD0, 0xA8E96CD4, 0x73B60A5F, 0x940A1202,
+   0x55A4AEC8, 0x34AAE120, 0xDBD742F0, 0x550E9A74,
+   0x228C68AB, 0x794456D7, 0xA4E25EC6, 0x492F8868,
+   //Window 24
+   0xB0E63D34, 0x4FE7EE31, 0xA9E54FAB, 0xF4600572,
+   0xD5E7B5A4, 0xC0493334, 0x06D54831, 0x8589FB92,
+   0x6583553A, 0xAA70F5CC, 0xE25649E5, 0x0879094A,
+   0x10044652, 0xCC904507, 0x02541C4F, 0xEBB0696D,
+   0x99375235, 0xB99F0E03, 0xB9917970, 0x7614C847,
+   0x524EC067, 0xFEC93CE9, 0x9B122520, 0xE40E7BF8,
+   0xEE4C4774, 0xB5670631, 0x3B04914C, 0x6F03847A,
+   0xDC9DD226, 0xC96E9429, 0x8C57C1F8, 0x43489B6C,
+   0xCC2338FB, 0x46FFD227, 0x90E26153, 0x89FF6FA9,
+   0x331A0076, 0xBE570779, 0x06E1F3AF, 0x43D241C5,
+   0xDE9B62A3, 0xFDCDB97D, 0xA0AE30EA, 0x6A06E984,
+   0x4FBDDF7D, 0xC9BF1680, 0xD36163C4, 0x170471A2,
+   0x55950CC3, 0x361619E4, 0x56B66BB8, 0xC71D665C,
+   0xAFAC6D84, 0xEA034B34, 0xE5E4C7E3, 0xA987F832,
+   0x7A79A6A7, 0xA0742772, 0xE26D6C23, 0x56E5D017,
+   0x38167E10, 0x7E50B976, 0xE88AA84E, 0xAA6C81EF,
+   0x4D325BBF, 0x473959D7, 0x8D6114B9, 0x2A61BEEC,
+   0x924BE2EE, 0x25672A94, 0xF2C23D0C, 0xA48595DB,
+   0x6A221838, 0xE476848B, 0x35C1B673, 0xE743E69A,
+   0xD8468503, 0x2AB42499, 0xE9E90BA7, 0x62AA0054,
+   0x73A904E0, 0xBDFB2717, 0x28888D73, 0x7CE1E40B,
+   0xEAA97D1B, 0x2E7E35F6, 0xA9AFA097, 0xD061772A,
+   0x7A1F7C59, 0x434AC7C4, 0xE79B7B9A, 0x6E21124A,
+   0xBB22ECC7, 0x055ACFF3, 0x84C858D3, 0x8BFD7AC9,
+   0x9F1F68AD, 0x2FD57DF5, 0xB06470C8, 0x5DDCC6DB,
+   0xA9B47307, 0x801B6451, 0x76551BF4, 0x6B51C8E3,
+   0xD44E1DA9, 0xEF0BD1F7, 0x4D4E600C, 0x714BCB1D,
+   0x0C6540C7, 0xC57BB9E4, 0x327CC644, 0x71BD1EC2,
+   0x7F4DD81F, 0x9A52CF7E, 0x5E69C05E, 0xA0132BE1,
+   0x2A0F4D72, 0x90DAB747, 0x312D6706, 0xC142F911,
+   0x8261998B, 0xE8D3631F, 0x615C1C94, 0xF0F42FAE,
+   0xAEC3FA5D, 0x2F4E948C, 0xA374101E, 0x242AE7A8,
+   //Window 25
+   0xC8DE610B, 0x0F893A5D, 0x67E223CE, 0xE8C515FB,
+   0x4EAD6DC5, 0x7774BFA6, 0x925C728F, 0x89D20F95,
+   0x098583CE, 0x7A1E0966, 0x93F2A7D7, 0xA2EEDB94,
+   0x4C304D4A, 0x1B282097, 0xC077282D, 0x0842E3DA,
+   0xFC15AA1E, 0x5A3097BE, 0xB54B0745, 0x40D12548,
+   0x519A5F12, 0x5BAD4706, 0xA439DEE6, 0xED03F717,
+   0x4A02C499, 0x0794BB6C, 0xCFFE71D2, 0xF725083D,
+   0x0F3ADCAF, 0x2CAD7519, 0x43729310, 0x7F68EA1C,
+   0xF7F91D0F, 0x9C806D8A, 0xA82A5728, 0x3B61B0F1,
+   0x94D76754, 0x4640032D, 0x47D834C6, 0x273EB5DE,
+   0x7B4E4D53, 0x2988ABF7, 0xDE401777, 0xB7CE66BF,
+   0x715071B3, 0x9FBA6B32, 0xAD3A1A98, 0x82413C24,
+   0x9BE47BE0, 0x69C43526, 0xCB28FEA1, 0x323B7DD8,
+   0x3A6C67E5, 0xFA5538BA, 0x1D378E46, 0xEF921D70,
+   0x3C4B880E, 0xF92961FC, 0x98940A67, 0x3F6F914E,
+   0xFEF0FF39, 0xA990EB0A, 0xF0EEFF9C, 0xA6C2920F,
+   0x343BF1A9, 0x70B63D32, 0x37D1A6B1, 0x8FD3BD28,
+   0x316865B4, 0x0454879C, 0xC458EFA2, 0xEE959FF6,
+   0x9706DC3F, 0x0461DCF8, 0x164E4B2E, 0x737DB0E2,
+   0x2F8843C8, 0x09262680, 0x7745E6F6, 0x54498BBC,
+   0xD5F30851, 0x4C1F428C, 0x2A4F6630, 0x94DFED27,
+   0xFC5D48A4, 0x4DF53772, 0x933260CE, 0xDD2D5A2F,
+   0xD44CC7A5, 0x574115BD, 0xBD12533A, 0x4BA6B20D,
+   0x243057C9, 0x30E93CB8, 0x14DE320E, 0x794C486A,
+   0x02F1CD1E, 0xC232D973, 0x1DD212A4, 0xCE87EACB,
+   0xE69802F7, 0x6E4C8C73, 0x1FFFDDBD, 0x12EF0290,
+   0x1BCEA6E2, 0x941EC74E, 0x3CB92CBB, 0xD0B54024,
+   0x7E8F9D05, 0x809FB9D4, 0xF2992AAE, 0x3BF16159,
+   0xB055CB40, 0xBDB8E675, 0x977B5167, 0x898F8E7B,
+   0xB82FB863, 0xECC65651, 0x6D88F01F, 0x56544814,
+   0x263A75A9, 0xB0928E95, 0x1A22FCDA, 0xCFB6836F,
+   0x3F3BD37C, 0x651D14DB, 0xB6AD4664, 0x1D3837FB,
+   //Window 26
+   0xCF7D62D2, 0x20D3C982, 0x23BA8150, 0x1F36E29D,
+   0x92763F9E, 0x48AE0BF0, 0x1D3A7007, 0x7A527E6B,
+   0x581A85E3, 0xB4A89097, 0xDC158BE5, 0x1F1A520F,
+   0x167D726E, 0xF98DB37D, 0x1113E862, 0x8802786E,
+   0xF4C6B6EC, 0xF6E894D1, 0x18B3CD9B, 0x526B0827,
+   0x12117FBF, 0x73F952A8, 0x11945BF5, 0x2BE864B0,
+   0x42099B64, 0x86F18EA5, 0x07548CE2, 0x2770B28A,
+   0x295C1C9C, 0x97390F28, 0xCB5206C3, 0x672E6A43,
+   0x47C64367, 0xCACCE2C8, 0x45AF4EC0, 0x6A496B9F,
+   0x6034042C, 0x2A0836F3, 0x0B6C62EA, 0x14A1F390,
+   0x3EF1F540, 0xE7FA9363, 0x72A76D93, 0xD323B30A,
+   0x0FEAE451, 0xFFEEC8B5, 0xBD04EF87, 0x4EAFC172,
+   0xB3E59B89, 0xE4435A51, 0x4133A1C9, 0x13613955,
+   0x440BEE59, 0x87F46973, 0x00C401E4, 0x714710F8,
+   0xD6C446C9, 0xC0CF4BCE, 0x6C4D5368, 0xE0AA7FD6,
+   0xFC68FC37, 0xDE5D811A, 0xB7C2A057, 0x61FEBD72,
+   0x65F837E2, 0x27375FE6, 0xD882179F, 0x93F8C68B,
+   0x59B16187, 0x584FEADC, 0x483BC162, 0xE5B50BE9,
+   0xA2776625, 0x7AD9D6F1, 0x04FF457B, 0xE9D10080,
+   0x677618A6, 0x5B56D322, 0xE3E68673, 0x036694EA,
+   0x1D8A4FD1, 0x6FEAFFC5, 0x5F1AD208, 0x59663B20,
+   0x24ACB46A, 0xEFC93CEF, 0x5967118C, 0x54929DE0,
+   0x9ACFFB1C, 0x88570800, 0x145639EC, 0x492BBF2B,
+   0x38F0018E, 0x71F495A6, 0xC2792847, 0xE24365DB,
+   0xA6F29002, 0x4BEDAE86, 0xE034457A, 0x7ABEDB56,
+   0x179BFF2A, 0x8BF3EEC6, 0x390F4E6B, 0x9D626D57,
+   0x14DD6EA3, 0x653FE0E9, 0x89BD6D08, 0x74837159,
+   0xEBD9B03D, 0x85FB05B4, 0x4A768BBC, 0x7DC3F221,
+   0x32B0ED8F, 0xAACC63F1, 0x2BAFEFD2, 0x04123724,
+   0x7E2D2A13, 0x0DF9A798, 0x9C27591F, 0x09BD13CF,
+   0x6E1AFB50, 0xAA5F5E47, 0xB66EB646, 0xCD146A42,
+   0x1442EC3C, 0x3F07561D, 0x8AE8EC47, 0x7E547173,
+   //Window 27
+   0x453CADD6, 0x8DE2B7BC, 0xBC0BC1F8, 0x203900A7,
+   0xA6ABD3AF, 0xBCD86E47, 0x8502EFFB, 0x911CAC12,
+   0xEC965469, 0x2D550242, 0x29E0017E, 0x0E9F7692,
+   0x65979885, 0x633F078F, 0x4CF751EF, 0xFB87D449,
+   0x1D7AADAB, 0x1A0445FF, 0xD5F6A67C, 0x65D38260,
+   0x91CFB26F, 0x6E62FB08, 0x5C7D91D6, 0xEF1E0FA5,
+   0x33DB72CD, 0x47E7C7BA, 0xFA7C74B2, 0x017CBC09,
+   0xF50A503C, 0x3C931590, 0x616BAA42, 0xCAC54F60,
+   0x4B07E2B1, 0x7173DD5D, 0x8D9EA221, 0xD144C4CB,
+   0x1105AB14, 0xE8B04EA4, 0xFE80D8F1, 0x92DDA542,
+   0xCF03DCE6, 0xE9982FA8, 0x1A22CFFC, 0x8B5EA965,
+   0x3FAD88C4, 0xF7F4EA7F, 0x6A5BA95C, 0x62DB773E,
+   0x9C92B235, 0x4BAAE6E8, 0x6B3993A1, 0xA73BBD0E,
+   0x693DD031, 0xD06D60EC, 0x7156881C, 0x03CAB91B,
+   0x1DB3574B, 0xD615862F, 0x64BB061A, 0x485B0185,
+   0xA0181E06, 0x27434988, 0xC1C0C757, 0x2CD61AD4,
+   0x030D86A0, 0xC85C34D3, 0x213CE95E, 0xF14B2E80,
+   0xF07E6D7F, 0xCE3EED9B, 0xA3A3EC79, 0x476C3E21,
+   0xCADEA5D3, 0xB4EC11F2, 0xCCA936AA, 0xD1AD5F12,
+   0x34E61C7D, 0x1724609E, 0x2FD67BA2, 0xCC520DF3,
+   0xBAFEA141, 0x11A09A99, 0x19D41640, 0x7FE0414B,
+   0xF3B609D1, 0xD66B072A, 0xBC5554D2, 0x27F7DE34,
+   0xBC517B45, 0xD66529AF, 0x12D18D9F, 0x8BE43521,
+   0x4E0DEFD7, 0x942192E1, 0x90C0AF1E, 0xB465871F,
+   0xF33F25BC, 0x170F87E0, 0xC339C098, 0x24DCB667,
+   0xAB073EAE, 0xBF1702A4, 0x238CFB44, 0xADA6919C,
+   0xDDEE6375, 0x53008511, 0xB8DB60AD, 0xDB92FA85,
+   0xA421210E, 0x50B6A366, 0x4C37558F, 0xDC7BF8EB,
+   0x89E4043B, 0xFB5487B0, 0x09799BD2, 0x4DE49DEF,
+   0xB3E760BE, 0x9DA870C0, 0x89EE1539, 0x5E4E1DD3,
+   0x915705DB, 0x1B3849FA, 0x5EAC0E81, 0x7CE5E194,
+   0xB00D3F5C, 0x7C1772A0, 0x6C00B5A1, 0x54792676,
+   //Window 28
+   0xC360E25A, 0x8CE9B6BF, 0x075A1A78, 0xE6425195,
+   0x481732F4, 0x9DC756A8, 0x5432B57A, 0x83C0440F,
+   0xD720281F, 0xC670B3F1, 0xD135E051, 0x2205910E,
+   0xDB052BE7, 0xDED14B0E, 0xC568EA39, 0x697B3D27,
+   0x14092EBB, 0x0B89DE93, 0x428E240C, 0xF17256BD,
+   0x93D2F064, 0xCF89A7F3, 0xE1ED3B14, 0x4F57841E,
+   0xE708D855, 0x4EE14405, 0x03F1C3D0, 0x856AAE72,
+   0xBDD7EED5, 0xC8E5424F, 0x73AB4270, 0x3333E4EF,
+   0xA1F25897, 0xE75E7A88, 0xA1B5D4D8, 0x7AC6961F,
+   0x08F3ED5C, 0xE3E10773, 0x0A892DFB, 0x208A54EC,
+   0x78660710, 0xBE826E19, 0x237DF2C8, 0x0CF70A97,
+   0xED704DA5, 0x418A7340, 0x08CA33FD, 0xA3EEB9A9,
+   0x8434A920, 0xB4323D58, 0x622103C5, 0xC0AF8E93,
+   0x938DBF9A, 0x667518EF, 0x83A9CDF2, 0xA1843073,
+   0x5447AB80, 0x350A94AA, 0xC75A3D61, 0xE5E5A325,
+   0x68411A9E, 0x74BA507F, 0x594F70C5, 0x10581FC1,
+   0xCB0C9C8C, 0x5AAA98A7, 0x81C4375C, 0x75105F30,
+   0x5EF1C90F, 0xCEEE5057, 0xC23A17BF, 0xB31E065F,
+   0xD4B6D45A, 0x5364D275, 0x62EC8996, 0xD363F3AD,
+   0x4391C65B, 0xB5D21239, 0xEBB41B47, 0x84564765,
+   0xE75746B5, 0x33E95D07, 0xC40C78BE, 0x1C1E1F6D,
+   0x222FF8E2, 0x967833EF, 0xB49180AD, 0x4BEDCF6A,
+   0x3D7A4C8A, 0x6B37E9C1, 0x6DDFE760, 0x2748887C,
+   0xAA3A5BBC, 0xF7055123, 0x7BBB8E74, 0x954FF225,
+   0x6D3FEA55, 0x4E23CA44, 0xF4810568, 0xB4AE9C86,
+   0x2A62F27D, 0x47BFB91B, 0xD9BAC28C, 0x60DEB4C9,
+   0x7DE6C34C, 0xA892D894, 0x4494587D, 0x4EE68259,
+   0x1A3F8A5B, 0x914EE14E, 0x28700385, 0xBB113EAA,
+   0xA7B56EAF, 0xEF9DC899, 0x34EF7316, 0x00C0E52C,
+   0xFE818A86, 0x5B1E4E24, 0xC538BE47, 0x9D31E20D,
+   0x3ED68974, 0x22EB932D, 0x7C4E87C4, 0xE44BBC08,
+   0x0DDE9AEF, 0x4121086E, 0x134F4345, 0x8E6B9CFF,
+   //Window 29
+   0x711B0EB9, 0x96892C1F, 0x780AB954, 0xB905F2C8,
+   0xA20792DB, 0xACE26309, 0x0684E126, 0xEC8AC9B3,
+   0xB40A2447, 0x486AD8B6, 0x9FE3FB24, 0x60121FC1,
+   0x1A8E3B3F, 0x5626FCCF, 0x6AD1F394, 0x4E568622,
+   0x6ADD8545, 0xE5DB7717, 0x72C49B66, 0x1B71CB66,
+   0x68421D77, 0xD8560739, 0x83E3AFEA, 0x03840FE8,
+   0x1EC69977, 0xB391DAD5, 0x307F6726, 0xAE243FB9,
+   0xE8CA160C, 0xC88AC87B, 0x4CE355F4, 0x5174CCED,
+   0x95FE1347, 0x5EE6AB84, 0x6F24503C, 0xAB0F6C39,
+   0x4486DD6B, 0x807E3FFB, 0x8002FEF5, 0xF00B6C74,
+   0xA7862999, 0x48BFF9A6, 0xBED89E26, 0x85E5A06C,
+   0x3D8419EB, 0x86D311AF, 0x34733F16, 0x24F3AD78,
+   0x2BCFFBC4, 0x53376D28, 0x06EADB7A, 0x708817A7,
+   0xCD35AE69, 0x6FF50E05, 0x74BC7FDE, 0x63B5FB75,
+   0xE7FE08C4, 0x71C9E953, 0xF583CA18, 0xB4D8BFD4,
+   0x45E81C5C, 0xDE8D7882, 0xE0474138, 0xA5F5E93C,
+   0xAC7DAF05, 0xDED5C7AC, 0x932F7A24, 0x0F06F5ED,
+   0x53CE3505, 0x8DD86E20, 0x3CF6F7E6, 0xFDBBB2F8,
+   0xC9228C12, 0xF4018A7F, 0x751C80AB, 0x5A0EF8D3,
+   0x4B7158E8, 0x36DA1937, 0x0D78C85F, 0x3CCCF44C,
+   0xFC35268D, 0x7F47170A, 0xC98F8F7F, 0x9C105144,
+   0x9B7613B6, 0xD442194E, 0x5879A926, 0xAAC8A280,
+   0x0C2A78F6, 0x51F747BC, 0x63FAEF51, 0x25445AAE,
+   0x3CEEEC1C, 0x4BEA10E3, 0x24E08901, 0x12CABF72,
+   0x966D43C1, 0xFC0B644B, 0xBC5BF66B, 0xCE99BACE,
+   0xB79BAEA8, 0x5E3E4F85, 0x45F11FDB, 0xD1D7C937,
+   0x848068CE, 0xA3B91DCB, 0xB9D4F188, 0x7E28DCF1,
+   0x6D908259, 0x08685BF5, 0xE8176D08, 0xCCC57953,
+   0x520B4F40, 0xDCD84242, 0x4CA3BB47, 0x2746ABDB,
+   0x2924F364, 0x58BFAD84, 0xBB2E5F6A, 0x11336313,
+   0x1CDF04DC, 0x3EB7FD11, 0x0A2576C6, 0x8551F549,
+   0x6C073A2C, 0xC6550F97, 0x22B466DF, 0xE0892E18,
+   //Window 30
+   0xD111F8EC, 0x3E0E5C9D, 0xB7C4E760, 0xBCC33F8D,
+   0xBD392A51, 0x702F9A91, 0xC132E92D, 0x7DA4A795,
+   0x0BB1151B, 0x1A0B0AE3, 0x02E32251, 0x54FEBAC8,
+   0x694E9E78, 0xEA3A5082, 0xE4FE40B8, 0xE58FFEC1,
+   0x516E19E4, 0x7B23C513, 0xC5C4D593, 0x56E2E847,
+   0x5CE71EF6, 0x9F727D73, 0xF79A44C5, 0x5B6304A6,
+   0x3AB7E433, 0x6638A736, 0xFE742F83, 0x1ADEA470,
+   0x5B7FC19F, 0xE054B854, 0xBA1D0698, 0xF935381A,
+   0x5846426F, 0x55366B7D, 0x247D441D, 0xE7D09E89,
+   0x736FBF48, 0x510B404D, 0xE784BD7D, 0x7FA003D0,
+   0x17FD9596, 0x25F7614F, 0x35CB98DB, 0x49E0E0A1,
+   0x2E83A76A, 0x2C65957B, 0xCDDBE0F8, 0x5D40DA8D,
+   0x54530BB2, 0x9FB3BBA3, 0xCB0869EA, 0xBDE3EF77,
+   0x0B431163, 0x89BC9046, 0xE4819A35, 0x4D03D7D2,
+   0x43B6A782, 0x33AE4F9E, 0x9C88A686, 0x216DB307,
+   0x00FFEDD9, 0x91DD88E0, 0x12BD4840, 0xB280DA9F,
+   0xF37F5937, 0xA37F3573, 0xD1E4FCA5, 0xEB0F6C7D,
+   0xAC8AB0FC, 0x2965A554, 0x274676AC, 0x17FBF56C,
+   0xACF7D720, 0x2E2F6BD9, 0x10224766, 0x41FC8F88,
+   0x85D53BEF, 0x517A14B3, 0x7D76A7D1, 0xDAE327A5,
+   0x94D7D9B1, 0x43C41AC1, 0xC82E7F17, 0x5BAFDD82,
+   0x5FDA0FCA, 0xDF0614C1, 0xA8AE37AD, 0x74B043A7,
+   0x9E71734C, 0x3BA6AFA1, 0x9C450F2E, 0x15D5437E,
+   0x67E242B1, 0x4A5883FE, 0x2C1953C2, 0x5143BDC2,
+   0xB1F3390B, 0xC676D7F2, 0xA5B61272, 0x9F7A1B8C,
+   0xC2E127A9, 0x4EBEBFC9, 0x5DD997BF, 0x4602500C,
+   0x4711230F, 0x7F09771C, 0x020F09C1, 0x058EB37C,
+   0xFEE5E38B, 0xAB693D4B, 0x4653CBC0, 0x9289EB1F,
+   0xAB952578, 0x54DA9DC7, 0x26E84D0B, 0xB5423DF2,
+   0x9B872042, 0xA8B64EEB, 0x5990F6DF, 0xAC205782,
+   0x21F4C77A, 0x4FF696EB, 0xAAB273AF, 0x1A79C3E4,
+   0x9436B3F1, 0x29BC922E, 0xD6D9A27A, 0xFF807EF8,
+   //Window 31
+   0x33F6746C, 0xC7F3A8F8, 0xFEA990CA, 0x21E46F65,
+   0xCADDB0A9, 0x915FD5C5, 0x78614555, 0xBD41F016,
+   0x426FFB58, 0x346F4434, 0x14DBC204, 0x80559436,
+   0x5A969B7F, 0xF3DD20FE, 0xE899A39A, 0x9D59E956,
+   0x775D6ECE, 0xEF4F115C, 0xE8C0E78D, 0x69D2E3BB,
+   0x145CFC81, 0xB0264EF1, 0x1B69788B, 0x0A41E9FA,
+   0x909A1F0B, 0x0D9233BE, 0x0AE76B30, 0x150A8452,
+   0x0632BB69, 0xEA337537, 0xAA25584A, 0x15F7B3CF,
+   0x1339609A, 0x6EB4A914, 0x3E37EABD, 0x2B627DEE,
+   0x728C8D9C, 0xEA4083D1, 0x518F21E4, 0xE70814D4,
+   0x17398D14, 0x4CB05B57, 0x8003F6C9, 0x9D37D255,
+   0x60829275, 0x70577AF7, 0xC67D7E4F, 0xCB4A9A9A,
+   0xD13FB27D, 0xC20F05F7, 0x6C7195C0, 0xC05B30D3,
+   0x32FC56C5, 0xA335CF18, 0x62B3A82B, 0xAE65BCD3,
+   0x630D99EA, 0xCBF6AAB8, 0xE62CEC6C, 0x164BE816,
+   0x2FEED2F1, 0x6D41819D, 0x0B91BD0D, 0xFCDC5907,
+   0x60D9B5D0, 0x247D7B0C, 0x128F2E7B, 0x584EB583,
+   0x2EB389C7, 0xFF6A7478, 0x00B50A34, 0x2559F534,
+   0x5F5A25B8, 0x46D85D48, 0x870405DB, 0x1214F8AF,
+   0x9777AB35, 0xA409ECFD, 0x9C22CF23, 0xE1359999,
+   0xE0D59FC2, 0x7A839912, 0x422A3A39, 0x974B95B2,
+   0x7F5E74E0, 0xD8FBBA38, 0x6712705A, 0x04E52F93,
+   0x518103C9, 0x43595FC7, 0x54D6EB40, 0x28E137B3,
+   0x377B326C, 0x63FAD7F3, 0xBBFF6D03, 0xA644ACA4,
+   0x270F77D9, 0x42A745EA, 0xE2A23D1A, 0xBA79E329,
+   0x58D32463, 0xA9473FFF, 0x66C91DCD, 0x1E0373E2,
+   0x61A42E3E, 0x3A325E4D, 0xBD463698, 0x777F29B5,
+   0x9305FB68, 0x83A44919, 0x393D5D10, 0xABF9BE4F,
+   0x2CB58BC7, 0x56E7CDD4, 0x1B791CE5, 0xB08493E0,
+   0x0FB3A0E3, 0x4CB1D099, 0x8301A296, 0x763DEC84,
+   0xCA82A865, 0x323621D2, 0xAC78E631, 0xC29129CA,
+   0xAD38E5B9, 0xD98A8CCC, 0x95352DD7, 0xA65DC522,
+   //Window 32
+   0xBFE20925, 0x62A8C244, 0x8FDCE867, 0x91C19AC3,
+   0xDD387063, 0x5A96A5D5, 0x21D324F6, 0x61D587D4,
+   0xA37173EA, 0xE87673A2, 0x53778B65, 0x23848008,
+   0x05BAB43E, 0x10F8441E, 0x4621EFBE, 0xFA11FE12,
+   0xB2335834, 0xC0F734A3, 0x90EF6860, 0x9526205A,
+   0x04E2BB0D, 0xCB8BE717, 0x02F383FA, 0x2418871E,
+   0x4082C157, 0xD7177681, 0x29C20073, 0xCC914AD0,
+   0xE587E728, 0xF186C1EB, 0x61BCD5FD, 0x6FDB3C22,
+   0x2CF9D7C1, 0xCC7C4C1C, 0xEE95E5AB, 0x1320886A,
+   0xBEAE170C, 0xBB7B9056, 0xDBC0D662, 0xC8A5B250,
+   0xC11D2303, 0x4ED81432, 0x1F03769F, 0x7DA66912,
+   0x84539828, 0x3AC7A5FD, 0x3BCCDD02, 0x14DADA94,
+   0xCBAE2F70, 0x51B90651, 0x93AAA8EB, 0xEFC4BC05,
+   0xDD1DF499, 0x8ECD8689, 0x22F367A5, 0x1AEE99A8,
+   0xAE8274C5, 0x95D485B9, 0x7D30B39C, 0x6C14D445,
+   0xBCC1EF81, 0xBAFEA90B, 0xA459A2ED, 0x7C5F317A,
+   0x0DEEAF52, 0x410DC6A9, 0x4C641C15, 0xB003FB02,
+   0x5BC504C4, 0x1384978C, 0x864A6A77, 0x37640487,
+   0x222A77DA, 0x05991BC6, 0x5E47EB11, 0x62260A57,
+   0xF21B432C, 0xC7AF6613, 0xAB4953E9, 0x22F3ACC9,
+   0x0C24EFC8, 0x0D094277, 0xBEF737A4, 0x0349FD04,
+   0x514CDD28, 0x6D1C9DD2, 0x30DA9521, 0x29C135FF,
+   0xF78B0B6F, 0xEA6E4508, 0x678C143C, 0x176F5DD2,
+   0x4BE21E65, 0x08148418, 0xE7DF38C4, 0x27F7525C,
+   0xE4652F1D, 0x9FAACCF5, 0xD56157B2, 0xBD6FDD2A,
+   0x6261EC50, 0xA4F4FB1F, 0x476BCD52, 0x244E55AD,
+   0x047D320B, 0x881C9305, 0x6181263F, 0x1CA983D5,
+   0x278FB8EE, 0x354E9A44, 0x396E4964, 0xAD2DBC0F,
+   0x88A2FFE4, 0xFCE01767, 0x28E169A5, 0xDC506A35,
+   0x7AF9C93A, 0x0EA10861, 0x03FA0E08, 0x1ED24361,
+   0xA3D694E7, 0x96EAAA92, 0xEF50BC74, 0xC0F43B4D,
+   0x64114DB4, 0xCE6AA58C, 0x7C000FD4, 0x8218E8EA,
+   //Window 33
+   0xE48FB889, 0x6A7091C2, 0x7B8A9D06, 0x26882C13,
+   0x1B82A0E2, 0xA2498663, 0x3518152D, 0x844ED736,
+   0xD86E27C7, 0x282F476F, 0x04AFEFDC, 0xA04EDACA,
+   0x6119E34D, 0x8B256EBC, 0x0787D78B, 0x56A413E9,
+   0x4D559D96, 0x38151E27, 0xB8DB6C01, 0x4F18C0D3,
+   0x6F9921AF, 0x49A3AA83, 0x8C046029, 0xDBEAB27B,
+   0x7040BF3B, 0x242B9EAA, 0x1614B091, 0x39C479E5,
+   0x0E4BAF5D, 0x338EDE2B, 0xF0A53945, 0x5BB192B7,
+   0xEC5D7F65, 0x7D89C251, 0x90394087, 0x0C8F5616,
+   0xF0691AB3, 0x609E1CFC, 0xE9B20B21, 0x2A0300BF,
+   0xB114FAF4, 0xBF532FAD, 0x521BF5D1, 0x328FC0B9,
+   0x3BFC36DE, 0xBD51F93C, 0x7A4E5F60, 0xD989050E,
+   0xE7E0C278, 0x6786BA38, 0x588B2E6F, 0x09BF87CE,
+   0x465FEE3A, 0x723B7022, 0x64682394, 0x08B84114,
+   0x29E64629, 0x0EB52CE0, 0xCCA78E43, 0xADB60E8F,
+   0xB654A991, 0x20DD7062, 0xC69A6FE5, 0x4281D428,
+   0xC01E2EE1, 0x5C257CA3, 0x27C36961, 0x1FB43A14,
+   0x3472F324, 0xD594A7CB, 0x660ABE10, 0xC15EC024,
+   0x6B614CED, 0xB176D449, 0x62DBB885, 0x0B04734D,
+   0x36DDB587, 0x2CB753C6, 0x14CD340C, 0x9A1C80E6,
+   0xC06FE7CD, 0xE9F65696, 0x9AFD3A15, 0x51063057,
+   0x185360ED, 0x3DCDACA6, 0xC1853D2F, 0x2741703D,
+   0x1A33F1A0, 0xBD8AD84A, 0xC35CB07C, 0x5F6C698C,
+   0x6561E6B9, 0x212BD119, 0x617B4FD7, 0xF149CD7E,
+   0x30E82BF8, 0x1CE3C9C5, 0x0DBB772A, 0x4D662542,
+   0xD9C17214, 0x19E25A60, 0x7722FA55, 0x13BCF84C,
+   0xF89EF7A7, 0x228ACA0E, 0xFD3ED455, 0x03D64E2F,
+   0xDDE6C904, 0xF1C390F5, 0x7678E18A, 0x731452A6,
+   0xA0632CBA, 0x3C006E61, 0x45B35CCD, 0x920D9248,
+   0x7C5C7F65, 0x4B3379FB, 0xB05E050B, 0x526CDF10,
+   0xD21BF1AE, 0x3188E936, 0x624BBD2F, 0xB3E07B39,
+   0x1367A541, 0x7B9BFCF3, 0x8A367927, 0x039F8EC8,
+   //Window 34
+   0x846E364F, 0xC16C236E, 0xDEA50CA0, 0x7F33527C,
+   0x0926B86D, 0xC4810775, 0x0598E70C, 0x6C2A3609,
+   0xF024E924, 0xA6755E52, 0x9DB4AFCA, 0xE0FA07A4,
+   0x66831790, 0x15C3CE7D, 0xA6CBB0D6, 0x5B4EF350,
+   0xA9D82ABF, 0xE2A37598, 0xE6C170F5, 0x5F188CCB,
+   0x5066B087, 0x81682200, 0xC7155ADA, 0xDA22C212,
+   0xFBDDB479, 0x151E5D3A, 0x6D715B99, 0x4B606B84,
+   0xF997CB2E, 0x4A73B54B, 0x3ECD8B66, 0x9A1BFE43,
+   0x1430C9AB, 0x5AFDDAB6, 0x2238E997, 0x0BDD41D3,
+   0x418042AE, 0xF0947430, 0xCDDDC4CB, 0x71F9ADDA,
+   0xC52DD907, 0x7090C016, 0x29E2047F, 0xD9BDF44D,
+   0x1B1011A6, 0xE6F1FE80, 0xD9ACDC78, 0xB63ACCBC,
+   0xC0B7EFF3, 0x0AD7337A, 0xC5E48B3C, 0x8552225E,
+   0x73F13A5F, 0xE6F78B0C, 0x82349CBE, 0x5E70062E,
+   0xE7073969, 0x6B8D5048, 0xC33CB3D2, 0x392D2A29,
+   0x4ECAA20F, 0xEE4F727C, 0x2CCDE707, 0xA068C99E,
+   0x1B3EC67B, 0x5B826FCB, 0x41356616, 0xECE1B4B0,
+   0x56A3AB4F, 0x7D5CE77E, 0xAA212DA0, 0xF6087F13,
+   0x4DB92129, 0xE6301505, 0x40407D11, 0xB8AE4C99,
+   0xDFAB8385, 0x2B6DE222, 0xB7D6C3B4, 0x9B323022,
+   0xA5660AF3, 0x60684B69, 0x9066D14B, 0x69AAD23B,
+   0xFA4D020A, 0x4D9F9B49, 0xB5CD6A4A, 0xAFB54EC1,
+   0x32FD864D, 0x2B25FE18, 0x2B6B64D0, 0xEE694506,
+   0x5001D8AA, 0x954A2A51, 0x7082B5B3, 0x5E100855,
+   0xBC90EB1B, 0x20ECF71C, 0x651C1DF4, 0x4234FACF,
+   0xE681F678, 0xC720FCE9, 0xA7C007F4, 0x680BECDD,
+   0x3181AFEA, 0x7C08DC06, 0xA34ECA91, 0x75C1B050,
+   0x4B9E2333, 0x7D3479D5, 0xF3951AA3, 0xED16640A,
+   0x64723E54, 0x911B5962, 0x004B327C, 0x34384F8C,
+   0xB85435F2, 0x06CA5C61, 0xE2C1075C, 0x12E0CD25,
+   0xAC727394, 0xA4B84CB8, 0x92B352C1, 0x50BD7204,
+   0x9CBD0FB4, 0xE85524A4, 0xE7876024, 0x10B9274B,
+   //Window 35
+   0xFA181E69, 0xEF0A3FEC, 0x30D69A98, 0x9EA02F81,
+   0x66EAB95D, 0xB2E9CF8E, 0x24720021, 0x520F2BEB,
+   0x1DF84361, 0x621C540A, 0x71FA6D5D, 0x12037721,
+   0x0FF5F6FF, 0x6E3C7B51, 0xABB2BEF3, 0x817A069B,
+   0x89E800CA, 0x8A10B531, 0x145208FD, 0x50FE0C17,
+   0xB714BA37, 0x9E43C0D3, 0x34189ACC, 0x427D200E,
+   0xE616E2C0, 0x05DEE24F, 0xEE1854C1, 0x9C25F4C8,
+   0x8F342A73, 0x4D3222A5, 0xA027C952, 0x0807804F,
+   0xB809B7CE, 0x22C49EC9, 0xE2C72C2C, 0x8A41486B,
+   0xFEA0BF36, 0x813B9420, 0xA66DAC69, 0xB3D36EE9,
+   0x328CC987, 0x6FDDC08A, 0x3A326461, 0x0A3BCD2C,
+   0xD810DBBA, 0x7103C49D, 0x4B78A4C4, 0xF9D81A28,
+   0xB98FE684, 0x501D070C, 0x124A1458, 0xD60FBE9A,
+   0x92BC6B3F, 0xA45761C8, 0xFE6F27CB, 0xF5384858,
+   0xB59E763B, 0x4B0271F7, 0x5B5A8E5E, 0x3D4606A9,
+   0x05A48292, 0x1EDA5D9B, 0xE6FEC446, 0xDA7731D0,
+   0x95CAABEE, 0x70469B82, 0x889501E3, 0xDE024CA5,
+   0x076ED265, 0x6BDADC06, 0x5A0EF8B2, 0x0CB1236B,
+   0x0972EBF9, 0x4065DDBF, 0x22ACA432, 0xF1DD3875,
+   0x744AFF76, 0xA88B97CF, 0xFE8E3D24, 0xD1359AFD,
+   0x2F93A675, 0xE8815FF6, 0x05F48679, 0xA6EC9684,
+   0x358AE884, 0x6DCBB556, 0xE19E3873, 0x0AF61472,
+   0xA5F696BE, 0x72334372, 0x6F22FB70, 0xC65E57EA,
+   0x946CEA90, 0x268DA30C, 0x65681B2A, 0x136A8A87,
+   0x93A3147A, 0x1192D9D4, 0x9A565545, 0x9F30A5DC,
+   0x6EF07212, 0x90B1F9CB, 0x0D87FC13, 0x29958546,
+   0xC17DB9BA, 0xD3323EFF, 0xCB1644A8, 0xCB18548C,
+   0x4F49FFBC, 0x18A306D4, 0x4C2E8684, 0x28D658F1,
+   0x8C3BFF36, 0x83CCBE80, 0x5263E575, 0x005A0BD2,
+   0x259BDCD1, 0x460D7DDA, 0xFA5CAB6B, 0x4A1C5642,
+   0x9FE4FC88, 0x2B7BDBB9, 0xCC97BBB5, 0x09418E28,
+   0xA12321AE, 0xD8274FB4, 0x5C87B64E, 0xB137007D,
+   //Window 36
+   0xC63C4962, 0x80531FE1, 0x981FDB25, 0x50541E89,
+   0xFD4C2B6B, 0xDC1291A1, 0xA6DF4FCA, 0xC0693A17,
+   0x0117F203, 0xB2C4604E, 0x0A99B8D0, 0x245F1963,
+   0xC6212C44, 0xAEDC20AA, 0x520F52A8, 0xB1ED4E56,
+   0x6BDF22DA, 0x18F37A9C, 0x90DC82DF, 0xEFBC432F,
+   0x5D703651, 0xC52CEF8E, 0xD99881A5, 0x82887BA0,
+   0xB920EC1D, 0x7CEC9DDA, 0xEC3E8D3B, 0xD0D7E8C3,
+   0x4CA88747, 0x445BC395, 0x9FD53535, 0xEDEAA2E0,
+   0x296C9005, 0xB7D4CC0F, 0x7B0AEBDB, 0x4B9094FA,
+   0xC00EC8D4, 0xE1BF10F1, 0xD667C101, 0xD807B1C4,
+   0xBE713383, 0xA9412CDF, 0x81142BA1, 0x435E063E,
+   0xAF0A6BDC, 0x984C15EC, 0x92A3DAB9, 0x592C2460,
+   0x16E23E9D, 0x93656900, 0xA7CC41E1, 0xCB220C6B,
+   0x69D6245C, 0xB36B20C3, 0xB62E9A6A, 0x2D63C348,
+   0xCDC0BCB5, 0xA3473E19, 0x8F601B98, 0x70F18B3F,
+   0xCDE346E4, 0x8AD7A2C7, 0xBD3AAA64, 0xAE9F6EC3,
+   0x3274C7E1, 0x03022350, 0x4C4B6C26, 0x61EE8C93,
+   0x199389CE, 0x3C4397E3, 0x488757CE, 0xE0082600,
+   0x06B4DAFB, 0xAAC3A2DF, 0xDDFF5B6A, 0x45AF0700,
+   0x8C1D9FA0, 0x0A597424, 0x391FC68B, 0x1640087D,
+   0x4E5548BD, 0xF4873FCF, 0x03CE57F0, 0x8725DA3F,
+   0xCA953258, 0xD82F5C95, 0x7CF0747E, 0xAC647F12,
+   0x2D570BD5, 0xFF2038B0, 0xA13AE03F, 0xB0C2A767,
+   0xE9932D16, 0xEBAA27CD, 0x1234E901, 0xA686E3FC,
+   0x63261ECC, 0x9F80435E, 0x4337D6C9, 0x6302A62E,
+   0xCA4958A0, 0x91916A49, 0x3149D5D3, 0x55495899,
+   0x9F91DE3C, 0x378D020B, 0x4DD25170, 0x47B839A3,
+   0x38B7F258, 0x28258541, 0x437E7DEC, 0xEA5B14F7,
+   0xB0018F44, 0x74F08736, 0xB446D0F5, 0xF4A03417,
+   0xA40CA6B2, 0x66A4AA2F, 0xBADB60ED, 0x215679F0,
+   0x323E4EEF, 0x3871195A, 0x20952B16, 0x8F0940C3,
+   0x879D5F7D, 0xFE8DAC62, 0xC1A6E875, 0x649CB623,
+   //Window 37
+   0x338D6E43, 0xECAFF541, 0x4541D5CC, 0x56F7DD73,
+   0x96BC88CA, 0xB5D426DE, 0x9ED3A2C3, 0x48D94F6B,
+   0x2EF8279C, 0x6354A3BB, 0x0B1867F2, 0xD575465B,
+   0x95225151, 0xEF99B0FF, 0xF94500D8, 0xF3E19D88,
+   0xB71698F5, 0x7807F364, 0x9F7B605E, 0x6BA418D2,
+   0xA03B2CBB, 0xFD20B00F, 0xDA54386F, 0x883ECA37,
+   0xF3437F24, 0xFF0BE43F, 0xA48BB33C, 0xE910B432,
+   0x329DF765, 0x4963A128, 0xBE2FE6F7, 0xAC1DD556,
+   0xF405FF06, 0x1C30861C, 0x486E828B, 0xEBAC86BD,
+   0x636933FC, 0xE791A971, 0x7AEEE947, 0x50E7C2BE,
+   0xFA90D767, 0xC3D4A095, 0xE670AB7B, 0xAE60EB7B,
+   0x397B056D, 0x17633A64, 0x105012AA, 0x93A21F33,
+   0x22CAF46B, 0x5936E460, 0x9A96FE4F, 0x6A45DD8F,
+   0xB98F474E, 0xF7925434, 0x0053EF15, 0x41410412,
+   0x41DE97BF, 0x71CF8D12, 0xBD80BEF4, 0xB8547B61,
+   0xC4DB0037, 0xB47D3970, 0xFEF20DFF, 0xF1BCD328,
+   0xBDBCF0CA, 0xD981B888, 0xDF279E9F, 0xD75F5DA6,
+   0x7054E934, 0x128BBF24, 0x81DB134B, 0x3C6FF6E5,
+   0x047D26E4, 0x795B7CF4, 0x5049EC37, 0xF370F7B8,
+   0xCED945AF, 0xC6712D4D, 0x095642BC, 0xDF30B5EC,
+   0x9C438EDF, 0xFCDFEA49, 0x91EDBA44, 0x7678DCC3,
+   0xE2BA50F0, 0xF07B3B87, 0x43948C1B, 0xC13888EF,
+   0x1140AF42, 0xC2135AD4, 0x926ED1A7, 0x8E5104F3,
+   0x88F6695F, 0xF24430CB, 0x6D73C120, 0x0CE0637B,
+   0x7FAFA4C8, 0x345913D3, 0x0491AAC0, 0x3D918082,
+   0x3E69264C, 0x9347871F, 0xB4F4F0CD, 0xBEA9DD3C,
+   0x3EADD3E7, 0xBDA5D067, 0x0573BCD8, 0x0033C1B8,
+   0x5DA2486C, 0x25589379, 0x86ABBEE7, 0xCB89EE5B,
+   0x8776E667, 0x74145256, 0xB23C6BB5, 0x6E76142C,
+   0x1B3A8A87, 0xDBF30712, 0x98450836, 0x60E7363E,
+   0xB7366D80, 0x5741450E, 0x4837DBDF, 0xE4EE14CA,
+   0x69D4316F, 0xA765EB9B, 0x8EF43825, 0x04548DCA,
+   //Window 38
+   0x7189E71F, 0x32670D2F, 0x5ECF91E7, 0xC6438748,
+   0xDB757A21, 0x15758E57, 0x290A9CE5, 0x427D09F8,
+   0x38384A7A, 0x846A308F, 0xB0732B99, 0xAAC3ACB4,
+   0x17845819, 0x9E941009, 0xA7CE5E03, 0x95CBA111,
+   0xA105FC8E, 0x37A01E48, 0x289BA48C, 0x769D754A,
+   0xD51C2180, 0xC08C6FE1, 0xB7BD1387, 0xB032DD33,
+   0x020B0AA6, 0x953826DB, 0x0664C73C, 0x05137E80,
+   0x660CF95D, 0xC66302C4, 0xB2CEF28A, 0x99004E11,
+   0x96EA6CA1, 0x1013E4F7, 0x1F792871, 0x567CDC2A,
+   0x5C658D45, 0xADB72870, 0xCE600E98, 0xF7C1FF4A,
+   0x4B6CAD39, 0xA1BA8657, 0xBA20B428, 0x3D58D634,
+   0xA2E6FDFB, 0xC0011CDE, 0x7B18960D, 0xA832367A,
+   0xF416448D, 0x1ECC032A, 0xEC76D971, 0x4A7E8C10,
+   0xB90B6EAE, 0x854F9805, 0x4BED0594, 0xFD0B1532,
+   0xD98B5CA3, 0x89F71848, 0xF039B3EF, 0xD01FE5FC,
+   0x627BDA2E, 0x4481332E, 0xA5073E41, 0xE67CECD7,
+   0x4595A859, 0x2AB0BCE9, 0x82084EE7, 0x4D8C2DA0,
+   0xACCA3D3C, 0x21FF8BE5, 0x7827F633, 0xD8B80533,
+   0x6BECABBF, 0xF74E8C02, 0xFEDE4828, 0x9FAE4DBE,
+   0x3CC46BCF, 0xD3885A5B, 0x6E6AD144, 0x2D535E2B,
+   0x07605B28, 0x3AA1974F, 0x1E296255, 0x4F3D82A7,
+   0xB4E23F16, 0xBBE5EA03, 0x4E654193, 0x8F5C6C6B,
+   0xD3E8AB01, 0x27181182, 0xF3BA6BC2, 0xC68BB231,
+   0x20AF1FD7, 0x90A244D8, 0x5B713F4F, 0x605ABC05,
+   0xD221991A, 0xCA5FE19B, 0xF05F400E, 0x271FF066,
+   0x9CF09896, 0x9D46EC4C, 0xEC4FEBC3, 0xDCAA8DFD,
+   0xADF19D04, 0xAA3995A0, 0x9DA573A6, 0xC9863423,
+   0xF2465B2B, 0x378058B2, 0xB4C31612, 0x20D389F9,
+   0xB7631C9D, 0xD7D199C7, 0xBB123942, 0x1322C2B8,
+   0xBE8B6848, 0xE662B68F, 0xCDE99B14, 0xC970FAF2,
+   0xB06655E5, 0x61B27134, 0x81365D89, 0xADCEF8F7,
+   0x21B851AA, 0x917B5AB5, 0x1CF694A7, 0x4F447212,
+   //Window 39
+   0xCA8D9D1A, 0x488F1185, 0xD987DED2, 0xADF2C77D,
+   0x60C46124, 0x5F3039F0, 0x71E095F4, 0xE5D70B75,
+   0x6260E70F, 0x82D58650, 0xF750D105, 0x39D75EA7,
+   0x75BAC364, 0x8CF3D0B1, 0x21D01329, 0xF3A7564D,
+   0xE7417CE1, 0x242792D2, 0x970EE7F5, 0xFF42BC71,
+   0x5C67A41E, 0x1FF4DC6D, 0x20882A58, 0x77709B7B,
+   0xBE217F2C, 0x3554731D, 0x5BB72177, 0x2AF2A8CD,
+   0x591DD059, 0x58EEE769, 0x4BBA6477, 0xBB2930C9,
+   0xAF71013F, 0x6AF7A1D5, 0x0BEDC946, 0xE68216E5,
+   0xD27370A0, 0xF4CBA30B, 0x870421CC, 0x7981AFBF,
+   0x9449F0E1, 0x02496A67, 0x0A47EDAE, 0x86CFC4BE,
+   0xB1FECA22, 0x3073C936, 0x03F8F8FB, 0xF5694612,
+   0x9890272D, 0xCF3DE995, 0x3E713A10, 0x75F3432A,
+   0xE28227B8, 0x5E13479F, 0xFEFACDC8, 0xB8561EA9,
+   0x8332AAFD, 0xA6A297A0, 0x73809B62, 0x9B0D8BB5,
+   0x0C63036F, 0xD2FA1CFD, 0xBD64BDA8, 0x7A16EB55,
+   0x306A5A3B, 0xA40BC039, 0x96783A1B, 0x4E0A41FD,
+   0x0253CDD4, 0xA1E8D39A, 0xC7388638, 0x6480BE26,
+   0x2285F382, 0xEE365E1D, 0xEC0B5C36, 0x188D8D8F,
+   0x1F0F4D82, 0x34EF1A48, 0xA487D29A, 0x1A8F43E1,
+   0x9BB26F5F, 0x10F6A333, 0x044D85B6, 0x1E85DB8E,
+   0x94197E54, 0xC3697A08, 0xA7CB4EA8, 0x65E18CC0,
+   0xA471FE6E, 0xA38C4F50, 0x2F13439C, 0xF031747A,
+   0xC007318B, 0x53C4A6BA, 0x1DECCB3D, 0xA8DA3EE5,
+   0x3E554892, 0x5F24416D, 0x430E2A45, 0x8413B53D,
+   0x9032A2A0, 0x99C56AEE, 0xEEC367B1, 0x09432BF6,
+   0xDAF0ECC1, 0x552850C6, 0x5BC92048, 0x49EBCE55,
+   0x54811307, 0xDFB66BA6, 0x6F298597, 0x1B84F797,
+   0x5777E189, 0xA1A5C845, 0x456F2829, 0xCC10BEE0,
+   0xDA762BD5, 0x8AD95C56, 0xE9D91DA8, 0x152E2214,
+   0x7CB23C74, 0x975B0E72, 0xA90C66DF, 0xFD5D7670,
+   0x225FFC53, 0xB5B5B8AD, 0xFADED2AE, 0xAB6DFF73,
+   //Window 40
+   0x6D3549CF, 0xD433E50F, 0xFACD665E, 0x6F33696F,
+   0xCE11FCB4, 0x695BFDAC, 0xAF7C9860, 0x810EE252,
+   0x7159BB2C, 0x65450FE1, 0x758B357B, 0xF7DFBEBE,
+   0xD69FEA72, 0x2B057E74, 0x92731745, 0xD485717A,
+   0xB898FD52, 0x6C8D0AA9, 0xBE9AF1A7, 0x2FB38A57,
+   0x3B4F03F8, 0xE1F2B9A9, 0xC3F0CC6F, 0x2B1AAD44,
+   0x7CF2C084, 0x58B5332E, 0x0367D26D, 0x1C57D96F,
+   0xFA6E4A8D, 0x2297EABD, 0x4A0E2B6A, 0x65A947EE,
+   0xFDD5B854, 0xF535B616, 0x5728719F, 0x592549C8,
+   0x06921CAD, 0xE2314686, 0x311B1EF8, 0x98C8CE34,
+   0xE9090B36, 0x28B937E7, 0x0BF7BBB7, 0x67FC3AB9,
+   0xA9D87974, 0x12337097, 0xF970E3FE, 0x3E5ADCA1,
+   0xB3F85FF0, 0xCDCC68A7, 0x1A888044, 0xACD21CDD,
+   0x05DBE894, 0xB6719B2E, 0x8B8260D4, 0xFAE1D3D8,
+   0x8A1C5D92, 0xEDFEDECE, 0xDC52077E, 0xBCA01A94,
+   0x16DD13ED, 0xC085549C, 0x495EBAAD, 0xDC5C3BAE,
+   0xBE7B643A, 0xCC17063F, 0x46085760, 0x7872E1C8,
+   0xB4214C9E, 0x86B0FFFB, 0x72BF3638, 0xB18BBC0E,
+   0x722591C9, 0x8B17DE0C, 0x48C29E0C, 0x1EDEAB19,
+   0xF4304F20, 0x9FBFD98E, 0x9C77FFB6, 0x2D1DBB6B,
+   0xC7141771, 0x255616D3, 0x2F226B66, 0xA86691AB,
+   0xB3CA63A9, 0xDA19FEA4, 0xAE672F2B, 0xFC05DC42,
+   0x718BA28F, 0xA9C6E786, 0x9C66B984, 0x07B7995B,
+   0x1B3702F2, 0x0F434F55, 0xDA84EEFF, 0xD6F6212F,
+   0xB5B41D78, 0x4B0E7987, 0x4BF0C4F8, 0xEA7DF907,
+   0xFAB80ECD, 0xB4D03560, 0xFB1DB7E5, 0x6CF306F6,
+   0x89FD4773, 0x0D59FB56, 0x00F9BE33, 0xAB254F40,
+   0x77352DA4, 0x18A09A92, 0x641EA3EF, 0xF81862F5,
+   0x9F759D01, 0xB59B0157, 0x7EAE4FDE, 0xA2923D2F,
+   0x690BA8C0, 0x18327757, 0x44F51443, 0x4BF7E38B,
+   0xB413FC26, 0xB6812563, 0x79E53B36, 0xEDB7D363,
+   0xC389F66D, 0x4FA585C4, 0x54BD3416, 0x8E1ADC31,
+   //Window 41
+   0x1402B9D0, 0xD3B3A13F, 0x2C7BC863, 0x573441C3,
+   0x578C3E6E, 0x4B301EC4, 0x0ADAF57E, 0xC26FC9C4,
+   0x7493CEA3, 0x96E71BFD, 0x1AF81456, 0xD05D4B3F,
+   0x6A8C608F, 0xDACA2A8A, 0x0725B276, 0x53EF07F6,
+   0x526F09FD, 0x057FED45, 0x8128240A, 0xE8A4F10C,
+   0xFF2BFD8D, 0x9332EFC4, 0xBD35AA31, 0x214E77A0,
+   0x14FAA40E, 0x32896D73, 0x01E5F186, 0x767867EC,
+   0x17A1813E, 0xC9ADF8F1, 0x54741795, 0xCB6CDA78,
+   0x53B618C0, 0x1C6BD47D, 0x6A227923, 0xC424F46C,
+   0xDD92D964, 0x7303FFDE, 0x71B5ABF2, 0xE9712878,
+   0xF815561D, 0x8F48A632, 0xD3C055D1, 0x85F48FF5,
+   0x7525684F, 0x222A1427, 0x67360CC3, 0xD0D841A0,
+   0x0E0B040D, 0xB228A90F, 0x45FF897F, 0xBAF02D82,
+   0x00FA6122, 0x2AAC79E6, 0x8E36F557, 0x24828817,
+   0x113EC356, 0xB9521D31, 0x15EFF1F8, 0x9E48861E,
+   0xE0D41715, 0x2AA1D412, 0x53F131B8, 0x71F86203,
+   0x24AE7C52, 0x025C0D75, 0xA4A10CBF, 0xB5178ED4,
+   0x6A0576B8, 0x17C97D22, 0x14D58FCE, 0x758CFF44,
+   0x39ADAA99, 0xD9C6C7C2, 0xB443BFF3, 0x5786A440,
+   0x8CD9561F, 0x6533AD2B, 0xEDBCFB0D, 0x8BF37D94,
+   0x3B191165, 0x1960DAF1, 0x940361E2, 0x06FEF589,
+   0x82A89BC7, 0xB85E6B4B, 0x8E063F70, 0xDB6DC7F5,
+   0xDE702603, 0x458493AC, 0xE988D659, 0xB09C47E8,
+   0x4D4CA259, 0x22DA05E1, 0xB4D19014, 0x43B26383,
+   0x89B23A39, 0xC1E4C201, 0x86D6A587, 0xC87FAD53,
+   0x5869A5BC, 0x6B8BC917, 0x7445B9A2, 0xAA715E90,
+   0x6F5F32B5, 0x405DD401, 0x68E8E0BC, 0xE36F6E7C,
+   0xB930C0E9, 0x26EE7D48, 0x89ADDCE2, 0x4DDE7AAD,
+   0x542EAF38, 0x42DCA8B1, 0x7F6C839A, 0xC8CAD8E4,
+   0x2737AC00, 0x51E29AA5, 0x39EBB168, 0x230032A5,
+   0xC473B8BE, 0xD92C8136, 0x7E43F205, 0x2FD028F4,
+   0xC655642C, 0x1FDBABD9, 0xB64504ED, 0xFF04BF9C,
+   //Window 42
+   0x9DB3B381, 0x263A2CFB, 0xD4DF0A4B, 0x9C3A2DEE,
+   0x7D04E61F, 0x728D06E9, 0x42449325, 0x8B1ADFBC,
+   0x7E053A1B, 0x6EC1D939, 0x66DAF707, 0xEE2BE5C7,
+   0x810AC7AB, 0x80BA1E14, 0xF530F174, 0xDD2AE778,
+   0xB6828F36, 0xADBAEB79, 0x01BD5B9E, 0x9D7A0258,
+   0x1E844B0C, 0xEDA01E0D, 0x887EDFC9, 0x4B625175,
+   0x9669B621, 0x14109FDD, 0xF6F87B98, 0x88A2CA56,
+   0x170DF6BC, 0xFE2EB788, 0xFFA473F9, 0x0CEA06F4,
+   0x289A8619, 0x2618A091, 0x6671B173, 0xEF796E60,
+   0x9090C632, 0x664E46E5, 0x1E66F8FB, 0xA38062D4,
+   0x0573274E, 0x6C744A20, 0xA9271394, 0xD07B67E4,
+   0x6BDC0E20, 0x391223B2, 0xEB0A05A7, 0xBE2D93F1,
+   0x4444896B, 0x7EFA14B8, 0xF94027FB, 0x64974D2F,
+   0xDE84487D, 0xEFDCD0E8, 0x2B48989B, 0x8C45B260,
+   0xD8463487, 0xA8FCBBC2, 0x3FBC476C, 0xD1B2B3F7,
+   0xC8F443C0, 0x21D005B7, 0x40C0139C, 0x518F2E67,
+   0xA91F6791, 0xAE51DCA2, 0x9BAA9EFC, 0x2ABE4190,
+   0x559C7AC1, 0xD9D2E2F4, 0xFC9F773A, 0xE82F4B51,
+   0x4073E81C, 0xA7713027, 0xFBB596FC, 0xC0276FAC,
+   0xA684F70C, 0x1D819FC9, 0xC9F7B1E0, 0x29B47FDD,
+   0x721B33F2, 0x6A4590F4, 0xFEDF04EA, 0x2124F1FB,
+   0x9745EFE7, 0xF8E53CDE, 0x65F046D9, 0xE7E10432,
+   0xE4D0C7E6, 0xC3FCA28E, 0x87253B1B, 0x847E339A,
+   0x3743E643, 0x9B595348, 0x4FD12FC5, 0xCB6A0A0B,
+   0xA714181D, 0xEC1214ED, 0x6067B341, 0x609AC13B,
+   0xA545DF1F, 0xFF4B4C97, 0x34D2076B, 0xA1240501,
+   0x1409CA97, 0x6EFA0C23, 0x20638C43, 0x254CC1A8,
+   0xDCFB46CD, 0xD4E363AF, 0x03942A27, 0x62C2ADC3,
+   0x3FD40E09, 0x27B6A8AB, 0x77313EA9, 0xE455842E,
+   0x1F55988B, 0x8B51D1E2, 0x062BBBFC, 0x5716DD73,
+   0x4E8BF3DE, 0x633C11E5, 0x1B85BE3B, 0x9A0E77B6,
+   0x0911CCA6, 0x56510729, 0xEFA6590F, 0x27E76495,
+   //Window 43
+   0x070D3AAB, 0xE4AC8B33, 0x9A2CD5E5, 0x2643672B,
+   0x1CFC9173, 0x52EFF79B, 0x90A7C13F, 0x665CA49B,
+   0xB3EFB998, 0x5A8DDA59, 0x052F1341, 0x8A5B922D,
+   0x3CF9A530, 0xAE9EBBAB, 0xF56DA4D7, 0x35986E7B,
+   0xF0290A8F, 0x831AB3ED, 0xCB47C387, 0xCAE81966,
+   0x184EFB4F, 0xAAD7DECE, 0x4749110E, 0xDCFC53B3,
+   0x4CB632F9, 0x6698F23C, 0xB91F8067, 0xC42A1AD6,
+   0x6284180A, 0xB116A81D, 0xE901326F, 0xEBEDF5F8,
+   0x59B0FF62, 0x54A6FE5A, 0x4094D0D4, 0x25EC81A3,
+   0x33437F1D, 0xFCFD834E, 0xA67604DC, 0x8E98378B,
+   0xF4848598, 0x53137DD6, 0x62FDA36A, 0x87F2C5BF,
+   0xEF74DF46, 0x70DC1C27, 0x0A86A056, 0x3EBF428F,
+   0xB7F01D83, 0x6F975E7F, 0x45CCF5CB, 0x5F1F860B,
+   0x8B70930F, 0x22702EBA, 0x2B5CC879, 0xD8186DF7,
+   0x1720468F, 0x8C065DA0, 0x00464C80, 0x42477261,
+   0xC277E1CA, 0xD8C4BBBE, 0x66BA642F, 0x04AAEA17,
+   0x24593B2C, 0x542BC9B6, 0xA3C4A5D8, 0x8D459D6A,
+   0x05EE43AA, 0xD0D146BF, 0x44DA6976, 0x3707EF3E,
+   0x874BE76D, 0x615383AA, 0xCC4F8782, 0x547C4D7F,
+   0x7C6491E4, 0xC8CEA726, 0xD2B2D493, 0x858374EA,
+   0xB1753624, 0xEA87389A, 0x33C61483, 0x10FD2652,
+   0x98A1D8F8, 0x6FA52ACA, 0xBC5253E2, 0x70AD5C05,
+   0x8484F5CD, 0x163C1B0F, 0x20BC1EC6, 0x6C2DE03C,
+   0x28F6D210, 0xD56DD524, 0x39AE9820, 0xA29D8CED,
+   0xBB8282AD, 0x89003860, 0xC144CB6F, 0xEAF0446C,
+   0x8E166B0A, 0x2FD11149, 0x7586B9A4, 0x162FE943,
+   0x7A5BFE72, 0x8C7EB8B0, 0x7123F232, 0x21381AA2,
+   0x2E23051C, 0x2109DA4B, 0x968A8EE8, 0xCA4F85BB,
+   0x3DB8257A, 0x3034BD65, 0x0EA6D8CA, 0x78461D3F,
+   0xBF2BA2DA, 0x92F28378, 0x601BBBE3, 0x16B4EDEC,
+   0x0068ED20, 0x90EEC2EA, 0x11E377D2, 0x17BF0542,
+   0x57FC6649, 0x32893DC3, 0x25CC711C, 0x992E54B4,
+   //Window 44
+   0x979F3925, 0xB81D783E, 0xAF4C89A7, 0x1EFD130A,
+   0xFD1BF7FA, 0x525C2144, 0x1B265A9E, 0x4B296904,
+   0xB9DB65B6, 0xED8E9634, 0x03599D8A, 0x35C82E32,
+   0x403563F3, 0xDAA7A54F, 0x022C38AB, 0x9DF088AD,
+   0xF111661E, 0x9E93BA24, 0xB105EB04, 0xEDCED484,
+   0xF424B578, 0x96DC9BA1, 0xE83E9069, 0xBF8F66B7,
+   0xD7ED8216, 0x872D4DF4, 0x8E2CBECF, 0xBF07F377,
+   0x98E73754, 0x4281D899, 0x8AAB8708, 0xFEC85FBB,
+   0x1A3A93BC, 0x82EEBE73, 0xA21ADC1A, 0x42BBF465,
+   0xEF030EFD, 0xC10B6FA4, 0x87B097BB, 0x247AA4C7,
+   0xF60C77DA, 0x8B8DC632, 0xC223523E, 0x6FFBC26A,
+   0x344579CF, 0xA4F6FF11, 0x980250F6, 0x5825653C,
+   0xD314E7BC, 0xEDA6C595, 0x467899ED, 0x2EE7464B,
+   0x0A1ED5D3, 0x1CEF423C, 0x69CC7613, 0x217E76EA,
+   0xE7CDA917, 0x27CCCE1F, 0x8A893F16, 0x12D8016B,
+   0x9FC74F6B, 0xBCD6DE84, 0xF3144E61, 0xFA5817E2,
+   0x49CCD6D7, 0xC0B48D4E, 0x88BD5580, 0xFF8FB02C,
+   0x07D473B2, 0xC75235E9, 0xA2188AF3, 0x4FAB1AC5,
+   0x97576EC0, 0x030FA3BC, 0x0B7E7D2F, 0xE8C946E8,
+   0x70305600, 0x40A5C9CC, 0xC8B013B4, 0x6D8260A9,
+   0xCFDCF7DD, 0x2B09D2C3, 0x723FCAB4, 0x41A9FCE3,
+   0x07F57CA3, 0x73D905F7, 0xAC8E1555, 0x080F9FB1,
+   0x9BA7A531, 0x7C088E84, 0xED9A147F, 0x07D35586,
+   0xAF48C336, 0x602846AB, 0x0CCF0E79, 0x7320FD32,
+   0x7F8F875D, 0x92EB4090, 0x56C26BBF, 0x9C9D754E,
+   0x8110BBE7, 0x158CEA61, 0x745F91EA, 0x62A6B802,
+   0xC6E7394B, 0xA79C41AA, 0xAD57EF10, 0x445B6A83,
+   0x6EA6F40C, 0x0C5277EB, 0x88633365, 0x319FE96B,
+   0xD39B8C34, 0x77F84203, 0x3125EDDB, 0xED8B1BE6,
+   0xF6E39DC5, 0x5BBF2441, 0x6A5D678A, 0xB00F6EE6,
+   0x57D0EA99, 0xBA456ECF, 0x17E06C43, 0xDCAE0F58,
+   0x0F5B4BAA, 0x01643DE4, 0xD161B9BE, 0x2C324341,
+   //Window 45
+   0xE1337C26, 0x949C9976, 0xD73D68E5, 0x6FAADEBD,
+   0xF1B768D9, 0x9E158614, 0x9CC4F069, 0x22DFA557,
+   0xBE93C6D6, 0xCCD6DA17, 0xA504F5B9, 0x24866C61,
+   0x8D694DA1, 0x2121353C, 0x0140B8C6, 0x1C6CA580,
+   0x9AED9F40, 0xBD5660ED, 0x532A8C99, 0x70CA6AD1,
+   0x95C371EA, 0xC4978BFB, 0x7003109D, 0xE5464D0D,
+   0xD9E535EF, 0x1AF32FDF, 0x98C9185B, 0xABF57EA7,
+   0x12B42488, 0xED7A7417, 0xE97286FA, 0x8E0296A7,
+   0x1F017D5E, 0x8B57416E, 0x7674E99B, 0x37533396,
+   0xE8F488A0, 0x6E6D94C0, 0xDC16F95E, 0xB93A787A,
+   0xDCC99CCC, 0xC3AC51A2, 0x9AA47C1D, 0xC134B413,
+   0xAFDFD8D5, 0xF28FCDAF, 0x10B831ED, 0x0D57BD8E,
+   0x6C19D4C7, 0xD2FCD200, 0xE1B1E976, 0xA0F3C437,
+   0x94F237E8, 0xF0545FF6, 0xC0BF8BB1, 0xDD10EC3F,
+   0xAC7CD3E1, 0x4F89696C, 0x5F24BFE6, 0xED3714EC,
+   0x5FAF7706, 0x363EB1D8, 0xC027CC32, 0xFCBD604D,
+   0xC355363B, 0x16CE8EDD, 0xF8820D6E, 0x4AF2F70F,
+   0x7661A508, 0xCB7ED4D2, 0xDD195472, 0x41D3444E,
+   0x38DA9649, 0x17FEA2B4, 0xAEB4A200, 0x9BF69356,
+   0x6AB19C3D, 0xA13B5F91, 0xDC9360A6, 0xC0519C14,
+   0xA70684D1, 0xDE74E49C, 0x33E80C3D, 0x3AE87661,
+   0x16A5C34D, 0x5984A2A9, 0xB8298C35, 0x09A83ECC,
+   0xAA4CA4C0, 0x9A19867C, 0xB375B8FF, 0x02085610,
+   0xF70396DC, 0xF296328B, 0xDE6FAE63, 0x9C9DDC4C,
+   0x0B083B6E, 0x94683D26, 0x06F6A54D, 0x0A3752EB,
+   0x752074DD, 0x48BEDC23, 0x3E822593, 0x637622FC,
+   0x6BE55D3B, 0xEA000513, 0x324D006D, 0x9F5E12F4,
+   0x64FC0270, 0x529486A9, 0x923399E6, 0x09BA0D0C,
+   0x121550B3, 0xD3E926AB, 0xC147CE84, 0xE4975E4A,
+   0x5EFF722A, 0x7A8BE0F9, 0x6FD4F2A0, 0x71E4702C,
+   0x3CB7B280, 0x13B92ACF, 0x28272D73, 0xC588716D,
+   0xDAA9FE5C, 0x862C7BF3, 0xE2A79E42, 0x78C008F2,
+   //Window 46
+   0x4C830320, 0xF3B7963F, 0x903203E3, 0x842C7AA0,
+   0xE7327AFB, 0xAF22CA0A, 0x967609B6, 0x38E13092,
+   0x757558F1, 0x73B8FB62, 0xF7ECA8C1, 0x3CC3E831,
+   0xF6331627, 0xE4174474, 0xC3C40234, 0xA77989CA,
+   0xB796D219, 0xB32CB8B0, 0x34741DD9, 0xC3E95F4F,
+   0x68EDF6F5, 0x87212125, 0xA2B9CB8E, 0x7A03AEE4,
+   0xF53A89AA, 0x0CD3C376, 0x948A28DC, 0x0D8AF9B1,
+   0x902AB04F, 0xCF86A3F4, 0x7F42002D, 0x8AACB62A,
+   0x252BD479, 0x9CB0AE6C, 0x12B5848F, 0x05E0F88A,
+   0xA5C97663, 0x78F6D2B2, 0xC162225C, 0x6F6E149B,
+   0xDE601A89, 0xE602235C, 0xF373BE1F, 0xD17BBE98,
+   0xA8471827, 0xCAF49A5B, 0x18AAA116, 0x7E1A0A85,
+   0x35E6FC06, 0x8B1E5722, 0x0B3E13D5, 0x3477728F,
+   0xAA8A7372, 0x150C294D, 0x3BFA528A, 0xC0291D43,
+   0xCEC5A196, 0xC6C8BC67, 0x5C2E8A7C, 0xDEEB31E4,
+   0xFB6E1C51, 0xBA93E244, 0x2E28E156, 0xB9F8B71B,
+   0xEE9523F0, 0x343AC0A3, 0x975EA978, 0xBB75EAB2,
+   0x107387F4, 0x1BCCF332, 0x9AB0062E, 0x790F9259,
+   0x1E4F6A5F, 0xF1A363AD, 0x62519A50, 0x06E08B84,
+   0x7265F1EE, 0x60915187, 0x93AE985E, 0x6A80CA34,
+   0xBE0F4492, 0x2DFB9E08, 0xE9D5E517, 0x3FF0DA03,
+   0xF79466A8, 0x03DBE9A1, 0x15EA9932, 0x0B87BCD0,
+   0xAB1F58AB, 0xEB64FC83, 0x817EDC8A, 0x6D9598DA,
+   0x1D3B67E5, 0x699CFF66, 0x92635853, 0x645C0F29,
+   0xD7FE71F3, 0xD50E57C7, 0xBC97CE38, 0x15342190,
+   0x4DF07B63, 0x51BDA2DE, 0x200EB87D, 0xBA12AEAE,
+   0xA9B4F8F6, 0xABE135D2, 0xFAD6D99C, 0x04619D65,
+   0x7994937C, 0x4A6683A7, 0x6F94F09A, 0x7A778C8B,
+   0x425C6559, 0x8DD1FB83, 0x0AF06FDA, 0x7FC00EE6,
+   0x33D956DF, 0xE98C9225, 0x4FBDC8A2, 0x0F1EF335,
+   0xB79B8EA2, 0x2ABB5145, 0xBDBFF288, 0x40FD2945,
+   0xD7185DB7, 0x6A814AC4, 0xC084609A, 0xC4329D6F,
+   //Window 47
+   0x53544774, 0x511053E4, 0x3ADBA2BC, 0x834D0ECC,
+   0xBAE371F5, 0x4215D7F7, 0x6C8663BC, 0xFCFD57BF,
+   0xD6901B1D, 0xDED2383D, 0xB5587DC3, 0x3B49FBB4,
+   0x07625F62, 0xFD44A08D, 0x9DE9B762, 0x3EE4D65B,
+   0x4E6DAAE2, 0xED7F2E77, 0x9E0A19BC, 0x7B3AE0E3,
+   0x91AE677E, 0xD3293F8A, 0x45C8611F, 0xD363B0CB,
+   0x309AE93B, 0xBE1D1CCF, 0x3920CAE1, 0xA3F80BE7,
+   0x498EDF01, 0xAAACBA74, 0xB2F5AC90, 0x1E6D2A4A,
+   0xBECCEFB5, 0x40FDF5AA, 0x3621D7C7, 0xCF56EDE9,
+   0x52B576C1, 0xB632A9CE, 0x9A6F6027, 0xD3403AE8,
+   0xE8785A64, 0x660A050D, 0x9682652E, 0x10F3D647,
+   0x4FBCBE02, 0x78B25EDF, 0xB4F9315D, 0xC9710FDE,
+   0x3245980E, 0xD655ADE7, 0x81067200, 0xA6F59657,
+   0xDB136BE1, 0xE4FC23BE, 0xAF13D879, 0x9F246CDC,
+   0xF961AC0E, 0xC2B93117, 0xEBDB9E1A, 0xC8A741B5,
+   0x6C693BD1, 0x82EDE246, 0x3DD1701E, 0xFCDE6B4F,
+   0x0F6F722B, 0xC6828697, 0x1CE64E46, 0xB51401B0,
+   0x370279A0, 0x78681257, 0x39280446, 0x74183860,
+   0xB6B3F93E, 0xBC44192E, 0x61D9298F, 0x9732EA49,
+   0xBF71120F, 0x520B8AF5, 0x4BD2CCED, 0x75138F70,
+   0xE230CC55, 0xA8CEDFDA, 0xCACE5C58, 0x36477872,
+   0x76D9ACAE, 0x8878A5CD, 0xC1605435, 0x5900C6AF,
+   0x681F275D, 0xD4B0AF62, 0x67FADC4B, 0xAF445A60,
+   0x07EE1AA7, 0x79E9B8FE, 0xF4318176, 0x8350BBC7,
+   0xA1C55EE6, 0x5FD75B65, 0x26D3AA58, 0xF95B02AF,
+   0xF99E1761, 0xB9501ED3, 0x6737CC00, 0xCB9D2EBC,
+   0x21C646FA, 0xA921BF5F, 0xE23856A7, 0x78FE6FA7,
+   0x7F77BF35, 0xFBB5B721, 0xEB11FCF2, 0xF6716E8D,
+   0x86582D9D, 0x4ADD3D07, 0xD92F2591, 0x49449B73,
+   0x0A8F073E, 0xC48257F4, 0x304BF77A, 0x8C98045C,
+   0x9E2E77AE, 0xBF3507C0, 0x30EF837D, 0xC280DD89,
+   0x03F7FC9E, 0x2E8023C2, 0xFC6A75EE, 0x62243622,
+   //Window 48
+   0xF4F8B16A, 0x56F8410E, 0xC47B266A, 0x97241AFE,
+   0x6D9C87C1, 0x0A406B8E, 0xCD42AB1B, 0x803F3E02,
+   0x04DBEC69, 0x7F0309A8, 0x3BBAD05F, 0xA83B85F7,
+   0xAD8E197F, 0xC6097273, 0x5067ADC1, 0xC097440E,
+   0x3794F8DC, 0x266344A4, 0x483C5C36, 0xDCCA923A,
+   0x3F9D10A0, 0x2D6B6BBF, 0x81D9BDF3, 0xB320C5CA,
+   0x47B50A95, 0x620E28FF, 0xCEF03371, 0x933E3B01,
+   0x99100153, 0xF081BF85, 0xC3A8C8D6, 0x183BE9A0,
+   0xE085116B, 0x25470FAB, 0x87285310, 0x04A43375,
+   0xE2BFD52F, 0x4E39187E, 0x7D9EBC74, 0x36166B44,
+   0xFD4B322C, 0x92AD433C, 0xBA79AB51, 0x726AA817,
+   0xC1DB15EB, 0xF96EACD8, 0x0476BE63, 0xFAF71E91,
+   0x49DEE168, 0x72CFD2E9, 0x3E2AF239, 0x1AE05223,
+   0x1D94066A, 0x009E75BE, 0x38ABF413, 0x6CCA31C7,
+   0x9BC49908, 0xB50BD61D, 0xF5E2BC1E, 0x4A9B4A8C,
+   0x946F83AC, 0xEB6CC5F7, 0xEBFFAB28, 0x27DA93FC,
+   0x76257C51, 0x3CE519EF, 0x18D477E7, 0x6F5818D3,
+   0x7963EDC0, 0xAB022E03, 0x8BD1F5F3, 0xF0403A89,
+   0x496033CA, 0xE43B8DA0, 0xA1CFDD72, 0x0994E10E,
+   0xBA73C0E2, 0xB1EC6D20, 0xB6BCFAD1, 0x0329C9EC,
+   0x3318D2D4, 0xBDEC338E, 0xBE8DE963, 0x733DD7BB,
+   0xA2C47EBD, 0x61BCC3BA, 0x35EFCBDE, 0xA821AD19,
+   0x024CDD5C, 0x91AC668C, 0xC1CDFA49, 0x7BA558E4,
+   0x908FB4DA, 0x491D4CE0, 0xF685BDE8, 0x7BA869F9,
+   0x79F464BA, 0xED1B5EC2, 0x47D72E26, 0x2D65E42C,
+   0x9E67F926, 0x8198E574, 0x34747E44, 0x41066738,
+   0xE37E5447, 0x4637ACC1, 0xF3E15822, 0x02CBC9EC,
+   0x805AA83C, 0x58A8E98E, 0x5595E800, 0x73FACD6E,
+   0x38330507, 0x468FF803, 0x4037A53E, 0x06F34DDF,
+   0x8D6993A4, 0x70CD1A40, 0x43E5C022, 0xF85A1597,
+   0xC125A67D, 0x396FC9C2, 0x1064BFCB, 0x03B7BEBF,
+   0xA9806DCB, 0x7C444592, 0x4487CD54, 0x1B02614B,
+   //Window 49
+   0x692AC542, 0x8303604F, 0x227B91D3, 0xF079FFE1,
+   0x15AAF9BD, 0x19F63E63, 0xF1F344FB, 0xF99EE565,
+   0xD6219199, 0x8A1D661F, 0xD48CE41C, 0x8C883BC6,
+   0x3C74D904, 0x1065118F, 0x0FAF8B1B, 0x713889EE,
+   0xB1B76BA6, 0xCA6C0937, 0x4D2026DC, 0x1A2EAB85,
+   0x19D9AE0A, 0xB1715E15, 0xBAC4A026, 0xF1AD9199,
+   0x07EA7B0E, 0x35B3DFB8, 0x3ED9EB89, 0xEDF5496F,
+   0x2D6D08AB, 0x8932E5FF, 0x25BD2731, 0xF314874E,
+   0x0876FD4E, 0xC38E438F, 0x83D2F383, 0x45F0C307,
+   0xB10934CB, 0x203CC2EC, 0x2C9D46EE, 0x6A8F2439,
+   0x65CCDE7B, 0xF16B431B, 0x27E76A6F, 0x41E2CD18,
+   0x4E3484D7, 0xB9C8CF8F, 0x8315244A, 0x64426EFD,
+   0xBA16F73B, 0x2B1D402A, 0x8CF9B9FC, 0x2FB31014,
+   0x446EF7BF, 0x2D51E60E, 0xB91E1745, 0xC731021B,
+   0x4FEE99D4, 0x9D3B4724, 0xFAC5C1EA, 0x4BCA48B6,
+   0xBBEA9AF7, 0x70F5F514, 0x974C283A, 0x751F55A5,
+   0x36CF69DB, 0x3B59796D, 0x56670C18, 0x1219EEE9,
+   0x7A070D8E, 0xFE3341F7, 0xA327F90C, 0x9B70130B,
+   0x0AE18E0E, 0x36A32462, 0x46C0A638, 0x2021A623,
+   0xC62EB0D4, 0x251B5817, 0x4C762293, 0x87BFBCDF,
+   0x548F5A0E, 0xCAE8BBDA, 0x3BBFBBE1, 0x1910EABA,
+   0x7677AFC3, 0xAE579685, 0x73FF0B5C, 0x49EA61F1,
+   0x4F7C3922, 0x78655478, 0x20C68EEF, 0x95D337CD,
+   0xDF779AB9, 0x68F1E1E5, 0xB5CF69A8, 0x14B491B0,
+   0xAC620366, 0x686D72A0, 0xB6D59344, 0x4BE3FB9C,
+   0xA1EB75B9, 0x6E8B44E7, 0x91A5C10C, 0x84E39DA3,
+   0xB38F0409, 0x37CC1490, 0x2C2ADE82, 0x02951943,
+   0x1190A2D8, 0x9B688783, 0x231182BA, 0x25627D14,
+   0xD842CA72, 0x39D4ADD2, 0x3ED96305, 0xA71E4391,
+   0x6700BE14, 0x5BB09CBE, 0xD8BEFCF6, 0x68D69D54,
+   0x37183BCF, 0xA45F5367, 0x3370DFF7, 0x7152B7BB,
+   0xBF12525B, 0xCF887BAA, 0xD6D1E3CD, 0xE7AC7BDD,
+   //Window 50
+   0x81FDAD90, 0x25914F78, 0x0D2CF6AB, 0xCF638F56,
+   0xCC054DE5, 0xB90BC03F, 0x18B06350, 0x932811A7,
+   0x9BBD11FF, 0x2F00B330, 0xB4044974, 0x76108A6F,
+   0xA851D266, 0x801BB9E0, 0xBF8990C1, 0x0DD099BE,
+   0x7B0AC93D, 0xEBD6A677, 0x78F5E0D7, 0xA6E37B0D,
+   0x76F5492B, 0x2516C096, 0x9AC05F3A, 0x1E4BF888,
+   0x4DF0BA2B, 0xCDB42CE0, 0x5062341B, 0x935D5CFD,
+   0x82ACAC20, 0x8A303333, 0x5198B00E, 0x429438C4,
+   0xC1770616, 0x6C626F56, 0x09DA9A2D, 0x5351909E,
+   0xA3730E45, 0xE58E6825, 0x03EF0A79, 0x9D8C8BC0,
+   0x056BECFD, 0x543F78B6, 0xA090B36D, 0x33F13253,
+   0x794432F9, 0x82AD4997, 0x4721F502, 0x1386493C,
+   0xB008733A, 0xE566F400, 0x512E1F57, 0xCBA0697D,
+   0x40509CD0, 0x9537C2B2, 0x57353D8C, 0x5F989C69,
+   0x4C3C2B2F, 0x7DBEC972, 0xFF031FA8, 0x90E02FA8,
+   0xCFD5D11F, 0xF4D15C53, 0x48314DFC, 0xB3404FAE,
+   0xF327A07F, 0xF02CC3A9, 0x4490937D, 0xEFB27A9B,
+   0xB1B3AFA5, 0x81451E96, 0x91883BE4, 0x67E24DE8,
+   0x70869E54, 0x1AD65D47, 0x64A3856A, 0xD36291A4,
+   0x7132E880, 0x070A1ABF, 0x0E28DFDF, 0x9511D0A3,
+   0xC72A4BE5, 0x9B185FAC, 0x4D848089, 0xF66DE236,
+   0x717AFEA9, 0xBA14D07C, 0x2D551C1C, 0x25BFBFC0,
+   0x4CDF3D88, 0x2CEF0ECD, 0x647F73C4, 0x8CEE2AA3,
+   0x722D67F7, 0xC10A7D3D, 0x94564A21, 0x090037A2,
+   0x4F3815C4, 0x6AC07BB8, 0x1AA9017E, 0xDDB9F624,
+   0xCA85720A, 0x31E30228, 0x7CB75838, 0xE59D63F5,
+   0x7BAAD2D0, 0x69E18E77, 0xD42F5D73, 0x2CFDB784,
+   0xF5774983, 0x025DD53D, 0xE042CD52, 0x2F80E7CE,
+   0x4D6EE4AB, 0x43F18D7F, 0x9570C3DC, 0xD3AC8CDE,
+   0x0B8C9B2A, 0x527E4907, 0xC5A4C0F1, 0x716709A7,
+   0x916A26B1, 0x930852B0, 0x4E071177, 0x3CC17FCF,
+   0x59694868, 0x34F5E3D4, 0xA28F655D, 0xEE0341AB,
+   //Window 51
+   0x060B5F61, 0xF431F462, 0x7BD057C2, 0xA56F46B4,
+   0x47E1BF65, 0x348DCA6C, 0x41BCF1FF, 0x9A38783E,
+   0xDA710718, 0x7A5D33A9, 0x2E0AEAF6, 0x5A779987,
+   0x2D29D187, 0xCA87314D, 0xC687D733, 0xFA0EDC3E,
+   0x5EB03C0E, 0x499B6AB6, 0x72BC3FDE, 0xF19B7954,
+   0x6E3A80D2, 0xA86B5B9C, 0x6D42819F, 0xE4377508,
+   0xBB3EE8A3, 0xC1663650, 0xB132075F, 0x75EB14FC,
+   0x7AD834F6, 0xA8CCC906, 0xE6E92FFD, 0xEA6A2474,
+   0x4B049136, 0xCB4D20EE, 0x356A4613, 0x8B63BF12,
+   0x70E08128, 0x1221AEF6, 0x4ACB6B16, 0xE62D8C51,
+   0x379E7896, 0x71F64A67, 0xCAFD7FA5, 0xB25237A2,
+   0x3841BA6A, 0xF077BD98, 0x3CD16E7E, 0xC4AC0244,
+   0x50F75F9C, 0x3C5604FF, 0x7E752B22, 0x1D8EDDF3,
+   0x3C9A1118, 0x0EF074DD, 0xCCB86D7B, 0xD0FFC172,
+   0x037D90F2, 0xABD1ECE3, 0x6055856C, 0xE3F307D6,
+   0x7E4C6DAF, 0x422F9328, 0x334879A0, 0x902AAC66,
+   0xB940C71E, 0x8E52874C, 0xDB5F4B3A, 0x211935A9,
+   0x301B1DC3, 0x94350492, 0x29958620, 0x33D2646D,
+   0xEF911404, 0x16B0D64B, 0x9A3C5EF4, 0x9D1F25EA,
+   0x4A352C78, 0x20F200EB, 0x4BD0B428, 0x43929F2C,
+   0xE82C9F9E, 0xD44636E6, 0xC33A1043, 0x711DB87C,
+   0xAA8AEC05, 0x6F431263, 0x2744A4AA, 0x43FF120D,
+   0xAE77779B, 0xD3BD892F, 0x8CDC9F82, 0xF0FE0CC9,
+   0xF1C5B1BC, 0xCA5F7FE6, 0x44929A72, 0xCC63A682,
+   0xB38DFF6F, 0x2834DA3E, 0xEA636BE8, 0xBE012C52,
+   0x61DD37F8, 0x292D238C, 0x8F8142DB, 0x0E54523F,
+   0x036A05D8, 0xE31EB436, 0x1E93C0FF, 0x83E3CDFF,
+   0x50821DDF, 0x3FD2FE0F, 0xFF9EB33B, 0xC8E19B0D,
+   0x5E9CA895, 0x147D9052, 0x972072DF, 0x2F4DD31E,
+   0xE6C6755C, 0xA16FDA8E, 0xCF196558, 0xC66826FF,
+   0x0CF43895, 0x1F1A76A3, 0x83C3097B, 0xA9D604E0,
+   0x66390E0E, 0xE1908309, 0xB3C85EFF, 0xA50BF753,
+   //Window 52
+   0xADF7CCCF, 0x75D9BC15, 0xDFA1E1B0, 0x81A3E5D6,
+   0x249BC17E, 0x8C39E444, 0x8EA7FD43, 0xF37DCCB2,
+   0x907FBA12, 0xDA654873, 0x4A372904, 0x35DAA6DA,
+   0x6283A6C5, 0x0564CFC6, 0x4A9395BF, 0xD09FA4F6,
+   0x5CFE5C48, 0xC51AA29E, 0x815EE096, 0x82C020AE,
+   0x7549A68A, 0x7848AD82, 0x60471355, 0x7933D489,
+   0x67C51E57, 0x04998D2E, 0xD9944AFC, 0x0F64020A,
+   0xA7FADAC6, 0x7A299FE1, 0x5AEFE92C, 0x40C73FF4,
+   0x5488771A, 0xBF44FFC7, 0x7F2F2191, 0xCB76E3F1,
+   0x94F86A42, 0x4197BDE3, 0x70641D9A, 0x45C25BB9,
+   0xF88CE6DC, 0xD8A29E31, 0x4BB7AC7D, 0xBE2BECFD,
+   0xB5670CC7, 0x13094214, 0x60AF8433, 0xE90A8FD5,
+   0x4EBD3F02, 0x0ECF9B8B, 0x86B770EA, 0xA47ACD9D,
+   0x2DA213CE, 0x93B84A6A, 0x53E7C8CF, 0xD760871B,
+   0x36E530D7, 0x7A5F58E5, 0x1912AD51, 0x7ABC52A5,
+   0x2EA0252A, 0x7AD43DB0, 0xC176B742, 0x498B00EC,
+   0x888AE17F, 0x9FF713EF, 0xB34B7BEB, 0x6007F68F,
+   0x3B653D64, 0x5D2B1898, 0xD3CA4B1B, 0xCBF73E91,
+   0x6CDFB3A1, 0x4B050AD5, 0xD1F833A4, 0x41BD3EC3,
+   0x719D7BF5, 0x78D7E2EE, 0x2A27412E, 0xEA460467,
+   0x441E760D, 0xC312BA68, 0xA50E512E, 0x84D0D061,
+   0x4BBDD849, 0xFE764F4E, 0x9DADD5C0, 0xA924ADCF,
+   0xDEBFE976, 0x08685961, 0x29FBA601, 0xD3D846C5,
+   0xDC3F4040, 0x43BF8227, 0xA49E9FF5, 0x05E767B8,
+   0x9953E453, 0xC4689C30, 0x1712DCA5, 0x5E355A2E,
+   0xF1CD96F7, 0x1FF83C81, 0x44CF56DB, 0xB06B89FB,
+   0x65F16E0D, 0x18277053, 0xE5618672, 0x6403B91D,
+   0xBE384BC6, 0xBA3F9475, 0x303CE5F3, 0x7F691CBE,
+   0x210F4045, 0x4589BA03, 0x01E8012A, 0xD5E73663,
+   0x74462FFA, 0x1C26052D, 0x4F989519, 0xE78F600C,
+   0x7CEE0B2F, 0xC63CA0C9, 0xAF760B5F, 0xBE588573,
+   0x593773CD, 0x05906FC4, 0xE322D5AF, 0xD5970FB0,
+   //Window 53
+   0x0EBCF726, 0x103C46E6, 0x6231470E, 0x4482B831,
+   0x487C2109, 0x6F6DFACA, 0x62E666EF, 0x2E0ACE97,
+   0x1F8D1F42, 0x3246A9D3, 0x574944D2, 0x1B1E83F1,
+   0xA57F334B, 0x13DFA63A, 0x9F025D81, 0x0CF8DAED,
+   0x207674F1, 0xBC19180C, 0x33AE8FDB, 0x112E09A7,
+   0x6AAEB71E, 0x99667554, 0xE101B1C7, 0x79432AF1,
+   0xDE2DDEC6, 0xD5EB558F, 0x5357753F, 0x81392D1F,
+   0x3AE1158A, 0xA7A76B97, 0x4A899991, 0x416FBBFF,
+   0x2F3B26E7, 0x6D956E89, 0xDA875247, 0xF4709860,
+   0x2482DDA3, 0x3AD15179, 0x017D82F0, 0xD64110E3,
+   0xFAD414E4, 0x14928D2C, 0x2ED02B24, 0x2B155F58,
+   0xCB821BF1, 0x481A141B, 0x4F81F5DA, 0x12E3C770,
+   0x7882F14F, 0xE29FA63E, 0x07C6CADC, 0xC9F6DC35,
+   0xB882BED0, 0x46F22D6F, 0xD118E52C, 0x1A45755B,
+   0x7C4608CF, 0x9F2C7C27, 0x568012C2, 0x7CCBDF32,
+   0x61729B0E, 0xFCB0AEDD, 0xF7D75DBF, 0x7CA2CA9E,
+   0xC53352E7, 0x88B34414, 0x1337D46E, 0x5A34889C,
+   0xF95F2BC8, 0x612C1560, 0xD4807A3A, 0x8A3F8441,
+   0x5224DA68, 0x680D9E97, 0xC3EB00E9, 0x60CD6E88,
+   0x9A6BC375, 0x3875A98E, 0x4FD554C2, 0xDC80F924,
+   0xE2A9A6DB, 0x30495BA3, 0x58F9268B, 0x4601303D,
+   0x7EB0F04F, 0xBE3B0DAD, 0x4456936D, 0x4EA47250,
+   0xD33FD3E7, 0x8CAF8798, 0xEB433708, 0x1CCD8A89,
+   0x87FD50AD, 0x9EFFE3E8, 0x6B29C4DF, 0xBE240A56,
+   0x43AD73B3, 0x84BFCF53, 0x4F035A94, 0x1B528C20,
+   0x33EEAC69, 0x4294EDF7, 0x817F3240, 0xB6283E83,
+   0x0A5F25B1, 0xC3FDC959, 0x5844EE22, 0xEFAF8AA5,
+   0xDBDDE4DE, 0xDE269BA5, 0xC56133BF, 0xE3347160,
+   0x2FE3CD4C, 0x7C838643, 0xB4BC633C, 0xE0F33ACB,
+   0x3D139F1F, 0xB4A9ECEC, 0xDC4A1F49, 0x05CE69CD,
+   0xF5F98AAF, 0xA19D1B16, 0x6F23E0EF, 0x45BB71D6,
+   0x46CDFDD3, 0x33789FCD, 0xCEE040CA, 0x9B8E2978,
+   //Window 54
+   0xE457A477, 0xA0158EEA, 0xEE6DDC05, 0xD19857DB,
+   0x18C41671, 0xB3265224, 0x3C2C0D58, 0x3FFDFC7E,
+   0x26EE7CDA, 0x3A3A5254, 0xDF02C3A8, 0x341B0869,
+   0x723BBFC8, 0xA023BF42, 0x14452691, 0x3D15002A,
+   0x262A3539, 0xF3CAE7E9, 0x6670D59E, 0x78A49D1D,
+   0xC1C5E1B9, 0x37DE0F63, 0x69CB7C1C, 0x3072C30C,
+   0x77C850E6, 0x1D278A52, 0x1F6A3DE6, 0x84F15F8F,
+   0x592CA7AD, 0x46A8BB45, 0xE4D424B8, 0x1912E3EE,
+   0x365E668B, 0xDC988086, 0xAABDA5FB, 0xADA8DCDA,
+   0x255F1FBE, 0xBC146B4C, 0xCF34CFC3, 0x9CFCDE29,
+   0x7E85D1E4, 0xACBB453E, 0xF92358B5, 0x9CA09679,
+   0x240823FF, 0x15FC2D96, 0x0C11D11E, 0x8D65ADF7,
+   0x0296F4FD, 0x775557F1, 0xEA51B436, 0x1DCA76A3,
+   0xFB950805, 0xF3E98F60, 0x831CF7F1, 0x31FF32EA,
+   0x8D2C714B, 0x643E7BF1, 0x2E9D2ACA, 0x64B5C339,
+   0x6ADC2D23, 0xA9FD9CCC, 0xCC721B9B, 0xFC2397EC,
+   0xB48EC57D, 0xF031182D, 0x04B233B9, 0x515D32F8,
+   0x093AAD26, 0x06BBB1D4, 0x0D83D1EC, 0x88A142FE,
+   0x245C73F8, 0x3B95C099, 0x52EDCD32, 0xB126D4AF,
+   0x8FCB52E6, 0xF8022C1E, 0x0106D339, 0x5A51AC4C,
+   0x7C64A054, 0xB7F70A1A, 0x9DB43E79, 0x0DC1C0DF,
+   0x51FE63D6, 0x6D0A4AE2, 0x7F0C8ABF, 0xE0D5E332,
+   0x2B7ECEE8, 0xFF550036, 0x5D055008, 0x3EA0E6F7,
+   0xF24AC84F, 0x30DEB62F, 0x5D7116B7, 0x936969FD,
+   0x2617CF7F, 0x02DA7612, 0xEEE35260, 0xD6E25D4E,
+   0xFD3533E9, 0xB2FA5B0A, 0xB9126F88, 0xE76BB7B0,
+   0x88856866, 0x692E6A99, 0x49DB65CA, 0x3FDF394F,
+   0x22D8D606, 0x25296991, 0x3DD7C4CF, 0xE815BFBF,
+   0x4D844E7F, 0x69C984ED, 0x4A2E8A82, 0xD354B217,
+   0xFB2C4136, 0x25BD4ADD, 0x144B26E1, 0xF72DF4DE,
+   0xE6101AFD, 0xD0AA9DB0, 0xE49BD1B8, 0x4445EFAA,
+   0x331593B2, 0x5DC54EEE, 0x094BF10B, 0xFA35E3B9,
+   //Window 55
+   0xC42BD6D2, 0xDB567D6A, 0xBB1F96AE, 0x6DF86468,
+   0x4843B28E, 0x0EFE5B1A, 0x6379B240, 0x961BBB05,
+   0x70A6A26B, 0xB6CAF5F0, 0x328E6E39, 0x70686C0D,
+   0x895FC8D3, 0x80DA06CF, 0xB363FDC9, 0x804D8810,
+   0x1F17A34C, 0x14E49DA1, 0x235A1456, 0x5420AB39,
+   0x2F50363B, 0xB7637241, 0xC3FABB6E, 0x7B15D623,
+   0xE274E49C, 0xA0EF40B1, 0x96B1860A, 0x5CF50744,
+   0x66AFE5A4, 0xD6583FBF, 0xF47E3E9A, 0x44240510,
+   0x48AC2840, 0xB5358B1E, 0xECBA9477, 0x18311294,
+   0xA6946B43, 0xDA58F990, 0x9AB41819, 0x3098BAF9,
+   0x4198DA52, 0x66C4C158, 0x146BFD1B, 0xAB4FC17C,
+   0xBF36A908, 0x2F0A4C3C, 0x58CF7838, 0x2AE9E34B,
+   0x4A34F239, 0x417499E8, 0xB90402D5, 0x15FDB83C,
+   0x433AA832, 0xB75F46BF, 0x63215DB1, 0xB61E15AF,
+   0xA127F89A, 0xAABE59D4, 0x07E816DA, 0x5D541E0C,
+   0xA618B692, 0xAABA0659, 0x17266026, 0x55327733,
+   0x3F6EFFC7, 0x023C155D, 0x9C90F0C7, 0x1FBD69FF,
+   0xBEEC2C5D, 0xE5D7DA8A, 0xD7E86273, 0x8813872B,
+   0x55F5E228, 0x9F3BC2C6, 0xB0923B41, 0x11482869,
+   0x1AA307CA, 0x65D75C74, 0x7F24EEE5, 0xDA92C257,
+   0x754C92E1, 0x08DD1028, 0xCF0FEF34, 0xCA90B57A,
+   0x8AF55919, 0x1A9B84AC, 0xED93686B, 0xAA95E0E1,
+   0x167021A4, 0x46737315, 0x20D5FF98, 0x6CB6A0DA,
+   0x1092E706, 0xECC4801A, 0x3C5E61A6, 0xEDCAB23A,
+   0xA06D107E, 0x7F1290FC, 0xB7661137, 0x697261FD,
+   0x947B4B38, 0x1BB5BE4E, 0x3BB79130, 0xB49826B6,
+   0x5BA8BFFB, 0x019DDFE8, 0x7E3FA8E4, 0xB1AF7900,
+   0x01BCFE7F, 0x72E1BDF2, 0xD1169AEA, 0x2ED3CA8F,
+   0xD9DE99A8, 0xE17A9947, 0xC93477BD, 0xC2E61B2D,
+   0x1D19E287, 0x57F684D4, 0xFE358135, 0x843C2122,
+   0x04F7E8AB, 0xE2D3E2E9, 0xB5F27AEE, 0xBF93FFE9,
+   0x7B1858C4, 0x29830D1D, 0x8106ADBF, 0xA8F44964,
+   //Window 56
+   0x35D0B34A, 0xE3417BC0, 0x8327C0A7, 0x440B386B,
+   0xAC0362D1, 0x8FB7262D, 0xE0CDF943, 0x2C41114C,
+   0xAD95A0B1, 0x2BA5CEF1, 0x67D54362, 0xC09B37A8,
+   0x01E486C9, 0x26D6CDD2, 0x42FF9297, 0x20477ABF,
+   0x1E706AD9, 0x126F35B5, 0xC3A9EBDF, 0xB99CEBB4,
+   0xBF608D90, 0xA75389AF, 0xC6C89858, 0x76113C4F,
+   0x97E2B5AA, 0x80DE8EB0, 0x63B91304, 0x7E1022CC,
+   0x6CCC066C, 0x3BDAB605, 0xB2EDF900, 0x33CBB144,
+   0xDACE5ACA, 0x157AF101, 0x11A6A267, 0xC4FDBCF2,
+   0xC49C8609, 0xDADDF340, 0xE9604A65, 0x97E49F52,
+   0x937E2AD5, 0x9BE8E790, 0x326E17F1, 0x846E2508,
+   0x0BBBC0DC, 0x3F38007A, 0xB11E16D6, 0xCF03603F,
+   0xF8AE7C38, 0x5ED0C007, 0x3D740192, 0x6DB07A5C,
+   0x5FE36DB3, 0xBE5E9C2A, 0x76E95046, 0xD5B9D57A,
+   0x8EBA20F2, 0x54AC32E7, 0x71B9A352, 0xEF11CA8F,
+   0xFF98A658, 0x305E373E, 0x823EB667, 0xFFE5A100,
+   0xDA64309D, 0x5C8ED8D5, 0x91B30704, 0x61A6DE56,
+   0x2F9B5808, 0xD6B52F6A, 0x98C958A7, 0x0EEE4194,
+   0x771E4CAA, 0xCDDD9AAB, 0x78BC21BE, 0x83965DFD,
+   0xB3B504F5, 0x02AFFCE3, 0x561C8291, 0x30847A21,
+   0x66131E2E, 0xB9D18CD3, 0x80FE2682, 0xF31D974F,
+   0xE4160289, 0xB6E49E0F, 0x08E92799, 0x7C48EC0B,
+   0xD1989AA7, 0x818111D8, 0xEBF926F9, 0xB34FA0AA,
+   0xA245474A, 0xDB5FE2F5, 0x3C7CA756, 0xF80A6EBB,
+   0x3DE9ABE3, 0x8EA61059, 0x9CDC03BE, 0x40434881,
+   0xCFEDCE8C, 0x9B261245, 0xCF5234A1, 0x78C318B4,
+   0xFDE24C99, 0x510BCF16, 0xA2C2FF5D, 0x2A77CB75,
+   0x27960FB4, 0x9C895C2B, 0xB0EDA42B, 0xD30CE975,
+   0xFF57D051, 0x09521177, 0xFB6A1961, 0x2FF38037,
+   0xA3D76AD4, 0xFC0ABA74, 0x25A7EC17, 0x7C764803,
+   0x48879BC8, 0x7532D75F, 0x58CE6BC1, 0xEA7EACC0,
+   0x8E896C16, 0xC82176B4, 0x2C750FED, 0x9A30E0B2,
+   //Window 57
+   0x421D3AA4, 0xC37E2C2E, 0xE84FA840, 0xF926407C,
+   0x1454E41C, 0x18ABC03D, 0x3F7AF644, 0x26605ECD,
+   0xD6A5EABF, 0x242341A6, 0x216B668E, 0x1EDB84F4,
+   0x04010102, 0xD836EDB8, 0x945E1D8C, 0x5B337CE7,
+   0xDA9F3804, 0x349AE368, 0xA164349C, 0x470F07FE,
+   0x8562BAA5, 0xD52F4CC9, 0x2B290DF3, 0xC74A9E86,
+   0x43471A24, 0xD3A1AA35, 0xB8194511, 0x239446BE,
+   0x81DCD44D, 0xBEC2DD00, 0xC42AC82D, 0xCA3D7F0F,
+   0x9B583160, 0xB418C2A6, 0xB4E59194, 0xBE74FCD4,
+   0x3C83E3FF, 0xF178EEAA, 0xE296F29B, 0xE051F895,
+   0x06CEB84A, 0xD0235238, 0xE111FE6B, 0x5ACE48CE,
+   0x1C045545, 0x40E43A49, 0xDD522146, 0xF3FA86DD,
+   0xEC222BA0, 0x2D9794C1, 0x523E5D48, 0xC3DFF42F,
+   0x0FE4846B, 0x4A7CD570, 0xFF135174, 0xEFC5B113,
+   0xC6B05E85, 0x2630B25B, 0x654CD077, 0x0A6D3029,
+   0x32D8B89D, 0xB4F1F54F, 0x1627FC27, 0xDE3BAFF2,
+   0xA4A2DF3E, 0xB883B83B, 0x44E5A363, 0x045B7CC2,
+   0x4E0D96DE, 0xA42BD773, 0x8D93C165, 0xB9257547,
+   0x73C8138E, 0xE8F90126, 0x607D84BF, 0x5A8EE74D,
+   0x49EA4363, 0x1BECBB50, 0x5ADA3286, 0x1D4B6114,
+   0xF1D96994, 0xCDF32D65, 0xB75B2B18, 0x8BB3D8F3,
+   0xCB307798, 0x5A95D2A3, 0xCB15A8B5, 0xDF8629CC,
+   0x548C4926, 0x375BDCBE, 0x3C25B3A6, 0x94AD58C6,
+   0x8FAC4888, 0xE94E0D52, 0x69BA5BE3, 0x9CBE7746,
+   0x782FEDC1, 0x04C16DE7, 0x093AE7C4, 0xFEE2C11A,
+   0x3DDE90B1, 0x357A7D85, 0xCE6923DC, 0x68136AF2,
+   0x8E864536, 0x0AAA9B44, 0xFEAA1C2F, 0x16B53452,
+   0x5946D955, 0xE8F494D1, 0x3B1569E3, 0xB5311651,
+   0x4E1B623B, 0x9F310D42, 0x816266A5, 0xF045749B,
+   0xA0DB7827, 0x944FD751, 0x681D7259, 0x80120DA6,
+   0x31A9C588, 0x00CDD20D, 0x97AE4BF1, 0x7BF2ABD3,
+   0x6B08C06A, 0xF75A2290, 0x4A12DC8B, 0x0FA3E584,
+   //Window 58
+   0xF23F2D92, 0x91213462, 0x60B94078, 0x6CAB71BD,
+   0x176CDE20, 0x6BDD0A63, 0xEE4D54BC, 0x54C9B20C,
+   0x9F2AC02F, 0x3CD2D8AA, 0x206EEDB0, 0x03F8E617,
+   0x93086434, 0xC7F68E16, 0x92DD3DB9, 0x831469C5,
+   0xE36D0757, 0x4A9090CD, 0xD9A29382, 0xF722D7B1,
+   0x04B48DDF, 0xFB7FB04C, 0xEBE16F43, 0x628AD2A7,
+   0x20226040, 0xCD3FBFB5, 0x5104B6C4, 0x6C34ECB1,
+   0xC903C188, 0x30C0754E, 0x2D23CAB0, 0xEC336B08,
+   0xCBB13D1B, 0xD213F923, 0x5BFB9BFE, 0x98799F42,
+   0x701144A9, 0x1AE8DDC9, 0x4C5595EE, 0x0B8B3BB6,
+   0x3ECEBB21, 0x0EA9EF2E, 0x3671F9A7, 0x17CB6C4B,
+   0x726F1D1F, 0x47EF464F, 0x6943A276, 0x171B9484,
+   0xA607419D, 0xC9941109, 0xBB6BCA80, 0xFAA71E62,
+   0x07C431F3, 0x34158C13, 0x992BC47A, 0x594ABEBC,
+   0xEB78399F, 0x6DFEA691, 0x3F42CBA4, 0x48AAFB35,
+   0x077C04F0, 0xEDCD65AF, 0xE884491A, 0x1A29A366,
+   0xF7EA25AA, 0x7BF6A5C1, 0xFBB07D5F, 0xD165E6BF,
+   0x89E78671, 0xE3539361, 0x2BAC4219, 0xA3FCAC89,
+   0xF0BAA8AB, 0xDFAB6FD4, 0xE2C1C2E5, 0x5A4ADAC1,
+   0x40D85849, 0x6CD75E31, 0x19B39181, 0xCE263FEA,
+   0x9A29A5C5, 0xE042ECE5, 0x3B6C8402, 0xB19B3C07,
+   0x19D92684, 0xC97667C7, 0xEBC66372, 0xB5624622,
+   0x3C04FA02, 0x0CB96E65, 0x8EAA39AA, 0x83A7176C,
+   0xEAA1633F, 0x2033561D, 0x4533DF73, 0x45A9D086,
+   0x5ECE6E7C, 0xA29AE9DF, 0x0FACFB55, 0x0603AC8F,
+   0xDDA233A5, 0xCFE85B7A, 0xBD75F0B8, 0xE618919F,
+   0x99BF1603, 0xF555A3D2, 0xF184255A, 0x1F43AFC9,
+   0x319A3E02, 0xDCDAF341, 0x03903A39, 0xD3B117EF,
+   0x4D82F4C2, 0xB6B82FA7, 0x6804EFB3, 0x90725A60,
+   0xADC3425E, 0xBC82EC46, 0x2787843E, 0xB7B80581,
+   0xDD1FC74C, 0xDF46D91C, 0xE783A6C4, 0xDC1C62CB,
+   0x1A04CBBA, 0x59D1B9F3, 0x95E40764, 0xD87F6F72,
+   //Window 59
+   0x1E84E0E5, 0x19686041, 0xAEA34C93, 0xA5DB84D3,
+   0x7073A732, 0xF9D5BB19, 0x6BCFD7C0, 0xB8D2FE56,
+   0xF3EB82FA, 0x45775F36, 0xFDFF8B58, 0x8CB20CCC,
+   0x8374C110, 0x1659B65F, 0x330C789A, 0xB8B4A422,
+   0xCAB91F1E, 0x2D500910, 0x4D1CD216, 0xBEDD9E44,
+   0xEDD02252, 0xD634B74F, 0x1258617A, 0xBD60F8E1,
+   0x9E05614A, 0xD8C7537B, 0xE7AF5FC5, 0xFD26C766,
+   0x582BD926, 0x0660B581, 0xACF07FC8, 0x87019244,
+   0x0A981B0D, 0x0BA4E352, 0xBD1A41A4, 0x1C354CB3,
+   0xDF9FAB9C, 0x1AABAA3A, 0x53C418D5, 0x0701A7D1,
+   0xDCF2B921, 0xDD1A7CEF, 0xBCF48061, 0x6CEEF0B3,
+   0xDE25CCE6, 0x1083B598, 0xE90A5E34, 0x890A54C7,
+   0x048752A1, 0xC59EED6C, 0xA01341B4, 0x41F2702E,
+   0x9DC6B092, 0x6E35903B, 0x1F5B5B23, 0x4291ABA8,
+   0xA653D61D, 0x8173AA70, 0x4F2EB51E, 0xD1B648D4,
+   0x5AB93F8F, 0x31B7CE06, 0x99E2F4FE, 0xA55408EE,
+   0xE1E54549, 0x6CEBF355, 0xAA88ED82, 0x3C755EB7,
+   0x98C9932F, 0x79D0A889, 0xCB5095E6, 0x0636AEC2,
+   0x95259F8C, 0x28241A94, 0xA63914A7, 0xA6B7ABAD,
+   0xB3D2A13A, 0x2F81EB0B, 0xBECF1412, 0x9B07A130,
+   0xC94A5F66, 0x76B68F4F, 0x5390D72F, 0xEF2B23A0,
+   0x59571E9E, 0xAB344487, 0xC1582591, 0x471A9079,
+   0x2646F3A4, 0x01567C3B, 0xA6297BCA, 0x8CB1F6B4,
+   0x68361444, 0xF4F61DEB, 0x4CCEAD70, 0x2FECE80A,
+   0x0E929D5F, 0xF2D5A54F, 0xC4D21650, 0x601100B7,
+   0x6928BAB8, 0xDF34E650, 0x42DBAEB3, 0xD6124E56,
+   0xD5FE5707, 0xAC71EFE7, 0x7E39D411, 0xE466EC8F,
+   0x8BEB7402, 0x8AF72D26, 0x7F05AB44, 0x96B273B6,
+   0x055DE17D, 0x2155F57C, 0x9A1FFB31, 0xFA8D1F52,
+   0x8434D03C, 0xA31B81AA, 0x38EDA0CA, 0x8F849420,
+   0x8A81D2EC, 0x03E5F820, 0x201C2829, 0xD018C8E3,
+   0x6A22433C, 0xBC101C4E, 0xFBE89805, 0xCC2AC6B8,
+   //Window 60
+   0x1F095615, 0x1083E2EA, 0x14E68C33, 0x0A28AD77,
+   0x3D8818BE, 0x6BFC0252, 0xF35850CD, 0xB585113A,
+   0x30DF8AA1, 0x7D935F0B, 0x4AB7E3AC, 0xADDDA07C,
+   0x552F00CB, 0x92C34299, 0x2909DF6C, 0xC33ED1DE,
+   0x83CDD60E, 0xABE7905A, 0xA1170184, 0x50602FB5,
+   0xB023642A, 0x689886CD, 0xA6E1FB00, 0xD568D090,
+   0x0259217F, 0x5B1922C7, 0xC43141E4, 0x93831CD9,
+   0x0C95F86E, 0xDFCA3587, 0x568AE828, 0xDEC2057A,
+   0x42E06189, 0x860D523D, 0x4E3AFF13, 0xBF077941,
+   0xC1B20650, 0x0B616DCA, 0x2131300D, 0xE66DD6D1,
+   0xFF99ABDE, 0xD4A0FD67, 0xC7AAC50D, 0xC9903550,
+   0x7C46B2D7, 0x022ECF8B, 0x3ABF92AF, 0x3333B1E8,
+   0xBE42A582, 0xEFECDEF7, 0x65046BE6, 0xD3FC6080,
+   0x09E8DBA9, 0xC9AF13C8, 0x641491FF, 0x1E6C9847,
+   0xD30C31F7, 0x3B574925, 0xAC2A2122, 0xB7EB72BA,
+   0xEF0859E7, 0x776A0DAC, 0x21900942, 0x06FEC314,
+   0xF4737F21, 0x7EC62FBB, 0x6209F5AC, 0xD8DBA5AB,
+   0xA5F9ADBE, 0x24B5D7A9, 0xA61DC768, 0x707D28F7,
+   0xCAA999EA, 0x7711460B, 0x1C92E4CC, 0xBA7B174D,
+   0x18D4BF2D, 0x3C4BAB66, 0xEB8BD279, 0xB8F0C980,
+   0xC0519A23, 0x28D675B2, 0x4F6952E3, 0x9EBF94FE,
+   0xA2294A8A, 0xF28BB767, 0xFE0AF3F5, 0x85512B4D,
+   0x99B16A0D, 0x18958BA8, 0xBA7548A7, 0x95C2430C,
+   0xA16BE615, 0xB30D1B10, 0x85BFB74C, 0xE3EBBB97,
+   0xD2FDCA23, 0x81EEB865, 0xCC8EF895, 0x5A15EE08,
+   0x01905614, 0x768FA10A, 0x880EE19B, 0xEFF5B8EF,
+   0xCB1C8A0E, 0xF0C0CABB, 0xB8C838F9, 0x2E1EE9CD,
+   0x8A4A14C0, 0x0587D8B8, 0x2FF698E5, 0xF6F27896,
+   0x9E2FCE99, 0x9C4B646E, 0x1E80857F, 0x68A21081,
+   0x3643B52A, 0x06D54E44, 0x0D8EB843, 0xDE8D6D63,
+   0x42146A0A, 0x70321563, 0x5EAA3622, 0x8BA826F2,
+   0x86138787, 0x227A58BD, 0x10281D37, 0x43B6C03C,
+   //Window 61
+   0x2F41DEFF, 0x02B37A95, 0xE63B89B7, 0x0E44A59A,
+   0x143FF951, 0x673257DC, 0xD752BAF4, 0x19C02205,
+   0xC4B7D692, 0x46C23069, 0xFD1502AC, 0x2E6392C3,
+   0x1B220846, 0x6057B1A2, 0x0C1B5B63, 0xE51FF946,
+   0x5B0F7BD4, 0xB9DC857C, 0x108EA1CD, 0x6990C2C9,
+   0xB984C7A9, 0x84730B83, 0xEAB18A78, 0x552723D2,
+   0x919BA0F9, 0x9752C2E2, 0x4BF40890, 0x075A3BD9,
+   0xA6D98212, 0x71E52A04, 0x9F18A4C8, 0x3FB6607A,
+   0x6CE400BB, 0xF47B7521, 0xCAF07D99, 0xF72919F7,
+   0x00CE62E0, 0x95B86E06, 0x8FCFD00E, 0x11872BAF,
+   0x211F7DC6, 0x049B21EB, 0x54EBD6F6, 0xB8900E56,
+   0x162D78DA, 0x7C38CEA4, 0x0BFA3DA0, 0x9A586C9E,
+   0x51C3EBE5, 0xAD3883E1, 0xD25D7BE8, 0xDB14D5C7,
+   0x558EA8C9, 0x23E44911, 0x3F45C6AB, 0x3A68529F,
+   0x149F75B8, 0xEB18A1DC, 0x079C7CB2, 0x9B8946A1,
+   0x1157A94E, 0x27AD2A19, 0x1106F85A, 0x84B14F46,
+   0xE685F58A, 0x34540E92, 0x0DD396F9, 0x6B2ECA2C,
+   0xBA86B4B4, 0xA7531847, 0xCC32DFFF, 0xA4BF77F2,
+   0x707A589D, 0x7BE46014, 0x6DCDBF0C, 0x04989252,
+   0x7CF9CA06, 0x5473994A, 0xB401B3E4, 0x02B853CA,
+   0x272CFC4B, 0x159850D3, 0x3B9B6B67, 0x7F8E93F7,
+   0x7AED726B, 0xEADC4B67, 0xFB92B8A7, 0x40B51984,
+   0xA0752DB1, 0xB11764DD, 0xC31F3E4C, 0x36B8205C,
+   0x76E40A6B, 0xB3C073E6, 0x893098D2, 0x7BB541A4,
+   0x86CCCE69, 0x8C3A96A9, 0x18C523C6, 0x025D6203,
+   0xE80886A7, 0xDEC1906A, 0xE126262B, 0x6CD6229C,
+   0xAE881C98, 0x8053143A, 0x286CC2C7, 0x0189394A,
+   0xDEA7FCF1, 0x9E3EE0E0, 0x2AE8C723, 0xF06F9B7A,
+   0x5F13ED61, 0xB460A58B, 0x74EA1318, 0x4C571D3B,
+   0xB1F15DC9, 0x39BBBFA7, 0xD2DC20E4, 0xBF12B379,
+   0xAC517DE3, 0x5C213CCB, 0x1BCF5A41, 0x5462C161,
+   0x17C5752D, 0x1F4CE6AE, 0x430B7995, 0x34979D29,
+   //Window 62
+   0xEE3C76CB, 0xF306A3C8, 0xD32A1F6E, 0x3CF11623,
+   0x6863E956, 0xE6D5AB64, 0x5C005C26, 0x3B8A4CBE,
+   0x9CE6BB27, 0xDCD529A5, 0x04D4B16F, 0xC4AFAA52,
+   0x7923798D, 0xB0624A26, 0x6B307FAB, 0x85E56DF6,
+   0x9884AAF7, 0x89689595, 0x07B348A6, 0xB1959BE3,
+   0x3C147C87, 0x96250E57, 0xDD0C61F8, 0xAE0EFB3A,
+   0xCA8C325E, 0xED00745E, 0xECFF3F70, 0x3C911696,
+   0x319AD41D, 0x73ACBC65, 0xF0B1C7EF, 0x7B01A020,
+   0x224C08DC, 0x262143B5, 0x81B50C91, 0x2BBB09B4,
+   0xACA8C84F, 0xC16ED709, 0xB2850CA8, 0xA6210D9D,
+   0x09CB54D6, 0x6D8DF67A, 0x500919A4, 0x91EEF6E0,
+   0x0F132857, 0x90F61381, 0xF8D5028B, 0x9ACEDE47,
+   0xDE673629, 0x45E21446, 0x703C2D21, 0x57F7AA1E,
+   0x98C868C7, 0xA0E99B7F, 0x8B641676, 0x4E42F66D,
+   0x91077896, 0x602884DC, 0xC2C9885B, 0xA0D690CF,
+   0x3B9A5187, 0xFEB4DA33, 0x153C87EE, 0x5F789598,
+   0xCA66ECA8, 0xB19B1C4F, 0x5663DE54, 0xF04A20B5,
+   0xC223B617, 0x42A29A33, 0x44827E11, 0x86C68D0D,
+   0xADBA1206, 0x71F90DDE, 0x7A6CEEEA, 0xEEFFB416,
+   0xC543E8AF, 0x9E302FBA, 0x1AA77B96, 0xCF07F747,
+   0x475952AF, 0x5FD7CAFB, 0x54A43337, 0x23A6D719,
+   0xB1617941, 0xA83A7523, 0x12B37DD4, 0x0B7F35D4,
+   0x2AE27EAF, 0x81EC5129, 0x318169DF, 0x7CA92FB3,
+   0x78D0875A, 0xC01BFD60, 0xC99C436E, 0xCC6074E3,
+   0xF57912B8, 0x4CA6BDEB, 0x98507B5A, 0x9A17577E,
+   0x59E51DFC, 0x8ED4AB77, 0x470F5A36, 0x103B7B2A,
+   0x12553321, 0x0C8545AC, 0x60482817, 0xAB5861A7,
+   0xB9B856CF, 0xF4B5F602, 0x7ADF2E5F, 0x60995578,
+   0xEE5CB44F, 0x60CE25B1, 0x2C2D7598, 0xDDCC7D18,
+   0x01847B5C, 0x1765A1B3, 0x5D0D23B7, 0xF5D9C363,
+   0x928B65D0, 0x42FF1BA7, 0x6148E043, 0x587AC69D,
+   0xD320390B, 0x3099BE0D, 0x4278329F, 0xA7B88DFC,
+   //Window 63
+   0x1EC34F9E, 0x80802DC9, 0x33810603, 0xD8772D35,
+   0x530CB4F3, 0x3F06D66C, 0xC475C129, 0x7BE5ED0D,
+   0x31E82B10, 0xCB9E3C19, 0xC9FF6B4C, 0xC63D2857,
+   0x92A1B45E, 0xB92118C6, 0x7285BBCA, 0x0AEC4414,
+   0x2B724759, 0xAE485BB7, 0xB2D4C63A, 0x945353E1,
+   0xDE7D6F2C, 0x82159D07, 0x4EC5B109, 0x389CAEF3,
+   0xDB65EF14, 0x4A8EBB53, 0xDD99DE43, 0x2DC2CB7E,
+   0x83F2405F, 0x816FA3ED, 0xC14208A3, 0x73429BB9,
+   0xFB85FA4C, 0xB1E13752, 0x383C8CE9, 0xD61257CE,
+   0xD2F74DAE, 0xD43DA670, 0xBF846BBB, 0xA35AA23F,
+   0x4421FC83, 0x5E74235D, 0xC363473B, 0xF6DF8EE0,
+   0x3C4AA158, 0x34D7F52A, 0x9BC6D22E, 0x50D05AAB,
+   0xCC1B5E83, 0xC370E522, 0x860B8BFB, 0xDE2D4AD1,
+   0x67B256DF, 0xAD364DF0, 0xE0138997, 0x8F12502E,
+   0x7783920A, 0x503FA0DC, 0xC0BC866A, 0xE80014AD,
+   0xD3064BA6, 0x3F89B744, 0xCBA5DBA5, 0x03511DCD,
+   0x31890A36, 0x805C5646, 0x57FEEA5B, 0x703EF600,
+   0xAF3C3030, 0x389F747C, 0x54DD3739, 0xE0E5DAEB,
+   0xC9C9F155, 0xFE24A4C3, 0xB5393962, 0x7E4BF176,
+   0xAF20BF29, 0x37183DE2, 0xF95A8C3B, 0x4A1BD7B5,
+   0xD785E73D, 0x5FE5691E, 0x2EA60467, 0xA5DB5AB6,
+   0xDFC6514A, 0x02E23D41, 0xE03C3665, 0x35E8048E,
+   0x1ADAA0F8, 0x3F8B118F, 0x84CE1A5A, 0x28EC3B45,
+   0x2C6646B8, 0xE8CACC6E, 0xDBD0E40F, 0x1343D185,
+   0xC23FC975, 0x8C885312, 0x05D6297B, 0x15715806,
+   0xF78EDD39, 0xA078868E, 0x03C45E52, 0x956B31E0,
+   0xFF7B33A6, 0x470275D5, 0x0C7E673F, 0xC8D5DC3A,
+   0x7E2F2598, 0x419227B4, 0x4C14A975, 0x8B37B634,
+   0xA36A2737, 0xA857240F, 0x63621BC1, 0x35DC1366,
+   0xD4FB6897, 0x7A3A6453, 0xC929319D, 0x80F1A439,
+   0xF8CB0BA0, 0xFC18274B, 0x8078C5EB, 0xB0B53766,
+   0x1E01D0EF, 0xFB0D4924, 0x372AB09C, 0x50D7C67D
+};
+
+#endif
+#endif
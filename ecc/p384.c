@@ -0,0 +1,575 @@
+/**
+ * @file p384.c
+ * @brief Dedicated secp384r1 (NIST P-384) implementation
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * Field elements are stored as 12 words of 32 bits. Products are reduced
+ * with the fast reduction for generalized Mersenne (Solinas) primes, using
+ * only word additions and subtractions.
+ * The point arithmetic and the scalar multiplication are shared with the
+ * other NIST curves (refer to ec_nist.c)
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec.h"
+#include "ecc/ec_nist.h"
+#include "ecc/p384.h"
+#include "ecc/p384_table.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (EC_SUPPORT == ENABLED && SECP384R1_SUPPORT == ENABLED && \
+   P384_SUPPORT == ENABLED)
+
+//Number of windows used by the scalar multiplication
+#define P384_NUM_WINDOWS 96
+
+//Prime modulus p
+static const uint32_t P384_P[12] =
+{
+   0xFFFFFFFF, 0x00000000, 0x00000000, 0xFFFFFFFF,
+   0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+//Exponent used to compute modular inverses (p - 2)
+static const uint32_t P384_P_MINUS_2[12] =
+{
+   0xFFFFFFFD, 0x00000000, 0x00000000, 0xFFFFFFFF,
+   0xFFFFFFFE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+//Curve parameter b
+static const uint32_t P384_B[12] =
+{
+   0xD3EC2AEF, 0x2A85C8ED, 0x8A2ED19D, 0xC656398D,
+   0x5013875A, 0x0314088F, 0xFE814112, 0x181D9C6E,
+   0xE3F82D19, 0x988E056B, 0xE23EE7E4, 0xB3312FA7
+};
+
+//Order of the base point q
+static const uint32_t P384_Q[12] =
+{
+   0xCCC52973, 0xECEC196A, 0x48B0A77A, 0x581A0DB2,
+   0xF4372DDF, 0xC7634D81, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF
+};
+
+//Value 1
+static const uint32_t P384_ONE[12] =
+{
+   0x00000001, 0x00000000, 0x00000000, 0x00000000,
+   0x00000000, 0x00000000, 0x00000000, 0x00000000,
+   0x00000000, 0x00000000, 0x00000000, 0x00000000
+};
+
+//Base point G (affine coordinates)
+static const uint8_t P384_G[96] =
+{
+   0xAA, 0x87, 0xCA, 0x22, 0xBE, 0x8B, 0x05, 0x37, 0x8E, 0xB1, 0xC7, 0x1E, 0xF3, 0x20, 0xAD, 0x74,
+   0x6E, 0x1D, 0x3B, 0x62, 0x8B, 0xA7, 0x9B, 0x98, 0x59, 0xF7, 0x41, 0xE0, 0x82, 0x54, 0x2A, 0x38,
+   0x55, 0x02, 0xF2, 0x5D, 0xBF, 0x55, 0x29, 0x6C, 0x3A, 0x54, 0x5E, 0x38, 0x72, 0x76, 0x0A, 0xB7,
+   0x36, 0x17, 0xDE, 0x4A, 0x96, 0x26, 0x2C, 0x6F, 0x5D, 0x9E, 0x98, 0xBF, 0x92, 0x92, 0xDC, 0x29,
+   0xF8, 0xF4, 0x1D, 0xBD, 0x28, 0x9A, 0x14, 0x7C, 0xE9, 0xDA, 0x31, 0x13, 0xB5, 0xF0, 0xB8, 0xC0,
+   0x0A, 0x60, 0xB1, 0xCE, 0x1D, 0x7E, 0x81, 0x9D, 0x7A, 0x43, 0x1D, 0x7C, 0x90, 0xEA, 0x0E, 0x5F
+};
+
+//Dedicated secp384r1 implementation
+static const EcNistCurve p384Curve =
+{
+   P384_WORD_LEN,
+   P384_BYTE_LEN,
+   P384_BIT_LEN,
+   P384_NUM_WINDOWS,
+   P384_Q,
+   P384_B,
+   P384_ONE,
+   NULL,
+   P384_G,
+#if (EC_NIST_BASE_TABLE_SUPPORT == ENABLED)
+   P384_BASE_TABLE,
+#else
+   NULL,
+#endif
+   p384Add,
+   p384Sub,
+   p384Mul,
+   p384Inv,
+   p384Import,
+   p384Export
+};
+
+
+/**
+ * @brief Check whether the domain parameters match secp384r1
+ * @param[in] params EC domain parameters
+ * @return TRUE if the dedicated implementation can be used, else FALSE
+ **/
+
+bool_t p384IsCurve(const EcDomainParameters *params)
+{
+   bool_t res;
+
+   //Check curve name
+   if(params->name != NULL && !osStrcmp(params->name, "secp384r1"))
+   {
+      res = TRUE;
+   }
+   else
+   {
+      res = FALSE;
+   }
+
+   //Return TRUE if the domain parameters match secp384r1
+   return res;
+}
+
+
+/**
+ * @brief Set integer value
+ * @param[out] a Pointer to the integer to be initialized
+ * @param[in] b Initial value
+ **/
+
+void p384SetInt(uint32_t *a, uint32_t b)
+{
+   uint_t i;
+
+   //Set the value of the least significant word
+   a[0] = b;
+
+   //Initialize the rest of the integer
+   for(i = 1; i < 12; i++)
+   {
+      a[i] = 0;
+   }
+}
+
+
+/**
+ * @brief Modular reduction
+ * @param[out] r Resulting integer R = (H * 2^384 + A) mod p
+ * @param[in] a Low part of the integer
+ * @param[in] h High part of the integer (0 or 1)
+ **/
+
+static void p384Red(uint32_t *r, const uint32_t *a, uint32_t h)
+{
+   uint_t i;
+   int64_t temp;
+   uint32_t b[12];
+
+   //Compute B = A - P
+   for(temp = 0, i = 0; i < 12; i++)
+   {
+      temp += a[i];
+      temp -= P384_P[i];
+      b[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //Take into account the high part of the integer
+   temp += h;
+
+   //If H * 2^384 + A < P then R = A, else R = B
+   p384Select(r, b, a, temp & 1);
+}
+
+
+/**
+ * @brief Modular addition
+ * @param[out] r Resulting integer R = (A + B) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void p384Add(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+   uint64_t temp;
+   uint32_t u[12];
+
+   //Compute U = A + B
+   for(temp = 0, i = 0; i < 12; i++)
+   {
+      temp += a[i];
+      temp += b[i];
+      u[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //Perform modular reduction
+   p384Red(r, u, (uint32_t) temp);
+}
+
+
+/**
+ * @brief Modular subtraction
+ * @param[out] r Resulting integer R = (A - B) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void p384Sub(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+   int64_t temp;
+   uint32_t mask;
+   uint32_t u[12];
+
+   //Compute U = A - B
+   for(temp = 0, i = 0; i < 12; i++)
+   {
+      temp += a[i];
+      temp -= b[i];
+      u[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //The mask is the all-1 word if the result is negative
+   mask = (uint32_t) temp;
+
+   //If U < 0 then R = U + P, else R = U
+   for(temp = 0, i = 0; i < 12; i++)
+   {
+      temp += u[i];
+      temp += P384_P[i] & mask;
+      r[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+}
+
+
+/**
+ * @brief Fast modular reduction
+ * @param[out] r Resulting integer R = U mod p
+ * @param[in] u An integer such as 0 <= U < p^2
+ **/
+
+static void p384Reduce(uint32_t *r, const uint32_t *u)
+{
+   uint_t i;
+   uint_t j;
+   int64_t c;
+   int64_t temp;
+   uint32_t v[12];
+
+   //Compute T + 2.S1 + S2 + S3 + S4 + S5 + S6 - D1 - D2 - D3, where the
+   //terms are formed from the 32-bit words of U (refer to FIPS 186-4,
+   //section D.2.4)
+   temp = (int64_t) u[0] + u[12] + u[20] + u[21] - u[23];
+   v[0] = temp & 0xFFFFFFFF;
+   temp >>= 32;
+   temp += (int64_t) u[1] + u[13] + u[22] + u[23] - u[12] - u[20];
+   v[1] = temp & 0xFFFFFFFF;
+   temp >>= 32;
+   temp += (int64_t) u[2] + u[14] + u[23] - u[13] - u[21];
+   v[2] = temp & 0xFFFFFFFF;
+   temp >>= 32;
+   temp += (int64_t) u[3] + u[12] + u[15] + u[20] + u[21] - u[14] - u[22] -
+      u[23];
+   v[3] = temp & 0xFFFFFFFF;
+   temp >>= 32;
+   temp += (int64_t) u[4] + u[12] + u[13] + u[16] + u[20] + u[21] + u[21] +
+      u[22] - u[15] - u[23] - u[23];
+   v[4] = temp & 0xFFFFFFFF;
+   temp >>= 32;
+   temp += (int64_t) u[5] + u[13] + u[14] + u[17] + u[21] + u[22] + u[22] +
+      u[23] - u[16];
+   v[5] = temp & 0xFFFFFFFF;
+   temp >>= 32;
+   temp += (int64_t) u[6] + u[14] + u[15] + u[18] + u[22] + u[23] + u[23] -
+      u[17];
+   v[6] = temp & 0xFFFFFFFF;
+   temp >>= 32;
+   temp += (int64_t) u[7] + u[15] + u[16] + u[19] + u[23] - u[18];
+   v[7] = temp & 0xFFFFFFFF;
+   temp >>= 32;
+   temp += (int64_t) u[8] + u[16] + u[17] + u[20] - u[19];
+   v[8] = temp & 0xFFFFFFFF;
+   temp >>= 32;
+   temp += (int64_t) u[9] + u[17] + u[18] + u[21] - u[20];
+   v[9] = temp & 0xFFFFFFFF;
+   temp >>= 32;
+   temp += (int64_t) u[10] + u[18] + u[19] + u[22] - u[21];
+   v[10] = temp & 0xFFFFFFFF;
+   temp >>= 32;
+   temp += (int64_t) u[11] + u[19] + u[20] + u[23] - u[22];
+   v[11] = temp & 0xFFFFFFFF;
+   temp >>= 32;
+
+   //The remaining carry is a small signed integer. Since 2^384 is congruent
+   //to 2^128 + 2^96 - 2^32 + 1 modulo p, it can be folded back into the
+   //lower part. Two passes are sufficient to absorb it completely
+   for(j = 0; j < 2; j++)
+   {
+      //Save the carry
+      c = temp;
+
+      //Compute V = V + C * (2^128 + 2^96 - 2^32 + 1)
+      for(temp = 0, i = 0; i < 12; i++)
+      {
+         temp += v[i];
+
+         //Add or subtract the carry at the relevant positions
+         if(i == 0 || i == 3 || i == 4)
+         {
+            temp += c;
+         }
+         else if(i == 1)
+         {
+            temp -= c;
+         }
+
+         v[i] = temp & 0xFFFFFFFF;
+         temp >>= 32;
+      }
+   }
+
+   //The intermediate result is in the range 0 <= V < 2^384 < 2p
+   p384Red(r, v, 0);
+}
+
+
+/**
+ * @brief Modular multiplication
+ * @param[out] r Resulting integer R = (A * B) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void p384Mul(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+   uint_t j;
+   uint64_t c;
+   uint32_t u[24];
+
+   //Initialize the product
+   for(i = 0; i < 24; i++)
+   {
+      u[i] = 0;
+   }
+
+   //Compute U = A * B
+   for(i = 0; i < 12; i++)
+   {
+      for(c = 0, j = 0; j < 12; j++)
+      {
+         c += (uint64_t) a[j] * b[i] + u[i + j];
+         u[i + j] = c & 0xFFFFFFFF;
+         c >>= 32;
+      }
+
+      u[i + 12] = (uint32_t) c;
+   }
+
+   //Perform fast modular reduction
+   p384Reduce(r, u);
+}
+
+
+/**
+ * @brief Modular squaring
+ * @param[out] r Resulting integer R = (A ^ 2) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ **/
+
+void p384Sqr(uint32_t *r, const uint32_t *a)
+{
+   //Compute R = A ^ 2
+   p384Mul(r, a, a);
+}
+
+
+/**
+ * @brief Modular multiplicative inverse
+ * @param[out] r Resulting integer R = A^-1 mod p
+ * @param[in] a An integer such as 0 <= A < p
+ **/
+
+void p384Inv(uint32_t *r, const uint32_t *a)
+{
+   int_t i;
+   uint32_t u[12];
+
+   //The exponent p - 2 is public, hence a plain square-and-multiply does not
+   //leak any information about A. The most significant bit is set
+   p384Copy(u, a);
+
+   //Compute R = A^(p - 2) mod p
+   for(i = 382; i >= 0; i--)
+   {
+      //Square
+      p384Sqr(u, u);
+
+      //Multiply
+      if(((P384_P_MINUS_2[i / 32] >> (i % 32)) & 1) != 0)
+      {
+         p384Mul(u, u, a);
+      }
+   }
+
+   //Copy the resulting value
+   p384Copy(r, u);
+}
+
+
+/**
+ * @brief Copy an integer
+ * @param[out] a Pointer to the destination integer
+ * @param[in] b Pointer to the source integer
+ **/
+
+void p384Copy(uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+
+   //Copy the value of the integer
+   for(i = 0; i < 12; i++)
+   {
+      a[i] = b[i];
+   }
+}
+
+
+/**
+ * @brief Select an integer
+ * @param[out] r Pointer to the destination integer
+ * @param[in] a Pointer to the first source integer
+ * @param[in] b Pointer to the second source integer
+ * @param[in] c Condition variable
+ **/
+
+void p384Select(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   uint32_t c)
+{
+   uint_t i;
+   uint32_t mask;
+
+   //The mask is the all-1 or all-0 word
+   mask = c - 1;
+
+   //Select between A and B
+   for(i = 0; i < 12; i++)
+   {
+      //Constant time implementation
+      r[i] = (a[i] & mask) | (b[i] & ~mask);
+   }
+}
+
+
+/**
+ * @brief Import an octet string
+ * @param[out] a Pointer to resulting integer
+ * @param[in] data Octet string to be converted (big-endian)
+ **/
+
+void p384Import(uint32_t *a, const uint8_t *data)
+{
+   uint_t i;
+
+   //Convert from big-endian byte order to host byte order
+   for(i = 0; i < 12; i++)
+   {
+      a[i] = LOAD32BE(data + 44 - i * 4);
+   }
+}
+
+
+/**
+ * @brief Export an octet string
+ * @param[in] a Pointer to the integer to be exported
+ * @param[out] data Octet string resulting from the conversion (big-endian)
+ **/
+
+void p384Export(const uint32_t *a, uint8_t *data)
+{
+   uint_t i;
+
+   //Convert from host byte order to big-endian byte order
+   for(i = 0; i < 12; i++)
+   {
+      STORE32BE(a[i], data + 44 - i * 4);
+   }
+}
+
+
+/**
+ * @brief Scalar multiplication
+ * @param[out] r Resulting point R = d.S
+ * @param[in] d An integer d such as 0 <= d < 2^384
+ * @param[in] s EC point
+ * @return Error code
+ **/
+
+error_t p384Mult(EcPoint *r, const Mpi *d, const EcPoint *s)
+{
+   //Use the common NIST curve layer
+   return ecNistMult(&p384Curve, r, d, s);
+}
+
+
+/**
+ * @brief Precompute the multiples of a point
+ * @param[out] table Table of precomputed multiples
+ * @param[in] s EC point (affine coordinates)
+ * @return Error code
+ **/
+
+error_t p384BuildTable(EcBaseTable *table, const EcPoint *s)
+{
+   //Use the common NIST curve layer
+   return ecNistBuildTable(&p384Curve, table, s);
+}
+
+
+/**
+ * @brief Twin multiplication with the base point
+ * @param[out] r Resulting point R = d0.G + d1.T (Jacobian coordinates)
+ * @param[in] d0 An integer d such as 0 <= d0 < 2^384
+ * @param[in] d1 An integer d such as 0 <= d1 < 2^384
+ * @param[in] t EC point (affine coordinates)
+ * @param[in] table Precomputed multiples of T (optional parameter)
+ * @return Error code
+ **/
+
+error_t p384TwinMultBase(EcPoint *r, const Mpi *d0, const Mpi *d1,
+   const EcPoint *t, const EcBaseTable *table)
+{
+   //Use the common NIST curve layer
+   return ecNistTwinMultBase(&p384Curve, r, d0, d1, t, table);
+}
+
+#endif
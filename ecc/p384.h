@@ -0,0 +1,86 @@
+/**
+ * @file p384.h
+ * @brief Dedicated secp384r1 (NIST P-384) implementation
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+#ifndef _P384_H
+#define _P384_H
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec.h"
+
+//Dedicated secp384r1 implementation
+#ifndef P384_SUPPORT
+   #define P384_SUPPORT ENABLED
+#elif (P384_SUPPORT != ENABLED && P384_SUPPORT != DISABLED)
+   #error P384_SUPPORT parameter is not valid
+#endif
+
+//Length of the elliptic curve
+#define P384_BIT_LEN 384
+#define P384_BYTE_LEN 48
+#define P384_WORD_LEN 12
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+//secp384r1 related functions
+bool_t p384IsCurve(const EcDomainParameters *params);
+
+error_t p384Mult(EcPoint *r, const Mpi *d, const EcPoint *s);
+
+error_t p384BuildTable(EcBaseTable *table, const EcPoint *s);
+
+error_t p384TwinMultBase(EcPoint *r, const Mpi *d0, const Mpi *d1,
+   const EcPoint *t, const EcBaseTable *table);
+
+void p384SetInt(uint32_t *a, uint32_t b);
+void p384Add(uint32_t *r, const uint32_t *a, const uint32_t *b);
+void p384Sub(uint32_t *r, const uint32_t *a, const uint32_t *b);
+void p384Mul(uint32_t *r, const uint32_t *a, const uint32_t *b);
+void p384Sqr(uint32_t *r, const uint32_t *a);
+void p384Inv(uint32_t *r, const uint32_t *a);
+
+void p384Copy(uint32_t *a, const uint32_t *b);
+
+void p384Select(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   uint32_t c);
+
+void p384Import(uint32_t *a, const uint8_t *data);
+void p384Export(const uint32_t *a, uint8_t *data);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
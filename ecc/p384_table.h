@@ -0,0 +1,4760 @@
+/**
+ * @file p384_table.h
+ * @brief Precomputed multiples of the secp384r1 base point
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * This file is generated by ec_nist_tables.py and must not be edited. For
+ * each 4-bit window i, the table holds the affine coordinates of the points
+ * (2.j + 1).2^(4.i).G, where 0 <= j < 8, in the internal representation of
+ * the field (plain value)
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+#ifndef _P384_TABLE_H
+#define _P384_TABLE_H
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec_nist.h"
+#include "ecc/p384.h"
+
+//Check crypto library configuration
+#if (EC_SUPPORT == ENABLED && SECP384R1_SUPPORT == ENABLED && \
+   P384_SUPPORT == ENABLED && EC_NIST_BASE_TABLE_SUPPORT == ENABLED)
+
+//Precomputed multiples of the base point
+static const uint32_t P384_BASE_TABLE[18432] =
+{
+   //Window 0
+   0x72760AB7, 0x3A545E38, 0xBF55296C, 0x5502F25D,
+   0x82542A38, 0x59F741E0, 0x8BA79B98, 0x6E1D3B62,
+   0xF320AD74, 0x8EB1C71E, 0xBE8B0537, 0xAA87CA22,
+   0x90EA0E5F, 0x7A431D7C, 0x1D7E819D, 0x0A60B1CE,
+   0xB5F0B8C0, 0xE9DA3113, 0x289A147C, 0xF8F41DBD,
+   0x9292DC29, 0x5D9E98BF, 0x96262C6F, 0x3617DE4A,
+   0x0500C831, 0x02D7E5C7, 0x5026580D, 0xB408BBAE,
+   0xD3566DA6, 0xBEA4F240, 0x202DCD06, 0xCB9D3910,
+   0x5FDC7D98, 0x64793C7E, 0x606FFA14, 0x077A41D4,
+   0x0A2F1DF1, 0xB65F2860, 0xE4B5D298, 0xC24ABD6B,
+   0xDC111EAC, 0xF7684C0E, 0x85115AA5, 0x8520B41C,
+   0x02A9FC99, 0x7D0BBE96, 0x0B0C4283, 0xC995F7CA,
+   0x836D84BC, 0x0ABCDBC3, 0x1CA297E6, 0x37882F4A,
+   0xE56583B0, 0x4F6661CB, 0xBFF98FC5, 0xF208E51D,
+   0xA025E467, 0x573CAC5E, 0xC251C777, 0x11DE24A2,
+   0xE6C1713A, 0x184414AB, 0x0AE8FB33, 0x3177686D,
+   0xB6901AEB, 0x8C986533, 0x54D5DEE8, 0x284B4477,
+   0x0A00E7C5, 0x0F5837E9, 0x7440F92D, 0x8FA696C7,
+   0x8FB6D0E1, 0x040F05B4, 0x55B9EBB2, 0x8B05526F,
+   0xFA7B1C50, 0x2D58CC9D, 0xFBEA5FFA, 0xAD6FE997,
+   0x234EDFFE, 0xF29F8EBF, 0x65CE4788, 0x283C1D73,
+   0xC512EF8C, 0x64664CDA, 0x32A78F9E, 0x30D84EDE,
+   0x1DBD2256, 0xD9C92CD0, 0xED799729, 0x1A61D867,
+   0x8C169047, 0xBA52EFDB, 0x61E41B88, 0x9475C990,
+   0x1079118B, 0x5C55E446, 0xFEE2B953, 0xC388528B,
+   0x85FB6E21, 0xC6CB1EE2, 0x1E6FD3BA, 0x2216F729,
+   0xB025B78F, 0xF1BF29B8, 0x049BCB3E, 0x8F0A39A4,
+   0xAC664AF8, 0x262DA4F9, 0xDFD51B68, 0x9E743EFE,
+   0xAED9B302, 0xB7678854, 0xA3C400C6, 0x9A9B3D7C,
+   0x22C3A979, 0x452C4A53, 0x38B601D6, 0x62C77E14,
+   0x55B4DDD8, 0x26356F3B, 0x3AFB81D6, 0x4749B66E,
+   0x892D3F8C, 0x56C9FD14, 0x5837C374, 0x7FE935ED,
+   0x904816C5, 0xDA1EEEC2, 0x7DA7B998, 0x099056E2,
+   0x38C5E0BB, 0x7D5DBA81, 0x63AAFF35, 0x5466D512,
+   0x1B52A325, 0x43FF93F4, 0xDFC363FD, 0x6FC4EED8,
+   0x4AC5E039, 0x68850554, 0x4E30AB96, 0x2E4C0C23,
+   0x3B5CBCE7, 0xAAF1CA1E, 0xABD99F1B, 0x9EE5F441,
+   0xF0F11C13, 0x6267BCD1, 0xF01F873F, 0x9632BFF9,
+   0x2FFCC6AB, 0xAFDAF500, 0xB67AEA5B, 0xA567BA97,
+   0x36F429CC, 0x6423A127, 0x72218A7D, 0x776BCB82,
+   0x57857D66, 0x86329BE0, 0x46932EC0, 0x51855950,
+   0xAF164ECC, 0x644E4147, 0x989F3318, 0xDE1B38B3,
+   0x9606860B, 0x4B88701A, 0x10B6383B, 0xA849557A,
+   0xDA7C4E9C, 0x5B21F9F7, 0xFFF01C20, 0x22A94156,
+   0xD8135255, 0x8CC15C11, 0xB32B0105, 0xB3D13FC8,
+   0x33F7BD62, 0x985D588D, 0xB284AF50, 0x838D24F8,
+   0x73DFBFD9, 0x84D11143, 0x1D749AF4, 0xEEBAC4A1,
+   0x36164B1B, 0x1B049B25, 0xDF9162A6, 0x152919E7,
+   //Window 1
+   0x401DAFCF, 0xA462B892, 0x3D157811, 0xAC8EBC77,
+   0x28A8583B, 0xA464FA94, 0xE5152CF6, 0x6B80DFF0,
+   0xB231511A, 0x5FBD88E2, 0x5282369C, 0xD5D89C3B,
+   0xEBAB3673, 0x6822B755, 0xF49BF223, 0xD1210CB8,
+   0x440A7ABA, 0x9CABA57E, 0x0E2A3BDB, 0xD41D4FC4,
+   0x9A9448F1, 0x41816D5E, 0xE12906D2, 0xD815229D,
+   0x222C0089, 0x68701396, 0x2CA537CC, 0x66629C44,
+   0x98C46ACE, 0x1FCABE37, 0x30305030, 0x8642EB77,
+   0xB4EDDE39, 0xC7D895A5, 0xBFE2CDFE, 0xEB967D99,
+   0x8CB58F46, 0x792D6A2F, 0x76799210, 0x40D943C5,
+   0x31A411EF, 0xAC1B2A2B, 0xDB0FF8A6, 0xA55A0FC9,
+   0x7D6419DA, 0x3F23A717, 0xE4DE442A, 0xE93E5D26,
+   0x722E90B9, 0x4BA1616D, 0x3C61194D, 0x552C1CF0,
+   0x89354C00, 0x3752120D, 0x6948BE78, 0x71D07BE3,
+   0x585ECABB, 0xD8C2865D, 0xA1EF7E47, 0xF645A075,
+   0x9FAF6A32, 0xBFA21A81, 0x45C59079, 0x0A99F07B,
+   0xDCF449DD, 0xC52A5256, 0x8F204CF9, 0x63701306,
+   0xB01F01B6, 0x15351855, 0x28B95F4F, 0x683505D4,
+   0xD5517888, 0xD0B9DE6B, 0xAD3B4A1C, 0x71BDE88B,
+   0x4725382F, 0x45266CBC, 0x7E32B4C9, 0x998C7E69,
+   0xE56A43D0, 0xA6041F77, 0xF1394A13, 0x26E8F920,
+   0xE2E378F9, 0xB25B7369, 0xF3BF944E, 0xC6308AAF,
+   0x0E21FE6F, 0xAE4A4DF0, 0x59E500F9, 0xC8D54812,
+   0x88811CF3, 0x39F36CBF, 0x5D264401, 0x03FB983F,
+   0x52801BE3, 0xADAA3392, 0x69B1394F, 0x1C438F0E,
+   0x7FD5AB1C, 0xDC80A4FA, 0x266F332A, 0xE2BD2665,
+   0x5BFB7B05, 0x63B74C7D, 0xADDBB15F, 0xB7038C76,
+   0x0AA9048A, 0x7FC86C72, 0x5F1C7733, 0x48B2053D,
+   0x5B31F08A, 0x2029DA02, 0xF62C57F0, 0x5D0EB735,
+   0x367A5A8E, 0x14C2762F, 0x307FFEE0, 0x61AA2B57,
+   0xDE16ED18, 0x1C351112, 0xA944B921, 0x43B1107C,
+   0x8F94CF4C, 0x57A59FFB, 0x1282A95B, 0xD7D7E320,
+   0x3F25D2E2, 0xE0C54B68, 0xF5F48EB3, 0xD03AA748,
+   0x1F66BB06, 0x3255F533, 0xC714A768, 0x81C32374,
+   0xC7B99F69, 0x5B80B484, 0x3F245F7A, 0xB252A2BC,
+   0xC19305F6, 0x31DAD088, 0x02DC5E00, 0x000A08C6,
+   0x314E8737, 0x39669B08, 0xA31D8C74, 0x64441BFF,
+   0x9F4C7913, 0xE66AC31F, 0xA0AA1ADE, 0x9E72562C,
+   0x4486E8D9, 0x9632710B, 0xE63AC0BC, 0xA25A03CC,
+   0xFFD7A99A, 0x6D6DFAAB, 0x70846500, 0x7711EA76,
+   0xDD91DE67, 0xC4983A80, 0x4FE23644, 0x8C49D66E,
+   0x018D340E, 0xF23F9DC3, 0x68436BB7, 0xE66BB49C,
+   0xCDC2C8FC, 0xEB29170E, 0xBFB3126D, 0x2BD69B3B,
+   0x6FF1600D, 0x4676C655, 0x6768F2DA, 0xC5F7E3C3,
+   0x1459285C, 0x25B80348, 0x0C71A01E, 0x35638C34,
+   0xEE29BDD6, 0xE11E6C0F, 0x4A8807DA, 0x529276DE,
+   0x8692F87F, 0x4411835A, 0x542B170C, 0x7AD54C03,
+   0x30CA0F40, 0x5D4E0447, 0x6E49F6FD, 0xF9A36EAE,
+   //Window 2
+   0x76EAD2E4, 0xBD5EA787, 0xEAD4D0DC, 0xB8E0F03C,
+   0xA7DFFDED, 0xA2193F92, 0x351BC35E, 0xB3F2467A,
+   0x36C5018A, 0xDEDA6F06, 0x69269255, 0x21A4F5D3,
+   0x09EA07CB, 0x4A0AB4D4, 0xBC926B83, 0xDD574F9C,
+   0x967F587E, 0x6A6A72AA, 0x0372DF0C, 0xD78D4D86,
+   0x828D35E0, 0xE9A595AE, 0x50514591, 0x38849236,
+   0xD2200E52, 0x37E0C245, 0x7CD1351C, 0xDEE8D708,
+   0x03FDFB69, 0x1F325032, 0x5E82EAFD, 0x175568F6,
+   0xEC59B334, 0x6076F98D, 0xB783FF53, 0x6DF9F50F,
+   0x9BAD7404, 0x7B33E888, 0xF491048D, 0x66836345,
+   0x2C43F337, 0x22EDE35F, 0x56523BF1, 0x181DAFFD,
+   0x153D2350, 0x66470233, 0x0F49CB05, 0x3E38931E,
+   0xF400E78A, 0x54F95F24, 0x72B2D31D, 0x0306CE7D,
+   0x0285A2D8, 0x79E9E961, 0xD6EC8D08, 0xCD8F23CB,
+   0x12F98FA2, 0x10579A78, 0xF901EF7B, 0x7A119BC8,
+   0xDA4FFF62, 0x24EF87CA, 0x8435F9EC, 0xD829756D,
+   0xB9D8FB83, 0xD1285274, 0x8CC0FF39, 0x9AE579E8,
+   0x14DC9153, 0xF9F8E482, 0xEF6244CD, 0x052F10F4,
+   0x99F68D7A, 0x6FC967C7, 0x54A40BDA, 0x16C29384,
+   0x69CDB1A2, 0xD7BC2006, 0x2A493891, 0xA8D50347,
+   0xB486D71C, 0xC953D265, 0x0C5A9B83, 0x533B2E62,
+   0x95AAA767, 0xA6783289, 0xFCC63995, 0x8E1CB5DD,
+   0x951D12BF, 0x5AF64FAB, 0xA4EA2FED, 0x8AB7EF8E,
+   0x01D259E4, 0xEB818B8D, 0x633D93C6, 0x2FFEF6F4,
+   0x203D6474, 0x564051F7, 0x97624439, 0x9684C345,
+   0x349875BE, 0xC64A144D, 0xFA7C943D, 0x8CCCCB04,
+   0xCFE6BB91, 0x3229B8F7, 0xB737FB0B, 0x35758C50,
+   0x49DF459E, 0x50F443EC, 0x341BEECC, 0xC232C7AF,
+   0x78F77C22, 0x6128A6BD, 0xE986A17B, 0x4AB7E91A,
+   0x5421AB6C, 0x4C61E5F9, 0xEF82A76B, 0xB4C31EC0,
+   0x30501E8C, 0x26CC551C, 0xBA0160BD, 0x920BCC93,
+   0x42EB3868, 0x6C8D883E, 0xD9B636CB, 0x87D77E6F,
+   0x9DFADA94, 0x6F80A32E, 0xB08ACD0E, 0x6129CDE5,
+   0x72F12CAB, 0x138C9F26, 0x74A46D4B, 0x95756994,
+   0xED406A00, 0x49812554, 0xEF85F693, 0x6056176B,
+   0xDCD946DC, 0x054A87A8, 0x74F984EF, 0x987EF713,
+   0x414A73C7, 0x8455A179, 0xE7FC5F47, 0x03184459,
+   0xF93DBA12, 0xBB891A5A, 0xF83EC8C0, 0x674320C5,
+   0xDFA714DF, 0xC5A30F67, 0x1D9815D4, 0x83C7AB3A,
+   0x00531F4A, 0xDE968529, 0xE889D3CB, 0xB18E3FED,
+   0x43EB65BF, 0x40F4B3AE, 0xABC9AEF3, 0x35499715,
+   0x35A998B0, 0xCB715727, 0x835C9165, 0xA7307EEB,
+   0x1ECAB0A0, 0x3BBB17EA, 0xE725A39E, 0x45791B0F,
+   0x28363FA8, 0x3E5F29C8, 0xBFB415AB, 0x209F4BF1,
+   0xFA1AA527, 0xE7EAC5C9, 0x05580C8E, 0x6629B6B1,
+   0xC949CE19, 0xB1DA3305, 0x98DDA0E0, 0x3A6CCFD3,
+   0xA11B0EC4, 0xF77BFB79, 0xDDF7E39E, 0x601AA690,
+   0xEEB633E5, 0xACC6B649, 0x4984DAE1, 0xCB01B8A9,
+   //Window 3
+   0x25ADC9EC, 0x00E81058, 0x1873B2BB, 0x8D8E5A4C,
+   0x5D1F591A, 0xA7A882F9, 0x6C27F447, 0x5CC7168A,
+   0x3461D347, 0x679662C0, 0x91DC62BE, 0xB2518139,
+   0xE701E4D0, 0x7958B510, 0x1708EEDF, 0x6E5F2BE8,
+   0x4F79204A, 0xB0B25E1F, 0xABEDB90E, 0x1A479632,
+   0xB01BEE25, 0x242DC35A, 0xF910C2D5, 0xA89FBDB7,
+   0x4D25C424, 0x826E27BD, 0xE426A10B, 0xB8DFC019,
+   0x0742C59D, 0x092B0822, 0x2A6B35C5, 0x54F5DC25,
+   0x96C13AC6, 0xA183FCEB, 0x7EF2DFFD, 0xB4648D7C,
+   0x7F359E09, 0x2259355A, 0x4A08E8E5, 0x703F7DCF,
+   0x64FAA491, 0x8F88D8AD, 0x2498E2C2, 0x28C50B23,
+   0x39086047, 0xC96A5BFD, 0xB0E5AC72, 0x978A4CEF,
+   0x02036854, 0x84A1EC5E, 0x8190C68B, 0x3D5C8428,
+   0xB19C17C7, 0x90CE2A50, 0x65656E71, 0x18BFC6CF,
+   0x72B7DA86, 0x9B23AF41, 0xE1F4C294, 0x730CE010,
+   0x31CA4716, 0xA2005027, 0x6C9B9142, 0x5765AC38,
+   0x2312BF47, 0x01AD37B9, 0x5C970A63, 0x5D09402A,
+   0xE5C1A5E9, 0x7ADF96F3, 0x9E7A229E, 0x22D51F3C,
+   0xEE22164B, 0xAB061418, 0xE8EB972B, 0x6E91DE75,
+   0x935BECCA, 0x350D1199, 0x8AA6B056, 0x91164EF8,
+   0x6C0A8D3F, 0x467416BA, 0x0CBFD908, 0xA52822E3,
+   0x66C8E8D1, 0x98C18EC7, 0x13F4AFE5, 0x901192EA,
+   0x66436E52, 0xE2373EA1, 0xF61E479F, 0x73047FDA,
+   0x7804A96F, 0x9EC67C8E, 0xF5E9AB3A, 0x4CE39AB5,
+   0x05419BE5, 0x72CFBCDD, 0x4CC1B97A, 0xD3C12780,
+   0x04ECE88A, 0x72F649B0, 0x3CD27B66, 0x62B7268A,
+   0x415B4247, 0x32469FBA, 0x1799BBDA, 0x03CFCDF9,
+   0x46383A5B, 0x37F2D1EC, 0xD9E8CC5C, 0x1B9602F5,
+   0xFB96C12B, 0xD56B8310, 0x85449764, 0xE0CDB5E7,
+   0xBA02C4AB, 0xD49AF0EB, 0x2BBCE595, 0xB73A1080,
+   0x6CDB67A9, 0x61AED044, 0x1B9C21EC, 0x663A09D3,
+   0x0AFCE29E, 0x04CE0C5D, 0x5D96013C, 0x39EC91B9,
+   0x30CB7FA5, 0xDE55EDCB, 0xF3465D26, 0xF1E6D8B4,
+   0x7CBB6CDC, 0xE3793683, 0x5D1F7FB6, 0xC6292F60,
+   0xC7967CFB, 0xE427F1B5, 0x66E1806B, 0x6AF0F7FF,
+   0x58DBE7BA, 0x72BD929D, 0x321E7979, 0xCA2FF02A,
+   0xB6FC9676, 0x60CB3B13, 0x94A67643, 0xB50C81D1,
+   0xF5381E3C, 0x09976865, 0xF1ECE3B9, 0xE731C6FF,
+   0xD0D38F51, 0xE92F6DF9, 0xA0117B21, 0x4C873339,
+   0x69415DAA, 0x97123550, 0xEFB6BCFE, 0xE3186DF6,
+   0x5ADC0885, 0xEB587F6C, 0xE38D4BE8, 0x8D10BBB1,
+   0xA37AF77B, 0x724AAC6C, 0x2233EDFD, 0xD44986D4,
+   0x9B2B2B84, 0x25F18FA3, 0x80256FDB, 0xBC48DACA,
+   0x6AC11AD6, 0x120207D2, 0xD4E8DCD5, 0xD212ED54,
+   0x8C83AF63, 0x54830AD1, 0x0D85A122, 0x16A4804B,
+   0x3492834F, 0x3EE000FA, 0xD37F047E, 0x7028A73A,
+   0x5EC68774, 0x00E40921, 0x6E1D2392, 0x18B5A95F,
+   0xBBA9213E, 0x3DB749E4, 0xED1E052B, 0xE99FCC3C,
+   //Window 4
+   0x450DCDA4, 0x7B5F7103, 0x210005FB, 0x991DAEAF,
+   0xE7E9F447, 0x399186AF, 0x60A1E9A4, 0x80BF2BF9,
+   0x2BF6A679, 0x51735619, 0x97B96D3F, 0x13EE2F3C,
+   0x220244B8, 0x3CB0F721, 0xE6860A4B, 0xA1CE495F,
+   0x4D1751AD, 0xC0A1437B, 0xF55E10EE, 0x5B0AF9B4,
+   0x9CBEDC04, 0x70F25A5E, 0x5C11EA07, 0x4C1548BC,
+   0xB8B665A1, 0x68417504, 0x74BF56B6, 0xA183F07E,
+   0x60B6F0EC, 0xA1EE5C2D, 0x17BA4CBE, 0x5737B2F6,
+   0x8EB41871, 0xD0C55E3A, 0x2A1D71F3, 0x6218BBE2,
+   0x2E431B8A, 0x5DC961DD, 0x7411FBD8, 0x8B7A2B88,
+   0x977476EE, 0x8DFE5403, 0xD5CEB5DC, 0xFA9DEAB7,
+   0x6836A0B4, 0xC7123D76, 0x5C1221ED, 0x52177202,
+   0x1E2017B7, 0x661AEBEC, 0xAB675612, 0x45B5967E,
+   0x2D29930B, 0x8ABCF826, 0x9E828117, 0x0041B594,
+   0xB5D7928E, 0xCDBC35C1, 0x4C2BC1C5, 0xA7D93AB6,
+   0x023F9A38, 0x5855243D, 0x0F75EF4D, 0x0340A4F5,
+   0x9A90044B, 0xF767BBA6, 0x86BE2A07, 0x3E85FC9E,
+   0x36DA27A8, 0xBA70B2E0, 0x7FE694B7, 0xBE24A58E,
+   0x33D7F511, 0x6E2549A5, 0x5A689DCC, 0x2E2A45FB,
+   0xDD2B1787, 0x5AE5330A, 0x3F7F43CA, 0xA98610B4,
+   0xBA489A17, 0x06F67C17, 0x29AFA3A7, 0x9530CF6C,
+   0x84EC5B5B, 0x695B73A8, 0xC1566A85, 0xB239100C,
+   0x7E50060F, 0x2CB980DA, 0x474D6690, 0x544C3F8C,
+   0xCA39DB5C, 0xD442E44C, 0x7B5AB8DD, 0x27D4A112,
+   0xBB18A2BC, 0x0DA0C384, 0x12B6B2F3, 0x9EE6AFEA,
+   0x05DBD1D1, 0x84FA93B1, 0x9E45A17B, 0xF6F32CCB,
+   0xCB993623, 0x73E54828, 0x4BD9E83C, 0xBFC940AA,
+   0x99B640C2, 0x850BC2C5, 0xC619A2BB, 0x9317C6DF,
+   0xD40B4C0C, 0x30EB22A7, 0x1C596769, 0x4CA57CEC,
+   0x011D0622, 0x09F20549, 0xF412D4AA, 0xAFA776CF,
+   0x22D85DF2, 0xA025BF80, 0x0A20606A, 0xD062FF16,
+   0x2CF55D32, 0x221B9CC5, 0x5942EF9F, 0xC2C9F7D1,
+   0xEE5280EA, 0xEC62CE77, 0xA92930ED, 0x375A60C8,
+   0x5BF57943, 0x40C2D657, 0xFA495F36, 0x43F708EC,
+   0x4A4FC5E1, 0x4CAB4856, 0xBD34499E, 0x3E28CD43,
+   0x2807D3C8, 0x3E68339C, 0x063ED72E, 0xC7B2F5DE,
+   0x270453BF, 0x06F70E73, 0x8C63E31C, 0xEF8154B6,
+   0xB56D4E7D, 0xD76442A9, 0x665645F9, 0xF5C313DD,
+   0x6D842AC5, 0x313E0305, 0xE5DD67CF, 0x8EF9F66F,
+   0x922EB9DD, 0x741AD5A7, 0xEA3ECFE1, 0x5A9B19D7,
+   0xD8065D3B, 0xD5E2B3F2, 0xFD6747B9, 0x3397204F,
+   0xCD288CD0, 0x40BCB05E, 0xA4DD5AEA, 0xD782FFC0,
+   0xFE6CC94E, 0x49AA40FF, 0xABFEA081, 0x5770CAB1,
+   0x1F2D44F0, 0x720E9C19, 0xB8022FF3, 0x2078AFA1,
+   0x81FB84D9, 0x1125CE10, 0x8F9E6017, 0x20A12F70,
+   0x777E4ACA, 0xFAAFE0DD, 0x7A0AF906, 0x0A4C8C08,
+   0xFD00338D, 0xCC10F64D, 0x5B78FD30, 0x6A82A993,
+   0x8EDFDF15, 0xAE72C768, 0xF95C8CAC, 0xE0C67DD2,
+   //Window 5
+   0x69FEEEE8, 0xB0658763, 0x8D4A71DD, 0xB1FDF7DE,
+   0x2FB21FD4, 0x69C95186, 0x99CEE80C, 0xCCD9FA55,
+   0xC1C26343, 0x3FD704B7, 0xB4089351, 0xF910EBFB,
+   0x78A34642, 0x67787C6E, 0xA14C33EF, 0xE5EE4625,
+   0x09F4A12E, 0x2A10AE07, 0x568A2562, 0x10AFF206,
+   0xB5E65097, 0x7648B908, 0x47190A73, 0xC62E2AF7,
+   0x6A2D14C2, 0x7CD5E1CF, 0xE159FEF4, 0xDA750B6B,
+   0x2B9AD41B, 0xCC44A086, 0x6E538EF8, 0xEEE614AA,
+   0x6C76CF88, 0xC82E105A, 0x60607554, 0x1D2F846B,
+   0xF62402FD, 0x13DE417C, 0xC83F40E2, 0xF83DDC3D,
+   0xF6234D7F, 0xDED521AE, 0x136514EB, 0x5721FE31,
+   0x1DC99D73, 0xD0B97C70, 0xBB7BE383, 0x269975FE,
+   0x4A726836, 0xED60E952, 0x7734E1FD, 0xFDACEEFF,
+   0x138028CD, 0xE397C087, 0x9BFB09D1, 0x694A192A,
+   0x018D58F3, 0x683A731A, 0x70B5DB23, 0x434BA50A,
+   0x8B5B24E2, 0xC8F8141E, 0x9B3DE864, 0xD56CF054,
+   0xE66342CD, 0x90DC950A, 0x568993A4, 0x559028FA,
+   0x9B44B9BB, 0xCE45CD81, 0xAF7C9D5F, 0x06D9727D,
+   0x05E9ACBA, 0x87FDFBD8, 0xA82DCA50, 0x72A741B5,
+   0xCA637059, 0xFDB26924, 0x2E9B5CFF, 0xC5F200D7,
+   0xC669891E, 0x4F5870BD, 0x644DA3DA, 0x5658C342,
+   0x9C087A59, 0x24B58E19, 0x951D1BBB, 0x92F4788B,
+   0xE94BBAF8, 0x1CAC4F73, 0x88400B5E, 0x9D1E25FD,
+   0x40A28826, 0xD1E59640, 0x2B313AE5, 0xFF44484D,
+   0xA0439C38, 0x129E7E35, 0xF0245DAA, 0x014514C4,
+   0x9C57EC89, 0xF5B8A99C, 0x0D7F0C9C, 0x2DAF9E60,
+   0x716C6F54, 0x032495F7, 0x078DBF7C, 0x6B0B5D5B,
+   0x04E05AFA, 0x45709B2B, 0x10F5363E, 0x6488CB59,
+   0xA7CD14F1, 0x7EE5C40E, 0x096F355A, 0x140DF242,
+   0xDE000BD9, 0xDC32D8AC, 0xC5FD3636, 0x8F416C5B,
+   0xF60C87A3, 0x47B63F51, 0xB742916A, 0xF2EAB72D,
+   0xEA70137C, 0x3D9345FC, 0xECF2B5CF, 0xFBD42EA3,
+   0x19B87463, 0xCA2349E5, 0x50983638, 0xA5D5FA96,
+   0x16ED0F20, 0x447D3E47, 0xAE1915E8, 0x9DE19A4D,
+   0xBA3FE49E, 0x8F1C985A, 0x6292DCF9, 0xA45723B2,
+   0xF2F9798B, 0xF3AD16BE, 0xFE245E99, 0xBD5B8B76,
+   0xFAB432FC, 0x4AD68110, 0x8259CB7C, 0x3DD11741,
+   0x4A66A113, 0x50D31DEF, 0xD97AF82B, 0xE6438C89,
+   0x25FBA539, 0xED8C1F97, 0x028E5CCD, 0xDAB88A82,
+   0x2CC2F600, 0x27F51C07, 0x0537991E, 0xD97C42DB,
+   0xCF624431, 0xB06D82D3, 0x314FB7C7, 0x36BDFAAD,
+   0x088276AB, 0xD8F9963E, 0x12587BD6, 0x5A07AD76,
+   0x92874E94, 0xD674CBBB, 0x67F7CF41, 0xF6B46B19,
+   0x5F7A02DD, 0xD60F9980, 0x1EEF8EB6, 0x93FFF0DD,
+   0xD4B6321C, 0x1A7DAF3E, 0x1B26853A, 0xC26E128D,
+   0x274278EC, 0x28379247, 0xE47C2E64, 0x8872BD20,
+   0x2D6D044B, 0x6BB14C80, 0x65CAEE94, 0x775D6CA5,
+   0xF42AD78C, 0xF7191C4A, 0xFC84C1D8, 0x62CC960A,
+   //Window 6
+   0xBB5EF8A6, 0x25043FFB, 0xCCD47590, 0xE2193C62,
+   0x60F5AFD2, 0xC96307A5, 0xF776EE76, 0x36A26654,
+   0xAA19B096, 0xAAAA4F9F, 0x7F00128D, 0x3E9C2DD2,
+   0xA912E417, 0xB9B681BE, 0x205D7508, 0x2DF33BFA,
+   0xABA26B12, 0x685D8CC3, 0x87023F04, 0xBC005209,
+   0xB02DE357, 0xAD380091, 0x5D674F6B, 0x8E3337F5,
+   0xD40F2F29, 0x5B8D2D1E, 0x2EC487F0, 0x8EC2C4C1,
+   0x735988EE, 0x13047269, 0x035CB494, 0xA30E9D2C,
+   0xDFF42DBC, 0xD20E8943, 0x6DC6985C, 0x0B59AD43,
+   0x435394AF, 0x97625381, 0xBEED755C, 0xC93D0F32,
+   0x6D4B438C, 0x36FDBDB2, 0x9AA7DC18, 0xBF0C8F94,
+   0xEC148DF7, 0xD7D58537, 0x8F66B3B3, 0x906D111F,
+   0x5199E77E, 0x97272777, 0x2B2E9D1F, 0x50448265,
+   0x190ED36B, 0xE3A08732, 0x0495836B, 0x6EE27CB3,
+   0xD6B27ED1, 0x8AA5D187, 0xD7AF1065, 0x8C7930A7,
+   0xC26D472B, 0xFF57F8E0, 0xDECF61E5, 0xEB08DE3E,
+   0x66E56C01, 0xA2F78EE8, 0x99DBA115, 0x487F97EE,
+   0xDC577951, 0x3ACC560B, 0x8FA0C532, 0x06AC8270,
+   0x1E4713A3, 0x79E81EB1, 0x55936C80, 0xE18FDD72,
+   0xDC2EEE04, 0x28FD2855, 0xF36B109F, 0x65424587,
+   0x7251F799, 0xA4118CAF, 0x0B167759, 0x523D15BE,
+   0x6077917B, 0x8EB1A828, 0xA075F970, 0xB42621E8,
+   0xEDB8AE8F, 0xDB6342DC, 0xE0FB6E15, 0x57C80833,
+   0xB053B046, 0xDD383D76, 0x2C5A02C8, 0xDCAD4DEB,
+   0x86D61F04, 0xE447DF37, 0x9F199A8C, 0x2A7B4F3C,
+   0xE1A94B98, 0xDB5A487F, 0xC61AD627, 0xC983A4B2,
+   0xA30715FD, 0xABF3B858, 0x1A373C37, 0x415DA524,
+   0x7D3D2B01, 0x8162C899, 0xD6FAFE89, 0x3DCEF976,
+   0xE2D5B6DC, 0x11847AE6, 0xE2703B6D, 0x2A48430C,
+   0x599E459F, 0x2D59E057, 0x10D6E09C, 0x040B2BA6,
+   0x2A6A1425, 0xEAFA7606, 0xF5285A97, 0xC3D18A1C,
+   0x0BA5EFC5, 0x738DD032, 0xDD445834, 0xD2D773DC,
+   0xE36070EF, 0x5CEC15E3, 0x9A19DA3A, 0xD3BA4EB6,
+   0x8AAC4A2D, 0x1A8E5351, 0x26E2B71F, 0x54D468C9,
+   0x52D084B7, 0x6F413F91, 0xD0ED7567, 0xAC26D0C9,
+   0x9F28E95D, 0x15A67DE1, 0x5BD8017D, 0x78CDD7F0,
+   0x58D43812, 0x73B160F2, 0xB9521474, 0x8255B2F6,
+   0x0BEA5104, 0x298DF2C5, 0xB453952C, 0xF15F82E1,
+   0x100B8796, 0x5F491CE2, 0x2578C567, 0xED0D3083,
+   0x2666E979, 0x2A95A0AF, 0x8D070958, 0x6977C093,
+   0x6760F56F, 0x507F6F93, 0xEDDB2EFD, 0x35906D56,
+   0xCBAD7CE9, 0x0384EADD, 0x5CF5FD18, 0xFD42C05D,
+   0x06264033, 0xF7D43840, 0xFD6BF6D9, 0x67EC0479,
+   0x4A887C20, 0xB2936BC6, 0x05902370, 0xADEB68A8,
+   0xBD4E6E7C, 0x4677BCDB, 0x012A382E, 0x40FC674D,
+   0xF0059D88, 0xB2B63563, 0x8DF9A8B2, 0xEF82EDC3,
+   0x08F3C711, 0x0835D5D9, 0x8BC9208A, 0xD66AB5D0,
+   0x86AFCA53, 0x3BF9D016, 0x055877FC, 0x97690FDD,
+   //Window 7
+   0x5712FFA2, 0x18A993CC, 0xD6CFF1E3, 0xF6785DEB,
+   0x2BC686A7, 0x3048566F, 0x830A0D97, 0x5F8DFD4A,
+   0x82199D69, 0x98DC64EA, 0x319C8898, 0x995B5B2A,
+   0x6D293338, 0x1F67EBD3, 0x518A9A55, 0x9893A729,
+   0x9B8E1E80, 0x89F3B063, 0x78F712F2, 0x95B29110,
+   0x27223053, 0xDF966B7D, 0x35396542, 0x29E5AE4F,
+   0x6BE36499, 0x1540E45D, 0x2C3D1362, 0x481244AE,
+   0x936EB492, 0xBF9ADE1B, 0x872BAA3E, 0xEF1CE9B4,
+   0x5CCF4268, 0x841598CA, 0x7199DCE6, 0xEB17D1C7,
+   0x1D55AC7D, 0xECDA0DA0, 0xBFC88747, 0xE8C7C8C7,
+   0x6AACC749, 0xE5459EA9, 0x9F6CE430, 0x1704CBBA,
+   0xE5888BA8, 0x2E7FE408, 0x95D627E9, 0x7C3EFCA4,
+   0xC52B0060, 0x2E955528, 0x9F50A974, 0x9BAD2419,
+   0x83BE3ECB, 0xEEE8830D, 0x2C52B126, 0x084DF7DF,
+   0xF7F0B8AA, 0x548C5542, 0x91CDAB04, 0xE763AD3E,
+   0x24F2E1EB, 0x453B34F0, 0xD22AF184, 0x22FA2F40,
+   0xCAC1F13D, 0xC3CF08E1, 0x41689D8C, 0xF2ED78FD,
+   0x4DF94842, 0xC5B2109D, 0x69BAC04E, 0x0290398E,
+   0x3B825320, 0xC6F57E73, 0x25318F56, 0x40E7FEB0,
+   0xDCEA9DCC, 0x372CE1C7, 0xC3CB7F31, 0x2DBD16CC,
+   0x2E576456, 0x01AB201A, 0x08307462, 0x3C05A15D,
+   0x26FE2499, 0x7B8BC565, 0x8D8A4345, 0xA819BF46,
+   0x6FC1FBBA, 0xAFA8A442, 0xD5173BE4, 0xCA038207,
+   0x690A2C28, 0x0C4A4EC4, 0x5F41F114, 0x05CCA982,
+   0x1C6244F8, 0x2AD3A0E9, 0x409F62D3, 0x43A1730F,
+   0xC44E0A6D, 0x711B9881, 0x2EE46263, 0x4D74A196,
+   0x4481620A, 0x67B2782F, 0x3F044324, 0x5F98AB45,
+   0x4E76C550, 0xDEE5F836, 0xDFF2B166, 0x79B2AC59,
+   0x66ECAD07, 0x519BBFE6, 0x86769C50, 0x040D5B86,
+   0x8D66FE8D, 0xE37D98DD, 0x16123E3A, 0x119C7516,
+   0xB2D4B14A, 0xA12B1C7E, 0xC8447FB2, 0xAC02FC87,
+   0xE0E5D11B, 0x92DAFD0C, 0x62037A43, 0x6DB7F105,
+   0x576871C1, 0xEE5F1BA6, 0xEEB3247B, 0xEBFA3403,
+   0x31D3F4F3, 0xE8766789, 0x1CB9B82D, 0xD730F4E1,
+   0x9ED27CB6, 0xC53ACAEF, 0x5D9AA5C7, 0x2735C09C,
+   0x9171F70E, 0xDA694996, 0xBE9E44CA, 0x0188CD76,
+   0x2A5905C9, 0x0A8DDBA3, 0x62225917, 0x99EF65BA,
+   0xE21B27B8, 0x03575104, 0x5529F50F, 0xD8803CBC,
+   0xBEFFD7F0, 0x9D8B4AE8, 0xF15662CD, 0x4BC05600,
+   0xF188101B, 0x678C64BE, 0xC525126E, 0x4FFE7A51,
+   0xF2004F54, 0x2EE29444, 0x0B3C6A5A, 0x52E1DB38,
+   0x5B570287, 0x5F772BB2, 0xAB82FC74, 0x5AB2C2C2,
+   0xD2BD7CF6, 0xF09F2538, 0x49C6EF17, 0x97299020,
+   0x8F645D9C, 0xB69C7D39, 0x4FBD7FE9, 0x7A705928,
+   0xFA4A92A2, 0x392B8F14, 0xDF716F92, 0xFA8A06A7,
+   0x5E87C588, 0xBDBC96F3, 0x42C68114, 0xA0D2E7AA,
+   0x87C6D7F5, 0x053F94FA, 0xD1F43A02, 0x88030075,
+   0x36CA5232, 0xCCCA8B82, 0xF0D9B4D2, 0xFDD2277F,
+   //Window 8
+   0x75EF7ECE, 0x1AC3B9D6, 0x84439AC8, 0x45346C2D,
+   0xEE89FB8A, 0x61A16216, 0x0E29EED1, 0xA5BE804E,
+   0x51D258A2, 0x6272BEEB, 0xAD62B895, 0xBA2213C7,
+   0x0328049B, 0x02234625, 0x8E055DF0, 0xDAB5A0C0,
+   0x26DEAB8D, 0x4759E138, 0xDF5F1EC1, 0x9132448E,
+   0x1056B382, 0x1C7EDCCC, 0x446D869E, 0xA8FDB93C,
+   0x031046BF, 0x0825663C, 0x804B19A4, 0x0E33D28D,
+   0x2C679C02, 0x9D97E6D7, 0xEF388A13, 0x52E60D5F,
+   0xCB741830, 0x47CB1991, 0x81C4301B, 0x7248A3AA,
+   0x6C71C09F, 0x5590122E, 0x2A0FD9BF, 0x6D67883C,
+   0x39F1609A, 0xDFB2D684, 0x9F1CE7A1, 0x3F712EC1,
+   0xA8E134C5, 0xF0E1ABCA, 0xFE24F7F5, 0x46B6C5F1,
+   0xB3F918AD, 0xD3D7EB89, 0xFF3D1195, 0x64D263DB,
+   0x66B80A43, 0x95E5F10E, 0x8E758BA5, 0x1D39055C,
+   0x33F46567, 0x28EDD869, 0xF79C1F74, 0xE15F1247,
+   0xCE5E5A60, 0xBE7BB217, 0xE5ADF233, 0x5B4F6C56,
+   0x4117D2CB, 0x09D3C38F, 0xFDDDC7A7, 0xD9F1D198,
+   0xD134340B, 0x03A8A840, 0x2267A809, 0x5119891B,
+   0x7B8D1EF3, 0xFC65A1C9, 0x2058FD63, 0x59BB1763,
+   0xFB1045C4, 0x31B73B30, 0xAB2DE705, 0x87864E71,
+   0xC5BB4481, 0x6EB085A7, 0xCA7AD159, 0x0E83D8BF,
+   0xA477589A, 0xF0B3DEBF, 0xF4D9B85D, 0x9C01E861,
+   0x23193BB2, 0xD8606592, 0x4FB2C36D, 0x24405C91,
+   0x564C994E, 0x8ABB7E10, 0x8B224BF4, 0xD47AC1C4,
+   0xEA3FCF2F, 0xBE716FC3, 0x03BA301E, 0x647C3861,
+   0x4C2B9D64, 0x6A393A9B, 0x75655576, 0xB0A8D529,
+   0xA7CB7E09, 0x4954578C, 0x5D8B2931, 0xAF8CAF81,
+   0xB1EB04F5, 0x1A791D53, 0x062D7AE6, 0x28446373,
+   0xBC78ADE5, 0xF6FE1826, 0x4421B01C, 0x73A31666,
+   0xEA147328, 0x07400292, 0x2BE886BB, 0xD28F56BA,
+   0x4B27D499, 0xDD74286F, 0x7834C249, 0xC7A97DC3,
+   0xC2A8760D, 0xC6E763F4, 0x2E93167D, 0x67965BE9,
+   0x6CD86BA6, 0x69944261, 0xAFB46386, 0xDC486494,
+   0x51D2E2CE, 0x92250C54, 0xFE4C8F05, 0x3D25E2AA,
+   0xE5AE90FD, 0x0402D19B, 0xC7672F6D, 0x45DFE6E0,
+   0xC1EDC1E7, 0xBE35ABEF, 0xB0F62D52, 0x6024CEC7,
+   0x49BA2911, 0xA4E945C2, 0xC947CAA2, 0xE8667C86,
+   0xA6B7C841, 0x8084E0DF, 0xA229F400, 0x8B702DDF,
+   0x4CFCB792, 0xBAE6E579, 0xF92035EB, 0x4861C350,
+   0xE65C7D48, 0x25306D05, 0x91D4F685, 0x0F743252,
+   0x87A199F6, 0xB4273546, 0x93E9A060, 0x75800238,
+   0x200D717E, 0x9636ECFC, 0xECA720CB, 0x6DE636B1,
+   0x0F41048D, 0x0AD6E705, 0x7E529947, 0xACFD5529,
+   0xC6E0F0A4, 0x8F76D2BA, 0x3808768E, 0x6693B125,
+   0x08C7B6A9, 0xE91F98F1, 0xE9B1866A, 0x655E10AE,
+   0x5B09CA5B, 0xD14D22A0, 0x0C99ECDC, 0xA6EA0FBF,
+   0x4C7E36A7, 0xF8B54ABF, 0x0FA5E040, 0x59FA0898,
+   0x3E3693C4, 0xA3836A9F, 0x487F667D, 0x02CC9087,
+   //Window 9
+   0xE2D987D4, 0x3F4AFCA6, 0x9BCF5278, 0xD92988F9,
+   0x2AE8F15E, 0x0B81F5FB, 0x2EF0EF36, 0xED0F1774,
+   0xB58DF192, 0xDE81C101, 0xEBBA96C8, 0x81EDB994,
+   0x2FD6596F, 0x445201C4, 0x366014C3, 0xD29C151F,
+   0x10E4FD21, 0x6E489E1B, 0x14996F8C, 0x54C04482,
+   0xCDDBBBAC, 0x8BB04837, 0x1B6E5B43, 0xC4C6090F,
+   0x515C4A00, 0xE0F49E68, 0xC06373BB, 0x3C32CEB5,
+   0x24C30859, 0xCECFA4DF, 0xACECCA7A, 0xCE3BB178,
+   0xF2188DFF, 0xE670A1DC, 0x2797440B, 0xBBF46040,
+   0xB819AC40, 0x513DF39C, 0x03619332, 0x37993FAA,
+   0xFA3657DB, 0x8DE3B1EC, 0xCBC582FC, 0x7DC3A1F8,
+   0x28D52BD8, 0xD97533DF, 0x340D0602, 0x8E54E373,
+   0x61EBC815, 0xA9C711D3, 0x48108F90, 0x64DA0844,
+   0x712F7D76, 0xB24582F7, 0xE46FDB59, 0x5EE49E24,
+   0x526666B7, 0x36CADCF7, 0xA9A7DFA5, 0x2E5E7996,
+   0x0191BB2B, 0x8EB5B137, 0xFD368C71, 0x6D2D7025,
+   0x96FE69D6, 0xF0E1E3EF, 0x07AEB867, 0xBE8D43D9,
+   0x36B987F9, 0xFC821C00, 0x5BECD838, 0xA2F45F09,
+   0xB13A7398, 0xB0D00608, 0x23DD622B, 0x4F7A5F82,
+   0x286E41EF, 0xF45EFC71, 0x41530E21, 0x176DDF55,
+   0x51F7FF02, 0x1535E77E, 0x39C77A46, 0xBEBF9D83,
+   0x3EBC699D, 0xB813DBF3, 0x9FE4E12A, 0x674987E2,
+   0x2EC9EA41, 0x79FF29C2, 0xA49FBA69, 0xC3D8F9FD,
+   0x484017AA, 0xFC005BDC, 0x093D3CB8, 0xF883E6F2,
+   0xD6870076, 0xF2005766, 0xA7E90CF8, 0x00986C27,
+   0x6C220456, 0x5E17ADF3, 0x7B843FEB, 0xFE998E02,
+   0x59727784, 0x3C9A45D7, 0xCCBCF32B, 0xEEF0C54B,
+   0x74BA5344, 0xD0A7D92D, 0x65C55D98, 0x20C07D33,
+   0x2717F481, 0x5CE72CF0, 0x0203720E, 0x10F805CC,
+   0x709D20DF, 0xE3F11B90, 0xB7F33941, 0xA367E420,
+   0x0C5FEF90, 0xA57D4DFA, 0xCDB6F33E, 0x0E738184,
+   0xDE08ADAB, 0x57FA545C, 0x7F8FCE9E, 0xB6116E5D,
+   0xD7CC8FEE, 0x858A54EA, 0xF0BACB2D, 0xAEBC37A0,
+   0x77FA928C, 0xD2A88638, 0x1876C998, 0x3CA8E05F,
+   0xCB5FAE45, 0x2C11E987, 0xDC18F789, 0xE2962ABB,
+   0x101EEB9F, 0x7E0EB2FC, 0x173CC1F4, 0x65C7B92F,
+   0x299440BA, 0x2492649A, 0xA6FDA150, 0x64F56864,
+   0xD2D61775, 0x6F8C38B1, 0x76A46149, 0x0345163B,
+   0x8ABCE4FA, 0x04F74609, 0x425D4AC7, 0x09F3B632,
+   0x90866A05, 0x5EC18B33, 0x53862E0E, 0xBB03EDEE,
+   0x043772D4, 0xBCC5A2BE, 0xC2234CFF, 0x2613BD68,
+   0x2009178D, 0x6F25D0E4, 0xE7D3AF34, 0x432F6049,
+   0x18C2DF94, 0xF252E025, 0x7C7C7676, 0x72B0EADD,
+   0x64956FFC, 0x580E39D9, 0xA83D88AB, 0x590604CA,
+   0x6C779BEB, 0xF9C2E3FB, 0x70AE1D26, 0x3E776EC4,
+   0x616E31F4, 0xE764B467, 0x475BCF21, 0xCFC9A7CB,
+   0x1F8CE562, 0x67CACDD1, 0x3CCA0BD9, 0x38151757,
+   0xDBF8E83A, 0x20D7E6AB, 0xF718B0D2, 0x9C8CC758,
+   //Window 10
+   0xF72584E0, 0xEE588514, 0x019ACA87, 0x7D3BD20F,
+   0xEA7A5C79, 0xC78F7B96, 0xD2A5CF08, 0x941D8442,
+   0x60AAD0F1, 0x8D84F3BE, 0x20AD8C82, 0xF94DFEA6,
+   0xEBF46B90, 0xE8748E64, 0x02E421D6, 0x0C86F427,
+   0xEADDFD7F, 0x4F18508A, 0xB65E4EAD, 0xBE0387E0,
+   0x8CA85C8C, 0x30115744, 0xA14B1C47, 0x18BAFDAE,
+   0xCE5BB23D, 0xFAD6E579, 0x02E205B5, 0xB3A29F97,
+   0x1B3EC947, 0xF4643438, 0xBADA0B0C, 0x91734CB6,
+   0x378386CA, 0xF2738A40, 0xE61DEE25, 0x6E212C08,
+   0x5879FFCC, 0xAAB64F20, 0xF901B566, 0x167E0A78,
+   0x63E92693, 0xAC9D40B6, 0xE5F9A3C7, 0x288B5E15,
+   0x0E79C0BE, 0x1151ABA5, 0xF1F84C18, 0x8062AB95,
+   0x177695BA, 0x4F687860, 0xE98D7532, 0xAE48C654,
+   0xB27A8494, 0xB17C14F2, 0x014A062F, 0x33F4C480,
+   0xBBD6F26F, 0x2E6650A8, 0xA6015FC9, 0x0253ACB6,
+   0xECA833B6, 0xBF939727, 0xC98DAD56, 0xB6EA9355,
+   0xAE2DFF7F, 0xE65D769E, 0x3CE21087, 0x7F3D115D,
+   0x500B7C75, 0xDD72D4E9, 0xE1B9EAF6, 0x7D3D78B3,
+   0x2E6D4F35, 0xC47ABF7B, 0xAFC41ABD, 0x801B279A,
+   0xF1486BBF, 0x63D3B459, 0x09B26F14, 0x41EEF4B3,
+   0x4BDE2B7A, 0x5046E8D7, 0xDD7F4397, 0x95DD8005,
+   0xE3C913E5, 0xCCA39D2A, 0x99F6E18E, 0x4F060281,
+   0xC41F7BB7, 0xB7A180E6, 0xDA12B437, 0x18362BCF,
+   0x37795B95, 0x8BF5FFB1, 0x2624BA8D, 0x0F2F231C,
+   0x29E8D10B, 0xE482AE1A, 0xF904FC83, 0xE0DC3E00,
+   0xD80BA93D, 0x72639ED0, 0x6369B416, 0x17274EFC,
+   0xEFC598E9, 0xC4D9955F, 0xB1B68DED, 0x6BEBAB22,
+   0x500F2AA1, 0xD9B267D4, 0x57AAED1B, 0x2EBA8AC1,
+   0xBC23FDC9, 0x9B504AFC, 0xA7E15376, 0x7BE09393,
+   0x4DED6E99, 0x156A9C02, 0x0E607CC1, 0x54BE04C5,
+   0x1B181733, 0xC67AE8E4, 0x22495E5D, 0x9908A531,
+   0x567BF3E9, 0xD2999853, 0x1693B6AC, 0x3693A42C,
+   0x94B0F844, 0xF5DDD1AA, 0x613E3A40, 0xAAB27AAD,
+   0xF75B5B57, 0xCE7D5FB0, 0x641E9DF2, 0xE79BEC1C,
+   0x7AF48A17, 0x8A34D444, 0xBA62EEB2, 0xCD86AE09,
+   0xD2DC8FC0, 0xFD8D6F1E, 0x52DD02C9, 0x848650F9,
+   0x9819D858, 0x0C2D085E, 0x888859C0, 0xD496E036,
+   0x5CA94D00, 0x206EE539, 0x7E7F8F59, 0x50D04285,
+   0xACABC725, 0x821A716F, 0x41E35994, 0x457DB275,
+   0x96F6F3BD, 0x2C947361, 0xC0CD5505, 0xB816EBB7,
+   0x893ED69A, 0x6B88A8CB, 0xA07DC9A8, 0x399049A8,
+   0x58270064, 0x325F4ABE, 0x3451AC8F, 0x9E2E9111,
+   0xA3A8F329, 0x7F995FB4, 0x5B806754, 0xF83FBDAD,
+   0x899AE9B7, 0x25FD6563, 0x64432B38, 0x3FE49DAC,
+   0x1CF3DDFB, 0x8BEC7C27, 0x52F804AC, 0xA920C72A,
+   0x5651D4D1, 0x8BA6D364, 0x2344270C, 0x6276A84D,
+   0x5BB49F05, 0x75902E42, 0x68A46AE4, 0x6914E0B1,
+   0x7CC00D46, 0x008DA86A, 0xFC6FED8E, 0x688E1925,
+   //Window 11
+   0x3C8769ED, 0x14E2F301, 0x6CDE423D, 0x3774D66A,
+   0xF9B585BC, 0xAA513701, 0xC19636F5, 0x893C8008,
+   0xA9209AAD, 0x40964AB2, 0xF8E1E90A, 0x038BF01E,
+   0x8FDA1CEC, 0x72B187E2, 0x36F76260, 0xE56836A4,
+   0x2A957AFB, 0x02830845, 0xF2B6AC21, 0x4059981A,
+   0xA3E33627, 0x92573F3D, 0x70D98F8F, 0x8B230822,
+   0xEE3C0541, 0xEF7C2E98, 0x012D7FAF, 0x19F7F530,
+   0xA94B0C04, 0x81CEF942, 0xC6B764A1, 0x3A3A9F52,
+   0xDD2A6FB4, 0x1BC2BE95, 0x0244AAEB, 0x8A354C89,
+   0x507B58C0, 0x7EF4AD0B, 0x51E589BE, 0xABB5F73A,
+   0x50B8D928, 0xEF2549FF, 0xC83D7BE6, 0x2C55F786,
+   0x1F03EA6D, 0x87267B1C, 0xCDD6A6BA, 0xB5484BEC,
+   0xFCB3C913, 0xB3FA1642, 0xDF2EC7A3, 0x0C4451DE,
+   0x6FBA4A9A, 0x81162D08, 0x5F870300, 0x89F73BE1,
+   0x68CD1F89, 0x8B0EC695, 0xEFB1B5D5, 0x6BEBDEFE,
+   0x89B630B4, 0x6DD7DE10, 0x99C8EAF1, 0xD3C05323,
+   0x556B5A69, 0xAB15DF49, 0xE0D7E315, 0xD14D3687,
+   0xAC977F6D, 0x56321073, 0x5C30FCFC, 0x04095F2D,
+   0x3D9D2E73, 0xE3975ECB, 0xFCE9F71B, 0xA926298A,
+   0xD8BEA391, 0x5BAA8A0E, 0x6CC7210F, 0xB56BD74C,
+   0x58B1626C, 0x02780F8B, 0x1A3B097B, 0x913C9C0D,
+   0x6D6B7B10, 0x363D808D, 0x5FA04D14, 0xD34A5A45,
+   0x369C9BF5, 0xA8FABAC8, 0xB852B409, 0x3CF248AB,
+   0x3F49CE4F, 0xE5F7B130, 0x9A2644B7, 0xF91A3883,
+   0xDC5E99C2, 0xE23CBCC5, 0x41745DC8, 0x89FF46F0,
+   0x9B186C78, 0x749A2CB3, 0x2BB7F324, 0x1126CCC5,
+   0xBF950718, 0x18584F7F, 0x79245E5C, 0x74349F07,
+   0x5151B470, 0x4AB93A74, 0x878E43D5, 0xD9933A86,
+   0x33C6D09B, 0xA1B56D22, 0xE12FDB7E, 0x75B37FD1,
+   0x31A02D21, 0x47A96855, 0x52E5AF97, 0xE055B997,
+   0xB74EDF79, 0x52FEF02A, 0x1CEA8341, 0xA6454451,
+   0x0E915847, 0x4E89A430, 0xF4770742, 0xA8F97000,
+   0x23332B4B, 0xD48E2F4C, 0xFDE3D3B8, 0x694F9764,
+   0xBBED6BEE, 0xA9CF80EC, 0xB944A6CA, 0x70B5E318,
+   0xFE5A5749, 0x37CED2A6, 0x865AABB9, 0x289D00E6,
+   0x48EF1267, 0xB5825F5C, 0x3697A55B, 0xE0429701,
+   0xC5B89AA0, 0xA7267F90, 0x7406CEEF, 0x72AD0330,
+   0x2DCCA564, 0xB8CD6843, 0xE8D55E10, 0x20498ED4,
+   0x70E3BC4E, 0x2AC789FC, 0x10888166, 0x27181F8F,
+   0x0DC20817, 0x78C9574F, 0x86686151, 0x4BA5E04C,
+   0x69740C21, 0x1896923A, 0xC4AA80C9, 0x84895389,
+   0xD4C8AB49, 0x234CA1F5, 0xD90606E0, 0x8CE27359,
+   0x7D38C44C, 0xFFA3B84E, 0x0C979537, 0xC570BBA0,
+   0xC7551265, 0xB64858C1, 0x62319FEF, 0x8E53A5B0,
+   0x75FDD7B1, 0x85EAF589, 0x583F85BC, 0x57230220,
+   0xF8F5B5D2, 0x00A6408F, 0x1DD84FDD, 0x5D4F2191,
+   0x809ABC90, 0xBFDAF59A, 0x211EA3C9, 0x2A31376C,
+   0x8B2C51FD, 0xCB3DCA66, 0x00C5F0A7, 0xCBB902B3,
+   //Window 12
+   0xF47168AC, 0x9112E340, 0x90080705, 0x3917D3A0,
+   0xCC7FDEDF, 0xB6971DA1, 0x8512E48A, 0xCBD8AA25,
+   0xA7F6297E, 0x804100CA, 0x433EB6A3, 0xF19C3F9B,
+   0x2D8B523F, 0x45E0B176, 0x39D2CF6C, 0x1B7078CB,
+   0xEE4928BE, 0xAF40B68B, 0x5A620149, 0x65D24D48,
+   0x5D389045, 0x4A1E9B51, 0xF610090C, 0xAE61A171,
+   0xF4B400ED, 0x0F3E5C4B, 0xE55C977D, 0xCA6BC2CB,
+   0xDB939CCA, 0x542D3323, 0xE3B256A2, 0x3689C3D1,
+   0x7D32CF1B, 0xF2448B12, 0x25FAE31C, 0xBF9368B9,
+   0xABF2364F, 0x6B122AA0, 0xBED3E60A, 0x1233CF5B,
+   0x5528DDCE, 0x6AFC3AEE, 0xD6C16AD0, 0x028C85B9,
+   0x5ABC0EB0, 0xBB2C0177, 0x555CB586, 0x4A189DF6,
+   0x3960AF31, 0x39ECBE96, 0x8DC45BEB, 0xCF17F6C6,
+   0xC9F90773, 0x529D1AC9, 0xC9EAD7C0, 0x76D384B1,
+   0xEE807AFA, 0xCD2B14FB, 0x4AFD9E5A, 0xEA2DF0A9,
+   0x458BEED4, 0xC6E8D771, 0xFEA706F3, 0xE47B0034,
+   0x5090EA6D, 0xEBBF2F58, 0x444EAA61, 0x20EA3211,
+   0x28F1932E, 0x9E7D6B89, 0x5A8E9B93, 0x803AB56F,
+   0xFF28F921, 0x2F0A8ECF, 0xA74F058F, 0xB3C6F5DB,
+   0xB18E6D24, 0x44C0D818, 0x271E9472, 0x2A0E4A5D,
+   0x1F1936D8, 0xC061D566, 0xEE291C28, 0x0C7BBC44,
+   0x6A3FACED, 0x270A1A41, 0xF4EB442A, 0x923760F3,
+   0xF5D2952A, 0x8E942912, 0x2BE18C6E, 0xB6DF04E2,
+   0xDCBA1B55, 0xA2F87B23, 0x6D30E0C0, 0xA3CEFE09,
+   0xBBEAC961, 0x7961575B, 0xA7FD875C, 0x120B2BD7,
+   0xB82A2970, 0x8B4C8339, 0x648CE733, 0xA3D22984,
+   0x8794F92E, 0x4F6F80E4, 0xEF0F6BE6, 0xE3BD4620,
+   0x9E348B14, 0x6E07CEC5, 0xCEF03A50, 0x2B36871E,
+   0xF75BA358, 0xC2AD537B, 0x0AF4D7E5, 0x5ED99A66,
+   0xB946A3A0, 0xFEB7D2B4, 0x6A6F1F92, 0xEE1EC3FC,
+   0xF5C9BB9B, 0xE9DA84F3, 0xAC531057, 0x3DD5D457,
+   0x9E496655, 0xC78B5937, 0xDE7AC461, 0x20F8185C,
+   0x956A5D8A, 0x921013D4, 0x4B0DC7A9, 0xF99D6741,
+   0x1BF4D6A9, 0x7937C8CB, 0x702D6E10, 0xB3E32D48,
+   0x1D175EAA, 0x2A2EF899, 0x512EA777, 0xE55504E6,
+   0x52D58251, 0x8FE81280, 0xD52B4F64, 0x931E142F,
+   0xBBA422D5, 0x04185909, 0x44D473C2, 0x12516883,
+   0x225F48E3, 0xAC39F5E7, 0x9289DBF9, 0x887B9F30,
+   0x12A250FF, 0x936453E3, 0x7371BEC4, 0x5F0BF8AF,
+   0x9A135AF8, 0xBBB11B17, 0xF620BEF2, 0x53CE50EE,
+   0xBF4B7FF1, 0x23D3B4A5, 0xEBDD52EC, 0xBC763B32,
+   0x3DD7B5E5, 0x45C3DE32, 0xF88E180E, 0x5067FB37,
+   0x702337FB, 0xEA0546BF, 0x87DC6495, 0x7643494F,
+   0x497A241C, 0x745022BC, 0xE24804DA, 0x713AD735,
+   0xF7B67B48, 0x744D6156, 0x06FC6FE1, 0xC1D4A8FE,
+   0xE976120F, 0x9E6F01A9, 0x5FB7E58E, 0xFB21A9E0,
+   0xAF6FCBC5, 0xA099DBA9, 0x34237B66, 0xBDE7EDF1,
+   0x86511C15, 0xDA532722, 0x6EF27014, 0x1D67EA90,
+   //Window 13
+   0xCED7E5CE, 0xB5004B5D, 0x3706E5AC, 0x6073BB16,
+   0xC733AA38, 0x4FA63884, 0xECB75383, 0x72C8DAB9,
+   0x874CD0D4, 0xEB3468E9, 0xBEE33DFC, 0xDAE976E4,
+   0x28FD84DD, 0xF61F4F0C, 0xE323431B, 0xF32B946A,
+   0x5DA6E7E8, 0xE8C51797, 0x5E9F0ECC, 0xA121A936,
+   0xFF8A86B5, 0xED5B9F08, 0x54D9705B, 0x7453FE30,
+   0xDF1A900A, 0x5FBC2935, 0x09514AA7, 0x9405D0CD,
+   0xB9DF29E0, 0x3A6ED5BE, 0xE900BE5A, 0xE8E55664,
+   0xF5C80A6A, 0xD6C84589, 0xC8CFC10D, 0xD4959C58,
+   0x9CF42F28, 0x0B9C6F4D, 0xBAFF37F9, 0x3F24AA9C,
+   0x3B9E0C94, 0x2910D040, 0xCBC303A5, 0xA8875122,
+   0x588C2F09, 0xCCEC2814, 0x909262BC, 0x51C27D74,
+   0xE5BE8788, 0x0F40968B, 0xA7CD7531, 0x4D1BF10C,
+   0x64680E4B, 0x955444E4, 0xD11C3A0E, 0x7749232A,
+   0x0345972E, 0xE5AF4D84, 0x3AE68FA1, 0x8BD7B5B0,
+   0xF56C2632, 0x5563DA25, 0x66927243, 0x2E7712A4,
+   0x6197C4B5, 0x60BD44B8, 0xA4F201B2, 0xEA8F88BA,
+   0x91ECE48A, 0x30C72DB1, 0x6E1DD37F, 0x4FFE05EE,
+   0xD04EE64F, 0x1C215BAE, 0x8C8BA38F, 0x3560CFEF,
+   0x5E46AF40, 0x9A811E35, 0xE68ACC98, 0x1642C6CB,
+   0x29A243B4, 0x654B32E1, 0x22F5E1FB, 0xCC8F8B98,
+   0x15070813, 0x5B592C58, 0x19BD983B, 0x3DF50588,
+   0xD435FC58, 0x890A5598, 0x43B95E92, 0xB805A7D7,
+   0xB1A0561E, 0x6B90634A, 0x5AA5DF9B, 0xD5475E04,
+   0xD3C7534A, 0x6F4AE020, 0xB212F870, 0xA3F7B415,
+   0x94A1776F, 0xD6D4BB47, 0x74FD88FC, 0xBA4407D6,
+   0x99740EAA, 0xB54F6DDB, 0x32DA43B0, 0x664A8F02,
+   0xC5F23F7B, 0x48F52A46, 0x7D9D5A09, 0x3C3150F6,
+   0x4F68487D, 0x48B26C39, 0xDF6C5A62, 0x51727B75,
+   0x996B3D1D, 0x91D0A967, 0x715B5823, 0x34F6A5BB,
+   0xB57806F1, 0xE593CB1D, 0x292A3722, 0xB21F5C3F,
+   0x345F27E9, 0xD16EB969, 0x67C03DC0, 0xEE40FA02,
+   0x0A581C5B, 0xF06BBDFC, 0x9A8A6328, 0xA2AFE651,
+   0x0CCDB575, 0x0495C5D6, 0xC4BF4F88, 0x70117460,
+   0x7666FE69, 0x6896ABA6, 0x1F95D5B6, 0x5F4E5FE8,
+   0xA75E12C6, 0x3B7A41C0, 0xAB3ACFB9, 0x6249980B,
+   0x15A83308, 0x5E59E867, 0x9F56B1F6, 0xD5C4D065,
+   0xC17A05D7, 0x910253B7, 0x0D105A20, 0xEC918E39,
+   0x04C072E7, 0xEBED83DB, 0x21A56054, 0xEBB6DAFB,
+   0xDB49EC51, 0x91B2CAFA, 0xF184153E, 0x9C2D3BE1,
+   0xF9DCF997, 0x314004B3, 0x445D561E, 0x42F5062D,
+   0xCACB1D4B, 0x9575E66A, 0x6B4BB4C9, 0x20A53165,
+   0x92EBA319, 0x4B0BAD18, 0x687517FF, 0xEE600CA8,
+   0x1D8CB56C, 0x7F968125, 0x0506E235, 0xB2C24CEB,
+   0x2304A8F7, 0x3A5D8542, 0x9AD566FC, 0x4AB0B9A4,
+   0x309A3732, 0xE759F2B9, 0x03E217AA, 0x21C7A9C2,
+   0x83445914, 0x9016BCB8, 0x4E8055ED, 0x2E6025D7,
+   0x44633335, 0xE1237B35, 0x5E3A6F18, 0x3D32DEF1,
+   //Window 14
+   0x9C901612, 0x788075A9, 0xEB3B8ADB, 0x9E1F87FC,
+   0x7FFA2531, 0xA13DBAF4, 0xE67355A1, 0xF55BF77D,
+   0x587090CD, 0x5FF9B4A3, 0x5FC581A0, 0x1C968081,
+   0xF06DCA9E, 0x0C5BB6C2, 0x4FD22A60, 0xD376123E,
+   0x2325C589, 0xED4AC3F7, 0x30BB885E, 0xEDCE0302,
+   0xB608A6CA, 0x8AAF499B, 0xA9B81EBB, 0x779876A7,
+   0x221C5A52, 0x920070CC, 0xDC203AE0, 0xF05EE13C,
+   0x52899B80, 0x15A064F2, 0x37104693, 0xBA5B829B,
+   0x44F175AA, 0xEF7C73B1, 0x0031916C, 0xAA29FA41,
+   0x14BEBF3E, 0x51D4E6AF, 0xA63D371D, 0xCD7C4EEC,
+   0x39BECCB8, 0x515D658C, 0x2B00A0EB, 0x4876C8D7,
+   0x1CE2C4EF, 0x8C90DFF2, 0xBB0E6143, 0xE4DA82F4,
+   0xE0EEC0FE, 0x9D0C9BE8, 0xE84BDD38, 0x81807388,
+   0x7D32B258, 0x55050CCC, 0xD2D86F05, 0x51FD3727,
+   0x49857A01, 0x44CB2141, 0x68850699, 0xED7C8422,
+   0x22FEC7E4, 0x8E5CEB07, 0x0457CFCE, 0xC09BDBBA,
+   0xBAAF4F72, 0xE26D2244, 0x666C6473, 0xA1513FB2,
+   0x674E736C, 0x9133CA7B, 0xF39A7140, 0x40BD8BA3,
+   0xA2925092, 0x07B2AB97, 0x6E3D9C4C, 0x7963B28F,
+   0xB9DA2B03, 0x74F98EE9, 0xF578CA84, 0x8DA787AA,
+   0x90A99E56, 0xC8269BF4, 0x6E6587AC, 0x51E18399,
+   0x5F1126C6, 0xC9633A6B, 0xDEB07060, 0xB66B2A72,
+   0xA50D6E17, 0xD76DBB27, 0xE5B55D76, 0x53E43A5C,
+   0xD73E4EED, 0xFD26D75E, 0x781C2E7B, 0x7B51BCDA,
+   0xD9441610, 0x087EB880, 0xB365366D, 0x3387A87F,
+   0x5FA14390, 0x8397C563, 0x344D1868, 0xF93222B5,
+   0x52E007D8, 0xB48F27C7, 0xAD0C39CD, 0xD32EFAA3,
+   0x026C352B, 0xA2207525, 0x20C1F596, 0xEB9ACBB1,
+   0x24C6E8F6, 0x83C382B1, 0xF863CACE, 0x2CB93842,
+   0x27BF359A, 0x1E493127, 0xC8D074B0, 0x42802DED,
+   0x01F7A5EB, 0xE0BB3A0D, 0x24532672, 0xFE50C126,
+   0xB34C086B, 0xB7D249ED, 0x25888F5E, 0x223B3637,
+   0xCE9A1A84, 0xFB0421F8, 0x3DB598C0, 0xE8EBC60A,
+   0xE6CFBF14, 0xB65BDD4F, 0x2A21663D, 0x2617BA65,
+   0x8E6D2C6F, 0x5F5FFAD1, 0xF70BAF76, 0xA3D8903F,
+   0x90437BD2, 0xC064AF82, 0x2320EE34, 0x21AB3D0D,
+   0xC7A4A3F6, 0xF5446956, 0x917474EE, 0x6E823630,
+   0xE0877DFA, 0x9C4B5DF6, 0x846E4874, 0xE936E9CE,
+   0x07578253, 0x6B804AD3, 0x799A8C0B, 0x1377ABF7,
+   0xE8ACA0C3, 0x744C90AF, 0xAB5AEDD1, 0x0D105B98,
+   0x77880D4A, 0x24CDE6B5, 0xFA1A4BD4, 0x3AD26B25,
+   0xB599F984, 0xEC1E0E92, 0xBF469A90, 0xFB5EEB9C,
+   0x85A9C63B, 0xBCD9888F, 0x5AAF87CF, 0x38201DEE,
+   0x5B14945A, 0xB4234BE1, 0x65942C3A, 0x5D76CC14,
+   0xC7B5212F, 0xB5F17E89, 0x4D6911ED, 0xC7D32202,
+   0x970D7BDB, 0xB0051DCA, 0xB9D1D62D, 0xB3AC1A1F,
+   0xF98F8FD6, 0x72EC38DA, 0x59FB560F, 0x155BF888,
+   0x87F1F38D, 0x2E11E000, 0x9F494624, 0xFC300F4F,
+   //Window 15
+   0xCD485D1C, 0x77F32039, 0xE77EF3F9, 0x0AF10BFA,
+   0xB5C0A09F, 0x881ED562, 0x2316A602, 0x38C088AC,
+   0xC0919DF5, 0xB697E0FF, 0x6BAC8B1F, 0x56A80DAE,
+   0xFAC5BC04, 0x17EC580C, 0xECE4D5A4, 0xC76909FD,
+   0xA9A07232, 0x2801020A, 0x4384667E, 0xFF06B5D1,
+   0xB1E4BE6C, 0xBC65E264, 0x1259802B, 0x4FABC2BF,
+   0xB3433D4B, 0xF30AB604, 0x0927DEA6, 0xAEDB5914,
+   0xDE0E8A2C, 0x06DF6FFF, 0x5219FD1C, 0xC78F615A,
+   0x97F4D020, 0xCDCBC475, 0xCF113A4E, 0x54D9A28E,
+   0xD61B480E, 0x78D64B95, 0x4A9E1F10, 0x2B4ACD97,
+   0xF08C2B56, 0xE8BE9812, 0x641652A2, 0x077FBE3B,
+   0x0A78E580, 0x057F360E, 0xA21BFDC1, 0x03328AE9,
+   0x50F71B37, 0x5941BAE3, 0xBCEF6E23, 0x0C38F597,
+   0x013D33AD, 0xDFF9A6CE, 0xB32AA10E, 0xEE5216E4,
+   0x505C2047, 0x4D3F7AC2, 0x05FD0C99, 0xE212C967,
+   0xE3F2D65A, 0x29289C25, 0xD238618D, 0x896964E8,
+   0xEE2ECF97, 0x7E47E080, 0xDDB0D30E, 0x1B1ED32A,
+   0xE056653E, 0xB23A6A7B, 0x8A970085, 0xAD058517,
+   0x006DE51E, 0x9D78CD91, 0x871D2D4E, 0xB6BEFE0F,
+   0x0EEC86E6, 0x64333A15, 0x42692EF2, 0x5D6E9A68,
+   0x3E926528, 0x251C548A, 0xA05320D5, 0x8D3BA527,
+   0x902FAAFA, 0x0AFBE064, 0x0AD0DD86, 0xB8797360,
+   0x5497C6AC, 0x9025A54B, 0x276F72B5, 0xDD294231,
+   0x47E51486, 0x3FFE816D, 0x975B877B, 0xB74748B6,
+   0x09043946, 0xB2FB2716, 0x56E24CB5, 0xCB9FAC36,
+   0x94A7B024, 0xD78CC27A, 0xCEBC1CBD, 0x449B90C2,
+   0xABF9E5E7, 0x9ACFA90B, 0x248E5DBD, 0x7F930400,
+   0x5D20F9D7, 0x50709370, 0x659170CB, 0x842B1178,
+   0xE14B96DF, 0x767D139B, 0x0F9D2C4A, 0xE4DB57F1,
+   0x90F22DE4, 0x0CD475FF, 0x6139250E, 0xFDEE6C18,
+   0xC2FDB130, 0x438938E8, 0xAF9AE02D, 0x950D01BC,
+   0x7487F6FD, 0xC388DBEC, 0xC87C9A14, 0xC851AEEA,
+   0x638CDB98, 0x0C456642, 0x4DB44668, 0x0BF7A2CE,
+   0x28A2B441, 0xD0D95DEE, 0x9563ECB4, 0x3A5349D3,
+   0x6F4C3581, 0x7A4143A4, 0x6ACB0DA4, 0x8592CE88,
+   0x22E7B6BC, 0xCA98C9BF, 0xF34B457E, 0xDCD6F9C1,
+   0x6D3CEB1A, 0x7EB1CC59, 0x84AFCB92, 0x732D7BDC,
+   0x452EF41C, 0xD0ABA44E, 0x91E4263B, 0x301D5267,
+   0x0A021331, 0x8B15FBF7, 0x82A8FEC4, 0xEE5C68FC,
+   0xF22C4040, 0xFF136D34, 0x519AA101, 0xF71DACE7,
+   0xC5E01782, 0xC7D6A0BD, 0xFF981503, 0x1A0DF664,
+   0x9D138085, 0xB18EECA7, 0x257D7C81, 0x18D9CBFD,
+   0xE707A28D, 0x26361D29, 0xD936DE43, 0x470B2432,
+   0x4F6F73BE, 0x3C31504C, 0x0CE6FB16, 0x827F255E,
+   0x645329C1, 0x566C9340, 0xC9122A49, 0x34FBDD7B,
+   0x4B087320, 0xDCBFDC4E, 0x3DC83CFB, 0x9D8CC44E,
+   0x7A802F2A, 0x35BBFF4C, 0x6738FBB6, 0x4CC250C8,
+   0x1B87BEE2, 0x81098C8B, 0x1F56667A, 0xC09091AA,
+   //Window 16
+   0xD74D9642, 0x06BA5918, 0xDFA0F56D, 0x92DD9CDE,
+   0x8CBAE3EF, 0x74C1AC3D, 0x5F6F39BF, 0x2FCE93BF,
+   0xE2CFE67C, 0xFF348797, 0x510CC718, 0x079DC566,
+   0xC16BB523, 0xA0ECD5D0, 0xCC51C42F, 0x29F49D50,
+   0x892459A9, 0x36275538, 0x8484B5F1, 0x62637770,
+   0x5C806F88, 0x89A8437E, 0x5D9087BC, 0xA64DA09A,
+   0xB60D0AC6, 0x815FB712, 0x73890790, 0xD1EF5A45,
+   0xEFEA1FB3, 0xF40DA447, 0x15E87F40, 0x3E29C9BF,
+   0xD12A07AA, 0x769F7BCA, 0x93B2C623, 0xBF5C57A1,
+   0xAD0F80A0, 0x5682C9A2, 0x8DC86281, 0x028BA2B8,
+   0x2E1C30A1, 0x4CD34A8F, 0x442CF9EA, 0x380830C6,
+   0xEA6514F2, 0xA540E4FB, 0x93CACE0B, 0x6F615C16,
+   0x721DFCE2, 0x08E4B1E2, 0xEBB420B7, 0x363DDF01,
+   0x0C789A68, 0xC12E5BDB, 0xAC7B889F, 0xD2313FDF,
+   0x6F8E00D6, 0x9CBDCD18, 0x334D9477, 0x9137D017,
+   0x784B0871, 0x44DB714A, 0xDFFEB038, 0xDB2818A9,
+   0xA1CED644, 0x8C0CE678, 0xDEB44F66, 0x5ED1C727,
+   0x0EFBEB3B, 0xC7B99468, 0x0F86B0CE, 0x4E49496D,
+   0xCF73FDF9, 0x7C03DF6F, 0x7BEB454D, 0x5A2F5F64,
+   0x12036B42, 0xFB767159, 0x3509D22B, 0x083F7601,
+   0x333C2D86, 0x355EF5CF, 0xD0E93ED1, 0xEFDB05AC,
+   0x6E2AC34B, 0x2737515B, 0x4A00E986, 0x5613C62B,
+   0x0140C559, 0x3F43747D, 0x85B8AB03, 0xBB54747E,
+   0x2D9FDD69, 0xEA28555D, 0xE4C3E43A, 0xC3E4B638,
+   0xF5679C30, 0x69280D83, 0xADBEF9A6, 0x1FE4152D,
+   0x85982882, 0xBA9C2357, 0xD98007D5, 0x1383324E,
+   0x5FC38D9D, 0xD0A87436, 0xA922140F, 0x73349E8F,
+   0x9B310C5B, 0xD984BF59, 0x6A3ACA2C, 0xDAF073DD,
+   0xAFA83E51, 0xD888F058, 0x8723CEF3, 0x1B2576FA,
+   0xC21FDC74, 0x08CB0FA2, 0xD85C264F, 0x8022A598,
+   0x8EEE0086, 0xD6847C9C, 0xC7642C03, 0xDADF1E5C,
+   0x5425711C, 0x1869FDFF, 0xE212166E, 0x169680D6,
+   0x9572E8CC, 0x2A684B3D, 0x04005968, 0x2845872F,
+   0x0B97226F, 0x02E14599, 0x98486531, 0xE8C2F8C6,
+   0x2CD011D7, 0x9944A3BE, 0x0E76F293, 0x23839225,
+   0x95D65825, 0x906BF563, 0x148CB6D8, 0x68F7571E,
+   0x3BE71D45, 0xE2BA5ED6, 0x978F0C62, 0x918382EA,
+   0xE33B308B, 0x75EA1CFD, 0x3CC3DC4C, 0xD42F8EC9,
+   0x9C36C02B, 0x42D0FF24, 0xB476F456, 0x20B7BC99,
+   0x3BD8189B, 0x88C6C7AD, 0xE70186E6, 0xDC37CBD5,
+   0x27945EF7, 0x91676010, 0xECBA9A5C, 0xEEA72E35,
+   0xFF37C61C, 0x290D5161, 0x20EF377C, 0xD634B4FD,
+   0xE042A66E, 0x896A3C0B, 0xAFED4D3E, 0x718AF55D,
+   0x33F01076, 0x5DBBAA2F, 0x606D5232, 0xF949F290,
+   0x4C5B75A5, 0xA6717D80, 0x17042D13, 0x73073E74,
+   0x9741AF5F, 0x1A7B91E8, 0xEF85A60B, 0xA66DB18D,
+   0x872EA76B, 0xDA7B2143, 0x09B41904, 0x6BDB418F,
+   0x855956DB, 0x30CD7748, 0x0BD506B9, 0x567B5AC8,
+   //Window 17
+   0x1D845828, 0x7A605CBF, 0x6B74DD32, 0x9D338308,
+   0x250B7A72, 0xB00CD47A, 0x964452BD, 0xA5A5F852,
+   0x7A9D39ED, 0x1E39D6DF, 0x3A976AC7, 0x89AC606A,
+   0xDEFB5093, 0x09DF5DD5, 0x26A847C5, 0x916F53C3,
+   0xE1C388F2, 0x7FE24DA6, 0xEED7CEC9, 0x4D38DA8E,
+   0xE37BBBE8, 0x9EFE7F18, 0x1EC6CCB4, 0x310AB22E,
+   0xA7B49EA1, 0x3AD95DE1, 0x71DB7AB9, 0xCEDE2931,
+   0x7F6C1F96, 0x1CB1691A, 0x945BC0DB, 0xBCF20FC4,
+   0x704E434C, 0x16C8B065, 0xD9B92058, 0x75030622,
+   0x17393C81, 0xBF8CBA1C, 0xBD65AF6F, 0xF8C8484D,
+   0x86475FE0, 0xF9B4F9D1, 0x8DFAA2ED, 0xBC56B987,
+   0xAC6B6564, 0xD9009DAB, 0x51EBFA7B, 0x118C1D83,
+   0x51DCB931, 0x0D4444EE, 0xEC9B0FCA, 0x7D447EE1,
+   0xF8E4278A, 0x5E62091F, 0xC28DE501, 0x1D8A3610,
+   0xF6480043, 0xEF4C1B7B, 0xB97A3C69, 0xCB3807E9,
+   0x8F234F9A, 0x184F6003, 0x476D933B, 0xA1E1BBF4,
+   0xCB235791, 0x673C3F25, 0xCA7A5C86, 0x8BF54E6A,
+   0xB117348A, 0xBA528BF4, 0xDCFC771B, 0x435520B5,
+   0x43EC921C, 0xCA4692A1, 0x437242CC, 0x44E4EA6C,
+   0x4FEC4995, 0x14D84731, 0x40F6231C, 0xFEF3C0C1,
+   0x948F66BA, 0x2A582001, 0x378636CA, 0xF98A1D0C,
+   0x55928E9D, 0xF5C26162, 0xD4E00659, 0x156D666F,
+   0x3D61964D, 0x66A35221, 0xF4178580, 0x52CEEF47,
+   0x558E795B, 0xE32C9FAD, 0x4167683B, 0x52210179,
+   0x1850E103, 0x10524EA6, 0x04241DD0, 0x0C726673,
+   0xBA173737, 0xBAD3BCA3, 0xC52C5D0C, 0x365B2A05,
+   0xC8C30D20, 0x84658274, 0x4857F8C3, 0x442FF125,
+   0x67DB9887, 0x70D455CA, 0x3E14AC51, 0xBD778110,
+   0x545AC8E8, 0x8F02162B, 0xCB35C878, 0x1FFED4AA,
+   0xA7A0C395, 0x2B0EC5D9, 0x6FF9E30A, 0xB77EC2E9,
+   0x4C53C231, 0x640D1354, 0x0D2F4047, 0x262FC08E,
+   0xFC04DD69, 0x7B2E66E4, 0x7F3D2B30, 0xFBED3AB1,
+   0x0B8FAFE8, 0xA81E303A, 0xE48CB1B3, 0x139CE60B,
+   0x424102B4, 0x009A5807, 0x29209269, 0x0877968F,
+   0x535D5E35, 0xF35F0606, 0x5CE5ACDF, 0xF4E1A46B,
+   0x8CAE22CD, 0x1E2F4935, 0x8AAF14E0, 0x0E0D784D,
+   0x99DC1F5A, 0x26273C3E, 0x6F3ED683, 0xA9F5E332,
+   0xC1E8C305, 0xF25EF4DA, 0x4C7C0C98, 0xF9C44E60,
+   0x75D68DCD, 0x230114C4, 0xADB0CBF0, 0xFD70A67D,
+   0x98544C46, 0x3AD87C10, 0x54A8CDCE, 0x45DFA0E5,
+   0x81DBCEFE, 0x2DCC43E4, 0x629CF127, 0xCE1C38E9,
+   0xB38C89BA, 0xB65398FC, 0x78AED8E2, 0xF4FEDEA4,
+   0x4234C457, 0x9C7EC022, 0xF7B436B5, 0xA23549EB,
+   0x7645C8C9, 0x36BB6968, 0x7E6D7137, 0xB27AD0F5,
+   0xA99D5728, 0x0FF1786E, 0x0E0C4354, 0x64475D50,
+   0x88C7D16E, 0x9CA6A548, 0x42FCCA0A, 0xA8F59040,
+   0xF9BD6605, 0x1909F882, 0xC5637509, 0xD0A4D250,
+   0x6BB4D9C0, 0xB20D9211, 0x1D86B95F, 0xEDD49C7F,
+   //Window 18
+   0x9211FA73, 0xAC45111A, 0x06A39BD4, 0xCE690AD3,
+   0xDAF57C5E, 0x1CF6877D, 0x5831213C, 0x7707A815,
+   0xB658221B, 0x85C3003B, 0xE0344C2A, 0x59DE5A56,
+   0xA45D9E35, 0x468AC4C7, 0xF49C0BEE, 0x02E3059C,
+   0x8EF2ACBB, 0x36089F51, 0x8199FAC3, 0xA41CA1E0,
+   0xA08F5C25, 0xFEB4CD34, 0xD916513A, 0x411D2298,
+   0xD63E042E, 0x0D361718, 0xB106C172, 0x2614E322,
+   0xB61580FE, 0x3001E999, 0xEA83A64A, 0x1A321D5F,
+   0xB1C0DAD6, 0x53E42B48, 0x84FC0EB2, 0x33C647E2,
+   0xD330E54E, 0xBA4644E0, 0x66B172A7, 0x4FC42990,
+   0xF66936CB, 0xDD0B0386, 0x403978EB, 0xD20D4D26,
+   0xCF90172E, 0x5515A2C9, 0xAB9E2A84, 0x83CBBF35,
+   0xCE066C5A, 0x4FEE5A94, 0xE23E055E, 0x00F156BE,
+   0xA9BB9E06, 0x1367D5C0, 0xCC3B8562, 0xC14D9D3F,
+   0x385DEDCE, 0xE0E9A140, 0x0200EFC8, 0x1332D768,
+   0xA4CEE262, 0x4A8AB442, 0x1F9F1D94, 0xA60CB92D,
+   0x865B67BC, 0x5326750A, 0x97C7F758, 0xA960A6EA,
+   0x40E3C17F, 0x23FFB6AE, 0xDC5AA4A3, 0x7002C3BF,
+   0x68C9122B, 0xE15B9E22, 0x8EC1E59E, 0x0D1C8DF3,
+   0x0597145D, 0x73AAF1BE, 0x721578A3, 0x85521590,
+   0x5E7C68AE, 0xB4F21378, 0x917691EE, 0x8880C28B,
+   0xF215E680, 0xFCEBEC82, 0x71280B3C, 0x75416B28,
+   0xDFAB768D, 0xDB50B969, 0x23932D8E, 0xB15C97EA,
+   0x26F0FFA9, 0x638018F4, 0x098DDE2A, 0x476B210B,
+   0xCAF91C99, 0x724CC931, 0x5763BB98, 0xA6441BDC,
+   0x3559AF2F, 0x49BD6339, 0x496BFD59, 0xA5A617D9,
+   0x04D04DB9, 0x8436AA24, 0x9D217AEB, 0x370D68E8,
+   0xB2683063, 0xAB831990, 0x9007F0FA, 0x7BBADDA2,
+   0x59F1D011, 0x2B5D1CBA, 0xDED960A0, 0xC48CAF3A,
+   0x55DEB670, 0xC8A17144, 0x3C5EF10B, 0xBD77BC7D,
+   0x9EACC06D, 0x7812AC6F, 0x5BECE302, 0x7A4DF55B,
+   0xE7D4BCE6, 0xDD3F0F4B, 0xE3356B57, 0x21E83815,
+   0xA96979C3, 0xC5D77622, 0x51812EDD, 0xA1069634,
+   0xDDB6291F, 0x7D38A5AD, 0x99442191, 0x56A428C8,
+   0x119A61CC, 0x6A648048, 0xE5C488DD, 0x7EA237F2,
+   0xCA5CCDC3, 0xDB2B369B, 0x2A50823B, 0x5BC7C617,
+   0x9B7375E2, 0x21E1538E, 0xD3D5D24D, 0xC92A7F7D,
+   0xC6A95D0E, 0xB45A90C9, 0x5F2C89B7, 0xD38A0A3D,
+   0xF85AFB0A, 0xD7AFAC3A, 0xDC090276, 0xD4A5A22C,
+   0x37FD290C, 0x93C6D984, 0x86CDA4AE, 0x246BE62B,
+   0x2B7544A0, 0x5DE42073, 0x914A5AC4, 0x982FCFB5,
+   0x5F2C798E, 0x1A4941FA, 0x560429BC, 0x0E3E3EF3,
+   0x88E1E7EC, 0xCB9B41B0, 0xF42F5335, 0xE43614B6,
+   0x4162FA43, 0x2EEEEFFA, 0x3A3234C6, 0x1180EFFE,
+   0x3EEEEC3D, 0xB1F7EB3D, 0x99A17950, 0xA8AFD00A,
+   0x455423A8, 0x4E49F586, 0x056223FC, 0xDB0A1FA4,
+   0xE1B6BA4C, 0x07E5C86D, 0x76B5A261, 0x4CA3BB96,
+   0x9C55F95D, 0x30E5E1AE, 0xEA9B57DD, 0x97C3414A,
+   //Window 19
+   0xBBC7E72A, 0xEBA8E784, 0xEFE97E5B, 0xEC1D62BC,
+   0x417FB221, 0xBCC4322E, 0x54DE88AF, 0xABA96295,
+   0xC903DC6A, 0xBB4003BD, 0xD084B7CB, 0x4EC12D78,
+   0xC3D9D39A, 0x9093107B, 0x6AF9E4DE, 0x02878403,
+   0x06936041, 0x6E0920C2, 0x2491C59F, 0x01993809,
+   0x49F4C8CF, 0xE716CCFD, 0x6F80FA8B, 0x5D74A6C9,
+   0xAEC88628, 0x02DB6411, 0xFB164265, 0x91F6BC73,
+   0x0D312312, 0xCE88B710, 0xE2A5BD00, 0xF4C7A281,
+   0x096463B9, 0x111143CE, 0x466938BA, 0x0ABB03A3,
+   0xEF49F86A, 0x54A306FA, 0x6D3E0BE9, 0x313BBDF6,
+   0xA725CAF5, 0xC4D58BE9, 0x943275C9, 0xE88A2401,
+   0x3DA783E1, 0x91CB8140, 0x5608271B, 0x11554814,
+   0x76BD8239, 0x9A7E1564, 0x091C4953, 0x070931D5,
+   0xD807C337, 0x4E186CF0, 0x162A1766, 0x9208CB2E,
+   0x1629423E, 0x890E6E9E, 0x2E5C2641, 0x104BD81A,
+   0x5CC3AC52, 0x4D6E79D1, 0xA944BB84, 0x9930341D,
+   0xE27E3D0C, 0x4FC1EE29, 0x730BCB16, 0x673D7D95,
+   0xFD9BE1B5, 0x7312B6A1, 0xB9F047FF, 0x5CFBD277,
+   0x7B00A982, 0x886E3B9F, 0x49DCBD71, 0x2614A4DF,
+   0x42DB236B, 0x64C230B9, 0x4CF495FD, 0x24CED6AA,
+   0x99839644, 0x8F866E01, 0xA36C769A, 0x37B9B726,
+   0x4514EB3A, 0xCCE562FC, 0x71478CD6, 0x44A1B415,
+   0xCC2C5311, 0x03A11AD2, 0xFA7F8FD3, 0x7FDEE32E,
+   0x8FC29A84, 0x5C8871DB, 0xE51464CE, 0x2E4DA390,
+   0x256A1D9D, 0x84116629, 0xB0D61C44, 0xB23638E5,
+   0x68A05E3C, 0x96C5355F, 0x2B255370, 0xD065617A,
+   0x673E4A81, 0x870487D4, 0x28ABDE16, 0x93EE876C,
+   0x6E4CC6D9, 0x9634FE30, 0x1D2E5BAF, 0xBBC4D24A,
+   0x748A10F9, 0xAEC09AF6, 0x72DE9F0B, 0x20F24ED3,
+   0xC57F7532, 0x2B4C337F, 0xD61AC4EA, 0x23CCE5A2,
+   0x489F20CB, 0xDBDEDC8F, 0x9BB141E6, 0x662039C4,
+   0xA1D4C21B, 0xBED5B418, 0x7F2B3CCF, 0xD29D92A8,
+   0x20356571, 0xA0E4214C, 0xECCA4AEE, 0x300D7E33,
+   0x901DE4B7, 0x31B54806, 0x9B08BFF7, 0x3B3D60A4,
+   0x18A2C68F, 0x08AC5341, 0x8CDEB29E, 0xF5E900F2,
+   0x9BB91CFA, 0xAAEE9CE2, 0xDF7BB617, 0x580040D6,
+   0x7C9FDF89, 0x9E156AA9, 0x46345A0D, 0x2042F38A,
+   0xF9F5421E, 0xFB95D2A5, 0x23602F0F, 0x4CB1DE62,
+   0x02F1407F, 0x4FED63D4, 0x88687C07, 0x23884EA7,
+   0x8A226869, 0xFF92C5C8, 0xF45F97F0, 0x8AE482A4,
+   0x65757AFD, 0xE096467B, 0xEB3B436E, 0x965B0A30,
+   0x56015F3E, 0x0669A5D7, 0x276375EB, 0xDAC2EA61,
+   0x99471FE5, 0x69499928, 0x2D21C004, 0xF63C9FE8,
+   0xEDF2CAE1, 0xEB0D8E4A, 0x0F95D836, 0xA1E57875,
+   0xADF87A8D, 0x901F96FC, 0x1B945B9D, 0xE049AF8B,
+   0x1E551F66, 0xBD1F188D, 0x1F5FFEA1, 0x41118905,
+   0x95CDFBB2, 0x49E16FEE, 0x5B5F04CC, 0x62D5C20E,
+   0xC9AF7AF9, 0xF4495B0D, 0x11AB7A09, 0xA7993C15,
+   //Window 20
+   0x08D7E82F, 0x0762FE2F, 0x8591E9EC, 0x950F4481,
+   0x1CC0D4B1, 0xB4EF28CF, 0x3E1774A6, 0x7A9336D4,
+   0x87EC952D, 0x7AA7AE12, 0xF8794748, 0xB31975D3,
+   0x4A220CA4, 0xB96A9042, 0x30560A02, 0x99002B95,
+   0x6186F30E, 0x3DE7B18B, 0x9CA19D83, 0x63628BC1,
+   0xE7DCBD8E, 0x185B2584, 0x7C371327, 0xDF11408C,
+   0xFDCBAE9E, 0xF81452F8, 0x0A39BBE8, 0x0C980C60,
+   0x85E28280, 0x1395042E, 0x38BBB994, 0x81E4EFF1,
+   0x1C2EB548, 0x79AEEC02, 0xBA07B447, 0x97BCA53A,
+   0xA562A5AD, 0x0718EDCC, 0xE29ACEB1, 0x8DDDD400,
+   0x29E3065F, 0x4687114C, 0x7289C366, 0xB5FC567F,
+   0xF955D6AE, 0xD7D62D4F, 0xF517BF31, 0x10FE0BAD,
+   0x89660FD5, 0xEEBAD8A3, 0x8D3A30DA, 0xD57A3A25,
+   0xFBA00599, 0x89954368, 0x56BE797F, 0x8BE7FAE5,
+   0xD79C6591, 0x065A02C3, 0xFCA27DE9, 0x4326DCA8,
+   0x965E5C25, 0x5BA0E56F, 0x711EB85A, 0x406C6883,
+   0x21CB759C, 0x142FD060, 0x47E3E4D7, 0xE2C681A6,
+   0xDF115D79, 0x493EF951, 0xB438AD8D, 0xB7C8CBB7,
+   0x0B3DFEF9, 0x8C971AD6, 0x1E5C16F8, 0xF963A3F4,
+   0x5BC1F6A4, 0xC5998A2F, 0x74700240, 0xBB705B42,
+   0x70B05895, 0x78331A15, 0xF6C7D1C5, 0x1EA4E3BA,
+   0xB50018FE, 0x8EB45AE7, 0xFA45E55C, 0xCC4D16E8,
+   0xE14EFBA8, 0x4CD285B6, 0x7D224AA9, 0x6A1DB1B3,
+   0x889AD565, 0xB6226747, 0xEE53B734, 0x2FCEAF70,
+   0xD129F4BD, 0xC699BFBF, 0x02D03B97, 0x05A00FED,
+   0x93557E15, 0x7F268C25, 0x520A173E, 0x1699EDD4,
+   0xD3995FC2, 0xB1A19750, 0x8CE2C751, 0xB0197F85,
+   0x9FFE0AF9, 0x6E0C477C, 0x74A14CCE, 0xEC8F2A53,
+   0x11BAEDD1, 0x57FB07AF, 0x14E27012, 0xAFACAB09,
+   0x695F323E, 0xEC8441B5, 0x8A0CE868, 0xCFDAD397,
+   0x538AC2D9, 0x40D12555, 0x26B04A6D, 0x6ABA78CC,
+   0xAD4B3577, 0xCC98E874, 0x29E473A9, 0x01600A56,
+   0x83E84136, 0xB1820346, 0x5A231308, 0x7EBA70C4,
+   0x5319B3EA, 0x7FA35392, 0x86D214B1, 0xDA42C124,
+   0xFAF6420E, 0x2F1585EB, 0x9C214462, 0x7F95E4A8,
+   0x70B17076, 0xB4C2582D, 0x80DF56F1, 0xDAA3ACE7,
+   0x3386B130, 0xDE9CCDFA, 0xD65F982B, 0x8B0A7D46,
+   0x1DFEA483, 0x478F4568, 0xDA9C8B50, 0x3A60EA0E,
+   0x4EDD351F, 0x6972ED98, 0x1138B048, 0x362C5746,
+   0x87E9B696, 0x4DD37D14, 0x90B962EC, 0xA4611087,
+   0x5467B25B, 0x08513983, 0x94FB3B95, 0x6F86000D,
+   0xA09B5937, 0xA9227510, 0xE2BC3623, 0xCF1FC429,
+   0x0762BD3E, 0x1F72AB76, 0x6ED283DE, 0xE4E6AE12,
+   0x2AEC4E7C, 0xF41B9421, 0x8E466318, 0x82C70C90,
+   0xF31A6BEB, 0xD312F034, 0xB070223F, 0xDAC28EC2,
+   0x2809E73D, 0x35AECA93, 0x3E223986, 0x0F0E0FA4,
+   0x3379E320, 0x85586206, 0xF6D9FD48, 0x6978FCAD,
+   0xFAFDE8F2, 0xB15AF695, 0x8922CDF5, 0xB6200C0A,
+   //Window 21
+   0x9A87BDDB, 0xE7658A42, 0x749C85ED, 0xDDBEEF12,
+   0x8CC5B531, 0xF94C76CD, 0x195B04D3, 0xF1F8E726,
+   0xBEC4A862, 0x7430740E, 0x7BCC96F5, 0xF84E292B,
+   0x05AFAD92, 0xADB05A6F, 0xDCCD2A07, 0x6F60FB80,
+   0x16EBE27E, 0xE5F7A486, 0x29AB1CA6, 0xD94D431D,
+   0xACC19CDB, 0x19C9C477, 0x6C088656, 0x3948F91F,
+   0xC815E0E8, 0x1928CB30, 0x199070B7, 0xFB80114D,
+   0xB16F84D8, 0x176FC23F, 0x870B8ED2, 0x35D9A5AD,
+   0xBF657B4D, 0x70B8FCA4, 0x45C52DCE, 0x9B19F14B,
+   0xE0E4472F, 0x907CC829, 0x90C4A329, 0x71A895C7,
+   0x897F24B9, 0xE4E6D7ED, 0x9E14086E, 0x30448AF1,
+   0x7595C405, 0x1C5B0219, 0x9E034C03, 0x7A857C7A,
+   0x6BE13241, 0x70FEADB4, 0x9D4C4202, 0xA872AE17,
+   0x330C0EE1, 0x694FFCF3, 0xC37EF50A, 0x104FDBBA,
+   0xB3BE5164, 0x03D03F16, 0xC6E9BE9A, 0x1EF9CD74,
+   0x218B2DD2, 0x7F484049, 0x4ECD343A, 0x7D73713A,
+   0xF3AF8BF2, 0x3268737B, 0x3955B986, 0xCD33F815,
+   0x67C44060, 0xC8647635, 0xC6B31778, 0x10B93B7E,
+   0x3D47877A, 0x6B587A62, 0x2F6C3745, 0x06510E3B,
+   0x9B1DB6E8, 0xEE6E0362, 0x0DC2979E, 0xF2E23AAB,
+   0xF366347D, 0x8FCF1202, 0x9EAB6308, 0x62376CD6,
+   0x9CEB2C28, 0xEB92F8C9, 0x660BEE2E, 0xD4ADE6F0,
+   0x6B68780B, 0x260E99E6, 0x608C16E0, 0xBC273B62,
+   0x5215157B, 0x06C819D4, 0xF33A3546, 0xB0FC5563,
+   0x61312317, 0xF5E194C2, 0x2AF834C3, 0x342D07D1,
+   0x5C2C8597, 0x71AEB8CD, 0xB1751184, 0xED873FAA,
+   0xC310A08E, 0xD34EF04C, 0xACE42DD3, 0xDE97D275,
+   0x7B21491C, 0xF693F82C, 0x10E615E2, 0x2DA8171A,
+   0x992891C5, 0x745609BC, 0xED4F5207, 0xB2700CDA,
+   0x4A6A85B4, 0xC6904842, 0x1A01976C, 0xC35CD5AB,
+   0x8A82FC5F, 0xBCF1D0A2, 0x0D0A0916, 0x86C0341E,
+   0xC4C1B479, 0xF46B8357, 0xAD5805E6, 0xC4C1E247,
+   0x61D32910, 0x3C4750FE, 0x22E1E09B, 0xB359FE70,
+   0xE1004B0C, 0x89C17D01, 0xE528BCE8, 0x0A3BD4F8,
+   0x61343F31, 0x099E41C2, 0x67AB0F6C, 0x939391E6,
+   0x8C8762F2, 0x894DA8AF, 0x43175C9E, 0x63328108,
+   0x77572AFD, 0x1790ED96, 0xE475439A, 0xA3A5AF49,
+   0xE3ECFE3A, 0x68A93BCC, 0xB17E90DE, 0xC80B5076,
+   0x3D89F3C9, 0xA05CE442, 0x4D80978B, 0x054ACE02,
+   0x29D7CF55, 0x5B3281A5, 0x6C35D0F3, 0x67432A88,
+   0xE7FDD2BE, 0x0D86C0B2, 0x9601EE22, 0x5B9A80D7,
+   0xC62C46CB, 0x82E62205, 0x3881EDC5, 0xEBB40010,
+   0x12871B55, 0xF12786E9, 0x932623F0, 0xCE0C8168,
+   0x9E0AA66E, 0xA7CFB9CB, 0x7C565858, 0x17633276,
+   0xE295EDDC, 0x6DF0FE65, 0x53B3EC56, 0xC0508BC3,
+   0xE1F528B6, 0xB988BFC1, 0x269691D8, 0x3094D499,
+   0x9CB1ED7D, 0x9A63F88C, 0xC978A57E, 0x602565CD,
+   0xC82C08A9, 0xE7EF069F, 0xD172A8B9, 0xBA343896,
+   //Window 22
+   0x40A566E4, 0x1EC88356, 0x52F856BC, 0x471C2FC8,
+   0x263796FD, 0xA8C8B378, 0xAB0F109F, 0x8E3BA3E5,
+   0x70F1FA00, 0x57BF0A23, 0xEDEEB698, 0xF4095B6F,
+   0xB3EE6DEB, 0x99472DFF, 0x31EA0776, 0x637AF70D,
+   0x8A9437E5, 0x202B5905, 0x8651B370, 0x896E8F4E,
+   0x8AD736CE, 0xAB946C50, 0x90A13CB3, 0xBF6EC454,
+   0x3A5B4B9B, 0xE927D37A, 0xB459F311, 0x171C8956,
+   0x6019EB69, 0x2A67FB53, 0xD8E1416B, 0x287094FA,
+   0x2C72AB23, 0x437FB08C, 0x41CEBEF2, 0xBC06ADAF,
+   0x64359006, 0x2A262BA0, 0x1D606DFC, 0xBA53A5AB,
+   0x921F0BF4, 0x339891E7, 0xC4293156, 0xA2D5BA0F,
+   0x3C235B31, 0x9B660A64, 0x53270A78, 0xA09F9E96,
+   0xC494E0B9, 0x3D5CD742, 0x916FEB02, 0x48D93078,
+   0xB7BFB5DF, 0x9D902CD1, 0xDB531017, 0x3876D60E,
+   0xA1C0EED4, 0xF37214D2, 0x5BE75DBA, 0xA0196EB8,
+   0x1FBF3871, 0x65B7B621, 0xB3E354A9, 0xAD7B7818,
+   0x3AA13831, 0x5F6A1E42, 0x32D087F4, 0xEBA4B791,
+   0xAC943754, 0x8210991D, 0x33BBC97E, 0x8EE6F693,
+   0xF454F756, 0xBF4FD27D, 0x7E7F7BB6, 0xD0951AFE,
+   0xC06A4BBD, 0xB750BCEE, 0xF39B2950, 0xC396C33E,
+   0x18703405, 0xADC20AB9, 0xBD7F6013, 0x4033402C,
+   0xD90FDFC4, 0x236BE56D, 0x58CA4F34, 0xBD43371B,
+   0x761CAFFA, 0x249FE2CB, 0xEB4438C2, 0xD4F4C994,
+   0xC971A63C, 0x0F932A67, 0x69EC24BA, 0x61F5A430,
+   0xEFC7873C, 0x5F77191B, 0x35393805, 0xE6410786,
+   0x3EC2CB2D, 0xA9CB742E, 0x0FADAF12, 0xDF885B6B,
+   0x1959B71F, 0xBC65DFA0, 0xFE670ABF, 0x56C704B5,
+   0xC7CA33B1, 0xE8A991DE, 0x9F14AA24, 0x6038F1A0,
+   0xB3F79399, 0xAC067DFB, 0x9FD7371B, 0xBD06392C,
+   0xD4A2EEB5, 0x2E00B79E, 0x2A58AFEE, 0x1D65EBF8,
+   0x714BD3A5, 0x4FC76B2B, 0x9660B480, 0xA246D893,
+   0x013CAA04, 0x7CE97EAD, 0x1B875357, 0xB7718A37,
+   0xD31D5FEB, 0x4D64593A, 0x2DE03531, 0xA1B31AFD,
+   0xBE68E2A0, 0x3B5EF2B5, 0x48EAAD3F, 0xF783E491,
+   0x66876608, 0xBABF3F8E, 0xEE6BA9E1, 0x4BDCA0AF,
+   0x7B68EDD4, 0x4BB6B4C3, 0xAB9272D6, 0x93E5CB91,
+   0x45AFC8DF, 0x3159C267, 0xC0B5B733, 0xC7F69675,
+   0x7D1FC5A0, 0x2341E600, 0x2FE45DA6, 0x62AC8767,
+   0xA72AE03C, 0xAE70404F, 0x75D26BAE, 0xD3AD4839,
+   0x4A825B7D, 0xF8C033BD, 0xE57B8F69, 0xB2FC13E0,
+   0x8D3F74A0, 0x94A904F0, 0xD648B557, 0xED108AD6,
+   0xAFA06947, 0xFACB2253, 0x60283880, 0xD97C6C74,
+   0xCBF551FB, 0x80E21A91, 0x0036EA1A, 0x47A66787,
+   0x77DFD7EB, 0x45EA5A0D, 0xE136F30E, 0xA0CC35A0,
+   0x476FA4C3, 0xEDE43491, 0x8B32358F, 0x4974AA43,
+   0x061E35F6, 0x6A7B1D87, 0xE4905567, 0x0CA8827F,
+   0xEAC95534, 0xF72AEF54, 0xC7C0B4A6, 0x8A8CAB04,
+   0x1E37CDBB, 0xCFBD1E5A, 0x47EC8E4D, 0xCB6B3479,
+   //Window 23
+   0x843354FA, 0x4A022566, 0x6D03B7B6, 0x19B11F29,
+   0xCD1C65ED, 0xE6D86F21, 0x39BFB9CC, 0x846A727B,
+   0x69420B94, 0x79CB7BF1, 0x234EDF6D, 0x9D755D13,
+   0x67903BE8, 0xA17F33FB, 0x4078F9ED, 0xFA15EA93,
+   0x52E6F955, 0x0F85C2AF, 0x321DF41E, 0x7CE2A463,
+   0xF5EAB794, 0x43B47A5A, 0x2BDBEABB, 0xC490547B,
+   0x9D807CAB, 0x240345D4, 0x4BAC3ACB, 0x97364595,
+   0x9709BC0E, 0x53684A9C, 0x599C6B86, 0x8991EF6C,
+   0x0AC3726B, 0xA8104ECB, 0x67A1064B, 0x8CB820F2,
+   0xBFADEB38, 0x0D8A9B12, 0xEAFB0E2F, 0x6F8EF7A4,
+   0x4A2A14D5, 0x27264C29, 0x0679CFE8, 0x7753851D,
+   0x22CF1A76, 0xDDC72440, 0xCB1F2E18, 0x99C442DA,
+   0x2B23C896, 0x00888FD9, 0xA8D2BD5D, 0x0AC099B0,
+   0xADEFE6B7, 0x4B751E94, 0x9D3F7776, 0x35BC5EBB,
+   0x8B782AC4, 0x62C6BD7D, 0xC07A4497, 0x01884C0E,
+   0x1E542B1D, 0xCC03D9C5, 0x99AD10FA, 0x001F95D3,
+   0x80BF1D92, 0xD0A2FFAA, 0x265D469C, 0xA9A8C5D9,
+   0xBA29CE13, 0x40334439, 0xCB80213D, 0x29B4CA19,
+   0x059E8C9A, 0x5665D855, 0xBE5C4DB2, 0x219F27D9,
+   0xE19058C2, 0x767AC904, 0xEC4BF280, 0x5FB0357B,
+   0xA6E151E6, 0xB2D7BD5C, 0x94A33148, 0x5E28F039,
+   0x810F36A5, 0x92D03CDF, 0xC4690F31, 0x2EBB9B24,
+   0x0009AFB6, 0xFC530594, 0x97C08110, 0x9C214DC4,
+   0x38683226, 0x12049C3C, 0x17102DED, 0xF766980B,
+   0xADAEDBA7, 0x71194E5B, 0x8FA31E08, 0xDA99348F,
+   0x8C958965, 0x686A390E, 0xF314FFCD, 0xD4CD3760,
+   0x18B10818, 0x50665BAD, 0xE4FA3C33, 0xE232BCF3,
+   0xEE61C109, 0xC90B0CC1, 0xFAC95123, 0xEDE5C239,
+   0xB30FFDB1, 0xA4CDFCCF, 0x5971001F, 0x272805AA,
+   0x62C718B2, 0xC1BE8E3A, 0x20864AC2, 0xBF58BCCF,
+   0x3D47DB66, 0xFE6375E8, 0xCE532067, 0xD955F4EA,
+   0xD15BA0F2, 0xC42561F8, 0x4782519F, 0xCA0B37C2,
+   0xD1C33D5B, 0x68B34E6C, 0x3271462E, 0xEB1FEEC6,
+   0x999A1A86, 0x8FC212F3, 0xE5E08DEB, 0xB204DB7B,
+   0x9FBB0C5C, 0xFD103D65, 0xFDCDD692, 0x1B44828A,
+   0x32A2F6E4, 0x59A726E9, 0xFE55A563, 0x0B168819,
+   0x4CF896C3, 0x54419AB2, 0x74A46E37, 0x36C5658D,
+   0x7C8373B8, 0x8F84B8CB, 0x7EC5C9DF, 0x45A3E511,
+   0x3C5B0229, 0x211F5077, 0x6B6C80BD, 0x2955A6A6,
+   0x2C264438, 0x56A0B7FF, 0x47F9FDA7, 0xDA814B16,
+   0x78282613, 0xED34DB73, 0x6CFEA329, 0x101ABC73,
+   0xC214456A, 0x57708FFA, 0xC665AF5E, 0xCA96932A,
+   0x453F9BC3, 0x1E8A0602, 0x7E0140BA, 0xC96C7C96,
+   0x553D236F, 0x8C8E91E2, 0xC8BF4410, 0xEF6A7C21,
+   0x001D8CA5, 0xFA503A7C, 0x7DEF3E2D, 0xF1C0078D,
+   0x27EF4D9D, 0xE00CD0B4, 0xDEAF84CF, 0x07F53CA4,
+   0xFF56119D, 0xD5197C79, 0x8665D6B0, 0xE9C6E2F5,
+   0x811FC7CC, 0x1106F900, 0x551BC8B7, 0x54A91CE6,
+   //Window 24
+   0xD8EE21C9, 0x39C1B328, 0x558717DB, 0x2C3E0C91,
+   0x3F8686A9, 0x4B58808B, 0x18141B1A, 0x43603909,
+   0x37CA7ABC, 0xD6E98B0D, 0x060CBD1B, 0xF532389A,
+   0x23D86ECD, 0x7A7E1839, 0x085A4E9A, 0x31EA31B1,
+   0xBE643603, 0xBC40CE5A, 0xA2124163, 0xBD22CFB2,
+   0xDE3A82BA, 0x6F04CAA2, 0xC3B38E69, 0xB9D2852C,
+   0x9FBF5DE5, 0x7CCEA65F, 0x7F58DD3A, 0xCC703C48,
+   0xB5B8F7C2, 0x8A91CB7C, 0x6B7BDEFE, 0x6E1A959E,
+   0x21D69D60, 0x64B3F910, 0x723EE7D7, 0x0418585A,
+   0x5B797DE2, 0x6A7E5C7C, 0x0D83371C, 0xAA90698A,
+   0xE4BD2494, 0x56AD8F91, 0x8A0F010C, 0x4E83CE07,
+   0x12DDB102, 0x741B85FF, 0x57543114, 0xF190BE7E,
+   0xB820CC41, 0x925CBF46, 0xE2208A39, 0xD18151FF,
+   0x3084BC48, 0x629ED4E7, 0x1338DB1E, 0xF60B9D3B,
+   0x6292F5A9, 0x5B9467E6, 0x129FD466, 0x1A770F8F,
+   0x7845743C, 0x9861F601, 0x1EA8C133, 0xA0AB0A86,
+   0x5DBC3FD7, 0xAB88D487, 0x286A9C70, 0x4EFEF311,
+   0x468318AF, 0x7993C5FD, 0x3CC4C235, 0xDAABEBF4,
+   0xCAD68884, 0x9A5B763B, 0xE02C6677, 0x5AA2B359,
+   0xA15207D5, 0xA3C6DBAE, 0xB4E18052, 0x93F0298E,
+   0x7DD7366B, 0x76962F41, 0xFAFEBC04, 0xC1E6E5E4,
+   0xB7CF818C, 0xADAF35A2, 0xC58F3797, 0xC29FF9A8,
+   0xF8D84364, 0x45E38FE0, 0x287EFC35, 0x5F70404B,
+   0x981400F3, 0xEECEEC43, 0x716AA814, 0xF89CF775,
+   0xB73046BD, 0xE3035E8B, 0x1DF5D737, 0x5D36C445,
+   0x78D58B7E, 0xC1057EFA, 0x16361F04, 0x1263DC6E,
+   0x8B4EE970, 0x4DD104E8, 0x733BB434, 0x3A4EFDEA,
+   0x771CCAD7, 0xE196405E, 0x61F44C47, 0xF9F8363B,
+   0x07E01EC5, 0x814BC4B7, 0xCDB043A9, 0x9744CF5E,
+   0xEEC7FDB7, 0x744013FF, 0x906E8DF1, 0x7B380B0C,
+   0x18A2AE91, 0x25307756, 0x56E55299, 0x54E727E8,
+   0x2BEEB8C6, 0x5BC04A03, 0xC1FEAB42, 0x3EF248FE,
+   0x0AF8A3DE, 0x32389C11, 0x0D8690BE, 0xE3D3B27D,
+   0xEC6B2AAB, 0x757DC8E9, 0x3BEEF187, 0x2B9802EA,
+   0x1297A5AA, 0x94E65EB7, 0xB5A0FE7A, 0x403879DA,
+   0xBB3E880F, 0xCF84AA5D, 0x0C8C4AAF, 0x19CB80B0,
+   0xA0E7D1EB, 0xE3E631F2, 0x59A78C6C, 0xDCFF73BD,
+   0x9F0429FB, 0x44269086, 0x3065DC57, 0x1C05F2C3,
+   0xD82FAAC6, 0xFBB78089, 0x0B10E502, 0xDF181E55,
+   0xFF3AD464, 0xA1922CA7, 0x0187561E, 0xF4EDA4C3,
+   0xE792B218, 0x9C954A5F, 0x7A6026D5, 0xBC741ABE,
+   0x8CD734A3, 0x72E75760, 0x8F533D5A, 0x476FD164,
+   0x36E48931, 0x41578980, 0xE0418765, 0x790CF3D3,
+   0x6C065FDD, 0x7F2FEF39, 0x6F0DB54B, 0xC6749DDC,
+   0x1B7EA9FD, 0xC17BC40D, 0x86BD702A, 0xEC5178A1,
+   0xE6276D0D, 0x22895800, 0x81DECA0D, 0x9239F5D1,
+   0x61F65D04, 0x6E252D72, 0x91B32EE9, 0x281A7D24,
+   0xCBA1EA69, 0x6C83EE80, 0x992051B2, 0x3AFAC506,
+   //Window 25
+   0x364F3D9B, 0x9703B2F6, 0x72DCBD76, 0xFFE30759,
+   0x54A63592, 0x0A8CE940, 0xDA220C9B, 0x422454F0,
+   0xC1BD4C63, 0x7DBE997E, 0x5D6BD8AF, 0xA3F97376,
+   0x1FB62ABF, 0xACBDC014, 0xCABA0102, 0x9FE70E8C,
+   0x076EEC6C, 0x19425828, 0x3251DFEF, 0xF72BF2A5,
+   0x4E84C4A3, 0x061B2BCE, 0x33435953, 0x228C2228,
+   0xA2F45920, 0x0E0E4636, 0x409EBD77, 0x359F9C05,
+   0x2FF96BDE, 0x6B418BD5, 0xEE7FCE77, 0xD015E540,
+   0xD5993067, 0xB1A009C8, 0xE4C5105E, 0x39525BFE,
+   0x5F85AABB, 0x1F9FDFD3, 0x3D0D23D7, 0xB729E9DA,
+   0xB0F7A5DB, 0x4789DECD, 0x74212BBE, 0x5285A9F1,
+   0x16F420A2, 0xA38E24DB, 0xCFDD43EA, 0x4C788DE4,
+   0xBCEA77E9, 0x53538A11, 0x8765D06C, 0x66304230,
+   0xA9CCB6BB, 0x8B889001, 0x895A4937, 0x053DEB2C,
+   0xA70FD3C4, 0xEB38B669, 0x478AFBA6, 0xBE7AA0B1,
+   0xCE6DD6C7, 0xC322CE90, 0xEB7C6327, 0x6F7EB483,
+   0x17F8D2B6, 0x360FDFE4, 0x147CC0F5, 0xE0D4854D,
+   0x17CC5C27, 0x6298BA9E, 0xAF675CC3, 0x4AB43385,
+   0xCB882C2A, 0xFC91C9F4, 0xE7044BFE, 0x72070F76,
+   0xC8C08F79, 0x3316E0B8, 0xD4FF0DF3, 0xBACC4CAB,
+   0x5499D51C, 0x0CD92ABC, 0x24CEF089, 0xA925D0A9,
+   0x78AE5070, 0x283CED4E, 0xF638D2C0, 0x5ECBDDB0,
+   0xFE1DDFC2, 0x60B86CDB, 0xDDD88C06, 0x34B687C1,
+   0x43DF0D14, 0x1ECA46CB, 0x03BA597C, 0x6A0D7C70,
+   0x200BD009, 0xFA3613FC, 0xA9CCF36F, 0x52466A2B,
+   0x5EC56061, 0x6B094FFA, 0xCEA1D73C, 0x153CBA5D,
+   0xB3AB240C, 0x7B2C6F2B, 0x17F26CCC, 0x15938AEB,
+   0x626C8F40, 0x6D91A5FB, 0x966A4500, 0x8EB067CF,
+   0xD9BFC925, 0xE9D5DF41, 0x9DDDD487, 0xC89CA60C,
+   0x556A23F7, 0x506529D5, 0xC9907CAB, 0x98BDE7E5,
+   0x9332DE10, 0x0C67D562, 0xEABBDD2A, 0x22E4DC4C,
+   0x59B00C98, 0xCEDBD9EC, 0x1C77BF24, 0x26AA86ED,
+   0x70696F8B, 0x6EB0D917, 0x98AB6B97, 0xE09E59CE,
+   0x5CC8CF01, 0x769B3921, 0x8DF925A5, 0x9F7BD6E1,
+   0x87888706, 0x0453D81E, 0xD9EE11E2, 0xC7AC1D50,
+   0x810B1DBE, 0x8BD33DF7, 0x860025EA, 0xE8B8FA6A,
+   0x241C6172, 0xEEB75282, 0x9BF9F6BC, 0x04F214A7,
+   0xD098E756, 0x572A4BE8, 0xB2A16DCF, 0xC7C78139,
+   0xA228F2A5, 0x42A1034A, 0x1C996089, 0x4EF64FCF,
+   0xEB0005A7, 0x9A0D8620, 0x2379B1F3, 0x07EBF173,
+   0xC1F11842, 0x37D64BC7, 0x1EF0D5AE, 0x866927A6,
+   0x754BFE5A, 0x3F9BF3A0, 0x042E5A52, 0xD97759FF,
+   0xD8937FD2, 0xAF6CC166, 0xFD74725F, 0xF33BEB91,
+   0x64128DDC, 0x7D5577CB, 0xB65A408A, 0x4812D0AA,
+   0x5CF4730B, 0xD8AEA60E, 0x64C676F9, 0x2EB0D1E6,
+   0x2A6C7650, 0x9087490C, 0x4B724DA5, 0x6C876D5D,
+   0xFF99FDD7, 0x941F5E81, 0xB2F4D7F5, 0xE9E8BBF7,
+   0x02559B2D, 0x57F044CB, 0xB4364741, 0x1EEFDD96,
+   //Window 26
+   0xDE151060, 0x22FED8DD, 0x0ADD81D5, 0xB68661B3,
+   0xA86CA648, 0xC867147E, 0x6D9FA8D0, 0x8EA6E63C,
+   0x71FDB423, 0x3CAEC845, 0x2971B4D6, 0x1B860787,
+   0xDE1AA18F, 0x2C6E8711, 0x5B5D3E24, 0x630C727A,
+   0xA4E95E69, 0x1DBEF0A1, 0x38B8D116, 0x3750825E,
+   0x3F6059B7, 0xCBEFA593, 0x0F597307, 0xBD60A040,
+   0x5A707ED3, 0x7E58ACA6, 0x9FFA3112, 0x2C713F85,
+   0x1D4CCDCF, 0x58181DA5, 0x64A48CC8, 0x18E56481,
+   0x8282827F, 0x0993566F, 0x6CE0285B, 0xD8716619,
+   0xE133A514, 0xB6BD917E, 0x2FEA31D0, 0x8274ED16,
+   0xF1774F88, 0x4E6B1228, 0x8DD68477, 0xA6CF8589,
+   0xA9323059, 0x837A4E97, 0x9E2F2A6C, 0xB2B275C2,
+   0xEF63A330, 0xD18DD98F, 0xFA8FF5C7, 0xD1340388,
+   0x744C4072, 0xCB7F4CF5, 0x8A99FFBB, 0x457AE25D,
+   0x02772377, 0x5D641659, 0x4EA9CF4B, 0x3F151E1D,
+   0xFD9C9118, 0x94FA275B, 0x8A3EE729, 0x6FC6086E,
+   0xF45B677A, 0x2CB4CC08, 0xC62C7C24, 0x8DD15F30,
+   0x9A992B24, 0x701E2497, 0xD60F957E, 0x929219B5,
+   0x502AB6AE, 0x6DD0EB38, 0x32F80DED, 0xB78B18DF,
+   0x6DCF7D35, 0xAB1D608E, 0xF145CC46, 0xBBE7AF1C,
+   0xDD4B3241, 0xF08AC328, 0x3BAB2242, 0x9B4E2A0D,
+   0xB9BB540E, 0xCF2B5BB7, 0xE98DF817, 0x102D32E0,
+   0xDE88A9AA, 0xA1024046, 0x032B062A, 0x44946D5B,
+   0x844AF27A, 0x27738A87, 0x775E45B7, 0x32A2106F,
+   0x48F5C1D6, 0x92E17F3A, 0x6A0BC38C, 0xAD2B1469,
+   0xF3791CAC, 0x5253AD3A, 0xE27380ED, 0xC98087D7,
+   0xC298FBAB, 0xE36E3D66, 0xB3EC5CAA, 0xEAC810FE,
+   0xA5494720, 0xCB69C432, 0xAA935AB3, 0x6C91839E,
+   0x5B13893F, 0x3D83B073, 0xDB33583B, 0xB7D5D24C,
+   0x587D32E3, 0xA0982425, 0x62CABD83, 0x70068D0A,
+   0x1429F90C, 0x719581B4, 0x9F08C390, 0x5A3764C6,
+   0x64C24FFD, 0x71E806F5, 0xF6CE9629, 0x40E29190,
+   0x3653AAC2, 0x43AF1B08, 0xF45057DD, 0xE9A59B03,
+   0x53380550, 0x371F49C6, 0x0C444C04, 0xB9AC2F23,
+   0x91150BCF, 0x6614FE05, 0x423A225B, 0xE9A1AB64,
+   0x3AD5C0DD, 0x71EA68A4, 0x5242789A, 0x33F4649B,
+   0x5EDB4E60, 0xE001AB13, 0x3C5E3556, 0xFFCCF4D2,
+   0xDEFD1956, 0xD90FAEA8, 0x0654A86C, 0x2105B8F4,
+   0x0D3B00F2, 0xD98C06C7, 0x9FC6E1C8, 0xE8AF8B60,
+   0x45149267, 0x62CB0504, 0x8AF10C8B, 0xE9E169CD,
+   0x7ECA4957, 0x79A1E695, 0x93E17C9F, 0xC233D288,
+   0xBB69BAC0, 0x45D3DB48, 0x923DF0B6, 0x9F64492C,
+   0x585B2626, 0x7BCF3A55, 0x9A5721E0, 0x87598F38,
+   0x69854BC7, 0xF4635CAC, 0x67FE5675, 0xA1307E6E,
+   0xE886C019, 0x844AAA78, 0x8A9B26E9, 0x670477F0,
+   0x4787C6A2, 0x3F858EBE, 0x8725F98E, 0x571BA942,
+   0x9CBA6DDA, 0x78038CD8, 0xBB320443, 0x85D62B6A,
+   0x126C93DC, 0xA2901D6C, 0xC87BDABD, 0x954CAB7A,
+   //Window 27
+   0xF5324C87, 0xC9B75BFD, 0x3EEED861, 0x0A3E3A18,
+   0x43B8DEF6, 0x9C12AFD2, 0x05243E7E, 0xC4450F94,
+   0x59F0736D, 0x74C69688, 0x4EC7704A, 0x2E4E9ADE,
+   0xC4A0143D, 0xC29F735C, 0x4D7CCD32, 0x4ECC34D2,
+   0x9C623B32, 0x03073083, 0x3F872163, 0x47D08954,
+   0xD82DCD7D, 0xECA60F71, 0xBBC36994, 0xEC1EF93E,
+   0x55784829, 0xA9CCA5B0, 0x8249BB0B, 0x6E339460,
+   0x7F6A7FE9, 0x48EECE42, 0x7DCA9980, 0xF3AF0AC9,
+   0x522159F7, 0xECA728EB, 0x68475E3C, 0xAC9528A9,
+   0xAE1FACB3, 0x501FC3ED, 0xE24CABEE, 0x83A516E9,
+   0x14B813C6, 0xBB70B2B1, 0xD17ADE30, 0xD3329541,
+   0xDC7B7F16, 0x9DEB19EC, 0x2883518D, 0x64C12BF4,
+   0x6DEA8225, 0x8AF4FB6C, 0x53B061B4, 0x5E895551,
+   0x084288D5, 0x09153D28, 0xBC1221CE, 0x4301E1D1,
+   0x3C662A1A, 0x59E6DBE1, 0xBDA4B5A1, 0x5C0261C9,
+   0xAC43ABEF, 0xD089CBDA, 0x8A2CDC56, 0xD3E90282,
+   0x77BE6DE6, 0x2D4FD184, 0x4C876C23, 0xA48B28D9,
+   0xD5ED6C00, 0x5654B702, 0x12AFB54B, 0xB4CA8992,
+   0x391ECA7D, 0x627D1AD7, 0xA5601E80, 0x363E1A5E,
+   0x9EB83CDD, 0x5D2CA455, 0x687A35F6, 0xC1E3BB4C,
+   0x30300449, 0xFEFBD004, 0x09228DF0, 0x0177B083,
+   0x31B33807, 0x9571FF75, 0x150AC958, 0x084BD412,
+   0xC6187F5C, 0x989C17B9, 0x34F376E3, 0xA0725856,
+   0x32F4E99C, 0xF68E5711, 0x9D905FBD, 0xAE981BC2,
+   0xC12F2478, 0x0E335339, 0xC40B58AB, 0x05C124E5,
+   0x675F5B58, 0xC9DD9BE2, 0x65898406, 0xEDCF271F,
+   0x9E0705B9, 0x10A0EE1F, 0xE078F3B4, 0x9AEE33B4,
+   0xB5E7CD86, 0x1F20E001, 0x24733BFF, 0x44FD9BEA,
+   0xA94887B4, 0xAC9BF371, 0xA54D9B36, 0x79F0D1ED,
+   0x2046E9F5, 0x298BA93D, 0xD831F28E, 0xA80A2B94,
+   0x1E35D736, 0x3760CC5B, 0xA8230C3B, 0xAFE59F1C,
+   0xD88B85F8, 0x9C44A33C, 0xADE0140E, 0xB9F5FDD8,
+   0xA0854440, 0xAA32C79C, 0x20156A1B, 0x2DC3271D,
+   0x3F0F0BA1, 0x7BCCD3D8, 0x1FF55905, 0x307FFBFC,
+   0xD2ED9F4E, 0x29548EB2, 0xE0482B11, 0x3FC623BB,
+   0xE7EB39B8, 0xB817D836, 0x707DBA9E, 0x37F71A86,
+   0x7DB40537, 0x9AA27E1C, 0x46BDA830, 0x1DC339DF,
+   0x12A74EE1, 0x0B5F003E, 0x3E688DD2, 0x8FF94418,
+   0x3D07FC7D, 0xDF0AFD93, 0xB2E39559, 0xC9ED4C89,
+   0x74F49C1A, 0xCD3AFEA2, 0xDC86EC66, 0x66AF6B9A,
+   0x8E61AA2F, 0xDF4E7C9D, 0x2DC1347F, 0xB782C699,
+   0xADABD89F, 0x6D76899C, 0x6A109253, 0xCEAD7C41,
+   0xD639ADDA, 0xE2CC5C35, 0x9D3A8619, 0x34B3BCB1,
+   0x8F306605, 0xDE020D4F, 0x8C45B3C3, 0x7B0BD0E5,
+   0xC464ED32, 0x5236335A, 0x59C03C04, 0x071B733C,
+   0xB31D7D8D, 0x70943ADC, 0x5F10F7FA, 0xE5EBC142,
+   0xB11E160D, 0x34765015, 0xE906E911, 0x83767CE7,
+   0xD9507BCE, 0x1AF3BAAF, 0x7FEBEF1F, 0x66147466,
+   //Window 28
+   0x268106AB, 0xE54C3C1C, 0x5251D5E5, 0xD0557C60,
+   0xE9236F3F, 0x17FF8F7C, 0xA07BED43, 0x6A163ADF,
+   0xA3EA9008, 0x3BDFAA52, 0x72BFF246, 0xA7FC27F2,
+   0x39DF6DB2, 0x997C6627, 0x7C8791A2, 0x35B365A4,
+   0xE8E859DA, 0x5C5A7FD8, 0xA9A55DEF, 0x939226DD,
+   0x81B96729, 0x167C9ADF, 0x1C82F217, 0x344AD7D9,
+   0xCA810D3B, 0x3CDB6605, 0xBAC7B154, 0x276C6932,
+   0xBCB50DA1, 0x58C992ED, 0x52D2A745, 0x6B622E5D,
+   0x84E7F1FE, 0x7D66D0D0, 0x770981F9, 0x161EB511,
+   0x2416A5C8, 0x2E962954, 0x9D590722, 0xD1C8C588,
+   0x92C490B9, 0xF6752AF7, 0x2C092884, 0xE38E4EAF,
+   0x05EB60AF, 0x20010D41, 0x9F688703, 0xD76509BE,
+   0x59C6017B, 0x92A4A103, 0x14B4897D, 0x17E75B31,
+   0x5995E0D9, 0xBABFC2F8, 0x3FE5EB05, 0x7369ACBE,
+   0xAEEE476A, 0x8112B5DD, 0x9DBAA6FF, 0xB77F6DD0,
+   0xB7D7053A, 0x7D9C9E43, 0xBB21AC47, 0x3A5917FE,
+   0xCA6BA6D8, 0xE8000F90, 0x12EFD97E, 0xC7C24886,
+   0x74EE0CA7, 0xDFB81105, 0x10A8D6C4, 0xB6201E83,
+   0xBB794E95, 0xDA334C49, 0x6EDB336A, 0x519F790D,
+   0x7010F0EE, 0xCCDA662B, 0x4A987776, 0xB9B6889E,
+   0x7D19F180, 0x59D2AEB9, 0x9D1A2789, 0xAABB66ED,
+   0xEB99C203, 0x32133909, 0xD8DD6CA3, 0xB6316FE3,
+   0x7A488DDA, 0x2E0C3A3B, 0x2666CA9A, 0xA5AC256F,
+   0xA6388415, 0x2DACE517, 0x458EDB1A, 0x280E8D03,
+   0x5441ECF8, 0xD5544538, 0xDC6A7633, 0x487B9F86,
+   0xFCBD69B7, 0xDDD3B371, 0xB91871B1, 0x06038C83,
+   0xF2BA936E, 0x18BCBD58, 0xC64693C1, 0x799E2985,
+   0x8E825EEA, 0xA667EA54, 0x1A37BC27, 0xC748AAD0,
+   0x63D62CBB, 0x7A4056C9, 0xD5C65B13, 0x99A18D4B,
+   0x98CE9A1D, 0xB011A6EF, 0x1560B2A6, 0xE55305A8,
+   0xC9083F17, 0x2411989B, 0xA9573ADB, 0x6FF6395C,
+   0x26D3F34D, 0x9F5223FE, 0x9D180CE2, 0x8DA2ACDA,
+   0x8D3CAD16, 0xFE17156E, 0xFB307988, 0x3DF0186C,
+   0x4EC36DE7, 0x3B9EA8B0, 0xEF4453DB, 0x0BBA895C,
+   0x93ED7F84, 0x072D33C4, 0xA4869CB3, 0xCE9AAAF5,
+   0xFCC884A3, 0x5E08F4DC, 0x7EC6ED6E, 0xC8379CD2,
+   0x72F0A33C, 0xF1AAA96D, 0x0A6002D7, 0x87C263E8,
+   0xD0300105, 0xB38A70B3, 0xEA888242, 0xF0F310C1,
+   0x2E231832, 0x76549794, 0xC8EA5B83, 0x020E1554,
+   0x3FF511B2, 0x39EEB9D6, 0x0EB25F79, 0x15092385,
+   0xCF504DE9, 0x61145A85, 0x0B4D7721, 0x6326FA03,
+   0xD8E8EB70, 0x96FAE643, 0x44F30304, 0x512D7625,
+   0xF5FFE6C4, 0xCC4445EF, 0xA33BE08D, 0x0EF6DB00,
+   0xCA00CDAD, 0xC41DB569, 0x014E8778, 0x302C9D11,
+   0xCF5C3C18, 0xFA903E91, 0x8F5B3BAA, 0x5AD048FE,
+   0x262A5E4E, 0x44D0D596, 0x5ED27C7A, 0xEA2FA4F0,
+   0x7CA408F3, 0xA1960A64, 0x284AA31D, 0xEECE1256,
+   0x34483F51, 0x99414AC7, 0x99E99522, 0x3777E1A3,
+   //Window 29
+   0x5CA8FAD8, 0x8D12FE42, 0xD10970F6, 0x0FBDF6B9,
+   0xC7D54F8E, 0x3EFAC0DA, 0x081D4201, 0x78D97625,
+   0xD3724AC0, 0xADBE354F, 0xA1C855E6, 0xC7706509,
+   0xDDEE3FA8, 0x3E610D70, 0x828A967F, 0xBF575954,
+   0xB53A955E, 0x2AE095F6, 0x7B90D88C, 0x56033472,
+   0x8DC0A40A, 0x3C112381, 0xD5C067D3, 0x4CFEC7CE,
+   0x9D7F512D, 0x7F4109BE, 0xD1B173E7, 0xFCA562C3,
+   0x214BC4ED, 0xC067B61E, 0xF4E86CEE, 0x9DB493C9,
+   0xF575B7B3, 0xE191F3BF, 0xD45E0FF9, 0xB7509B4B,
+   0x497F2236, 0x289EC8A1, 0xDA22C3E7, 0x596F91F4,
+   0xAEFAA657, 0x78123688, 0x3AC76C0C, 0xCE9474DE,
+   0xDA1B4BA3, 0x5C127C3F, 0xDE0DA9CE, 0x32533216,
+   0x2DA214EA, 0x67D472B9, 0xC8310C24, 0x906BEBC5,
+   0xE0E9BFF1, 0x8DE497FA, 0xB010519E, 0xC055108D,
+   0x314B4309, 0x6C0A6A75, 0x7427879D, 0xC72F4849,
+   0xA9D7130F, 0xD2A16112, 0xA84DA301, 0x244193F6,
+   0x368CFE37, 0xA4C13330, 0x24CE656D, 0x5496C5E4,
+   0x81B1A37C, 0x91F6B86A, 0x26F78461, 0xA6DD4A61,
+   0x7F764113, 0x7D909CBA, 0xD1C3F247, 0x5E8A847F,
+   0xBF744AF4, 0xFC720E23, 0xF6F96F76, 0xDD556617,
+   0x47E5D97C, 0x0ABD37F8, 0xCE52860A, 0x362C722E,
+   0xE1885C2B, 0x47D63C0F, 0xD63E7AD1, 0x33F668E8,
+   0xEC148EEF, 0x8B8CFAAC, 0xF8B8DC78, 0x8079E2D3,
+   0x9C76AD98, 0x352EAB77, 0xFFB727BB, 0x9D1DC12F,
+   0x572FB7B1, 0x1350C625, 0x98376B3A, 0x44CBC63A,
+   0x35F4F0B5, 0x4B80B0DE, 0x153B8AEB, 0x7AFE1331,
+   0x16DDA7BC, 0x0BC82E53, 0x67C2B54E, 0x87A149B8,
+   0x1CA6438F, 0x896B129F, 0xC42427FD, 0xFC70E648,
+   0x8DD0AB81, 0xC261B06C, 0xA60EAA89, 0xE6AC435A,
+   0x47A27FDC, 0x37ECD487, 0xFB09ED4B, 0x3673F462,
+   0x21B6FAA8, 0x05D2ECA8, 0x938C1A51, 0x0B2CFF22,
+   0xD5EB89D8, 0xB093A83D, 0x08EDD0AD, 0x1B53A699,
+   0x9BA824BC, 0xEDC49603, 0x455CF98A, 0x643D92F5,
+   0xF4DD9C20, 0x83C4D9A7, 0x399B1218, 0x307D42C0,
+   0x81B57F18, 0x2005B218, 0xF3415462, 0x10705416,
+   0xE7C0CA14, 0xEAFA2E22, 0x3D144F4B, 0x05A48AF1,
+   0x921B22D0, 0xDE1DF058, 0x68B53211, 0x39123E85,
+   0x1D556893, 0x16EBB39C, 0xAA3DAC57, 0x4FE13E87,
+   0x3097165B, 0xF983E8CE, 0xD7375555, 0x85B8738F,
+   0x789FD5AB, 0x062722F1, 0x8700C5CE, 0x4DC10654,
+   0x28E74765, 0x2458EC12, 0xEEC61A0F, 0x8093947F,
+   0x3769A15D, 0x25A5B888, 0xB692706A, 0x8FB63CC3,
+   0x913B6411, 0x2BC1AFDC, 0x8EEDEE77, 0x066D9601,
+   0x24E52F40, 0xFF6DC2CC, 0x85CDB078, 0x7F6EA68C,
+   0xB05070D4, 0xE28D3F13, 0x32F6546E, 0x2F677A65,
+   0x21FC31ED, 0x874D5935, 0xB7768BA1, 0x1437AD10,
+   0x4D0B0162, 0x3A1D9D4E, 0x040B189D, 0xF1715D3E,
+   0x9819C8FB, 0xF3E47666, 0x065E2488, 0xD8644386,
+   //Window 30
+   0xEB02D061, 0xA4F057AE, 0x2F3BC02E, 0x05B67F0B,
+   0xF86E089A, 0x56AEAD32, 0x3031E720, 0x36EE2EEA,
+   0xB1B8E237, 0x5B51B855, 0x9B8BB539, 0x87389331,
+   0x205E62E9, 0x5841EE49, 0xC40EA262, 0x96ED905A,
+   0x506A5C36, 0x2C97DAB6, 0xA4AEF7D8, 0x0F317F1B,
+   0x952C8ACC, 0xAEC182BC, 0x600A1B20, 0x509E270D,
+   0x235C5081, 0x99827AC2, 0x75308EB9, 0x7FB253D3,
+   0x154E075F, 0x342EE505, 0x9CBED9BD, 0xD038F55B,
+   0x05A099F6, 0x140232FD, 0xA763F7D2, 0x2003A3C8,
+   0x5C50AE9B, 0xCDD8653C, 0x1B6F0972, 0x8E815559,
+   0x6872ACA5, 0xF0BFB869, 0x00C7BD3A, 0xD7351F08,
+   0xA8C4A1EC, 0x918D4676, 0x3E691114, 0xD9D73DC0,
+   0xE2B7D161, 0xEED08A60, 0x7E8BA1EE, 0x70A4F13D,
+   0x8BF20B0E, 0x8A74371A, 0xD5AD8C5F, 0x1CC082A9,
+   0xDDDE1DE1, 0xDEBF6864, 0x6018E613, 0x8ED46E9C,
+   0x7DAF30FF, 0x67E6ACF4, 0x24F7F26B, 0xE5040BE6,
+   0x89AAE477, 0x37AB567D, 0xE0D43D20, 0xED60A124,
+   0x1CB13B65, 0x28D7D7F9, 0x5F078874, 0x5A79D9CC,
+   0x16B2A15F, 0x14109200, 0xD3FC5789, 0x14E60BA5,
+   0xA6FD20F1, 0x856CFFB8, 0xC2762A8E, 0xEADDBE77,
+   0x7E08A687, 0x642ACE34, 0x1F639771, 0xC88E9B53,
+   0xC816D1B9, 0xE31DCEB0, 0x3E23B8DD, 0x8B5C7946,
+   0x7FE5C93E, 0xF5D64E46, 0x9703A586, 0x0476E6C3,
+   0x22C2E442, 0x209A451D, 0xCD8C55A3, 0xC63328E8,
+   0x33FA6A23, 0x15456385, 0xD9BFC836, 0xAF5FBF20,
+   0xC54E05DD, 0x2E932568, 0x9A8A7899, 0x07E1DFC4,
+   0x065B07CF, 0xBEC2F18B, 0x4E3A72F4, 0x28051E71,
+   0x709B3DA6, 0x01544673, 0x2425241B, 0x6AC06E67,
+   0x55963726, 0x7A13EECE, 0x6068FEA4, 0x29A38B17,
+   0x4057CA55, 0x949FE260, 0x5644E0A5, 0xE47728AA,
+   0xD6C94A24, 0x36F56737, 0x7E0DC76A, 0x318AFD09,
+   0xD9A3478D, 0xE381198A, 0xD990C549, 0xD456B8C0,
+   0xFD3EA6D5, 0x354DC04A, 0xCCE47D9F, 0x7DB006B6,
+   0xEF47C2CA, 0xA1E7ECCA, 0xEEB15264, 0xC1339D41,
+   0x6CD379C6, 0xD010754D, 0x93E780FD, 0xDB035818,
+   0x0226CAD8, 0x685C729C, 0x31C1B461, 0x9AAD6168,
+   0x2C343ACF, 0xBA7A4D03, 0xC2EB6096, 0xFA05E005,
+   0x970C8E2A, 0x2AEA2332, 0x10930C95, 0x13E84B7B,
+   0x4D138884, 0xFEB423C8, 0xEBFF51F4, 0x66F09CF5,
+   0xCA7A06DB, 0xABDBC0A5, 0x026FD619, 0xFB477F31,
+   0x57120C29, 0x7EF6C8A1, 0xBDED5615, 0x07860A96,
+   0x408D1A1E, 0x25B3EC9F, 0xB2B8B6AC, 0x7F093C11,
+   0xF1A956BC, 0x4346514A, 0x1851EC8D, 0xE20B78E3,
+   0xE7FAC8B6, 0x2F0A95BE, 0xCFF5B428, 0x28BF4539,
+   0x1CAA5C55, 0x6B2AA5C7, 0xA57E8C3E, 0xA1A272DF,
+   0xCB7A7F7E, 0xB6343722, 0x31BF33BF, 0xD2127B9F,
+   0xF4310192, 0xF274740C, 0xD66CE2DB, 0xC0C6F74D,
+   0xBD49EE97, 0x7C315E35, 0x7508E38F, 0xF8BF7169,
+   //Window 31
+   0x0D71D442, 0x2505F322, 0x71076F00, 0x7164FD9B,
+   0x553E946B, 0xC057820F, 0x60518230, 0xF2ECC083,
+   0xBF4EA967, 0xD0BDCCA9, 0x608DB07D, 0xD4E59198,
+   0xF5B834CF, 0xE4B80367, 0xFCD18CE5, 0x618379A5,
+   0x214592A9, 0xBD10607B, 0xEDE301EF, 0xC1E82061,
+   0x048E4B41, 0x98C302A2, 0x147750F1, 0x96C4EDBD,
+   0x968A77AC, 0x8C713A3E, 0xBC18B389, 0x9A3D4EDC,
+   0x2FF3598B, 0x0EE14DC2, 0xB21235A9, 0x88ED2EAC,
+   0x97F42A48, 0xEB751BB9, 0x9B18801F, 0x62B47394,
+   0x1CE52C2B, 0x9B87609C, 0x58090706, 0xD2973090,
+   0x09400A7B, 0xD3E4CEBA, 0xFA8540D8, 0x5AD258C4,
+   0x20D26B3A, 0xDEB3DAD4, 0x071FE641, 0x574E164B,
+   0xB3DBE669, 0x1AAAB59B, 0x8B4C5C2A, 0x6290BBA9,
+   0x9E61C9AD, 0x267680E6, 0x5F792890, 0x5A6D4348,
+   0xE3C0F7A1, 0xA23115FD, 0x68E66D7C, 0x207089B8,
+   0x55B1EC56, 0x1ECFC077, 0x9AEEAD67, 0x35968B2F,
+   0x92E16457, 0x6EE0ECA7, 0x5200CDCA, 0x4B6C84AA,
+   0xA6558D1F, 0x6A37F56F, 0x3E8B9429, 0xA4448741,
+   0xE605C136, 0xA7B2B30E, 0xAEF01846, 0x2A16B436,
+   0x6F731F6A, 0x0D443A47, 0xD2406363, 0xA1DC563B,
+   0xA57DA3F1, 0x725A5DC5, 0x871E7629, 0xF2FB980F,
+   0xCDA9C8B8, 0x9A0960BD, 0x36543A50, 0x8F815379,
+   0xF7F9DC1E, 0xA7ABF827, 0xE3566EE5, 0x8ACE4597,
+   0xA71F4D3C, 0xCC1BABD8, 0xF145D8C3, 0x59AC0A89,
+   0xC2012E7D, 0xF9378555, 0x2ACF0CEE, 0xD942AEDA,
+   0x744E7ACB, 0xD21A63AD, 0xDA16861C, 0xDC1058AC,
+   0xF0AB41B8, 0x413CD58F, 0x61EF4ADC, 0x7B96D3EC,
+   0x17B9AAB4, 0xA3E86303, 0x7859E61C, 0x165ACC4D,
+   0x57756558, 0x45536539, 0xAC9C9475, 0xD0D8B18D,
+   0x63137F2B, 0x237A6219, 0x41A42D06, 0x372B9666,
+   0xD9254AD5, 0x3D93AA06, 0x7891B68A, 0x5AB89CCB,
+   0xB55B95BA, 0x911491D9, 0x3E531118, 0x242F8E90,
+   0x90826D23, 0xB056302D, 0xBE946A44, 0x654181C8,
+   0x7DB8C2F5, 0xCA33BA43, 0x57778F2A, 0xB43F6682,
+   0x321721EB, 0xBB11AA20, 0xAED01CB3, 0x6A98C634,
+   0xDC207A88, 0x9728B8FD, 0x2A117BC4, 0x6A302820,
+   0x85C3BB11, 0x6657012C, 0x48EC8509, 0x868EE73E,
+   0x90C2AAE7, 0xD24718BF, 0x015D5B0C, 0x66CF8ECA,
+   0xCEAC7AB1, 0x4794A19D, 0x638A81F6, 0x679AA55B,
+   0xF2D64867, 0x0E42A93E, 0x2D15D44F, 0xE84FA0F4,
+   0x082FAE3F, 0x8B2195FE, 0x886D8E52, 0x4A0E1051,
+   0xD203C984, 0x56D64835, 0x5D8BA01C, 0xA031452B,
+   0xDFC9BBC9, 0x37C9567A, 0xF7839E1D, 0x93341DA7,
+   0x2AF399F7, 0xE2BE73D7, 0x94144689, 0x16BBEBE9,
+   0x32BBDE36, 0x353D71F6, 0x3F559A4F, 0x284CE9DD,
+   0x370F7F1E, 0xC4A79AF4, 0x43D3F4EC, 0x2D24CCA6,
+   0x22FEFB20, 0x568091F8, 0x072DEF89, 0xB640F54B,
+   0xA37E1BB6, 0x8AADB93F, 0x17C1943A, 0xDF2D7CE7,
+   //Window 32
+   0x0020362E, 0x84A2AE35, 0x19BF5F49, 0xEA2B1DF4,
+   0x287C9B53, 0x2BB64E18, 0x2B7B03E9, 0x11C2DF65,
+   0x85D5A524, 0x23A42EA4, 0x11CD506E, 0xE10CB36D,
+   0x2ADAEFC2, 0xE5F50BFE, 0x36ADB53E, 0x64666B55,
+   0xE90ED2A4, 0x7768FB7F, 0x06CC84C0, 0x425D7817,
+   0x31D6AB0B, 0x52EC806A, 0x4697D363, 0xD7E67972,
+   0xD49176D9, 0x44461E29, 0x654DF125, 0xF11BDD66,
+   0x301B669C, 0x33A8C003, 0x5CB914AF, 0x993FDFED,
+   0x2724DFC0, 0x05153609, 0x032FA744, 0xEA9ADB70,
+   0xD90E8F39, 0x3C262539, 0x4A268523, 0x08C546C0,
+   0xB77B6648, 0xACD1B0E5, 0x83888D47, 0xF042C491,
+   0xBBF92795, 0xACAE4C89, 0x721708C4, 0xE7A7BD33,
+   0x0B2377AD, 0xBE9F8263, 0x1AC10C82, 0x472271D7,
+   0x6456C33C, 0x607BF4D5, 0xB349FCA2, 0x39D1DDF2,
+   0x6DEE1FF6, 0x38271DC8, 0x25FB3A4D, 0xEDBDE93E,
+   0x87A4EE6A, 0xD3DEE04F, 0x2FFBA9F5, 0x9A8D2CD9,
+   0xA701A355, 0x1F388B77, 0x8828D315, 0xF90E2EBD,
+   0x4BC8A462, 0xC7A66507, 0x10473D7E, 0xEE5FE7CE,
+   0x94AFD765, 0xBDEA727C, 0xD783B375, 0xC381731B,
+   0x8279E64D, 0x7FBD82AD, 0x3C50571D, 0xD7D9EF0C,
+   0x7F51D2F0, 0x232D6FB4, 0xFA71E7B9, 0x8A7FFACA,
+   0x9166E3E8, 0xF946AFC1, 0xB3026DC8, 0x770AEE82,
+   0x0407C734, 0x18B49317, 0x46A8A6F5, 0x9C3FB009,
+   0xA138DE47, 0x6EB5134E, 0x9AE7687C, 0x19EF4E9D,
+   0x1F546966, 0xB645ED4C, 0xD872A1DA, 0xA0CB6B78,
+   0xCD251D18, 0x01EC1C68, 0x23EB565F, 0x30C3C859,
+   0x9F18F162, 0xEFBD8D6C, 0x4CB4EF4E, 0x8944091C,
+   0x8B8BBF50, 0x548A5609, 0x0A1B80A2, 0xD9602C95,
+   0xE89E5B90, 0x9F324965, 0x22EDCE1C, 0x666C0C34,
+   0x7E299A4F, 0xC31F2A56, 0x64306A70, 0xCA359865,
+   0xB912851E, 0xC4BDB226, 0x960A6F11, 0xE8020D4F,
+   0xA260BDD0, 0x2766EF72, 0xA9A13690, 0xD0BC5768,
+   0xE32DA327, 0x7CE36226, 0x6A50F58F, 0x68653A17,
+   0xA0450817, 0xFAB0D9F3, 0xE467110F, 0xA0C2E8EF,
+   0x737F1213, 0xC63B63AF, 0x462595DF, 0x9C162213,
+   0xC6A66176, 0xB3977605, 0x20146A06, 0xFC7A1218,
+   0x5811E395, 0x345876CF, 0xBE9FF3FE, 0x916B8F3B,
+   0x3260EDD9, 0x133BD63F, 0x4F29C1F9, 0x3225D14E,
+   0x8012430D, 0x93E7B76A, 0x4603AB58, 0x10C7F87D,
+   0xC0F7234B, 0x70361939, 0x401E88CE, 0xBC374780,
+   0xD953AF0C, 0xC7575B34, 0x19BD858C, 0x8958C1B0,
+   0x5BED03AC, 0xA395DBFB, 0x905C373A, 0x2DDF00F2,
+   0x8911778C, 0xC74A3079, 0x9D1A5F28, 0x78BDDA48,
+   0x0181A021, 0x8C2B0AD0, 0xB37E5B91, 0xC84F622E,
+   0xB2B5A18D, 0x7393788B, 0x5F4A6587, 0x575D5BA7,
+   0x3DF4E660, 0xE5DC1C26, 0x83614EDC, 0x65119C37,
+   0x92A47B68, 0xF9EB2018, 0x09184FEA, 0x0886B307,
+   0x8D7D49D4, 0x31B725BC, 0xC218459D, 0x1CC8CA4B,
+   //Window 33
+   0x37C3CCAA, 0x6A0642F8, 0x7BC1A00D, 0x8F8D46CD,
+   0xEFC36D76, 0x5F3AF201, 0x5677CFE5, 0xCE059F5B,
+   0x95D268AA, 0xD71ED2A6, 0xEEB92E0C, 0x1A60EC14,
+   0x40111ED6, 0x9097F043, 0x962A83FB, 0xBA955625,
+   0x130860DA, 0x56181333, 0x752A51F0, 0x9614A3EC,
+   0x27F4B8E0, 0x9D89FA34, 0xDDB96FD5, 0x8859EF7E,
+   0x625CAF5C, 0x7752E818, 0x3C04AD55, 0xCC8C27F7,
+   0x199E3B6A, 0xD774E597, 0x811313AA, 0x493EBAB6,
+   0x99787B60, 0x338B575E, 0xA821B375, 0x35FF5DC5,
+   0x95EC4B5D, 0xF9D101AC, 0xC1560215, 0x86F72364,
+   0x65E74237, 0xB0F0B637, 0x92D8959B, 0x5679FAE2,
+   0x1C1101E3, 0x6EC26C64, 0x6E2A938A, 0x4428A2AA,
+   0xB354E7A6, 0x3ABB4762, 0x52460724, 0x9EB8AE04,
+   0xBC447960, 0xACCD3ECA, 0x40F193EC, 0xCEE9846B,
+   0xD092B885, 0x22193624, 0x0B737F7A, 0xD7E69CC7,
+   0x920448A1, 0x24D350D9, 0xCE4B055C, 0x69D69C0F,
+   0x681A07E8, 0x2CE7E1B1, 0xF7263DA5, 0xBA79441B,
+   0x963738D9, 0xDB4B70D2, 0xFB4AF43D, 0xD8D9A9F6,
+   0x5F323FB1, 0x4284C178, 0x7782D852, 0xC061FB3F,
+   0x80EC38E6, 0x910082BC, 0x1453FD5F, 0xF360F335,
+   0xDE1AA3A3, 0x27314A65, 0x0FCBCAC8, 0x8CCE0006,
+   0xDBFBBBE2, 0xDFC94A51, 0x88A33F06, 0x1CD984C2,
+   0x89E194CB, 0xFCBCB202, 0x48745DE4, 0x8E6CE167,
+   0xE1BB13CB, 0xAF6E6D36, 0xD3F2E3A8, 0x0BE1093B,
+   0xC984CD5D, 0x6D2A0DEF, 0x06DED507, 0xD5ED5CC0,
+   0x036E0E21, 0x8B4044FE, 0xF338BD8F, 0xBE4CD58F,
+   0xEE7A1116, 0xEA50010E, 0x56AF2A05, 0x3FBDA36F,
+   0x81D965F1, 0x0402B406, 0x227110F4, 0x1A0DF552,
+   0x21B4C2E8, 0x02CAB16B, 0xB0D045CF, 0xF0740064,
+   0x9216EBFB, 0x35DA4155, 0xDAE31713, 0x0A2FB0F2,
+   0xBDD8DAB6, 0xC43F31C5, 0x91927115, 0x3F59A4B8,
+   0xB2761A5C, 0x709ECA69, 0xF4BF411A, 0xDD71CCC5,
+   0xCECA3E68, 0xBFC5E281, 0xFA34812D, 0x9192A086,
+   0xE79CC9D5, 0xCDF5C429, 0x411D1212, 0x87094A55,
+   0x38B01580, 0x544F68B7, 0x2F85544A, 0xA7FA4DF0,
+   0x67869AA4, 0x8F77C557, 0x43A8F101, 0x24E8685D,
+   0xB75A0CE6, 0xE3CEF00B, 0x7C037995, 0xFD8E6B48,
+   0x4F6EC425, 0x087ACA58, 0x23C29BF4, 0xA0FEE3F5,
+   0x3853635C, 0xFEDDECB1, 0xECB08ABE, 0x2D540D2F,
+   0x295C84CA, 0x4128A640, 0xABB50407, 0x2F8FFF93,
+   0x95224537, 0x85BEFD17, 0x3C3440EE, 0xA260399A,
+   0xDC59D583, 0x3A266EAE, 0x04CAA21D, 0x5F2756EA,
+   0x7A079047, 0xEE299798, 0xA78809BF, 0xA3137A8E,
+   0x0DD4A112, 0xD46F5636, 0xB5D80DAA, 0x1FFAD1A6,
+   0xEF4C517F, 0xC262ECF1, 0x5BA2AB40, 0x90B58DA7,
+   0xD8330A01, 0xF2F4ADAF, 0xA6EA41EB, 0x1A9D6FA6,
+   0x0DCCCD88, 0x8CA9597C, 0xB5EBEB0A, 0xB0F9F4BF,
+   0x287F9ACC, 0xB651173C, 0x3215E579, 0x8F766281,
+   //Window 34
+   0x256EB547, 0xC066E749, 0xD20BC008, 0xCB207DD3,
+   0x91B8B552, 0x7DACD841, 0x16C50475, 0x00088CC1,
+   0x369D064B, 0x5FE835DB, 0x927B1863, 0x03650873,
+   0x6EE6C982, 0x53948B38, 0x7B9E974E, 0xA578322E,
+   0x6BB2D5D8, 0x38610155, 0x66527A63, 0x3ED290B7,
+   0x7E91A190, 0x388B7A9F, 0x226CE3B0, 0x811E25B1,
+   0x6C9E9744, 0x3AE2D1BB, 0xCED80792, 0x670E49E6,
+   0x3D67CA5F, 0x76B597A4, 0xF9AF1B84, 0x0BD0F129,
+   0x061E69B3, 0x55462938, 0x30F8A23C, 0x3ED69B43,
+   0x1E4877CB, 0x997D5786, 0xA728C69D, 0x07C49871,
+   0x88FB7EA6, 0xCABB83AB, 0xB0D5441A, 0xBF12F90F,
+   0xD5B9450D, 0xDBB1FDAD, 0x9B4F1020, 0x125CE73E,
+   0x213A6E54, 0x13179681, 0x59FA6704, 0x392A5971,
+   0x4C101F3C, 0x86D9C131, 0xC507964A, 0x6BC5F2A5,
+   0xD9782EC6, 0x55EB59F7, 0xD2C8326F, 0x6A2CB15B,
+   0x53553C1C, 0x4248DC4F, 0xA9992DA7, 0x6B644FFA,
+   0x521C51C5, 0x6A6885E1, 0xB77CC0E9, 0x0AAD44AA,
+   0x7C43053B, 0x03A66799, 0xB2BFEFAF, 0xC6B622F3,
+   0x3DF306F7, 0xCCCBBA0C, 0x120599F1, 0x40B2F691,
+   0x91515908, 0xCB0CF13B, 0x324645C0, 0xC440359D,
+   0x0D1F2542, 0xC09DFE83, 0xFABD6C75, 0x05067D67,
+   0xD5C30780, 0x84FD04DF, 0x731614B7, 0xD45B5E6C,
+   0x82C08528, 0x7E37E714, 0x75826711, 0xA3711867,
+   0xB3BF6462, 0x02131D55, 0x78D454D9, 0x3C4368AA,
+   0x090C80CB, 0x3E0F2A9F, 0xF67D6C4E, 0x19A24D6A,
+   0x1EC00533, 0xE914294F, 0x505AB509, 0x23808077,
+   0x47141BF7, 0x527325E0, 0x58E0B2AB, 0xED6401CC,
+   0x63A3D867, 0xDC122691, 0x615D3C20, 0xB147F91F,
+   0x6E029153, 0x55ABF9CA, 0x7A86BA00, 0x7732FFCA,
+   0x14AEC20B, 0xEDF0E562, 0x3FDB3D37, 0x787335EA,
+   0x49C5BA99, 0xB1EFB7D6, 0xCE8A7F14, 0x772CA736,
+   0x27DE5D9F, 0x27DDC191, 0x2B731A4A, 0x9F2ECB33,
+   0x43ED8E4C, 0x0A5DA7E7, 0x60EB6BAC, 0x6EA246CD,
+   0x6D2249A8, 0xDC0BD824, 0xE073E866, 0x13630242,
+   0xA305D225, 0xAB43EB37, 0x3983560B, 0x64533615,
+   0x12053E93, 0xEDAB257D, 0x179A088B, 0x6C7956D6,
+   0x6A74BCE9, 0xC18597EE, 0x6E23EECC, 0x06A6359B,
+   0xE558E0D6, 0xF4E73D07, 0x6F8FB2C1, 0x049C99AC,
+   0x0AE9D67C, 0x2F7BE9A7, 0xAF7FB485, 0x25605DD1,
+   0x2E92A2E7, 0xD886F578, 0x22112463, 0xF610F225,
+   0x93C148BF, 0x3250B2AC, 0x5D706145, 0x9B2680F6,
+   0x5E4F1655, 0x6E49ADED, 0x91C996FD, 0x9BADB73F,
+   0x2A7FA542, 0x1E9DA0C4, 0xC406B706, 0x312CCB1F,
+   0xAA5B9DE3, 0x15E81228, 0x277F3FF6, 0x02FD7011,
+   0x2D16E579, 0xE699D545, 0xE28E0815, 0x507D6F5A,
+   0x1FEB1D1F, 0x1F7AC29A, 0xF73FB5D6, 0x42456041,
+   0x64D47961, 0x3FCA6819, 0x0CFDD646, 0xDB7144CD,
+   0x7C012CF2, 0xFBC60609, 0x852B965A, 0xBCCFE91F,
+   //Window 35
+   0x1F336928, 0xDFB863BB, 0xDAE4EDCC, 0xA4678F28,
+   0xF1095811, 0x4460B514, 0x8BA4A18E, 0x220D6528,
+   0x15F458FF, 0xEB5C7502, 0x9420E572, 0x7D1B4733,
+   0x6F39D742, 0x56B34044, 0xA0F2B519, 0x9E2E938D,
+   0x77F54092, 0x732BF98F, 0x04211C4E, 0x0F6B57F6,
+   0x837A6B85, 0x106561E9, 0x6402B5C6, 0xF75EFF06,
+   0x2113DB2E, 0x8E7B2D37, 0xDDF07BA7, 0x63939701,
+   0xDB57E2E5, 0x0B165AA4, 0x4E275115, 0x79C6E816,
+   0x2C744952, 0x2353D685, 0x32E9CF03, 0xB2E0301E,
+   0x3EDBB7C6, 0x0358E75E, 0x002405C1, 0x40546A03,
+   0xF72D2C8D, 0x53F41767, 0xB7960802, 0x6F1C9C2B,
+   0x2EC355E2, 0x8E933D34, 0x0B24CAA1, 0xEAA716A1,
+   0x82492CA8, 0x87FB96F7, 0xE791A2A4, 0x1D228BA8,
+   0x33E50569, 0x057C81DC, 0x1D46A895, 0xE950D786,
+   0xF9E8EA38, 0x27BFFC97, 0xA8EF19BE, 0x9754DE31,
+   0x159EA2ED, 0x2833AB08, 0x01951409, 0xE70D9F14,
+   0xF6E28D6A, 0xBE42EDCF, 0x650DB1F7, 0xB40E0F05,
+   0x488D70FE, 0x07C94CD3, 0xFDDFE8DD, 0x196581EE,
+   0x7F828406, 0x661233B7, 0x8A05D8B3, 0x6C82492F,
+   0xF66FCF6F, 0xC3A4D21E, 0xEB3493CD, 0xD4E8AA0C,
+   0x0E5B24EF, 0x7AC8CDAA, 0x3DDC353F, 0x30C64887,
+   0x9FD7E6ED, 0x1DCFF555, 0x3302027D, 0xDD46B7DE,
+   0xCBDCC7D4, 0xD897D78B, 0x8DC920AA, 0x1F6AAC13,
+   0x18CF4A8F, 0x98FA181E, 0xEA7C93F5, 0x8B4785F2,
+   0x62B4A5D8, 0x5EA26C23, 0x21C25713, 0x1F314EA6,
+   0x1E732FD2, 0x3F98F1EA, 0x12AC2B8A, 0xBF65736D,
+   0x62D73C85, 0x32C19099, 0x701C09B9, 0x6CA5E17D,
+   0xFA02D7A3, 0x388F0121, 0x4F718F95, 0x63E1934F,
+   0x83BB5DA1, 0x76333A7E, 0xE11FBB73, 0x6B9CDD48,
+   0x677517F2, 0x8E9F9BD0, 0x7F9E3F87, 0xCC8BDEB0,
+   0x0144AA2A, 0x7940315A, 0x2694663F, 0x9330A2ED,
+   0x83C890F5, 0x884A4C0F, 0x3EDAC25C, 0x19A3E4B1,
+   0x5754E4B0, 0xC9F8ECB0, 0x3F98E06E, 0x312E96E2,
+   0x75ACEC9C, 0x2953B1C8, 0xAFFDE248, 0x1D10327C,
+   0x725DA6E5, 0x827C27D4, 0x2AA33B24, 0xF524A7C9,
+   0x6289B318, 0x7C0D4663, 0xACEFFD71, 0x1440CFA1,
+   0x5E780B24, 0x9027DF84, 0x465B1DD2, 0xF9EA2180,
+   0xDB8B47B8, 0xF0123157, 0xEB7F7E34, 0xDC95B9C6,
+   0xA4710ED3, 0xA2E99558, 0x80CC037A, 0x11E42EC7,
+   0x5FA5A9A4, 0xA89CBBB1, 0xCFDB4490, 0x686E635D,
+   0x1FBDC1CF, 0x4A3B9BDC, 0x65BB35A1, 0xE93BD4C1,
+   0x83B43831, 0xA4184A4D, 0xDAEE5711, 0xF4A0EF75,
+   0xC17A9509, 0x00906CBF, 0x8AEFC770, 0x7EE6F4C8,
+   0x642E0994, 0x6DD4EC5C, 0x1BC9B6BB, 0xB7DC4E10,
+   0x593A3FE6, 0x79F9DC81, 0xB05FE149, 0x229E396C,
+   0x188C58DF, 0x977EB4C0, 0x914188C9, 0x64A45CDD,
+   0x99F5027E, 0x2347CC96, 0x1CA3EDC3, 0xE4600E04,
+   0xB54C6F06, 0xA23266AD, 0x746A7858, 0xF0B6D5C8,
+   //Window 36
+   0x2805E596, 0x6F5E0F5D, 0x26281050, 0x89BBA01D,
+   0xEE0D124B, 0x712E1253, 0xBADC49FB, 0xD214B583,
+   0xAAF0C000, 0x049F9294, 0x6AC2C3EF, 0x4E5A9DFE,
+   0x91013E25, 0x965622C6, 0xCED6E714, 0x4B8F321B,
+   0x0051E057, 0xB5A0603D, 0x7A5E5A25, 0x81A2B658,
+   0x306B5712, 0x7BDD7FA6, 0xF6ACF171, 0x526F1B07,
+   0xAE948731, 0x13092201, 0x2570B6BE, 0xF30983F3,
+   0x2226CCDC, 0x1695676D, 0x03552486, 0xA07E761E,
+   0x7D6C4EB8, 0xF0128984, 0x3C5AA103, 0xD39A39B1,
+   0x57DA5C7A, 0x84286C06, 0x6C6124D5, 0xDE6C0E32,
+   0xFB19CC06, 0xAD856519, 0xC7D9918C, 0x6BB8B902,
+   0x03671A21, 0x5B9A5331, 0xBD8775BC, 0xD73F96B7,
+   0x373703F5, 0xC9179A6A, 0x8351D281, 0x4E24749C,
+   0x4AE2EE50, 0x919DE6F9, 0x38287C10, 0x67F4E439,
+   0x72668E03, 0x990C8551, 0x181F57A6, 0x463EB450,
+   0x601EF99C, 0xC7114244, 0x701382BF, 0x6A4DF41C,
+   0x30206E8F, 0x2F4C4A40, 0x52FD0FD2, 0x31F29823,
+   0x3C7C2939, 0x8591518F, 0xE9D24086, 0x8D6A583A,
+   0xA9F924F2, 0x06E4C121, 0x5A962D24, 0x1ABFEC31,
+   0xBFC3586E, 0x7A319D45, 0xFC045087, 0xE86766CF,
+   0xED99DABF, 0x0A092EFF, 0xF6306683, 0x7510BC90,
+   0xFD4C2C1F, 0x3EC97DCE, 0x41A9877A, 0x792380F7,
+   0x61A6AB80, 0x9A4C2BC7, 0xDE1BD5E0, 0xDB0C21CD,
+   0xF51881A7, 0x50BC30FC, 0x10BD862A, 0x7A9B375E,
+   0xC6CD8BAC, 0x0A7351F5, 0xDECA6714, 0x3E0715A0,
+   0x4412D372, 0x3BA2E9FA, 0x0979A829, 0x8FE8260E,
+   0x7C947D9E, 0x3E6A7998, 0x53523878, 0x5806CC28,
+   0xF2EE2036, 0xB12E478D, 0x25C7607F, 0x1ECD6095,
+   0xA48F137F, 0x95312FD1, 0xFD954E5A, 0x0CD405D5,
+   0xAB1457FC, 0xDE7F173A, 0x0E7C381B, 0x639E6C23,
+   0xEAE1BC96, 0x3DF75C83, 0x18153A8A, 0x317E9752,
+   0xD3FB2BB5, 0x7D6A4034, 0xED8E4037, 0x881DB1FC,
+   0x428D3691, 0x24F1B980, 0xB38257BD, 0xCC3D6B63,
+   0x49FD6D4B, 0x7E7D2DFA, 0xCD1A8618, 0x8C82813C,
+   0xE90E1DE2, 0x2E70F310, 0x16DF9995, 0x421E79FC,
+   0x188771C8, 0x0C0EC4D3, 0xF450F88F, 0x8A3DE7CC,
+   0x1461C7DC, 0x15287529, 0x239EC185, 0x3A68B954,
+   0x7A7C5F95, 0xDDBB71FD, 0xD9612510, 0x602EF0B8,
+   0xA8919F64, 0xAFA267C6, 0xCD6A93CA, 0x36B74E37,
+   0xF1BA47A2, 0x410977B1, 0x64BEB33D, 0xE60832F1,
+   0xDAFD2C34, 0x764033B9, 0x2AEA0987, 0x863C9F32,
+   0x6DD0A91C, 0xF0724F3C, 0xAB382FFF, 0xD70DD8D2,
+   0xBD28D60B, 0x92C29C40, 0x4ED58230, 0xEC6B5F3B,
+   0x719848A8, 0xB59426B4, 0x1E4734E2, 0xC4550EEE,
+   0x6A7811B8, 0x9BFBCB02, 0x6D567A06, 0xD710F8D0,
+   0x49EEBE60, 0x2E086317, 0x3B4F2C9B, 0x95D65485,
+   0x7F2B2FB0, 0x923C92F5, 0xD0EB2139, 0x82CB0BBA,
+   0x5574621C, 0x140EF417, 0xD2E4FC93, 0x7C157BF3,
+   //Window 37
+   0x37D6C1B7, 0x26063118, 0xF99591E8, 0x6176A0EF,
+   0x6ADA2064, 0x8C6750B9, 0x3EBA3308, 0xF5035E9A,
+   0x921335ED, 0x22046F04, 0x06508F45, 0x4F769C49,
+   0x2C18581E, 0x9BDE2F07, 0x44B0F2E1, 0xA8A4A413,
+   0xCA599CE5, 0xEFBEC9A6, 0x8C756857, 0x994D283D,
+   0x68E2EDA5, 0x41937029, 0x849988CB, 0x7E35D102,
+   0x98BB0F90, 0x92E31DFC, 0x66A5593F, 0x991F8316,
+   0xD6A5D010, 0x8E3442FE, 0x7A991729, 0x90D1E74B,
+   0x1F7E01EC, 0xC8A7631D, 0x768F02C4, 0xBF3E6245,
+   0xE0BC8BB7, 0x96F20A64, 0xC6DC4B13, 0x4FA9839C,
+   0x1677EBC4, 0xE046A892, 0x262067F1, 0xC17ED7ED,
+   0x266052D4, 0xC05B84EA, 0x28095EF2, 0x4C17AF76,
+   0x1307A23F, 0x67F1943F, 0xC3BE4AC8, 0x81646859,
+   0x0C24E001, 0x23AB47FE, 0x8D64396E, 0xC9D5AAC0,
+   0x188DD6E6, 0xDD6431C1, 0xCC544C97, 0xDAAD484D,
+   0xF9DC4747, 0xC92128EB, 0x4C1AA90D, 0xCD0422C5,
+   0x113EFE1F, 0xFF1EB68A, 0x5B3C7601, 0x58C0E635,
+   0x6064E3A2, 0xC6BF9AF8, 0x8162D679, 0x4528B31F,
+   0xD8BC3979, 0x9A4211B5, 0x561E7469, 0xF616137A,
+   0xBEE860FC, 0x398D04EE, 0x0342B513, 0x10B76CA9,
+   0x3DB1C1F8, 0x1829BBDF, 0xAFE34D14, 0xBC1B0A72,
+   0x94333F9E, 0x3AF1AA78, 0x39347475, 0xBC3C4B34,
+   0x88EF6C03, 0xA9DA7857, 0x86234A4D, 0xE289CDD6,
+   0x57DA48FC, 0x10496666, 0x1F460BF7, 0x5C9B53B8,
+   0x6FC4D708, 0x268E0686, 0x9754835B, 0x834C4C01,
+   0xE6359E3E, 0x804B4A8D, 0x60FAC392, 0x4488E7F5,
+   0xFB361733, 0xCACB513D, 0xAA11845B, 0x5EABC834,
+   0xCC00974F, 0xF8702C3D, 0xE31142E2, 0x8A15A40D,
+   0x91AEC095, 0xD573338B, 0xD8B3400B, 0x71854685,
+   0x9C706AE1, 0xC41A1719, 0x84DF9733, 0xBE2C54EA,
+   0xC7B5C3FC, 0x19DAC473, 0x54C803D3, 0xF0C8B13C,
+   0xD12E970F, 0xA3475837, 0xB58C2579, 0xD89EFD0E,
+   0xF01BD837, 0x91236DBE, 0xABFA7A90, 0xF2545338,
+   0x7E978383, 0xCD7DBAA0, 0xF7B7CBA4, 0xF12A12BB,
+   0x8560A9CC, 0x95F490AD, 0xF9E1590F, 0xA3172019,
+   0x186FFF8E, 0x507DC59D, 0x7EB7EADC, 0x7B70E23F,
+   0x522327A2, 0xA8F6985F, 0x8435E170, 0xFCDA5A58,
+   0xD19533C2, 0x3AE64262, 0xD546E32D, 0x9F612036,
+   0xC7EAE220, 0xCD4D49B5, 0xBA13C86F, 0x487AF0EC,
+   0xA20CD525, 0x056DAA12, 0x75C26590, 0x6823DBBF,
+   0x5ED0DCAD, 0xD1574207, 0x5BB41D3C, 0xF4222464,
+   0x3EFC6E49, 0x454D7E61, 0xCD8BD83E, 0xE976DA39,
+   0xF0539D9F, 0xFF82F6C8, 0xABDCE7AD, 0xBA54AC5B,
+   0x058DAA78, 0xD84340B7, 0x94884CDA, 0x87F46BC5,
+   0x1BD39036, 0xF8F8149D, 0x20ADC4BB, 0xECADCDD7,
+   0x7E4E61DA, 0x37A47196, 0x8C256005, 0xC1297622,
+   0xC3881DE7, 0x30452A16, 0xA5815F36, 0xF36C4197,
+   0x2FBB8538, 0x5258222A, 0xC2A899C9, 0xDBBFBE73,
+   //Window 38
+   0x9A0B4196, 0x686FBA63, 0xB4A737EC, 0x07B4A582,
+   0x25EFE643, 0x6530679B, 0x5E188D49, 0x4DF54BCA,
+   0x0936E379, 0x8C78145D, 0x58D44250, 0x8B31D353,
+   0xDBF1B2B6, 0x58830D04, 0xFE9F2877, 0x257CB87A,
+   0x2DA9CA1E, 0xC37B19D9, 0x663EE951, 0xC0414185,
+   0x7F22EE03, 0x1C8C3FCF, 0x6E84FE25, 0xBC3A4E5B,
+   0xD3F2B701, 0x935ACD17, 0x6283D869, 0xA882F61D,
+   0xD09B261C, 0xE85C9B9A, 0x322997E0, 0x4DFA5539,
+   0x8B213006, 0x2A757CA1, 0x2A5B2456, 0xF9D54DF2,
+   0x363173E0, 0x4EDC316C, 0x20166B44, 0xD6400BDE,
+   0x627B7137, 0x2CCCB06F, 0x8EF453AB, 0xF801AB6B,
+   0xFB1EACE2, 0xFF4C8C9A, 0xF936BEAB, 0x4D0DB837,
+   0x51A22736, 0x95FCD31F, 0x8E7CA536, 0x2C052819,
+   0x1F3ADF6D, 0x6E1029C5, 0x6CDC45F0, 0x2EACE550,
+   0x633CDFFD, 0xDB9462A8, 0x20AD0E1B, 0xE4AD39D7,
+   0xDB736E5B, 0xC6764D3C, 0x11380099, 0xF522CA23,
+   0x0187F8AD, 0x469DB40A, 0x57972879, 0x555B842F,
+   0x3C2D60BA, 0x73D94212, 0x73C2399B, 0x8CBF070E,
+   0xC7B3033F, 0xD239236B, 0x67E8AD3B, 0xCFB5FA7B,
+   0xC5C89377, 0xDDDE6CA3, 0x2162DA53, 0x89B47B4C,
+   0x56A37EC7, 0x75733A48, 0xCBC0C7F6, 0xA50E2374,
+   0xA129E3DD, 0x5931E06D, 0x99BB8B0F, 0x56DADBD6,
+   0xC0E5100A, 0xB2584902, 0x1BD1C9E0, 0xF6931E76,
+   0x4CFCA2C6, 0x9C7571DF, 0x58EB0CE2, 0x0868F07C,
+   0x1876A908, 0xB38A1953, 0xD66AD048, 0xDCA29205,
+   0x9786D8DE, 0xD623B84F, 0x99935691, 0x8B3806BB,
+   0x65CF9BD9, 0xB1E7325D, 0xBE42762D, 0x4EF2C3E9,
+   0x6A117C26, 0xDEA82C70, 0x0DFF7A69, 0xD25D104F,
+   0x83AF5C68, 0x12428EFB, 0x97C975C9, 0x5603CEC3,
+   0x2E862C30, 0x3989DD47, 0x5375AED4, 0xDB910863,
+   0x5B66919C, 0xCDC3E001, 0xBBB5AF32, 0x8CC589DB,
+   0xC5297518, 0x8636DD30, 0x0D7A420C, 0x7A7C4BD8,
+   0xB030766A, 0x32DE7E49, 0x8AB8E841, 0xF2DC1568,
+   0xF885C001, 0xDBEC43F7, 0x969763A7, 0x2A7DFEFE,
+   0xC0EFEE48, 0x89E293FD, 0x0775269E, 0x6ACD61BC,
+   0x7C32A2EF, 0x576BB4F2, 0xC989A2C9, 0x64802554,
+   0x163C169B, 0x7C511440, 0x51DB1698, 0xA264E493,
+   0x8A05C295, 0x12818822, 0x2CBF170F, 0x068D8640,
+   0x35634338, 0xAD85734C, 0x2C4C23D1, 0xA65C01FE,
+   0x35A41DFE, 0xD29D1F10, 0xFC281EBB, 0x49863648,
+   0xDB581A47, 0xE0398D2B, 0x6CDA334E, 0x645EE476,
+   0x3C955F63, 0xB4C2B0E1, 0x1BF3B9E0, 0x64E35CA6,
+   0x64503883, 0xAC73DE4D, 0xB3BEFCF5, 0x089BFC17,
+   0x5F63380F, 0xF7A24A48, 0x606BF87C, 0xC435A652,
+   0x159CCCE1, 0x33DF55F3, 0xDAEF6C07, 0xBD413570,
+   0x9D95DEE2, 0x20E8ACF1, 0x1E9DBFF8, 0x0CCF9A51,
+   0x852B6923, 0xC1344E04, 0xA265354D, 0xA995F6EE,
+   0xE8B43A39, 0xD2F7218F, 0xC3C7B28D, 0x3A6AF3F4,
+   //Window 39
+   0x91F22D45, 0x98163D17, 0xC56E9558, 0xDB56B796,
+   0x6D0F4D11, 0x84D52975, 0xD2000D91, 0x0E7C0D8F,
+   0xE0E16028, 0xDD83EADF, 0xECCF825F, 0xD15FDFB4,
+   0x92B01EA6, 0x183B44E1, 0x01AE050C, 0x7414770C,
+   0xD705D880, 0xF339B53D, 0xFAA8F031, 0xAB2344EB,
+   0x65AB7F33, 0x04AE4BE6, 0x8AB95C34, 0x1BBEA6C3,
+   0x780ED78B, 0x4DE807AB, 0x12878133, 0xD414DD5B,
+   0x5CD8DC93, 0x71B4E2B4, 0x772DDE62, 0x1F495235,
+   0x9F7F84E8, 0xA1AE293B, 0x0A5575F2, 0x7B57CB81,
+   0x0F3B69D2, 0x491F55D2, 0xC0586CFB, 0x81B9BF9A,
+   0xD6B5EDB4, 0x32104A29, 0x6F1493E6, 0x815E4871,
+   0x57818FC2, 0xD252D399, 0xCDCA5D82, 0xA925AAA7,
+   0xD0A580E6, 0x537F3C75, 0x2EFD0453, 0x75BD9F4C,
+   0x7A8B4DA0, 0xCB9275FC, 0xB8E7D43D, 0x19C43099,
+   0x2B17991A, 0x051FDEA0, 0xB0C03B73, 0x2050E090,
+   0x585EB6A7, 0x9108B093, 0xF55E25DE, 0x30BE3F55,
+   0x0DC59077, 0x19E1D71C, 0x46F07E58, 0x77180B50,
+   0x76483655, 0xE700AE23, 0x41561652, 0x59DAA1C4,
+   0x2320C34F, 0x07506799, 0x3582CA08, 0xBB0F4207,
+   0x1A8FF087, 0x0DF14392, 0x886A9C45, 0x5814C758,
+   0x3FDB52C3, 0xD7AA5A42, 0x7CE84518, 0xB541328C,
+   0xA242E8C3, 0xA38596B2, 0xFB92E2EB, 0x551B8C95,
+   0x6C922F94, 0x0B6021EC, 0xC24E6F51, 0x3ECF5B0B,
+   0x15EA2AB3, 0xAEE4AB87, 0xB390D4C6, 0x2FE7C7F4,
+   0x00919106, 0xEC477C6C, 0xA59CCE28, 0x8DFA9B7B,
+   0xA44C9280, 0xBAB45C88, 0xBC807296, 0x99155137,
+   0x901FC140, 0x9DAEAB19, 0x8F9F7E7E, 0xB5BD3169,
+   0xE9B57CB3, 0x1A0EC836, 0xC8354FCF, 0x1005488B,
+   0x80F3C67A, 0x21AA4200, 0x41686322, 0x280B97F9,
+   0x76CAD354, 0x09EE687A, 0x94AF3F0C, 0x419C2CBB,
+   0x42B9B41A, 0xD4359861, 0xE6F9ADA7, 0xFC223709,
+   0x30B87675, 0x6C8CA3DB, 0xD6445328, 0x1011F2B4,
+   0xB6868009, 0xC7AA3D5F, 0xABC283C5, 0xC991BFD0,
+   0x38BEDBBA, 0xEC7039FB, 0xDC4B6233, 0x22E2EF61,
+   0xE8D84970, 0x5F9B7311, 0x3665730B, 0x25BFBA02,
+   0x98A49553, 0xE5CE6EA6, 0x26006B2E, 0x77DAA75F,
+   0x90A00286, 0x3668C309, 0xB8AED2AC, 0x4087CDB5,
+   0x892E8EBE, 0x857A4C5F, 0x769D0D96, 0xD143FF28,
+   0x68B5299A, 0xFD3AA7C9, 0xF16B1027, 0x83582462,
+   0xF49082FC, 0xF9B9D80F, 0x1F2DDC93, 0xD84D210E,
+   0x96352282, 0xAC82D028, 0x8CF768ED, 0x33240E07,
+   0x815B657C, 0xD0CF0ED3, 0x12B0669A, 0xFEF68852,
+   0x2CBE857C, 0xA1ADD8DD, 0xC263BA83, 0x9DBF2FF6,
+   0x44A4D18B, 0xC6A23369, 0x9FDAC418, 0x8EDA4AA7,
+   0x50FAB139, 0x2BD71F48, 0x1E65A25F, 0xAB59672C,
+   0xBF38366B, 0x6B6DA80C, 0xE4BB8405, 0xCF113D50,
+   0x5BEAD200, 0xC4C99E00, 0xF7616754, 0x811A0471,
+   0xE0100037, 0x4B82503C, 0xC8322812, 0xEE16949B,
+   //Window 40
+   0x8456B4DA, 0x8568960C, 0x67FEC6AB, 0x511AF0D3,
+   0x9CAF93B8, 0x054CD79B, 0x77D8D02F, 0x3D84E21E,
+   0x846E6F59, 0x5F9507F0, 0x1D798DDD, 0x778BFE30,
+   0x1B8935FF, 0xFE97A16B, 0xFA735802, 0xFCA8C5BE,
+   0xF76431B9, 0xF7F6EA02, 0x72F26EC8, 0x37869C2F,
+   0x1EC658A7, 0x150686BF, 0xA3AE9E76, 0xBE41E479,
+   0x377434D0, 0x132B090E, 0xF1BD60F0, 0x2F07C163,
+   0x08DD6BE2, 0xDFF3A5BF, 0xD9AC5119, 0x2E21F4B5,
+   0xD4A86E5F, 0x696350F3, 0xE9D37F67, 0x0DD522A7,
+   0x52E2B852, 0x36520211, 0x2CE2A87F, 0x56E91912,
+   0x445C677C, 0x07E96DE9, 0x95742D59, 0xD34CD591,
+   0x6D93BAB1, 0xFFEEBD3E, 0x163763D5, 0x917BF9C8,
+   0xA8701430, 0x6A66EDA1, 0xE696F639, 0xEE4205B5,
+   0x6E9DCE47, 0x8B5895C3, 0x4CE0880C, 0xA206FBA3,
+   0xC653F347, 0x607D942B, 0x6F44BD15, 0x42DFF0F7,
+   0xDEC93846, 0xBF64BE28, 0x86E36B3E, 0x75FD8B4C,
+   0x6A7C1731, 0x01932443, 0xDD8EFD68, 0x88C40FE3,
+   0x7F5F2037, 0x2AB7692E, 0x3758BE5D, 0x3AC4D3D0,
+   0x1814FEED, 0xD15665CE, 0x5E43C9BF, 0x21E9C4A2,
+   0xB757CFF9, 0x2F4DF00E, 0x785D0008, 0xF81509EE,
+   0x827B5428, 0xFE819CE2, 0x366E54C6, 0xD283AB71,
+   0x6DF187DB, 0x88ECD5A1, 0x038D9542, 0x1FE6B2B2,
+   0xDCFA71EA, 0x4324BBF5, 0xC3792820, 0x23BF513B,
+   0xA339BEDB, 0x2A739543, 0xF9C173F4, 0x0B3EF0F6,
+   0x9B0AB534, 0x097CC584, 0xBA3AD38D, 0x584A2D57,
+   0x60A65383, 0x78499A58, 0x70B5D1B2, 0xFD26A814,
+   0x63D81DDE, 0xAAE59D1C, 0x836C58A0, 0x2ECA959B,
+   0x146428A4, 0x9D9B972C, 0x0FD856D7, 0x2E4BD543,
+   0x4FCF1342, 0xDEC879C3, 0x7B31CBA4, 0x903C56FE,
+   0xFE8F1DEA, 0xBCE18CF7, 0x40647D56, 0x19EECCE2,
+   0xE9A33BBF, 0x7FBBD655, 0xC67CA821, 0x97AFEC2E,
+   0xFCBD1683, 0xDA632BDA, 0x50CB5844, 0x3816832A,
+   0xC5D6569A, 0xBD9E48CE, 0xB15D9051, 0x7F4CE0D5,
+   0x3BA26DE3, 0x6AFA726D, 0x069B6D3A, 0x041FEAD2,
+   0x10D9429A, 0x2995F8F6, 0xEB677439, 0x24D30C1A,
+   0xA4842018, 0x41B507E6, 0x40F10F4C, 0xDD7BE5B6,
+   0xF20142E2, 0x4FA3DAA2, 0x3F7155B1, 0x31EA3F96,
+   0x335C814D, 0x48D792DE, 0x184DF78D, 0x084A014B,
+   0x7A12C205, 0xE45E9163, 0xE42B604D, 0x381CEF2D,
+   0xD3E193D2, 0xC7F3E606, 0xD6F30973, 0x95CDE1EC,
+   0xADEDFAFD, 0xC401AD73, 0x40F75DCD, 0xA7EE8FF2,
+   0xDBD11127, 0xB9BB1209, 0xDF49326D, 0x00CE7A04,
+   0xF590FFC9, 0x86CE89B6, 0x3D3C7860, 0xDB6254BB,
+   0x67B9B394, 0x03EC20E0, 0x088BCDFC, 0xDB1D3D5C,
+   0x895F7059, 0x86F8A8BF, 0xEAB099BF, 0x29873215,
+   0x720CBB17, 0xEF4C7C11, 0x0F09BCA9, 0x8CED14F9,
+   0xD302AA81, 0x19CB632F, 0xB8BB9CE5, 0xBF2C67D4,
+   0x4E885A8D, 0x0ACE40B2, 0xE8AF6E99, 0x185109E5,
+   //Window 41
+   0x4EC91657, 0x7AA29366, 0x09DD1CA2, 0x59BBAA87,
+   0x8172145C, 0xA02D4113, 0xF2DDD3E9, 0xB56AA4A4,
+   0x9D07FDDD, 0x356556FE, 0x86FEA1B0, 0x137D0872,
+   0x2F711ECF, 0x42E9A286, 0xC2472C15, 0x0DB3DF0E,
+   0x41DF85F8, 0x1283110D, 0x6E41C686, 0xB603544F,
+   0x54041A11, 0x732F05A0, 0x7820E29E, 0x9586A28C,
+   0x6D966D64, 0x91D74ECD, 0x72E76881, 0x1290184F,
+   0x8B0069A5, 0xCF50FDF0, 0xA8F48F6E, 0xFB7FB39F,
+   0x4CD5494B, 0x1C46FDEE, 0xACEBB78B, 0x018A9502,
+   0x2E41E240, 0x11BB6224, 0xE1BBCEF6, 0x685B96C0,
+   0xDFF9F18F, 0xBEB24E42, 0x0DCA02F7, 0xB5D520E2,
+   0x5DE0BCDD, 0x5C7CB350, 0x96A86AFE, 0xC4E3E3F7,
+   0x3F32FCB6, 0x4940A79C, 0xE6C3D1F1, 0x2E5C5C86,
+   0xA2D71EB3, 0xCD798A7A, 0xDB0CE910, 0xCC128C05,
+   0x8CAE704B, 0x5114CA40, 0x66A09FD2, 0x55706F88,
+   0x33F8A7EF, 0xD70A5B12, 0x77FBFA11, 0xE5D808A8,
+   0xA0146A62, 0x2CC53605, 0x695F3579, 0xA1A547AA,
+   0x205B2773, 0x3AE6A0E1, 0xE67F27B4, 0xDA42FE9B,
+   0x5CEFFF4C, 0x3A926C94, 0xD779CB3B, 0x17AD6D72,
+   0x274744A2, 0x5BE5C662, 0x942AABE8, 0xFDD29308,
+   0x4BB7E799, 0x7DBC115F, 0x2E1A9287, 0x372F5980,
+   0x8EAA9BEC, 0xEEF2ADF0, 0xDE5E5AE8, 0xCB1B7E8F,
+   0xF5DEA582, 0xD8FBB5D7, 0x14A4FA79, 0xE2F6F731,
+   0x3D8775E9, 0x5D756590, 0x670E6CAA, 0x7AC56E1A,
+   0x3C0F7074, 0xF515D78B, 0xF214D1D4, 0x3D8045C2,
+   0x1C4EA940, 0x1BFE4B34, 0x3C0DED72, 0x08A0E9DE,
+   0xE2110316, 0x96C585E2, 0x3546012A, 0x27BC41AC,
+   0x709DA766, 0xD3B05BE3, 0xD5D969D4, 0x96EFBB33,
+   0xB7F38B65, 0x75DFF1CB, 0x4DBC49DF, 0x1ADDD745,
+   0xDA72920D, 0x68621AEE, 0xF30E8C80, 0xE017FCB3,
+   0x8A9BBCF4, 0xDF052D6D, 0xA3655176, 0x998AF041,
+   0x254C237B, 0x38DC8D71, 0xAF7305A3, 0x4AE63390,
+   0xAF6E8EA8, 0x956C1DAE, 0xD2B312E4, 0xEFAE4764,
+   0x41E4C572, 0x13EE5014, 0x3A836705, 0x08FA0996,
+   0x8EDF1E5D, 0x8280DF49, 0x98939C53, 0x4ABB6185,
+   0x8EFAE1A1, 0x26839263, 0x13E05ECF, 0x637C01D5,
+   0x46A68D23, 0xC7E0D304, 0xDD4472A5, 0x3795BF29,
+   0xD7DEC6D5, 0xEE8DD74E, 0x79D1216A, 0x751F83CB,
+   0xD84D467E, 0xF11551E8, 0x2357B5BE, 0x5FCC4AFF,
+   0xF6056AC3, 0xBB8BC03E, 0xCF385430, 0x0912C67D,
+   0x8B189194, 0xD353D3B4, 0xE3835040, 0x262B58EC,
+   0x772B7775, 0x944F1664, 0x395D610B, 0x18B21298,
+   0xAD5261AE, 0xBEEF8F80, 0x6F5336E9, 0x55DB9B7A,
+   0x77D90EA8, 0xC9F575C7, 0x345EB652, 0x6CED4058,
+   0x84D21CEC, 0xA3038AC2, 0xB4A0E0B6, 0xE4666676,
+   0xC3EB8EC3, 0xE183F7F9, 0x6467DA2E, 0xE0B4B28B,
+   0x31A5D8A3, 0xACB67E3F, 0x4B226710, 0xBF916F87,
+   0x95EE07C8, 0x071704A5, 0xA6113464, 0x560318E9,
+   //Window 42
+   0x057A5682, 0xDB22F743, 0x51F721AE, 0x212DCF2C,
+   0xC951C5D9, 0x66B6274C, 0x182A49CC, 0xC05CFE04,
+   0xFFD6582C, 0xB031DA3E, 0x7EBD5F3C, 0xB3D99DA9,
+   0x7A3D1084, 0x4D7E446D, 0xC720A95E, 0x8D37CB72,
+   0x96FB5822, 0xF411E7CA, 0x6301C209, 0xF5BEE88D,
+   0xF5203595, 0x5337672B, 0xD554D1D3, 0x75B71E1B,
+   0xAE0D0480, 0xD47C0ED5, 0x0DEFCE89, 0x7046A110,
+   0x937E48AE, 0x142506C1, 0x41087A0B, 0xF698907E,
+   0x805740E4, 0x0DF6770C, 0xDF95CEC6, 0xA54B25C4,
+   0xC63B0D79, 0xA9CDBFD0, 0xEE435F80, 0x06B912A1,
+   0x976CB6EB, 0x6C96E993, 0xEED92A8C, 0x1F90904E,
+   0x80CAECD2, 0x0196DE28, 0xFDB7D86D, 0x92D3CF6E,
+   0xA88B3D48, 0x5141DEE6, 0x84EBE851, 0x6AB6B3D1,
+   0xEF243CE2, 0xA65FE6C1, 0x5C25CB8C, 0xAF740004,
+   0x1C70539C, 0x5EE26A42, 0x3BDF351D, 0x97D93EB9,
+   0xFD39F8CC, 0xE8A75B6C, 0x3BAE40DA, 0xA07475DE,
+   0x4A6A1CE8, 0x1DFA8601, 0xE6893AEC, 0x6E377C72,
+   0x96DEC79B, 0x95642D84, 0x404CA311, 0x90ACB65F,
+   0x4747D927, 0xB5113CC2, 0x9BFC83F4, 0x326954E1,
+   0xCCD06860, 0xDEF1B32E, 0x603D0CD7, 0xAF80E53D,
+   0xA247B3C0, 0x340C0217, 0xDF3ACAB0, 0xF0B910C7,
+   0x6BC95AEE, 0xBDDE2895, 0x9FDE8503, 0x106F1B6F,
+   0x0EB4B04C, 0xF9882DEB, 0x773C4702, 0x75215B86,
+   0x16644652, 0x4235FC06, 0xBB9DFEDB, 0xF5173836,
+   0x9E71F493, 0xF34D653D, 0x86920F48, 0xF547073C,
+   0xE7117BB6, 0xBD414E1B, 0x2A4351F8, 0x8A06746D,
+   0x1A323071, 0x6D606BFB, 0x6B2CC0FD, 0xBCAA51CF,
+   0x87CADD2C, 0x7D2B34D4, 0xC3C80FA0, 0x7A3027ED,
+   0x31C3AF84, 0xEE1B37F5, 0x284216B8, 0x40A6FE45,
+   0xB0FFD9AF, 0xD36C7AA0, 0x069768E6, 0x4E08B0B2,
+   0xA61BDEE7, 0x380A1728, 0x3FB81E12, 0xB524E104,
+   0x8FD9DD90, 0x37B72208, 0xB5A21E84, 0x329BFAD0,
+   0xE6AB5DC6, 0xD05DF848, 0xF65E1B00, 0x05269FB7,
+   0x0784AFA5, 0x86975977, 0x7075B744, 0x27D36DA3,
+   0xFCDC1803, 0xAEE0A47F, 0x02249EA8, 0x279409E6,
+   0x412C2F31, 0xCD61D355, 0x9FEC16DC, 0xD7D16405,
+   0xC29404A0, 0x278D8C3C, 0x760D0B86, 0x9563BDA5,
+   0xFC42A2AF, 0x9B44D5D5, 0x1AD8C5F1, 0x4BAFDB19,
+   0xDA9CD45A, 0x8C07A263, 0xA4425985, 0x69990897,
+   0x546EBDAA, 0xE51FA1B3, 0x4EFF18EA, 0x4A4052C7,
+   0x0380F324, 0xEFF8D0F3, 0x0E3D6130, 0x78FBFA8F,
+   0xF80303E5, 0x969247E3, 0x4A6835C5, 0x3FBC7AC0,
+   0xC03273DC, 0xE5B23A24, 0xD892D7DC, 0xFD55AA31,
+   0x275F18C5, 0x9830F769, 0x26B8F287, 0xE55D4486,
+   0x09B16EBE, 0x4FF228B8, 0xEB0F9AFA, 0xE5B27F22,
+   0x54299BC3, 0x03FB729E, 0x6E2B2BE5, 0x33FFF5FC,
+   0xD3590A53, 0x1801F44F, 0xB91770D0, 0x5BF5F04A,
+   0xDA117E72, 0x1609A928, 0x540E50A3, 0xE44DF983,
+   //Window 43
+   0xDCF5B44D, 0xF5E6C882, 0x36C2DAF9, 0x0AD397A7,
+   0xC4CC9AE9, 0x1F1652FE, 0x97F2913E, 0xE60FDA50,
+   0xB36DE182, 0xB735F7B4, 0x401F5436, 0x5916FDCA,
+   0xCF414A55, 0x80453099, 0xB6A87BE3, 0xAEA86E9F,
+   0xE55B3B1C, 0xED647CEA, 0xF3197F7F, 0x32927302,
+   0x423AA340, 0x501D12E8, 0xC9C9273D, 0xC00C4D4E,
+   0x6A85812E, 0x9E65DC8D, 0x81169F5C, 0x0A1129CB,
+   0x3E1591B1, 0xBF12AC04, 0x2446BC92, 0x65F52E69,
+   0x6A74A28D, 0x30675A67, 0xF6E7FB2E, 0x75218CAB,
+   0x5FF11AAC, 0x7E68480A, 0xD4FFA13C, 0x4036B09F,
+   0x48715031, 0x78E32D08, 0x9A85B1B7, 0x4E2B24FA,
+   0x0BCDF79B, 0x6C48CF4B, 0xD670EB8D, 0xDD6F387A,
+   0xE5BF2AE0, 0x9D0BC5C6, 0x29F7AF18, 0xF030DDEC,
+   0xD7BB7740, 0x9834ACDD, 0xE1E71258, 0xE78A748B,
+   0xE6A84D32, 0xDF5FDB63, 0xBF2F7633, 0xDF067468,
+   0x9F0E1F41, 0x396EA4BE, 0x109B12D4, 0xF3DFC3D6,
+   0xA9165441, 0xD606F2A8, 0xF45EB137, 0x3D1C5551,
+   0x421E9B16, 0x1E121F60, 0xADB19465, 0x71EB227A,
+   0x05BA2B0C, 0x9C759AE8, 0xACE4091B, 0x3FFF01F2,
+   0xB621F3EF, 0x7316AD69, 0xC80D456D, 0x92032420,
+   0xC3A2A686, 0xC91445EC, 0x574CD314, 0x7382B8F2,
+   0xA7E7371F, 0xF0B8C621, 0xAA2DC861, 0xF73EC809,
+   0xB59E5A9D, 0x23B3FD03, 0x3DF0C734, 0x6EE5C437,
+   0x31DC4157, 0x7BDB2D8F, 0xD773BB02, 0xD880476B,
+   0xB4F3ED99, 0x1EDA0F7A, 0xE24FFB1B, 0x7E846003,
+   0x0B1774EF, 0x6CD2BEBF, 0x0DED9125, 0xDDA970E9,
+   0x7D3F1CD6, 0xE245A792, 0x5557F3C9, 0xE409635B,
+   0xA156B334, 0xB57B195E, 0x078CBAF1, 0x635CBA42,
+   0xA0B38096, 0xA8A53116, 0x9D37E856, 0x48BA2320,
+   0x72599B2D, 0x2D563817, 0x675385D9, 0xCD14FDBE,
+   0x3FEBFA48, 0x8079263A, 0x7FA4CD8D, 0x7FAAB7DA,
+   0xE5DE8926, 0x2E635F2A, 0x9DC764FA, 0x979799BF,
+   0x1A783390, 0x51382F7E, 0xA7862142, 0x0DB2C3FB,
+   0x9DD48C86, 0xDD82C9A5, 0xA5250C57, 0x4BEA035F,
+   0xBAD99468, 0x3DE149C9, 0x099346CD, 0x4EA1FD3E,
+   0x587AF106, 0xE37CE2BB, 0x32A39F03, 0x6B392CC0,
+   0x1FE80944, 0x2D4EE5FE, 0xF62D2278, 0x449C3957,
+   0xDCA5D59B, 0xE4AD41D7, 0x5F52E107, 0x993EF8B3,
+   0xD29535D4, 0x10BD6744, 0xFCF44483, 0xEBD7581B,
+   0x29A58FBE, 0x069132F2, 0x31C2758C, 0xFDAA852B,
+   0xAFFC52C4, 0x7BA675DB, 0x00BF9A71, 0xEA0FF4B2,
+   0x197E4ABE, 0x90A082A9, 0x8E79E6C7, 0x1AF7AC35,
+   0xF6A67BF5, 0x5E8682FD, 0x2772B2D6, 0x79E8D54B,
+   0x28D1B379, 0xEB27E4FD, 0x9CEDD98A, 0xA69B7C01,
+   0x4899BDDC, 0x453A6750, 0x60F04F5A, 0xB90D2A46,
+   0xDD19CAFD, 0x5122C73B, 0xA5D5269C, 0x46FF6EFF,
+   0xD2F0F1EE, 0xFA9D6347, 0x70ACDCF8, 0xAB704E0A,
+   0xB30A1C11, 0x6D01B8AF, 0xE8208BCE, 0x3AF49722,
+   //Window 44
+   0x839484BC, 0x63416DDF, 0x4917A76E, 0xF8E673E6,
+   0x687BB208, 0x3692169F, 0x2A8A454A, 0x262FD932,
+   0x7991A2B7, 0xD91C12C5, 0x2B9046B5, 0xAD0CAD66,
+   0x4CE184AC, 0xB9E4584D, 0x95DE57DC, 0xD36AAB4F,
+   0xF5A0CF25, 0x99C48720, 0xABFC71C7, 0xF8AD16EF,
+   0x4EBF2D1C, 0x603BB39F, 0x2B8E1AD3, 0x806FBD10,
+   0x53996EEF, 0x87C86DEB, 0xCD5FAB3C, 0x08BE861E,
+   0x48AA7598, 0x3EF8F4B6, 0xB27A037A, 0x9D84CB2D,
+   0x33743279, 0xE69274B9, 0x65F4AC88, 0x7E9E19C2,
+   0x9D3E74BC, 0x94A691B3, 0x827D37C8, 0x237E8F66,
+   0xE97736B0, 0x6902BCB1, 0x56856621, 0x44CF300E,
+   0x6CEF4AF8, 0x238DD548, 0x9B46BE9F, 0xDA325137,
+   0x2068ACBB, 0xA97FC08D, 0x59A9F44B, 0x621C9C1C,
+   0x0C455CE2, 0x78C8373D, 0xA17FF81E, 0xFC126226,
+   0x76B1400E, 0xF86E7792, 0xCB110B3E, 0xD2ED3E08,
+   0x3F3F1E4D, 0xA3F5279F, 0x38763BE8, 0xF0E7BA23,
+   0xFF0962B8, 0xAC650C08, 0xA07EFA7E, 0x6263A1FF,
+   0x177F8266, 0x67D4A07E, 0xED12E6C3, 0x29217DBB,
+   0x4A01A916, 0x31700A14, 0xB8908680, 0x7C8437C1,
+   0xE4403F35, 0x4E7A93B7, 0x6E23D0CB, 0xB2B3ED14,
+   0xC0D39A44, 0x96108BC3, 0xA1AB90AB, 0x91A77AFF,
+   0x7BC6F273, 0xF31168EB, 0x18F566FF, 0x5CF4C913,
+   0xD6B141DB, 0x3E71395E, 0x202DE51E, 0xF8F1F54F,
+   0x7E4B5300, 0x41FAB2F8, 0x9F0C1DE9, 0x668ACAC5,
+   0x96CCE313, 0x09D6EB4A, 0x8D5842DA, 0x14E8B616,
+   0xA0DC9114, 0x59EBD710, 0xCA7BF540, 0x5572DA55,
+   0xAB4C0850, 0x9AD569A3, 0x29153242, 0xEB85D7BB,
+   0xA274ADE5, 0xB91D7041, 0x39BDB6DA, 0x7D7F8D2A,
+   0x3CB76612, 0xF249838E, 0x4B5EC768, 0x013DFC85,
+   0xCE3132B8, 0x28CBA769, 0xD66EFF1C, 0x374C0036,
+   0xD58C5D8A, 0xF7F02964, 0x0B8EB2D7, 0x26FAB898,
+   0x503032C1, 0xF28699B4, 0xD44BCC31, 0x1F3E6E0A,
+   0x5256A23B, 0x78516F22, 0x4919A33C, 0x8DE3D99C,
+   0x563B251D, 0xCB2A2E9A, 0x496ACCB9, 0x0330E18C,
+   0x4A51443B, 0x13677E99, 0xC6D8460E, 0x8424F019,
+   0x9EBF7BA9, 0x57946F09, 0x3A2688F7, 0xEBE482F9,
+   0x87F65917, 0x35B4B4AE, 0x4074ADF2, 0xB6E69A81,
+   0xC5CD91FE, 0x8CE3239B, 0x9607E824, 0x76029D99,
+   0xBD132E63, 0x7716A1A0, 0x8E71231A, 0xA4807C8A,
+   0x02F613EE, 0xBDA9D00C, 0x66C0A6C7, 0x0F1FCB5E,
+   0xA6F9DA0F, 0x8EA33915, 0x44FD0C30, 0x3304304D,
+   0x327B7F02, 0xFBA839AA, 0xBEF6E1E5, 0x3D4D67EA,
+   0x15820793, 0x1DEFD0E8, 0x585FE962, 0xEC1A3760,
+   0x28C0F3C4, 0x3CC6AE1C, 0xE910A3A8, 0x334C8A64,
+   0x1CA69834, 0xEF07EC38, 0x94AD674C, 0x5A1AE00B,
+   0xA7D5B2D2, 0x5BEA92A1, 0x058AEB44, 0x36DAD5EA,
+   0x9215FCB7, 0x50833343, 0x087269A0, 0xE6C2ADF5,
+   0x7D6BC4AF, 0x82BA03E3, 0x7038AAE9, 0x873FC10D,
+   //Window 45
+   0xAD3AB043, 0x064B0F77, 0x5742664B, 0xE002FF5A,
+   0x087FECFD, 0xF83F8CB0, 0x8B1122C6, 0xE1CB78CA,
+   0x2FD30FEE, 0x8D7D7600, 0xF3CDBDD4, 0xDD22A800,
+   0x287EC7AA, 0x8B5FF455, 0xFC7E03ED, 0x517ADAD9,
+   0x8E765F15, 0x25E7253E, 0x2759B7AC, 0x24758758,
+   0x10275F27, 0x86D0CEA2, 0xEE1842F9, 0x9926862D,
+   0xFD7B4296, 0x8B8488EA, 0xC13B1716, 0x7AAC167F,
+   0xDF6B2498, 0xDCB887CC, 0x62C273E8, 0xC258C402,
+   0x5E1F72A8, 0xCACFC3A7, 0x76CBF386, 0xDE2F8CED,
+   0x8D865D53, 0x4ECE3407, 0x1B45884F, 0xDE26E80E,
+   0x49AB821C, 0x14CCAC6C, 0xECC7D271, 0x0CAD3EE7,
+   0x81917606, 0xDBBDE7E7, 0xAE086CF7, 0x2B0E25C6,
+   0x8FA2BE0C, 0x2380CD09, 0x3D185B92, 0xB22DFC62,
+   0x051A2AAE, 0x85227E0E, 0x7ED1857E, 0xB2295A3B,
+   0xC8EBC688, 0x244FE215, 0xD3D82A56, 0xDFEFCADC,
+   0x78809378, 0x80CA3526, 0xBA2E9656, 0x378AC77D,
+   0x547A9495, 0x77B2C528, 0xAB8A72E2, 0x39D0BEEB,
+   0x80C934C9, 0x1BDD5FE6, 0x14008E03, 0x2BF3F69F,
+   0x6171D68E, 0x4D991D64, 0xBD084D96, 0xEAFBADAF,
+   0x37F53377, 0x16346EA5, 0x755444F5, 0x9F178834,
+   0x1012B232, 0x7B79A14C, 0x85921A4E, 0x0FA56E29,
+   0x89D66D27, 0x34731AF2, 0x8FA74D29, 0xFF7479A5,
+   0x6AF63266, 0x6180A833, 0x16589F19, 0x6E37B858,
+   0xC5EC0211, 0xDE0A1A3D, 0x8215C1A0, 0x3513F522,
+   0x0AC36209, 0xB973D1D7, 0x92E8E2C3, 0xFBB792D3,
+   0xFEEA49F9, 0x48F72CE8, 0x405E1B78, 0x4C184E3C,
+   0x4ACF2992, 0x760CFC25, 0x99EA574D, 0x0A667818,
+   0xA71AFF59, 0x00EB986D, 0x8A47B829, 0xD258ADFF,
+   0x3F467610, 0xDF03F375, 0x138A19E1, 0x7F62DCCE,
+   0x0E5ECF01, 0x466CD78C, 0xC9B17321, 0x14C4B718,
+   0xB3342021, 0xF0832849, 0x73ADB3A4, 0xE91A9FF0,
+   0x250139BC, 0x4349038F, 0xE67C194C, 0x05450107,
+   0x03E4315F, 0x90866F01, 0x8B34886D, 0xAE3D1A0D,
+   0x29DCBAA5, 0xD8E9351C, 0x48011DE7, 0x15FC7FE8,
+   0x34EC5AC0, 0x4772B542, 0xE5864055, 0x02F13449,
+   0xD96508C2, 0x9D645E12, 0x3D7C31FE, 0x31DE67AE,
+   0xD3291270, 0x509B6D91, 0x7B05B62A, 0x64095D71,
+   0x7FA6F4EA, 0xD37351F3, 0x9B966EC9, 0x553F2C55,
+   0xF772CE3F, 0x1134AB74, 0xBAC742D8, 0x12577D34,
+   0x3FB4C386, 0x6E7EFE96, 0x711C879C, 0xF94ECFBA,
+   0xCACC919D, 0x77029A5B, 0x2EE99AB2, 0x0F970896,
+   0xEC93F891, 0xB50A6881, 0x3F7B8150, 0x3A69796A,
+   0x9E96E5AA, 0x5D9C0B7F, 0x64E47E67, 0xB4FD7284,
+   0xEDAEA6D9, 0x6FD246A9, 0x02C15F6F, 0xBF8B96E7,
+   0xFA36EB5E, 0xA9D56D48, 0x747D820B, 0xF33F4E2C,
+   0x5FAB268F, 0x7DC14221, 0x87957550, 0x86159845,
+   0xF43B1687, 0x2A754EE6, 0xE7E6430C, 0x3E4DC93C,
+   0xC14B4032, 0x8444199E, 0xFED66305, 0xE7081B92,
+   //Window 46
+   0x7C84AD05, 0x64809CC7, 0xFA12106D, 0x98ADE2D9,
+   0x370DA1BA, 0x2DC25204, 0x35BE0E7C, 0xCA3AA1C9,
+   0x1DF710DE, 0x7BD4D112, 0x87DB5C07, 0x4FA9B824,
+   0x9C821B7D, 0x5BA62B46, 0x27D1E9FF, 0xD0AFB3CA,
+   0x28AA18E7, 0xE2765B05, 0xB6296D2C, 0xED1FEC99,
+   0x16A3589D, 0x2013139E, 0xC2737A29, 0x333EDD5C,
+   0xC2F28385, 0xB9630603, 0x85A67988, 0x2F8D7728,
+   0x217793C3, 0xF5D841F4, 0x303D6D9E, 0x98A3BE0F,
+   0x87830818, 0x80D1AF45, 0x0AF55AA7, 0xB2642C00,
+   0x2633C1EF, 0x5C628D4E, 0x2474B2F8, 0xF39B436A,
+   0x4F13F45A, 0xFE223B75, 0xA8B5CA46, 0x5C9BFE59,
+   0x8E0BEE5F, 0x810D2C64, 0xD57A761E, 0x59C6FFC6,
+   0x2C599265, 0x067F4536, 0x5116BA44, 0xDD7AC3E5,
+   0x8EBBDB21, 0x0AEFEFD7, 0xE4406404, 0xF71A150C,
+   0x7E06C09F, 0xE96B05E4, 0xC97E1503, 0x407BF578,
+   0x58A147A7, 0x7D46120C, 0x93986D97, 0xE644534A,
+   0x61AD1987, 0xF9A2B0A7, 0xD89EE5A7, 0xCC29A3EA,
+   0xB876557D, 0x27887E6C, 0x48140CFF, 0x46A66F7B,
+   0x393FF447, 0x820CCAF3, 0x5090BBFC, 0x56991743,
+   0xD5B28C0B, 0xB6061EC1, 0xB70C15B3, 0x4537910C,
+   0x2633B016, 0x1098D77E, 0x2555A511, 0x7D38BE15,
+   0x0A6C32AB, 0x86F67E04, 0xD51A2568, 0x46F2EE26,
+   0xDFED7538, 0xBA9D5926, 0x6C40E647, 0xC0AB1412,
+   0xFAB5A9C3, 0x188D2909, 0xA6B5AE22, 0x67B40BEA,
+   0x0661E696, 0xF1FA87A7, 0x4ECDCEC0, 0xF8660903,
+   0xF95A1A77, 0x3AEB307B, 0xA0D4A59B, 0xAFFED02B,
+   0x699AE2BD, 0x98FFE265, 0x435BC353, 0x54FE523B,
+   0xE382B496, 0x434FE714, 0xA7E3812E, 0x9C94560A,
+   0x10DAE541, 0x061A5519, 0x38384EDC, 0x7FD95538,
+   0x874D09DA, 0x0058EDB7, 0x64F9C635, 0xB95547D2,
+   0xF3C09935, 0x04604250, 0x70D5F9EC, 0x208CD08B,
+   0x25F4A989, 0xF6824749, 0xA4234AD9, 0x8F585C84,
+   0x4DD31BDF, 0x1848D627, 0x672C8F63, 0x56C28C77,
+   0x36142D72, 0x2324C2C2, 0x4C50D8FD, 0x0EF60F1E,
+   0x8BF5FE6C, 0x9D4E2CC6, 0xB7F1DA75, 0x68C1F89D,
+   0x1FCD2BC6, 0x4DE4AB7E, 0x3A14CF72, 0x03E83DB7,
+   0x1063DF40, 0x7154717E, 0x1F057D81, 0xA4F9C46C,
+   0x94BB94AB, 0x612B38F6, 0xC8F74560, 0x41A0B8CC,
+   0x9BC34409, 0x458F671D, 0xAF5EB184, 0xB3B15BFD,
+   0xA11729AE, 0xDA58A940, 0x1A1B9675, 0x3013FDE2,
+   0x61CCFA11, 0x04A1A03A, 0xF3DC4557, 0x3BC8C2BF,
+   0x496E75A9, 0x6812723F, 0xE0F7BB69, 0x12E7BF6A,
+   0x9D245060, 0x8D5C8A10, 0x5D74CAF1, 0xC916EF45,
+   0x282CE90B, 0x127B7DFD, 0x5F0C02E0, 0x16E6E259,
+   0xC65415E1, 0x54FD8E92, 0x43EFB6F1, 0x2CB47C95,
+   0x32DC40A8, 0x44F43603, 0xA2857BE6, 0x3DCCFA8D,
+   0xB5DDDD0D, 0xC696D841, 0xF0C92AAB, 0xEBBB2D43,
+   0x6965C76F, 0x815FF957, 0x076B7436, 0xD588A64A,
+   //Window 47
+   0xF055FFEA, 0x64FAC04C, 0x1BFEFCC4, 0x205FB93A,
+   0xB4BA5E68, 0x8DBEFAEE, 0xF8F9B6DF, 0x933A8BEA,
+   0x575D2139, 0x35FF277C, 0x1D5DC732, 0x851EA5D6,
+   0x2F5FE954, 0xA6C32AB6, 0x885EA15F, 0x7C46012D,
+   0x61B9D626, 0xF5307FB6, 0x30B8384F, 0x32F82B92,
+   0x0516A17F, 0x785C7B87, 0x821AECCE, 0x5DC6EE8F,
+   0x3D681AAA, 0x69E04201, 0x0E539216, 0xA83F7166,
+   0x46E7B3E5, 0x679C93B7, 0x068E5BA5, 0x2F63EA84,
+   0xB7D725DB, 0xBD9B1F03, 0xF3C66632, 0xBB9AD200,
+   0xAFC66759, 0xF0DCC19B, 0x858F22CE, 0x8FAF2372,
+   0x6E653C9F, 0x59277556, 0xD9114ADB, 0x72BB4BD1,
+   0xD1CEEE69, 0xC4CEFFF0, 0x80D0438C, 0x68A72480,
+   0x88612852, 0xC3B630BB, 0xBBBBC9F1, 0x9E59D4A2,
+   0x5E623380, 0x1D00206A, 0xEDAA2566, 0xEC070EB6,
+   0x4FC83B5C, 0x1920EB51, 0x12C137BA, 0xB14C6524,
+   0xECE1B9E2, 0xBCE01A88, 0xE2376A2C, 0x6170CC7E,
+   0xE4421CDB, 0xFCB3ACE9, 0xF779F071, 0x661BE55D,
+   0x90FCC7F3, 0x35AD8DF0, 0x118E23AB, 0x8C5E7157,
+   0x94AB0923, 0x64177AC0, 0xAB86CB71, 0xC51C1B55,
+   0xDC64FB37, 0xB8DDCBE2, 0x4F8A7AEB, 0x93E610F6,
+   0xEB2E818E, 0x9C3F3915, 0xEC4C1B0E, 0xB3EC1798,
+   0x016B60C8, 0x30BB3E56, 0x85D86493, 0x71621235,
+   0x3D48B84C, 0x945065A7, 0x7B0556B0, 0x1B24C6F0,
+   0x932EB95C, 0x674B1D32, 0x70E31968, 0xD3D0C241,
+   0xEAAB5039, 0xE477E3C7, 0xBC5BBA9E, 0x423E291F,
+   0x81F78AA8, 0x3C2611C7, 0x15347E0F, 0x42653C66,
+   0x77FA6DF0, 0xC1FB8172, 0xFCC6EE27, 0xA3EA94FC,
+   0x0B98E2D0, 0xF5476122, 0x7CC60BEB, 0x628802B6,
+   0x48544D24, 0xD9B64193, 0x784F2515, 0xDBD0D2CC,
+   0xD3077676, 0xE85E4741, 0xBEAECACF, 0xB013082C,
+   0x2B1D0149, 0x2471BA97, 0x99221123, 0x83F21919,
+   0x1B48FED3, 0x3BFF9034, 0x5767BF55, 0x8AC7ED2A,
+   0x6DBC82E6, 0x90F45F6B, 0x59B452CC, 0xB0C3CAFD,
+   0x4D8C006B, 0x04AA4819, 0x80577B93, 0x5E8055D7,
+   0xC8468425, 0x198D862C, 0x9139CCB3, 0x0242E1F8,
+   0xE92A9075, 0xDA41DF85, 0xB809554D, 0xC70FF724,
+   0xD5EC3D47, 0xCE1A1DFF, 0x708A154D, 0xA7722BDD,
+   0xF0A02C83, 0x4FEC07F5, 0x2332888D, 0x31C52143,
+   0xEDE76CC3, 0x415D5337, 0xD6B34E5B, 0xDA1049F3,
+   0xDE3E8DCD, 0xD8B7A544, 0x3C981FA5, 0xBE7F4E6B,
+   0x29E6B597, 0x9F66151E, 0x379A5302, 0x8B4BD4AD,
+   0x96258B5D, 0x940CFB53, 0xDD1276B8, 0xF0C9FC3A,
+   0x78EE4A53, 0xE60B7628, 0x9836B926, 0xF52E1A27,
+   0x947FCD20, 0xB78BA34A, 0x39F2C44D, 0xEDDF32E1,
+   0x5FB8CE8C, 0x98AFD344, 0x1C606F24, 0x1A5C18C2,
+   0xFA90A3EE, 0x90B3A939, 0x00B0BDBD, 0x63C0678D,
+   0x9604EA64, 0xF408B6B8, 0xF6240BDC, 0x35DA1861,
+   0xBD3D4AE8, 0x36E64201, 0x3A4D3A28, 0x09AAC05B,
+   //Window 48
+   0xAA03BD53, 0xA628B09A, 0xA4F52D78, 0xBA065458,
+   0x4D10DDEA, 0xDB298789, 0x8A3E297D, 0xB42A31AF,
+   0x06421279, 0x40F7F9E7, 0x800119C4, 0xC19E0B4C,
+   0xE6C88C41, 0x822D0FC5, 0xE639D858, 0xAF68AA6D,
+   0x35F6EBF2, 0xC1C7CAD1, 0xE3567AF9, 0x577A30EA,
+   0x1F5B77F6, 0xE5A0191D, 0x0356B301, 0x16F3FDBF,
+   0x55DE60E2, 0xC6D13D90, 0x345523A8, 0x88525311,
+   0x72320EFE, 0x412788DE, 0x1E0922C4, 0x623BE109,
+   0x4CDF382A, 0xF820CA87, 0x6FABC337, 0x1A509EE2,
+   0x3DA53B9D, 0x2123B640, 0x7C7FA6FB, 0xADDED6EA,
+   0x1F77605F, 0x47CFB5B1, 0x581798B7, 0xAF3D0A9E,
+   0x0E0EFA1C, 0xB9484B48, 0x0BCCA1DC, 0x9A8D3D40,
+   0xF13D61F7, 0xC5405556, 0x3B5E93CB, 0xB2EC6221,
+   0x5D54EEF2, 0x99A04BBF, 0x2C6A2774, 0x5EC8010E,
+   0xD2F845CC, 0x738EB43D, 0xE8CC4419, 0x4A8217C8,
+   0x9026FBD5, 0x36570782, 0xA3A04352, 0xE2A5656C,
+   0xAA6EE304, 0x93A8FFA5, 0x13267B04, 0x7A68A8ED,
+   0x3EDA619D, 0x6C9FC6A5, 0xCBC98625, 0x91306DBD,
+   0x4F3BF0BB, 0x4EB8364D, 0x22F78E20, 0x2F7C46CD,
+   0xB5829B86, 0x00098538, 0x87750110, 0x0D57F75A,
+   0xD58E4B2D, 0x5FD943BD, 0xE7FE418C, 0xDDDE438A,
+   0xE6173C57, 0xEEE61463, 0x999ADD1F, 0xCF32925B,
+   0xA6F2DACD, 0x7088C49D, 0x84D64D33, 0x734ED3A6,
+   0x140F34F1, 0x0EFE506D, 0xD7917EA9, 0x87CE6A49,
+   0xDB6C1BE0, 0x5834D4F7, 0xE385BE74, 0x773174AD,
+   0xAF1B2721, 0x7341F958, 0x893A764B, 0xD9A47617,
+   0x15EF4658, 0xC94BE864, 0x588B5558, 0xD4AC6CA5,
+   0x604E818E, 0xA68932ED, 0xE40DD43D, 0x5649D764,
+   0xF4D87503, 0x64150312, 0x9EBFCCA7, 0x8605B303,
+   0x9FF51269, 0xD9AF8DB8, 0x3D21F15A, 0x99324D72,
+   0xA86B8E14, 0xD10CA702, 0x2E6AD902, 0x4646C257,
+   0x6D4775C7, 0x4E78C932, 0xB44DA1D6, 0xB20D327A,
+   0xAB5F0ADF, 0x283C8171, 0x8598EA1C, 0x3D19F7B6,
+   0xA55E2F41, 0xC6278782, 0x4087D5AE, 0x3498E52A,
+   0x5E1DBA66, 0x6C32EEF2, 0xCEDAD478, 0x3BCA0E58,
+   0x525A584B, 0xF66C491B, 0x861BF7AC, 0x3B584E20,
+   0x84BF0F5A, 0x5426C155, 0x035E69AB, 0xB905C03E,
+   0x81EE09AE, 0xEF469068, 0xF876E128, 0xD3BE245C,
+   0x8FB3A10A, 0x0C0C9577, 0xE78B4230, 0x0721E722,
+   0xD9F6804A, 0x89029149, 0x2ADB450E, 0x4E0DF12A,
+   0x6FDBCAA1, 0x57263B12, 0x7324AF40, 0x8F695866,
+   0x6F07DC61, 0xD37CCB7B, 0x792071BC, 0xB43425D7,
+   0x1912F701, 0xA6EFA42D, 0x28BE38F9, 0x74BBF4AE,
+   0x132D5B62, 0x04206E68, 0x322DBC55, 0xF78C1E3B,
+   0x57E772E9, 0x256C2ECE, 0x68956272, 0x57AA537D,
+   0x026E09D0, 0x6958FD4E, 0xAADD2BAA, 0x86B1E009,
+   0x358784C9, 0x83B1D3B1, 0xE72880C7, 0x978C9578,
+   0x0C6BE476, 0x6EBC3F9E, 0xED42E982, 0xFD99D661,
+   //Window 49
+   0xBC7C0795, 0xCC794D81, 0xBB66B55D, 0x3EF70872,
+   0x04FF152B, 0xD7B9E340, 0x87164FE9, 0x16543CED,
+   0x871A332F, 0x96880DFC, 0xA9E60062, 0x96B2EECB,
+   0xD3EB1CCA, 0x8F80A433, 0x0BBAC091, 0x27A8E3FD,
+   0xA8EC664E, 0x738590EE, 0xB2CB7D0E, 0xAA3DD92D,
+   0x37EA27C4, 0x76C846CF, 0x87B431ED, 0xB9FB524A,
+   0x7564BA48, 0x339861E5, 0xE94CE8D5, 0x77FD220E,
+   0x720C83C5, 0xF842C133, 0xB0727F8A, 0xE30C6064,
+   0x604FDF05, 0x3C3E3478, 0x97B767CC, 0x3A21B95A,
+   0x17C40543, 0x314C8614, 0xAFE419D7, 0x1D5A66D1,
+   0x33B893C7, 0x467EE9E1, 0x323A2A0E, 0xCB7C1ADA,
+   0xED15DBDE, 0xBADD6515, 0x24D1E6AE, 0xA851EA6F,
+   0x9C93ADE0, 0x3E556BDF, 0x0F97AEB5, 0xF8092081,
+   0x329DC851, 0xCADAF59B, 0xFD979888, 0x8F2C675A,
+   0xF7D6F0E9, 0x9F76C6F4, 0x6EA2E0DF, 0x047D48BF,
+   0x813EAC91, 0xA63E8A56, 0xA455F355, 0x73470AB4,
+   0xF7294B66, 0xE1910D72, 0x4DDDA7F0, 0xE89FE34A,
+   0xDB43C333, 0x6641FF1E, 0x8061E437, 0x000147AC,
+   0x56048CD6, 0x1DD3F221, 0x76988A0F, 0xE5F8F32D,
+   0xB20A073F, 0x176D3182, 0x359639D6, 0xD4CBAADE,
+   0x67561620, 0x2F75709A, 0xBB1E8940, 0x4E9D52EC,
+   0x050B91A5, 0x808DC806, 0x80551595, 0xC3986F2D,
+   0x36668222, 0xE8A6DE3A, 0xC984961E, 0x9EEA0BAA,
+   0xF6D44D6D, 0x8AC56CCB, 0x2702D6FE, 0xF81AB803,
+   0xA4DCD044, 0xF7ADF935, 0xBB054A56, 0x45103B00,
+   0x1CFDE580, 0x59DE339F, 0x9C1A4134, 0x20E94F22,
+   0xEC40215A, 0x2DDB8175, 0x4ADA9D34, 0xF3EECC78,
+   0x2A68C6F0, 0xF614199E, 0x3224705C, 0xA34476AD,
+   0x3B3AFC11, 0xC4BE9219, 0x337D4DB8, 0x732EDA5C,
+   0x03D835BE, 0x2E230468, 0x684A9F2D, 0xC1B08C84,
+   0xDA9E1F4D, 0x47EC431D, 0x887255D4, 0xAA62BFE7,
+   0xF058D145, 0x7C51492F, 0xF14AD776, 0xE78B6C32,
+   0x1A6BEF65, 0x5794A49C, 0x537CFF7D, 0x1B9CE4E2,
+   0x7C5A85AB, 0xD6A5E7BD, 0xDA3445E3, 0x2FDB04C3,
+   0x341D1DF1, 0x484CA064, 0x074455E6, 0xFE8569D4,
+   0x230E2478, 0x72CCBE56, 0x98DFEE0D, 0x8907DCA0,
+   0x10AEB978, 0x4D07929F, 0x0E10176D, 0xF699F55A,
+   0x8B6E78D5, 0xAA2F76E7, 0x0CA43003, 0x7105A1CC,
+   0xB84D6E3F, 0x47759B95, 0x25084F30, 0x7239F640,
+   0x2829E3D4, 0x374F6B6C, 0xD5FCD466, 0x96781469,
+   0xC85FACAD, 0xB3B64E4D, 0xC02A1604, 0x4AA8382F,
+   0xA6CD15E6, 0x6A0031CF, 0x6D7918D7, 0xDD406E70,
+   0x08F51315, 0x6878397B, 0xD49554CA, 0xB56FA908,
+   0x834E48EB, 0x44011C8B, 0x98F5E55F, 0x0E71A070,
+   0x971A430F, 0x1D2E2A99, 0x0E41C5B1, 0xC25FBE61,
+   0x9E437693, 0xC79972D2, 0x2DD403C5, 0x8C972B14,
+   0x56EA5990, 0x49FFC359, 0xD5EC71A8, 0x16552D6D,
+   0x8AC97BCE, 0xE5D18753, 0xE32E1A2F, 0x187EBDEC,
+   //Window 50
+   0x6C91AD26, 0x794A459A, 0x371DA833, 0x6B258CA2,
+   0x3933F3E9, 0x9EF81528, 0x0DF0FAFE, 0x49BAF296,
+   0x01F2318D, 0xF9BC786C, 0x127F8C4F, 0x3DC56A32,
+   0x50C23814, 0x329B33E9, 0x468E6A05, 0xA42F9DDE,
+   0xD1B32A37, 0x28C3A32C, 0xC8ACAF24, 0x2103C6A0,
+   0x43B2CBDC, 0x9A7EAF32, 0xCFC82F75, 0xEA9EC23D,
+   0x26AEF425, 0xB04416CB, 0x19C5A0C4, 0x122A70D3,
+   0xA552CA6D, 0x3FCBAAED, 0xA776D0DB, 0xFE5F0B3F,
+   0x7D8FF2C2, 0x04DEDCB6, 0x6B1AC5DE, 0x5431FA78,
+   0x084A5248, 0x332161BC, 0x18E9E4F9, 0x495BF99E,
+   0x67923CCF, 0x705D5304, 0xD18032F1, 0xB70495B7,
+   0x43B49B07, 0x4D5D931C, 0xCB029582, 0xF0313E1C,
+   0x49F7893F, 0x2AE2F310, 0x316B307A, 0x5A67FE7F,
+   0xF823A157, 0x7F9F7F1D, 0x4C7BC0B9, 0x1B744AE5,
+   0x69C3C423, 0xCAA45A86, 0xC9CACA01, 0xB403F894,
+   0x5D3A32F8, 0x7CA10195, 0x6490AC02, 0x864DF030,
+   0xA265CD63, 0x6C7CD2E7, 0xAB817F67, 0x09367C96,
+   0x8702A2EE, 0xDDF94885, 0xF880249F, 0xE42B16F1,
+   0xAB8B5B1E, 0xEB6C5F9B, 0xCA9DA950, 0x8FEFF018,
+   0xB92F9FEB, 0x5C95FC7E, 0x5911192C, 0xDB98ADB3,
+   0x6101CBCE, 0x7B46CD2C, 0xF618AB7D, 0x24334C46,
+   0xF4CD6FEF, 0x7BEF7D4D, 0xB355C4DB, 0x7B8DEE5D,
+   0x2AF979D8, 0xA0A64E37, 0xC4F23846, 0x44A955DD,
+   0x38940778, 0xE18A2950, 0x955EF722, 0x76D458A5,
+   0x4B0A79F3, 0xD46A64C0, 0x86681C3A, 0x8B2CD6DB,
+   0x3428F01E, 0x2433D5DE, 0xBA37B239, 0x750B279C,
+   0xC1CD75E6, 0x95B7D4CC, 0x77F33A3F, 0xF478E653,
+   0xF7374AB1, 0x2DE3DB02, 0xD9182E64, 0x11D41E9D,
+   0xB614A076, 0x278D648D, 0x24A4DEC3, 0xAF2CFDEA,
+   0xED57AFE4, 0xCEE7DBD4, 0x5EC43704, 0xAE1569C9,
+   0xDB07A28A, 0x99B41EEA, 0xF9EA3715, 0xCA1FF56C,
+   0x73A7CB0A, 0x0AED5B56, 0x6481E45E, 0xC72FF629,
+   0xAB6E144F, 0xA79B2407, 0x9BAF9ED1, 0x23E884CF,
+   0x8A2DE0AF, 0xA4399B7A, 0xB45A7527, 0xF6FC89EB,
+   0x54D6720E, 0xEFCAF97F, 0x61FB94F2, 0x305814FA,
+   0xB1F2C80B, 0x6931A9BB, 0xB3795CFC, 0x42A01723,
+   0x911AA294, 0xCDB0F241, 0xB7F12B72, 0x42725078,
+   0xAC66E784, 0xA384D14E, 0x7FB6624E, 0x04227DD8,
+   0x00D6F359, 0x0818DB0F, 0x385851FD, 0xAF4D4F4A,
+   0x35A166D8, 0xA893B168, 0x8FF16A67, 0x400CDE94,
+   0x41447FBB, 0xCB96B2EB, 0xA31B0ABE, 0x49845025,
+   0xB32BFB92, 0x100F5A86, 0x4B0874E8, 0x69168224,
+   0x6AA42DB2, 0xF9D82A4B, 0x96662B67, 0xAAD8C2D6,
+   0xCC6B4D31, 0x01DAE32E, 0x0E152E0B, 0xE362E546,
+   0xF7B83F76, 0xDF322C97, 0xC4F1CBE9, 0x10C78D33,
+   0x2232293C, 0x3B90A6BD, 0xF2EF2546, 0xD9597EA7,
+   0x07E5EB8F, 0x4414C790, 0x3BAFABCF, 0xCEB27F7A,
+   0x655FAF8F, 0x5E593589, 0x8F953A81, 0x2D37F1EA,
+   //Window 51
+   0x1B635020, 0xF68A33E6, 0x1C6E73DA, 0x66E39E7B,
+   0x2D8D8378, 0x18B1C2E0, 0xD51ABD7C, 0x14B81ED8,
+   0x400435FA, 0x1940113C, 0x462109A0, 0xC57F7195,
+   0x279CAC7C, 0x7EC34DA2, 0x1B8EC400, 0x1ABEA785,
+   0xEEEEBA47, 0x25F6A9B4, 0xD21EDA2A, 0x7379EAC9,
+   0x9AF2E50D, 0x08402D5A, 0xC0B5ABD9, 0xD1137EA3,
+   0xF519E99D, 0x6B30248D, 0xEEA70A59, 0xB0496D6A,
+   0x7D87CF86, 0xBEE852B0, 0xC45135AC, 0x8A07FB8F,
+   0xF6C6C2F3, 0xF2A7B114, 0xC67222A4, 0x40576504,
+   0x79EFE7E6, 0x9EFF9A52, 0xE5138D19, 0xF452F675,
+   0xF9161158, 0x9FC54360, 0x925089AF, 0xCD82A594,
+   0x03F27A94, 0xD7EB5E34, 0x953D5AA9, 0x6098E471,
+   0x67CC55AF, 0xC5C187E5, 0x13E8B878, 0xA5497759,
+   0x65E0D737, 0x366109FF, 0x083CE171, 0x3C497ADA,
+   0x6D974AC0, 0xD2394F0F, 0x4E6B9886, 0xC280890C,
+   0xB906A29F, 0x9E83356F, 0x45B04D3C, 0x430CCF23,
+   0xA788384B, 0x67C472B8, 0x4D4E836C, 0x0B09496E,
+   0x07409CFC, 0x9B4FB8E5, 0x81F399D8, 0x171E32B9,
+   0x3D54BCB8, 0x6EDFED0F, 0x8B2AE30C, 0x89FE565E,
+   0x1856E7CD, 0x12AE6A00, 0xDD92AAE6, 0x006D223A,
+   0x3B80EB45, 0x6F519B17, 0xA7062B1A, 0xA50A8BB4,
+   0x5FC20DE8, 0x7E53DD5C, 0x2805DCBC, 0x442304F6,
+   0xBB68490E, 0xB02D647F, 0x09DCD1B4, 0x21F31D27,
+   0x3E70785C, 0x0ED12C99, 0x85F1EBB8, 0xE6B4E18A,
+   0x40C36F04, 0xDAB54B7C, 0x2C79E7CB, 0xDDFF762B,
+   0xF7ED2EE0, 0xA41241C6, 0x150E9496, 0x75D149A7,
+   0xC18208D7, 0x1F9FF54C, 0x5C36DD73, 0x7055D177,
+   0x84255521, 0x02FF33DB, 0x5B96D570, 0x3659A6E6,
+   0x8E65711C, 0xDA43184E, 0xD0ABF46E, 0x42519D70,
+   0xC646098F, 0x9A4D287B, 0x10D2C373, 0x7D870347,
+   0xAE72C0EA, 0x49A730DE, 0x140EBB19, 0x4F103EF2,
+   0x852019E1, 0xE50432CE, 0xEDFDFA7F, 0x7C653D77,
+   0x2F85A007, 0xC08075C1, 0xCD349BB0, 0x03755A4B,
+   0x16D71AE7, 0xF022E224, 0xAB220DE1, 0xE879FEF9,
+   0x9BE98243, 0x962A2952, 0x1B55D0D6, 0xF38013BF,
+   0x5ED5E784, 0x8CE0D9C5, 0xC3B385B0, 0xCD36DF94,
+   0xBFCEE499, 0xD65B6D26, 0xDAB1DCEB, 0xCCD0AB92,
+   0x94ECBE4A, 0xBCDBECD4, 0x98C886E4, 0xE38D3C34,
+   0xFD0F88A9, 0x2B322B8F, 0x77CED35F, 0x59576F28,
+   0x71787954, 0x3B16AA67, 0xC64347DE, 0xE0EF719D,
+   0x0ABD7B59, 0xFEED35C9, 0x95E046B2, 0xEA4695CC,
+   0x45CD76DE, 0x4634F4BB, 0x030A0378, 0x2D602F16,
+   0x49F68A07, 0x29E5E39F, 0x777D47CF, 0x7C3581EC,
+   0x3670D228, 0x683DF554, 0x1D649A47, 0x107C7606,
+   0x1C962584, 0x60CEBBBB, 0x0B70217C, 0x7D83EFB8,
+   0xC8755D18, 0x0546532E, 0x5EEB41CB, 0x87387D07,
+   0xC148DEA4, 0xE6BCD22F, 0x0B36ADA8, 0xDB7CC58A,
+   0x66D8F981, 0xC635BDAE, 0x52DD8711, 0x3106C84E,
+   //Window 52
+   0xB6CA9DA5, 0x173D9554, 0x3B066F62, 0xA2BE12AB,
+   0x26A92FEF, 0x2746E101, 0xEB642CB1, 0xF85098A6,
+   0xEC50AC0D, 0x07951FFE, 0x40E8D694, 0x821C76BB,
+   0x11836D15, 0x9529388E, 0x756B176C, 0x316E074C,
+   0x0984CA6D, 0x2BA847F8, 0xE78C0CF1, 0xB1E2D2CE,
+   0x3A4E10DB, 0x51D03996, 0x9E40A86C, 0x4DBF6D73,
+   0x7F2F67FD, 0xC88DAAEA, 0xEB792D03, 0x7C2FE14C,
+   0x68762A40, 0x75985C11, 0x0F3F2CC3, 0x103CB5CE,
+   0xEC2BE5FA, 0xAED1EC52, 0x5ABA50F7, 0x87539B60,
+   0x295F9058, 0x6EFE252A, 0x6474C180, 0x5773D258,
+   0xD681F491, 0x5ED66AC4, 0xF39EFBFE, 0x6584D02B,
+   0x4319D2E0, 0x7D4C43E5, 0x606E321F, 0xE6525A0B,
+   0x60F2571E, 0x19C3070D, 0xC3166C51, 0xB3CB5354,
+   0xF7748EFA, 0x2D970634, 0x7C0E0877, 0x57D99B13,
+   0x47B2A16E, 0x80F4E25E, 0xB4E19AB9, 0x0B4EF8DC,
+   0x0BC18432, 0x42691EA0, 0xDC93256A, 0x5D698FFA,
+   0xA42961E9, 0x15834007, 0x1539C28A, 0xDDA8B92C,
+   0xA4C08E80, 0xF996CBC4, 0x025EB32B, 0xE730CDF0,
+   0xFC693E4F, 0xC4B9C598, 0x4DAE7EB6, 0xCC568F46,
+   0x658BAEF0, 0xBDA6E910, 0x56AD8FD6, 0x1FBC679A,
+   0x25ACC864, 0x2A0C3F0B, 0xCC5F178F, 0x3982177C,
+   0x4AF85802, 0xFA43C668, 0x3603160A, 0x18E9DA8C,
+   0xD1AB7E75, 0x5CC69020, 0xE9D1F063, 0x25C4F035,
+   0xFB587129, 0x1975D071, 0x2DB10D70, 0xC075C072,
+   0xEC0465D1, 0x1EBBED3F, 0x5D165AB9, 0x00ACF20F,
+   0x48B713C7, 0xF11F11AA, 0xC89597BE, 0xBE9BDB9E,
+   0x2AE5D003, 0x93BD9F34, 0xCD03C0A6, 0xBA9537E0,
+   0x485FDD8A, 0x1CAB00FC, 0x0ABED1F0, 0xA7771471,
+   0x2B7C6B36, 0x595D05FC, 0x1E77DFB5, 0x63DC9A54,
+   0x08CCD8BE, 0xE71A0888, 0x3F5F8E72, 0xDC71E85B,
+   0x6D8203FA, 0xEA91DE76, 0x3E6ECA85, 0x19380421,
+   0x573DEECE, 0x66AC3FDD, 0xE1FD1805, 0xE713052F,
+   0xCEDFEE68, 0xF185BCB6, 0x8002A718, 0x13E9D8EC,
+   0xDB6B8DE0, 0x46368EF6, 0xF013E0FF, 0x356E911C,
+   0xF5E99129, 0x0D9C4136, 0xF37AACC5, 0x4C5507F9,
+   0xB3F5552B, 0xA03E0C67, 0x5E16B82E, 0xE691D0DA,
+   0x6626A968, 0x5458078A, 0x1861945A, 0xE638479A,
+   0xB81736EC, 0x4120E5E7, 0x9F45118E, 0x6430D9A0,
+   0x4175FC65, 0x41249E7B, 0x06EC6E23, 0x8C1C41B0,
+   0xFDFDD03B, 0xED856E09, 0x46630C1C, 0xE9B9D569,
+   0x072E49E1, 0xAFE669D6, 0x89D1A063, 0x0167B1C5,
+   0xBDB34759, 0x2D77CCE0, 0xCEAB127E, 0x0FD921A0,
+   0xFDD6EB78, 0x2C106AA5, 0x70BA5D96, 0x0D45D33D,
+   0xBF840452, 0x1E2F30CF, 0x218AF3AC, 0x1AAA090D,
+   0x2B47D7F2, 0x76FC1DF0, 0xF358F89A, 0xEE8CB576,
+   0x4B3C94E1, 0x3E60B1DA, 0xE53C7944, 0x1AE1B9A5,
+   0x7F2B0B90, 0xBE4C8D55, 0x6FB7D80A, 0x00E8D080,
+   0x30C0BB4B, 0xF8683946, 0xC6C9B4A8, 0x0B5E3246,
+   //Window 53
+   0xA22FD201, 0x0EE2798D, 0x496A4E52, 0xCF4E3A5F,
+   0x01887409, 0xCB78360E, 0x90F1C750, 0xD72E7D27,
+   0xFC01B123, 0x6D9135FA, 0x04727DC6, 0xD7A0AAFA,
+   0x28997D31, 0x3EAF4DC3, 0xB212CD3A, 0x5D3BFCA7,
+   0xA1F86B49, 0xA41158D2, 0x98ED293F, 0x9AA1AD64,
+   0xF1808DB6, 0x76940E40, 0xA1DD0752, 0xE3BFDEBA,
+   0x8232343E, 0x523E9255, 0x8F4C4D39, 0xEDEE2BD9,
+   0x83E94A44, 0xDD2DE704, 0xD7C6B2EC, 0x64C8E33B,
+   0x364170F7, 0x1F486411, 0xCE872FFA, 0x7C93116C,
+   0x618557C9, 0x177EF239, 0x65BFE6E0, 0x1909912C,
+   0x996EA203, 0x318E5C80, 0xFE63AED2, 0x6F58963B,
+   0xFE0A7CA2, 0x0B92997C, 0x11065EE5, 0xDA249872,
+   0x3868D9D1, 0x18BAD352, 0xCD1D0951, 0x109A3D6F,
+   0x80F1DE63, 0x1CEB880D, 0x8F145579, 0x5772259A,
+   0x0D32CFB5, 0x11E4A4E5, 0xEC1D3CE5, 0x2C6B73FB,
+   0xCB4BD14E, 0xF477C993, 0xB0E29586, 0x8729E277,
+   0xD3FB25AD, 0x4038BF0E, 0x25891808, 0xE0EE0D01,
+   0xB5312306, 0x658BFEE5, 0xC54BBD53, 0x8400E52F,
+   0x207F2B71, 0xD1AD1D62, 0x6C15194D, 0x793BDC24,
+   0x7554B344, 0x4B56F17A, 0xEA272B85, 0x7EE13E86,
+   0x72C7135F, 0xB7E3ABD5, 0x3C7F3125, 0xF0D96815,
+   0x7613B8A3, 0x3C58C983, 0xF879E7A6, 0x6A7DB396,
+   0x5F892951, 0x9F9B052A, 0xEA3CD23D, 0xADD3F804,
+   0x92754AB8, 0x770E2814, 0x8D87B4A4, 0x74AC9607,
+   0xDAD5B83D, 0xB2B6B921, 0x5AAF27E7, 0x1CE95CAA,
+   0x8ADA0091, 0x40A73D71, 0x476BEA30, 0x3E383CD3,
+   0x7ED85701, 0xB5F05951, 0x48A030DE, 0xD79CB86F,
+   0xC110139A, 0x53CBC8EC, 0xC26F8BCE, 0x266D79BB,
+   0xD07CD7C2, 0xA95E0602, 0x0D088227, 0x0FDB2CC5,
+   0x1EE4F25C, 0x00E07B0F, 0x1C9F83CA, 0x88F68471,
+   0xA72C82FD, 0xC893EE1D, 0x79F9DA28, 0x462E52E2,
+   0xD726A903, 0x03345763, 0x6EA93F39, 0x4023DB91,
+   0x05DEF36D, 0x839E6628, 0xC4C1170C, 0xEFBB8BFA,
+   0xD49273A7, 0xF613FDA7, 0x0E94F87F, 0x3FC4FF46,
+   0x66C1297D, 0x18E7962C, 0xAD7D5989, 0x3723C298,
+   0x2F609960, 0xF011E116, 0x077F593C, 0xDAD34878,
+   0x41CD0E0A, 0xFF2EBFA6, 0x3EFC609B, 0x99BB1524,
+   0xC5D639DC, 0x7764664C, 0xCE4A882F, 0x9A162627,
+   0xC328BF9A, 0x9DE8036D, 0xF9CED264, 0x5DD89B16,
+   0x61AE458C, 0xF42EFB69, 0x0205CB57, 0x4C18B22B,
+   0x963A1BFA, 0xF3CE7681, 0x763BD76C, 0x5254CC70,
+   0x9A6B5744, 0xD5019F68, 0x9507723A, 0x53AC0363,
+   0x5917E720, 0xD344E81E, 0x91F6B305, 0xECE422CA,
+   0x4BFED2A6, 0xAA14684F, 0x06227005, 0xAAEDC507,
+   0xB7242468, 0xC348C684, 0x171229AE, 0xE564E3F8,
+   0x69B4B512, 0x1FAB5AA8, 0xB75B30EA, 0x03E708BA,
+   0xDF97D7F0, 0x661EE611, 0x968AFF10, 0xDD2D5655,
+   0x2076470D, 0xB1CBA5AB, 0x965401DD, 0x4342E6F9,
+   //Window 54
+   0xEA22E778, 0x0139BABF, 0xDF3CF2E1, 0xEC6284AC,
+   0x04C9E381, 0x802E7ED8, 0x9E1E75CA, 0xEFB3591A,
+   0xCD470675, 0xD2F9C128, 0x5BC0B5B5, 0xF59328C8,
+   0x18AAC609, 0x70D17B7A, 0x050839CF, 0xE4C16B59,
+   0x7438E95E, 0xD51D3E0C, 0x8DCDF8E3, 0x682CD98A,
+   0x2592AB4E, 0xCA1499C8, 0x825613AA, 0x850A3C8A,
+   0xC82A5064, 0xE95BEC53, 0x47D7DE0D, 0xA1A0F0BB,
+   0x1F092A1A, 0xAF46A965, 0xFE229351, 0x1511FCCE,
+   0xF9BBCE99, 0x696F7B54, 0x9E929F7E, 0x1F93132C,
+   0x09DA9B11, 0xAEA2A304, 0x9F045216, 0x0B85FE12,
+   0xF4FD49AB, 0x04CD2903, 0x11AD43C2, 0xAB4C6B26,
+   0xE6F2AE29, 0x2C4DA27E, 0x692B593A, 0xFE450AD5,
+   0xD1CFD954, 0x095B3004, 0xD4AC3371, 0x852CE3A3,
+   0xB6172D1C, 0x32E3D541, 0x14DE64D4, 0x91858FE2,
+   0xB98629F7, 0xBEA80480, 0xA504074F, 0xA801024F,
+   0x7276FF83, 0xC07768E4, 0xE635893F, 0xCC76AE33,
+   0x1F82EA28, 0x23819494, 0x2DF3A8E9, 0x9D795CAA,
+   0xE024DC7E, 0xE3B47BF9, 0x0C8CBE83, 0x07488C4D,
+   0x658AAAB9, 0xB3F42330, 0xFAAF6291, 0xCC2A615D,
+   0x29F2B69C, 0x8899238E, 0x8690B03E, 0x6E5053A8,
+   0x90A5922A, 0xDE421A6B, 0x47059BCC, 0xE628B590,
+   0xF032AE22, 0x4AA2DF22, 0x3A14327C, 0x70517D62,
+   0xAD09CD1C, 0x2AD11F37, 0x44953E05, 0x06FCD087,
+   0x23B9E4F4, 0x7B9ED85B, 0x0BBC7CB5, 0xA00CFA26,
+   0xEA7ED696, 0x750A9E74, 0x69AFB231, 0x96F2A88B,
+   0xF916520B, 0xC9ACB1DA, 0x099B3C2D, 0x5934722F,
+   0x4342D893, 0x5EDA8859, 0x9F773FE7, 0xBD486C9B,
+   0xCA2A1E36, 0xA12C3D77, 0xED6C11F1, 0xD385BB81,
+   0x5210C683, 0x6C39EECD, 0x81A7BBA9, 0xA9FE2A23,
+   0x211700B5, 0xAA27AB5E, 0x352AFFAB, 0x9EC6B7ED,
+   0xC6E0E952, 0x272E3431, 0xCEBC456D, 0xCD6AA5F7,
+   0xDF6230B8, 0xE0EE038D, 0x916B8050, 0x96305C38,
+   0xCA4EB7B2, 0x703909D3, 0x55B60B3E, 0xD4656C07,
+   0x989571CE, 0xAB9DAFE2, 0x5D0988EA, 0x6324FE37,
+   0x02A45412, 0xBF6751C9, 0x1ECEE33A, 0x8B327449,
+   0x53256475, 0x164D24BB, 0xE373D71F, 0x3D7B796A,
+   0xCD76FCFF, 0x86C3C873, 0x944F5519, 0x0433BFF7,
+   0xD4407E7D, 0x36E65089, 0x0AF822C9, 0x369AE554,
+   0x0491479A, 0xD783A5F0, 0x7D6E28FC, 0x6579BCA7,
+   0xF1468BFF, 0x97C7614E, 0xB35E84FB, 0x3FAC844B,
+   0xAB654140, 0x94538AE1, 0x369FC424, 0x50F3343A,
+   0xD4CC2E2C, 0x699150AF, 0x8DA96061, 0x80F2AB86,
+   0x40B8A5DA, 0xBCB1DE22, 0xD46A785E, 0xEB8719A8,
+   0x61C823BA, 0xC168CAC9, 0xC7B5D470, 0x5A4F3844,
+   0xC1839F2C, 0xF6C62A13, 0x2C81F513, 0x07CDC60E,
+   0x59E1621D, 0xE8C08EDD, 0xE5AFDAC6, 0x08B6B471,
+   0x51464838, 0xBE159F25, 0x4F21F1F4, 0xB8F2FF30,
+   0x6A633A64, 0x4CF85F20, 0xB197E991, 0xD04A385F,
+   //Window 55
+   0xD81E43B0, 0x3F8229A8, 0x558BD431, 0xF9C58ABD,
+   0xA1EA026A, 0x318C2BDF, 0x425E7020, 0x058EA1E6,
+   0xD4CA4CE0, 0xC6E7B862, 0x16E36B9D, 0x95B1FA9E,
+   0xE2CBFA44, 0x4B5115E0, 0x5914F4C2, 0x11D4EFAA,
+   0x94C0CFDE, 0x2BE2ACF4, 0x97015DA2, 0xF8032336,
+   0x0ABCCB66, 0x3D0BCB89, 0x75D1FD36, 0x2A257889,
+   0x8B5324DF, 0x5753D7CE, 0xB4D4361A, 0xD31F18B1,
+   0x3CECC6AD, 0xC761BF6C, 0x8CE2F356, 0xDE049136,
+   0x33A01E76, 0x8D3D0358, 0x42BD884D, 0x0B838105,
+   0x5E5A3F9C, 0xF9D3A5D8, 0xBB7E546A, 0xC189DCE9,
+   0x0EC9829A, 0x6B6D4775, 0x9ADCFE25, 0x93CFEAAB,
+   0x663AD1DD, 0x26169B05, 0x3E358727, 0x90678064,
+   0xC8D698C7, 0x2D0A33A1, 0x1CBBB9C6, 0x0EEA43D4,
+   0x7DB11B7E, 0x29FCEF03, 0xAFB6E42E, 0x27BDE1CB,
+   0x5D6831FF, 0x6927300C, 0x97FB8470, 0xEB4EE9B3,
+   0x5A2CE6C8, 0xD8B7318A, 0x6AC7BDD7, 0xE1228CA1,
+   0x27DE0A0F, 0x08A1F795, 0x6EF2A2CB, 0x72F308E7,
+   0xAAAEDE47, 0x250FF4E5, 0xC9168684, 0xFF92EEC7,
+   0xBC59FE30, 0xF5349BBD, 0x53DF3E30, 0x970009BA,
+   0xC319C636, 0xDF3F55FA, 0xD3D5D20D, 0x29F821D0,
+   0xD4A6C910, 0xBE87350C, 0x67D57A73, 0xCE04C645,
+   0xA143AA6A, 0x668A6522, 0x07DFF96E, 0x13C515E8,
+   0x8D171E92, 0xE452F37D, 0x53B10BED, 0xEFECBC97,
+   0x2F14FB1B, 0x3432BB99, 0x253E7262, 0xADC06C98,
+   0xB80E6CCE, 0xE4806B62, 0x1351D329, 0xAB759F62,
+   0x7C16AD6F, 0xA42DA21C, 0x17014896, 0xD732238B,
+   0xA0FA3969, 0x6224EA6E, 0x8F0BFF6F, 0x25E7478C,
+   0xEC96A15E, 0xE5BC2520, 0x9BE005B0, 0x646F452D,
+   0xEE94D389, 0x6A65445A, 0x887BB88C, 0x6C2AF981,
+   0xC3C206F4, 0xF62A9BA4, 0x4DF7860A, 0x916C1D71,
+   0x71CDC8DA, 0xCF0D90CF, 0x39BB3042, 0x6D92D973,
+   0x9D4EF4F3, 0x53499F5F, 0xD0BCD8AB, 0x90D04CA9,
+   0x9F7B9F58, 0x86522129, 0x440D3D1A, 0x5F8054FA,
+   0x6969AD8E, 0xE79A5C24, 0xC1B84C0A, 0xEC0F3B02,
+   0x8C6B5ADA, 0x954851A9, 0x610EEFC3, 0x63718946,
+   0xC010252A, 0x11E5E094, 0x6AAAAEE1, 0xE5A96133,
+   0xFAA91151, 0x16DF9833, 0xDCE117C8, 0x38609BF3,
+   0xB37EFAA3, 0x12A1D651, 0x0A6F39AB, 0x1A9B8031,
+   0xB66B50E6, 0x298BF050, 0x6CB53931, 0x1215054C,
+   0xF13B7F76, 0xA8BA5CB9, 0xEB08031C, 0x4E6D06E9,
+   0xC13E1A41, 0xF191A94C, 0x0F7E956F, 0x0DCEB47B,
+   0x593762E9, 0x664FECAD, 0x882464C2, 0xAA5143F6,
+   0xAF6A129E, 0xE353A753, 0x78FACA8D, 0x4E708952,
+   0xED6999F7, 0xC28BE198, 0xA74823E5, 0xCAB8C24F,
+   0x6822AB16, 0x0BE92DBD, 0xDD93161B, 0xB6E50115,
+   0xA7137F30, 0x7D1A3446, 0x03F09451, 0xE4432BA7,
+   0xA40CE2AD, 0xB814935B, 0x2A87718D, 0x57494891,
+   0x0DF2A88B, 0x404E1703, 0xA12A2E91, 0x55E072C2,
+   //Window 56
+   0xC690CCC6, 0x61F040BE, 0x51F9E5B6, 0xAA51CD7B,
+   0x81156ECF, 0x29242BDE, 0x8C3782B8, 0x31E3D90A,
+   0xE589FF8B, 0x2F1F10D1, 0x848B8E4E, 0x64247C77,
+   0x87E2519F, 0x4004D2F2, 0x331A0E13, 0xB1CDEAA6,
+   0x6E22DB4B, 0x05DFC199, 0xBF734568, 0xE05E0653,
+   0xFBC4CD34, 0x93664F3B, 0xE179A680, 0xC3B58CDE,
+   0xC3B3F614, 0xED604529, 0x931A1889, 0x26523DF2,
+   0x9A7564A7, 0x5294A84E, 0x74A9DF54, 0x38D0B1FD,
+   0x1BF2A516, 0x859427D2, 0xFB881189, 0x5FC7DDC5,
+   0x3D225E23, 0xF6D2BB3A, 0xB2C1DDC0, 0x8013D279,
+   0x76DC9654, 0xABAD4047, 0x4A0BC971, 0xE3E0AC07,
+   0x99A6D41C, 0x4398F6D2, 0xC1220650, 0x056B6152,
+   0xB037597D, 0xAA1392C0, 0x9F488FAD, 0x9A0DF6A7,
+   0x05EB0372, 0xF46386C8, 0x854656E9, 0x9501384F,
+   0xF932931B, 0x7C7DAB9F, 0xE1DDE558, 0x8A695B6F,
+   0x45DFC120, 0x300B3410, 0x897D708A, 0xDD1C5D1E,
+   0x341F5B38, 0x873958CE, 0x4F082A61, 0x6D71B209,
+   0xBB70840E, 0x26B203A0, 0x63D7C48E, 0x770D7A79,
+   0x639D8C12, 0x934E134B, 0x5C50C703, 0x88F3C803,
+   0x6B400D86, 0x58D2D6BD, 0xD23C37D7, 0x56D4A42C,
+   0x34E1E864, 0xE1B94EDF, 0x54D68835, 0xAE3BAAAA,
+   0xAAA95062, 0xD182449A, 0xADF90634, 0xB17C79B3,
+   0xBA5AAD60, 0x745E0746, 0x6313F071, 0x6FA52BFD,
+   0xF23020BF, 0x626213D3, 0x83527B95, 0x781D73FB,
+   0xEA2E27D0, 0x056BE3F7, 0xD11548F1, 0xD3420DE5,
+   0x5A40A136, 0xFDE7DB05, 0x8AB15252, 0xE8DE42E8,
+   0xF0FEFA7E, 0xF94233A7, 0x86C86DAE, 0x1D5DA10D,
+   0x49D33E02, 0x4ABCA0E1, 0x6C2EF9CE, 0x0FB843C8,
+   0xE9CBEF42, 0x1E8896D2, 0x8D3F00FE, 0x4D1CC637,
+   0xA4D9C7B9, 0x449FFF66, 0x363EE563, 0xC3678177,
+   0xC3AE7CFB, 0x90DF1C81, 0xBB9A04DD, 0x25EFFC42,
+   0x26A9B8A2, 0x8E607AE2, 0xE393DAE2, 0x637C7D68,
+   0x645D3AE4, 0x23141D4C, 0xBC38E74A, 0x8FE3E1B1,
+   0xE1DB521A, 0x60A5E825, 0x7DAF4F5D, 0x10E223E4,
+   0xC76FE09C, 0x9AF8E783, 0xAA5C2200, 0x6C36E3E9,
+   0xD2B71913, 0xDAE7648D, 0x7FAA8088, 0xE064E761,
+   0x2BFDEDBF, 0x72F06CC4, 0xB0029C81, 0x5D60B902,
+   0xF9D9DBFB, 0x107D098A, 0x311E5AEC, 0x6FE7A0E5,
+   0x2D7132FC, 0x4E6460DE, 0xFA5041DC, 0x632420F8,
+   0x63EC6739, 0x88F994E8, 0x723F7C26, 0x9E18548B,
+   0xDC049D49, 0x6BB345EE, 0x96279B13, 0x82C6688C,
+   0xC20EDD2C, 0x3D3AFE9A, 0xCEF2535B, 0x810EB3FF,
+   0xAF032C3B, 0x1948C489, 0x2800D75A, 0x005B635B,
+   0xF0FD361F, 0x8B57B11C, 0x9F75A148, 0x0B7196D6,
+   0xDCED61DB, 0x530F47E7, 0x6BC47723, 0x37C3985D,
+   0x79AE7930, 0xF88A1DE4, 0x1C4082DF, 0x5F840A23,
+   0xFE4C884E, 0xE3D1D82B, 0x8C2E61C8, 0x88AB8A2F,
+   0x00B33FF4, 0x6B357770, 0x0549EAB7, 0xE1ADDC50,
+   //Window 57
+   0xAE10AA6C, 0xFCDC8FF8, 0x6390EB18, 0xB2088FE4,
+   0x0A65D44F, 0xCD2A1459, 0x4C430CED, 0xCC04E2B4,
+   0xD2958A59, 0x94133ABE, 0x262A66C5, 0x3C23DAD9,
+   0xA56600F5, 0xF24B93EB, 0xE48EF3D4, 0xD26FE4E3,
+   0x00A42CD6, 0x1DA58EB7, 0x0B708B29, 0xBC181FA7,
+   0x46CFC593, 0x2F2510E8, 0x23484B36, 0xACAC3695,
+   0xEC0D9960, 0x92365842, 0x2BD0D6C7, 0x7C0F038E,
+   0xE08B09E1, 0xB0CEE21F, 0x132D786C, 0x85680516,
+   0x87EB98CD, 0x9D7DD21A, 0x8E381FAA, 0x43655419,
+   0x5D2038A7, 0x74F55C7E, 0xE142107D, 0x3FCEE0FF,
+   0x9D99927A, 0xA7F4596B, 0x969F342A, 0x52710725,
+   0xF705A76E, 0x26D5E13E, 0xEA0E984B, 0x28CB0B65,
+   0x6A7DAFFD, 0x8919F516, 0xAE400E35, 0xDBBF4ED7,
+   0x088F50F1, 0xEBAE51FB, 0xBE54C36F, 0x152C1A22,
+   0xFD33A2F0, 0xFDA784FF, 0x23AA17A6, 0xD7949062,
+   0x3FB726CD, 0x7DA0D532, 0x475C0EDD, 0x69B47DCF,
+   0x408DE30A, 0xB1D06DB1, 0x105DAF29, 0x1054D2E7,
+   0x4C3551CB, 0x71A86D68, 0xD7C874D8, 0x78815EFD,
+   0x481AAF23, 0xCF42606C, 0xA97229C9, 0x316E3EC1,
+   0x6F676668, 0x11F13C1C, 0x2DF1B4FC, 0x571ECDF3,
+   0x80152E1F, 0xE86A9EB6, 0x1C6067F6, 0xE776291B,
+   0x281493C3, 0x55BEA8C5, 0xEEE7A871, 0x89ED2F1F,
+   0x020C2D90, 0x89054FE9, 0x1D7BF09B, 0x378FA609,
+   0xB66B0187, 0xD323721C, 0x99D6ECBA, 0x0318B25E,
+   0x7FC55BBC, 0x06A61716, 0xA333A938, 0x76088F15,
+   0xF83181A4, 0x1EB7245E, 0xDC93D705, 0x116F51C6,
+   0xD341239C, 0x976CE281, 0xBA1C45FF, 0xF9AD13DB,
+   0x6CA4910F, 0xBABC3C46, 0x2FF7509E, 0xBD5F492E,
+   0xE24B5417, 0x439C3F11, 0x861E93DD, 0x90F7D5F0,
+   0x0BEB03E3, 0x14A8E9B1, 0xC837A836, 0x5A72C7AC,
+   0xCDDDA9A8, 0xD6D5C0A9, 0xBE6FBDC2, 0x252DE90E,
+   0xE46DCF2A, 0xB1F2D277, 0x4D81268C, 0xB7183C24,
+   0xF4FB2FEC, 0x7DADA8B3, 0x0ABD5B42, 0xE7554E8A,
+   0xE02C5528, 0xA4BDB9E1, 0x250016AD, 0x271BE52B,
+   0x3E866AAB, 0xFE5F8553, 0x98FD95DF, 0x366D8F8A,
+   0x7956F647, 0x45DF76A6, 0x72FDEE3E, 0x2B4BD2EF,
+   0xA39F0984, 0xA795C5D1, 0xECFE439F, 0x760D5046,
+   0xD3DD39C4, 0xA8AB9147, 0x2341D62F, 0x675555AB,
+   0x6AA815B0, 0x0242E5D0, 0x9EE1C95F, 0x4275C51E,
+   0x48EF823C, 0xDB2EED35, 0x44D04891, 0x27929D5F,
+   0x55C98D9F, 0x32D11F70, 0x2B3134A6, 0xBD1830C8,
+   0x7018743A, 0xF3474608, 0x81E76712, 0xF5440563,
+   0x2550A104, 0x1981BAD7, 0x5EF626E0, 0xE62521C8,
+   0xF2B71825, 0x2ACD5FAF, 0xB9FCD730, 0xD7B1E1A5,
+   0xFB953644, 0x7F652EC6, 0xE9030F98, 0x70912DD5,
+   0x38E538EB, 0x3A560DCD, 0xAF1E1A4A, 0x700FD0F8,
+   0xBE7162EF, 0xC3A464A2, 0x5573C66C, 0xDDDA0948,
+   0xD30B632C, 0xBE521082, 0x545C7F4B, 0xBFA1BD5F,
+   //Window 58
+   0xCE6020D3, 0xE2117B3C, 0x4A2DEFC3, 0x5EA3D73E,
+   0x0FB7E135, 0x03AB6C8A, 0x353D9628, 0x0AD21BB2,
+   0xC19E2E37, 0x53AE49C0, 0x991289EF, 0x347AAEAD,
+   0xD090E5AA, 0x37D7D0BD, 0xA27598A0, 0x377B89F9,
+   0x512E854E, 0xF9015E85, 0x341BEFDC, 0x4F2F1054,
+   0x095DEC26, 0x6E0A0084, 0xF22DD9CC, 0x82F3242F,
+   0x85BAE667, 0x48695739, 0x26DB6675, 0x0811C4C7,
+   0x89EB6ADF, 0x13D2CE30, 0x13022C0F, 0xB2DC686E,
+   0x68FF0E89, 0x61844FCA, 0x8FE99B07, 0x55F06F59,
+   0xBA118378, 0x069BE937, 0x4E9C8FCE, 0x1365FB2E,
+   0x4A9AFBC4, 0xDD29D1C6, 0xB251D5D2, 0xF0DBC007,
+   0x306C840B, 0xAF6B563F, 0x9478DCD6, 0x3AFA23A5,
+   0xAB0A5202, 0x5A8FF2C3, 0x7627E073, 0xCB2BB7DB,
+   0x202E8FC8, 0x25C9C661, 0xC31C2BCA, 0x6D88DAB3,
+   0x456CD299, 0x7294E692, 0xA8856933, 0x0B5AA230,
+   0xA222EA9C, 0x36027169, 0x36187BCF, 0x537BE8A8,
+   0x6D9F7E06, 0xEE5C3ABD, 0x80363920, 0xBAAF59BF,
+   0x36572F8B, 0x9B042B38, 0xBBA9E9C6, 0x675324DE,
+   0x4E0733F3, 0xE5EA2094, 0x139B02C0, 0x63F5C429,
+   0x1C66442F, 0x50774774, 0x55DFAA8C, 0x0BED6694,
+   0x78441AF4, 0x122BDC32, 0xE3997D1E, 0x3721E7A2,
+   0xB1931B12, 0xC1D3BD8E, 0xA9E30A89, 0xD90CF453,
+   0x34B7191C, 0x2508F585, 0x2EDF1A93, 0x9A83EAB6,
+   0xEE8BF762, 0x4C234879, 0x68233AAA, 0x15F633C2,
+   0x36AE9861, 0x97BB10DB, 0x77DB2761, 0x07DBFE46,
+   0x4D539F2B, 0x0C848587, 0x18B6C73D, 0x1264A1E6,
+   0x954222D5, 0xD5D86E0E, 0xD695309B, 0xEEC10AEB,
+   0x190538A2, 0xA7277E11, 0xAC74C039, 0x5E5FBA68,
+   0x76FB830F, 0x7ADEAE8F, 0x32FD6378, 0x5C9565E2,
+   0x7501A7A8, 0xD9EAD178, 0xDE0FF8C1, 0xA9F3A7DB,
+   0x66C12169, 0x9C46FB60, 0xA28FD226, 0xF58B38B3,
+   0x60526755, 0x2D3D1E55, 0xDB9A7193, 0x40765B92,
+   0x9431D55E, 0x6FBA4495, 0x8D2DD9A0, 0xBAB0F372,
+   0xAF190655, 0x8403161D, 0x1EB22282, 0xF73213AA,
+   0xC51699B1, 0x6D2BACBE, 0xF5A2A456, 0xC7DD4A56,
+   0x2ADC96AB, 0x255C92EA, 0x2EFF1C4C, 0x16B75372,
+   0x0741AC7A, 0xE6647E38, 0xC8A3E9C0, 0x2FF3E521,
+   0xCA358511, 0x9F18E952, 0x05E72A2B, 0xFEF26612,
+   0x83E57DED, 0xA738B457, 0x6116A435, 0x9DB0A48A,
+   0x1FA8706F, 0xF3210020, 0x238AE461, 0x9F39D02E,
+   0x691AA564, 0xBD789EFA, 0x7539F1DD, 0x33B251F9,
+   0x0B240DEC, 0x57789921, 0xC6ED75AB, 0xD4B3E8F9,
+   0xF2742A36, 0xE0988057, 0x2CBA1313, 0x160FDA7A,
+   0x059B7094, 0x5A64E944, 0xFC50A93E, 0x814DBFC1,
+   0x2CEB5305, 0xD025DD20, 0x786EF22A, 0xCAD319BB,
+   0x52ACDC43, 0xD6B14AC9, 0xCD2E1299, 0x9083A76F,
+   0xD3D522EB, 0xAC914FB4, 0x91644375, 0xB34A6647,
+   0x75CF737C, 0x7BDB30C7, 0x21486B3F, 0x32B3E46B,
+   //Window 59
+   0x2E2CC4AB, 0xE816E48C, 0x09D866E4, 0xDEA35767,
+   0x66DFA43E, 0xCD03908F, 0x167D467D, 0xA05C151A,
+   0x5416B1C5, 0xE29ECA36, 0x6A893EE6, 0xE9A70D3A,
+   0xB620E1E6, 0x45983EBA, 0x1E5F9B53, 0xBA626771,
+   0x3FBB588F, 0xC38D3473, 0x7F32556B, 0x8256B5B4,
+   0x4FC5D5BA, 0x08EA4E87, 0x5F3C4411, 0xFD6D07B0,
+   0x9C3804AC, 0xFD720574, 0xF38347D3, 0xF6F157D3,
+   0x1076B6BD, 0xD5A82B6B, 0xB86BC88D, 0x816D4925,
+   0x1DD922BA, 0x07A9FF72, 0x9A24FAC3, 0xA953D78F,
+   0x1B8F261F, 0x9435AD1E, 0x8B450926, 0x332A0050,
+   0x1BA8501D, 0xA352758F, 0xBD898AD5, 0xE021EA4A,
+   0xACA5091A, 0x53B91A8A, 0x94869B86, 0x95508B05,
+   0xCF81F372, 0x78581C3F, 0xB4424BE9, 0x06C93205,
+   0x9462CAD9, 0x40FCEE42, 0x92D61A68, 0xAA6EE59F,
+   0x4D4B2D84, 0x27543175, 0xE8C637EA, 0x4644B28E,
+   0x24C118E4, 0xCA61A542, 0x40146DDD, 0x2AAB3C65,
+   0xFC86DAE9, 0xEC1176D0, 0xF15AB694, 0xE149721B,
+   0xD2B771C0, 0x26889364, 0x733911F2, 0x9D5E3342,
+   0xD5B6B070, 0x82C0E9C2, 0x305C496E, 0x1BAE2ED7,
+   0xA868469C, 0x3028D659, 0xAAA93444, 0xDF923D5C,
+   0x6B1BCD4A, 0x10369C66, 0xAF31CC7C, 0x0F598E18,
+   0x6B3480BF, 0xFF056B1F, 0xE489E357, 0x14FCC590,
+   0x980166AA, 0x953A32AD, 0x26584CC8, 0x524264B4,
+   0x2B49837E, 0xDDF757CF, 0xAE8AF89F, 0x7B4902B4,
+   0x825A82CE, 0xE2DDB523, 0x9DFF61AC, 0x35B1D345,
+   0x57EE868A, 0x17CC8CA8, 0x31408332, 0x29758FF6,
+   0xCAD128EA, 0x40DFD3B2, 0x0F981424, 0xDF0544F9,
+   0xC10B641D, 0x7830568A, 0x6F560D68, 0x9710E04C,
+   0xA6F8F9B3, 0x2063ED78, 0x78B679CF, 0x8E4EFA27,
+   0x4B543316, 0x8CC27C67, 0x90DFDEEB, 0xB3D11255,
+   0xBE970702, 0x5E7D9517, 0x0CA77CB5, 0xFAD07ECE,
+   0xD3527FB2, 0x8E0D4049, 0x55D63E3C, 0x10CE81CB,
+   0x8AFB08B2, 0x8E0B3947, 0x662331DE, 0x88F8CE4C,
+   0x6ED82720, 0x806A7FE1, 0xE15BBA2B, 0x50229F71,
+   0x7DE2C112, 0x5D45652A, 0xEAC49CE7, 0x1FDB2E57,
+   0x52AB5CA9, 0x637A8D73, 0x3F93F51E, 0x5C85A0CA,
+   0x76C3B275, 0x6AC601E1, 0x5B30DD55, 0x2EB677AA,
+   0xBF7019C4, 0xBBE6FDA5, 0x53AB6CCE, 0xF40CE62E,
+   0x0B5CFD71, 0xF91A1632, 0xB3039089, 0x93524C3C,
+   0x32D4F0FE, 0xA9F75F97, 0x6A226028, 0xDE27F13C,
+   0x5C441A50, 0xB6AB6FD4, 0xB2BA05FD, 0x3B7DBEB5,
+   0x660B2E47, 0xEEDFD64E, 0x3B3E583C, 0x8604F3E9,
+   0x0BC57AEF, 0x4B44F0CC, 0x3C3926BA, 0xF6B29E5A,
+   0x6313AE26, 0x0689A303, 0x8C5EC301, 0xD2F7967A,
+   0x7A14DB92, 0xB34D981B, 0xFE6E2044, 0x687990CA,
+   0xBA554F92, 0x2E9C3C25, 0x19CCA511, 0x3AF5A82A,
+   0x2CFA9998, 0x43D08B7E, 0x1702868B, 0x7B3B1CD3,
+   0x6F715553, 0x84F15019, 0x0AFC3EBB, 0xE921E2C2,
+   //Window 60
+   0xA213E83B, 0xB3DE52C7, 0x55DB2392, 0x464A92D0,
+   0xA76F70C9, 0x0F54907F, 0x455C1C82, 0xF03811A5,
+   0xA71BFEBC, 0xDBC082AB, 0x8EDFFA7F, 0xC6B40528,
+   0xE3636016, 0xC07BB07D, 0x4C00333A, 0x12B29E9A,
+   0x53EEC121, 0x888E1907, 0x640707C9, 0x64ACC0D1,
+   0x03519FA1, 0xB78CA0FF, 0xC6C4EAFB, 0x5C88FB72,
+   0x8BF77BB6, 0xBDD4B203, 0xB37C91FA, 0x436AABEB,
+   0x067D6B1C, 0xC7A859B7, 0xB1BBDCC6, 0x4A6820FE,
+   0xFEE3FD00, 0x8451BAA5, 0x63902D8D, 0x701D14F8,
+   0xC68211FD, 0xF47C0F3B, 0x0670431C, 0xC1441E92,
+   0x54119890, 0x55B2BAF1, 0x0ED785CB, 0x69BB3A8B,
+   0x1C6C6429, 0x4600C6C2, 0x59B549D2, 0xCB7B67B5,
+   0x79D31448, 0x1A3D31D6, 0x3C4D95BB, 0x2B83506B,
+   0x4DD52A91, 0xB8D037ED, 0xCFE79E95, 0x61EEC524,
+   0xEDF1DD94, 0xDADE55AE, 0x65FF710D, 0xD3FB1549,
+   0x0F26D7B2, 0x78701E42, 0x0506BFF4, 0x4B00CC3A,
+   0xD8921A1B, 0x00F1DAF9, 0xEA792A95, 0xFEF4FFE3,
+   0xB84F6477, 0x15B0132F, 0x5A0D2599, 0x768AE80C,
+   0xE898CBCC, 0x20527222, 0x4E98E6AF, 0x2CD9ECBE,
+   0x98FFABA5, 0x6325B6C4, 0x8F929849, 0x515CFCFE,
+   0xB15D2945, 0x84149035, 0x90F31A67, 0x7E313682,
+   0x713398BB, 0x148C8386, 0xD0D5A059, 0x99A0BB57,
+   0x842DD573, 0x4ED79AFA, 0xD4B85463, 0xA48C501F,
+   0xC284875C, 0x8B4D6BC6, 0xDB248191, 0xEF81BC42,
+   0x02BEEC15, 0x0F8CCB8C, 0x33FD8275, 0xEEB47811,
+   0x017A78B3, 0x54774F9A, 0x34E738CD, 0xB0F27357,
+   0x4618B9DE, 0x008CF2C2, 0xCBC8B0B8, 0x97B0175F,
+   0xEA989A65, 0x8BBEB8FA, 0xB7B32EAC, 0x5D3B1F03,
+   0x922AD734, 0x866E7322, 0x05B91BE8, 0x3BFF97B8,
+   0x2DD9F0B9, 0x2816E151, 0x15B223F3, 0x96B15A26,
+   0xA9EBD965, 0x5AACAF3B, 0x7E661060, 0xDDD33E69,
+   0xD49844A9, 0x878DDDE3, 0x3478A8ED, 0x15895E31,
+   0x35D925E6, 0x763D4FBB, 0x2438B790, 0xC441BE75,
+   0xA03C20CB, 0xD8141CA0, 0xBCEF63DB, 0x03E7C6F1,
+   0x1AAB6FFB, 0xAC79E632, 0x82966305, 0x58B35958,
+   0x5EA8BD95, 0x6E1BAA82, 0x3F391BD1, 0x42C294DE,
+   0x2D0F89D0, 0x994CBB20, 0x675F5C14, 0x248E3C50,
+   0x33ADD13F, 0x64ED6CD1, 0xB7110F88, 0x1F5B7BAC,
+   0x26B16BA4, 0x7A42F5C4, 0xECBC886E, 0x9C49D432,
+   0x8142CDD2, 0xA389FAC0, 0xA7CD9570, 0x5AB90DB2,
+   0x14A1F743, 0x6AF7F10B, 0x8EC78F65, 0x54FB1DBB,
+   0xBFE74C3E, 0x4FA0053D, 0x5666A453, 0xDBAE4F2A,
+   0xF5538BD2, 0xB4878504, 0x6F815DCA, 0x8EBDD127,
+   0x9FDD9DFB, 0xCF9DB990, 0x6B1268CA, 0x87765CEE,
+   0xB189DF37, 0xC06DCA7A, 0x3A78311E, 0x06FBC73A,
+   0x71CFBA00, 0xE15508E6, 0x87E2A7C7, 0x16A9A1A2,
+   0x99918304, 0x352D8BA4, 0x299E2629, 0x79F99441,
+   0x153B21E1, 0x43F454D3, 0xDE9AE507, 0xD8A3BCBD,
+   //Window 61
+   0xA8492B0E, 0x0AA8984A, 0x3281B1AB, 0xA8D57AB9,
+   0xA774654E, 0x0880535A, 0x978AEA8A, 0xCB15D86F,
+   0xDAF4EED1, 0x926E0999, 0xC68C9E4F, 0x88A2CD73,
+   0xFCF69D9E, 0x17E0AC0B, 0xD99A80F5, 0xF8FB7DDA,
+   0x2BD8BCD4, 0x3CBC116C, 0x9732C221, 0x40C015D9,
+   0x27E929E3, 0x2E0EBE2E, 0x22A20838, 0x93CF5583,
+   0x8B0F3359, 0x037B1CDB, 0x656A8C99, 0x3FB3FCF8,
+   0xECE519E4, 0xCE9B3C01, 0x8A075FF1, 0x838EA449,
+   0x0D874B5B, 0xB1018EDA, 0xB591DE39, 0xD091C617,
+   0xE2828AD2, 0x62789040, 0x76105B52, 0x9B0B0DE3,
+   0x71FD30FA, 0x6B9D80A2, 0x27D34789, 0x4AF5F02D,
+   0xD38B7DAA, 0xEB1478E6, 0x434C77D4, 0xDC5096D0,
+   0x6F3A5002, 0x4DE269DC, 0xBD40F4F2, 0x30B402F2,
+   0xC1EE9D1E, 0x8B18A8F2, 0x39262891, 0xAC5E28A7,
+   0xEB2F0FA9, 0x5F1E5B07, 0x259C3ADD, 0x5B4DE0C3,
+   0x8AC67C8D, 0x34C34944, 0x0125B920, 0xF744D721,
+   0x9F277D2D, 0x14303118, 0x5A1943ED, 0x7C69980A,
+   0xFEF919B7, 0x71647BDC, 0x2F5EE6F0, 0xBDA03673,
+   0x29B9B406, 0x438B07EB, 0x2EF3C7DE, 0x92B03190,
+   0x3EF5C914, 0xC9C68DEA, 0x8938D128, 0x068B27F7,
+   0xEAD3C4FB, 0xCA366876, 0x11FA81FE, 0x18DECF6A,
+   0x23BBA878, 0x5C04D72D, 0x3616E5BF, 0xC76E6FB1,
+   0xBF2380AE, 0x9E4C9BE4, 0xB67F4167, 0x3BA6C1E7,
+   0x96EEDC4B, 0xC3555E3C, 0xA8162586, 0xADC5857D,
+   0xF6385C5B, 0xD2786F2F, 0x828287EA, 0x59B05A2F,
+   0xDEBEB333, 0x7D44F5FF, 0x900EE41D, 0x6A740D6F,
+   0xD73FE7B9, 0xE4AAE6A1, 0x4ED4A07B, 0xF53F7657,
+   0xABB1B5E4, 0x8AE6B921, 0x5B1EF512, 0x7466B85F,
+   0x200EA2E9, 0xF74224F4, 0xB5B32B1F, 0x58A34CA2,
+   0x0AA3E91E, 0xFC23D2A5, 0x7ACEBA85, 0x6D7ADD82,
+   0x5F0E794A, 0x9DAE9AFE, 0xF6D6D28E, 0xA08D8B41,
+   0x5F53324A, 0x5F2E0DD9, 0x650A2D9F, 0xD3D9F548,
+   0xFB6C30D9, 0x72C66A02, 0xE00380AE, 0x01C5C334,
+   0x1F400CA5, 0x8CB21D38, 0xC898A07B, 0xDD339F11,
+   0x103ACF65, 0x0AB900D7, 0xE39CB673, 0x6CC1A648,
+   0xBB505E19, 0xB087D66A, 0x4D5E8210, 0x78427B46,
+   0x6875F4BE, 0x35AC1455, 0xF7E5ABC3, 0xA3B347BF,
+   0x059B4DEB, 0x5E764FA0, 0xF9B08E7C, 0x8E8849C6,
+   0x866DF773, 0x1FCF5725, 0xA293B411, 0xD4D0B43D,
+   0x489B6BA3, 0x514AF997, 0x327D7217, 0xB8977DB3,
+   0xF57BF7ED, 0x46F76DDB, 0xCED29261, 0x8570B573,
+   0x20B7CC1E, 0x73A46644, 0x29CE95EF, 0x43651FE2,
+   0xE14343CF, 0xFA7BAC59, 0xBE511D46, 0x19C6A360,
+   0xAC806960, 0xB3E3C2BC, 0xF74CA363, 0xB8A5614A,
+   0x00A5537B, 0x0FE2AA4B, 0x2D0F1648, 0xAE354B53,
+   0x2A327069, 0x2A32FC78, 0xDA3FFF6B, 0x8F5C5728,
+   0x77BC8018, 0x05E2FCD4, 0x8AE24A4C, 0x16548C7E,
+   0x11B5CE21, 0xAF51A3BF, 0xEDE23D73, 0x1CB60EA5,
+   //Window 62
+   0xDE68B4D8, 0x8C56D73B, 0xF933E263, 0x2AE421BF,
+   0xC419B34E, 0x448C5F77, 0xFEDE4D58, 0x97B15D0E,
+   0x78B64510, 0x11A125AC, 0x030B7226, 0xB2E694D4,
+   0xB25B8465, 0x56D6E47D, 0x3EA4A11A, 0x4AF74B9D,
+   0x3DBB7EB6, 0xA898F066, 0x001F8107, 0x06CB5DD7,
+   0x603B0189, 0x933664FC, 0x337228E6, 0x1BD1A457,
+   0x248D27D5, 0xB7817FF5, 0xA102FD46, 0x768A0CBA,
+   0xF1EF97F0, 0x1A0145CA, 0x7E08A4E2, 0xBDBF5444,
+   0x1E262158, 0x06D7BDB1, 0xD7D5C3DC, 0x4544CEEE,
+   0x256E62AA, 0x5E1FF066, 0x84AE076D, 0x9EA46DAC,
+   0xB5DE4CFB, 0x9C5C1B18, 0x87E9CC16, 0x9BD45675,
+   0x6884CCF4, 0xA944A8BD, 0x93C37BC0, 0x325DB2F6,
+   0xED0F0B79, 0x7D111216, 0xD2C58F58, 0x61961D03,
+   0xD2C36281, 0x80CBA5AE, 0xD179D616, 0x840EA75B,
+   0xBDEF053D, 0x2653632B, 0x29D14FB2, 0x90C6112B,
+   0x181B09AE, 0x08812AB1, 0x45CE3C8F, 0x9FE4E30E,
+   0xB919213B, 0x0AAFAEBB, 0xC4408BB2, 0xC47F1BFE,
+   0x0B3DCC44, 0x4C8D8250, 0xBB10E533, 0x112AFA1A,
+   0xE7EB9FCA, 0xA3633B46, 0x70DADA6F, 0x1C1CD7F4,
+   0x9AFCC3BC, 0xF59B3E01, 0xCA42A865, 0x71FA7E02,
+   0xE92AAB55, 0x6AB4F0ED, 0xAF7F1AA7, 0xAE5BB69B,
+   0xAB4BD359, 0x26C88E39, 0x6F0A203A, 0x33D2EC41,
+   0xDF90E37F, 0xF7601B75, 0x45302674, 0x81094ADE,
+   0x2A732229, 0x7DD9CFCB, 0x4D60021D, 0x5526A47D,
+   0xA302C6B7, 0x6D3AAB2F, 0x0AB1D54B, 0xEF8985DC,
+   0xBB1781FD, 0x1F20CD7B, 0x9AEDE0C6, 0xC913902C,
+   0xFD8B67D5, 0x241981D8, 0x36B6BEA0, 0x677D350A,
+   0x68BA295D, 0x39D73A0B, 0xF35D9D9F, 0xC44D3BC7,
+   0x17109F9D, 0x91950912, 0x2EF6B1B4, 0x281E2A23,
+   0x411042DB, 0xEEEEE4D0, 0xF0772135, 0xF4139093,
+   0x7D075DAB, 0x851965CB, 0xB8C1C37C, 0x3354EE78,
+   0x711BC02A, 0x47DC13BE, 0xF97135C6, 0xEC1AC1B3,
+   0x636E9D19, 0x99ADCDFF, 0x0BC6C8C9, 0x1A264849,
+   0x8C18C3BA, 0x69DCBDEB, 0x13B0948B, 0xA51DA5FB,
+   0x8C5C61C3, 0x57B69205, 0x8AAC65EE, 0x0B142EFC,
+   0xD27FBB03, 0x34EC5362, 0xA87FB92A, 0x7A0C07E5,
+   0x74FA4C1E, 0xB30529EF, 0xC25738B9, 0xDEFD0897,
+   0x95F01029, 0x4911C905, 0x542E873E, 0xF430BE5A,
+   0xA820120F, 0xCC47C6C9, 0x356966C3, 0xB98AB120,
+   0xE42F65BA, 0x3DE102BA, 0x2C0E375F, 0xE0BE0945,
+   0xC9899DD4, 0x1BCDA4AA, 0xF6A3C235, 0xA87C92AF,
+   0xAD1DAA95, 0x56BFBAAE, 0x1B59F4F0, 0x7BC37068,
+   0x02D82855, 0x24410382, 0xC4908463, 0xAB22E3EE,
+   0xC0C719E4, 0x5E63B13F, 0xA4F6D9D9, 0xE94A5644,
+   0x87C09E31, 0x0E41E417, 0x7C9D2E2B, 0x1F205BBE,
+   0x57DC2DAB, 0x221A6F31, 0xE19D44E9, 0x5C4450EB,
+   0x5DD8A146, 0x35C7E442, 0xEE6834F3, 0xCAA846F0,
+   0x051D29EA, 0x37A3717B, 0xE4C4BC9A, 0x87B2C338,
+   //Window 63
+   0x9D1FE745, 0x393890CC, 0xA65C0AE6, 0xE803284A,
+   0x1EEDD379, 0x2832404A, 0x24557409, 0xA5AA0A42,
+   0x8428733F, 0x748E6589, 0x46399BB0, 0x47154818,
+   0x90374E84, 0x5FBED33D, 0x3CA2DF4E, 0x0B51A3EF,
+   0x7FDFAB4D, 0xB990A3E3, 0x0024108C, 0xC1BCFAA8,
+   0x8647FC14, 0x678FD285, 0x2B13DDE8, 0x0A925462,
+   0x19B8C564, 0xF82B7434, 0xB8048774, 0x8F8B1844,
+   0x4DEB98EC, 0xBA299BDD, 0x96E4B084, 0xCED5BEC0,
+   0xD7A6C62A, 0xE790CA3B, 0x285CFD41, 0xC63FB678,
+   0xE62CE5F7, 0x3349B612, 0xC7B7EE94, 0xFE300ED8,
+   0x109C2A0D, 0xB70E0AB5, 0x8E9D86D7, 0xA7D4C764,
+   0xD16BC0B0, 0x1BD3EC2C, 0xB3FB2E39, 0xBDB06B56,
+   0x176F8A19, 0x2C6CF21C, 0x26D9402A, 0xE25217FF,
+   0x21DE8B08, 0x8920ED46, 0x8D924566, 0x3CD16766,
+   0x024B3EB7, 0x368568A2, 0x60E4F469, 0x1E1C5C10,
+   0x806E6B55, 0x5FF14982, 0x389A848E, 0x379BCA03,
+   0x51AAAFE7, 0xB4F0A9FC, 0x0C1F00E4, 0x6FEF8308,
+   0xEC00B308, 0xBF2BC771, 0x9B1D113D, 0x2A473D26,
+   0x25666FCA, 0x33ADCE74, 0xB5BBF7E2, 0x8DE8D6E2,
+   0xB4EDDFDE, 0x52531478, 0x25C7A6A9, 0x9783E3C5,
+   0xB7A28DF9, 0xFA38502A, 0x121284B4, 0xFE4564EF,
+   0x131DD429, 0x076F402E, 0xDCD92755, 0x4FE5EFED,
+   0x8B80F8EF, 0x39FCE006, 0x948546CC, 0xA32CE708,
+   0x6D55517C, 0xBFDDEC5D, 0xC61FCCBB, 0x9EDBB6F8,
+   0x00ABABEF, 0xA17BD67A, 0x26B2401E, 0x27B7006C,
+   0x4627D53A, 0x5EEA7E50, 0x23DCBD7F, 0x48760D12,
+   0x0DFAA499, 0x985BE07E, 0x153B3A81, 0x74D0C74C,
+   0x0196E9D9, 0xB5C3E6A6, 0x764CE8E1, 0x530C7C59,
+   0x84615660, 0xD36AB38D, 0xD4E9EF0C, 0x3D4014DE,
+   0x5A834991, 0x686FE885, 0xD64F24EE, 0xECB89960,
+   0x785FE102, 0x9434A067, 0x637AAC71, 0xCCF9603D,
+   0x89A2C4CC, 0x743EBBD9, 0x13271376, 0x1A0CEA3F,
+   0xC75F6347, 0x001A19FB, 0xB68082AF, 0x552A98DF,
+   0xB58683D5, 0x5094B1EC, 0xAF8F0EB4, 0xEC67B8C7,
+   0x814E93AB, 0xCA541A56, 0xE80E92DF, 0x49B8D072,
+   0x057D413D, 0xF90DA3A1, 0x6A686EDB, 0x1DF65F8C,
+   0xEB591945, 0x960E5B03, 0xBACF18D2, 0x06236270,
+   0x4B4B1C00, 0x95F261DB, 0x37923D22, 0xDF3D71D3,
+   0x05B6093A, 0xD568ABDA, 0xEAD57930, 0x49EED9EF,
+   0x2BCD94C2, 0xC1953644, 0x0A8AF658, 0x04336899,
+   0xBDFEAF62, 0x8A6D288B, 0xBED8A6CD, 0x8AC4938D,
+   0x17EAEC07, 0x01376D6C, 0x56FBC8DB, 0xD1CE8082,
+   0xEF5DE894, 0x0D09CDE0, 0x873E7811, 0xF88AC0DD,
+   0x19A6D0D4, 0x92C73E9C, 0xF203993E, 0x4F9DBCDB,
+   0x7EE85624, 0x5BB9BDE4, 0x63B87CAC, 0x668960E9,
+   0x2CB7A07A, 0x165F2D69, 0x0166F9F1, 0x627A63F6,
+   0x6B2746E9, 0x4EF50CCE, 0xF73F5133, 0x9A2EF808,
+   0x83994B80, 0x229C56DE, 0x387CC1F6, 0x31C39D41,
+   //Window 64
+   0x1A9BB0AA, 0x31EFC132, 0xBB0F6CA7, 0xDA74BDF2,
+   0xCD3D0497, 0x1AF000F8, 0x2AAA3451, 0x39ACB8F2,
+   0xEDFB898D, 0x23EAF4CD, 0xCAD3D109, 0xE7B3F42D,
+   0x5E695394, 0x98CA61B5, 0x0E70A633, 0x6F591102,
+   0x216B71D5, 0x80A93EC7, 0xC463E3B8, 0xBBB25C8F,
+   0x8615E7A5, 0xB18E3FBA, 0xFC212920, 0x5A5D5C5F,
+   0x511B69F8, 0x898BD3DB, 0x0F9C63CD, 0x2E1671CA,
+   0xA0FFBB78, 0x2686BE11, 0xB3BAA939, 0x93AE6BD0,
+   0x2CA76A4D, 0x8AAF7922, 0x5B66AAA9, 0x66F3F75B,
+   0x57F6EC88, 0x1616A86B, 0xCCD953CF, 0x71322859,
+   0xA263BC46, 0x4653596F, 0x6A91CB26, 0x424E7E02,
+   0x1C1F9232, 0xF15F4B57, 0x175E091D, 0xBC173B81,
+   0xAE89EB47, 0xE764EF1B, 0x3C23B51F, 0xCC8CF57B,
+   0xB29D8107, 0xDE0077D4, 0x1798C742, 0x4E344728,
+   0xA26B8FC2, 0x61810663, 0xD4F7B9E3, 0xC2950BF1,
+   0x7276264D, 0x67FBD84C, 0x8FB1A4DE, 0x53076DED,
+   0x8011F820, 0x3DF9236C, 0x80491F31, 0xF5775DD1,
+   0x19AA256F, 0x0DE1332D, 0x5DC0E92D, 0x3EF665C8,
+   0x8AC2A4FE, 0x5B95E70A, 0xAE1493F8, 0x50C3FA0A,
+   0xB1FF9A4F, 0xCCA507D8, 0x3892BC87, 0xD595D170,
+   0xDCE68332, 0xEB383866, 0xE612166D, 0x453096D7,
+   0x8C604CFD, 0x6777C8E1, 0x22368B9A, 0x8D3C3A89,
+   0x20E1A532, 0x50AB2D43, 0xCA2188BD, 0x6D3AD09B,
+   0x1ABB225A, 0xD625658C, 0x2CCEECE3, 0x9ADB343A,
+   0xAA41AF2A, 0x1CDBA50C, 0xA31A9F8F, 0x788ED544,
+   0xF7137548, 0x3D6529C2, 0x1BA02834, 0x976317B0,
+   0x240A5EF4, 0xC57CA301, 0xEF057BB8, 0x1872D3CB,
+   0x1E6F863E, 0x1EC20950, 0x11097074, 0xD91FED6D,
+   0xCA394F2D, 0x861110B1, 0xDD2A9A08, 0xBD9AC101,
+   0xFD11D933, 0xC5F2D285, 0xC0544BC5, 0xB2E31F66,
+   0xDF823A33, 0x3D5B69C6, 0x3EE50C52, 0x3A90B643,
+   0x291D741A, 0x9382F945, 0xB02842AE, 0x015C5033,
+   0xDD9C81BB, 0x18691119, 0xBDB0012C, 0x3F4BD734,
+   0x2293F63B, 0x044D409D, 0x5741810B, 0x74AAF68A,
+   0x77AE573E, 0x936BFA02, 0xCFF4C0DB, 0xC151524F,
+   0x840ABFB0, 0x7F70E4B8, 0x5546FF4A, 0x938A3DDE,
+   0x3506CE84, 0x6E1511EA, 0x4C09C67D, 0x148AF7F9,
+   0x6E179496, 0x3890ED1A, 0xEEC54607, 0xFD0C4ED3,
+   0x069A2A62, 0x8B15A833, 0xE2CB6800, 0xE05781A2,
+   0xE5472581, 0xF684D4EE, 0x577FB238, 0xE9C67244,
+   0xB604583D, 0x62573DD4, 0x7356031F, 0x0E8FF2D8,
+   0x2C8A7644, 0x7B775987, 0xC7BEA279, 0x52BA0D3A,
+   0x5F899DAD, 0x0E5C9CCE, 0xE67A3AB4, 0x317C43A4,
+   0x0AFE78BC, 0xAEDA2F96, 0x75B3C0DC, 0x33467D0A,
+   0x28BEAC70, 0xE3DBBDDA, 0x544F6B32, 0xB4536EC4,
+   0x07D768B0, 0xFC68E3AF, 0x5FF3772F, 0xF2AE9D2A,
+   0x79B6385F, 0x429840EE, 0x45A36283, 0x4215A138,
+   0xEB491DDA, 0x95B77126, 0xF11F6888, 0x739A9BC3,
+   //Window 65
+   0xAA827B07, 0x7D9A06F4, 0x7CD6596C, 0xCC3C82E4,
+   0x14CBF8B8, 0x26D7FFDC, 0xEB8257AA, 0xB7B13317,
+   0xB78CB337, 0x8EA3DF11, 0xE55FFEA3, 0x131F3845,
+   0x89F3C69A, 0x1228F051, 0xDCF0208C, 0xD9E13081,
+   0x8D0223A7, 0x951CB192, 0xD759CE54, 0xE53F2BEB,
+   0x60EDBAC6, 0x7392CD05, 0x1E6F179D, 0xA36E4C38,
+   0xC351BE09, 0x99C022EC, 0xFFC93537, 0x537CE7DD,
+   0xFBA62351, 0xEEE40172, 0x83121A3A, 0x64542269,
+   0x3DF5DBD4, 0x7D8A4E31, 0x872B14E5, 0xE2B0AA79,
+   0x5107087C, 0x3279448E, 0x86FAC3FE, 0x3E8EA3FF,
+   0xEA2DDC53, 0x56E5058D, 0x22F8A1BC, 0xE79E85B6,
+   0x555C1945, 0x70438160, 0x4C17A905, 0xE6840FA4,
+   0x614D3067, 0x7956BBAC, 0x9DCDAC33, 0xE70AEB7C,
+   0xBD480D70, 0x62B607A6, 0x64B3BCF0, 0xD9AD8397,
+   0x3AC741F8, 0x745C6F7B, 0x2F571136, 0x339A1090,
+   0x4FD00B7D, 0x3DD4F1BF, 0x4EAA8452, 0xC50D1017,
+   0x0B27979D, 0x6E4890B5, 0x3C31D4AB, 0x2738525E,
+   0x65B09810, 0xC47E97D7, 0xCF699106, 0x41203264,
+   0x35A34C44, 0xB8133148, 0xCE1B7F2F, 0x76493536,
+   0x09FF3F24, 0x77B53797, 0x1CE48890, 0x76CF9691,
+   0x4D0D661A, 0xD87B5E01, 0x81DCD620, 0x84366F51,
+   0xFE8FD580, 0xCD768A79, 0x75DD31E6, 0x280EA91A,
+   0x8335E10C, 0x1A3F7261, 0x7F21E94B, 0xF02297E9,
+   0xC6A3D1A1, 0xE4A820EE, 0x5EF797E3, 0x64AAD1ED,
+   0x1B2D5CE4, 0x6DC70C99, 0x66E05FD1, 0xA428102A,
+   0xBB5B007A, 0x31FBE2CF, 0xC5924E51, 0xF7E24565,
+   0xBB28D388, 0x199B41AA, 0x07F294A1, 0xFCE09F78,
+   0x0915F288, 0xF9484171, 0xBAEC6F41, 0xFDF5AC54,
+   0x422CB4A9, 0x87F32F81, 0x89EC8976, 0xF761DB1A,
+   0x516C6348, 0x4E063FCB, 0xD924512F, 0xAE51399B,
+   0xCF21EB07, 0x24929668, 0x52AD3B9C, 0xD3555908,
+   0x5A0BC364, 0x472C02E6, 0x128D672B, 0x243E3FEB,
+   0xF702B51C, 0x6960348E, 0x3FE2A2CE, 0x9188E288,
+   0xB038A3ED, 0x1E46AECB, 0x0C296A47, 0xE42CDCBC,
+   0x64E04FF0, 0x5126EA9F, 0x66F0F6AD, 0x84D2D3EF,
+   0xC239413D, 0x0B0AB896, 0xE8FDDF5B, 0x321D3D8E,
+   0xE0968467, 0x6349407B, 0x77DB8E06, 0x06233D5E,
+   0x467C1EA2, 0x005B7074, 0x8D719AF1, 0xBE82E959,
+   0x44B79742, 0x1EA5AAA3, 0x56A38218, 0xB0AC0D43,
+   0x1BB0467B, 0x8C865F4D, 0x908C1B95, 0xEEE5D491,
+   0x56889308, 0x15E85199, 0xF8DA7FE6, 0x7932FA92,
+   0xD53EBE7F, 0xE8F7929D, 0x515D9D78, 0x7D088CDD,
+   0x4536B1A4, 0xCEB8D336, 0xBE9B2803, 0x71C9E028,
+   0x91441EFF, 0x37B3A885, 0x6D6EB3D5, 0xF807ABDC,
+   0x720C460F, 0xE1859631, 0xAC13DA61, 0x7C1C0B21,
+   0xEE6A919F, 0x518588DA, 0xCBDC75B9, 0x33E1536C,
+   0x90D957E0, 0xDD366CAB, 0xA93CFB83, 0x813726E7,
+   0x9F5131C2, 0xD7261A57, 0xD5EBEA28, 0x44B55DCB,
+   //Window 66
+   0x5992B108, 0x0708A95B, 0x2834F982, 0x000A18D6,
+   0xDFAE696E, 0x8B42B3BB, 0x4351358E, 0x630527B7,
+   0x3721ADAE, 0x0F74AA5D, 0x3F5EF596, 0x5B96E58D,
+   0xAA644979, 0xA3CD5292, 0xBF5F18AC, 0x67028246,
+   0x79B30F09, 0x855FF5A7, 0x6809871A, 0x94468255,
+   0xF0FC05B1, 0x0816D773, 0xC424CED7, 0xF5132490,
+   0x882B6167, 0xFE703C65, 0x0B63BDE2, 0xFA59F3B6,
+   0x1791BDD9, 0x99BFAE79, 0x63AE128E, 0x4DD82C3C,
+   0xAE387FA6, 0x9473FCEC, 0x7BEF7B61, 0xA15C110E,
+   0x1F9C7C1F, 0x2E2BFD5B, 0xFA5EC157, 0xD461DEA8,
+   0x50357BB3, 0x72B38556, 0x7D7AE19A, 0xE6074B78,
+   0xEBAFD417, 0x9366251B, 0xD94BE72A, 0x630EBEB6,
+   0xD444894B, 0xD54C97CA, 0x0E2F615C, 0x0F222481,
+   0x453D7374, 0x22763AF6, 0x4D821A8A, 0x0BB4B4B5,
+   0x8C19B2A8, 0x928F3150, 0x3952190A, 0x0FBE3266,
+   0x6DA5B886, 0x0D25A095, 0x71F07099, 0x024D8E05,
+   0xCCEA895B, 0xB7EC9980, 0xA6F824CF, 0x3BF22DB3,
+   0x10613A2C, 0x8D783A56, 0x76B45332, 0x45680FDE,
+   0xA5CC0D60, 0xDEE034D1, 0x4AE73787, 0x2977258A,
+   0x69BBFC59, 0x8B7C6356, 0x0AD66525, 0x72124D13,
+   0x7E4F4350, 0xCF4AB08A, 0xEF66FBA9, 0xB1AF8D75,
+   0xC5E19121, 0x5BE67DB1, 0x2A93A6B8, 0x336AF49A,
+   0xF53C2A58, 0xDCAAE2B1, 0x7BFA43E8, 0xAF85E197,
+   0x7B644AED, 0x690E6658, 0xE55D6972, 0x8587BBE7,
+   0x43FEFA1F, 0xABFEFB5E, 0xC9B08AFC, 0x70F4DEF0,
+   0xC2E456A5, 0x25767D9B, 0x00DC593C, 0x323FC346,
+   0x7861F8E2, 0xA0DEA176, 0x0E89DBCE, 0xEE20E2AF,
+   0x587C487E, 0x58EA83A6, 0xBE5AB9EF, 0x4E2D4AE3,
+   0x0DD5D348, 0xC176E9A1, 0x8B5BFE3E, 0xD42103E3,
+   0x433D59C1, 0x38306D18, 0x15CDD514, 0x0E6A56D4,
+   0x558462CC, 0x4FC402BE, 0x3BCDE31E, 0x3F72C45B,
+   0x54A1A577, 0x30330E08, 0xCC40E084, 0xAF706F1F,
+   0x42080734, 0xAC467834, 0x77B8D2CB, 0xFAF96531,
+   0x56C98FED, 0x67DCF33B, 0x93302AF0, 0x2679D603,
+   0xF35956DF, 0x81D590E4, 0x7278C36B, 0x8D9C0D6B,
+   0xDF31182E, 0xB8326190, 0xACF4B8EA, 0x9FD8DCD7,
+   0xC0ED7793, 0x0B8309ED, 0xDFD1D63E, 0x322458FC,
+   0xC50CE511, 0x16422994, 0x5542D628, 0x2E80EF97,
+   0xB2B9FECA, 0xEF066EB2, 0x9EE717F0, 0xE17611F9,
+   0xF7DAC096, 0xA912DC31, 0x38406423, 0x43AB1A5C,
+   0x5FF52548, 0x32AA1520, 0x44CB6336, 0xDF578F2A,
+   0xB1757A7E, 0xBD1BC239, 0x3C2BDB40, 0xEAA6823E,
+   0x5BF81BCD, 0x1A7DE530, 0x9285500B, 0x31882962,
+   0xBA9005FD, 0x9730719C, 0xEE426899, 0x8FD60125,
+   0x0E8B84F8, 0x8A12331F, 0xC3437AF8, 0x71C63A9A,
+   0x2C591712, 0x07264749, 0xDD1713A6, 0x71EA7056,
+   0x2FD2E464, 0xF106B0CD, 0xEDB52D68, 0xACB082CE,
+   0x939FD0F5, 0xFE5539F4, 0x3B54B401, 0x16BF7C20,
+   //Window 67
+   0x82291675, 0x9EDDCE1A, 0x1FBD66C3, 0xFDE42B6C,
+   0xCC9157FF, 0xF7829803, 0x448572B6, 0x2F260B66,
+   0x0F6BA10F, 0xF477B7CA, 0x671610DF, 0xFAB8664A,
+   0x74987483, 0x207D9A72, 0xA03E1E95, 0x7A2C1137,
+   0xC7F641E0, 0x5439A675, 0xD038D0F7, 0x3CE1B3D4,
+   0xD267716E, 0x37514E5F, 0x9A01BE2F, 0xF874BD31,
+   0xBBA60729, 0xD4EEB140, 0xE86D9211, 0x7697D5C4,
+   0xEEFEB9DD, 0xA6314573, 0xA9184242, 0xFA0E13BF,
+   0x36618ACF, 0x1B14FECA, 0x4EE130F4, 0x60DFAB92,
+   0xEAD45067, 0x5A626982, 0xFCA6A0C2, 0x47DE071D,
+   0x23D58E7B, 0xB31077F1, 0x0EAF942E, 0x88172C00,
+   0xE328A08F, 0xA81CFFC6, 0x7D4E2294, 0x6BED5824,
+   0x9A66ABC2, 0x5963E4F7, 0xEFB47355, 0x3E715A0E,
+   0xE893C55D, 0xEA05AA88, 0x9987C1A3, 0x275D9322,
+   0x263778CB, 0xAD648FE3, 0xEC6AA706, 0xEAE36E26,
+   0x9D87A8EF, 0xC82B815D, 0x434C81D3, 0xC25FDEF8,
+   0x83AE5332, 0x209810FC, 0xB25D5393, 0xE2F9C695,
+   0xDDF3A809, 0x60DA2D71, 0xBA9A9E0C, 0x8B449A5B,
+   0xE15AF9F6, 0xC24FC3D8, 0xBCFC2BF2, 0xE2BB6123,
+   0x0FA11D94, 0x73713560, 0x4A7D0F33, 0x01F01293,
+   0x706A5426, 0x18799693, 0x3F3BEC0E, 0x90AD907C,
+   0xB5350980, 0xA95D4A7D, 0xD58F507D, 0x5A9A2BF9,
+   0x260D8108, 0xC261AD56, 0x812ACB6C, 0x38C3F6BE,
+   0x51FD512E, 0xF47799D7, 0x592B09F5, 0xD60792BC,
+   0x90BA5F94, 0x96CF928F, 0xBF207DF7, 0xCBB459FD,
+   0x587FCA5F, 0x80D7D677, 0xD9CDA304, 0xAC0E1979,
+   0x86568E13, 0x02095C71, 0xE26D26F0, 0xF60E669B,
+   0x18A3ED79, 0x4C248543, 0x7109E985, 0x8250AFE4,
+   0xF0FF653A, 0xF01AD496, 0x78332B3F, 0x12C29E21,
+   0x906B35F6, 0x9ECD5A04, 0x0875A3CC, 0xEB908872,
+   0x886FDBAA, 0xC5A8EEC5, 0x95B62893, 0xE08B3AE0,
+   0x5D45FBC4, 0x64AC8D0B, 0xD3956103, 0x79829EF8,
+   0x4E846CBD, 0xDEC4AB1B, 0x59A1DE14, 0x96CBC878,
+   0xB904C422, 0x2CA42233, 0xC6BCC809, 0x41EA4C5D,
+   0xD2CB2D4C, 0xF64BE358, 0x784F2396, 0x46DEF0B1,
+   0xCFF35DA9, 0x5AE1BD8A, 0x630B8519, 0xB2CA5C01,
+   0x5F7C2063, 0xAAF29006, 0xCABF986E, 0x242D0717,
+   0x2E1DA9AD, 0x8879B69C, 0x2CC08A8C, 0xEE85FBDE,
+   0xF0DECA01, 0x75A5AA4D, 0x6AC098D7, 0xF6394903,
+   0x1FAD9837, 0x55E18907, 0x750266BA, 0x109EB44B,
+   0x8DCF9324, 0x75C96E2F, 0x645060C4, 0x77F18B1F,
+   0xE6EBD7B0, 0x35A8D4DD, 0x819E3BC7, 0xDE3FB1FA,
+   0x62B360BA, 0x56A9B006, 0xAB241FDE, 0x68D7F61C,
+   0x92D3AF29, 0x1DAC8206, 0x9931F919, 0xDB9B4F4C,
+   0xEC2DD197, 0x8212BE0D, 0x306364EA, 0x777D50E9,
+   0x93A71458, 0xB2BCDA41, 0xDF0A4A13, 0xCE1BD6EA,
+   0xD26B87A7, 0xF3452006, 0x536E3165, 0xA1997CD9,
+   0x89FE379E, 0x2D7A87C4, 0xDCB57860, 0x7027303C,
+   //Window 68
+   0x47F8E6E8, 0xDDCA4B69, 0x124C3655, 0xCFAEE2EF,
+   0xFD59D024, 0x63239E5D, 0xBF716A7E, 0x1272D9FD,
+   0x5A3F4D14, 0xE434BC3B, 0x88138C55, 0xE8B3261E,
+   0x0454B468, 0x3E51527C, 0x1AE5A919, 0xE42FCE6C,
+   0x96E0B000, 0x87F04548, 0x2A1D5EFE, 0xE9C7AD4C,
+   0xC445565D, 0xE83EFAE1, 0x3D904F20, 0xBFF63109,
+   0x29FD8E67, 0xE9F11DB6, 0x06C4788A, 0xC16FE3CA,
+   0xDA321B13, 0x378970D0, 0x9C62193B, 0xCABC145D,
+   0x826F1076, 0x186995FD, 0x6B39E8F1, 0xE0F485F2,
+   0x67D77C2B, 0xA313FC5B, 0x5BC7A502, 0xAA1B21EE,
+   0x21FC6DF5, 0x9A69F47B, 0x29248F07, 0x0DD04260,
+   0x7DB98F6C, 0x11EECBAF, 0x831A76D2, 0x39397130,
+   0xE1CC7BBA, 0x9C87FEB0, 0xB4552B9D, 0x98A012BB,
+   0xCB98B4C4, 0xF34CDF85, 0x5C5BAEB4, 0x2B566C96,
+   0x6132B6F3, 0xC358ADD9, 0x16C98180, 0xE7ABB758,
+   0xA9DF4A96, 0x6519D59B, 0x2B913A9C, 0x0F63648B,
+   0x0F2586FD, 0x15A5B96C, 0xED2BC940, 0x362F9FD1,
+   0x77D5AB40, 0x7221A69A, 0xF2D4EA2F, 0xB3B69534,
+   0xD5DDB2C1, 0x7F544AE0, 0x6C92E21F, 0x7D87C171,
+   0x36A637D7, 0xC247330F, 0xE12CF335, 0x4D92478C,
+   0xD1A44B75, 0xBE516093, 0x04AAF3CD, 0x25E58894,
+   0xE0B40CC4, 0x83C301CC, 0x0FA102AD, 0xD2251CA0,
+   0xA6AD9C2E, 0xD483B070, 0x843744E3, 0xAC54101B,
+   0x4E09FE66, 0x034423FC, 0x6D471945, 0x0DBACBA8,
+   0x4125743C, 0xF6D4328D, 0x26F31BF7, 0x03A28DEF,
+   0xADF0FC3A, 0xD3376A91, 0x367A363C, 0xD4139258,
+   0x0F976D28, 0x5A50BB61, 0x8B922D2F, 0xAAE486A8,
+   0x426BF2EB, 0xCA401C14, 0xCD7FB3CB, 0xBD56447C,
+   0x41506FFD, 0x3E521E53, 0x11619BC1, 0xDAE970A2,
+   0xCB089F24, 0x1CC313EB, 0x94152942, 0xC0B9A447,
+   0xCB3CD9F8, 0xA3194FC0, 0x440BB25C, 0x93E5F081,
+   0xB9617573, 0x0B37D903, 0x6BC1DA7C, 0x35BA36BA,
+   0xACBD099E, 0xB5DE1FFE, 0xCCFDAFCD, 0x812809B6,
+   0x62C6AC35, 0xC2FD1E73, 0x947A09D4, 0x54A34C37,
+   0xEA8889F6, 0x77584472, 0x3466E0A7, 0x5056B521,
+   0x62D812A5, 0x36FD58A5, 0x31942E2D, 0xEC45EF81,
+   0xCE75835A, 0xE062D9A2, 0x487BBFAD, 0x884ABEE7,
+   0xF1ABE7C9, 0x266B74B6, 0x5CA9D450, 0x49B22673,
+   0xB6BE787E, 0xA4C647CA, 0xB1A4DB7A, 0x68F9B428,
+   0xCE15A1FB, 0xA9AF0DA8, 0x1B661C28, 0x7270F250,
+   0x024D102D, 0x55D5BDAA, 0xD2668D46, 0xD048A5D4,
+   0xA686913D, 0x8C199FCE, 0xFFC89A89, 0xFF5B83B5,
+   0x80667556, 0xB171B1D4, 0x8D04D7B5, 0x2583F1C7,
+   0xA965C20D, 0x8705495E, 0x3794287D, 0xC9AE3249,
+   0xD7A6352A, 0xBB7794C4, 0xED469D08, 0x0A43B4C5,
+   0x8AF82448, 0x670305E0, 0x906C002C, 0x956FFE4B,
+   0x052FAA22, 0x8ABBA210, 0xABCF9B80, 0xB6B10A15,
+   0xF0866D64, 0xC267B611, 0x6CEE21A5, 0x799DBC43,
+   //Window 69
+   0x9ED1436F, 0x66F2906D, 0xA02CCE5B, 0xBD93B0F9,
+   0x998709C1, 0x668531FA, 0x1EB74C1C, 0x94F85BDA,
+   0xAE51C7B8, 0x79728904, 0xDE5427A8, 0x302E9B41,
+   0x8B8E632A, 0x9DA5EB75, 0x2A67BB20, 0x04F9430A,
+   0x337B7D77, 0xDBEC6713, 0x8BC3C1DD, 0x9366B0C8,
+   0xFF98C3D3, 0xBFE1079A, 0x4E0463E5, 0x17B3545E,
+   0x136D90D7, 0x96033FCC, 0xFD33E30F, 0x4EC28C65,
+   0xDE5D6D44, 0x0CD4DAF8, 0x5C5FE593, 0x696B5263,
+   0x93FFAF87, 0x3CB874FB, 0x88F6AD2B, 0xDF49A4BE,
+   0xA5B86DFC, 0x4E1EE44A, 0x49A269CC, 0xB773FB7C,
+   0x1A98DD88, 0x71C9205C, 0xBDF65541, 0x6929C99A,
+   0x7FD87239, 0x4C829CC5, 0x4AC1AC84, 0x0605EC6B,
+   0xEA14CE52, 0xB6E15BCA, 0xBCD4579C, 0xC92CAD8E,
+   0xEB268922, 0xE883D637, 0x280111D6, 0x534C9707,
+   0xC7CA391C, 0xBA93F4D1, 0x0252312A, 0x68623235,
+   0xC725F8E9, 0x31714AF6, 0x2D83CA60, 0x51E177FD,
+   0x4178DC79, 0x8E90CDB3, 0xBDE03F9F, 0xD127E41F,
+   0x7C4E4C62, 0x8499AE83, 0xDED8BE29, 0x76ED0EA9,
+   0x711CB6D6, 0xD566FA48, 0x23EEF16C, 0xEE5F7872,
+   0x37B9B4D1, 0x744AF9AA, 0x6543B018, 0x05BAFA20,
+   0xF791D946, 0xEB3017A7, 0x261FB1AC, 0x866AA727,
+   0x2D3380F6, 0x50EC55AB, 0xB6A531DB, 0x387EACFF,
+   0xF1301524, 0xD1943972, 0x4EAFA2CF, 0xF2B7B649,
+   0x72CCA571, 0x34CD21DB, 0x52C6878C, 0x6BF5946E,
+   0xBE161594, 0xE99A0189, 0xF8633538, 0x07A96FD5,
+   0xE2C23722, 0xDA4C202B, 0x6C626266, 0xDAAEB93F,
+   0x3AF552DD, 0x416A4466, 0x499550E9, 0xE6399789,
+   0x05D957FD, 0x1DFC889B, 0x173F9983, 0x5D0C2306,
+   0x4C4EA01C, 0x771A6B72, 0x9A7FF7F6, 0x43311FF8,
+   0xE4D31AB4, 0xB770A5C6, 0xEAC7AB67, 0x6F380C1E,
+   0x3F9E0142, 0x9B0A4AB3, 0xDAF8B2AD, 0x28C8B8B8,
+   0x793432BA, 0x19BC9420, 0x3BA8A609, 0x0923F58B,
+   0xF18DB394, 0xCE65C53D, 0x897AEBF1, 0x8DF92192,
+   0x7874B967, 0x403178B8, 0x0B184268, 0x3AFE2EE5,
+   0x8461CA35, 0x979EA6DC, 0xA7866CF3, 0xB0CC1D95,
+   0xD9EA83C1, 0x31E69D54, 0x426DCC86, 0xEA529150,
+   0xC4A42C9F, 0x88D68A14, 0x972B8D83, 0xCD72504A,
+   0x6710CF53, 0x391AE43D, 0xA6182AFA, 0xF690B61A,
+   0x9A38B684, 0x4ED1BB2C, 0x76A9B5F9, 0xB5B1743A,
+   0xCC2C2077, 0x46494C6B, 0xA86054CC, 0x515477F1,
+   0xECCDA5C3, 0xC60E0E72, 0xB5965C8E, 0x81646C24,
+   0x6149CAD6, 0x21D142FB, 0xAFF4E49A, 0x545A406A,
+   0xD4D30109, 0x9DB82513, 0x30042D0A, 0x306460D3,
+   0x341D2B1F, 0xD517CAD6, 0x47EEC1C9, 0x2AA3CA17,
+   0x7AFC962B, 0x7A758CE3, 0xE44732C2, 0x4E33CFE0,
+   0x4CD4FCC7, 0x62C31E25, 0xAF497161, 0xCD83554E,
+   0x35AC13BA, 0xDC2480C6, 0x3A658F11, 0x9127CA31,
+   0x70D52CCB, 0xB94542A9, 0x8343F5A7, 0x8E37F785,
+   //Window 70
+   0x7742BFF0, 0x3FCD7E30, 0xF1F19FD8, 0xD81BE3FE,
+   0x7722F9A6, 0x50708B65, 0x810CBEF3, 0x8D509A8D,
+   0xC413C682, 0xFF08F667, 0x7C111C0C, 0x1E12DF49,
+   0xBA51B083, 0x27A8B1D6, 0xB41A3FE4, 0xE0B4EDE3,
+   0xA0A03C29, 0x93EDB60C, 0xBC442F42, 0xE95D089D,
+   0x36E05F20, 0xDCE08BAF, 0xA652F7B0, 0x016C3F70,
+   0x13DDADFC, 0x59BBA30E, 0xBD400092, 0xE7617816,
+   0xC6315FB7, 0xB965AF08, 0xC1BA2876, 0x71804BC8,
+   0x63C62F04, 0x1FDF8553, 0x277700BC, 0x3E6F80CF,
+   0xED77F3FB, 0x4338E871, 0x683AD259, 0x7CFAED75,
+   0x6B049B5A, 0xC347640E, 0xBF012314, 0x86C60E59,
+   0x64248F7E, 0xFAD74BE9, 0x92618A29, 0x37EC6B11,
+   0x9A1D0EDE, 0x31C61955, 0xD7B81EBD, 0xC0D74C1A,
+   0xBD7476CF, 0x8701D4D1, 0x6FE96E07, 0x7B82D1D5,
+   0x1A38214A, 0x7928FBC2, 0x492A12E6, 0x57D49E82,
+   0x11E6614A, 0xE39FBEE9, 0xD4C67502, 0x9780611B,
+   0x0565ABA3, 0x9AFCF7E6, 0xD2121C14, 0x89676BA9,
+   0xFDEA7C44, 0x641743BC, 0xEF3C7686, 0x891BAA69,
+   0x316B684D, 0xAFA599EB, 0x21E57851, 0x9A5C584F,
+   0x53BE3697, 0x1CAA6488, 0x77B94747, 0x37963F85,
+   0x7185AF64, 0x83043E87, 0xB5B271F5, 0xB3533B6C,
+   0xB86EDD4D, 0x6CEAAE49, 0x2714DAF8, 0x27C4177F,
+   0x942F9945, 0x81B4163E, 0x784C785F, 0x56D7AA13,
+   0x3994D05F, 0xEB53B9BC, 0x06615F84, 0x2917D343,
+   0xBA613C1F, 0xE81305E3, 0x7587160B, 0x770776CB,
+   0x29BC3D2C, 0xDCC4870A, 0x41CD777D, 0xCA0F0000,
+   0x97EA06B2, 0x5373BE3A, 0x4192319A, 0x2D2E1ED8,
+   0x58432407, 0xDA2786C6, 0x578A6E4C, 0x2608BA51,
+   0x08D45751, 0xB84980E0, 0x71570E50, 0x941B75FA,
+   0x56EBABA4, 0x67EA5480, 0x26D16EA8, 0x1AA04BC0,
+   0xE4EC9363, 0x6FFEAED1, 0x629ACB81, 0xA2C5CE49,
+   0x2A80D7B5, 0xF7C2E0D1, 0x9114A8E1, 0x22F92216,
+   0xC56EA187, 0x791F3C54, 0x3734E44E, 0x17FAEDEA,
+   0xE0CCC012, 0x9CBB32A6, 0x2A2787C0, 0x804AE3FB,
+   0xD99E244A, 0xF56C3DC3, 0x5319481C, 0xD17749EB,
+   0x9B672D87, 0xB43ED5EF, 0x91ABFEA6, 0x44035E0B,
+   0xFF890967, 0xB43665EB, 0x152B31D5, 0x9298AAD0,
+   0xB4827EEB, 0xFFEC30C5, 0x509342F7, 0x28DCA2FF,
+   0xCE9FD9F4, 0xC2ADF324, 0x69CDA678, 0x565BC5AE,
+   0xA5880C3F, 0xA7B34B3B, 0xFDF63268, 0x54CA2D7F,
+   0x5AC3DF3B, 0x39A3862B, 0x34F977B9, 0xD95D3EE7,
+   0x4660556F, 0x51FF4BC9, 0x6DBDA089, 0x4058101A,
+   0x77188CA9, 0xC71BB595, 0xBF087C63, 0xC4425780,
+   0x2E48E513, 0x743B4B47, 0x754806D0, 0x75C53201,
+   0x5C171573, 0x50A7E773, 0x7E9C872F, 0x71C18FAF,
+   0xD4E77F4D, 0x8BD16EED, 0x9908FB93, 0x8A3E4E1E,
+   0x268A27E9, 0x7367420E, 0x88256DD1, 0xB1644C71,
+   0xAECEC76E, 0x1EB51079, 0xEB4ACB67, 0xAEEA4085,
+   //Window 71
+   0x526B2679, 0x23EC0027, 0x1C91D6D0, 0xA4214685,
+   0x3F4783FF, 0x16C1DF9E, 0xEB51FAB6, 0x8ECFDC22,
+   0x1FCE1183, 0xDEEE0F97, 0x035E6988, 0xF1D06B58,
+   0xAAEED382, 0x13E475D2, 0x222A1ACB, 0xA7591818,
+   0x181BFEAA, 0x69C8C2A1, 0xDA76F82A, 0xF1890009,
+   0xE9C9BB60, 0x129162D3, 0x68517103, 0x8CB496FD,
+   0x99232BDF, 0xDEE9E0DA, 0x7AC8BF47, 0x18B9595F,
+   0xC8944D3B, 0x3F5E0D74, 0x16A0D2B5, 0x2EF15C12,
+   0x634DDEB1, 0xCFDE1A3E, 0x04B6D7AB, 0x5305E591,
+   0x0A70CB0D, 0x101FEDDF, 0x3146CC6D, 0xC379E4BB,
+   0x762111C4, 0x533B11DF, 0x1CD6644E, 0xEAD38629,
+   0x00304BE8, 0xB2B76A7B, 0x7EB7F0E4, 0xE910BC13,
+   0x514D0F99, 0xCEFD2E4B, 0x51E09457, 0xAF1E4F2B,
+   0xCDB421BD, 0x7B97C77A, 0x16D2515C, 0x3208DF88,
+   0xCFFA55F3, 0xBEF536E4, 0xB12CD5C6, 0xAA52879D,
+   0x2FE4C0E7, 0x60A82397, 0x18F0E58C, 0xD7054D02,
+   0xCBC0CC57, 0x0B4E7B8A, 0x705CC209, 0xD0D74F33,
+   0x7EB9B2DE, 0xAA392B40, 0xD9F67596, 0xE0C32646,
+   0xD68CE844, 0x87E391D9, 0xB6CA9254, 0x79C9B494,
+   0x10924587, 0x755AE3B9, 0x57018B4D, 0xF7B27047,
+   0x00C0FA71, 0xDB96F864, 0x54D9AB26, 0xBBDAE072,
+   0x093507D6, 0x2F9825B4, 0xC17DDBBA, 0x4BABBC32,
+   0x13FA18D1, 0xDBE80560, 0x929E0D68, 0x9601BC60,
+   0x07D875A2, 0xAE1C0C6E, 0x90823594, 0x1FC1F5AB,
+   0xB7C95F8B, 0x640E03C5, 0x868D0942, 0x12C6A7DF,
+   0xCB6C0C1D, 0xC153DD44, 0x51504E87, 0x3A4EA1DD,
+   0x6A3639F4, 0x4D730275, 0x6B15D9BE, 0x0E2AD296,
+   0xEA37B2CA, 0x1B605C2C, 0x062CFF6E, 0x9A1024C4,
+   0xB084A811, 0xFFCB2F92, 0x42A42142, 0x15A57C27,
+   0xCC417AC4, 0x8FEF5287, 0x82FC054E, 0xD1745912,
+   0xD78F5E34, 0x223DC040, 0x0116CD29, 0x0B5EA44D,
+   0x75DAA666, 0x901C98B4, 0x7ECDF663, 0xB7233A8B,
+   0xDF622EF1, 0xB70808CF, 0xBC2B7158, 0x8153F17E,
+   0xE4290BD4, 0xB4EE14A1, 0xEB6F41F4, 0x29D8F978,
+   0x014A92F4, 0x69151098, 0x0CC476DF, 0xE1E2D4BB,
+   0x9CB9131C, 0xBE1B6C69, 0x2ACA60E4, 0x44C6DB39,
+   0xDA1CECE3, 0xF1FF3A34, 0xDE541C07, 0xB753F1ED,
+   0x72919A68, 0xBB9936C9, 0x29CDAFAB, 0x4044CDE1,
+   0xD0201123, 0x5254A243, 0xAD190D90, 0x63044B4F,
+   0x5D62C7C2, 0x3F36A701, 0x3C33A8AC, 0x2187741D,
+   0xB342120F, 0xBB55D16C, 0xB067845A, 0x262F0EF7,
+   0xAD6D6DD3, 0x17BE8653, 0x3BCF3258, 0xD70AE229,
+   0xA0468DD9, 0x87BF2117, 0x0C70C6F6, 0xFB6304BC,
+   0x5016DEC7, 0x6F69BAE3, 0x2701F835, 0x999C65A6,
+   0xCB2F852C, 0x98E26F91, 0x98ABEB65, 0xFC8729ED,
+   0x42162DFE, 0x117BB206, 0x873F11D3, 0xD4C8EBEA,
+   0x9B6E3D5F, 0xF7D17DCA, 0xC9A42A0A, 0xA3BC61A6,
+   0x635C8C2B, 0x6906B7CE, 0x94CF9567, 0xD7DB88CC,
+   //Window 72
+   0x4905CA71, 0xE4BFC2C0, 0xD156F761, 0xF33A450A,
+   0xD08848C2, 0x3D8B29DB, 0xA2309686, 0x097DA395,
+   0x5F4972D7, 0x21190503, 0x17CBAA12, 0xB2D10558,
+   0x753EE324, 0xDDCEBB55, 0x6924666F, 0xE87AB07C,
+   0x4ECF1A68, 0x9B475D74, 0x2E6236C0, 0xF82BE8F5,
+   0x3CFD056B, 0x237C0DBA, 0xC3C6CBD2, 0x354CD872,
+   0x75E58CEF, 0x9695F735, 0x28586396, 0xB19A9FBB,
+   0x6DE55F63, 0x546404D4, 0x0850907D, 0x61605199,
+   0xB2D31BF7, 0xE0182345, 0x7604FAE7, 0x8472B963,
+   0x49B28E0D, 0x92C21387, 0x5299EFE1, 0x45FB72B7,
+   0x7ADD939F, 0xD631E4E9, 0x17E9D6CC, 0x0FA7CFD6,
+   0xCBB0F7B7, 0x42A0B0D6, 0xC8741294, 0x251467F2,
+   0xC2DD943A, 0xF3CBED25, 0x424F5265, 0x007DA251,
+   0x2320C788, 0xF5D115BC, 0x31753E2F, 0x990BEC91,
+   0x73B122E4, 0xFCAD1DE5, 0x417ACC6E, 0xA94CB07B,
+   0xB9516D33, 0x2223F73A, 0x878078DB, 0x40FA5182,
+   0x7969FB88, 0x3CA7A571, 0x08BE7280, 0xEDB60B9B,
+   0x397562BE, 0xDB109846, 0xBBF4DCB3, 0xA76546D4,
+   0x7A92E055, 0xF772079D, 0xC6B8DA27, 0xA8F5A88B,
+   0xF7A9CDBE, 0xC2C94D2D, 0x7625EAF9, 0x24D587BC,
+   0x60E6EB6D, 0x0FDE8F06, 0x241AB899, 0x186D6834,
+   0xAE4C265E, 0x2293E645, 0xEFCEA481, 0xF033A2B4,
+   0x65151EB4, 0xFA81C6AE, 0x347EF924, 0x1D6DCCBB,
+   0x0E9D1806, 0xFF88FDE2, 0x106C9A0B, 0x0A9FBA17,
+   0xB3861542, 0xBFC7ABB7, 0x4B7ED1E2, 0x16D6F914,
+   0xB46F837D, 0xFFE0EB17, 0xF246A586, 0x7B9A656E,
+   0x289D3A4F, 0x49ED5A2D, 0xF3032895, 0x4D19C787,
+   0xAB66BCCC, 0x719DD3DA, 0xB609C245, 0x1B30784F,
+   0xD3BF8652, 0x538C49BB, 0xEA2B7840, 0x3835EAFF,
+   0x88ABC586, 0x6EB37CC3, 0x781496CE, 0x6211C6A9,
+   0xA4833E4F, 0x3DF7BB21, 0xC70F9E78, 0x627608BD,
+   0x36479D0B, 0x12FFF68F, 0xE51D8855, 0x6A75BF6F,
+   0x1C5AC1DC, 0x03F1310F, 0xE8C3B111, 0x529FF0DA,
+   0x559C8274, 0x293CA7A2, 0x639168FB, 0x3A5F3041,
+   0x6CBFD162, 0xE42C6D00, 0xF7E99005, 0x5B6B16EE,
+   0x97D3BB0D, 0xD3454A01, 0x1C3368AE, 0xB8CF21E8,
+   0x50295856, 0x9684C930, 0x88EF060F, 0xFFC8C0BD,
+   0xAD840206, 0x90F218D0, 0xE3F8F6BD, 0x05FA1F25,
+   0x796AA45E, 0x79B53D41, 0xBFFE5623, 0xF09EBA03,
+   0x661E6664, 0xA99B769B, 0x3C837FA0, 0x386AF036,
+   0xC831E4F2, 0x96562BCA, 0xC3C0B6BD, 0xE3A43BAA,
+   0x17E75674, 0xACFC3E64, 0xACF26DEB, 0xFB144A63,
+   0xF470AF50, 0xC9BBBCA8, 0x4694DF91, 0xF799F903,
+   0x8F5E4EF6, 0x5FCDCA2F, 0x81DC4E60, 0x0EC6779B,
+   0xFB0BAFF0, 0x100C17C6, 0x55E8AB1E, 0xEB1833C9,
+   0xE73796D0, 0xB2E79219, 0x865E9128, 0x7C8F1779,
+   0x8658BBD5, 0x69A38E7C, 0x6D523F68, 0x840E2C3C,
+   0x324FFBA5, 0x48BF00E6, 0x4468DE4F, 0xB75B527D,
+   //Window 73
+   0x3F943745, 0xF9F5D75B, 0xC3F49B85, 0x4392035F,
+   0x31F666FC, 0xD4D06A53, 0x923B3473, 0xF8B09EF0,
+   0xECE2E50D, 0x56978EBB, 0x1DDD0F09, 0x83838B51,
+   0x3944B6D6, 0xCE66A52D, 0x20F79DB5, 0x988451EF,
+   0xD582BDFC, 0x4300B001, 0x147BB6E8, 0xB22F9897,
+   0x10685251, 0xF8B944EE, 0xC5A20177, 0x4C34F592,
+   0x14ED1DFD, 0xA6FBB9CB, 0x018796E4, 0x8FE4F939,
+   0xF59BDDD9, 0x971A14DA, 0x16360686, 0xB384091C,
+   0x313BB158, 0xAA75C686, 0xDB585F9A, 0x0EF43C88,
+   0xAA4E5DB4, 0x8B4251A9, 0xBF655C3C, 0xF8831AB8,
+   0x360EF6C0, 0x4BC9AE2F, 0xE3E7207B, 0x613C3C54,
+   0x3ABBB823, 0x1704326E, 0x866E9FF6, 0x970AF005,
+   0xFE02B5C9, 0x96A72F29, 0xC6C966ED, 0x530CBACE,
+   0x773D3E1A, 0x5F35CE28, 0xE31A40AA, 0xFC1C96FA,
+   0x82197D61, 0xA5DC1FD1, 0xF6DC8FCA, 0x9BEBA0E9,
+   0x604C13AD, 0x9E7E9464, 0xE0D1805B, 0x536415A7,
+   0x1DA3138B, 0xB6015D38, 0xF4A865FA, 0xAB757B3D,
+   0x602BB0B9, 0x2F5BFD4B, 0x0D8174CA, 0xF98A77DF,
+   0xA6804CA4, 0x5A536B57, 0x6E749403, 0x087492E0,
+   0x0F830731, 0xA78BB7F2, 0x507B13BD, 0x4E648568,
+   0xFCB59B90, 0x799885B3, 0x10422F91, 0xE54446E5,
+   0xA7B9D730, 0xDFDB9639, 0x5BBD6A24, 0xB883A82D,
+   0xDB7F6459, 0xBB866AA5, 0x53A67039, 0x5B8C6E31,
+   0xCA141A26, 0x4CC1CCB9, 0x75C424E2, 0x7685907D,
+   0x5B282142, 0xFC77E0A5, 0x601D5638, 0x99FEE0CE,
+   0x842AD706, 0xDCF85E58, 0xEA098C58, 0xB9E149B8,
+   0x14C5DA44, 0x501A2A8A, 0xCA01CB39, 0xFAED534B,
+   0xD0260696, 0xABDE81CF, 0xE4CEF636, 0x872E47DA,
+   0xC1BA5278, 0x297C2792, 0xB2E13692, 0x74CF7DFA,
+   0x78150230, 0x48BFCB5E, 0x412ADE4B, 0x16709359,
+   0xA1C6DD5C, 0xE61AD4B9, 0x15156F30, 0xB327BF2B,
+   0x0DD76479, 0x9047FAA3, 0x4935CE3E, 0xA9D92B58,
+   0x1B75157F, 0xEB79EBAD, 0x1F186B89, 0xCB5A6DA0,
+   0xF35E3BC5, 0xD36B89CD, 0x417F9085, 0x81FDF0E4,
+   0xEEFD5F24, 0x550D6545, 0x1AB11A8C, 0x6730CAA0,
+   0x3F881D0C, 0x108B72B7, 0xB18A9D16, 0x121FD9C6,
+   0xA3921D6A, 0xF733C6C1, 0xED97DBD9, 0xA537C99F,
+   0x1E1CA96E, 0x2AA803AC, 0x9A732E4B, 0x82CB00D9,
+   0x085B6ED5, 0xD3CD53F6, 0x69A48C66, 0x0FAB054B,
+   0x78B7A77F, 0xC308D020, 0x0108ACA6, 0xC4FAA9C8,
+   0xE56DF296, 0x662A1CB5, 0xA8727E92, 0x68D77BA0,
+   0x38573A50, 0x0C9E2A0C, 0x8D823FFE, 0x98F20543,
+   0xCB44D3E1, 0x93D6B4C9, 0xC61B43FA, 0x43FB347B,
+   0x573F389F, 0x5319481C, 0x8D91DD09, 0x3C3B4890,
+   0xF72263B5, 0x40055036, 0xA2A721BF, 0x5424D9D1,
+   0xB570C91E, 0x457D4489, 0xC74AE25D, 0x65D48922,
+   0x3ECED0B6, 0xEDD0CC48, 0xFF4A361E, 0x237A3D46,
+   0x23247165, 0xC4023401, 0x800310B3, 0xB0AA7E27,
+   //Window 74
+   0x2E0D7596, 0x91DB566D, 0x84AA1E72, 0xBD5B4980,
+   0x83F2E4D5, 0x43C7147A, 0x7A172CA4, 0x57D9880C,
+   0xB974258B, 0xDE7E71E6, 0xFED337F6, 0x228C9E51,
+   0x267BE621, 0x06A9C51E, 0x6885406A, 0x850869D3,
+   0x35D53004, 0x787532FF, 0x3A05A393, 0xEF212CA1,
+   0xC967CF9A, 0xD692A2D8, 0xAA79C4ED, 0xC24E75E6,
+   0x48A8EB3F, 0x4F65C439, 0x9C2ED037, 0x027845A7,
+   0x24C02FF0, 0x920E3D9D, 0xC6D3ED74, 0xA0FB955D,
+   0x8F49A156, 0x441A63C9, 0xC25D53A4, 0x0FB13320,
+   0x0F9112F0, 0xE7DDC2D6, 0x9B141066, 0xC693A1C8,
+   0xD87D4127, 0x6A3F66F0, 0xC8964C17, 0xDDCC9F5D,
+   0x0BF1A1BB, 0x5ED9A440, 0x566A86FD, 0x517E440E,
+   0xD6E3A961, 0x391527F7, 0x9F5BC5B7, 0xE2BCFCD6,
+   0xEBD66A30, 0xDDA3374A, 0x6485DF1F, 0xD3ABCDAE,
+   0x0AC145A9, 0xF64A2613, 0xD4CC0A15, 0x44A835F8,
+   0xFDABEE2A, 0x72D35F34, 0x55F15FF2, 0x2A6E9870,
+   0xF3FE8592, 0xB9576291, 0x7E3613B9, 0x41FD98AE,
+   0x307FE779, 0x5905E534, 0xCBB82ED0, 0xEE2744EC,
+   0x820D0703, 0x3E6AC049, 0xA1053951, 0x6337509C,
+   0x701067E2, 0x1FF3AC7B, 0xF1138EAF, 0x47919D0D,
+   0xE1AECD60, 0x3CE7E314, 0xAF5DC833, 0x7DB9585B,
+   0xB781D530, 0xB372DC18, 0x8161B109, 0x44E4A5AB,
+   0x5485C6DD, 0xD998265F, 0x9510C263, 0xEA62275F,
+   0x4EA3DFC2, 0xC86E3CCD, 0x577F56A6, 0x8B5956A4,
+   0x97001A2D, 0xFA3AACC8, 0xDDEB34C1, 0x45F61D92,
+   0x52883C03, 0xE331E5CD, 0xBBC10E5D, 0x0332F45B,
+   0x298360CF, 0x995838D3, 0x71A676BD, 0xEE75D255,
+   0xA6242A84, 0xA6D5B896, 0x10FE86CE, 0xCEDC9FA4,
+   0x1787173B, 0x3B3A979B, 0x30FD697F, 0x48D8D4A1,
+   0xFDD03FFF, 0x6B7733A0, 0xAADC2A44, 0xCC7D4315,
+   0xF4B1092C, 0xBFC276C5, 0x8C4EFDAC, 0x0D50438F,
+   0xB9545072, 0x41B0FAD1, 0xE18ECAFE, 0xCFBB77CE,
+   0x39BD62A3, 0x55704DBB, 0xF8D0A7B8, 0xB2D976D9,
+   0xEF0C179E, 0xB4038A9E, 0xB8557414, 0x65007FE4,
+   0x4E5E662D, 0x5B4DCAE1, 0x71E5344C, 0x4FDA189D,
+   0x2DBFFDF3, 0x920F0B66, 0x4CF514E4, 0xDADA0B87,
+   0xF6630583, 0xEE27CDE7, 0x88F993A3, 0x82D7B5C4,
+   0xA749AE31, 0x5B9081EF, 0x08AAB738, 0x21C2074B,
+   0x723B6025, 0x99DDBEFA, 0x576E7EFE, 0x52D05365,
+   0xEFCD6439, 0x8DBF9449, 0xD4E6FF57, 0xBAC6A75F,
+   0xC5EE4AB8, 0x198A0D17, 0x5F366969, 0x3E69871C,
+   0x10CF3636, 0x87A6D335, 0x750BFB27, 0x6BB5504A,
+   0x28D96CA9, 0x4F95565C, 0x052FA288, 0x48F21CAD,
+   0xEE983848, 0x579AFC98, 0x80217C68, 0xD351FB56,
+   0x2C3A0616, 0x3E19BBA6, 0x66F1FC1E, 0xD17298FB,
+   0x3FD9DDAC, 0x51F46D0D, 0x1E745F63, 0xA0F56674,
+   0x460D4F3F, 0x16BFBAB4, 0x0C7D2DB4, 0xD1FD393E,
+   0x983FB27A, 0x08320A82, 0xC53F381E, 0xF1BDEE26,
+   //Window 75
+   0xF3CDDF3F, 0x3CEDB737, 0x43C7549C, 0x2A4B4119,
+   0x29199BE6, 0x8D31786B, 0x29F24C09, 0xAAAC218B,
+   0xD9210950, 0x11FAC541, 0x30CC3EDA, 0x1BFD76A0,
+   0x00F30197, 0x07ABD762, 0xD4E9C563, 0xE364A04F,
+   0xD34FDE05, 0x0A18D7A8, 0x4DEF5A2F, 0x796343D6,
+   0xCDFB8100, 0x8C49BB4A, 0x6FEF27C9, 0x4BF2143E,
+   0xBB2229F9, 0x501D3093, 0x72527FDE, 0xD0907AE0,
+   0x6D3573B7, 0xE08F5321, 0xDD401C85, 0x45ABE907,
+   0xE7B992FF, 0x517DF947, 0xEEF50900, 0x3EE68336,
+   0x9419091C, 0x148A9162, 0x4CE6D5BA, 0xFA4C80BD,
+   0xF58A09D0, 0xF1234463, 0x4F0FCBF4, 0x19268B95,
+   0xFB059256, 0x10D777D7, 0xD370E6BC, 0x93D72DAC,
+   0xC0ED9F39, 0x8C0CB374, 0x46CDB439, 0xBE6D2F5D,
+   0x69C00B0C, 0x37F07538, 0x41EFFEFB, 0x44C39F4A,
+   0x03600BF7, 0xDD2A7584, 0xDB54A98C, 0x852A261E,
+   0xA1BB628E, 0x0EA751BE, 0xDA40BB85, 0x2EAC8EC1,
+   0x9768BDB7, 0x5A9973D6, 0x5C85DA77, 0x433EEAEB,
+   0xD57F9D14, 0xFF49FE22, 0x09767AA0, 0x93D933E4,
+   0x8331FABE, 0xD0FF407A, 0x5D078771, 0xC606CB7F,
+   0x2DF20C3C, 0x21E7AD05, 0x951C9FA4, 0x897F6A26,
+   0x8EF1AD2D, 0xAC828022, 0xEF18623F, 0xC50099D0,
+   0x0C1DF5B9, 0x2871FCCE, 0x33AA8A64, 0x112D2049,
+   0x7807EAB2, 0x9539E141, 0xED8A85A5, 0xC105357E,
+   0xEFC877BB, 0x09958E7B, 0x41EDBF53, 0xC9610B48,
+   0x6F1B6ECF, 0xA6F25661, 0x8A0611B5, 0x1583A764,
+   0x0D1455BD, 0x8197B57F, 0x2AC7223A, 0xEBC830A9,
+   0x832EA377, 0xE5B41B63, 0x51E0F326, 0x4A72A0BD,
+   0xFABDF519, 0xC571EE43, 0x1E32BB8D, 0x4FB3520C,
+   0x06926E7A, 0xD8A1D8E0, 0x5FAF078F, 0x7C86A13A,
+   0xBE2E429F, 0x5287F696, 0x09E1E341, 0xA37E39B8,
+   0x89B45CFA, 0x654CB285, 0xFF39C452, 0xA428DCA8,
+   0x5EE9882E, 0x1A8B9848, 0xF14871EE, 0x6A4497C9,
+   0x856DB1E1, 0x513BE6C9, 0xD2E0B5D9, 0x5B113D30,
+   0x9DFDC36B, 0x7202C3CC, 0x61BF8B16, 0x1EAAE80B,
+   0x0116A5FF, 0x41C8CEAE, 0x988B5CF2, 0x4EE0B758,
+   0xFCF26975, 0x7E5518FC, 0x3B8E1A5F, 0x4835EBBE,
+   0x0663CB59, 0x5ABF1250, 0xCCE9BB79, 0x24731A4C,
+   0x67673587, 0xCD7B6C11, 0x1DEAD97F, 0xC893829C,
+   0xF28B07BC, 0x7BDCDA5B, 0xEBB60CB5, 0xC39D5942,
+   0x2904589A, 0xA4F6FF0B, 0x1DDBB463, 0x31E42DBD,
+   0x220B2EE5, 0xC866DE13, 0xAA20661A, 0x04E72127,
+   0x420498C7, 0x58B94D9D, 0x94EFDB4F, 0x24B080E4,
+   0xC5EBB37E, 0x9027BA67, 0x23A87820, 0x6527C280,
+   0x7E9432DC, 0x726DD47C, 0x00ABA599, 0xFA27901D,
+   0xB9DA248A, 0x8C198D9C, 0x5EC9B51B, 0xC3500632,
+   0xC6F770A0, 0x3727FE88, 0x110E2DBB, 0x6C5B7EE2,
+   0x7266A738, 0x2D5BBD2C, 0x62131C84, 0x0868691B,
+   0x8BEE9B79, 0xC1A83F9C, 0x223AFB1E, 0x52B23BAE,
+   //Window 76
+   0x044ACC65, 0xBC988641, 0x48AC42B2, 0xB52DBE4D,
+   0xD8BE8B31, 0xD23337A1, 0x02C00B31, 0x875A82B4,
+   0x0E4D57AC, 0xB81682FA, 0xB31BCB79, 0xA79E73CD,
+   0x14F02364, 0x1EE8AF19, 0x91556534, 0x363211F5,
+   0xE5B5A54D, 0x70B3C1A1, 0xC1C64B56, 0x213F21AC,
+   0x7C98448B, 0xD53FF1B6, 0x1801EE82, 0xF968AA66,
+   0xA6524A1C, 0x0ACAB598, 0x08C9F887, 0xC01BBFFB,
+   0x3A95BC34, 0xA5D00CBF, 0xF23758BE, 0x01C58337,
+   0x25DCBF04, 0x36A59405, 0x6A7542B2, 0x641660E5,
+   0xAE10046B, 0xC3CB4E1F, 0xE939EF55, 0xA23713E3,
+   0x5224452A, 0xB0C9FB5D, 0xDBA19297, 0x763C32A3,
+   0x2C650D35, 0x0D90D498, 0xD4AD0FA2, 0xAD059F17,
+   0x2F0BA3EA, 0x670C4909, 0x9D447F60, 0x2E4537EC,
+   0x1B45DF90, 0x3FC04416, 0x6AA89EB4, 0xD7417D79,
+   0x0D58052A, 0x6C49EC2D, 0xC6A043C7, 0xDEA2FC6C,
+   0x369DFEFB, 0xB3657483, 0xAEE6F303, 0xD790CBDC,
+   0x4E931564, 0x6C91B28E, 0xA4DEABBC, 0xB211ACAA,
+   0x09C20F42, 0x310A9449, 0x090C4B8D, 0xAA4767DF,
+   0x290F93F5, 0xC1D9A6FB, 0x5017E649, 0xE1B741C8,
+   0x3B4DE560, 0x9981F671, 0x0EDAB5F0, 0x2FD78CF3,
+   0x6CEA93E4, 0x80A92502, 0x5ADB162D, 0xA3A7EAF2,
+   0xDD67D52B, 0xF604130B, 0x48BFE590, 0x9F53BACD,
+   0x7BCEC6A5, 0x20B12F11, 0x134C1978, 0xB069A822,
+   0xDB663EFB, 0xF9FE0B7B, 0x187CD22F, 0x95D3C5EB,
+   0x857AA496, 0x13FE92C2, 0x5A141312, 0xF2201BE7,
+   0xD7B1C50D, 0x24B8561B, 0x5F2BC263, 0x9C29D22E,
+   0x53466344, 0x4125007C, 0x9E41C7A1, 0xC396CB5F,
+   0xBEA81761, 0x6DEA313F, 0x25818CEF, 0x141E8595,
+   0x790A95A7, 0x712724D3, 0x8FE02B6C, 0x1876A21D,
+   0x914F3AC8, 0x04A03002, 0xB18D5B6C, 0x990DAAFA,
+   0x9C9957E5, 0xFB22FE3C, 0xA7532A49, 0xCC0FE847,
+   0xFC8720EA, 0x028E521C, 0x54B0F028, 0x1CD20813,
+   0x3D31C0DE, 0x2C66A69A, 0x54584BDC, 0xD39F5BB4,
+   0x64C5B27D, 0x0AA87886, 0x3322ECC6, 0x37FC610D,
+   0x5ADC82F2, 0xED9FEFBD, 0xFAD7032F, 0x1E4F0D63,
+   0x15585EEC, 0xD05DF7B5, 0x6436D964, 0x322FDA25,
+   0xDCA24B8C, 0xC6E5EB14, 0xE194C40D, 0x95D76174,
+   0x3B4F4AC3, 0xAAF2D670, 0x7F56B206, 0x11B43D5A,
+   0x166D6F10, 0xBB842951, 0x31033FBF, 0xA1B9EB7F,
+   0x59976B45, 0x23FE6903, 0x4321DB9C, 0xA71140DC,
+   0xF4ED6E4F, 0xA7EC5274, 0xDFAE6F75, 0x8F7DC1DD,
+   0xE8DB2700, 0x72A6FDBB, 0x52178247, 0x30B63598,
+   0x49188326, 0xE3190E52, 0x02D0301D, 0xCD5BE94D,
+   0x8EC2EFE1, 0x5E4F4FBE, 0xAE7C9A25, 0x0811B15E,
+   0xA14B52EE, 0x88015737, 0x9288679F, 0x3773F0A4,
+   0x79291BF3, 0xD198C9C0, 0x8CFFA915, 0x669E13C3,
+   0xDD2A2F1E, 0xDBC28F7C, 0xEB51F242, 0x808BF8D3,
+   0xA79571EE, 0xD64F2ABF, 0x6A363FC0, 0x47226BAB,
+   //Window 77
+   0x31E76220, 0x3992D2A1, 0xFF7003C6, 0x7AD2A60B,
+   0x8F1546BE, 0xDB6A4D39, 0xE8A1A2A3, 0xB13228B1,
+   0x993D3A02, 0x1470159C, 0x9E9BF4D9, 0x5B4E8B1D,
+   0x0CD001D1, 0x6FCB85E9, 0x3DF1DFE2, 0xE0781A9D,
+   0xC8A2265B, 0xF650285A, 0x37A9B579, 0x8727088A,
+   0x22C74609, 0xBB844DF2, 0xD5476D33, 0xC3742094,
+   0x830E736A, 0x1A834759, 0x3BAC0AA1, 0x43DBEB20,
+   0x1A431CEC, 0xEFC30524, 0xB0B02928, 0x1F5394B6,
+   0x0F8730F9, 0x778DC88B, 0xFE7A2787, 0xB2CBEA43,
+   0x0F60B45F, 0x73B0844B, 0xE6F7DAED, 0x8B07B4D5,
+   0xCED3E58D, 0xFBAFDCD9, 0x403D88E7, 0xDF42265D,
+   0xC0E914E6, 0xC69D7D8C, 0x4E8B527F, 0x7FC0CF36,
+   0x13D8D437, 0x19FA5490, 0xFC046307, 0x4D173D65,
+   0x3288E484, 0x9970F608, 0xA2B18C99, 0xA2FEF7E5,
+   0x7AAB3BC6, 0xC36FAFAB, 0x3ACF3677, 0xF570F752,
+   0x267C967C, 0x8D5F1F92, 0x1EAD5510, 0x75841853,
+   0x54A6BDED, 0x0D9D9FE0, 0x16F81849, 0x9F4EDFFE,
+   0x017672F2, 0x9ADD0F8A, 0xEE689901, 0x5F7B305F,
+   0xE0EF74D7, 0xEA743F9D, 0x709B69E4, 0x9BEB2FC6,
+   0xDD9BF27C, 0x025DB58F, 0x164E8FEE, 0xCDD4751D,
+   0x0D81BB31, 0xED2E3D39, 0x8A9A643F, 0xE1DF95AD,
+   0x0EFE1CC0, 0xE990E159, 0x407888C3, 0xD76F9D79,
+   0x41D155B4, 0x16F021EE, 0x3D51649E, 0xC91D89DB,
+   0xF6952E6B, 0x05FAA47C, 0x3169D985, 0x31B96478,
+   0x6C7A75E8, 0xC66B2C77, 0xFC5B3B31, 0xC9F8359D,
+   0x690ABC52, 0x59D88B53, 0x1F15DA24, 0xF53F8547,
+   0x0EFC94A7, 0xF1B34148, 0x7AC4AB3C, 0x83A7FF93,
+   0x62B1B89D, 0x7D279089, 0x1DB539E4, 0x91FD153F,
+   0x76853634, 0xC1308779, 0xA4450155, 0xF3CD85DE,
+   0x7D51B288, 0xB436E70B, 0xA813592A, 0x2C408A05,
+   0x3961548D, 0xA27229D8, 0x588ACE2F, 0xBB10AAB8,
+   0x2A5115A5, 0xF29A3119, 0xD0A7E3CA, 0x4114FD8E,
+   0x05F1954E, 0x06AB2002, 0x8860EEDC, 0x3288A7CE,
+   0xE209558F, 0x17BD7B17, 0xD13695AD, 0xDBBA6AA3,
+   0x5DE49089, 0x14D3DFAA, 0x0F38C1A9, 0x8F0115C8,
+   0x8F242AD0, 0x02C8D588, 0x56C402F6, 0x9E6FD1A0,
+   0x81F291A6, 0x15DBEC5B, 0x7BE36F59, 0x1B74D862,
+   0x075603D2, 0x7F05DABE, 0x2461C8F7, 0x2B657D42,
+   0x22EC731B, 0x9F8BA6BE, 0xB80714DD, 0xD95232A5,
+   0x4DAEC796, 0x25A646B0, 0x53D422AD, 0x6E434419,
+   0x3CE86B7C, 0xB1710E0A, 0x694A30A7, 0xEDAB3EDA,
+   0x45620953, 0xC6E69FB4, 0x2AA70380, 0xB36C1C1C,
+   0x75A97436, 0xECADAC31, 0x9298C96E, 0xC419E2DB,
+   0x7912C307, 0x280BF117, 0x043F376E, 0xA84462EE,
+   0x7EF12F25, 0x8D09225A, 0xD29E6CCC, 0x970349DC,
+   0xBA91BD66, 0x39AA55BE, 0x84A0AB64, 0xB225D04C,
+   0xC2DA4691, 0x76F1438C, 0xBCDC62EE, 0x8F553F81,
+   0x785AB369, 0x80C7FD6E, 0x05331EF5, 0xB15909EB,
+   //Window 78
+   0xD9A0D716, 0x09DA59B0, 0x3BA58128, 0xE90F2266,
+   0xF30671A0, 0xE867DF85, 0xABA22D8C, 0x4BF10CFB,
+   0x18406EE8, 0x017FAF54, 0xB97C0053, 0x4CBF6414,
+   0xB0228BD2, 0x516090D9, 0x80745095, 0x2599843F,
+   0x28A501BE, 0x2FE05207, 0xFEA4FA16, 0xBFFE106A,
+   0xE03BAEBB, 0xF83A3767, 0x8EC66837, 0x71B00E3D,
+   0x4C25596C, 0x4AB92574, 0x2F6A490D, 0x25A08409,
+   0xFEA22274, 0x9ED3A633, 0xB8EC1AE6, 0xEE083594,
+   0xF8F2C6A4, 0xF47609ED, 0x51C058F4, 0xFABDECA0,
+   0x43F8483B, 0x8D602438, 0xF90238D0, 0x78A0041D,
+   0xA2A80DA3, 0xB7F38876, 0x5C043308, 0x7FB8D3CE,
+   0x28AEB3DB, 0xC00BE406, 0x6BD6CACE, 0x488601D7,
+   0xAE6A9620, 0x22E5DC3A, 0x64028168, 0x86B97565,
+   0xB05B0C7B, 0xEA92FB09, 0xEBBC0F6E, 0x824E80E4,
+   0xE3A2D1A6, 0x7138DC71, 0x46D06239, 0xEBE4307B,
+   0x02A62BE2, 0x6A985020, 0xEC54BE9B, 0x51D10C05,
+   0x74400C6A, 0xD008062B, 0xFBA8FFF0, 0x3580DCE7,
+   0x15905E78, 0x21B3DCAC, 0x1905F5CC, 0xBAE8E645,
+   0xE453A00C, 0x59E7E3E6, 0xE561266D, 0x47AD4F4D,
+   0xD303B4AE, 0x968C98CF, 0x32C514B1, 0xA5A1535D,
+   0xD0B967B3, 0x68EF1AE2, 0xFC36DAC0, 0xEABA3FE7,
+   0xD2FEC6B2, 0x3CB002A8, 0x8D4956B6, 0xDF9074FB,
+   0x92A5AA02, 0x64647CEC, 0xD0270D69, 0x30871C8F,
+   0x2EEA7C50, 0x27DB5489, 0xDB101985, 0x61EA9B8E,
+   0x79304CBF, 0x1C2A9CA1, 0x2A46F581, 0xFF365226,
+   0xF2492239, 0xBAC0C9E9, 0x97D8E491, 0xC70AD033,
+   0xF7391433, 0x9271FD0B, 0x13F9A636, 0x02FE125F,
+   0xFA6AA293, 0x4B20FE64, 0x6E9B7A03, 0xBCF05D01,
+   0x417C09D7, 0xB990FD5B, 0x913F5F06, 0xBF877C84,
+   0xFC8E5CC1, 0x7213AC1D, 0x127DEC03, 0x68C499A7,
+   0x90464B2D, 0xB7C2A235, 0x6ECDC8C4, 0xDAB7045B,
+   0x4FE5301C, 0x0FE662BF, 0xB45A0B6F, 0xC3844D0E,
+   0x64AF8E44, 0xB33E418E, 0xE5D364B1, 0xD37F8DA4,
+   0x0E2002E5, 0x9B8F6F7C, 0x50851BF8, 0x2B790A72,
+   0x944E77F3, 0x227FCDE0, 0x8780B1B2, 0xADAB6BD7,
+   0x7763AA57, 0x07DDE5A2, 0x44E31BFC, 0x6F5ADA36,
+   0xE4094860, 0xBFB24177, 0xC30F98E4, 0xF8C6C5DF,
+   0x72188930, 0x225EF286, 0xA639A312, 0x72C4EC24,
+   0xB7E9788B, 0x7AD0C2DB, 0x599317D1, 0x404D9AEC,
+   0x22588145, 0x6881E1FB, 0x073AE523, 0xF38548EF,
+   0xAC7EB65F, 0xC17AEBCC, 0x81FCB98F, 0x42F3D6B9,
+   0xA13ECDD9, 0x6BA68F82, 0x10B52C8A, 0x7E41C7AE,
+   0x23710977, 0xFF36757B, 0xEED61A49, 0x017EE605,
+   0x2128997C, 0x8F3BF34A, 0x7B0BAC0D, 0xE225F28E,
+   0xC09210BF, 0xE6E2651F, 0xB2C39790, 0xB53936A8,
+   0x5CAF78C2, 0xC7874B27, 0xB06CA9E9, 0x5578EC0C,
+   0xDAA7A3D2, 0x15527E91, 0xD986A20E, 0xB73BF2E6,
+   0xEAB417E8, 0x109A956B, 0xD592E983, 0xB3FC1AAA,
+   //Window 79
+   0x22C317DF, 0x54C51297, 0x93F78A50, 0x1B709E8F,
+   0x48A8029B, 0xEE5C4CA0, 0x9CA255AF, 0xB55CFE22,
+   0xFBCE159B, 0x6E9FF806, 0x01213DD7, 0xC948A002,
+   0x8032AE22, 0x79C6EE57, 0x837263DE, 0x34C95370,
+   0x6C9E06D9, 0xF7C55301, 0xEDBBC83B, 0x58F7D1D1,
+   0xE81C6DED, 0x478A56AD, 0x588CF0A0, 0xB1415CE2,
+   0x9D4A1AB2, 0x21DC7A1C, 0x4A3D5A11, 0x2D176F73,
+   0xC31F23A8, 0x5068EB04, 0x0AFAFB50, 0x4711A082,
+   0xED22A556, 0xDF89A995, 0x19C95931, 0x3293EB48,
+   0xDC82BBA6, 0xB468F2B2, 0x06618E9A, 0xBD747162,
+   0x3EAFE092, 0x4B8E2D34, 0x6900EA49, 0xE6349AD1,
+   0x04848A48, 0x8E584051, 0x1468E827, 0xEFE04061,
+   0xDC0657E3, 0xFE6310D8, 0x6B48063E, 0xE8F51964,
+   0xDD445E26, 0xB2F9AE79, 0x8F482594, 0xB18F187B,
+   0x4531F0D6, 0x5DA90D2B, 0x0982CC97, 0x0EB1F1D7,
+   0x11730BE5, 0xD0E3A745, 0x6218EDA1, 0x96DABD77,
+   0x772FFAD1, 0x255927D1, 0xF4F0AD07, 0xB11AEF60,
+   0x3308FBBD, 0x0EAB96E8, 0x8FC9A4DF, 0xB041A45A,
+   0xD5E479DE, 0xB7CA59B1, 0x72C6B8C4, 0x058BC9C4,
+   0x893380D8, 0x830956BD, 0x87C7A0B4, 0x09AB4A1B,
+   0xED8AED3C, 0x06E670F0, 0xC5CAD2EA, 0xFA7CAEAD,
+   0xF5E2F747, 0xA069D1A4, 0xDF883CAC, 0xFAD6AC63,
+   0xD1628697, 0x7CF7EB26, 0x345EBB35, 0xEDEFB791,
+   0x88E6B552, 0x7B23CD75, 0x10E11064, 0x3C63D9D3,
+   0xAF779842, 0x69B892C9, 0x5FB91F06, 0xC71E8FB6,
+   0xA296F55C, 0x04E65620, 0x411B5432, 0x4F04C16E,
+   0xBD0AE64D, 0x0110D0C7, 0xF9F0A40F, 0x382402B5,
+   0xF884DD27, 0x0F7D21C0, 0x5C0C7498, 0x3A0AEE17,
+   0x2983E10A, 0x5747BD71, 0x8302D470, 0xC971CEAC,
+   0x397F79BD, 0xCD5E06B4, 0x628D6924, 0xEC05CF1D,
+   0x733ED834, 0xC62E26D4, 0xEC6DCB01, 0xAC3F1469,
+   0xABF88D50, 0x9212231E, 0x7D4AB30D, 0x5D5CA08E,
+   0x93AD5938, 0x0C59C5A4, 0x449A4888, 0x850E872D,
+   0x89272015, 0x83231BA8, 0x19DDD043, 0xA0D481DF,
+   0x36ABADF7, 0x619B3544, 0xE66FD696, 0xC2BCC041,
+   0xEE01C7AE, 0xE43946ED, 0xAFFF1DF6, 0x778B39D7,
+   0x102759D1, 0x6EB0AE9C, 0x05FDFA4E, 0x7EBD10E5,
+   0xBB517808, 0x5516B05E, 0xF8651A42, 0x8B0AC5A4,
+   0x940C3F10, 0x6C35AFC7, 0x0BF6E948, 0xA0EDD9FA,
+   0xBA69D4BB, 0x5D7B0A11, 0x8A17B2BC, 0x10A13DF7,
+   0x2406C72E, 0x8FF9934B, 0xE76CEE2A, 0xF960E2CC,
+   0xC10BD0BB, 0xC678DAAA, 0x05F7D058, 0xC417D537,
+   0x6C3DEFF4, 0x5D9083A9, 0xA3C32893, 0x66743C3F,
+   0xD4779E94, 0xB7780E32, 0x108D614C, 0xC5132571,
+   0xB5291F28, 0xC6FD034A, 0xAB484737, 0xC81AE4C7,
+   0x8B123344, 0x9187B073, 0x43B86069, 0x8713F8EB,
+   0x2D215408, 0xD665D734, 0x7E3D16A5, 0x8FE70D61,
+   0x7F62F760, 0x83E86A46, 0xA9092B63, 0x3880FC4C,
+   //Window 80
+   0x968B4A5F, 0x110162F2, 0xBA0F8B3D, 0x1323FEFF,
+   0xB1666EAA, 0x89ACC4C0, 0x3007A482, 0x85DFB383,
+   0x5C7A9BA1, 0x5F5449E7, 0x6BFCF21E, 0x38174A00,
+   0x4F0474FC, 0x9F7DC254, 0x40CB718B, 0x13F390D7,
+   0x3A45AD17, 0xE6091C18, 0x1605976D, 0x9B795D80,
+   0x2055EE90, 0xE0BCD7AF, 0x92EE7C2E, 0xD637FBF6,
+   0x7FA31C8D, 0xBFF1C0BF, 0x3A8B9881, 0xFBDD7515,
+   0xA597C62A, 0x0C142938, 0xC1E2ABCA, 0xB71473F1,
+   0xB23AD2F1, 0xA3803705, 0xE830CFFF, 0xFD80DE9F,
+   0x1F6F63DF, 0x732E194B, 0x15407260, 0x25009855,
+   0x6FD2C490, 0x462759F1, 0xF470DED8, 0xB856468F,
+   0x4A94647A, 0x50EE8E60, 0xF3406E2F, 0xEB5B38A8,
+   0xC7E761A1, 0x0B727DE9, 0x002FDDFD, 0x63D639A2,
+   0x78DECB72, 0x3D706223, 0x3E024B4C, 0xCBCDEF5B,
+   0x64FBEC0B, 0x3968F45F, 0x0C399929, 0x5DB612A1,
+   0xEA12873C, 0xDDC8F122, 0x19C92A9D, 0xF5903F69,
+   0xD99F6E4F, 0xBB237674, 0x8CC2E576, 0x9FF5ED20,
+   0x5E0C8EAB, 0xF62F2C1B, 0x68CBE962, 0x322AB1D7,
+   0xB9151A2C, 0xF264CE3D, 0x2DE95C08, 0x209DA30D,
+   0x2FE06E11, 0xDB3737E4, 0xCFCC3B8E, 0x963084E9,
+   0x120CAD15, 0xB9807D76, 0x08998593, 0xE7F0DE68,
+   0xE91568F0, 0xD9820666, 0x7857CEBA, 0xA769BF6B,
+   0x50B44D62, 0x3186CFF4, 0x6CE1AE05, 0x8E430376,
+   0x034C9C0A, 0x3A451382, 0x3D968609, 0x7527E8C4,
+   0x43D99860, 0x495B70C3, 0x230E138E, 0xEB4FBA2C,
+   0x959F5549, 0x1AE6DB0D, 0xD2D01027, 0x6E32CAE9,
+   0x6CC83999, 0x933A001B, 0xC6BA0E66, 0x43E70927,
+   0x1DC5CB12, 0x98925F1C, 0xAA657C71, 0x983BA9C1,
+   0xC45E7A25, 0x22818BC7, 0x7FB1933C, 0xD762E6FB,
+   0x2933B718, 0x70BAC8AF, 0x3A5C49AF, 0x3FA45778,
+   0x46DFB84D, 0x726149A4, 0xDBBE5433, 0xCD6890A0,
+   0xB05FB60F, 0xB846B0FF, 0xB8A55606, 0x0D14122F,
+   0xAF8B2BED, 0x8582E45D, 0xA7F52000, 0xB062D850,
+   0x90EBCC97, 0x4D8280BF, 0x70236712, 0x2B4E093F,
+   0xFBF714CC, 0x9168D949, 0x4274AD14, 0x51B6F976,
+   0x9A471E7F, 0xA09A50F6, 0xB76B7FFB, 0xD8D5F464,
+   0xC7F52C70, 0xE2CBD19B, 0xCDF31A65, 0xBD2A7657,
+   0xEB38D23D, 0xE2C5FE1E, 0xFFC658B3, 0x20954ADB,
+   0x66DC5970, 0xF895BAFA, 0xADA2BE0F, 0xFD513066,
+   0x1F4D0C3D, 0xF3F85E60, 0xF26A9CCC, 0x9AA08B3F,
+   0xE8AF14DA, 0x97576540, 0x32C4F5F3, 0xC3E7E858,
+   0x57765C2C, 0x652726C0, 0x280CD163, 0xF8952DDB,
+   0x16EBEDDB, 0xB9D14FA3, 0x4F682384, 0x20997B9D,
+   0xDB73DD60, 0x8991BC2C, 0x24E82F01, 0x6952584C,
+   0x9F0F532F, 0x9105FE5F, 0x28CA9AFF, 0x8C4591E4,
+   0x6E6DFE89, 0x17884211, 0x16591C3F, 0x5DFBE98C,
+   0x37E023A6, 0xD7974391, 0x6110253A, 0xE37783ED,
+   0xB8AC562F, 0x1ABE78A9, 0x2A75FCCD, 0xB9FC25B0,
+   //Window 81
+   0xE3667565, 0x8FAD0C67, 0xCAEB77C5, 0xB6809115,
+   0x2244896F, 0x8F1CA009, 0x7726E572, 0x760ACA36,
+   0x05216D7A, 0xA367D788, 0x44CFF24C, 0xBE0E98A0,
+   0x8AEF73C9, 0x82891358, 0x8FDCF0E2, 0x0278F9C8,
+   0x736BA12C, 0xDA5422DE, 0x8A7187E0, 0x8EDA5949,
+   0x56515F40, 0x9B9C9923, 0x61F862BE, 0x59B93F29,
+   0xE02394C3, 0x79B5730C, 0x5F24ACF8, 0x53FAE795,
+   0x545FB944, 0x8C51117D, 0x1BD05869, 0x430B8044,
+   0x0F624FF1, 0x31D6B301, 0x88E54908, 0x04B08C5C,
+   0xE3816AE3, 0xB65C61A1, 0xFAC8B759, 0x286BEA76,
+   0x038E1CDD, 0x97785233, 0xE6529C62, 0x53D5A3AE,
+   0x3EAAFA55, 0x9CDDFFB9, 0xB15DCF88, 0x1A7F00A9,
+   0xA0B71018, 0xE429AC28, 0x7EC4CDC9, 0x2DB47E9A,
+   0xF8EF35E7, 0x504E5476, 0x498273BD, 0xD5B65692,
+   0x95FDE087, 0x47230DAC, 0x5ED58863, 0xF30AA4D1,
+   0xC3AC84D9, 0xC3C54667, 0x910A8385, 0x762D9D3E,
+   0x4073713F, 0xA3492A4E, 0x720487E2, 0xBBCE822D,
+   0x62D92E9C, 0x5503A9E4, 0xF5CE3E15, 0xB964E1CA,
+   0xDDC3BF48, 0xFE4F5067, 0x015F545A, 0x5FA5C9EF,
+   0xD68119D9, 0x9CF8DCB3, 0x3CF1D233, 0x986EE3B0,
+   0x0DA57151, 0x310EB8EC, 0xC281706D, 0x620D1EFB,
+   0x984E975F, 0x8E8ACE26, 0x8E0DC912, 0x3755806E,
+   0x5256321C, 0x98036884, 0x4B24120B, 0x2EFC8F7D,
+   0xF5AE0D76, 0x64CAB05F, 0xE4AC6C7E, 0xBD88A34D,
+   0x93986EE8, 0x863F3A7D, 0xEAD9D4DC, 0xD4DD5E4E,
+   0xDB38E8EF, 0x1F0CCF53, 0x7F32C100, 0x7FF2C33F,
+   0x87E9A572, 0x4E1B0C3F, 0xDD957899, 0x52CF50AF,
+   0x138C50B1, 0x2D49E855, 0x5871E524, 0x0F1DCA1A,
+   0x7D3C5E13, 0xD941C5E2, 0xBB614574, 0xB4FED323,
+   0xDCE7197C, 0x7C3B5903, 0x87BBC210, 0xFD8247FB,
+   0x133B72B7, 0x2E5F55F2, 0xDF891B10, 0xE66295DA,
+   0x66B40198, 0x2AC6B35D, 0x324D23C4, 0x7F5616DD,
+   0xAAF184A6, 0xDA13867D, 0xB3D56D7C, 0xD9A96F21,
+   0x565B92BD, 0x08D294F0, 0x0E44505C, 0xD4087B7E,
+   0x57B90D47, 0x7489DE51, 0x22A49181, 0x2D659538,
+   0x3D6F03A6, 0x4B92279C, 0xAC3385EA, 0x16440B29,
+   0x7A855317, 0xAA34E82C, 0xA3C7CD6E, 0x9EFA7254,
+   0xD867F21F, 0x2AD9FA20, 0xCFA27170, 0x94AF20C8,
+   0x1B1FFA54, 0xC7F5B10E, 0x726CBCCA, 0x345E3E6A,
+   0x566255C2, 0x95F970EF, 0x0CFDC877, 0xB953AF0F,
+   0x75429BBD, 0xACB5298C, 0x58420CF2, 0x0DD53FEB,
+   0xC061A43A, 0x9F098ED3, 0x3DFB40B4, 0xFB192BAC,
+   0x446ED595, 0xBC7FF79D, 0xEEFAC81C, 0x66198683,
+   0x49F63693, 0x55B6A2B0, 0x2BC4A900, 0x1B7FEC78,
+   0xC547CF87, 0xF398A26B, 0xD1510022, 0x570FD825,
+   0xF4B66658, 0x974C38F6, 0xB2241408, 0x8BF5FA27,
+   0xADC45006, 0x20F35E0B, 0x96D3F091, 0xD87E80F4,
+   0x787028C4, 0x86F1C1D5, 0xB386EE06, 0x3314A0DE,
+   //Window 82
+   0x95DDD724, 0x53DCA6A6, 0x8E32F846, 0xDA3CB33B,
+   0x33F0C368, 0xECEEF531, 0xC12E5467, 0x568C2F8B,
+   0x9E53D17D, 0x6FEB14EB, 0xB6403D8F, 0xEFC23D8B,
+   0x589533ED, 0x37A92437, 0xAFB7B2B7, 0xC8D03CF8,
+   0xE1C86C06, 0x5A09B405, 0xBC4D1A9D, 0x52F38699,
+   0xBF018632, 0x3F5D0995, 0x380A0D13, 0x65E4EE35,
+   0xF597C3A6, 0x632B7146, 0x4E01545B, 0x7937B26E,
+   0xA2F53726, 0xE5F66E93, 0xA88F8A53, 0xC54830F2,
+   0x41618540, 0x4B8FF991, 0x1DD7D37D, 0x272EA462,
+   0x65D404B5, 0x87B989AE, 0x2E2E406B, 0xDC91CE69,
+   0x7C7ED067, 0xB46EEECE, 0xF00A94BA, 0x0E22B743,
+   0x9D7B8673, 0x703DA03F, 0x8C3AF404, 0xF8275833,
+   0x64069B93, 0x1835ECF0, 0xDF0A117D, 0x07E29D3E,
+   0xF1596AE6, 0x8E88564C, 0x1138B73A, 0x5E4A7CFE,
+   0x95CA91DB, 0xA3BDEB70, 0xFCE4BD10, 0xC8097F0A,
+   0x72B8E87D, 0x773FB2B0, 0x5B40F194, 0xC12FB3EF,
+   0x668D35C0, 0x35732419, 0x75BEE354, 0x35A32EC8,
+   0x5E88A9C0, 0x32970C60, 0x66745C21, 0x7B5AFBDF,
+   0x07BD4728, 0x7E60582D, 0x591B018F, 0x98A2D71B,
+   0xA18872FB, 0xF2F62923, 0x798A0511, 0x71D87D29,
+   0x05F9E830, 0x6CA27C8A, 0x7859AA00, 0x3D5A7C2A,
+   0xE9103D4D, 0xDDDFBD16, 0xEC5F938B, 0x47521BBF,
+   0x1C6C9BD9, 0xEE913243, 0xB59FA8B1, 0x1703943A,
+   0x8486D062, 0x8F70EB88, 0x365DD622, 0xCF36264A,
+   0xD9A5B8DE, 0x815EDA39, 0xE5FB9929, 0xCDB8F78B,
+   0x29149153, 0x36F23EB9, 0x500B8D06, 0xC8FB7E37,
+   0xF7269BD4, 0x9CD64A09, 0x4F1CD7FC, 0xD495DD4D,
+   0x389EC5DE, 0xE2ADA4D1, 0xFF2DBAB4, 0x2A3AA63E,
+   0xEBE40B0B, 0xE3501D3D, 0x435EFB89, 0x5D208294,
+   0x228DB3C5, 0x684460DF, 0x137D7EB9, 0xA4C225C1,
+   0xD1FFFBD4, 0x6492D54C, 0xEBE13691, 0x66DAE9D5,
+   0xA286A88C, 0x8FF04C73, 0x7F34F65B, 0xE82DAE6F,
+   0xF34E6A13, 0xE7576CB9, 0x46E2DB86, 0x4AA9715A,
+   0x9762CCD6, 0xAD0F7608, 0x9AB07E63, 0xA0DFBE95,
+   0x73DB4B0B, 0xCC9B8800, 0x4F4CA275, 0x685F7972,
+   0x3774534E, 0x03BF824A, 0x56F71345, 0x8435AF5A,
+   0x6388F082, 0x4837A96D, 0x9E9F8C39, 0x56E01346,
+   0x9AF03272, 0x21362D1E, 0xF7151608, 0xE71C519F,
+   0x095A5790, 0x99C3BECB, 0x2483AD3F, 0xA1DC51FB,
+   0x8D1C1CA1, 0x4DC91893, 0x5A461B5F, 0x17A1A81B,
+   0x84D7E319, 0x758188FC, 0xC9DA4DF3, 0x45C11F82,
+   0x9235BC30, 0x74EB36C9, 0xB2173967, 0xCB8363D0,
+   0x8FE76BC0, 0x21E23775, 0x9C9D7131, 0xA2279EA8,
+   0x4F080252, 0x1DFE4C93, 0x4FFFE4F6, 0x43BF57DF,
+   0xBB84AAF0, 0xB6E09512, 0x13F5F9EF, 0x8EBED495,
+   0x7B0FF7A6, 0xB36F13DA, 0x1FE010C5, 0xE97F0EDF,
+   0x092FE4A2, 0x420D2453, 0xDB570219, 0x85339816,
+   0x55F226B8, 0xE9B1CE96, 0xA71E0FD3, 0xA1D34647,
+   //Window 83
+   0x752660AB, 0x65B36F1E, 0xB5600F5F, 0xAE6588C1,
+   0x3AD0287F, 0xFDEBB815, 0x5D4BF0F8, 0xD255A09C,
+   0x1C1935F4, 0xA447ECED, 0xD68D92E4, 0x6D76746D,
+   0x66EC7670, 0x2395ECDF, 0x89C27DFD, 0x0F87C763,
+   0x2E602E17, 0x6AD8F575, 0x9D6A90AE, 0x7652BC9A,
+   0xF8781FE2, 0x4ED54599, 0xEECE0E40, 0xC1179CA4,
+   0x0CAB667D, 0x633A14B9, 0x7F46B59B, 0xD75FFACD,
+   0x86F76BE6, 0xA83B4A3C, 0xF44385E0, 0x2D79F9AB,
+   0x658097A4, 0xD2FFFF8A, 0x98592977, 0xF12EE3A7,
+   0x24634A96, 0x8A3270C6, 0xF65F2BBE, 0x9A9F5262,
+   0xAE1C9139, 0x2001137E, 0xF0A3395B, 0x327C3D27,
+   0x6593EFA8, 0x6D17DFB8, 0xE4A2DC2C, 0xD8B0222B,
+   0xA81394CE, 0x11BA7188, 0x31D26F49, 0x4D1DDE11,
+   0x3FEAC8BD, 0x60707319, 0x1927658D, 0x329CCFFF,
+   0x85AC214B, 0xDC884245, 0xD732C89E, 0xC6AF8340,
+   0xFE3377F2, 0x94E6EDD1, 0x280EBE5E, 0xFDC96147,
+   0xF1E53560, 0xBF460C72, 0x83124B08, 0x3EFB1EC4,
+   0x07D37C99, 0x7E8E20F8, 0x8850E721, 0x7F5B243E,
+   0xAC8814F1, 0x9FF1BB28, 0x15E6C573, 0x71E356DB,
+   0xFBCF9F12, 0x0A888C78, 0xD4953452, 0xB01BACAB,
+   0x73154092, 0xDEFBB924, 0x0B3A2F05, 0xE0FFC57C,
+   0x8A1B0CC6, 0x497D9489, 0xDC190246, 0xBD6831E3,
+   0x1319553C, 0x037EC1C7, 0x64938C77, 0x2598230E,
+   0x3D914C78, 0xAE333DA7, 0x4A1EF2FB, 0x5CD9CE96,
+   0x7E9D944F, 0x0CC8085C, 0x747538BC, 0x19A4C667,
+   0xE6EB9139, 0xE0E30944, 0x53CFEF08, 0xCFB7DDA5,
+   0x54660CAC, 0x32369360, 0x51793ED4, 0xB6CB258B,
+   0x8186172B, 0x1511ED31, 0x95AC7E7F, 0xBDC75BCB,
+   0x7B77F79C, 0xAA1493A9, 0x19D0D254, 0x59126B69,
+   0x81B423E5, 0x96A4CCCF, 0x6B7D9E89, 0xD884DBD2,
+   0x1DE571C6, 0x02635317, 0xD5DCFC91, 0xE707DCF4,
+   0x979AA40D, 0xC8A65BE3, 0x5B5E0BCE, 0xBC1FB2B2,
+   0x390F831D, 0x8E47514C, 0x66298D20, 0xB3493C66,
+   0x8DD4F504, 0x275FF075, 0x0EA6C894, 0x2276C23B,
+   0xD0D4619C, 0x0476AA17, 0xD52FB88B, 0xD9ACEF27,
+   0xE367D6B5, 0xAFF2F9CF, 0xE18690D9, 0x12112CFE,
+   0xFDE2CDD7, 0x7834DD92, 0x9F039486, 0xE66D280B,
+   0x99896ACF, 0x59F65A0C, 0x061FEAB1, 0xC44BAC8A,
+   0x6D60DC70, 0x70B1337F, 0xEF957450, 0x384E93A0,
+   0xDBC6E44E, 0xD9BAB691, 0xC1DEEF98, 0xC2BBE12C,
+   0x8BC6E385, 0xC1EA8C42, 0xE01BD48E, 0x41B81342,
+   0x69C03372, 0x8535E17C, 0x3EBD39C6, 0x332AC49D,
+   0x51CA0D0D, 0x3B1264EB, 0x372B974B, 0xDA7A1041,
+   0x528BB7F5, 0x22310710, 0x2F43BE54, 0x6D5D30D6,
+   0xAC3CA3EA, 0xAA6DCF18, 0x30CE27CF, 0xE0716D91,
+   0x3876D11F, 0x459D02E8, 0xFB9108AA, 0x5C6749C3,
+   0x534D1524, 0x918A94A4, 0x13120807, 0xC20243A9,
+   0x8FAA7150, 0x7A424546, 0xBF77E138, 0x6783C2C3,
+   //Window 84
+   0x3F385D2B, 0x35B2E438, 0x932B516D, 0x6E668AC4,
+   0x51A3599F, 0x8A1646FE, 0xD12C0F3A, 0xAEE309AB,
+   0xC46DA385, 0x0231423B, 0x637EE943, 0xF23C10B4,
+   0x22248E00, 0xC0BC215D, 0xD45F6553, 0x9ED447E3,
+   0xDAAD7D1D, 0xAF084771, 0x1F2D8179, 0xEE94BF70,
+   0x267BB3FD, 0x1E8C72AD, 0x8DE7AC78, 0xC425DE16,
+   0xD20B2E50, 0x42A4D006, 0xED232D4A, 0x3C16C20E,
+   0xADCEDDA5, 0xEC5D8B89, 0x684C6514, 0xA3B2BD18,
+   0x242A6FE4, 0x4CAC2455, 0xD1335FBE, 0x92BA26A4,
+   0x17100B52, 0x9061F716, 0x89042401, 0x63DC6EFA,
+   0xB5BFB627, 0xACB2DEE8, 0x71A55C70, 0xEC9B2219,
+   0xBC6268FF, 0xDC239D81, 0x59B0725B, 0x68822559,
+   0x00AD744D, 0xDA52E57F, 0xA789DF53, 0x89638528,
+   0x4DE1DF0C, 0xD23FBA2D, 0xC37CB95B, 0x656AA87D,
+   0x33C056B1, 0x9A5D9366, 0xD1F0A3E6, 0xBF4AF30B,
+   0xF98152DA, 0x6AB012FE, 0x68EB0B65, 0x7ED2FF25,
+   0x29469AB4, 0x67B886AF, 0x28293C53, 0x2D07DBC7,
+   0xD3745D7F, 0xDE88DBD7, 0x09D2EEF3, 0x6CEB6B55,
+   0xBD0A33BF, 0x3EA12CFE, 0xF9B84C60, 0x4F3A0F55,
+   0x162352FD, 0x47E73C8A, 0xEA00FAE1, 0xC0983027,
+   0x458C1A60, 0x80D32CE6, 0x98EB8F07, 0x5C8A0AB5,
+   0x43E90D42, 0xABBCB2B1, 0xC22FBBD7, 0xE8CC6419,
+   0xA35059F1, 0x81D8E136, 0x92664D7E, 0x33FDCA28,
+   0x5432EC92, 0x60F441DB, 0x3C8F0673, 0x2047D9A3,
+   0xC5EEB7E9, 0x7A71D521, 0xEAF2F437, 0x95ED6C89,
+   0x0633B54F, 0x3C37FEB8, 0x94D56C43, 0x9EFCAC93,
+   0xEF6F6F26, 0xC4A715F1, 0x093088DB, 0xFEE97F8D,
+   0xEDB4CA5F, 0x3C598CA2, 0x1562DB64, 0xC2341D63,
+   0xEB79DB5F, 0xF4135D37, 0xC9A60DB7, 0x91F9E864,
+   0x76709C84, 0x7CA1D139, 0xF70BE98D, 0xF99922C2,
+   0xDB988583, 0x15227568, 0x74090D98, 0x7731F0D5,
+   0x52ED49F1, 0x711E42C8, 0x6C44B94C, 0x627F82D1,
+   0xC0FCAEE6, 0x3D2CCD21, 0x31D58A0A, 0x7630684B,
+   0xE32C0CAF, 0x04983ECA, 0xEEF06463, 0x27359FAA,
+   0xD9EFEF3F, 0xC2104507, 0x85D6E232, 0x7F3CA2EC,
+   0x10133025, 0x4B84B935, 0x79DE709A, 0xB63DE39A,
+   0x5A30424A, 0xC71CA2AF, 0xA55A60CF, 0x3BCFD80C,
+   0xA6C0DF4F, 0x0800C45B, 0x65BFD8D7, 0xA38DE3C3,
+   0xAF0682BE, 0x02F6D306, 0xB0E5F1E4, 0x2FD6078A,
+   0x97448486, 0x3292CBE9, 0x057BA827, 0x3FA62AF0,
+   0xC3051D47, 0x984622B2, 0x6D2C6878, 0xFFEB709C,
+   0xB9CB8ED1, 0x886ED619, 0x545C49B0, 0x6E9A4981,
+   0x30E8A72B, 0xD01606A7, 0x313900EF, 0xFDEFB51A,
+   0x508100AC, 0x76120DC2, 0x30A574F0, 0xCCC29EAD,
+   0xADDF35A2, 0xA16E034B, 0x4723A4AD, 0x32AE0025,
+   0x1E1CA3DB, 0x2A995867, 0x11B06E04, 0x00CCA400,
+   0x6E50B7CE, 0xC4629544, 0x8706A1B8, 0x87B2F57D,
+   0x52FA7FA1, 0xD2AB2126, 0x1C42F1CD, 0x5DD313E3,
+   //Window 85
+   0xAA019503, 0x10E2488D, 0x0B19A816, 0x080C0858,
+   0x9D12C29B, 0xA9D44412, 0xA0DC0CF8, 0xF1FA6864,
+   0x45628ECB, 0xE85AEDF0, 0xABDA7CD6, 0x04DDB732,
+   0x9EF190FF, 0x09BB6D5B, 0x34E4A376, 0x5A186F76,
+   0xCD22A980, 0x96D53577, 0x66709488, 0x907A086A,
+   0x7D8E3F1E, 0x7E567E0A, 0x486076EA, 0x36653375,
+   0x9D0D972F, 0xE1A0B3DB, 0xBF1D378C, 0x9F1E4AD5,
+   0x5638D827, 0x1C27C048, 0x429229FE, 0xAF371189,
+   0xA3EAAFDD, 0x58C538AB, 0xC6060F51, 0x845748F6,
+   0x7EF3ED06, 0x8BC4EDE5, 0x62DB5E52, 0xA411E7F2,
+   0x476818E8, 0xB8C5AFF9, 0xA78899EE, 0x23C4BDB8,
+   0xF966AB55, 0xE0140093, 0x0422E93E, 0x973F3FF9,
+   0x48630DFC, 0x584CB0D5, 0x4EE9C9ED, 0xBDC14779,
+   0x3CC20589, 0xFA340BB3, 0x64BD22F8, 0xEF0311CB,
+   0xAE6C6F4F, 0x00AEFF39, 0xF80A57A8, 0x03363910,
+   0x364550CB, 0x4F85045A, 0x04B86F38, 0x1F6F33BC,
+   0x9F465F14, 0x98D4AE6F, 0xF5727BDA, 0xDE63DBA6,
+   0x2B416DEC, 0xF2D0EBF0, 0xA4FCAEAC, 0x4A8F9AA3,
+   0xB728C8C2, 0xECD9AE47, 0x1AFA4E42, 0xDC838FF9,
+   0x879BCF56, 0xFD2D8260, 0x47733531, 0x8650AE92,
+   0x6C739157, 0x98F36C91, 0x368A5384, 0xBD3CE42B,
+   0x25CFFB64, 0x3DEF0EDC, 0x7BDC62E6, 0x5BFFF23D,
+   0x57751AAF, 0xCB0936DD, 0xA1D600E0, 0xA44927CA,
+   0xBC244B4D, 0xB4508B23, 0x9B6AF424, 0x27573BBD,
+   0x3A2FA7DF, 0xF6EBCBD6, 0x35BB9511, 0x8AD8AB77,
+   0xDDD7A60A, 0x2496D4E6, 0xFCBD1E33, 0x8D731570,
+   0x1C4AEB98, 0xD5CF0156, 0x638E68C2, 0xFDF46D68,
+   0x2C54B831, 0x5472BA2B, 0x6137BD1B, 0xEBE7F0FF,
+   0x8A97F8AE, 0xD89E00A1, 0x9FA9769A, 0x47C88143,
+   0x636FE295, 0xA0BAC0A9, 0x47FC6F8D, 0xC9537BA5,
+   0xD69872AA, 0xFA07AB95, 0x04B284D4, 0x83D6B228,
+   0xD2DF0175, 0xE0E551AE, 0x2E6359AE, 0x6E4D33EB,
+   0x1CF343BF, 0xBCF75FF1, 0x4706CD05, 0x3B05B524,
+   0x0DC0CBC4, 0x16AE06F8, 0x3DE9B472, 0x3FD9DA41,
+   0xA727AC43, 0xF31E8C0F, 0xB97C2D91, 0x2A812F4C,
+   0x442A41DA, 0x9A41EA5C, 0x99DE6E20, 0xAB7ED5C9,
+   0x7D2F9C2D, 0x93CCE3A6, 0x689A3102, 0x12BEFD54,
+   0xED68D737, 0x81685016, 0xBB2E1869, 0xF7E41795,
+   0x4A72F5AA, 0x559BAF44, 0x06C7B7F9, 0x3EB7EA09,
+   0xEEF11ABE, 0xA83B911E, 0x275D3880, 0xD4FD5F39,
+   0xCBEA1EB1, 0x1CFC8323, 0xDF56B02D, 0xFA75CCBF,
+   0xF6FD01C2, 0x92CAB7A3, 0xC37F2ED0, 0x8345519C,
+   0x134F36B2, 0x3550AA72, 0x4BDFB129, 0x3379C13E,
+   0xBCDA8AD8, 0x9E44D65C, 0x7756452A, 0x0A7B31D5,
+   0xEA7FE679, 0xAFE14344, 0xC0113452, 0xA98758F5,
+   0xC4810F4E, 0xC4723DAA, 0x685EF2EF, 0x308DDB18,
+   0xEA344952, 0xAC65D15A, 0x51DCF349, 0xECF8F13F,
+   0x6105981F, 0x62493F26, 0xD02C64E3, 0x1F47493C,
+   //Window 86
+   0xCC3E621C, 0x60DEFB1F, 0xB291F8C6, 0x3C551EAA,
+   0xB5053054, 0x6AA4E445, 0x2D7B0A90, 0xDD36B95E,
+   0x163B4EA9, 0xF8E13784, 0xBB8F63F2, 0xE1724C60,
+   0x35B12E30, 0x50ABFFB5, 0x5EF6E7FB, 0x310C2622,
+   0x62B950AA, 0x769B07CE, 0xEF7126C1, 0x1E0F686C,
+   0x36B4D522, 0xC4601E6B, 0xC89617DD, 0xCF4D4F4D,
+   0xF10B4DDD, 0xF8E60E7D, 0x58522997, 0xB583969B,
+   0x1DDD93BA, 0x64FA2129, 0x424B0824, 0x5FED1DB5,
+   0x4A5C91A0, 0x1ED8EC31, 0x086E8781, 0x4A23A77B,
+   0x412DE3C2, 0x161DE20F, 0xBF25C04E, 0x0290A248,
+   0xCDA345AD, 0x06357313, 0xA3EE9E4B, 0x0CBBE840,
+   0x00D78E36, 0x3A160BBA, 0x61C1D618, 0x55BF16BD,
+   0xA898FEB4, 0xA56FF4C1, 0xBA9F48F8, 0x2B8F421B,
+   0xB4908DCD, 0xE7F4D251, 0xAE12E154, 0xE8C835CF,
+   0xFE96ABE0, 0xD220AA12, 0xC0D9E8C6, 0x0F860456,
+   0xA0F7B80D, 0x67D64DE8, 0x29AB1FCB, 0x6E3DF0B8,
+   0xDB1D02DA, 0xF93BCD67, 0x0CDB27C9, 0x2C7447B4,
+   0x661B92E7, 0x68094575, 0xA206A72B, 0xF2FD3723,
+   0xCD152EC3, 0x602C9B43, 0x113DD5F9, 0xE4F8F1C6,
+   0x34D6B338, 0x2F317BD6, 0xB98C539E, 0x4C86ACC1,
+   0xD407E28F, 0xCE64EE5A, 0xAB687567, 0x05E1C62C,
+   0xC5EE7C08, 0x7B986ADE, 0xA4D8E130, 0xAF9C153E,
+   0x0BA7C035, 0x1DC4AADD, 0x0C7F190A, 0x6FE81AAC,
+   0xA5D53486, 0x074F2FFB, 0x5A375FE7, 0xC7670E4A,
+   0xDBA656C9, 0x718882D7, 0xDE3780D3, 0x73B83359,
+   0x1F09E957, 0x3F351AC3, 0xDC6F4101, 0x0276B6F0,
+   0x8A03EF9C, 0xE3EB93E0, 0xD3953DE7, 0x189B5BBE,
+   0xE7E4D906, 0xDB673E86, 0xF988DDAF, 0x1AEF9AE3,
+   0x17D4E0E1, 0x49900979, 0x98F01246, 0xDA403383,
+   0x9E023017, 0xEF2D3786, 0x66251F58, 0x2A37D243,
+   0x6544EB09, 0xB7ABCE9C, 0xB4730572, 0xB5AFC4E4,
+   0xC60FADC1, 0x0C9A417A, 0xF75EF789, 0x303056A0,
+   0xB5CBA81D, 0x58E285DB, 0x2F275242, 0x21DCB595,
+   0xE7C9E327, 0xCEB48E16, 0x11F2B16F, 0x8C962626,
+   0x021994C1, 0x1E2C3ADE, 0x6E252E3A, 0xE353BE79,
+   0x51CB75A1, 0x31572798, 0x7A0F9D2F, 0x4F86C201,
+   0xE0142FB4, 0x3E5EF4B5, 0xD30BE4C7, 0xE3621459,
+   0x0C90E343, 0x5D9DA7F2, 0xF313A4E8, 0xD2298823,
+   0x7CCE6B53, 0x4CCF3D4B, 0xBCCDB034, 0x5508D8A8,
+   0x85661FC8, 0x58A48704, 0xF37998A7, 0xFC695D1E,
+   0xFEAACDAC, 0x89C594B4, 0xA9B901B5, 0x6E12E60F,
+   0x8513BE4E, 0x08338767, 0x369A45B0, 0xD1CD74CB,
+   0x455FF5E4, 0x5DDD0901, 0x25672B2F, 0xECC86612,
+   0x54E40B4C, 0xF17D264F, 0x91099A1A, 0x5F2C2F42,
+   0xB3D4F3B0, 0x5861C9DA, 0x9B9DF154, 0x29410C20,
+   0x14C508A0, 0x7853E6D9, 0xD069C1FF, 0xC06DDAF6,
+   0xC5E136F3, 0xAC0FEC52, 0xE7057B3D, 0x397A1599,
+   0xFEBCA9C5, 0xA7CC1A92, 0xB6312168, 0x9054F366,
+   //Window 87
+   0xBC6510AD, 0x08AFF4B2, 0x74375758, 0xE061870D,
+   0x8AAE6004, 0x5B02734B, 0xCE9622D2, 0xE00B1374,
+   0x72430767, 0xBAE3CD27, 0xFAB48CDF, 0xAB468ADB,
+   0xF681A609, 0x57874D65, 0x283FF85A, 0xD8D8C262,
+   0xBC42A3CD, 0xCF13AE9B, 0x8BA86C86, 0x6063ECF7,
+   0xD1AE018E, 0x09BD4976, 0xDCEAF81A, 0x10B976F0,
+   0x5F4215BC, 0xF1B22E74, 0x80ECCE98, 0x7EE742E8,
+   0x6E5FA075, 0x60227FDF, 0xC72925E7, 0x2E7C0CEB,
+   0x82F3B229, 0xADC86EC7, 0x2CF9E052, 0xF8B7CD57,
+   0xEFE1C5F5, 0x2F04E418, 0x106D810E, 0x2DB8249F,
+   0xF419E1B7, 0x631625C5, 0x1704D5A3, 0x67950897,
+   0x6F405990, 0x76F26365, 0x9B5BCCCC, 0x89EE0D8C,
+   0xC3E01AAA, 0x32541F94, 0x7738E6E9, 0xA0EE6AE7,
+   0x2D5B94C9, 0x1681BA73, 0xE5A57151, 0xCE35E8D0,
+   0x2BDA8386, 0x9C941698, 0x1FFD5FAF, 0xDD407468,
+   0x6C97EA3B, 0x05D48842, 0xF7E1AD52, 0xD8E39A08,
+   0x78C37F17, 0xF8AE6241, 0xA52F656D, 0x48E9CFD0,
+   0xE8F88FDF, 0x33DBDB0E, 0x6F4A96FC, 0x615C5A56,
+   0xDB8F9E81, 0xE67DFF1A, 0x32D07235, 0x79283167,
+   0x913CBB27, 0x24668F38, 0x179BEFE8, 0x232F97D1,
+   0xAD53BE1D, 0xCB7372D0, 0x5C5A2AA1, 0x78691938,
+   0xC460233B, 0x590371D9, 0xBD8F2DC8, 0xF10E5FD5,
+   0xF9DDCD21, 0xD303C6DA, 0xFFDFFF6B, 0x022315F5,
+   0x3D2A1A92, 0xAB6ABDFB, 0xC56257EE, 0x8B0B398B,
+   0x744129B3, 0xA197C199, 0xD54A3E42, 0x1C803C6E,
+   0xA69E31E4, 0x2B62920B, 0x41554DD8, 0x07583026,
+   0x80435819, 0x97E82535, 0x9955C519, 0x36EE3608,
+   0xF6F1B84E, 0xA884390E, 0x8A6A5644, 0x44AF2645,
+   0x4D00D9CA, 0x1F508C44, 0x0C658E1F, 0x3885255B,
+   0x8CF3AEA7, 0x2CFB3F48, 0x2AF0ACF2, 0xC045904F,
+   0x3489BEDD, 0x5A6DDDDC, 0xB6006928, 0x6FA576A9,
+   0x8184F7D5, 0xB1AF0F4F, 0x46372C8E, 0xA58DE018,
+   0x35ADAD9C, 0xE1FA17C7, 0x307590FF, 0xC051A767,
+   0x457E70A4, 0xAC77C987, 0x50EDD913, 0xE3A6F9FF,
+   0x55D933F4, 0x04EC0EFF, 0x5DF5780D, 0x3103D76D,
+   0x04D2FE84, 0x6B26791B, 0x3511B485, 0x58CDE516,
+   0x296A29FA, 0xE3D0F581, 0xAC94D1AD, 0x1BD949A5,
+   0x14F4A88B, 0xF08B9B73, 0xC72EBB86, 0xEE39832D,
+   0xE4F4877E, 0x2F404F41, 0xB3557B4F, 0x07E3B319,
+   0x5A189D75, 0x6651B00C, 0x6BA7E950, 0xBC8318D2,
+   0x6F08A897, 0x5F8B1781, 0xCA5D8D02, 0xC90FB4B0,
+   0x04D8F0B3, 0x1621C4F9, 0x8085B1FC, 0x2A3C3087,
+   0xFE3E9204, 0xDCFC8C6E, 0x2B97C3E9, 0x91004306,
+   0x7B40A076, 0xB943C3E1, 0xB52D88AE, 0xC3A820AB,
+   0xDEB32189, 0xCC30CC8D, 0xDBCFF8AD, 0xD4AE679F,
+   0x116A3E32, 0x0E80646A, 0x61671536, 0xB738FB7B,
+   0xF24EEE50, 0x60BD79F0, 0xC86B7E0A, 0xA65032B6,
+   0x6CC743F6, 0x9D240FEF, 0xEEAF3665, 0x2AB2A677,
+   //Window 88
+   0xC3965D6C, 0x7655AEEE, 0x15754E8D, 0xA205D8FF,
+   0xF98F3F6B, 0x2C547F20, 0x31FA2AC8, 0x80F7E381,
+   0x34E62F59, 0xE1A0AE17, 0x98286CA2, 0x121DDF8C,
+   0x0205F0D8, 0x62EC2E88, 0x5329D563, 0x8E49391C,
+   0x251DDB37, 0x71FCDBD2, 0xE9CEE913, 0x92A91A35,
+   0xD84AEE90, 0x99C6E5CB, 0xF1A79358, 0x5459524F,
+   0x5469119E, 0x8F0045F2, 0x648B036E, 0x5B8B82F2,
+   0xE8975A6A, 0xC290B110, 0xD8DE2CDF, 0x0CBA9800,
+   0xAEA335CB, 0x5591D449, 0x22EADBE1, 0x1D79343C,
+   0xEB23B82F, 0x29C1E44D, 0x067F13C6, 0x42E7D9DC,
+   0x6BA13EB8, 0x8FD75271, 0x9492044F, 0x534D28AB,
+   0xA8239701, 0xA4B8F7F3, 0x0DB88AAF, 0xB1A768B9,
+   0x740AE453, 0xF201BC5B, 0x8CCB3208, 0x9A7F901F,
+   0x9E06C104, 0xE2EA06FA, 0xC3661883, 0x1CE39D1A,
+   0xD4C91C53, 0x491786F5, 0x065207CC, 0x9AE26379,
+   0x820767FF, 0x70FEA387, 0x65750608, 0xD7BC36F1,
+   0x779FB65B, 0xD91BC0EE, 0x3088ED61, 0xFC332B87,
+   0x9459FE31, 0x74E6802F, 0x956D42BB, 0xA896A21D,
+   0x5F61095C, 0x975F718D, 0x4E393530, 0xCF3BF5ED,
+   0x66940AE1, 0x0F110A73, 0x012D87C6, 0x18140513,
+   0x3743B29B, 0x612087C7, 0x703FC29F, 0xE34DFC82,
+   0x0B0F3AAE, 0xE4205ABC, 0x313A036E, 0x271E02E9,
+   0x07596E6F, 0xB336ECBA, 0x37DB2538, 0x464E18A6,
+   0x03E27DF2, 0x149A1569, 0x6DE813C4, 0xBAFD5494,
+   0xEB99CAB2, 0x3EF047A0, 0x5CF418E9, 0xEFE52BE3,
+   0x9A53933D, 0xE5CAF2A0, 0x8B635424, 0x73B862D3,
+   0xBF3355F9, 0x5762D057, 0x9620D843, 0x913343BB,
+   0x4D63826F, 0x3BE2436F, 0x00FDDBF9, 0x92A6CE42,
+   0x5980DA46, 0xAD9AADFE, 0x17284095, 0x5CF036B9,
+   0x769031CB, 0x942991ED, 0xA050C37C, 0x83C06948,
+   0xE7A3976B, 0xED9B030D, 0x5B2BB15A, 0x1C6EB107,
+   0x842E2F90, 0x64DBD44B, 0xA02AED45, 0xB99A933A,
+   0xFF69D4C6, 0x8CA40176, 0x83E905C2, 0xABD7D6D3,
+   0x27B193F1, 0x1EF968F3, 0x183AE2CC, 0x1E5107F9,
+   0x9EF8BF67, 0xF94570A9, 0x2DC5477A, 0xEE8006A2,
+   0x0A55E9D7, 0x3B8E5AA4, 0xC185E526, 0xFECB1AC0,
+   0x89C9592D, 0x35DD6BB3, 0xAFFE29A2, 0xE41F3117,
+   0x4ED9EB74, 0x1BA7DA97, 0xD454BB5E, 0x41D91E46,
+   0x9F4505E4, 0x26680F6B, 0x8B682C40, 0xFB8B965D,
+   0x0E934ACE, 0xC632D963, 0x6D3DF610, 0xEC905D8B,
+   0x08D7BA2C, 0x6B88EEAE, 0x568A7ACA, 0x11EF09EA,
+   0x6D1EF2A5, 0xF77ADF2F, 0x635FF8F7, 0xFF3A8FAB,
+   0x508F4A5C, 0x293B6CBB, 0x7DA8683A, 0x3322F3C9,
+   0xAAAC79EF, 0x0B9F71E3, 0xF23CADB2, 0x4200F168,
+   0x343B0C63, 0x3FF106EA, 0x149CE8B9, 0xB9E7A243,
+   0x6E29C974, 0xBA836130, 0xEC3BC965, 0xCFB0C722,
+   0x60E6DFD6, 0x48156813, 0xB320BA08, 0x6FDC7481,
+   0xEA31A6FC, 0x3DE2DB30, 0x295B514B, 0xA26C2470,
+   //Window 89
+   0xA19B7F44, 0x49C0C09D, 0x44B47593, 0x21CF10EB,
+   0x21B7ABD1, 0xEEAD581F, 0x2C8E0B36, 0x221FC0F6,
+   0x49455F17, 0x97E3D3B4, 0x3112A8EF, 0x30B1817A,
+   0xDF5745CA, 0xEE6E05B6, 0x9F304AFA, 0x8373DBBE,
+   0x432202C8, 0xAB7BF494, 0x6707A413, 0x575DFBD0,
+   0x2AC7C5C0, 0x6FBB50D9, 0xC042E8EB, 0x8042B7D4,
+   0x1CCF3230, 0x2AF32A71, 0x6E79CBB7, 0xAFF0A62C,
+   0xC3D96E52, 0xE4703570, 0xDEF54D4A, 0x3F11C8A1,
+   0x4D01B8F3, 0x3F0FCC46, 0xFE230060, 0x33DE558C,
+   0x8EBCE09E, 0x1CE7DC08, 0xFC32A9A9, 0x6F13021D,
+   0x67A46D74, 0x343B6D4B, 0x43DC1095, 0xBF2A4C5D,
+   0x275CA8CA, 0x0FF6820E, 0x11C57564, 0x4D922BFD,
+   0xD44D9420, 0x591BD224, 0xE028E23F, 0xC26F4E88,
+   0x36152BF2, 0xE745E3E9, 0xCD3563E6, 0x7604A757,
+   0xD9D4ABB5, 0x8307A168, 0xD3709420, 0x86855466,
+   0xA46627C8, 0x3DF04325, 0x47932AB3, 0x4FBD8509,
+   0x880C9590, 0x7D403C7F, 0xD8017975, 0xF74F1028,
+   0x1B1900A2, 0x64813951, 0xD76F8A8A, 0xB1BF5E44,
+   0x8A822557, 0x6086BEF6, 0x87E69163, 0x5C531219,
+   0x0AD683CB, 0x575EAE1C, 0xD211CD06, 0xCA177BD3,
+   0xDA45D75C, 0x92F9471E, 0x62C2E9F0, 0x3E0438D7,
+   0x81A8DCBC, 0xB684DB92, 0x7B6A5053, 0xA93B326F,
+   0x49209D24, 0x0092EE12, 0xAC2E3D54, 0xF6116817,
+   0x48B17C20, 0x53F2F3E3, 0xB8F02680, 0x82EA0C67,
+   0x9818BAF6, 0x8AE9F0FC, 0x225048A5, 0xBC72D4A8,
+   0x77802BCD, 0xEE37FE6A, 0xC03B0894, 0x1986B3F1,
+   0xBF1015C8, 0x48CDBBBE, 0x68D77FAA, 0x1B9E2E9F,
+   0xEF9C6A1B, 0xC133EDA9, 0xD79DA93F, 0x3767A890,
+   0x5B72A26D, 0x6C9A6C3E, 0x6ACAEE26, 0x1A753FAB,
+   0x62AA8252, 0x6C794327, 0x715D2AF3, 0x0B7E9136,
+   0xB31D8F25, 0x7081E199, 0x852D0FF1, 0xE398EFD6,
+   0x1C09E380, 0x04ADE2DF, 0xDB3575B5, 0xC3EEB593,
+   0xD8499902, 0xD7664002, 0xAE4E0E52, 0xA2BB3BF4,
+   0x9A6E0454, 0xCA7F0D80, 0xF28F0DB7, 0x244D5C95,
+   0xFB70C86F, 0xFBC3DF7D, 0x6767CB09, 0xD849918B,
+   0x333C0763, 0xBE3689F5, 0x326AAD2F, 0x2A01E32D,
+   0xAA3B7B64, 0xB6C06171, 0x6AB7DFA8, 0x65BDA69E,
+   0xE45F5988, 0xBCA3B250, 0x310C631F, 0x0A056958,
+   0x45C0475D, 0x14520219, 0x2DD8E732, 0xC6B368F0,
+   0x1372AF0C, 0x3B488BC1, 0xF499A08F, 0xE3A7A6C4,
+   0xB5C86DD5, 0x36CF4301, 0x51A80364, 0x94B83F88,
+   0x1ED24DD3, 0x5A3ECAEE, 0x8B59EAF1, 0x1B41DB3F,
+   0xE0365EA8, 0x2449657B, 0xB7BBC017, 0x12F4E98C,
+   0x2AFA2C70, 0x99ADC6DA, 0x00C45961, 0x58D8ADCD,
+   0xF6FBA050, 0x268925B6, 0x28664094, 0xE68260EA,
+   0xB1473849, 0x0984F99A, 0x0CBDF64E, 0xCDF5FE0B,
+   0xD8333E3C, 0xCDF75DC5, 0x9E49EFF7, 0x8B9EE143,
+   0x61DDD54A, 0x61079EDC, 0xB1CD548D, 0xAB8A5792,
+   //Window 90
+   0x550E2F47, 0x129EB4F3, 0x712138F7, 0x6337DC9D,
+   0x13E54A9C, 0x3E2A1F7F, 0xFD9784AA, 0xDDCC51E7,
+   0xEA743F41, 0x8C33D591, 0x01697AE2, 0xEEA16F9D,
+   0xA97EEEC2, 0x779E13C5, 0x34631A1B, 0x4C8C03B2,
+   0x375F6406, 0x6DC880F9, 0x243C87BF, 0x5DEB5178,
+   0x1FFE48A5, 0x8BA028F0, 0xB253A99F, 0x7990C82E,
+   0x87971B25, 0xAA92C596, 0xF55196CE, 0x89EA09D6,
+   0xC8CA140F, 0xF43B31B2, 0xB5368F71, 0x118F63FE,
+   0x5CC85916, 0x6DBE0FBC, 0x32E7E4BD, 0x6FE2FF85,
+   0xED933A45, 0x1907D4BF, 0x8E5F36D9, 0x16A51BFA,
+   0xD7C48208, 0x60A7388F, 0x8E9C8AD5, 0x97313EC0,
+   0x0DE99ED4, 0x763EF177, 0x09145FC1, 0x283F0D37,
+   0xA5132AFD, 0x80626EE4, 0x5AE64E40, 0xBE7E1AA2,
+   0x0F1D6309, 0xD13A7BD5, 0xF9C966CA, 0x25BF8F88,
+   0x26A4A75A, 0x3EFD20AD, 0xD038CBBE, 0xB8D7D75B,
+   0x9DD4E042, 0x5F25924F, 0x861D6049, 0x71181817,
+   0x996EED40, 0xBC54EE88, 0x81CC5AEA, 0x1D474A04,
+   0xE0415416, 0x8CF72038, 0x97ED2A41, 0x314C80CF,
+   0xBFBA87C9, 0x988369ED, 0xB52C55FD, 0xAED8FA9C,
+   0xC06A1F63, 0x9485DDA4, 0x6C2F8E66, 0x7BC0FBC5,
+   0x7A224858, 0x4296AA3A, 0x2A8D8544, 0x1F051B13,
+   0x32C38AE5, 0xE163B747, 0xE3AEBD58, 0xF7745F38,
+   0x52E822E4, 0x9AAD08AD, 0x79FA55F4, 0x169D1F2D,
+   0xEB0FD592, 0x838E3D35, 0x9E34B35E, 0xC52ECDAC,
+   0x91B2D315, 0x31949A73, 0xCD82ED11, 0x11984D09,
+   0xC874AAF4, 0x51379175, 0xEC215B42, 0x4A693043,
+   0x2E62F3FD, 0x575BA5FF, 0x0CFBE815, 0x13B2C420,
+   0xC7AD608D, 0x30782A24, 0xAA6F1143, 0x83E73373,
+   0xAB0CE284, 0x5882EF9A, 0x3B987BAD, 0x549D7590,
+   0x888FF126, 0xB1A0946C, 0xE116CB9C, 0x3ECC6772,
+   0x579CD0BE, 0x1D68C8F8, 0xABAE5015, 0x0D932A19,
+   0xF4F283D5, 0x342A632A, 0x6948C7EB, 0x61806561,
+   0x1E9FFAF5, 0x8CA33C3E, 0x7D06D68D, 0x5FA200D6,
+   0xAB9AF93B, 0x3264262D, 0xF0CB22AE, 0xB8828DF7,
+   0x646A92D8, 0x5B68DA77, 0xBB534A71, 0x94B9EA33,
+   0x71CD5562, 0xCE5E5D0E, 0x41490933, 0x4168E70F,
+   0x572B8632, 0x4319F6B9, 0x9F29CEF9, 0x785340C8,
+   0x3BA01733, 0xDC2BD19C, 0x73D3A2B1, 0x893C9CD8,
+   0x781F369E, 0x7F71402D, 0x594815C2, 0x88867FCB,
+   0x5CF622FE, 0x9D09DE2E, 0x93B63A11, 0x8A074242,
+   0x259DB307, 0x947F15B6, 0x617BD26D, 0xB418BDC9,
+   0x8D2313C6, 0x9D9EA4D1, 0x8DBC10CB, 0x797D6BB1,
+   0xACDBCB41, 0xCB8C6C42, 0xCBF4DDCC, 0x536C2BCC,
+   0x296AC7AD, 0x50955DAF, 0xC79CBD0C, 0x2B02D9B8,
+   0xDD32C542, 0xB2798A98, 0xFBF73FD9, 0x04E3CA26,
+   0x204CD344, 0x642AB665, 0xE976C8C7, 0xFDC5249E,
+   0x4DEEF82D, 0x2F66B02D, 0x62FDF4AC, 0x3DDA2B88,
+   0xE291C67C, 0x9DD49083, 0xA86E5357, 0xDA2075B4,
+   //Window 91
+   0x4CCA56AB, 0xF21ADECC, 0xA3122B0E, 0x59777AFE,
+   0xE5DEB68A, 0x7E0D55E7, 0xB01753E0, 0x2FB272E9,
+   0x8B664954, 0x921CB62A, 0x04B92393, 0xD42A4BD2,
+   0xDA194383, 0xC6239833, 0xAD55B1FD, 0xB4D2BD31,
+   0xFA999A4E, 0xB05888A0, 0x1A7DB127, 0x5C4E46BE,
+   0xEA3734BC, 0xA970057A, 0x1B34CA68, 0x6B51BA9B,
+   0x50F5DD9E, 0x7F4DAA81, 0xCF84C6DE, 0xD6AA41E9,
+   0x40331D82, 0x0446E363, 0x1B4CFB8A, 0x3183CEC2,
+   0x91245A6F, 0xE222308C, 0xE151C582, 0x90C76F89,
+   0xC23E3B4C, 0x01561AE1, 0x3AA78767, 0xC352CCAD,
+   0x2A3BDF47, 0x28CD16DA, 0x97881F8B, 0x6140A586,
+   0x3BFB5F00, 0x3BA7855C, 0xD7A58B25, 0x197B2B8A,
+   0xB94D61A6, 0x24B4EBBA, 0x183CD523, 0xB707AB77,
+   0x41203901, 0x2C7C7E69, 0x2C6F9C54, 0x931FB6BF,
+   0xADA0FB5A, 0xB6D75ABA, 0x850ABF63, 0x7C068B2F,
+   0x848DB448, 0x2AC5CFC1, 0xF43181BB, 0xDCFCC02E,
+   0xB04331AB, 0xC2A6F63D, 0x62CFD85B, 0x5DF5D554,
+   0x877E7D9E, 0xADC3E36C, 0x8955A3F4, 0xA7021248,
+   0x23559E81, 0x4466D629, 0x5499A794, 0x1FD6D3A8,
+   0x75A6E4FA, 0x4C9CD1C8, 0xA1F4910D, 0x66175064,
+   0x283DE41A, 0xE383CAC1, 0xDDE2CB9F, 0xC8A925CD,
+   0xD33D1F01, 0xA285014B, 0x2023432B, 0x3EFB129F,
+   0x2C7EF6E0, 0xE15DCCB9, 0x79265C36, 0x2B95FAC9,
+   0xB0B5E338, 0x79022F1A, 0x44634C16, 0x21DF31F0,
+   0x6A149198, 0x5624128C, 0x24F2B621, 0x42F8B0D6,
+   0x8F5894F7, 0x24E2AD2C, 0xEE211926, 0xD1870E05,
+   0xBB315C04, 0x6F5D46E1, 0x43268932, 0x614F5936,
+   0x588E5F1B, 0x7F8B27F8, 0x3693A91B, 0xDD6637B8,
+   0xC77E6D24, 0x11A79FBC, 0x2ED65C92, 0x93C7359E,
+   0xB4B07E9F, 0x8A0F73F4, 0xB8C9A965, 0xBE78E362,
+   0x5D0AEA53, 0x4C56D25C, 0x0709231C, 0x1C536040,
+   0x575CF2A3, 0xB7F22211, 0x062FA861, 0xDCB2FAEC,
+   0x81D367E2, 0x4947CA7D, 0xC8F0401B, 0x3182149E,
+   0xC9F89257, 0xA8278363, 0x515C860C, 0x89C1461F,
+   0x5EEC8003, 0x1345431F, 0x70D93B26, 0x1A19572C,
+   0x17908CEB, 0x8BAEBC83, 0x25A1AE64, 0x8DDEEFB9,
+   0xA94D00D7, 0x34CAB216, 0x1FC49D62, 0x91FEA811,
+   0xAD78127E, 0x70511174, 0x40AC1D53, 0xB03BB51A,
+   0xD7FCE38B, 0x4E3AFE15, 0x6D8B7D1B, 0xAD0FBC3B,
+   0x04FB3A69, 0xDB3485BF, 0x94B99D28, 0x4EDBA0DE,
+   0x356BF828, 0x6F874491, 0xCD8AA86F, 0x3C2FB755,
+   0xD2277642, 0x2314B45A, 0xA43530CC, 0x7A86D9F1,
+   0xA7D71B13, 0xCC807511, 0x0F2F6773, 0xE582CF1D,
+   0xD1ACE7E6, 0x0FBFB6A5, 0x35662BD0, 0x8EF0695A,
+   0x2C105F01, 0xDB7AB55B, 0x1F257BC0, 0x19A56C2A,
+   0x33D8C90F, 0xA4064B96, 0x247E6058, 0x8C7DA0B8,
+   0x719B7366, 0xE1AEA884, 0xCC8ED9A0, 0x9CE41608,
+   0xB9E17C7D, 0xE31C236B, 0x908C750B, 0xFBAB70ED,
+   //Window 92
+   0x32A41354, 0x305BB9A8, 0x5929C1DA, 0xB50D25F2,
+   0xC1AD2DF7, 0x0526E29C, 0xD3AD2521, 0xE75EC303,
+   0x5AF9C584, 0x37E078F4, 0x57FB4021, 0x75BD3593,
+   0x6EAFD08A, 0x9400A529, 0x2F0F7C45, 0x9D2DAD27,
+   0x5ABAEE00, 0xA8F595FD, 0x2B34E6F6, 0x3FCBAB7A,
+   0x351939A0, 0x4454CCF4, 0x3B90A779, 0xD4FAFD9C,
+   0xC70677B4, 0xB581DB49, 0x6DE68E88, 0x6513F611,
+   0xAA27DD01, 0xEE6C1DAD, 0xB0E4BFA8, 0x38003190,
+   0x97368687, 0xE77932E0, 0xD51FABC3, 0x216F34B1,
+   0x31320784, 0xE11F3E87, 0x116013F0, 0x0B010799,
+   0x6B611759, 0x032C1B1D, 0x7C3606ED, 0xE421378A,
+   0xA3E2262A, 0xE1FF2628, 0xC320F954, 0x6BA3F533,
+   0x44036294, 0xFB1014E9, 0xFB0A786F, 0x5DF30AC9,
+   0x733843B0, 0x9A36C2F7, 0xBFB36D6C, 0x79969C23,
+   0x1F36852E, 0xEBD0FDCC, 0x9ADCDCFD, 0x83CA7ED7,
+   0x3B505755, 0xD8263A22, 0xA4199621, 0xBADDB865,
+   0xE8184C9F, 0x477A1E8E, 0x28AA2FBB, 0xBD83B243,
+   0x59564F62, 0x3CF0CADA, 0xC6F387A2, 0x32BEBBBC,
+   0x0C5C0B6F, 0xA2176851, 0x58CD30DD, 0x1C37979C,
+   0x68011094, 0xF7EC90B3, 0x5667AD16, 0x589B179B,
+   0x51FAE5A3, 0xDA753361, 0x0F64662D, 0xF2B00FF9,
+   0x36D63791, 0xB1051E30, 0x29010CF1, 0xCB2D8EB9,
+   0x791AFAA6, 0x920047D4, 0xFAC65134, 0x25831468,
+   0x65DC3672, 0x25EAB727, 0x4B264385, 0xBAF9BDBE,
+   0x15267D5E, 0x33D3C66F, 0x9A61F58C, 0x7D78E6C7,
+   0xAE1875BB, 0xBF049603, 0x06F8C1A5, 0x66347C3C,
+   0x2CE0346E, 0xC0B58F0B, 0xD3862E18, 0xB14AFB2B,
+   0x3784919F, 0xCD687D04, 0x08518D89, 0x4743A47F,
+   0xB07077A9, 0xD9FF8608, 0xBB777498, 0xC3086BA0,
+   0x7162E0A5, 0xFFBCF163, 0x8C868DD8, 0x656449F2,
+   0xDDA46949, 0xE57C3B08, 0x90D2B4C7, 0xF0C8A4D9,
+   0x3CE873B8, 0x55837133, 0x5125A418, 0x1DBB6E4E,
+   0xD039A2D3, 0x97F8C7BA, 0xCE7AE406, 0x70DD92CA,
+   0x655B491E, 0x599AF7E4, 0x947720E6, 0x1A396B5B,
+   0x2B774C8D, 0x217A20FC, 0xB3F08469, 0x6148BE1D,
+   0x56785F27, 0xDF3C56AB, 0x9AEB9F50, 0x75486309,
+   0x9C2E8A6D, 0xCDBD3A13, 0xC20FF183, 0x7FF08104,
+   0x256F86E9, 0xF63920D5, 0x4B16A807, 0xAA72A588,
+   0x709BF7BF, 0xC1F5F5C0, 0x0AC8D7E5, 0x858BA722,
+   0x4093377B, 0x403067D6, 0xA2C4C5D2, 0x2143532C,
+   0x83131BB6, 0x0869F51C, 0x8CBA34DA, 0x98FB6DEF,
+   0xF462A0DB, 0xE7D6D7CB, 0xC1C95A79, 0xC1D03C3F,
+   0x2914C870, 0xE8D352BD, 0x08022A49, 0xC7BC71C9,
+   0xF076210F, 0x2759B782, 0xBADBD7E7, 0xCC5484F6,
+   0xB223FB55, 0x67978851, 0x135FEABE, 0x0155B65D,
+   0x78D403D0, 0x2000C0C5, 0x3BBC9383, 0x450E03FD,
+   0xEC5FD49F, 0xB1D74001, 0x6A145211, 0x0707EB3A,
+   0xD2BF8F83, 0x4755B6F0, 0xF78A11C2, 0xEEC72A7B,
+   //Window 93
+   0x65FCCF36, 0x84662BF6, 0xA828E18D, 0xC53F2A9E,
+   0xADDB7D44, 0x342A2176, 0x204BF00B, 0xB8FEC0E2,
+   0x6CC5FFCD, 0xC6BD5E9D, 0x8026401C, 0x47ACF18F,
+   0x90C532EF, 0x6BF12B44, 0x3F791143, 0x8644B4C8,
+   0xD9EC40FA, 0xA3EB5EE6, 0x10C6BA12, 0x30D8C204,
+   0xEB0FEB7B, 0x0C23F41F, 0x1F6D5B1F, 0x1CD46EB6,
+   0x7423DEBC, 0x1897A785, 0xB3970A27, 0x45077DDC,
+   0xB70DB3F0, 0x6EF20970, 0x6D3AD5C2, 0xCB233D44,
+   0x34049756, 0x0684205F, 0xC9826267, 0x56849845,
+   0x20566922, 0xA7CA3308, 0x1DE5D3DA, 0xF5599F1E,
+   0x12E7E3E0, 0x7661EB89, 0x505683AB, 0xD8D35C80,
+   0x90195AE1, 0x4581005E, 0xEC550621, 0x89E8F844,
+   0x15F35A65, 0x83A03673, 0x72CAEDF1, 0xC6DF37B9,
+   0x02967228, 0x1A04F685, 0x0BCD84A3, 0xD61A91BC,
+   0x4FA8A260, 0x5DA49DB5, 0x1A002008, 0x8DFC83A2,
+   0x6062A51D, 0xB4FCDB2D, 0xF3E5669A, 0x177B41F7,
+   0xBC930C7C, 0xFBB80B9F, 0xC96FBCA4, 0xC26AB460,
+   0xACF9E379, 0xBAB80439, 0x5DF9000D, 0x3AD07A49,
+   0x3FA36C32, 0x13DC6BD7, 0x58261858, 0x64FA2EE9,
+   0x2BDA6BF4, 0x558C3415, 0x8EAAD35C, 0x9DDC0151,
+   0xFB8EDC2D, 0xB97DCAED, 0x1C45B0FB, 0x8D9AC94C,
+   0x29431D6F, 0xED387327, 0xCB75DC65, 0x6A44043C,
+   0xC3FE1458, 0x9BA63787, 0x8608A166, 0xC00FF09D,
+   0xF717D130, 0xAC23F223, 0xDBDFC2B6, 0x12F08274,
+   0x8CB84747, 0x91246A8E, 0xCCCE19F1, 0x174CD795,
+   0xB66C3B78, 0x8497D967, 0x436E682F, 0xCB2A56E5,
+   0x4B95FC3F, 0x355A69BF, 0xEEF9F7D1, 0x8FF6ED06,
+   0xB3CF557E, 0xA6275520, 0x71946077, 0x82BB9C92,
+   0xF4A6D262, 0x4CE0E163, 0xC0008D21, 0xE8AAC7BF,
+   0x8D16CB93, 0x2A171097, 0xCDF015D2, 0x186FEE36,
+   0x70015517, 0x799EB44C, 0x14EADA43, 0x99BAA051,
+   0x3BD8B90F, 0x4A19E274, 0xEA6CB4E2, 0x901EA6EA,
+   0xAF7DE155, 0xC403CF8E, 0x1AAD167C, 0xDB3A2F45,
+   0xFADBF8F5, 0x3856F867, 0x2C6C3BDD, 0x4EF6682A,
+   0xBB5FB35B, 0x7725304E, 0x1099809F, 0xD36F2F20,
+   0x6E5ADD54, 0x0B3A0B91, 0x555B58C8, 0x8566179F,
+   0xB0AD1A8D, 0xB982C2B5, 0x8BDBE6D6, 0x591BB259,
+   0x4F59C988, 0xFB54D999, 0xC0E41C0E, 0x77FE1820,
+   0xF900B194, 0xCA3B53DE, 0x6D5C47A3, 0xB8712A24,
+   0x386D39CA, 0x783EFB90, 0x8159443E, 0xADEC9B0F,
+   0x0BFA38C6, 0xE57F907E, 0xF2783574, 0x6C19C125,
+   0xC031165E, 0x8772ADA5, 0x518F0DC1, 0x827C4C7E,
+   0x924138ED, 0x3121D4D9, 0x0E08EF7B, 0x6BB87CD4,
+   0xFE9AAC42, 0x2BE3EA62, 0x21035976, 0x1F3C62DD,
+   0x0506BD4B, 0xB80D2E6D, 0x38604AB3, 0xA79BFB73,
+   0xA980D38C, 0x1045091F, 0x2DE33928, 0xEC28A2C5,
+   0x8BB136B4, 0x26D7E37D, 0x0335F656, 0xB63F74FC,
+   0x78AB429F, 0x133B99DA, 0x99291987, 0x7D1C42E6,
+   //Window 94
+   0xB41F372E, 0x4D15EB3D, 0x5413894A, 0xA8A8ACCE,
+   0x75665B49, 0xF1F33FCA, 0xFD23529E, 0xF0711A2F,
+   0xD87A4A75, 0x57FFCACA, 0xFF113D37, 0x2841B4DA,
+   0xC9FAB249, 0xC2181590, 0xDB3E1B77, 0xC2582DB4,
+   0x9CFC4D7E, 0x1C2D3890, 0x15550E58, 0x96AD8A95,
+   0x529FA3EF, 0x7184F9FF, 0x1A5318D1, 0x7C4525E9,
+   0x0F9E1744, 0x8B6F666F, 0x59D72A87, 0xD8E3E549,
+   0xC392B5D1, 0xC7F54D8A, 0x4815D2D4, 0x6AFFE164,
+   0xE528FFF0, 0x0E0C1440, 0x6FD73C26, 0x47284ADA,
+   0x1535180D, 0x97843F5C, 0xCE6B1E21, 0x39462702,
+   0x407429F1, 0xAB5F1E3A, 0xA79ECCBD, 0x8ECCF405,
+   0xD0E932BC, 0xE55E5B93, 0xE2DE9A2D, 0xEF7D458F,
+   0x3DF27F29, 0x69D4775D, 0x76DC1186, 0x1D9F2129,
+   0x2146C1C9, 0x5C731AD3, 0x322B33F7, 0xC46BD484,
+   0x7CC1B942, 0x1C16C773, 0xB633AC2E, 0x0C1D5D76,
+   0x30F84B4D, 0x24E22479, 0xA5317A4A, 0x9F1FD92F,
+   0x26AA9512, 0x443A45B5, 0xDE6F8FB4, 0x1899D6A7,
+   0x9A78CC74, 0x6BCDE7F5, 0xFB0753BD, 0x801EAB68,
+   0x8C06C000, 0x3AAEB2E6, 0x1A92F343, 0x9AFAF26E,
+   0x21C70508, 0x95022F2E, 0x7F337C5B, 0x2B5D265C,
+   0x4B385732, 0xB7F03992, 0xB3361DFA, 0x9E643D54,
+   0x57A0859A, 0xEA53ED78, 0x41847626, 0xF3366C0C,
+   0x36571376, 0xD51AEE30, 0x7B0EADDF, 0x62C189B2,
+   0x3253E3F6, 0x26547FCC, 0x0735F842, 0x7ED0EAA9,
+   0x8915C661, 0x06BB411A, 0x64C15386, 0x19BCC305,
+   0xB2F1584B, 0x55B9CCC6, 0xACDDDD4A, 0x3C8D2957,
+   0x31604AA5, 0xE39F9AB0, 0x1BE65B9C, 0x11EDCE64,
+   0x8A4D54C2, 0x6A1575ED, 0x478924B9, 0x27D83AFB,
+   0xE6DD1D1E, 0x43E936E3, 0x4A516248, 0x7FFFB505,
+   0x6B98E4CC, 0x6B68CC1B, 0xB0BDD3DF, 0x9A9FA9B6,
+   0x48575770, 0x905E4B83, 0x9378F715, 0x68C0A85A,
+   0x32FB7A57, 0x5FC1348A, 0xF36E85DD, 0xF7B53CF4,
+   0xDA23043A, 0xDDCCEC9A, 0xD53B9092, 0xF3DAC8F1,
+   0x7626259E, 0x3191B1A5, 0x0DF42792, 0xA1E59495,
+   0xF44CB20E, 0xE4B43AAB, 0x3831AA2B, 0x4B0B102F,
+   0x128948E2, 0x92A1E33F, 0x686B8E2C, 0x3B20BEBB,
+   0xF5A8ECA4, 0x3ADB013A, 0xDBE7F286, 0x66B87476,
+   0xA989CB3B, 0xE6EFB627, 0x4DD14118, 0x85B75AF8,
+   0x0C1C8F16, 0x467A054C, 0x59928CF5, 0x3A230E46,
+   0x8F6B6EFA, 0xB3D67997, 0xFFD46E29, 0x94BD750C,
+   0x459F4426, 0x0B5051DC, 0xC2FEBE3B, 0x5DEBA33B,
+   0xE5631A68, 0xEF0ACF4B, 0xDF74F200, 0xBCC1DC46,
+   0x92DAC25B, 0x174EE092, 0xF1E31A6A, 0xBB483CC0,
+   0xC2930E46, 0xE31EC466, 0x5F7DAAB9, 0x4499B142,
+   0xD240C22B, 0x552A55EA, 0x5311B31B, 0x458AA1A8,
+   0x565173D6, 0xBAF0580F, 0xD7F68985, 0xEA246107,
+   0x23157D07, 0x6E290EA3, 0x847039CF, 0x0D1209FA,
+   0x25070279, 0xD419F919, 0x393C3D36, 0xACB31BCD,
+   //Window 95
+   0xFDB89D39, 0x712AE60E, 0x23F83B51, 0x3ABF3C50,
+   0x1E1C7829, 0xC5986922, 0xB24CADD3, 0x35D95B85,
+   0x40AA05FE, 0xF5A82B37, 0xE7F5D8F7, 0x13BEEE45,
+   0xDF741A6A, 0xA6AA9EC1, 0x7EECD684, 0x514D1C37,
+   0x91C00276, 0x147D8AEF, 0x13214EA1, 0xBDDD1AAA,
+   0xBA8A0868, 0x15BAD99A, 0x4F01F331, 0x434837EA,
+   0x6C58CDD2, 0x7D706218, 0x9BE0D983, 0x4E96A091,
+   0x11E1793F, 0x071249E1, 0x5F7BA629, 0xA3082D06,
+   0x233BC618, 0x4F9E07CD, 0x4148431A, 0x2A5615B7,
+   0x05650C43, 0xB1612828, 0x5282F503, 0xE8879DA7,
+   0x99835FA6, 0x087B6120, 0x3FE4FFA2, 0x6AD59FF8,
+   0xFC242E88, 0x6C8C74A4, 0x5BFCA1A6, 0x4FDDFC03,
+   0x600BBB94, 0xE15F77AF, 0x66AEBBE4, 0x74D09059,
+   0xF193C1D2, 0xC483E256, 0xB486A1F5, 0xEF8574B8,
+   0x7ADA9FF8, 0x87D5947B, 0x02C1C428, 0x51A45D4F,
+   0xD4D93F13, 0x35C13923, 0x611475C7, 0x9A71FC22,
+   0xBC031AE1, 0x2C9F07D5, 0xA699423D, 0xD4791C58,
+   0x7D7D1FD2, 0x163B3F08, 0x2078CA4D, 0x9AFD2B0D,
+   0xE610F88A, 0x9EA209FE, 0xC1DF1037, 0x2AFC4791,
+   0x2EB4E013, 0xC18E5AB2, 0x2AD5ED49, 0x65E53633,
+   0x673FF029, 0xE67B7C25, 0x0A2F76DF, 0xEAAF9947,
+   0x37656B5A, 0xAEC6F488, 0x9F3643EB, 0xB9814CBC,
+   0x61F5DC25, 0x3EBD229B, 0x95321B9A, 0x3780F531,
+   0x4E46374C, 0xADD73327, 0xF2CAC56A, 0x6BE0D35C,
+   0x51DA70C9, 0x9EF7421D, 0x3821DA34, 0x8D071927,
+   0x78B82E9B, 0x273A17A6, 0xDE5C17C9, 0x0F9281CC,
+   0x3EE5F2E5, 0x6F29BE72, 0x000A1164, 0xEBC61E50,
+   0x2CAEBEBB, 0xF4D28D59, 0xBDA35ADB, 0xD3176A7F,
+   0xBF7B2DD0, 0xEDDA6DBB, 0x7B3D9BA0, 0xA93D867B,
+   0x61CFEB98, 0x12990F41, 0xA5963BA1, 0xCDE556C3,
+   0xB499D126, 0x967115FB, 0xF3C0AA13, 0x62CF0567,
+   0x813515C2, 0x1420F74D, 0x44A90380, 0x26D21CCD,
+   0xF5F8BCEC, 0x74207AFD, 0xE5233130, 0xBA2E0BCF,
+   0x7F0B1453, 0xABF2D92F, 0xA529FFBD, 0xA980A7AA,
+   0x622B29BC, 0x415699EE, 0xA834F38B, 0x24BCA161,
+   0xCDF99CD0, 0x781B303D, 0x3352D132, 0xA00B595E,
+   0xF34F7EBC, 0xB51DBB68, 0xF7E38637, 0x6D57D3E2,
+   0xE66B47E9, 0x1A5A9CA3, 0x29DCB8AF, 0x6600469C,
+   0x5AE491D2, 0x1B3E05F0, 0xB6A41A35, 0xC4952695,
+   0x07372F4D, 0xE97543CD, 0x070067A3, 0xBAC56EEA,
+   0xF98565E1, 0xE2A24F19, 0x7C42B13F, 0x83EA38A1,
+   0x354B8E3D, 0xAF550033, 0xC0E06C92, 0x9A05342F,
+   0xD98A9228, 0x4AB3D4B1, 0x0EF51376, 0xD78D2864,
+   0x4E1D477D, 0xD601C8E6, 0xF1B35933, 0x41AA3770,
+   0xECA7DFC0, 0xA1ED2F87, 0x8BFD6680, 0x4B7B4782,
+   0xEB156373, 0x5DD832D3, 0x41C65EED, 0x65751943,
+   0x0B9FDF1F, 0x15927DE3, 0x1C970F87, 0xD28030AA,
+   0x886FA3DB, 0x95F75F2A, 0xA771DB89, 0xC65744B0
+};
+
+#endif
+#endif
@@ -0,0 +1,559 @@
+/**
+ * @file p521.c
+ * @brief Dedicated secp521r1 (NIST P-521) implementation
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * Field elements are stored as 17 words of 32 bits. Since p = 2^521 - 1 is a
+ * Mersenne prime, products are reduced by adding the upper part of the
+ * result to the lower part.
+ * The point arithmetic and the scalar multiplication are shared with the
+ * other NIST curves (refer to ec_nist.c)
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec.h"
+#include "ecc/ec_nist.h"
+#include "ecc/p521.h"
+#include "ecc/p521_table.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (EC_SUPPORT == ENABLED && SECP521R1_SUPPORT == ENABLED && \
+   P521_SUPPORT == ENABLED)
+
+//Number of windows used by the scalar multiplication
+#define P521_NUM_WINDOWS 131
+
+//Prime modulus p
+static const uint32_t P521_P[17] =
+{
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0x000001FF
+};
+
+//Curve parameter b
+static const uint32_t P521_B[17] =
+{
+   0x6B503F00, 0xEF451FD4, 0x3D2C34F1, 0x3573DF88,
+   0x3BB1BF07, 0x1652C0BD, 0xEC7E937B, 0x56193951,
+   0x8EF109E1, 0xB8B48991, 0x99B315F3, 0xA2DA725B,
+   0xB68540EE, 0x929A21A0, 0x8E1C9A1F, 0x953EB961,
+   0x00000051
+};
+
+//Order of the base point q
+static const uint32_t P521_Q[17] =
+{
+   0x91386409, 0xBB6FB71E, 0x899C47AE, 0x3BB5C9B8,
+   0xF709A5D0, 0x7FCC0148, 0xBF2F966B, 0x51868783,
+   0xFFFFFFFA, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+   0x000001FF
+};
+
+//Value 1
+static const uint32_t P521_ONE[17] =
+{
+   0x00000001, 0x00000000, 0x00000000, 0x00000000,
+   0x00000000, 0x00000000, 0x00000000, 0x00000000,
+   0x00000000, 0x00000000, 0x00000000, 0x00000000,
+   0x00000000, 0x00000000, 0x00000000, 0x00000000,
+   0x00000000
+};
+
+//Base point G (affine coordinates)
+static const uint8_t P521_G[132] =
+{
+   0x00, 0xC6, 0x85, 0x8E, 0x06, 0xB7, 0x04, 0x04, 0xE9, 0xCD, 0x9E, 0x3E, 0xCB, 0x66, 0x23, 0x95,
+   0xB4, 0x42, 0x9C, 0x64, 0x81, 0x39, 0x05, 0x3F, 0xB5, 0x21, 0xF8, 0x28, 0xAF, 0x60, 0x6B, 0x4D,
+   0x3D, 0xBA, 0xA1, 0x4B, 0x5E, 0x77, 0xEF, 0xE7, 0x59, 0x28, 0xFE, 0x1D, 0xC1, 0x27, 0xA2, 0xFF,
+   0xA8, 0xDE, 0x33, 0x48, 0xB3, 0xC1, 0x85, 0x6A, 0x42, 0x9B, 0xF9, 0x7E, 0x7E, 0x31, 0xC2, 0xE5,
+   0xBD, 0x66, 0x01, 0x18, 0x39, 0x29, 0x6A, 0x78, 0x9A, 0x3B, 0xC0, 0x04, 0x5C, 0x8A, 0x5F, 0xB4,
+   0x2C, 0x7D, 0x1B, 0xD9, 0x98, 0xF5, 0x44, 0x49, 0x57, 0x9B, 0x44, 0x68, 0x17, 0xAF, 0xBD, 0x17,
+   0x27, 0x3E, 0x66, 0x2C, 0x97, 0xEE, 0x72, 0x99, 0x5E, 0xF4, 0x26, 0x40, 0xC5, 0x50, 0xB9, 0x01,
+   0x3F, 0xAD, 0x07, 0x61, 0x35, 0x3C, 0x70, 0x86, 0xA2, 0x72, 0xC2, 0x40, 0x88, 0xBE, 0x94, 0x76,
+   0x9F, 0xD1, 0x66, 0x50
+};
+
+//Dedicated secp521r1 implementation
+static const EcNistCurve p521Curve =
+{
+   P521_WORD_LEN,
+   P521_BYTE_LEN,
+   P521_BIT_LEN,
+   P521_NUM_WINDOWS,
+   P521_Q,
+   P521_B,
+   P521_ONE,
+   NULL,
+   P521_G,
+#if (EC_NIST_BASE_TABLE_SUPPORT == ENABLED)
+   P521_BASE_TABLE,
+#else
+   NULL,
+#endif
+   p521Add,
+   p521Sub,
+   p521Mul,
+   p521Inv,
+   p521Import,
+   p521Export
+};
+
+
+/**
+ * @brief Check whether the domain parameters match secp521r1
+ * @param[in] params EC domain parameters
+ * @return TRUE if the dedicated implementation can be used, else FALSE
+ **/
+
+bool_t p521IsCurve(const EcDomainParameters *params)
+{
+   bool_t res;
+
+   //Check curve name
+   if(params->name != NULL && !osStrcmp(params->name, "secp521r1"))
+   {
+      res = TRUE;
+   }
+   else
+   {
+      res = FALSE;
+   }
+
+   //Return TRUE if the domain parameters match secp521r1
+   return res;
+}
+
+
+/**
+ * @brief Set integer value
+ * @param[out] a Pointer to the integer to be initialized
+ * @param[in] b Initial value
+ **/
+
+void p521SetInt(uint32_t *a, uint32_t b)
+{
+   uint_t i;
+
+   //Set the value of the least significant word
+   a[0] = b;
+
+   //Initialize the rest of the integer
+   for(i = 1; i < 17; i++)
+   {
+      a[i] = 0;
+   }
+}
+
+
+/**
+ * @brief Modular reduction
+ * @param[out] r Resulting integer R = A mod p
+ * @param[in] a An integer such as 0 <= A < 2^522
+ **/
+
+static void p521Red(uint32_t *r, const uint32_t *a)
+{
+   uint_t i;
+   uint64_t c;
+   int64_t temp;
+   uint32_t u[17];
+   uint32_t b[17];
+
+   //Since 2^521 = 1 mod p, the bit 521 is folded back into the lower part
+   for(c = a[16] >> 9, i = 0; i < 17; i++)
+   {
+      if(i < 16)
+      {
+         c += a[i];
+      }
+      else
+      {
+         c += a[i] & 0x1FF;
+      }
+
+      u[i] = c & 0xFFFFFFFF;
+      c >>= 32;
+   }
+
+   //Compute B = U - P
+   for(temp = 0, i = 0; i < 17; i++)
+   {
+      temp += u[i];
+      temp -= P521_P[i];
+      b[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //The intermediate result is in the range 0 <= U <= p + 1. If U < P then
+   //R = U, else R = B
+   p521Select(r, b, u, temp & 1);
+}
+
+
+/**
+ * @brief Modular addition
+ * @param[out] r Resulting integer R = (A + B) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void p521Add(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+   uint64_t temp;
+   uint32_t u[17];
+
+   //Compute U = A + B
+   for(temp = 0, i = 0; i < 17; i++)
+   {
+      temp += a[i];
+      temp += b[i];
+      u[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //Perform modular reduction (U < 2p does not overflow 17 words)
+   p521Red(r, u);
+}
+
+
+/**
+ * @brief Modular subtraction
+ * @param[out] r Resulting integer R = (A - B) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void p521Sub(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+   int64_t temp;
+   uint32_t mask;
+   uint32_t u[17];
+
+   //Compute U = A - B
+   for(temp = 0, i = 0; i < 17; i++)
+   {
+      temp += a[i];
+      temp -= b[i];
+      u[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+
+   //The mask is the all-1 word if the result is negative
+   mask = (uint32_t) temp;
+
+   //If U < 0 then R = U + P, else R = U
+   for(temp = 0, i = 0; i < 17; i++)
+   {
+      temp += u[i];
+      temp += P521_P[i] & mask;
+      r[i] = temp & 0xFFFFFFFF;
+      temp >>= 32;
+   }
+}
+
+
+/**
+ * @brief Modular multiplication
+ * @param[out] r Resulting integer R = (A * B) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] b An integer such as 0 <= B < p
+ **/
+
+void p521Mul(uint32_t *r, const uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+   uint_t j;
+   uint64_t c;
+   uint32_t u[34];
+   uint32_t v[17];
+
+   //Initialize the product
+   for(i = 0; i < 34; i++)
+   {
+      u[i] = 0;
+   }
+
+   //Compute U = A * B
+   for(i = 0; i < 17; i++)
+   {
+      for(c = 0, j = 0; j < 17; j++)
+      {
+         c += (uint64_t) a[j] * b[i] + u[i + j];
+         u[i + j] = c & 0xFFFFFFFF;
+         c >>= 32;
+      }
+
+      u[i + 17] = (uint32_t) c;
+   }
+
+   //Since 2^521 = 1 mod p, compute V = (U mod 2^521) + (U >> 521)
+   for(c = 0, i = 0; i < 17; i++)
+   {
+      if(i < 16)
+      {
+         c += u[i];
+      }
+      else
+      {
+         c += u[i] & 0x1FF;
+      }
+
+      c += (u[i + 16] >> 9) | (u[i + 17] << 23);
+      v[i] = c & 0xFFFFFFFF;
+      c >>= 32;
+   }
+
+   //The intermediate result is in the range 0 <= V < 2^522
+   p521Red(r, v);
+}
+
+
+/**
+ * @brief Modular squaring
+ * @param[out] r Resulting integer R = (A ^ 2) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ **/
+
+void p521Sqr(uint32_t *r, const uint32_t *a)
+{
+   //Compute R = A ^ 2
+   p521Mul(r, a, a);
+}
+
+
+/**
+ * @brief Raise an integer to the power 2^n
+ * @param[out] r Resulting integer R = (A ^ (2^n)) mod p
+ * @param[in] a An integer such as 0 <= A < p
+ * @param[in] n An integer such as n >= 1
+ **/
+
+static void p521Pwr2(uint32_t *r, const uint32_t *a, uint_t n)
+{
+   uint_t i;
+
+   //Pre-compute (A ^ 2) mod p
+   p521Sqr(r, a);
+
+   //Compute R = (A ^ (2^n)) mod p
+   for(i = 1; i < n; i++)
+   {
+      p521Sqr(r, r);
+   }
+}
+
+
+/**
+ * @brief Modular multiplicative inverse
+ * @param[out] r Resulting integer R = A^-1 mod p
+ * @param[in] a An integer such as 0 <= A < p
+ **/
+
+void p521Inv(uint32_t *r, const uint32_t *a)
+{
+   uint32_t u[17];
+   uint32_t v[17];
+   uint32_t w[17];
+
+   //Since GF(p) is a prime field, the Fermat's little theorem can be
+   //used to find the multiplicative inverse of A modulo p
+   p521Sqr(u, a);
+   p521Mul(u, u, a); //A^(2^2 - 1)
+   p521Sqr(v, u);
+   p521Mul(v, v, a); //A^(2^3 - 1)
+   p521Pwr2(u, v, 3);
+   p521Mul(u, u, v); //A^(2^6 - 1)
+   p521Sqr(w, u);
+   p521Mul(w, w, a); //A^(2^7 - 1)
+   p521Sqr(u, w);
+   p521Mul(u, u, a); //A^(2^8 - 1)
+   p521Pwr2(v, u, 8);
+   p521Mul(v, v, u); //A^(2^16 - 1)
+   p521Pwr2(u, v, 16);
+   p521Mul(u, u, v); //A^(2^32 - 1)
+   p521Pwr2(v, u, 32);
+   p521Mul(v, v, u); //A^(2^64 - 1)
+   p521Pwr2(u, v, 64);
+   p521Mul(u, u, v); //A^(2^128 - 1)
+   p521Pwr2(v, u, 128);
+   p521Mul(v, v, u); //A^(2^256 - 1)
+   p521Pwr2(u, v, 256);
+   p521Mul(u, u, v); //A^(2^512 - 1)
+   p521Pwr2(u, u, 7);
+   p521Mul(u, u, w); //A^(2^519 - 1)
+   p521Sqr(u, u);
+   p521Sqr(u, u);
+   p521Mul(r, u, a); //A^(2^521 - 3)
+}
+
+
+/**
+ * @brief Copy an integer
+ * @param[out] a Pointer to the destination integer
+ * @param[in] b Pointer to the source integer
+ **/
+
+void p521Copy(uint32_t *a, const uint32_t *b)
+{
+   uint_t i;
+
+   //Copy the value of the integer
+   for(i = 0; i < 17; i++)
+   {
+      a[i] = b[i];
+   }
+}
+
+
+/**
+ * @brief Select an integer
+ * @param[out] r Pointer to the destination integer
+ * @param[in] a Pointer to the first source integer
+ * @param[in] b Pointer to the second source integer
+ * @param[in] c Condition variable
+ **/
+
+void p521Select(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   uint32_t c)
+{
+   uint_t i;
+   uint32_t mask;
+
+   //The mask is the all-1 or all-0 word
+   mask = c - 1;
+
+   //Select between A and B
+   for(i = 0; i < 17; i++)
+   {
+      //Constant time implementation
+      r[i] = (a[i] & mask) | (b[i] & ~mask);
+   }
+}
+
+
+/**
+ * @brief Import an octet string
+ * @param[out] a Pointer to resulting integer
+ * @param[in] data Octet string to be converted (big-endian)
+ **/
+
+void p521Import(uint32_t *a, const uint8_t *data)
+{
+   uint_t i;
+
+   //Convert from big-endian byte order to host byte order
+   for(i = 0; i < 16; i++)
+   {
+      a[i] = LOAD32BE(data + 62 - i * 4);
+   }
+
+   //The most significant word is made of 2 bytes only
+   a[16] = LOAD16BE(data);
+}
+
+
+/**
+ * @brief Export an octet string
+ * @param[in] a Pointer to the integer to be exported
+ * @param[out] data Octet string resulting from the conversion (big-endian)
+ **/
+
+void p521Export(const uint32_t *a, uint8_t *data)
+{
+   uint_t i;
+
+   //Convert from host byte order to big-endian byte order
+   for(i = 0; i < 16; i++)
+   {
+      STORE32BE(a[i], data + 62 - i * 4);
+   }
+
+   //The most significant word is made of 2 bytes only
+   STORE16BE(a[16], data);
+}
+
+
+/**
+ * @brief Scalar multiplication
+ * @param[out] r Resulting point R = d.S
+ * @param[in] d An integer d such as 0 <= d < 2^521
+ * @param[in] s EC point
+ * @return Error code
+ **/
+
+error_t p521Mult(EcPoint *r, const Mpi *d, const EcPoint *s)
+{
+   //Use the common NIST curve layer
+   return ecNistMult(&p521Curve, r, d, s);
+}
+
+
+/**
+ * @brief Precompute the multiples of a point
+ * @param[out] table Table of precomputed multiples
+ * @param[in] s EC point (affine coordinates)
+ * @return Error code
+ **/
+
+error_t p521BuildTable(EcBaseTable *table, const EcPoint *s)
+{
+   //Use the common NIST curve layer
+   return ecNistBuildTable(&p521Curve, table, s);
+}
+
+
+/**
+ * @brief Twin multiplication with the base point
+ * @param[out] r Resulting point R = d0.G + d1.T (Jacobian coordinates)
+ * @param[in] d0 An integer d such as 0 <= d0 < 2^521
+ * @param[in] d1 An integer d such as 0 <= d1 < 2^521
+ * @param[in] t EC point (affine coordinates)
+ * @param[in] table Precomputed multiples of T (optional parameter)
+ * @return Error code
+ **/
+
+error_t p521TwinMultBase(EcPoint *r, const Mpi *d0, const Mpi *d1,
+   const EcPoint *t, const EcBaseTable *table)
+{
+   //Use the common NIST curve layer
+   return ecNistTwinMultBase(&p521Curve, r, d0, d1, t, table);
+}
+
+#endif
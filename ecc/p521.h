@@ -0,0 +1,86 @@
+/**
+ * @file p521.h
+ * @brief Dedicated secp521r1 (NIST P-521) implementation
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+#ifndef _P521_H
+#define _P521_H
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec.h"
+
+//Dedicated secp521r1 implementation
+#ifndef P521_SUPPORT
+   #define P521_SUPPORT ENABLED
+#elif (P521_SUPPORT != ENABLED && P521_SUPPORT != DISABLED)
+   #error P521_SUPPORT parameter is not valid
+#endif
+
+//Length of the elliptic curve
+#define P521_BIT_LEN 521
+#define P521_BYTE_LEN 66
+#define P521_WORD_LEN 17
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+//secp521r1 related functions
+bool_t p521IsCurve(const EcDomainParameters *params);
+
+error_t p521Mult(EcPoint *r, const Mpi *d, const EcPoint *s);
+
+error_t p521BuildTable(EcBaseTable *table, const EcPoint *s);
+
+error_t p521TwinMultBase(EcPoint *r, const Mpi *d0, const Mpi *d1,
+   const EcPoint *t, const EcBaseTable *table);
+
+void p521SetInt(uint32_t *a, uint32_t b);
+void p521Add(uint32_t *r, const uint32_t *a, const uint32_t *b);
+void p521Sub(uint32_t *r, const uint32_t *a, const uint32_t *b);
+void p521Mul(uint32_t *r, const uint32_t *a, const uint32_t *b);
+void p521Sqr(uint32_t *r, const uint32_t *a);
+void p521Inv(uint32_t *r, const uint32_t *a);
+
+void p521Copy(uint32_t *a, const uint32_t *b);
+
+void p521Select(uint32_t *r, const uint32_t *a, const uint32_t *b,
+   uint32_t c);
+
+void p521Import(uint32_t *a, const uint8_t *data);
+void p521Export(const uint32_t *a, uint8_t *data);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,9619 @@
+/**
+ * @file p521_table.h
+ * @brief Precomputed multiples of the secp521r1 base point
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * This file is generated by ec_nist_tables.py and must not be edited. For
+ * each 4-bit window i, the table holds the affine coordinates of the points
+ * (2.j + 1).2^(4.i).G, where 0 <= j < 8, in the internal representation of
+ * the field (plain value)
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+#ifndef _P521_TABLE_H
+#define _P521_TABLE_H
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec_nist.h"
+#include "ecc/p521.h"
+
+//Check crypto library configuration
+#if (EC_SUPPORT == ENABLED && SECP521R1_SUPPORT == ENABLED && \
+   P521_SUPPORT == ENABLED && EC_NIST_BASE_TABLE_SUPPORT == ENABLED)
+
+//Precomputed multiples of the base point
+static const uint32_t P521_BASE_TABLE[35632] =
+{
+   //Window 0
+   0xC2E5BD66, 0xF97E7E31, 0x856A429B, 0x3348B3C1,
+   0xA2FFA8DE, 0xFE1DC127, 0xEFE75928, 0xA14B5E77,
+   0x6B4D3DBA, 0xF828AF60, 0x053FB521, 0x9C648139,
+   0x2395B442, 0x9E3ECB66, 0x0404E9CD, 0x858E06B7,
+   0x000000C6, 0x9FD16650, 0x88BE9476, 0xA272C240,
+   0x353C7086, 0x3FAD0761, 0xC550B901, 0x5EF42640,
+   0x97EE7299, 0x273E662C, 0x17AFBD17, 0x579B4468,
+   0x98F54449, 0x2C7D1BD9, 0x5C8A5FB4, 0x9A3BC004,
+   0x39296A78, 0x00000118,
+   0xDE37AD7D, 0xA5919D2E, 0x2C32EA05, 0xAEB49086,
+   0xB59FE21B, 0x1DA6BD16, 0x3A483205, 0xAD3F164A,
+   0x2D7A8DD1, 0xE5AD7A11, 0x123D9AB9, 0xB52A6E5B,
+   0xB5959479, 0xD91D6A64, 0xDE29195D, 0x3D352443,
+   0x000001A7, 0xEE86C0E5, 0x5F588CA1, 0x93A59042,
+   0xF105C9BC, 0xDEC3C70C, 0x2D5ACED1, 0x8DC575B0,
+   0x2E2DD4CF, 0xA355CEEC, 0xD2F8AB1F, 0x2A9D0317,
+   0xF1557FA8, 0xCAB814F2, 0x979F86C6, 0xFA62DDD9,
+   0x9B03B97D, 0x0000013E,
+   0xEC8F3078, 0xD5AB5096, 0xD8931738, 0x29D7E1E6,
+   0x137E79A3, 0x7112FEAF, 0x5E301423, 0x383C0C6D,
+   0xF177ACE4, 0xCF03DAB8, 0xB53F0D24, 0x7A596EFD,
+   0xC04EB0BF, 0x3DBC3391, 0x27A432C7, 0x2BF3C529,
+   0x00000065, 0xDEB090CB, 0x173CC3E8, 0x7354F7F8,
+   0xD1F00725, 0x1CF5FF79, 0x31154021, 0x072CF374,
+   0xBB6897C9, 0xA0347087, 0xEDD817C9, 0x872E0051,
+   0x1CD8FE8E, 0x4A811291, 0x8A2B7311, 0x6601D6EC,
+   0xE6EF1BDD, 0x0000015B,
+   0x2816ECD4, 0x01CEAD88, 0xFDC2619A, 0x6F953F50,
+   0xDCE3BBC4, 0xC9A6DF30, 0xBFC698D8, 0x8C308D0A,
+   0xF7114C5D, 0xF018D2C2, 0xF5483228, 0x5F22E0E8,
+   0x0B073A0C, 0xEEB65FDA, 0x5B7F6346, 0xD5D1D99D,
+   0x00000056, 0x0525251B, 0x5C6B8BC9, 0x5DDEFC7B,
+   0x9E76712A, 0x91CE1A5F, 0x9523A345, 0xCDEC9E2B,
+   0x6BD0F293, 0x26CBDE55, 0x71DBD98A, 0x2824F0DD,
+   0xB5C582D0, 0x39D68478, 0xD1D8317A, 0xAAA2A110,
+   0x2D1B7D9B, 0x0000003D,
+   0x67CBE207, 0x1F456279, 0x85CD2866, 0x4F50BABD,
+   0x725A318F, 0xF3C556DF, 0x6134DA35, 0x7429E139,
+   0xB8C6B665, 0x2C4AB145, 0x98874699, 0xED34541B,
+   0x7156D488, 0xA2F5BF15, 0xE1E21826, 0x5389E359,
+   0x00000158, 0xB9AD2A4E, 0x3AA0EA86, 0x28880F34,
+   0x736C2AE9, 0x4ABFD87D, 0x0FF56ECF, 0x6057AC84,
+   0x0D69E575, 0x3DDB446E, 0xC825BA26, 0xEE1CEBB6,
+   0x3088A654, 0x27AE938E, 0x0B55557A, 0x8AEDF39F,
+   0x2E618C9A, 0x0000002A,
+   0xDA0CDB9A, 0xECC0E02D, 0xA4C9A902, 0x015C024F,
+   0xE3191085, 0xD19B1AEB, 0x2663DA1B, 0xF3DBC533,
+   0xF2991652, 0x43EF2C54, 0x7C178495, 0xED5DC7ED,
+   0x3B4315CF, 0x6F1A3957, 0xFDEDFF54, 0x75841259,
+   0x0000008A, 0xCE48C808, 0x58874F92, 0xF4819B5D,
+   0xDCAC80E3, 0x14A95336, 0x38923319, 0x8B42A4AB,
+   0x1BC8A90E, 0xE0B9B82B, 0xED2E95D4, 0x10BD0493,
+   0x3ADD5662, 0x054FB229, 0x9D0CA877, 0xBA212984,
+   0xFB303FCB, 0x00000096,
+   0x32FBCDA7, 0x1887848D, 0xAB38EFF8, 0x4BEC3B00,
+   0x9AB88EE9, 0x3550A5E7, 0xE03C996A, 0x32C45908,
+   0xAF5B8661, 0x4EEDD2BE, 0xE1B4C238, 0x93F736CD,
+   0x4924861A, 0xD7865D2B, 0xC396AD9C, 0x3E98F984,
+   0x0000007E, 0x022A71C9, 0x291A01FB, 0x9117E9F7,
+   0x6199EAAF, 0x1CBFBBC3, 0x26DFDD35, 0x38BC763F,
+   0xC1BD5D58, 0x5C1E212A, 0x9C7A67AE, 0x6D5421C6,
+   0xCED50A38, 0xA3ED5A08, 0x1A1926DA, 0x781FEDA9,
+   0xEE58EB6D, 0x00000108,
+   0xBCB8DB55, 0xE9AFE337, 0x1E3F92BD, 0x9B8D9698,
+   0x8FC0331D, 0x7875BD1C, 0xDBD00FFE, 0xB91CCE27,
+   0xDF128E11, 0xD697B532, 0xB40A0852, 0xB8FBCC30,
+   0x46D4300F, 0x41558FC5, 0xB92465F0, 0x6AD89ABC,
+   0x0000006B, 0xA1475465, 0x56343480, 0x446ABDD9,
+   0x46FD90CC, 0x2C96C992, 0x2148E223, 0x99470A80,
+   0x7E9062C8, 0x97485ED5, 0x4B621069, 0xBAD20CBA,
+   0xDF0496A9, 0x33EDBF63, 0x7CE64D23, 0x71391D6A,
+   0x68DA2715, 0x000001B4,
+   //Window 1
+   0x81A8402F, 0x3A6C508F, 0x07DCDC53, 0x0DBF5C80,
+   0x985630DF, 0xE5965DA7, 0x61CA00A0, 0x943FF188,
+   0x0B188A52, 0xD632F8D2, 0x92FD3F3D, 0x2A87F661,
+   0xAC743B0B, 0xDA97DA26, 0x9C8AD05D, 0x7D10D8A8,
+   0x000001D1, 0x9BC73ABE, 0x52E272F8, 0x8D186333,
+   0x9E3004D2, 0x9D998852, 0x0B3075AC, 0x8DB547AA,
+   0xC182E139, 0x4B6B82C1, 0xC7CA30C9, 0xB800D50E,
+   0x1335E4C3, 0x3D3E6972, 0xC714B18D, 0x2D77001F,
+   0x37343C58, 0x0000007A,
+   0x2AD879AD, 0x87027D61, 0x214AEA2C, 0x641752BD,
+   0x0FF08EE6, 0xDEDC21B1, 0x3F6FBFAC, 0x2DA0980F,
+   0x803E72F4, 0x4B3CC8A5, 0x72102C33, 0xAE7D6D66,
+   0xEC62C8CC, 0x8158E5CA, 0x557462AC, 0x35DE3B21,
+   0x000001FB, 0xD256D46B, 0xB1958193, 0x4841CAE7,
+   0x596F2480, 0xFB0E3C28, 0xB7C142E0, 0xA1D97E37,
+   0xE6214D64, 0x6CC2E1BA, 0x871294F6, 0x4D09E2CC,
+   0x76F27FC9, 0x4BB3F5C1, 0xA855B9EC, 0x87992DED,
+   0x34A5AC15, 0x0000018D,
+   0x437E2BC8, 0xE19A15BD, 0x4007851E, 0x7FC53AE2,
+   0x93597630, 0xE8C0B16E, 0xB83FC6BF, 0xCDF7D2A0,
+   0xAF8B0DE1, 0x31293A9D, 0x2DB6458A, 0x54ECED79,
+   0xD3F4D699, 0x47749B5D, 0xF68D676E, 0xC57327BE,
+   0x000000BF, 0xE7A2B137, 0x7D44E666, 0xB737AF35,
+   0x88F136D2, 0xA49882E8, 0xCD66D0FE, 0xFDB747C6,
+   0x1D9971D0, 0xB293A9E3, 0x8AFF486A, 0x6A44B0AB,
+   0x23D4E763, 0x81AC01C2, 0x2444864E, 0x8C059532,
+   0x876EC073, 0x00000152,
+   0xAF1479F7, 0x2B05A8D8, 0xBA3231E4, 0x65B390E9,
+   0x3041C9DC, 0xD388A223, 0x19B3DC8E, 0xA5B816F1,
+   0x3B9C4734, 0xEDD4115A, 0xA39C61F7, 0x2C8DFCD8,
+   0x8D0116E7, 0x551DB00F, 0x0D028C25, 0x9CE6F088,
+   0x00000131, 0xBA67433B, 0x77E037B1, 0xD9EEC2D6,
+   0x63FA7EDA, 0x7541D914, 0x9AFA419E, 0xF5C81E67,
+   0x18F69214, 0x30E731FB, 0x4875FA4A, 0x705AA418,
+   0x933EC3A9, 0x1178C743, 0x05F26F5E, 0x259B440E,
+   0xD5F38E18, 0x00000013,
+   0x496390AE, 0xB6C6114B, 0x4DADA7CB, 0x2B862ECE,
+   0x28F68CED, 0xDF386405, 0xB5D540B2, 0xF12E8D4D,
+   0x3168C958, 0x59AD5734, 0x62AFD5E4, 0x6088C748,
+   0x4EDB1906, 0xB5D90DDF, 0x7D88DD30, 0x530F0ED1,
+   0x000001DA, 0x9D45CD21, 0x1F253ED7, 0x61981026,
+   0x44D19CF4, 0x3470E11D, 0x1B5711C7, 0x6AF8BAA9,
+   0x22E83375, 0x202F7CD7, 0x32AB7C83, 0xD4636178,
+   0x6BAEC7CF, 0x1682BA2A, 0xEE2BAFA0, 0xFB779983,
+   0x05B831E4, 0x00000062,
+   0x63653202, 0x63874218, 0x4A51311A, 0xD416C7EF,
+   0xB79EF786, 0x90941EC8, 0xE9F3995E, 0x619CA79F,
+   0x6F6DD49B, 0xBF5AD354, 0xA3F42981, 0x787539AC,
+   0x42E0D4D5, 0xF79F47EA, 0x97E476DB, 0x4819E259,
+   0x000000C5, 0x5127F218, 0x6761EDD8, 0x70614BE6,
+   0x79DEDACD, 0x7B7DE98A, 0xE8822CB5, 0x57D34D72,
+   0x11DED9FB, 0xF561E31E, 0x82E37858, 0x4AF1D33E,
+   0x2BE0F075, 0x25D18A2A, 0xE2C6E228, 0x7ADB8AAA,
+   0xC565143C, 0x000000D9,
+   0x88870BCE, 0x7878F476, 0x3CC55CB9, 0x7A6E6C8F,
+   0xE49B2DBE, 0x2C266D75, 0x4053EA24, 0xB8B64B63,
+   0x60932B83, 0x46334EA4, 0x7AC39BAE, 0xB4126A8B,
+   0x7B51D11C, 0x33A6EE2A, 0x8AB7FD69, 0x5A2FACA9,
+   0x000001B9, 0xECFC45F0, 0x900220D2, 0x52317BAC,
+   0x329FF0EA, 0x5D77381E, 0x01348036, 0xCC88FFCE,
+   0xB927D66D, 0x842F8D7D, 0x3B62BB50, 0xA08FB889,
+   0xFDF0C8E6, 0x9719E502, 0xB4307F0F, 0x9A023C02,
+   0x3D157C2C, 0x000000FE,
+   0x6C3FBB5D, 0x18FC5396, 0x217CDE8F, 0x5E8FD2DF,
+   0x280F3EE4, 0x073FD658, 0x52343E59, 0xCF876DC7,
+   0x87866F75, 0xCB56F971, 0x95D297F8, 0x72D0FA64,
+   0x9C4B4D8B, 0xD789B84E, 0x5F186B50, 0x960AC63E,
+   0x0000016E, 0x8EBC68F6, 0x6363F926, 0x56CAE561,
+   0x7A7E35DA, 0x82E68425, 0x3166DE45, 0x26F732C9,
+   0xE417D738, 0xE8596CE8, 0xD1D2C014, 0x97053020,
+   0x7F4C055F, 0x8926276C, 0x4D0662E8, 0x3E93EDEB,
+   0x673349FF, 0x00000113,
+   //Window 2
+   0x69BE00AC, 0xB38E8B90, 0x95E50B81, 0xE46B33CB,
+   0x1F5D4723, 0x9C9152C4, 0x8C2A465A, 0x7B8F4F6E,
+   0xF269CB33, 0xB85FA9E8, 0xCB5B47A9, 0x03C7389E,
+   0x0F312E99, 0x458AFC78, 0xB5AC20C9, 0xF40A0F02,
+   0x000001D5, 0x486BDE7F, 0x8FAC1245, 0x4D4A7784,
+   0x1430CD50, 0xBD29A67B, 0x58D2B99D, 0x38E3BCEB,
+   0x965CF657, 0x57354F17, 0x062DC3AA, 0xE5B45635,
+   0x40ED2A81, 0x103B69C5, 0x981BBA93, 0x413C42FC,
+   0x3503AA73, 0x0000008E,
+   0xF62A4087, 0x49EB72C3, 0x5B00B2BF, 0xEC873432,
+   0x643C12A4, 0xBB040159, 0xEAC95679, 0x2EF972F4,
+   0x2BBEA697, 0xC7E358BD, 0xDB23F1B4, 0x924A6105,
+   0xBDD61FE2, 0xD587C6BE, 0xAAFC22CE, 0xF348D2F7,
+   0x00000058, 0x930F49AA, 0x7BF1DEEC, 0x3CEC939A,
+   0xFD3224C4, 0x6D94E0BF, 0xAC7ECED3, 0xB2C7B10F,
+   0x5EF5A81C, 0xF85C84D4, 0xA6E9C773, 0x2F547B59,
+   0xE139B7AB, 0x1FD522DB, 0x436BFFD6, 0x0B189B69,
+   0x32EE281E, 0x00000073,
+   0x1C6CAC89, 0xB491062B, 0x9ADECC2E, 0xF20C5835,
+   0x6F1D7401, 0x488D7B91, 0x94761E60, 0xFF98B90E,
+   0x857557A9, 0xE63993CA, 0xACDEADFC, 0xC4FF9951,
+   0xFD8DCCAD, 0xED5A53C7, 0xF101C24A, 0x42E02C14,
+   0x0000012B, 0xBD3FE0EF, 0xBB9FE6F6, 0xC1393D0B,
+   0x72F26FFC, 0x6C25ED19, 0x2E831B19, 0xEBCC6B99,
+   0xDB50A0D7, 0x245C479C, 0x202AC3C8, 0x436117A0,
+   0x97B284D7, 0xFD694E11, 0x13BD5E82, 0x022193A6,
+   0x452B5A94, 0x000001C8,
+   0xD131F694, 0xD59595D1, 0x2A7FDC21, 0xCE8A8375,
+   0x75869627, 0x9E62E8B1, 0x6E01B014, 0x336D7845,
+   0x6EA5A8ED, 0xB53ACB36, 0x7DD8AC89, 0x4451F2E5,
+   0x2BC29533, 0x4C8CF19C, 0x7C10E63F, 0xFBC29EF4,
+   0x0000017C, 0x7A9357FA, 0x9BC2EC34, 0x3B8A04AF,
+   0xDE489A13, 0x230520B7, 0xB3521CDA, 0xAF6DEB0D,
+   0xD7699690, 0x14655A0F, 0xACE1AF3A, 0xCD89B94B,
+   0xF628697F, 0x3C079AB6, 0x40A71EA3, 0xFD251809,
+   0xE7B89297, 0x000001DB,
+   0x60B57216, 0x4300169A, 0x441BC961, 0x0143C544,
+   0x7FEF586C, 0xA682548D, 0xE993FE8D, 0xF064F99E,
+   0xDEBA875B, 0x169A43DB, 0x6D3CD064, 0x935CE8BF,
+   0x7C9700DD, 0xE986A7CB, 0x51C0F10F, 0x1447FBEA,
+   0x00000117, 0xE3ADF2D8, 0xF10CF577, 0xBF433D46,
+   0xFD750660, 0x2395CE48, 0x4944B884, 0xC1725875,
+   0x63C24A4D, 0xF3392F50, 0xB12376D0, 0x97588187,
+   0x9FB12A1A, 0x4BB92450, 0x3C03CC12, 0xB4E9C733,
+   0x26F27FE0, 0x000000C8,
+   0xD9E02E98, 0xFE87DDE0, 0xC932A7D3, 0x416547E5,
+   0x7D904335, 0xBAC5A782, 0x0FA3993D, 0x7077AB52,
+   0x9EA4D3E5, 0xBE4EACB3, 0xF56DF114, 0xCDDB4006,
+   0xA34C7B12, 0x0C4FCCA5, 0x05DC8144, 0xA1450A3A,
+   0x00000178, 0x45594505, 0xB5D6B799, 0xDD0AC080,
+   0xC1E8F726, 0xE2D97D82, 0x6269B2A1, 0x20004746,
+   0xE9C9E6E3, 0xA7F067F5, 0xAB497CFA, 0x6DFBD572,
+   0x55FDF3A1, 0x70231374, 0xFB825D84, 0xE606857A,
+   0xBE464555, 0x000000DA,
+   0x79FBA304, 0x34CDF571, 0x55CBA8EA, 0x2DA4C0B8,
+   0xE3AB7E7C, 0xFA08EDB0, 0x1176D554, 0x89BB570A,
+   0xF620989D, 0x13F14AEC, 0x73AB04D1, 0x070496CF,
+   0xE776B1A0, 0x0FD6E1E4, 0xE938CBF6, 0x6BE78274,
+   0x000000D9, 0x2CEA82B4, 0x8C93BC92, 0x8F61CC83,
+   0x841A245A, 0x07B43460, 0xF6D73717, 0x496E9107,
+   0x17789F54, 0xBF60AB90, 0xD79A87DA, 0xF04F3232,
+   0xCCB42770, 0xAAEB6908, 0xDA9DC1DE, 0x83B7BD43,
+   0x0389467E, 0x00000081,
+   0x9E6DBB64, 0x16A72EB7, 0xDDD1A126, 0x0E4A2F79,
+   0x482B6A66, 0xA231A534, 0x5F4424B5, 0xD1506E25,
+   0xB848CBB7, 0x72869485, 0x77260252, 0x8110E259,
+   0x6132F329, 0x4F3776FA, 0xF911712C, 0x71CE95F6,
+   0x000000C9, 0x1C4417D8, 0x85E3DE36, 0x703B3B41,
+   0x26E85989, 0x1D0DA946, 0xCB1F8AB4, 0x96C2E272,
+   0xE042EA51, 0x662C470C, 0xE2255E1F, 0x72C1F8B9,
+   0xA1BD3D56, 0x7FD14593, 0x38698FD7, 0xF820EE6D,
+   0x4B9EDA73, 0x000000ED,
+   //Window 3
+   0xE4FFAC9B, 0xE070A145, 0xAA280FFF, 0xF8295455,
+   0x7010805F, 0xA2D6CF89, 0x3220FF7C, 0x04E13089,
+   0xAD11681E, 0x5935E6E2, 0xB9CEF2BC, 0xD91EFB7B,
+   0x14BB8C4D, 0x3C260B99, 0x3A265599, 0x24BF88D5,
+   0x000000F0, 0xCC9C279A, 0x1FF2439C, 0x90BAB4CF,
+   0xDFCD0B6E, 0xC3ACBFDA, 0xFA08A7BA, 0xCDB22A56,
+   0xC91B8F40, 0x672BE103, 0x9624AC18, 0xA7CB0F83,
+   0x1E59BAC0, 0xED5F94C6, 0xAE0AA78E, 0xB43029E1,
+   0x9655B8C3, 0x00000052,
+   0x98AAFDD1, 0x662D7D3C, 0x21107B4C, 0x4C72AB8A,
+   0xC2DDDBF7, 0x74CD96B0, 0x20376ABD, 0x27BA0E3F,
+   0x867E8CFB, 0xA41A23C9, 0x45117BAE, 0x36E50538,
+   0xE45A9E79, 0xF399D347, 0x9E482DF2, 0x97CB9778,
+   0x000000E7, 0x015672D3, 0x5672082F, 0x2FF3D33E,
+   0x11445C3C, 0x0504B408, 0x296735E2, 0xEFB627D0,
+   0xF8E18280, 0xDD1A08E2, 0x85FB2222, 0xAF77422C,
+   0x4EC184A2, 0x7AA7FA0E, 0x2D0C1A44, 0x232261EB,
+   0x7E99ACD0, 0x000001E4,
+   0xC7904DCC, 0xF6AC59C2, 0x30E7A7C0, 0xF34A6438,
+   0xBBEF0274, 0x4D7D7ECB, 0x87E2E8A3, 0x13E02957,
+   0x2A250A6F, 0x0B985540, 0xBCF9DC53, 0x26A87784,
+   0xBA65EC34, 0x34AF454B, 0x721F360C, 0x8CD8460C,
+   0x0000001F, 0xFC08A52A, 0x1A082A89, 0x365F3B53,
+   0xB8823064, 0x89580CDE, 0xB1A9A671, 0x7E949F3D,
+   0x5D46AEF8, 0xD2E6F058, 0x194EEBDD, 0x7462EC31,
+   0xF047FDF4, 0x541D8A7E, 0xDD84132D, 0xF113644F,
+   0xD39482B8, 0x000000DC,
+   0xD28EA0E9, 0x0F666997, 0x7243DF5F, 0x0B94AAA0,
+   0xC3462336, 0x23328026, 0xE78749F5, 0x17B1E2B1,
+   0x0F956995, 0x785D0AAB, 0x66006613, 0xD5693FA2,
+   0x48D1E0AB, 0xE86B26BF, 0x7AF1BCCB, 0xAB68CEFD,
+   0x000000AE, 0x8046E012, 0x5468DF6D, 0xAB17D13B,
+   0xC0D6DD8C, 0xFD0D9B38, 0x84DE5691, 0x5FB3B96A,
+   0xE897F4E0, 0xE6E4AE24, 0x23D39D56, 0x7DE8ED15,
+   0x9EBA39B1, 0xA6C3D45A, 0xF6BF29AB, 0x8DE19508,
+   0x1E7B58B2, 0x00000169,
+   0x1133985C, 0x4F724FF7, 0x3F161965, 0x3E3618BA,
+   0x2C6B9E64, 0x1DCFE4B7, 0xA12B7534, 0x9FCCE3A3,
+   0x24E1798B, 0x4B71FDD8, 0x2C0C4CE6, 0xD78BC555,
+   0xCD0CAEDF, 0x4DEF17AA, 0x841B7AD1, 0x52E97071,
+   0x0000000A, 0xDD09461A, 0xCEC7D692, 0x28FCE58E,
+   0xF09CDDDC, 0xBB89A006, 0x6EA8820B, 0x35F4A19A,
+   0xE46FDC6F, 0x4EEE996A, 0x80F9DF51, 0x1FEC8614,
+   0x5567A840, 0x50EB5B5B, 0x1EA4EE6A, 0x766ACE17,
+   0xD9D1F547, 0x0000013A,
+   0x96E17CE4, 0x3E0D676B, 0xF93547AC, 0xEDDE67B9,
+   0x6D2ABB26, 0x5C7F91CA, 0xF015C080, 0x50B68857,
+   0x92E0541B, 0x190B5C67, 0x41A1BC70, 0x9FFDF76A,
+   0x907EE4AA, 0xCBBC0581, 0xBA86B55C, 0xA3CBDF3A,
+   0x000000F9, 0xBF7C2D0B, 0xDCD74CAE, 0xE6C980EB,
+   0xA3014C48, 0x5BCE8B7F, 0x9EA5B942, 0xB6DEFBD6,
+   0x30E21DF1, 0x12C9E0C9, 0xDF4616DB, 0x25638D31,
+   0xDEA9B408, 0x2122619F, 0xBE99E13A, 0x3F9D74DA,
+   0xB0B232C0, 0x0000016D,
+   0x3DACAF48, 0xB2BCC020, 0x142FCDBF, 0x1FCD5C80,
+   0x34CFEA61, 0xDDBEA097, 0x880F06DB, 0x59118968,
+   0x41FD5C20, 0xE379BC26, 0x29E7776A, 0x8520D72F,
+   0xF686797B, 0x6D147F35, 0x2F098D55, 0x9CC62B1F,
+   0x00000117, 0x384E730F, 0x5CD20F47, 0x14763178,
+   0x61D5C9EE, 0xFA537B73, 0xBB7BAA73, 0xDBB155DC,
+   0x868AC657, 0x23664C04, 0xBDD0D24A, 0x03303148,
+   0x9EA27541, 0xE5D7E643, 0xED31A9B6, 0xE8C44767,
+   0x4C401780, 0x000001D0,
+   0xBA2E2480, 0x7E7193FF, 0xD64C043E, 0x9EB55534,
+   0x94850DB1, 0x4CF71A2B, 0x0726A9CE, 0x5CB89279,
+   0xD1C18F14, 0x34AC7422, 0x9F2D685E, 0xD7ADB5FE,
+   0xC8498977, 0xB1DD2251, 0xE32B83BC, 0x5A313AD5,
+   0x0000011F, 0x46DAA5CD, 0x4F55F073, 0x6CA24109,
+   0x8112526A, 0x75EB0DEF, 0xC9688139, 0xB29C8C81,
+   0x6081FD1D, 0xA06DD84E, 0x492941EC, 0xF48713A1,
+   0x49A785D5, 0xE82293D3, 0x1D98268D, 0xFF0B6231,
+   0xD56430DF, 0x000001B7,
+   //Window 4
+   0xCAA4BEC3, 0xA3480D58, 0x5989E4A0, 0x38948993,
+   0x6F7BA4CA, 0x3F4D7B6C, 0xD39CB2AE, 0xE2913A55,
+   0xD7BE6499, 0x615043EA, 0xF504FEC3, 0x9D4C41CB,
+   0x8D44893B, 0x4F93DA96, 0x9A7928E0, 0x33A7ACDC,
+   0x00000013, 0x48219A09, 0xC865844F, 0x37426BDC,
+   0xA6D0B179, 0x284AE0E6, 0x7386A0A6, 0xC2DC16FC,
+   0xDDD6CBA0, 0x2940D262, 0x77D2934D, 0x741B88AB,
+   0x3AF6ED35, 0xA6DAE43F, 0x96F43A65, 0x1414083B,
+   0xC7143535, 0x00000057,
+   0x0D67EE97, 0xD49BEA9D, 0xF8CE59AA, 0x3B54996F,
+   0xF5862792, 0x609F5808, 0xBF16A7B1, 0x8FFF6EE3,
+   0x9EF889A0, 0x2D515A91, 0xCC6A85C3, 0x9FDAD17E,
+   0x54D161D4, 0xA93C168B, 0xD42907B7, 0x269CBD3F,
+   0x00000077, 0xCC9BC5AE, 0xEFBDC466, 0x9F2D0ABD,
+   0x56216332, 0x78B7F191, 0x567A46BC, 0x55CB85EB,
+   0xFE6F5FFE, 0x1FA1E9B7, 0xB6A1BD3A, 0xB23AA4A1,
+   0x92A1F94D, 0x85B417C5, 0x8706DF4E, 0x72C38E1D,
+   0x80F8E279, 0x000001F5,
+   0xA45742D3, 0x782A46B3, 0x9AE4F831, 0x7FB395DC,
+   0x06715575, 0xAA0A2499, 0x987995C6, 0x336DD153,
+   0x70D00FCB, 0x5678C82A, 0x33B45F8B, 0xDC87A872,
+   0x3498DFA5, 0xD5B26900, 0x410F7C71, 0xA8EF2E81,
+   0x000000EC, 0x69A89D17, 0x00E42EF0, 0x1DE60EE9,
+   0xDFD638D2, 0x8E2A3B24, 0x5E3E68A9, 0xD7A07F7C,
+   0x19D1CC8A, 0x4D2C9B89, 0xD84E1809, 0xFD778F5F,
+   0x7674BFD1, 0x1E2B3490, 0x962735A6, 0xF535952D,
+   0x9AD592A5, 0x00000031,
+   0xAE4622FA, 0x9DDC754C, 0x05C5947F, 0xAC04C429,
+   0x2DBFB6A4, 0x0B53D6DB, 0x883C6D42, 0x1FB16F7B,
+   0xE5DBAB18, 0xE38B1745, 0x0087B164, 0xA320F80A,
+   0x32CD4694, 0x4A5C274F, 0x0855DC1F, 0xE32650C1,
+   0x000000CE, 0x5997C5B5, 0xF1C1A8C5, 0x2E051A16,
+   0x3A20FF07, 0x36A4BC59, 0xBAACCCE2, 0x2C407BFD,
+   0x72AE4A19, 0xC128C710, 0x0ADA1E57, 0xB2D91FF3,
+   0xF4CE04DB, 0x31FD0538, 0x8616DA87, 0x245B59F8,
+   0x5C19B57F, 0x0000010B,
+   0xC8EDA3E4, 0x7DBC777C, 0x3D138B69, 0xF93443A5,
+   0xBE32F323, 0xF88673FA, 0xAF91501E, 0xC53F686E,
+   0xA9E8DF0F, 0x2C583A94, 0x79A360BF, 0xDBB476A5,
+   0xED573377, 0xD6D61DEB, 0xD85E7CE8, 0x8BF9489D,
+   0x00000186, 0x8C06659E, 0x4EA12CF5, 0xFBC275D3,
+   0x3A5DF265, 0xA5EA596B, 0x434F440B, 0x82EC727B,
+   0xA386793E, 0xB4AF3144, 0x4F4D4575, 0xB64CD799,
+   0x465AAE52, 0x01DD7DF8, 0x4C7C4434, 0x40EC3273,
+   0xC7D3008E, 0x000001E3,
+   0xAB4F88E3, 0x28E8D7CD, 0x8EC7FD82, 0x898BAEC9,
+   0xC459C3FB, 0x13328D8E, 0x3B0493EF, 0xA635E9B1,
+   0x1DDFF9B3, 0x03949338, 0xFF82A4FD, 0x93F2886C,
+   0x0C609C2C, 0x9CB16573, 0xAE8E6E06, 0xAB282B67,
+   0x0000018D, 0x0792DCFB, 0xC16FBD16, 0xADF64DB7,
+   0xC42BBE74, 0x315F21D9, 0xC85534C4, 0x747B8361,
+   0x66CD4CD3, 0xF33752B1, 0xCD26CBE3, 0x54D2BFA6,
+   0x185ADD85, 0x3364F9B0, 0xAC366F9F, 0x4188B82E,
+   0xDB6B5E54, 0x000000F0,
+   0x88E250D1, 0x74FF5C51, 0xDC911CEC, 0x46E6A1DE,
+   0x48C5291A, 0xC28BA25B, 0xA9FDE68C, 0x0F571B2A,
+   0x89952038, 0x1C7D3FE9, 0x6A4850F9, 0x40B66DAB,
+   0x56AF4D75, 0xF2A3DB39, 0x03123BA0, 0x9861204F,
+   0x0000016E, 0x5AC22CD7, 0x1ECDBBD4, 0x0000BE6F,
+   0xE7349A91, 0x327586B9, 0xFF94C6A2, 0x7E123652,
+   0xE78C257F, 0xAAEBCAF2, 0x18E795C5, 0x63C70794,
+   0x7DFFC5B3, 0x67E76A08, 0x6C3B3D20, 0xAFBA9F7E,
+   0x820B7E33, 0x000001CF,
+   0xC916E988, 0x330F31B6, 0xA6E737C0, 0x601FCA7F,
+   0xDF9C7B04, 0x99E063DC, 0x27CD93B0, 0x49E97A96,
+   0x9A7C06DE, 0x576FE342, 0x6EAC19AE, 0xA6D8C479,
+   0xFC72DC81, 0x4C5CC139, 0x3533FE76, 0xF34B6907,
+   0x000000F0, 0x983C41E6, 0x8D444D34, 0xE2E49BD6,
+   0x650AF8BB, 0xC1BCB88A, 0x1794D4C0, 0xB2FE435A,
+   0x798CB3D8, 0xE7433605, 0x8544A707, 0x9FD393E0,
+   0x82DFC635, 0x92981C51, 0x572BD642, 0xE001273D,
+   0xB451731F, 0x0000010C,
+   //Window 5
+   0xA2302041, 0x4F0E025F, 0x48D262B5, 0x4D50D989,
+   0xD622C7D4, 0x01720A0A, 0x58D1C97C, 0xE3B5A941,
+   0x38AED2A5, 0xFBC5B183, 0x823B5D8D, 0x27F02177,
+   0x775F38C5, 0xADF74074, 0x4F1A6EA0, 0x95BF91F4,
+   0x00000104, 0x8E2D6AB2, 0xF9CD8299, 0x6C27631D,
+   0xA75B296B, 0x1E00BAC9, 0x07700049, 0xEBD66975,
+   0xDC99E546, 0x75E54993, 0x44FA5282, 0xD50E44D1,
+   0x25FBCA4B, 0x81057B1A, 0x46631393, 0xBDCDF45A,
+   0xC22EFF26, 0x000001CF,
+   0x3FB4E975, 0x9289B69D, 0x90ABE866, 0x402EA680,
+   0xBE261ECA, 0x5308DA63, 0x3973AE33, 0xCA3572CC,
+   0x98532B78, 0x856CA780, 0x587F6B23, 0xCBF66636,
+   0x1723A436, 0x676C4992, 0x74F83F24, 0x9F9149EA,
+   0x0000003E, 0xB398B5F9, 0xBA145D0D, 0x5D91F299,
+   0x36FA701C, 0x880CEA61, 0x4447EDE5, 0xC69C641A,
+   0x7C901B83, 0xC9EC5747, 0xA4F6E566, 0x2AEA7BD8,
+   0xC73E0C6B, 0x507B21EC, 0xDA186A9C, 0x7AE3AACF,
+   0x0420187E, 0x000001AB,
+   0x8461A126, 0x0C44CB07, 0x1E3D5EC2, 0x833ECF39,
+   0xD30ED220, 0xCFB75A58, 0x0F06DD1A, 0x78309A88,
+   0xFA5F0298, 0x46EA7133, 0x4BFDF4A5, 0x4E43C6F0,
+   0xE0EB0A8B, 0x7047ABFF, 0xE1893149, 0x1B142957,
+   0x000001D6, 0x47F7C92D, 0xECA09AD4, 0x3D86A0BE,
+   0xB5F84D6D, 0x51FCD6A8, 0xDA40E7F6, 0x2BE41D0F,
+   0x28A08F5F, 0x4F9A374C, 0x98A7F09A, 0xBB0CBB89,
+   0xD2D6FF46, 0xF6E2353D, 0x15DFBD60, 0x9611D886,
+   0xDBAF53B4, 0x0000018D,
+   0x99868C1B, 0xD73BFF38, 0x3C0780C8, 0xC4DE3067,
+   0xB94ED8F5, 0x42E25EC9, 0x0080C257, 0x2A1CBE59,
+   0x7E1F5C2D, 0xA2AD3D6B, 0xB0B16C27, 0x6B750C30,
+   0x016248B6, 0x26E80CD1, 0x0A9B3479, 0x3A7CB193,
+   0x000000E5, 0xF06089DC, 0x248C212D, 0x22EDFC21,
+   0xF64C29CD, 0x94F10EB9, 0xAA2D5064, 0x5B200F04,
+   0xCBAD39F7, 0xE2E4F780, 0xC43F0E7A, 0x9038A60C,
+   0x30ADE30B, 0x828E35C4, 0xB05C9C75, 0x91A8FCD0,
+   0x71138725, 0x0000017C,
+   0x481F611B, 0xC73762E6, 0x076EE36D, 0xA8D18C26,
+   0xAF71C832, 0x7A9A12F7, 0xD09CDB38, 0x9F202F50,
+   0x937D8CE4, 0xAD23C663, 0xFFE8945F, 0x7A9B6EE4,
+   0x0C1248BE, 0x9FF51112, 0xB68F6130, 0xD9B7BB75,
+   0x00000152, 0x0BEFD018, 0x1978B2DB, 0x998C6496,
+   0xF5E39D99, 0x40C417C3, 0xD2B8318F, 0x4E3475ED,
+   0x4A153815, 0x40E4931F, 0xE7CC9693, 0xA6DED519,
+   0x7AC6EF5D, 0x9E67DB29, 0x00E7AF49, 0x3A227FD6,
+   0xF7AF3E66, 0x0000006F,
+   0x42B5DC6D, 0xE7E41336, 0xAC39FEB9, 0x1EC73D43,
+   0x0774D294, 0x9BBAB64F, 0x20D05AC5, 0x916F8429,
+   0x9FFA78AC, 0x18F5200E, 0x37BB7BD7, 0xEA36FC1D,
+   0xD0F38FE6, 0x7F43AB79, 0xF745B347, 0xCAD2D96F,
+   0x00000046, 0x52456C41, 0x3140D9C8, 0x53628A69,
+   0x98F3CB42, 0x60FDA64D, 0x2ADEC93A, 0x5EC42A38,
+   0xE9036457, 0xF3958029, 0x67180536, 0xC9CC525D,
+   0x19EAB58A, 0x42B055BC, 0xB41EFA49, 0x434FAB5A,
+   0x2BAE3414, 0x0000008C,
+   0x1320E005, 0x4F14F6BB, 0xD980656A, 0xBC1151CF,
+   0x4F287157, 0xA580333F, 0x6C608FA7, 0x5C8E4B00,
+   0x378420CD, 0x6A858828, 0x3B0D2DD5, 0x80C141BE,
+   0x1183E1A3, 0xF10C4E72, 0xA6B7A7F4, 0x42AF4669,
+   0x00000073, 0xF6A8ECCE, 0xEF81B0ED, 0x5304060B,
+   0x2FB88C74, 0x233EEA41, 0x17AF73CA, 0x2D541C3F,
+   0x30564AB3, 0x8EFBEEC3, 0x3526E325, 0x16011C23,
+   0x360CEB59, 0xD77D3AFF, 0x480FA468, 0xBF846F1E,
+   0xE1F4C7FF, 0x000001F4,
+   0x4A18638A, 0x7A8F819B, 0x1DAE3869, 0xDD0F6EBE,
+   0x1059923B, 0x777FF649, 0x8FA3F6FC, 0x806653A3,
+   0x8E9F983C, 0xA9DC8324, 0x5BC5F6A7, 0x4A4AF779,
+   0x06A6137A, 0xE95FA290, 0xBB89E63F, 0xFCF6C742,
+   0x00000050, 0xECEC69EE, 0x62EDE8A9, 0x2E06D0D8,
+   0x754540ED, 0xD7E610F7, 0x105B05C7, 0x99F67F8A,
+   0x0976BECB, 0x6AF2B5D9, 0x324E7DE7, 0x3BA47093,
+   0xEC99D94A, 0x62ECB0F4, 0x9A3825CC, 0xE281ABA1,
+   0x9194D78E, 0x000001AD,
+   //Window 6
+   0x46D39A88, 0xB5F53851, 0x9CC76DEB, 0x58A99A0F,
+   0xF3825B82, 0xCFDD909E, 0xF4694014, 0x8F49DBDC,
+   0x9CFEC7B7, 0xEFD505FE, 0x56925281, 0x66A7F2A1,
+   0x2A604FB8, 0x6F478D9B, 0x60F7C436, 0xCBC72E9E,
+   0x00000021, 0xD9C31E98, 0x5BF75682, 0xC8BCE143,
+   0x74D5CD73, 0xC700E94A, 0x778BD5F1, 0x3A66B233,
+   0xB01480C7, 0x688DF0CC, 0xC667F078, 0x16BBCF57,
+   0x780C73E4, 0x485890E0, 0xB77F5BA9, 0xB9DDACB3,
+   0xD62ADDF5, 0x0000017D,
+   0x767335CF, 0xF7BA638D, 0x733C2346, 0xB6FB9463,
+   0xED81C85F, 0xA0E475A1, 0xCB58E955, 0x5D2FC9F1,
+   0x75A1DFD5, 0x941FBDC6, 0x0F14F1C2, 0x732D6CEA,
+   0x21367160, 0x4C13E559, 0xEF0E8D39, 0x5BA5A950,
+   0x0000007D, 0xBBEB43F6, 0x355DBBB2, 0xB3505972,
+   0x0ADAF151, 0x82F0D0BA, 0x01976A04, 0xFD4BE88B,
+   0x080824B6, 0xF4424F37, 0x8392B272, 0x72F6EFD8,
+   0xDC69D678, 0xA06B0CA3, 0x0A4B8BA4, 0xAD3FD7C9,
+   0xB731404C, 0x00000119,
+   0xC9B816E5, 0x1730B2A5, 0x5531EE33, 0xF2C2A1BB,
+   0x659E0B2F, 0x1DA21329, 0xC88BCE0C, 0xBEC25192,
+   0xAC6F52AB, 0xDDD4B9E6, 0x9E4B9F7D, 0xF15BD68F,
+   0x7D249B4F, 0xEA9E12E6, 0x451ABAB2, 0x56A65055,
+   0x0000015D, 0xC4B6910E, 0xC4D7DC72, 0x2DDFF22E,
+   0x5FD33592, 0xB8287AF6, 0x43E429E2, 0xA1585685,
+   0x258A4647, 0x3B62CE95, 0x31F72F41, 0x57933B4F,
+   0xF63172FA, 0x0C5CB4D8, 0x54749D3A, 0x8CC931C6,
+   0x514DA5D2, 0x000001DE,
+   0x16EBA181, 0xD495B0EC, 0x76F4FB91, 0x834A505A,
+   0xDB3B0C92, 0xD1950CF8, 0xBF6BD68F, 0x5108E0CD,
+   0x9F777AC3, 0xD8492E45, 0x184F5A9B, 0x2CAA1A4E,
+   0xCE860F91, 0xFBB91EA5, 0x597025F9, 0x05957C32,
+   0x00000097, 0xB07D29FF, 0x1774A862, 0xCBCC928E,
+   0xCB4EDA89, 0x02AD819B, 0xA19276A1, 0xF5AF5B3E,
+   0x3D0CACF6, 0x3BDBC653, 0x8DCEC31F, 0x2F1ADE3E,
+   0xAAD43709, 0x574E10B1, 0x544E97C3, 0xC62C4DEB,
+   0xD4364902, 0x00000077,
+   0x8CC61218, 0xAB52651D, 0x44480B5F, 0xA1C9DE0C,
+   0x1E50B446, 0x1F16FB4B, 0xCE904254, 0x6F243EC4,
+   0xDD99EA21, 0x36840614, 0x0A32C8E8, 0xCD03B67D,
+   0x80ECEF0D, 0xFEF4282A, 0x446B4A9D, 0xED947DFF,
+   0x0000011B, 0x2DCB7B3C, 0xF6A41297, 0xD7F5283F,
+   0xD343EB08, 0x2F9BBF7B, 0x48BA42BE, 0xD4303C71,
+   0x7146C6A0, 0xCFAB9F39, 0xBFF735EA, 0x6F28A222,
+   0x2895CF34, 0x71ECB96C, 0xDDE25C5B, 0xBCC657D6,
+   0x45C4A4DC, 0x00000089,
+   0x1E762027, 0x993099FA, 0x1EA3F1AF, 0x9799C62D,
+   0x314377B5, 0x7E0BAE2C, 0xA34FD53C, 0x53814A3F,
+   0x724E8552, 0x237A23B4, 0x6CCB057E, 0x2F03DCC3,
+   0xF9C50353, 0xE8162A49, 0x8D7FA87B, 0xC9EEABEA,
+   0x0000012B, 0x9AA51CB2, 0xEF0D5148, 0x3B43119D,
+   0x74016AA9, 0x552037E4, 0x157B118E, 0x24F0D289,
+   0x1E14B658, 0xCEDDA762, 0x654E7BC4, 0x9BB08F1C,
+   0x1E09E8B4, 0x36CB9AED, 0x5B149738, 0x6708ADC1,
+   0x97913A39, 0x000001F9,
+   0x02B6BAA3, 0x6E93A3E4, 0x1C891464, 0x001F843D,
+   0x24D1E58D, 0x8EE3F13E, 0x6061074E, 0xD75616E4,
+   0x09F9F2F0, 0x0B5109A7, 0x27F3DCD6, 0xF09EE5B2,
+   0x85EA384E, 0x9AF52BEE, 0x4D6ADB23, 0xDADA8B9A,
+   0x0000015D, 0x573476A6, 0xB19CB8C3, 0xF0E6097E,
+   0x8F91AC51, 0x8B76E3FE, 0x157DD6CA, 0x4F5818DA,
+   0x9CDA8FBA, 0x02D6965D, 0xB512A269, 0x82C51A22,
+   0xE33A98C0, 0x1C76952B, 0x33E01B50, 0xCD5A0722,
+   0x9E6FDCBE, 0x000000F4,
+   0x5D5B4047, 0x8981F097, 0xFBD8F49B, 0x93E437D5,
+   0xBC068B71, 0x083BE97E, 0x005319CB, 0x5C6B1ABC,
+   0x045FA694, 0x1EEE6CDC, 0xF70CD426, 0x298F97A9,
+   0x14B9FB67, 0x4025549A, 0x1F05A634, 0xECEE0564,
+   0x0000006B, 0xE70C5E4F, 0x2FBEA3E1, 0x8BBD71BC,
+   0xDD1962EB, 0x7BD27064, 0x821464A9, 0x7C8A2ADC,
+   0x2D523C4D, 0x4EE5AED7, 0xA15C8D7D, 0xFEEADC53,
+   0xAE04B8B7, 0x144FC44F, 0xA51EE590, 0x731919C4,
+   0x2882F4BA, 0x0000016F,
+   //Window 7
+   0x3CA98249, 0x93D61C07, 0x907AA44A, 0x04C4F43D,
+   0x51D5B1D6, 0xEE3D2C31, 0xF859DF2A, 0xE74D6892,
+   0x922F8FA9, 0x16AB4838, 0x757B0010, 0xB0B6F7D1,
+   0xA918F320, 0x7CA940D8, 0x97B8C9B5, 0x45E9325B,
+   0x000001E1, 0x37316056, 0xDB18D7BF, 0x8FC0EB89,
+   0xC3453204, 0x060E2DB1, 0x3929DB79, 0xB1E67403,
+   0x2CCBF668, 0x9B05F538, 0xC7CE019A, 0x4DCA0FFE,
+   0x9377F446, 0x8A570683, 0x42947EB6, 0xE0A1BF92,
+   0x6EB25E34, 0x0000009A,
+   0x022667CD, 0xC76E5F4D, 0x3E07FB1F, 0x2C78870A,
+   0xD1C68926, 0x9E001396, 0xED2A502E, 0x707A9C2E,
+   0xE68933FB, 0xAA9A37F8, 0x4E4C8F98, 0x1AE458AC,
+   0xA71656EE, 0x8047ED5D, 0xA9DF9D4B, 0x06826324,
+   0x000000AD, 0x19C176EF, 0x2C4CBD93, 0x8092BE6E,
+   0x8DAC6442, 0x7A074BFF, 0x0C349EE8, 0x0129E1A0,
+   0xEC35B47C, 0x35253255, 0x4096E012, 0x06B23B09,
+   0xB3E6E7FD, 0x16FD165C, 0x8B36EAC3, 0x94AD125C,
+   0xB7D5F972, 0x00000154,
+   0x2BB30EBF, 0x13C41363, 0x84A62B56, 0x1C51E2FB,
+   0x883CB2CA, 0x0FFAEFE0, 0x1997F036, 0x23A65115,
+   0x9C64E7E3, 0xF030712C, 0x457AAF0D, 0x06320295,
+   0xB2498539, 0x945BD82F, 0x623A481D, 0x2995DF47,
+   0x00000161, 0xFEB7F8B3, 0xF962F403, 0x872DFF16,
+   0x244D8A3A, 0x89F6DDCD, 0x59FDAABC, 0x7DB8ACBF,
+   0x41661BC8, 0xC256C87F, 0x1B641D50, 0x27CCDB57,
+   0xD7F8AADB, 0x31F353C8, 0x4DAF6137, 0x2A2A6F9E,
+   0x33D40188, 0x00000125,
+   0xA8F70EB0, 0xBFB85A9B, 0xE59B107C, 0x9FA45D83,
+   0xCFF39E25, 0x90207916, 0x61816661, 0xDF20520F,
+   0x4D88EDDF, 0x250A81B6, 0xD4C88E4F, 0x3583BCE4,
+   0x6121DEEC, 0xFCAFBA31, 0x45FF2C20, 0x40E71EA7,
+   0x000001D6, 0x50452ED6, 0xF91F2045, 0x00FCA85D,
+   0x4C7BE74A, 0x0FCC66DA, 0x6AC750DC, 0x7BB3A7CD,
+   0x829CCEF8, 0x97039A3F, 0xF232419E, 0xB5F00AD5,
+   0x1647039D, 0xDD7F9785, 0xC72EBF12, 0xC675E619,
+   0x42BBFD03, 0x00000119,
+   0x11628DFC, 0xF8C5B2EB, 0x0A42E49B, 0xC66D10FC,
+   0xE26FE77F, 0x44C184B4, 0xA4D3DAF3, 0x22EF369D,
+   0x2CBE0115, 0x6662870A, 0x36CA9E6D, 0x80846B97,
+   0x7ED388A8, 0xBBAFD131, 0x4029082F, 0x4DA61427,
+   0x0000011C, 0xC06F365D, 0x68DB20A0, 0x2FFB8BB6,
+   0x46005F81, 0xBEC18577, 0xA0A17CE3, 0xC3CF8B54,
+   0xB7627D8D, 0xFF30D00D, 0x441830CD, 0x8F7A941D,
+   0xA53ED5CD, 0x99071DE9, 0xFD1147C9, 0x77DD8AD3,
+   0x619DB4EB, 0x0000010C,
+   0xFD85284B, 0xA32A9D65, 0xA4FAE26C, 0xB08333A5,
+   0xEF75E239, 0x8ACA0A12, 0x5A77BB33, 0x9035B738,
+   0x9AA71A08, 0x466F9797, 0x62F91BC6, 0x375DD056,
+   0xF5CB1C8C, 0xD93EA401, 0x16D691C4, 0x7ED00CA3,
+   0x000000D1, 0xE0A3542D, 0x8CCBD8FA, 0x70B071D9,
+   0x948625D0, 0x586A94D4, 0x8654DF26, 0x80290BE1,
+   0xD6FBFC0F, 0x260729E8, 0x2E103EAA, 0xF5F52AA6,
+   0x342394E5, 0xFB684270, 0xFAA21F70, 0x7C862797,
+   0x1348FABD, 0x0000002E,
+   0x5CA5F978, 0x317B098C, 0x2C21B6E9, 0x18FD8320,
+   0xF1193ACC, 0xC147AB01, 0xEAFF0D9F, 0x7EF3414D,
+   0xE28E9173, 0xEF1A3D6F, 0xB25FCEAC, 0x2603CCBE,
+   0x5AFFA9FF, 0xF825502D, 0x066A68E2, 0x539A125E,
+   0x000001DB, 0xA90A3B2D, 0xAF4B16BF, 0xFF63D1FA,
+   0xE0D81048, 0x07286721, 0xB203E687, 0x7BF45B93,
+   0xEC631A32, 0x3B10B512, 0x4D38CB03, 0xCA57F26B,
+   0xE08EB57A, 0xD7D6DDD0, 0x737D9CD0, 0x6C572D39,
+   0xB00845A8, 0x000001E1,
+   0xBF53583D, 0x6EE9325A, 0x921DD595, 0x3B7EF054,
+   0xC0ABC07E, 0x95C35CE8, 0x646FE810, 0x08A3A510,
+   0x85EC11BA, 0x77FE4781, 0x4E870F3E, 0xE382A513,
+   0xA9F1B8BD, 0x4EEB7787, 0x9D8F6459, 0x8521F39D,
+   0x00000068, 0x428A37FB, 0x10AAE6D8, 0xD66092F9,
+   0xF0578F9F, 0x1AB36081, 0xB90F50EE, 0x0AE841EE,
+   0xBB41BCF3, 0xCF79EB81, 0xF73FA600, 0x991AFD1B,
+   0xEB88461B, 0x2CE5C0F2, 0x1B9FEFF6, 0xCAB1B304,
+   0x80183105, 0x00000029,
+   //Window 8
+   0x008C7A44, 0xABF17FEB, 0x7B12DEF4, 0xADE7917A,
+   0x3786B033, 0xBFBA65B8, 0xF0D9F9F1, 0x8EF4AF44,
+   0xAB136CAE, 0x8F47615C, 0xBCBD5D3E, 0xE42F100D,
+   0xF05F9B27, 0x8F3DC658, 0xD6F2DBB2, 0xD95A6B2D,
+   0x0000008E, 0x46BBC412, 0x23BB06A5, 0xD0135EB6,
+   0x15718699, 0xB4ED9E10, 0x8F1639C4, 0xD7F644A0,
+   0x767FEE42, 0xFE8EC420, 0x668267B0, 0x64E90133,
+   0xEC4F5482, 0x536D132B, 0x679E614E, 0x174DF6C5,
+   0x0D72FBAF, 0x000000A5,
+   0x7694F566, 0x8FD8DC49, 0x1FA6E13C, 0xB2AB052D,
+   0x9AABC7CF, 0x7E4A708E, 0x6B81F0F0, 0x68A9C33A,
+   0xF1F7CB07, 0x96E4988A, 0xEA264C22, 0xDCA8D731,
+   0x21B3372F, 0x245371E3, 0x308D2300, 0x02216476,
+   0x0000017A, 0x33696CFD, 0xEBF54116, 0x419623A9,
+   0xA10C5784, 0x38FA84D5, 0x4C6A119C, 0x6D4E5BAF,
+   0x5C8EEE64, 0x9B4959D5, 0x7F99D26D, 0x174F417C,
+   0x58708101, 0x8294B72E, 0x48CAB8F3, 0xD9710F9B,
+   0x828AAA19, 0x00000192,
+   0x7845697D, 0xC661D6FB, 0xAA69C353, 0x324380E1,
+   0x6961D564, 0x521E96D8, 0xAF58E367, 0xB9D070FF,
+   0x5AC3B5A2, 0xABD851DF, 0x530BAAEF, 0xEBC0BEF2,
+   0x358627A2, 0x054BF32B, 0xA205B0CB, 0x0AB65C3A,
+   0x00000157, 0xA74CEC0E, 0x586C331E, 0x2ECC3900,
+   0x2808851D, 0x8003E820, 0x0A695392, 0x81FC784E,
+   0xA667A7B0, 0xF33BBD74, 0x64EDDA2D, 0x29FF01CA,
+   0x13EE0437, 0x4EC28C03, 0x9192138C, 0xD4E0F79C,
+   0x3DE5FC2B, 0x00000096,
+   0x95051804, 0xA09523FF, 0xC6EF7FBA, 0xC4B33367,
+   0x292CD05C, 0x388C5AA3, 0xDD93715E, 0xAE1B2CCE,
+   0x70D39632, 0xED7F02BE, 0xD5169F74, 0xA9DB568E,
+   0xAEB2F9CC, 0x6EB4424E, 0x78FC446A, 0x358F1F27,
+   0x000000D7, 0x67694CA1, 0x3A4E0F64, 0x2B1F54EE,
+   0xF50A6D56, 0x9BEF1F78, 0xCA01350C, 0xC6237D11,
+   0x778A4C6B, 0xA79F4C15, 0x270ED37A, 0xC6D4ACDF,
+   0x4E38060B, 0x1CEB1CCC, 0x5D39BA1C, 0xE6D621C2,
+   0x94AB7FBA, 0x000001A4,
+   0x451EBC0F, 0xC7883273, 0x6CAF9F40, 0x7491E239,
+   0x83906503, 0x935EA015, 0x5DCD244D, 0x126143BB,
+   0x6B4A931E, 0xC5708E20, 0xA6CB75B8, 0x9E74058C,
+   0x36868DF8, 0x211A6F97, 0x98B8563D, 0x79EDB44D,
+   0x000001A4, 0xA769E019, 0x1EF7EEF4, 0x1A174E8B,
+   0x9A1FEEF0, 0x26764010, 0xF7B63241, 0x6F59B94E,
+   0xE1423C69, 0xDBE73EF3, 0x9AFFC03E, 0x2814A67F,
+   0x9E4D8FC9, 0x333E01EB, 0xE6A4F82A, 0xE5A37809,
+   0xF80CD1A0, 0x0000007A,
+   0xB0E600B0, 0xBC9D6530, 0x18A80D81, 0x89CC224B,
+   0xE06D3439, 0xA234CA6A, 0x0CEAB1F5, 0xB55644C4,
+   0xFC9D1896, 0x4504A6CC, 0xBBE1F193, 0x40B6F890,
+   0xABAF5EB0, 0x2661474D, 0x052D3D88, 0x09BD458D,
+   0x00000009, 0xAACC4C5E, 0x3054A4E5, 0xECD13A35,
+   0x69E5A9EF, 0xD95AF038, 0x0865593D, 0x708D9A25,
+   0x7860FEDE, 0xEC49F16E, 0x5DABBA8E, 0xEA0AFA83,
+   0xF239C804, 0xAA972AEC, 0x1E7EE902, 0xE85034D9,
+   0xC8EE63DB, 0x0000014B,
+   0xDE1400D3, 0xEB126E3C, 0x77114739, 0x4D851C87,
+   0x25A86A1F, 0x55637464, 0x5395809E, 0x00B2F8CB,
+   0xECF5803F, 0xEAD5D56B, 0xEE6351A3, 0x182AA08F,
+   0xC92106D2, 0xFE2FEC4D, 0x672EC1EE, 0x7BA669D9,
+   0x00000179, 0x6FE471EB, 0x52217A7B, 0x0755E7DA,
+   0xA20DA1FD, 0x47F5B8D3, 0x1E479F6B, 0x05D5ECDB,
+   0x74DA2C21, 0x73290BF1, 0x1BDE3081, 0xCD954594,
+   0x73493286, 0x3F7B4D50, 0xD1665179, 0x63FA3B24,
+   0xCDE113DF, 0x00000169,
+   0x23B48C92, 0xDB2C322C, 0x9E73C187, 0xFAA004B4,
+   0xAE7E6963, 0x735D8472, 0x11B01C26, 0xBADC451F,
+   0x123595BB, 0x900B269A, 0xF3F280EC, 0xD4F26E26,
+   0x22E4C213, 0x5C896CCA, 0xB4FD6865, 0x71BAF2CF,
+   0x00000189, 0x74214C43, 0xF7C8C832, 0xA2148A5B,
+   0x20CBC871, 0x9BD1A895, 0xE84890C1, 0xA9650846,
+   0x1DA06071, 0x86219B0A, 0x97371924, 0xE30148D1,
+   0x6D0E4AFD, 0x1074A3C9, 0xB1C1ECBB, 0x2D97256B,
+   0x8351F81D, 0x000000FC,
+   //Window 9
+   0xC11B2A0B, 0xD23357CB, 0xB179A631, 0x70DE0D3F,
+   0x122B12B6, 0xB57A0FAD, 0x78489416, 0x3203600F,
+   0xD26D2267, 0x99FE0B86, 0x3B9DEED0, 0x36F3262F,
+   0x24A32DCD, 0xB6E61160, 0xAA745047, 0xEABD7C06,
+   0x0000009C, 0xCDC4CFF1, 0x3F277E18, 0x6EB7045F,
+   0xCAD81ADA, 0xBB804212, 0x3F82D6DA, 0x03B6A618,
+   0x7ECA8375, 0x95F2970D, 0xDA887969, 0xEB3A7834,
+   0x21FC350F, 0x55F9AC1C, 0xFC332B6E, 0x18D4111A,
+   0x0D85B434, 0x0000003A,
+   0xC0C3E8AA, 0xA8187A5F, 0x6DBAE123, 0x89107B45,
+   0x57EE86F9, 0x023BB57A, 0xD0A5E4B0, 0x7B574F5D,
+   0xE8C79CE3, 0xF832B673, 0x6771037A, 0xC10BFDF6,
+   0xFAD2B5DB, 0xF448E37E, 0xEF6701F1, 0x198293CA,
+   0x00000070, 0xDEB4DB92, 0xEE3E2714, 0x3E2A9E0F,
+   0x5AF53D65, 0x0FA38E48, 0x8FE35F6E, 0x5DD085E7,
+   0xE512D689, 0xEAD33215, 0x8B6AAC03, 0x6DDA0F8B,
+   0x44CF0C3C, 0xA861F599, 0x1D642848, 0x2D02DD4F,
+   0xAAE60D55, 0x000001BB,
+   0x453A46D0, 0x4A7912F4, 0x1C7CF115, 0x1D2E7623,
+   0x8F29C610, 0x2208DE2B, 0x81E502B5, 0x809DAA61,
+   0x6BD724B5, 0xA8F149FC, 0x31CE0E18, 0x38AF43FC,
+   0xE8139CFB, 0xA2FDBA97, 0x9EB155F9, 0x665271BD,
+   0x000001F1, 0x8D28EA7A, 0x8B86FC46, 0x51D8FA58,
+   0x8CF2558A, 0xD7BA83E6, 0x2C97C546, 0xACF26595,
+   0xDE7CF223, 0x4CE7407F, 0x7802038E, 0xAC6B1DE1,
+   0x95574CA7, 0xF0E9C573, 0x98631057, 0x55E8BD77,
+   0x43FA05D1, 0x000000A1,
+   0xBC78973A, 0x50C0AE1B, 0x5AFC5571, 0xDA11769B,
+   0x3989FC6E, 0x72DCA0E1, 0x1F23BE5A, 0x270E2D67,
+   0x8BB2AEF0, 0x0C9D34D4, 0x48EF02F4, 0x37F07FDB,
+   0xE0C549EF, 0xFF1C0206, 0x6FD94255, 0x9A62C16A,
+   0x0000005C, 0x785A3C92, 0x368D1944, 0xF92D17B7,
+   0xBAB00EF3, 0xE6B2113A, 0xE8F15F69, 0xF6B46F5C,
+   0xD58342FF, 0xADA12ADE, 0xA0EDF615, 0xE7B4926B,
+   0x12D90798, 0x671BBA9D, 0x284CA9E1, 0x8ED23F9B,
+   0x15DEF43A, 0x000001D2,
+   0xBABD7E5D, 0x68D62207, 0x2368AAD8, 0x7618829B,
+   0x4CB2E88B, 0xD8BC9D59, 0x6FB516EF, 0x8F4545F7,
+   0x3078FFDC, 0x0A5769F1, 0xA5FBF510, 0xA7DDBD1A,
+   0x12BA6FD0, 0xC4C70BA3, 0xF8E0DAFC, 0xEF602078,
+   0x00000016, 0x44F95785, 0x60352173, 0x0D3BE590,
+   0x945017D7, 0xEC7355CD, 0xC12442D3, 0xB71B36EE,
+   0x57FD71D8, 0xCED7C563, 0x65AEB2D8, 0x0155581F,
+   0xCF050F81, 0xB2F83A15, 0x6CF9C035, 0x4CB4DDF5,
+   0x302A86FC, 0x000001FB,
+   0x9AA0A8C1, 0x5EE4BCBF, 0xA37CDDBF, 0x3F701E41,
+   0x253A2DEC, 0x57790D50, 0xF30EC59C, 0x594F2C7F,
+   0x8A383D81, 0xD104AC87, 0x0097BACB, 0x28C23851,
+   0x6DE5B94B, 0x961C3DC3, 0xDD673666, 0x21B3DBC6,
+   0x0000004B, 0xBDE60673, 0x223F6E40, 0xD88C2017,
+   0x8109ED96, 0x3B960BF7, 0x3CE87777, 0xE3DFDD86,
+   0x36B20625, 0x737DC9E9, 0xC959FC6A, 0x635E8D98,
+   0x9F3ACC42, 0x4E87CF60, 0x4C171A9B, 0x033B148C,
+   0xEC218D66, 0x000000EC,
+   0xF14E77A5, 0xB7715CEA, 0x85D3EAE0, 0x30B15CBF,
+   0x4B1D66A7, 0x99AADA43, 0xF303A321, 0x11E13473,
+   0xA3C2FA64, 0xE075D04C, 0x5F4D07AA, 0xB0285520,
+   0xE5D0DBD5, 0x3D838D13, 0x6ADCA13D, 0xD6578532,
+   0x00000082, 0x5FA73D0C, 0x3785F4D0, 0xC4098F4D,
+   0xFABA0633, 0x4F749D9C, 0x9D0A4E29, 0xBE4319FB,
+   0x5966C3DE, 0x1A5367DB, 0x97E059AE, 0x6FA3DEBC,
+   0x0333CFC2, 0x283BE3D5, 0x38E9675B, 0x24D7367A,
+   0xD800FDC8, 0x0000017D,
+   0x70B32E66, 0x1A528364, 0x0E9B3086, 0x5B76DABB,
+   0x382FA85D, 0x48B57C94, 0x9CD9F361, 0x49DE7675,
+   0xB5F63C2B, 0x6C744071, 0xE741CFA6, 0xB7067EBB,
+   0x702D19C9, 0xA95EFC93, 0xCB409C01, 0xFD647A47,
+   0x000001C6, 0xF9F06368, 0x4C31F670, 0xA075C748,
+   0x775B1698, 0xE7656E7D, 0xFB6CBB0F, 0xDA1881A5,
+   0x69C0F805, 0xC2FE6B31, 0x1267496C, 0xD8926EE1,
+   0x0612FB94, 0x6CEFC9DC, 0x56180747, 0xF90F2AA2,
+   0x5518665C, 0x000000E4,
+   //Window 10
+   0xE93EF527, 0x1683448D, 0x0E5B6F98, 0x158FD922,
+   0xE23F2FA6, 0xCD0BCEA6, 0x15982D3B, 0x455D35DE,
+   0xBDA98D71, 0x2FC788D7, 0xF139B889, 0x65D44C08,
+   0x4105FD65, 0x219749FD, 0xE02F1FD1, 0xA9FF816A,
+   0x000000F0, 0xE55948CD, 0xA2A53148, 0x0CC0A0B5,
+   0x2D952F50, 0x61839836, 0x26F77E71, 0xAD87BB45,
+   0xA8BF589A, 0x6A9296E4, 0xAF21E0FC, 0x7D394E96,
+   0x91788120, 0x68622361, 0x47F3D389, 0x090A8CB2,
+   0xF17141DA, 0x000001B6,
+   0xE7BD87F3, 0x0F28D8B4, 0x1FF661B1, 0xCC50621C,
+   0x24D26BCF, 0xE9907708, 0x14FBEBC0, 0x6085222B,
+   0xD55B4431, 0x41EE5411, 0xA0A871F4, 0x51895481,
+   0x0BCD5935, 0xAB250908, 0x9617256E, 0xB3AC49B2,
+   0x00000172, 0x406F50F3, 0x5659B7E3, 0x0FC52027,
+   0x7A7B0D31, 0x9FFACB31, 0x00752BFD, 0xB0727679,
+   0x98A0E45F, 0x36D3387C, 0x789CE025, 0xE59BACBC,
+   0xE49B41F4, 0x199774CB, 0x4AD05ED8, 0x36B12EA6,
+   0xC9B1D3A4, 0x00000004,
+   0xC32D4D9A, 0x0B942D7A, 0xED8597BB, 0xB08FD2DE,
+   0x4B081B9F, 0x40036754, 0x9C4FD91D, 0x317C4888,
+   0x18A7BB51, 0xC872FB14, 0xBF314B67, 0xD530C7F4,
+   0x1C32E6C9, 0x58D77F7D, 0x0F977B24, 0xE626BA9F,
+   0x00000115, 0xE6B4320C, 0x0AD192A8, 0xE3ACB532,
+   0x699204E6, 0x17B5E0A5, 0x992CD0C0, 0x2E533D85,
+   0xB58CD08D, 0x92939F75, 0x4E5EF9D6, 0x42994066,
+   0x13F7C3DB, 0x24E12473, 0x2E2993B3, 0x8DE5501E,
+   0xDF6D4213, 0x00000192,
+   0x1CCE4FF4, 0x3F8ADF41, 0x0B65EEC1, 0x9C347CC5,
+   0x900F860F, 0x83BEDBD2, 0x462FB193, 0x172F2C33,
+   0x5466F3AE, 0x1DFBBC0A, 0xFA41670E, 0xE80DB754,
+   0xDC887B1E, 0x37D5FD76, 0x3346AAA2, 0x6D0AEE5C,
+   0x000000C4, 0xA3C933AC, 0x2B44493A, 0xB953B133,
+   0x22C5B2C2, 0x12F58FB3, 0x06800157, 0xE6BD2AA2,
+   0x1953B249, 0x77CFBF6E, 0x236A4D0A, 0xB91915FE,
+   0x7714CC71, 0x63F6028C, 0xBCE80866, 0x7589CF6A,
+   0x0B2418D3, 0x000000BA,
+   0xFFB2E55F, 0x6C6F6E7F, 0x03DBCCA2, 0x20F4F747,
+   0x9AE70C75, 0x8A750FDE, 0xE75873BD, 0xE58B2BF5,
+   0xEE82DAC0, 0xE84680E0, 0x9A8B304A, 0xE5F7571A,
+   0xB9CAA004, 0xA7848D87, 0xA7927489, 0x3EF58FC8,
+   0x0000003C, 0x313C0114, 0xBB8647EB, 0x96E25144,
+   0x3CF37863, 0xE16B97A3, 0x054D370F, 0xC31CC5EF,
+   0x778CC8C5, 0x8C5E1E94, 0x43DF4759, 0xB5555714,
+   0x8885B10A, 0xB4FE74BB, 0x99F3ED12, 0x7682FEFF,
+   0x5FDE57A7, 0x00000117,
+   0x078E03F1, 0xCF414BBA, 0xEC6F939C, 0xED6D1D2A,
+   0x8E327495, 0xE2DD6E93, 0xE220DC56, 0x4A1B0D53,
+   0xB91CB009, 0xFC7D14B9, 0x82E76C53, 0x2FC66E80,
+   0x1FCF6844, 0xF0B24F1A, 0xEBC5DC83, 0x07C90A09,
+   0x0000013E, 0x044479E0, 0xA6DE36F3, 0xF14203DD,
+   0x4A571F80, 0x6A4ED391, 0x087824A9, 0xE360DBFB,
+   0x46288A18, 0x72C0FBB5, 0xD88AFFA2, 0xE7DBDB32,
+   0xD5784A66, 0xD6AFB61A, 0x49F340C2, 0xAEF40A4F,
+   0xCA61B25E, 0x0000000C,
+   0x5FA23CB5, 0xF0A611DA, 0x5A95A434, 0x96302767,
+   0xC1088AA6, 0x6502B233, 0xF5E8CAEE, 0x50A13CAA,
+   0x9CD0279A, 0x1559DE22, 0xDF3C1521, 0x61B059BA,
+   0xD86FC9D4, 0xDFB294B5, 0xC13B08AD, 0x10C56755,
+   0x0000017F, 0x2BA32535, 0xCCA4A304, 0x42D4C801,
+   0xD13CF25C, 0x36B15517, 0x5CB0DB44, 0xDB886237,
+   0xE95E8BBC, 0xFFC4D2C0, 0x9EE813B3, 0xD1F39428,
+   0xE17DE8F2, 0xFDC16098, 0x9BF8AA0A, 0xC8B2B08C,
+   0x307E732C, 0x00000002,
+   0x2A7C68CF, 0xF5266DDB, 0x8880841F, 0x9A74D29F,
+   0x25116368, 0xE8B8D418, 0xBE294CFE, 0xBF158418,
+   0xBDC0CE68, 0xDAA1D0EC, 0x3630E99F, 0xE08876CB,
+   0x57B4D4BD, 0x95FDDC4D, 0x51FEC712, 0x14CF5E95,
+   0x00000175, 0xB9D5B157, 0xC4E5C08D, 0x0A622832,
+   0x51631CC8, 0x61CE0627, 0x6D8F4379, 0x95448DF3,
+   0xFC48B55D, 0x8B89AF62, 0xCF0D6DA1, 0xE90CD79C,
+   0x92825003, 0xE27C8A25, 0x2EA6B3D4, 0x5DB408EB,
+   0xB539BCD1, 0x0000018B,
+   //Window 11
+   0xB6813F72, 0x6F7F2FE8, 0x940210F0, 0x95F979FE,
+   0x1A409657, 0x42CBD8D7, 0x474C141B, 0x2E2D2F08,
+   0x52A6A362, 0x63E5EFF0, 0xB1C5A27D, 0xCD24503E,
+   0xDB08B256, 0x30335D77, 0x9724BEBF, 0x827057CF,
+   0x00000003, 0xDC5FEEF6, 0x6B372CA7, 0xD06696B6,
+   0x7557C331, 0x4A42090F, 0x4B10D90B, 0x6F10352B,
+   0x2C93E984, 0x2B8DED01, 0x72AC24FF, 0xD8C833A6,
+   0xFA53F5DA, 0x7C9354CA, 0xC166ED4B, 0x9E3B4CF5,
+   0x81DF59A0, 0x000001FA,
+   0xCC6DCE31, 0xCB9E50B3, 0x60399388, 0x0B656FDA,
+   0x600D4B62, 0xD3104FA3, 0xB660E0EA, 0x7CFC68AC,
+   0xDD9F415F, 0xD8C2218A, 0x26C649D9, 0xB3E0D7C6,
+   0x4D09F7FC, 0x37E6279F, 0x136AD787, 0xE9EF720E,
+   0x000000E3, 0xD03870D7, 0x0BADA672, 0x815592E0,
+   0x553EF23F, 0xB8DD5471, 0xC1132AD8, 0xB80B521A,
+   0xD8666E9F, 0x2C62908B, 0x38F49D54, 0xC9F15B3C,
+   0x3095F1BE, 0xFE8866D7, 0x5AA771BA, 0x8590B3CF,
+   0x0FA253A2, 0x00000015,
+   0x47525F3B, 0x31338097, 0xC6CDF694, 0x49551E31,
+   0x5B9451F1, 0xDFBE8362, 0xEE491931, 0xFED9C23B,
+   0x324D645C, 0x5270A02F, 0x4175D154, 0xE323781F,
+   0xFF475990, 0x31511E52, 0x69B0445E, 0x0B60CDA3,
+   0x00000082, 0x92FA5405, 0x822E4180, 0x6B4D67B8,
+   0xE78F939B, 0x265E1B54, 0x6F09C296, 0xB6BAA0BA,
+   0xF6EF60DD, 0x8BE593BA, 0x1D83F296, 0x7E71D499,
+   0x777E0632, 0x2E0DED5E, 0x5DB33416, 0x357E1BE4,
+   0x6800DC32, 0x00000077,
+   0xAAD63226, 0x46FBCF70, 0xF2C43F64, 0xC023EB8A,
+   0xA3F42111, 0xAB1B684C, 0xD12CEA22, 0xC6262621,
+   0xAD523F98, 0xA2539D86, 0xB45F0B6F, 0x76B98970,
+   0xD788809C, 0xF9874DF8, 0xAB358B89, 0xB24620C7,
+   0x000000C1, 0x92E3B976, 0xDD50316F, 0xECDF1DC5,
+   0xB6A2FED9, 0x7F40B693, 0x746BB5D6, 0x0572240E,
+   0xB76CE9E4, 0x084F25BA, 0x5C65A823, 0xB9890EC6,
+   0x51BA6ED9, 0xCAD192D9, 0x3930DEA2, 0x16DD9BFC,
+   0x2C781504, 0x00000126,
+   0x8961C678, 0x1EB52D8C, 0x5188A0B6, 0x9318B87F,
+   0x998C4703, 0x449DA5F7, 0xBA1284A8, 0x814E23EB,
+   0xBCD03139, 0xC4D98C41, 0x965A1803, 0xB1FE6BEF,
+   0x889A0BC5, 0xA2B5B201, 0x9B13CCDC, 0xBC93A351,
+   0x00000181, 0xF4E51116, 0x17C9763F, 0x2A842E35,
+   0x26C73085, 0x1296397E, 0xDD6481A7, 0x54F7416D,
+   0xD588B1B8, 0xC3D62325, 0x59F846CB, 0x20321E09,
+   0x8F0D9AD9, 0x9E1699DA, 0xD9C7BB56, 0x15DE9318,
+   0x42A8B57F, 0x000000E6,
+   0xB227157C, 0x32C6A931, 0xD347B7D4, 0xD276F7D0,
+   0x0AB44F59, 0xDA50395F, 0x99A52BE4, 0x5D0C5176,
+   0xB97054DC, 0x7B0F28E7, 0xD8E7B1DE, 0xDAE56AEF,
+   0x87B4CCAE, 0x05B01800, 0x274A0AB5, 0x21C81809,
+   0x000001ED, 0x9F9761C7, 0xC1C7E06B, 0xC2A78191,
+   0x3BD3309F, 0x702A4F90, 0x2C239FD7, 0x34A9F65D,
+   0x56867164, 0xC1695583, 0xF8097255, 0xF8597CF8,
+   0x9B59C0BD, 0x58996101, 0xE0C0EA85, 0x2622F5ED,
+   0x30AFB4DE, 0x0000005B,
+   0x8EA50AC8, 0xC3120DF7, 0x819551E9, 0x124A99BF,
+   0xEDDF11E9, 0x69DD9B95, 0xADCD1283, 0xDE805C83,
+   0xA354632D, 0x3CB8D5F8, 0x4D718278, 0x1D9DCBAF,
+   0x42C9AA97, 0xEBF2D047, 0xB9B68E10, 0xAF43C4B6,
+   0x000001AD, 0xD2451B29, 0x21EDFCB3, 0xA48336F3,
+   0xCC9ACF06, 0x11E3E8B7, 0x8471E8C3, 0x3E1E38E7,
+   0x3FE0082E, 0xF6A8AA86, 0xF9E09F1D, 0xE946EB4D,
+   0x3B445ADB, 0x1579DB09, 0x83D1B8D2, 0xECAA7CD2,
+   0x602DB173, 0x000001FE,
+   0x98C0AA63, 0x8B2C940F, 0x552F4B66, 0x6B8F11B6,
+   0x208BDBD8, 0x36D68942, 0x6D35A682, 0x1A27268D,
+   0xE3C883C6, 0xFFBABE3C, 0xC7B51FA6, 0xB2F48C34,
+   0xCFF5F20F, 0xC307666A, 0x6823D193, 0x98842102,
+   0x00000064, 0xA730707E, 0xA307127D, 0xB63D595A,
+   0x89C67AE8, 0x075C1933, 0x235A76D5, 0xC680DA9C,
+   0x4E1488E6, 0xAC7D5A89, 0xBD34618D, 0x90FE0290,
+   0x22131BC3, 0xE5F6D0E4, 0xB6709CEF, 0xCB81BB60,
+   0x6D74A464, 0x000000F8,
+   //Window 12
+   0x1C3BE7EF, 0x62B63169, 0x8074207D, 0xDAB254BF,
+   0x235A4C77, 0xF6F1466B, 0xD3B01424, 0x66F8F60F,
+   0x3BAE9F80, 0x9DA54069, 0x500F8A6C, 0x1A840763,
+   0xB25994B1, 0x542E2DD9, 0x183B3CEE, 0x996307E5,
+   0x0000006E, 0xA4B301ED, 0x45E2AE85, 0xE1FB6112,
+   0x0640D46D, 0x83FC8F4B, 0x7F102D19, 0x4F30038E,
+   0x6EEECE3A, 0x912F39C3, 0x74D062F5, 0x16906C7B,
+   0xA802A553, 0xE6D6E8C1, 0xA8D8C58F, 0xA57B4387,
+   0x77CFD9BC, 0x000001F0,
+   0x8EAC672F, 0x2FA8A511, 0x18B28A2F, 0xB58FE9A2,
+   0x69CB28AE, 0x0DB617AD, 0xADCC6220, 0xAC90B7D8,
+   0x852A7529, 0x3113C468, 0xDF7CF5CB, 0xAAC72C21,
+   0xE341E2CD, 0x3C1DAFAB, 0x68E9CBF2, 0x8AECF2A3,
+   0x00000149, 0xC3ACFC2F, 0x1461A475, 0x0CF6C4E7,
+   0x53EE5E37, 0xD20FCD4A, 0xBC89CD30, 0x3CB0B266,
+   0xABF7AB38, 0xCF12EEC3, 0x6030727C, 0x90F159A3,
+   0x9B3E7CB7, 0xB364C651, 0x60DDDE88, 0x0FDE7B06,
+   0xA575474E, 0x000000B2,
+   0x9D906490, 0x0DD159BF, 0x9CF878DE, 0xF3167E2C,
+   0x9FE4E683, 0xB2BCE411, 0xE82D628A, 0x1F7EDC9A,
+   0xCD23E4DF, 0xCF4A33AD, 0x21CBFAF7, 0xC0A49058,
+   0x635E858E, 0x192FB797, 0x325E6C47, 0x68DAD953,
+   0x000000B7, 0x14E26CC9, 0x662DF578, 0xC83FC419,
+   0x601A649F, 0xC80CFB85, 0x1AFE2549, 0x0B949F46,
+   0xEF38EB32, 0x7B42E487, 0x5FDF3664, 0xD509DF41,
+   0x7073C6AF, 0x066A0911, 0x7CB9E459, 0x946811E0,
+   0xE397A29C, 0x0000008E,
+   0xB7C2CF3B, 0x40BC7A65, 0x23C30518, 0x5043C6C7,
+   0x44DE8A14, 0xE7F93C65, 0x89ED4019, 0x5F8B4F4E,
+   0x96F258D4, 0x52D6E1F5, 0xBF255616, 0x23749D1D,
+   0xAA7F5F1E, 0xE03FEB69, 0x0C563D0F, 0xDB07A6A9,
+   0x00000163, 0x9DF56623, 0xD4029081, 0xC125A069,
+   0x18B71B89, 0xB7C6D7DD, 0xC4F119F0, 0xE05C3E73,
+   0xE6588CF4, 0x876F22F1, 0x0CBC6A79, 0xE6EEAEDC,
+   0xBF99DE26, 0x1B6ABA38, 0x9AA4741C, 0xCE3A2DD3,
+   0xF7CC38A4, 0x0000019B,
+   0xDC95DB9D, 0x0A3A1D68, 0xCF75DFB5, 0xA5C38305,
+   0x6E7E027C, 0x488C420C, 0x749040AA, 0xCAB3BD50,
+   0xEE496851, 0xA50B861E, 0x6C3FFFCF, 0xE9EC1AA9,
+   0xB05F9EDB, 0xEBE4D535, 0xCBCDEC8E, 0x041472E9,
+   0x0000010F, 0x9850831D, 0xB0E8FE76, 0x0BC53C52,
+   0xAD09D3EE, 0x224F7773, 0x11C864C6, 0x5AA5E0CC,
+   0x965A2517, 0x9546B27E, 0x76EDD7BB, 0xA5703E55,
+   0x6C41F158, 0x67ED0E1F, 0xB857BE3B, 0x815C2853,
+   0x80B601AF, 0x000001AC,
+   0xE228E043, 0xADE5960B, 0xF42A814B, 0x48C80804,
+   0xF55B80A6, 0x299F7124, 0xCC584AC4, 0x84E266B7,
+   0x9C5CD654, 0x0583D397, 0xF7F2325C, 0x670F05C3,
+   0x3D2C9C88, 0x15E7C1D2, 0x99565917, 0xAB084DC6,
+   0x00000062, 0x63A823E6, 0x37456DF0, 0xF18D1728,
+   0xA7A22F47, 0x16114C50, 0x1379A433, 0x6287C78C,
+   0x2019CB0E, 0x0018FCE9, 0x0B5619E6, 0xC50E946E,
+   0x465896EC, 0x524A795A, 0xCE912C92, 0xF7B944C6,
+   0xDE99A5C6, 0x00000065,
+   0xE2C08623, 0x37E172F3, 0xB4A56F2A, 0x882663C4,
+   0x8884C202, 0xD1F3145E, 0x473AF962, 0x05A3BB5E,
+   0xEBBA4C7B, 0x77842BF6, 0x24086988, 0xDD7D579C,
+   0xB6B2FBB1, 0xEF6A7B7D, 0xBB8944E1, 0xAB0E5EAE,
+   0x00000120, 0xD14AA9BB, 0x4D374271, 0x9BA34C85,
+   0x70A7FEF1, 0x8760F6B9, 0x078E4FD9, 0x5B53CB19,
+   0x7B7E23A1, 0x9272D546, 0x2967D06B, 0xCF09516A,
+   0x92E5112A, 0xBDB078A0, 0x416E5ED7, 0x9CE1BC10,
+   0x726C89EC, 0x0000007D,
+   0x126A0C8C, 0x874AF4D4, 0x3E16A72F, 0x3328A9AF,
+   0xF021B43E, 0x2934AB97, 0x561F00AA, 0x63E437E9,
+   0xF3A94E26, 0xB15E3F49, 0x3EFE25B9, 0x35CFDE7D,
+   0xAA8CA319, 0x4D647027, 0x6BD5FB33, 0x91E0124E,
+   0x000000FE, 0x0B4DDCA6, 0x6CFA7331, 0x3BD66215,
+   0xD8479B77, 0xD0474238, 0xCECBF081, 0x4355CB2F,
+   0xE46E2B3B, 0x8ABCA134, 0xB891F695, 0x17CF9FB6,
+   0x5D9B6DD9, 0x3195121E, 0xAD177BE3, 0x3E29B170,
+   0x2C29B968, 0x000000E1,
+   //Window 13
+   0x5C346588, 0xBB59F267, 0x76F373A1, 0xAC37B368,
+   0xA4C6D860, 0x4826E015, 0x61BDF224, 0x4EF341B0,
+   0xBECAC30B, 0x70B01FB4, 0xF0BB0C51, 0x5F518CFC,
+   0x9D163117, 0xBBEC7A91, 0xDE2DA58E, 0x8A65BEE8,
+   0x000000BA, 0x566098B5, 0x965CAF8E, 0xAFBD8436,
+   0xE8BA0E81, 0x7299FBC1, 0x77F4E27D, 0x367E2155,
+   0xF5169F5C, 0x01A49A6F, 0xC88FA561, 0x557B66DE,
+   0x8A6A0228, 0x8E1BEE40, 0xC867F1FA, 0x6DE8FCED,
+   0xBF4B5F80, 0x00000042,
+   0x628233ED, 0x59FA6794, 0x25A1287D, 0x1C30A04A,
+   0xBF3FAD38, 0x8DD4FDCA, 0x0D0B6F87, 0x522AAD84,
+   0xD160F8CC, 0x12A66E90, 0xE673AF6B, 0x714213F3,
+   0xAD0AB724, 0xD5E6FEEB, 0x6A892358, 0x0DDF08F1,
+   0x0000001F, 0xC077FEDD, 0xAA50ABCE, 0xE7610FEE,
+   0x36E6411E, 0xEB815B83, 0xBEA885D1, 0x5D57A6AB,
+   0x9710ED6D, 0x85645674, 0x794E6F1B, 0xF124CBF1,
+   0x7608184D, 0xCC8BE47B, 0x356377F6, 0x4B3E7161,
+   0x56CBD260, 0x000000D7,
+   0x910FDA3A, 0xF42C064A, 0xCEA6AA25, 0xFBAFA50F,
+   0x0DE9BBBC, 0xAFE5F558, 0x0E89FB39, 0x24E9D4AE,
+   0x25C76201, 0x5B719739, 0x5475AEEA, 0xA87EA529,
+   0x3C4BE889, 0x1E5495E0, 0x995AD46F, 0x7866138B,
+   0x00000087, 0x46AFB538, 0x5F9F803E, 0xCA875A75,
+   0xF8C0F078, 0x89B71552, 0x63F1050A, 0x8D43BB0D,
+   0x0858BAAB, 0xFE38CF7D, 0x8DC61935, 0x20F815EA,
+   0x50FBDAE2, 0x2E070889, 0x6C6A84E5, 0x73FB1857,
+   0xA524045E, 0x0000001C,
+   0xBD667641, 0x32966F76, 0xF0D579A6, 0x7DE72BE5,
+   0x81276712, 0x0A6FFAFB, 0x5E91A169, 0x0C76A213,
+   0x5F953CED, 0xEB960ED8, 0x0BE111CD, 0xAA5F7F8F,
+   0x911F59FA, 0x2CD0B477, 0xE5220A86, 0x059A70C6,
+   0x000000DB, 0xA61C4277, 0x16F99E8B, 0x56710251,
+   0x011745B6, 0xF1EF7FF2, 0x13CB7D19, 0x14F0C0E0,
+   0x2162EDB4, 0x67467A1C, 0xB0A459E8, 0x248E6FC9,
+   0x2CEE2121, 0x98142385, 0x2BA236EB, 0x1E63FA6E,
+   0xBD7465C9, 0x000000DA,
+   0x86B50C9C, 0x2A46C0A7, 0x0A057CE3, 0x82C3D6AB,
+   0x76C283D2, 0x9383A377, 0x1C11C68D, 0x558CBC68,
+   0xA0C20CFE, 0xA4F838D6, 0x41372541, 0xA3C536E0,
+   0x547A8C5E, 0x8186B8FB, 0xDFF536F9, 0x35FC4083,
+   0x000001F7, 0x19563D8F, 0x0050EC2A, 0x9484F295,
+   0xBB0280F7, 0x7B134EB6, 0x7DB337B1, 0xCAC07F11,
+   0x0342621E, 0x001EB285, 0x02390009, 0x176A7035,
+   0x4299F505, 0x80360ED2, 0x8EC094A2, 0x859795CC,
+   0xE4655868, 0x00000181,
+   0x212101C1, 0x63C19EA5, 0x2A79E339, 0xF1A83D3F,
+   0x45C6C251, 0xC32B350C, 0xFE63047A, 0x403B7F19,
+   0x83C8FC2D, 0x5CACE871, 0xF8B3BA77, 0x8F682259,
+   0xBBEB6E6F, 0xC28F8686, 0x8B53B422, 0x5B6FF887,
+   0x0000011D, 0xA7084BB3, 0xA2346206, 0xDF24EB15,
+   0x4AF0A26C, 0x15693983, 0x4851547C, 0x959D138D,
+   0x6334F835, 0x813F9811, 0x7A017A94, 0x5836E6C3,
+   0x4690B7B9, 0x314A8CA1, 0x36DAC227, 0xF47A571F,
+   0xA208D1FC, 0x00000023,
+   0x49BBDCC5, 0x4B302E04, 0xD5DF9D23, 0x8AC1D4CE,
+   0x2D5ED03F, 0x16933E34, 0x310C7EA8, 0x84C14BB7,
+   0xF2775AAF, 0x8E175CB4, 0xCC5C14FB, 0xFC626088,
+   0xABC13577, 0xA976DFBB, 0xDB34A758, 0x1B65DE60,
+   0x000001AE, 0x404A16A6, 0xB8EC8C8F, 0x65C21075,
+   0xFE2343A8, 0x281FAFF8, 0xE88C40AD, 0x98A7765A,
+   0xCB4247FE, 0x33F10D29, 0x71BC7CB4, 0xBD10D6B0,
+   0xED29AAB9, 0xB244B20D, 0x3D10065A, 0xF858E3A2,
+   0x421261E9, 0x0000003C,
+   0x5BF61D77, 0x46D98F97, 0xBB29A183, 0x3F07B422,
+   0x4DD94AFE, 0x3F70393F, 0xAC222E32, 0x7A92252D,
+   0xC3DDF1AE, 0xD7771A93, 0x44720E3B, 0x5AED637C,
+   0x5F92473F, 0x0FC5D917, 0x7A9B58C8, 0xF11CECE8,
+   0x00000197, 0x7C355BF5, 0x4BD350DA, 0x3134AF3E,
+   0xB93B27EE, 0x2513BE74, 0xE84F3D37, 0xA76034E4,
+   0xF8C140A6, 0xFFAAE759, 0xD99AD646, 0xE8EAB681,
+   0x7DF0E535, 0x16F4767B, 0x3DA23997, 0x623A390B,
+   0xCE44ACB9, 0x0000018B,
+   //Window 14
+   0x5A714194, 0x9AA53B47, 0x6957D5EB, 0x01163DD8,
+   0x908F5929, 0x5BD2C24F, 0xDBE42B0F, 0x87F519F4,
+   0xFB6B5AD4, 0xFF767379, 0x9A193F28, 0x4D0F8BBA,
+   0xEE549D79, 0xF3C42BD0, 0x825244FA, 0xBF851D3F,
+   0x0000009B, 0x9F78B57F, 0x825FFB60, 0xE0F74B73,
+   0xD1913668, 0x5468F89D, 0xF42A5B03, 0xAACAE46C,
+   0xA2347499, 0xC85272E8, 0xC771E34C, 0xD427D3A1,
+   0x295684C1, 0x433451DC, 0xED749903, 0x0CBABBD4,
+   0xB872072C, 0x00000049,
+   0x10A0D011, 0x84527363, 0x0BBADDD0, 0x299E1CB3,
+   0x5294C956, 0xF5F3079B, 0x4F0A3584, 0x9EDD5FA2,
+   0x641F1FE4, 0x764BB175, 0x93B38DB4, 0x0217A94A,
+   0xE31E6FDB, 0x61C992B7, 0x764CABEC, 0xEB231629,
+   0x0000013B, 0xD2E8C15C, 0xBD3B12A4, 0x8ACCC1F1,
+   0x8EEF9B5D, 0x52747252, 0xB931FBC7, 0xF9817BEF,
+   0x8A7B86C7, 0x584E1181, 0xB52330BA, 0x25A0A0AB,
+   0x9BC4926D, 0x89A625D7, 0x002FEB9B, 0xDB41831A,
+   0x653946B5, 0x00000061,
+   0x09D9E2F2, 0x2218489B, 0x7F4FE3C0, 0x56376992,
+   0x1ED2B98E, 0x61E36521, 0x178D242E, 0x166D671A,
+   0x7E8D39B6, 0xB65381C9, 0x82851B43, 0xAEFE583A,
+   0xA24A7AF4, 0x6CAA4459, 0x5640D447, 0xB421380F,
+   0x000000B5, 0x11D91549, 0x706A4130, 0xE3064F4A,
+   0x4214BE92, 0xB7649258, 0xA7C3B7B8, 0x71C05DDE,
+   0xA782E2FC, 0x83D30793, 0x0FA90EF6, 0x15DBD474,
+   0x1C77425B, 0xFC0B16D8, 0x917CDB42, 0xC7BFA045,
+   0x7EF5FAF8, 0x000000E9,
+   0x07AE5402, 0x09238DE9, 0x444B8B61, 0x14FCE2B1,
+   0xBD0D2EAD, 0x37EE7AFF, 0x97804504, 0xECBC75DE,
+   0x3B5E5FD8, 0x343A5D1A, 0xA90DCF6B, 0xBF806EE5,
+   0xB2BF2A3D, 0xD07F1054, 0xED9FFFE2, 0x6F590326,
+   0x000001FB, 0xE6198AAB, 0x9C42832D, 0x475EC98D,
+   0x3EACD0ED, 0x937FFE67, 0x715B6AA8, 0x891BFFC8,
+   0x4B35D1E7, 0xB36A8835, 0xFAD8AF9C, 0x7B8F6F81,
+   0xA3A21D6F, 0x771C3B1C, 0x4FAAF12E, 0x04FAD4C8,
+   0x4E053133, 0x000001F1,
+   0x4114124C, 0x296C4E5E, 0xD47C56BD, 0x8F760836,
+   0xF6758211, 0x9FDA0A36, 0x36CD51BB, 0x2BC5E75B,
+   0x1BBA9F2A, 0x32E6873F, 0x8E6C979A, 0xED7A7C28,
+   0x47CCCD6C, 0xBEC902BB, 0x48DCA66A, 0xACF4C76C,
+   0x00000080, 0x355A975A, 0x44A892F6, 0xBD1B1666,
+   0xBBD44A35, 0xA612F865, 0x6B49014C, 0x6B81BD2E,
+   0xCD50CBB3, 0xC26BEAB6, 0xB25E204F, 0xF93FE188,
+   0xDDCF6123, 0x7A980260, 0xA3C65166, 0xE19AE815,
+   0x87F09AF9, 0x000000C5,
+   0x1C6A01EA, 0x3F298D94, 0xDEC1F22C, 0xB6EE6874,
+   0x496D5522, 0x189023AC, 0xC08A48C9, 0xCA543ECF,
+   0xA2DB1EA9, 0x240CA6A0, 0x54492401, 0xA591EF2E,
+   0x344BCD0B, 0x22027038, 0x6DC4CED7, 0x34CB8459,
+   0x000001DC, 0x0414ED02, 0xB5A94908, 0xA14739F7,
+   0x8BDDF24B, 0x79AC753B, 0xA788AB96, 0x77FE2FF1,
+   0x754163A9, 0xAF045BC3, 0x49803F05, 0x42D13F83,
+   0xF4820418, 0xD7528FA3, 0x9F86243C, 0x08588F48,
+   0x9B4C2ABE, 0x00000131,
+   0x4473F37C, 0x3AF9DCD1, 0x80E36492, 0x7C318430,
+   0xC8D049CE, 0x5115486A, 0xB10D6316, 0x594EE800,
+   0xF913F656, 0x3C9AEC97, 0x476865FD, 0xC9B99AE4,
+   0x0FECFA86, 0xF9A597F8, 0xC2664276, 0x59313AAF,
+   0x00000020, 0xE5A1239A, 0x431F1976, 0x58838D43,
+   0xB406A1EB, 0x8D681F4C, 0xC023F469, 0xDCCCC654,
+   0x5F1DD612, 0x434F82C6, 0x9032C342, 0xC7965DA3,
+   0x99BC4322, 0x2745885E, 0x8C2F2CE3, 0x6CF68162,
+   0x415FF1A8, 0x00000009,
+   0x6DD7D8C6, 0x41EC0659, 0xB07D565D, 0x8BAEAEFF,
+   0x26C9B544, 0x55F5138C, 0x88825EE5, 0x975E2127,
+   0xC1A092E0, 0x90422CA7, 0xDBDE0554, 0xA03DE4E8,
+   0x734E71A8, 0xDF408882, 0xA10CC8E4, 0x80E01F63,
+   0x00000157, 0x0A65CB93, 0x7B4E0E13, 0xC1E49A1A,
+   0x1F3E7FAE, 0xDD71B3F8, 0x1B12FDB3, 0x1253F42E,
+   0x8D32D35F, 0x4312F8B0, 0x38E09D67, 0x4281B5CE,
+   0x9A727EBD, 0xBF211BC2, 0x0002358A, 0x3E61916C,
+   0x46C3DBA1, 0x0000003C,
+   //Window 15
+   0x414D9815, 0xBF2097B9, 0xCDA66DFC, 0xFA0673B3,
+   0x193B17B0, 0x8C775677, 0xC5387E9A, 0x07C8DBF6,
+   0x4C5DA984, 0x141DE69D, 0x06A8B133, 0xF0650AC8,
+   0xD2B258C4, 0xADD766EE, 0x96303678, 0xA6F42763,
+   0x000001DA, 0x39C8824B, 0xCDBF1DAA, 0x5638CB0C,
+   0xF8F2CD8C, 0xB6D33286, 0xD966C8E9, 0xC1331E1F,
+   0xE4B63EF8, 0xFB5F843E, 0xAC72D8E3, 0x8FF6B4B6,
+   0x110D0D4A, 0xACD5CF3B, 0x0067FE1E, 0x21C1E826,
+   0x5EAAE5B3, 0x00000068,
+   0x26E22B52, 0xC1D7001B, 0x2825905D, 0xB4B20896,
+   0xE739E7BE, 0xA064FDCD, 0xF2D62D9A, 0x83BFA334,
+   0x2758B810, 0xA2BAF389, 0xEBD64633, 0x3A88F2E4,
+   0x76DFD697, 0xD621BE34, 0x9F4A85C3, 0x7168C077,
+   0x0000017E, 0x20F8F0EA, 0x5B8F06F5, 0xCFACFC46,
+   0x95E44505, 0x787844B5, 0xE20192BD, 0x4A04ADC2,
+   0x316468C4, 0xD6774463, 0x30D71497, 0x5A606A2D,
+   0x7C826A92, 0x81BA512E, 0x22ABADF9, 0xCE26365C,
+   0xEB15B45F, 0x00000146,
+   0x99BCA15D, 0xFBE699BD, 0xBA48093F, 0x0D1C3672,
+   0xAB23124A, 0xF73D4880, 0x835A7F27, 0xC1752BA2,
+   0x5EEDE054, 0x94B30388, 0xD7F00082, 0x188F6B28,
+   0x86A04627, 0x2828FC70, 0x44BE79E6, 0xAF12D735,
+   0x0000012A, 0xD7B22FC7, 0xCD758E79, 0xA66F1012,
+   0x3187D186, 0xDCDDBC4E, 0x46D5D067, 0xB711FA20,
+   0xF2F7629E, 0xBCED7A88, 0x66252C90, 0x32982565,
+   0xA22574D0, 0x6EBB83C8, 0xE8001619, 0x78FBB10A,
+   0x731A6B86, 0x0000002F,
+   0xC4C926E6, 0xE93FF2EF, 0x3DC958D5, 0x417AE211,
+   0x770DAC2E, 0xA58BBE5E, 0x8CD4F091, 0x1C0F5F79,
+   0x46153DAF, 0xF4F9D63E, 0xEC37EA0E, 0xF33CE1A5,
+   0xEE187FF7, 0xCBE10924, 0xF34290F5, 0x3E986A34,
+   0x000001B7, 0x1E9E074D, 0x597B1F32, 0x6EE84E95,
+   0xE88F6C8A, 0x6B90E61D, 0x5CCC3EAB, 0xCCB5CBC0,
+   0xE27E2023, 0x2FA7DB33, 0x79E991FC, 0xD66BBA72,
+   0x4EE221B7, 0x4FA39A46, 0x90059ACB, 0x6587F688,
+   0x1311930A, 0x000001B9,
+   0x8D069D96, 0x02050868, 0x66B34C43, 0xBF4B3655,
+   0x7F3DE1F2, 0xB6CAFBE6, 0x1B28142D, 0xFC512E1F,
+   0x6CD17E71, 0x74FE9873, 0x8A44F1BD, 0xE39E338C,
+   0xDBA3C6E8, 0x5EEF8572, 0x68E236E6, 0x2AC52410,
+   0x00000155, 0x4F05F2E8, 0xABDE2779, 0xC4291117,
+   0x22E67F89, 0xD836F104, 0x6F01971E, 0xC516A0A1,
+   0x34040C96, 0xC9BCD434, 0x2EB86EF1, 0xEA30CA89,
+   0xEFCC2DF3, 0xBE065ADD, 0x05535B75, 0x3ED10871,
+   0xFC6FE904, 0x00000170,
+   0xB6D90AD1, 0xB3FE48F3, 0x9F2A94A6, 0x003894EC,
+   0xF1D1718F, 0x1DBD05F4, 0x59A35613, 0x9E07516A,
+   0x5B65B5A6, 0x9FC488CD, 0xD3A2619F, 0xCA4609F8,
+   0x0907796B, 0xE7B6D1F1, 0x67378F56, 0x8C95F670,
+   0x00000034, 0x73F60E0E, 0x7E5AF4FD, 0xC541AB15,
+   0x49D97796, 0x51C68E6F, 0x6D06AC34, 0x80B5C20D,
+   0x5580386B, 0x7B18DD5B, 0x5543E65E, 0xCB20F8E2,
+   0xC0C46D3D, 0x7B7658D2, 0x5CD12993, 0x4CE022F6,
+   0x06BC8A3C, 0x000001F4,
+   0xBC2DD99D, 0xC47018DE, 0x444763FA, 0x7B4DFA32,
+   0xCEBAF84F, 0xF14F11C3, 0x3799E81B, 0xDA34D7A0,
+   0x2351DB7D, 0x80486CCC, 0x071B8E02, 0x313FA62F,
+   0xB4A0FEFE, 0x17B0C4C2, 0xC2E6A4EC, 0xF96F6BC9,
+   0x00000126, 0x6B54CAF2, 0xAF70B257, 0xC1EF3008,
+   0x15E751D9, 0xEB6D3E35, 0x4BB6C7BC, 0x0C80C0CC,
+   0xB4ABF99E, 0x1F18D3DD, 0xA6C8601B, 0x8D48620A,
+   0xB8B1624F, 0x83587563, 0x343B56AD, 0x04D55C18,
+   0xB1B4243C, 0x00000076,
+   0xFA9E3B2B, 0xDEE6D4D3, 0x89719D7B, 0xC89DC320,
+   0xD4BA39AF, 0x584E18A8, 0x159CF1C7, 0x3C2A717C,
+   0x726431CB, 0x3F89584F, 0xCF2DF7CA, 0xF26517E4,
+   0x6F9582E3, 0x4AA28F22, 0x410CAE0F, 0xAC1BE97B,
+   0x0000013D, 0xAB393139, 0x1CB73C6F, 0xEC65CC58,
+   0x28DF0EC5, 0xFA4492AA, 0x42A1BA53, 0xD41ED280,
+   0x842A7C25, 0x72F671E8, 0xB9DFB3F4, 0x5A2E9B36,
+   0x5CA5298B, 0xD73E2D19, 0x1614C168, 0x66874F9B,
+   0x4CB3B6EE, 0x00000185,
+   //Window 16
+   0x689DBE3C, 0x94A182E2, 0x02610256, 0x2D8EE166,
+   0xE6294291, 0x4D0CB259, 0x0A7FCF2D, 0x244DB120,
+   0x8F58F3AF, 0xB50D34B0, 0x13275075, 0x2AD4B9EC,
+   0xC96BFCFA, 0xA19BECCF, 0x86F5BAF0, 0x1A5509DA,
+   0x00000185, 0x5AC043E6, 0xEFE1469C, 0x7D273130,
+   0xC86B7721, 0x2606809A, 0x2324AF0C, 0x21800FCB,
+   0x33A3324E, 0xA6B0D999, 0x8A38F30F, 0xD038B182,
+   0x12DB51D0, 0xB3490FF5, 0x53CA86CC, 0x7A935163,
+   0x2ECD7ECF, 0x0000016F,
+   0xAA283027, 0xBB3CB4DA, 0x4637A686, 0xB3284A11,
+   0x8D4D1678, 0x2F675F37, 0x6BCE4A50, 0x4D2B46FE,
+   0x583AD60D, 0x65E0D06D, 0x525EA4B7, 0xA897D633,
+   0x42BB371C, 0xE2AA9FCC, 0xDD500E47, 0x8F91D296,
+   0x000001BE, 0xAF7965F1, 0xC43C6CFF, 0xA63638DF,
+   0x116C957C, 0xE5A3F8A7, 0x80C1361B, 0xCC9582D3,
+   0xA1F87ABE, 0x2BEF1FF9, 0xD47BC010, 0xF3FE712A,
+   0xDB660935, 0xCC584A15, 0x8CC56DCF, 0xA035F2EF,
+   0x27984274, 0x0000019C,
+   0xB329F7D3, 0x2BB9D8B5, 0x569EBA9B, 0x7E561B23,
+   0x09B7BCA0, 0x65FDAE93, 0xEF327916, 0xF4206737,
+   0x8F7B2113, 0x2963CD69, 0x9CC9532F, 0x3B22A38A,
+   0xB31DEF2F, 0x455C3790, 0x931E5346, 0x9A6CCCD5,
+   0x000000E6, 0x981C49A8, 0xE9860742, 0xDAC58CFB,
+   0xC6BBFFEF, 0x7DCBBFA6, 0xF28CA98C, 0x3E512F79,
+   0x6A53C5D4, 0xFEE0577D, 0x072D38F9, 0x0B2260D2,
+   0x75FC677E, 0x8E97C4B8, 0xE1CE6A18, 0x3D3B1E4A,
+   0x48308DFF, 0x00000109,
+   0x70A75215, 0xCC39400A, 0x7EBE4792, 0xD237B407,
+   0xD20C2507, 0xB2CF5C3B, 0xDAA4C46D, 0xE7B00E11,
+   0x38CEC7A9, 0xA576029D, 0xB05E1375, 0x699005E7,
+   0xF1B051BC, 0xB88D5837, 0x44630F00, 0x054F8ABB,
+   0x00000060, 0xDA2BB0C3, 0xE53A8D17, 0xAE7BDB56,
+   0xCFDD266C, 0xDB11C9B9, 0xD9551CEB, 0x1FC5B3D0,
+   0x1A11AC22, 0xE161A118, 0x63056E13, 0xF76B5E73,
+   0xDFD99567, 0x836F2217, 0x7F5F7283, 0xAC0C57E8,
+   0x8323F67F, 0x0000001A,
+   0xE372D394, 0xA1B0BBC3, 0x8044F021, 0x4EECAECA,
+   0x24C350E7, 0x97636D01, 0x209D0E2D, 0xF1F047EF,
+   0xD12B0758, 0x0F922E78, 0x01A2A08A, 0x8808519A,
+   0x6B5DCC8B, 0x6570AF35, 0xB59CEE8E, 0xEE31EDF8,
+   0x0000003E, 0x9BCDFE17, 0xD467FF1C, 0x2D58B7E4,
+   0xA6FEFFA0, 0x271E5025, 0x3B8F9B17, 0x6C151628,
+   0xBE2D9478, 0x75FA8B04, 0x934CF55F, 0xABF8E3EF,
+   0xD6217D62, 0x9841059A, 0x6F1625CC, 0xED8BF5FC,
+   0x8D4B7142, 0x00000148,
+   0xA7C101BF, 0xD238E451, 0x8A0E4552, 0x0BAD1BD2,
+   0x7E77916B, 0x15EB9142, 0x49EBCC4A, 0x9C8EF516,
+   0xCA085959, 0xF6425C28, 0xC87D4707, 0x498CE242,
+   0xDFBF2093, 0x14B8121E, 0xDC3B4580, 0x338D5AAC,
+   0x000000E9, 0x6177B4EC, 0x886A911F, 0x5A7D1548,
+   0x6D305AB1, 0x75E8BAEA, 0x6EC3BE34, 0x891BDF87,
+   0xCF1CB5A7, 0x6088B030, 0x9AA5F7EC, 0x83288F6B,
+   0xE261EEDF, 0x44678F76, 0x2DB08F64, 0xC1CC7F63,
+   0x8D912DA6, 0x000000E2,
+   0x3E5A6E61, 0xB0356392, 0x73B8D05D, 0xB5E0E278,
+   0xB3078789, 0x53F7D377, 0xC698706F, 0xD56358E1,
+   0x505A1BE5, 0xA2674710, 0xCB650C44, 0xBC1559F4,
+   0x67D11D3E, 0x93361F08, 0x63826B8E, 0xD5D124BA,
+   0x000000D9, 0x1403F021, 0x943EB357, 0xCF992A03,
+   0x80D125B3, 0xD8BAB8CB, 0xB1365FF2, 0x98A1FAE7,
+   0x5EB04904, 0x8004BEAA, 0x4F728E6F, 0x74121D80,
+   0xA4B1DC80, 0xC6B52616, 0xB8B782B3, 0xC3AB4B91,
+   0x844CF275, 0x000001C4,
+   0x4413C3C8, 0xD5F2127B, 0x90C5EE5B, 0x53D19D17,
+   0xBD0B0607, 0xF46A12C4, 0x52F21415, 0x23FF83B8,
+   0x564A2084, 0x345D3CC5, 0xB8128778, 0xDD29DE25,
+   0x511855AF, 0xF22C6930, 0x42541B83, 0xD4A6AF33,
+   0x00000067, 0xC334139F, 0x3FF378AB, 0xC59741E7,
+   0x0D042FA8, 0xF6333E80, 0xCC57395D, 0x46A21BF4,
+   0xD458B571, 0x1B92954C, 0x7B5378F6, 0xA29D48CA,
+   0x0B6A333E, 0x24BD0EFB, 0x83EBFC93, 0x1062509A,
+   0x84A30CEC, 0x000000A4,
+   //Window 17
+   0xE96A67E2, 0xD8720C8A, 0xD54E0F6A, 0xA646ECED,
+   0xCBD31552, 0x3936CE2D, 0xB35268C2, 0x6D44C225,
+   0x6168F13D, 0x56DC0D08, 0xFB2C207F, 0x2B9BBCA1,
+   0xA136C5A4, 0xB4F0DA3A, 0xF8216F89, 0xED2CF79B,
+   0x00000141, 0x7EC6BCEA, 0x1EB0707D, 0xEBE7EED0,
+   0x341B0F22, 0x37333B3E, 0x99C3C50C, 0xDE463E09,
+   0xDCD5FAEB, 0xE481CDD0, 0xE688ED5E, 0x0FEAD808,
+   0x6FC12BD1, 0x29746A50, 0x7B8A4983, 0x829E8D3C,
+   0x2BE1B92F, 0x000000A8,
+   0x8AA3C1AE, 0xF306AD27, 0xFE1271E7, 0x5C833C94,
+   0x11A9B053, 0x5E33DC6B, 0x9CC1B1C8, 0xB28AC1CA,
+   0x92D6A8C9, 0x25BB6417, 0xF9EC9859, 0x2FC86297,
+   0xA31FD92A, 0x752B6170, 0xCBB524EE, 0x3E1F16BA,
+   0x00000008, 0x70A320C1, 0x85AE18CA, 0x6E589BA3,
+   0xCD6BFBA0, 0x7FB13310, 0x576F222B, 0x24C19D99,
+   0xDDC3F6D1, 0x06F1E0A1, 0x697073F9, 0xBDC674E2,
+   0x18C54CEF, 0x7264D610, 0xCC042535, 0x94275C0F,
+   0x66D7986C, 0x00000105,
+   0x170F4332, 0xDF54380D, 0x468B3892, 0x71073E65,
+   0x3D2D8723, 0x299D8E42, 0xB142FE92, 0x2EAC2ED8,
+   0x320BF387, 0xCF54C688, 0x2C6EFF70, 0x450CB1D4,
+   0x84AF19C5, 0x8E7BAD2E, 0x2239A281, 0x9F881DA5,
+   0x000000BF, 0xFA1EC6D4, 0x86063C1E, 0x4CFC2168,
+   0x42B40DFD, 0x6DDEAE23, 0x0AD0C42A, 0xA753EE2F,
+   0xA267039F, 0xC10D2E84, 0x39517320, 0xA4375C0F,
+   0x97219410, 0xA5DED43A, 0x495A7346, 0x8529EB5A,
+   0xBDEAC166, 0x000001D3,
+   0xA87A6B1E, 0x309A2B2A, 0x5C7B14AC, 0x872CB5DE,
+   0x2B0CD791, 0x014EE918, 0x9BBE4382, 0x368CA834,
+   0xD4E89AC5, 0x618B9693, 0x52D7163F, 0xC37A4F47,
+   0xB54FD0A0, 0x78673C50, 0x7042C7D0, 0x98DDC7DA,
+   0x00000030, 0x7C37AB34, 0x70882A78, 0xE779B5F2,
+   0x4D92B068, 0x5EB13B45, 0xD6340623, 0x1A7675E1,
+   0x3EA17559, 0x51B35F48, 0xA77A590E, 0x969C2DD2,
+   0x5A6FFF84, 0x7CDA8AE1, 0xDF5551BC, 0x9C9558AF,
+   0xAB1A48E9, 0x00000040,
+   0x7C632E11, 0x0CB012CE, 0x01CA76F4, 0xD5D3BB8E,
+   0xCF47BF22, 0x5638B2A7, 0x29A047EA, 0xE0AD4077,
+   0x5D0CCEDB, 0xBFB0DB68, 0x5DFA96F0, 0x5A6BA603,
+   0x2511B237, 0x7EBC6F18, 0xB3E29B07, 0x46CD756E,
+   0x000001C7, 0xD7D6F75D, 0xC71D93C6, 0xA3D4A3BD,
+   0xB17A95B5, 0xF2F0AF2F, 0x161EA7E8, 0x715D8D75,
+   0x905AFFF1, 0x722B95AB, 0xD372686B, 0x97445158,
+   0x82559908, 0x134A3BCE, 0xE27AE171, 0x91C2CDAF,
+   0xD662DB42, 0x000001BD,
+   0x186CA485, 0xBDD62240, 0x969FC79F, 0x44359C0B,
+   0xDF9143CB, 0x0C61C4BA, 0x0030322D, 0xEA2415F2,
+   0xAF55E444, 0x15DC87DF, 0xF5A6C58C, 0x8DC2E442,
+   0x5D72A89F, 0xF3C44938, 0x7CC23DD5, 0x61CCFE56,
+   0x000001EA, 0xDC2A9048, 0x86597A8D, 0xC0EED8B2,
+   0x48083469, 0xD1B714A1, 0x678F0740, 0x1157CFFE,
+   0xCE456B1B, 0xA208AD24, 0xE583C03D, 0x50875FA8,
+   0x55BDD6D8, 0xC2964233, 0x84345986, 0x822AEB73,
+   0x58E2225C, 0x00000188,
+   0xA5FC15E2, 0xCFE610FE, 0x33832C64, 0xA550EBEE,
+   0x52311ECD, 0xCAA4268F, 0xA3279F48, 0x6FE68652,
+   0xD800A101, 0x0E873417, 0x6DBF9236, 0x2160D531,
+   0xF78DF67A, 0xC97D8A86, 0x3FF6F74A, 0xD8906ED7,
+   0x000000B0, 0x1FC70059, 0xF9188F3D, 0x579F2FB1,
+   0x74272450, 0xEEC87818, 0x0FD83E66, 0x07B13A40,
+   0xEC0C26FF, 0x65FF4490, 0x0A4CC515, 0x82E04897,
+   0xD3E6C665, 0xA72F5903, 0xDB80F81E, 0x162CC76D,
+   0x1D056E10, 0x00000095,
+   0x11BA52B7, 0x6A434220, 0x03E43CAD, 0xA22752F6,
+   0xE4EE9954, 0x90C6070C, 0xD0848D3E, 0x2C00C5D0,
+   0x50EFE072, 0x2AF5ED1F, 0x45314F92, 0x051FFA10,
+   0xECDA3C0E, 0x197320D1, 0xE4A99B7C, 0x4254FAE7,
+   0x00000096, 0x71B0EECC, 0xC5C0A4A8, 0xDC0482B6,
+   0xCB74EECF, 0xF6493DA8, 0x8AF87D21, 0x61D4EA02,
+   0x85A96DD0, 0x73A6A665, 0xC5A3B3BC, 0x0D1CA607,
+   0x8D43450F, 0x8583DCFA, 0x864F8C48, 0x07CDCE9B,
+   0xA29E868E, 0x000001B2,
+   //Window 18
+   0x5C6F42B0, 0x519A595A, 0xA675ACB4, 0xE39552A9,
+   0x609641A9, 0xC993A489, 0xCB9D6301, 0x1427EB18,
+   0xFE02D86E, 0xEB102DD9, 0xA4C15DDC, 0x86DFC2D5,
+   0xB76F6B2B, 0x0DBFD177, 0xB285289A, 0xEC31EA91,
+   0x000000E2, 0xB85445EB, 0x46ED4B2A, 0xC8124AF3,
+   0xD272162C, 0x675589F1, 0x1B7E446D, 0x9E56E455,
+   0x605B2806, 0xBD0D72EF, 0x39F9B1AB, 0x793F00E5,
+   0x52D79F51, 0x7978077C, 0x28D3E23B, 0x4866C9D8,
+   0x9759E0E6, 0x0000010C,
+   0xA31B8BB9, 0x23C4D719, 0x740F7882, 0x048ABCAC,
+   0x5EE72269, 0xBD895A1C, 0x9077DB96, 0x95595E42,
+   0x49088381, 0xD01E2D4B, 0xF7E50193, 0x48570B7F,
+   0xE6F4ED20, 0xA8830D23, 0x9A45DDB2, 0xBC8AAE5B,
+   0x000000DB, 0x970F294E, 0x527E8FF8, 0x26C1D870,
+   0xD3F0CF50, 0x69AEFA63, 0x255E637C, 0x5BF085B7,
+   0xF332ED10, 0x9520D99A, 0x6A0BBBA6, 0x3BBF6757,
+   0x46F6172C, 0x77664D47, 0x5F0B4E9F, 0x1E6BA9EF,
+   0x5B8C50A1, 0x0000019B,
+   0xBE2D233D, 0x4143662D, 0x37B9C343, 0xDAA51EA9,
+   0xE39801A0, 0xE4543A36, 0xC1319E2E, 0x8F043E35,
+   0x504B47B3, 0x7A0F8DF8, 0xD4D60DAB, 0x0C081EF2,
+   0x99486CD4, 0x710081A8, 0xA36E4207, 0xD2E4EC67,
+   0x00000116, 0x07D56E26, 0x55C7A9FE, 0x037F6067,
+   0xE01C071F, 0x496B19BA, 0x6C4B2BAD, 0xBFF6490D,
+   0xE511CB4E, 0x85868504, 0x0E086C93, 0x2DB3B875,
+   0xAC978ACA, 0x28A8E768, 0xC24E564E, 0x3B1F3412,
+   0xDBA8099B, 0x000000E2,
+   0x430AEE87, 0xDC8418B0, 0xFE56A51A, 0xBD5F89C0,
+   0xC631BEA3, 0x10DB29C4, 0x0C973806, 0xA03FBCBC,
+   0x0AB83B29, 0xACE383AB, 0x5AEC5994, 0x19F1D9BA,
+   0x45CB06A0, 0xF36D16C2, 0xE427EA44, 0xA80A5EF4,
+   0x00000104, 0x67C4BD41, 0x8C77115E, 0x2EDCE105,
+   0xBC0D9D75, 0xE1A157DE, 0xB4D58D35, 0xE85AB91F,
+   0x0564C86B, 0x3CC536FF, 0xD0BDF26D, 0x237657CE,
+   0x4B36E529, 0x5C27949B, 0xD108D7F7, 0xAD81E019,
+   0xCA0DC963, 0x000000D5,
+   0x654F4E39, 0xB89C242A, 0xAC7DF59E, 0x3A242406,
+   0x11CC09B6, 0x351DB3BF, 0xB5CD27DA, 0x337CE2E5,
+   0x941F351A, 0xB911A8C8, 0x4F4C663A, 0x1829610F,
+   0x9ABD904D, 0x8C1E5044, 0xBE384923, 0xB2A4AECB,
+   0x0000007B, 0x485A76B0, 0x20F4B1D2, 0x03D1B899,
+   0x946F7C9F, 0xC4080BE3, 0x7EE2AE32, 0xAE4C9F69,
+   0xD8926FF9, 0x752FFBD4, 0x29DCB8A9, 0x2D627AA0,
+   0xA19B5F86, 0xDBAD059A, 0xF21A0CF6, 0xEAF6E53B,
+   0xF209613A, 0x0000008E,
+   0x986F7001, 0xDB55C6C2, 0x95CB3D1B, 0x67B6C097,
+   0xD2166C0C, 0x8C985426, 0xE1C9BF0D, 0x59026D57,
+   0x71C85698, 0x59A74190, 0x95831354, 0xFD2DC29C,
+   0x43D60779, 0x78A61F5C, 0xB2969EE8, 0x09FBD320,
+   0x000001C2, 0x9295996C, 0xBA429255, 0x15DE5FD1,
+   0x76252A2B, 0x092DCFA6, 0xD2CC5546, 0x6E887EBF,
+   0xE9169238, 0x5FC232C0, 0x4F449512, 0x21B85119,
+   0xD0C857CD, 0x35FD0670, 0x2F36082F, 0xA37CB8F5,
+   0x1BE3D45B, 0x000001BB,
+   0xE105FFC2, 0x64900AB5, 0xD00C2920, 0xB3E0A69F,
+   0xACDC7D5B, 0xFE3A57E0, 0x28A32D2C, 0x50017DE5,
+   0x5BD24047, 0xDBE2BA7E, 0x884E4863, 0x8F337130,
+   0x6B48A2EE, 0x79022D56, 0x0C2F309A, 0xAC5C8A0B,
+   0x00000186, 0x84BFC6C8, 0xAAB8B2CF, 0xC9FE9744,
+   0x50877D98, 0x384D5471, 0xDE69BB18, 0x438C52A3,
+   0xE88EE61E, 0xCCE637EB, 0xA76F2AFC, 0xD56FD7BB,
+   0x75B5620A, 0xD04FBC41, 0x56F3F8F0, 0x023BB654,
+   0x394174BF, 0x0000014B,
+   0x503DC30C, 0x2EDC22F9, 0xA819DE2A, 0x8E15166B,
+   0x0881FF55, 0xDE92A1C9, 0x425BC484, 0x5063C292,
+   0x5894FFDD, 0x7265E0A2, 0xD01AFEAC, 0x29A93E2B,
+   0x4F850B16, 0xB10AAE1E, 0x5BF5F95F, 0xD136E09E,
+   0x000000F3, 0xB292040A, 0xB339031C, 0xC8872FBE,
+   0xE3A653C6, 0xE3B091D0, 0xBBA8B2A4, 0x755F2616,
+   0xDE53DAA4, 0x69FF06F9, 0xCBC9A131, 0x72B153A9,
+   0xD7D107B9, 0xED2593A5, 0xBF3D962E, 0x1EB4063A,
+   0xF9C71C78, 0x00000119,
+   //Window 19
+   0xBDF87653, 0xC6999604, 0xB3F0B8C1, 0x5383B379,
+   0x0BF0435C, 0x98C6AC3D, 0x433C527B, 0x2B04984E,
+   0x02073E7F, 0x5308793C, 0xE1EF3FA7, 0x4897091D,
+   0xBB6B4777, 0x4FEA6F39, 0x472023E1, 0x5AD4C5CC,
+   0x000000E2, 0xE6CD3BA8, 0x0DB5541A, 0x8C0BAC0E,
+   0x5504D521, 0xCFAC5E4C, 0x32F61C5C, 0x8538BD21,
+   0xB8E644B5, 0x51FC9949, 0x8517C72E, 0xAD6F4E8D,
+   0x8D47A70C, 0x17AB479E, 0xB158E063, 0x74F01418,
+   0x8C565F7B, 0x0000002F,
+   0xD62D841E, 0x06642448, 0x4634C737, 0xF9E2A13B,
+   0x2B4C7A52, 0x45475093, 0x0A8A6321, 0x9515EC4C,
+   0xBF231A45, 0xA6309219, 0xDA96C8C4, 0x53BCCB4B,
+   0x9FD870F9, 0x66B59FF4, 0xCCC216E5, 0xAB77154C,
+   0x000000A7, 0x3C6C8DF2, 0xDE749644, 0x7F075E4A,
+   0x11521F6D, 0x7AC5E188, 0xFFE294F5, 0xD39BFB5D,
+   0x839C1880, 0x0492A75C, 0xFA397453, 0x0556FD68,
+   0x68816F47, 0xFEC8B33D, 0x2916C12A, 0x3B2E9498,
+   0x4E6C8F5E, 0x000001B5,
+   0x8800EFD3, 0xC13056A3, 0x9AACBB7F, 0xE543970F,
+   0xB2A97BA6, 0xFEF69B99, 0x966DED77, 0x6F8A3A52,
+   0xC1F0F304, 0x2807AC99, 0x3ADC784C, 0x3C1CC0AD,
+   0x4C449F6F, 0x7BA76BD7, 0x3469AF86, 0x6FF3EEE0,
+   0x00000014, 0x27B59D55, 0x1777DCBF, 0x44C1542C,
+   0xE96E4515, 0x6A04BB53, 0xFA3CCF63, 0x61140902,
+   0x004F2F02, 0xFA5E01FC, 0x19841095, 0x9ED1CCD0,
+   0x6FD9982A, 0x8D61E3A9, 0x2EC23099, 0xE85FC571,
+   0x52B56A73, 0x000001C1,
+   0xF4EC58A1, 0x4DEED00D, 0x1795EDE4, 0x9FED60EE,
+   0x341A7C8F, 0x01DF19D8, 0x0E549D6F, 0x9BF0E893,
+   0x4A0B9086, 0x5312C705, 0xAD529BF8, 0x6FE5A8D6,
+   0x438F4B80, 0x31FF282E, 0xD54CB3DF, 0x37A525BE,
+   0x000001BC, 0x3C80219C, 0xE21E9445, 0x7C04756E,
+   0xF016D163, 0x6E7F689E, 0xBB8C226E, 0x25205289,
+   0x4135716C, 0x9762AFD7, 0xA37C007A, 0xAEE61EA5,
+   0x3097FEEA, 0xA0D84EBA, 0xD51692F2, 0x1CB8AF57,
+   0x724D4A24, 0x00000000,
+   0x67F94F4B, 0xF443FE23, 0x090D955F, 0x3A71A562,
+   0x03E288F0, 0x74577558, 0x9C9AEA0C, 0x00D24644,
+   0xCE9831E4, 0xFDDC8383, 0x17EAB947, 0x6D8116F7,
+   0x6BB8DD5C, 0x0C3CFED1, 0xCEC46675, 0x130C5400,
+   0x000000C9, 0x3DD0AF80, 0x9342D0E0, 0xFF83797A,
+   0xCA058D9E, 0xCB09DD72, 0x97E61F4F, 0x13229500,
+   0x86AFCEF6, 0xC0E979D2, 0x272257E3, 0x5F9B206A,
+   0xD7C9DA68, 0xDDCD5B86, 0xADB7D61A, 0xD9587749,
+   0x528FE73F, 0x00000120,
+   0x0F164D7D, 0x373562D9, 0x1A033488, 0xE609D01D,
+   0xF3A0D906, 0x192695F9, 0x62957195, 0xFFEBC447,
+   0x6A8C7A68, 0x34467C4E, 0x00A3469E, 0x3AC9D6B5,
+   0x612667AD, 0x071F716A, 0xE03620BD, 0x1B1562E5,
+   0x00000120, 0xC4F699A5, 0x23913E9B, 0xB8835ADC,
+   0x563CCA92, 0x52856821, 0x6F97A603, 0x5254D362,
+   0xEB01543A, 0x3CED8D89, 0xE4174BA9, 0x7823B99A,
+   0xD9C758F5, 0x1ED5D09A, 0x499FF35A, 0x508BEB29,
+   0xA7571BA1, 0x000001BD,
+   0x182D44A5, 0x21F00686, 0xD0A69506, 0x473E1A5F,
+   0x67C37E71, 0x1DB395D9, 0x22DBE9FF, 0x6A9AA5C1,
+   0x8BDE2304, 0x279181B2, 0xD298E891, 0x699ACD64,
+   0x7FDDECF8, 0xD2C49503, 0x7EE29731, 0x88230773,
+   0x0000014D, 0xE4594CA6, 0xE9A9D713, 0x08DF0779,
+   0x44FD195A, 0x75B3E30D, 0x27F6D5C2, 0x26244360,
+   0x9D4A8507, 0x3DC7658C, 0x375676BA, 0xF8B43041,
+   0x7F2792CF, 0x166AC32D, 0x6B78529E, 0x4F4B6027,
+   0x68B9ACBE, 0x000001C6,
+   0xE9ABC410, 0x2F122F94, 0xD6FF2B00, 0xC24A6C3E,
+   0x9311A567, 0x5B206651, 0xA37782F7, 0x7E78BECE,
+   0xE973BE5E, 0xCFD7CC54, 0x0B8552C9, 0x8C3A8894,
+   0xFF85222C, 0x10C9B54A, 0x45B33ED3, 0x9CDA9C53,
+   0x00000116, 0xE7434083, 0xF0E67BAF, 0x380F2A0D,
+   0x935294A0, 0xBC68E72A, 0x7FD8E40B, 0xBB9C1479,
+   0xEC4D6238, 0x06D4D2D9, 0x47FBC779, 0x75FD7A91,
+   0xF8E411BB, 0x7D9D537C, 0xBE868E64, 0x7AF52E24,
+   0xAFA164F3, 0x0000017E,
+   //Window 20
+   0x81128A65, 0x620AFF9A, 0xD6A9D2C1, 0xA463FFE7,
+   0xDD4810EF, 0x2206277A, 0xDD0687CA, 0x413EDD73,
+   0x249CEF0A, 0xF4B12EC9, 0xC4B165CF, 0x14DD6665,
+   0xC5C070C3, 0x0CF86A23, 0x84755F2C, 0x42354FE9,
+   0x00000131, 0x2E9C881E, 0x6F4741DF, 0x43F26343,
+   0x2656911D, 0x1C82E8E5, 0xEBAE8AE4, 0xF3900776,
+   0xCEB1CA37, 0x16721332, 0x07F2F8FE, 0xAAD4911B,
+   0x59265673, 0xFC3BDA3F, 0xE8799EAB, 0xFD073355,
+   0x55805723, 0x00000088,
+   0xD7C3E500, 0x79B40005, 0xA7CBE47D, 0x99957461,
+   0x53A81EEB, 0x1DBA911D, 0x54CAC621, 0x50049C2A,
+   0x5C8458C0, 0xC3052CE6, 0x5CD9822E, 0xD4E4CC28,
+   0x9C89113B, 0xA64BD2BA, 0x24A9A360, 0x616F47F3,
+   0x00000000, 0x36BB95E6, 0xB309B385, 0xEEB3AF75,
+   0xF7808DA5, 0xFFEF855A, 0xC9EB3A68, 0xDA981F49,
+   0x0D7C5382, 0x5A29FE14, 0x2176630E, 0x4B6DD847,
+   0x7C59C56F, 0x15C998CD, 0x363FC081, 0x1C0E00D7,
+   0x28B9018E, 0x0000009C,
+   0x96F52213, 0xF02EBE95, 0x62F9F1E9, 0x2ABA2DFC,
+   0x934EF9F0, 0x7BBDDE57, 0xA417AF58, 0xD5C7882E,
+   0xDCDF7815, 0x55CDFE89, 0x8470A435, 0xF79051B1,
+   0x7E8593E8, 0x364DA0AA, 0x975A5F81, 0x02C3D160,
+   0x00000034, 0xCCD37734, 0x59493183, 0xE645E991,
+   0x085A8CD2, 0x8C4B4A86, 0x2D54D266, 0x7B4079BE,
+   0x96CF84CF, 0xBA683F56, 0x4ABADE40, 0xB5457B07,
+   0xFB29C00B, 0x92AE7F9B, 0x6ED5FD35, 0xB5A9D039,
+   0xB1F1A25F, 0x000000CA,
+   0xD326FFB6, 0x8ACD524B, 0x9E731029, 0x4A1091A3,
+   0x600D299A, 0xB056D998, 0xB78EBF7F, 0xFB695C26,
+   0x73CC7F48, 0x2B83E30C, 0x4BCB6645, 0xF2364E61,
+   0x837638C3, 0x6A707650, 0x21528A26, 0x6D1652BF,
+   0x00000034, 0x6D2B8FC3, 0x353DC81F, 0x8627A2E4,
+   0xFD300391, 0x1179264C, 0x5F7C2565, 0xAF46D535,
+   0x69856301, 0x16F35CBC, 0xDFCD6CBD, 0x4FE07645,
+   0x5D2268FB, 0x29CAC6AA, 0x2CA719DD, 0x8CBE9556,
+   0x9F8FCB72, 0x0000017C,
+   0xB4A6D22F, 0x8A5910C8, 0x01DB212C, 0xEE6879FD,
+   0xA0E6A5AE, 0x04FF66A7, 0x87C876AF, 0x6737374D,
+   0x06CB6101, 0xB47BC055, 0xBD24735E, 0x3A866F58,
+   0x9B0FAC30, 0xFCE48FD4, 0x8BD9C8A3, 0xA16C6F23,
+   0x0000013F, 0xFCEBF61B, 0x850462F4, 0x2974B82A,
+   0x8882CCB9, 0x43A1FFBE, 0xC738BB8A, 0xBC5C6E1E,
+   0x3C72FEE9, 0x6ADD3DB8, 0xC7D2B392, 0x3C68C927,
+   0x40310C19, 0xF15AE272, 0x1E648CD4, 0xF9682658,
+   0x6833F30A, 0x000001ED,
+   0xB4C31532, 0x85F7EE8D, 0x4F57340C, 0x7901AE50,
+   0x80549596, 0xFFC73749, 0x3470B849, 0xF63F2BBA,
+   0xC9122303, 0xAF19609F, 0xA29C6CFD, 0x07132084,
+   0x455BE025, 0xC48B9250, 0xC32B5F9A, 0x7F90302F,
+   0x0000006F, 0xBD5630D0, 0xE29725D5, 0x29A9B14C,
+   0x69940503, 0x34B4D9D8, 0x5416C35E, 0xE6C07431,
+   0xD96CF843, 0xCB8DDFAA, 0xBE80A73C, 0xF3FE2EC9,
+   0x36ED3535, 0x757728DC, 0x9877AC66, 0xC97EAFAE,
+   0x9BD30B6E, 0x0000008C,
+   0x8816F67E, 0x25D66392, 0x155F51F1, 0xB8AC3F18,
+   0x97186B84, 0xEE0A41D7, 0x7D29A424, 0xB82D67CC,
+   0x051AA4DA, 0xBC854839, 0xFFF27537, 0xF57CA395,
+   0x0A372456, 0xF9A57389, 0x44FC0153, 0x28113682,
+   0x00000018, 0xB5034049, 0x2B7ED9D7, 0xD0BA814D,
+   0x8862EDBD, 0xFE0CE2ED, 0x0DC79FF3, 0x00C1E102,
+   0xC36542FD, 0xC466C099, 0xA3DB194F, 0x4C5A7303,
+   0xEF6A357F, 0x25953C8F, 0x73486E85, 0xCFFB7522,
+   0x2BD15CC1, 0x00000191,
+   0x4583594B, 0x9F3783EC, 0xD5E8CAF9, 0x0E4D8677,
+   0x19AF1B4D, 0x20722320, 0xC38A2455, 0x64407857,
+   0x8CCE0710, 0x085B9750, 0x0375237E, 0x46A41226,
+   0x0DDB3D50, 0x5DEA15F8, 0xE7A9ABC3, 0x821A7009,
+   0x00000099, 0x40071A8F, 0x4CC63AAB, 0xE92C8D30,
+   0xAA95B0DD, 0xC88AC5D1, 0x01FDFEA6, 0x706B4144,
+   0x881162EE, 0x8141C4B8, 0x33558F6D, 0x475C5E63,
+   0x58B46C5A, 0x7B02E29E, 0x59652DBF, 0xA0B99199,
+   0xE1F3C54E, 0x00000082,
+   //Window 21
+   0x5338E99E, 0x541BDD79, 0x2656702D, 0x2753B15C,
+   0xA7F6AF6E, 0x360263F1, 0x02ADC827, 0x42C97787,
+   0x27ABFF88, 0xB4B4A665, 0x4A9A1CE9, 0x1F9DFE51,
+   0x48CEB12E, 0xF1FA56AC, 0x6D0B967D, 0xF0E55A36,
+   0x00000116, 0x49642F41, 0x7ED35BC3, 0x22EE3354,
+   0x69C8BC46, 0x1911836F, 0x52846623, 0xBF4B87E2,
+   0xDB193BAF, 0x4209F1E3, 0x427FF5F4, 0xDAE27044,
+   0x4152FD13, 0xA1F0AE7D, 0x3B73F059, 0x6F1503E1,
+   0x621ACE50, 0x00000196,
+   0x83625A05, 0x72C5CF1E, 0xD0B73C77, 0xB04221EF,
+   0xDCD8527B, 0x52DE6BDD, 0xD491416E, 0x73E03488,
+   0x30E7B551, 0xCFEFB1B1, 0x813A17FA, 0x872C5B20,
+   0x685A3923, 0x75F43FB9, 0x6960BCD8, 0xF057CAE6,
+   0x00000119, 0x54BECB7E, 0x84E8D679, 0x3AFDB96C,
+   0x47D5E5DA, 0x04476ED9, 0xF0B5D59B, 0x4C2984A8,
+   0xB2D7DAEE, 0x986271E7, 0x07FC2E0E, 0xB3300786,
+   0xA9895F88, 0x53A88830, 0x8F8FCD5A, 0x452D1A5E,
+   0xE9446200, 0x00000181,
+   0x5CE20879, 0xF2172430, 0x02995C9B, 0xD48233B6,
+   0xD39D6149, 0x5DA336E0, 0x1A37DF28, 0xC516D013,
+   0x2B3FE1C0, 0xA7098D96, 0x6A3099B8, 0x65CEE9A9,
+   0x320323A0, 0xD1DF9D2E, 0xCFAD65D8, 0xB1C49334,
+   0x00000024, 0x902DD9F8, 0x3BBC258E, 0x0E9CE909,
+   0x13861A7C, 0x0F7C4AB6, 0x0F0497F5, 0xDDC4A4CA,
+   0xEF96A255, 0x14A185DD, 0x4655FD64, 0x91345882,
+   0xA9839154, 0x6695B74A, 0x96C03926, 0x481DA372,
+   0xD88DB243, 0x000000D0,
+   0x05E31F06, 0x85E007A1, 0xFDCAFFD8, 0x8B43C7DE,
+   0x7E4AB187, 0x53D13F27, 0x4D4E71E1, 0xF7D22A39,
+   0x8D0A8B1D, 0xF1DAECF8, 0x90C409CD, 0xE51E2F3A,
+   0x46D43496, 0xB84B6E0B, 0xF5E87710, 0xB70B148E,
+   0x0000017D, 0xE45E1097, 0xFDCD92B7, 0x95DA5EF1,
+   0x6C5FA062, 0x7BAC30EE, 0xD2FA00BB, 0xF49D2088,
+   0xAADA82E4, 0x56827BA3, 0xF8C4FC0F, 0x207C79AC,
+   0x04EF216B, 0x38449D34, 0x3A3A6851, 0x91900CE7,
+   0xF0AD4B51, 0x000001AA,
+   0xE9CD61E9, 0xA14396D3, 0x037DC92F, 0xE5B79EEC,
+   0x0156582F, 0x88217B17, 0x1F70551F, 0xEDC45747,
+   0x32D048D9, 0x60BE827F, 0xDB6B91B0, 0x2FE4C45E,
+   0xBA4DC597, 0x8BC71163, 0x936E1F8A, 0xE3FC3791,
+   0x0000002F, 0x0139F399, 0x8DFC5EC3, 0x7334F267,
+   0xC93F2271, 0xA10066DC, 0x9B8D510D, 0xB7C157A9,
+   0x8A9D400A, 0x3AD20222, 0x5E83D95D, 0x483DB80D,
+   0x2E244DA8, 0x97E427CC, 0xD434F50E, 0x73195F8D,
+   0x0C98D8FE, 0x00000014,
+   0xAD9570B9, 0x573811F6, 0x6CA614D7, 0xBAF2EC12,
+   0xB735CB79, 0x6F4A9A0B, 0x6F9AFFB6, 0x850E4B73,
+   0x3B760AC1, 0xE399DFB4, 0x5CEE0611, 0xA7759B8E,
+   0x0722DE06, 0x58D84AE6, 0x83DBB9FE, 0x5AB2ED54,
+   0x00000148, 0xDF14F9E9, 0x98C24006, 0x0AD7BD90,
+   0xBBD0130F, 0xC3C91B77, 0xEE55B08D, 0x4F6934D7,
+   0x16A18D95, 0x2DEED126, 0x5F191A31, 0x84897D4B,
+   0x776BCD32, 0x7B0CD708, 0x83B4D25B, 0xD9F50BEA,
+   0x6E6AA60C, 0x00000181,
+   0xD225D7C4, 0xE82B6739, 0x0E8B47DA, 0xC69D44EC,
+   0xD69237A8, 0xD842C960, 0xD24A796E, 0x6ED0097A,
+   0x030E4149, 0xEF96B040, 0x212E51D1, 0x55C049AC,
+   0x0C44BB8B, 0xCCE35F17, 0x71C94884, 0xBFD67F29,
+   0x00000196, 0x4755C1C8, 0xF02B65DF, 0xA8144225,
+   0x3330FF77, 0xA39FB2B9, 0xB4D9365A, 0x95C66174,
+   0xD5D31CF2, 0xECC0CA46, 0x7597FD7D, 0xE11870A1,
+   0xE7565E2C, 0xA36C5100, 0xC709BC5D, 0x639F0A7C,
+   0x4D319121, 0x00000144,
+   0x7FCC0C7E, 0x83994E55, 0x1C37F01E, 0x88785663,
+   0x9F196624, 0x88A9A567, 0x5B3FC857, 0xCD828DF2,
+   0x581344F9, 0x470F8623, 0x768E83A8, 0x85CF12A6,
+   0x9718A861, 0x5D11327B, 0x6E713452, 0x9A1045D7,
+   0x000001C5, 0x711F46B1, 0xD4C452E4, 0x12FD1E23,
+   0xDC41B91E, 0x31AA874F, 0x845897E4, 0x8CD6171B,
+   0xCF51CD7E, 0x4F183E74, 0x1825BD25, 0xB5DA3216,
+   0x361A0E53, 0x601E0405, 0x16349308, 0xF094F144,
+   0xE3A40682, 0x00000187,
+   //Window 22
+   0x7B602085, 0xF762EAF7, 0x2D470147, 0x3B6E6233,
+   0xD3CCA3E7, 0xE1028D76, 0xCCF39BE7, 0xF3616DD8,
+   0x08E8F10C, 0xA35C4CC1, 0x7CB4B321, 0xC413DB10,
+   0xC3249F4B, 0xEAB81774, 0xBE83BC78, 0x3E7BDEA7,
+   0x00000134, 0x9D38D508, 0x86999F15, 0xFB204D42,
+   0x0C9A990A, 0xCB616F5B, 0x27C4421D, 0x46AE31EC,
+   0x2CB6590D, 0x309ACF22, 0x1A33F6AB, 0x80320210,
+   0x13D99E2A, 0x341D1667, 0xA13731B3, 0x4BFCC116,
+   0x7E0BAEBA, 0x000001F0,
+   0xD78FD6F6, 0x8F345BC8, 0xBC603416, 0x35446BE7,
+   0x92954E8F, 0x22A05FC3, 0xDE517CA3, 0xCD51695B,
+   0xC30B42E4, 0xD452C3C1, 0x385847BB, 0x71F0BE42,
+   0xFA66294B, 0x3E5604DA, 0x91EFA7AB, 0xA32470C7,
+   0x000000F7, 0x247C00DC, 0xBE46E43F, 0x4FA716E2,
+   0xA464EE49, 0x81328C41, 0xF16522FA, 0x187556CC,
+   0x495048B6, 0xC1682E5F, 0x71224071, 0xB9F18963,
+   0x5E33DEDF, 0x99A767D5, 0xFCE493C9, 0x6FFA81F2,
+   0xC7F53C56, 0x000000CA,
+   0xB7CF116D, 0x6FAA299A, 0x04FA5EAB, 0x29A0B9E7,
+   0x0147F1EB, 0x7301A289, 0xD6B2D599, 0x5A3C9E3E,
+   0x2D003F89, 0x63CFBA60, 0x6A13199E, 0x720B2F88,
+   0x8D785CC3, 0x57C483C7, 0x8DAB1162, 0x90E8785A,
+   0x00000147, 0x026BF788, 0x2C15DE82, 0x45C46443,
+   0xF542838F, 0x7FA94A27, 0xF8DEAD3C, 0xE287406A,
+   0x9587D5BF, 0x8DEC97FE, 0xB3EC2E82, 0xF34AA0D8,
+   0x08BC1827, 0xBDAF6B7D, 0x8E43DDF0, 0x6CFA1BD6,
+   0x38B99520, 0x0000002E,
+   0x8FF76030, 0x9965FF97, 0x09623254, 0x3803BE92,
+   0xE736FEAE, 0xF9006BED, 0x81EE80E2, 0xEBE94E4B,
+   0xF084F95E, 0x866AEB63, 0xAF245249, 0x0B44F9DF,
+   0x87F238CE, 0x9AD6AD29, 0xFBBE2900, 0xF4E2E01A,
+   0x000001A8, 0x656E4935, 0xC22A67A3, 0x2D8C32A4,
+   0xF9AA8ED5, 0xF3F515B6, 0x98BE32D0, 0xAE72CC29,
+   0xB8714B6A, 0x0BBD1D01, 0x1B687423, 0x61121BC7,
+   0x55674913, 0x9FC2DCD5, 0x156020CD, 0x8FD34058,
+   0xA230E1D8, 0x00000159,
+   0x3CD2D894, 0xD3986691, 0xF4ACD257, 0xB3C1245E,
+   0xF2A6EB4D, 0xE94F4FC8, 0xA24AAC36, 0xE5314682,
+   0x9D6D19B3, 0x1A8B4953, 0x62B2E879, 0x92EE6C6D,
+   0x9D84DA63, 0xCBE03DB3, 0x1EEF03C6, 0x5A937F67,
+   0x0000008D, 0xA8AFCC43, 0x01476022, 0x5BA321C7,
+   0x39AFCC5B, 0x35555C22, 0x28346402, 0x90447AFA,
+   0x7451D9D5, 0xFA67FE12, 0xAD2A529B, 0x02959C1E,
+   0x115B2FC4, 0xCA31DA20, 0x327C1F37, 0xB662ADF1,
+   0x7BE14866, 0x00000024,
+   0xF74A2534, 0x990B6C5E, 0x80259B31, 0x3F11B39F,
+   0x72031AA7, 0xF30D2177, 0x66CD4A2F, 0xA3122825,
+   0xA2A0835E, 0x67127FCE, 0xCBAB8489, 0x285AC417,
+   0xC8048752, 0x138CAF3B, 0x168C129D, 0x3F8DDC6B,
+   0x00000005, 0x37D70DDA, 0xB3D9AC28, 0xD9F20D9A,
+   0xA8BD293A, 0xCBFC1540, 0x39A064AE, 0xFF06B530,
+   0xCB1C84F5, 0x7415FBD8, 0x6A5E3BD7, 0xF235D2EE,
+   0x838452CB, 0xFA569AEB, 0xE741A7B0, 0xE11C94A6,
+   0xF5941AFD, 0x000000B7,
+   0x19C2C216, 0xDCA9AD5D, 0xA30D703B, 0xEE8659E4,
+   0x793D76B3, 0xF816AE02, 0x90047E41, 0xD4271B4A,
+   0x94965AB2, 0x7BCEE1B8, 0x2EE477F9, 0x44861F55,
+   0x99A6EFBC, 0x6D14B1F7, 0x2EBEE7C7, 0x2F70AA14,
+   0x00000095, 0xF7A0CAB7, 0xB610B9EE, 0x1A61D626,
+   0x3FE828F2, 0x35FD2A05, 0xDEB33557, 0xFCB4EB86,
+   0xBF798CDB, 0x567A78DF, 0x568985E2, 0x95AB33C4,
+   0x0B59FE5E, 0xCCA04237, 0x84562B5A, 0x783A7813,
+   0x621951DB, 0x000001D2,
+   0xED4564E4, 0x7B7CC207, 0xD39B26E7, 0xC2D36366,
+   0x68C54252, 0x69DF15E9, 0x5FB39A7D, 0x85BAA82E,
+   0x3CD85DD4, 0xB447933D, 0xA5DC4F0B, 0x7DF00AF7,
+   0xBDA97B12, 0xDE98E4B9, 0x70F52989, 0xD2EDC5E5,
+   0x0000005E, 0x5AFE72D8, 0xF9A3FDA5, 0x8A9DB145,
+   0x6312B53D, 0xBEAA04DB, 0xE275B397, 0xB2C9399A,
+   0xF070C6A1, 0xF3F47A0C, 0x04D5846A, 0x676AD519,
+   0x15D8894E, 0xC4CF2481, 0xE393377B, 0x11FC7C2B,
+   0x54A9A680, 0x00000077,
+   //Window 23
+   0xA2ABB00E, 0x2D2F9E08, 0x17648C6A, 0x4C8C679D,
+   0xB8520197, 0x52E2E9BA, 0xE0898E48, 0x7470A3CF,
+   0x90617E18, 0xBFEB2A91, 0xF44DE1A6, 0x247EA702,
+   0x7B1604FB, 0x7BAF95B2, 0x020C5856, 0xE9E81B78,
+   0x00000159, 0xDA533799, 0xDEB81330, 0x3996B5BE,
+   0xDC4DE9F1, 0xD33F04B5, 0x6A8B7630, 0x2BCCAD83,
+   0xA4554ACB, 0x2A7F5D61, 0x7974BD47, 0xB01696D5,
+   0xC481A752, 0x8CA48DA9, 0x6DFBEFDE, 0xE7DB0C27,
+   0x2FDA492F, 0x00000053,
+   0xE435A290, 0x1F6FAD01, 0xA1797BBC, 0x2233FB1C,
+   0xADEC0E98, 0xE5C86B07, 0x2C38F3F3, 0xA6C3E3B3,
+   0xBE4D76EC, 0x148C7CC4, 0x8F91B601, 0x9A269E56,
+   0x1872EF0F, 0xDD4FDE65, 0x8AA5366D, 0xAC81696C,
+   0x00000123, 0xC06DF67A, 0xDD10F5BF, 0xB5E3D640,
+   0xE02F88CF, 0xB63366E5, 0x67533DEF, 0xD4F7515A,
+   0xB81B500D, 0x7AC6FDEA, 0x25804829, 0x0C92E736,
+   0x05E776B3, 0xFDDA7BA5, 0xD366E4AB, 0x38A7D99C,
+   0x1C88E253, 0x00000199,
+   0x3699E35F, 0x8980DF2D, 0x7FEE846F, 0x9116DDBE,
+   0xFA3D46B8, 0xE8E6E54E, 0xB65BC109, 0xB6C3996E,
+   0xEFFAEE6C, 0xE549C8EA, 0x31410DEB, 0x9553BB7B,
+   0xA660056E, 0x3900D1CC, 0x15F7DBF7, 0xEA4C30EF,
+   0x0000018D, 0x1B976FC5, 0x0BF375E1, 0x17E1CBE9,
+   0xBFA9C680, 0xA7478FF3, 0xD9C860A1, 0x69E4E8E5,
+   0x34125622, 0xE1FF1512, 0x0E98341C, 0x76EB4630,
+   0xD320C6FE, 0x1EA3E4A9, 0xA06CEC28, 0x8EF84307,
+   0xBB00B6A0, 0x000000DE,
+   0x246BC98D, 0xC184AF99, 0xE0904D25, 0xAE516351,
+   0xA4FA486A, 0xDA6CC6C8, 0x33DD0F0A, 0xFC9EF8FE,
+   0xAFD708FB, 0x8981F399, 0x2A22F104, 0x65530203,
+   0x890718A9, 0x5A8D2895, 0x8C71713A, 0x7F48DDF8,
+   0x000001F0, 0x69A4FBFF, 0x2E16FAC7, 0xC3ABF535,
+   0x1EF4FF56, 0x3AEE6084, 0x8F332C08, 0x2B2EF3E8,
+   0x312A0198, 0x5BA34302, 0xB5303668, 0x0F62A886,
+   0x72871619, 0xFCB4C8BF, 0x9F6FF887, 0xC3743566,
+   0xA86874A9, 0x00000180,
+   0x65DAD623, 0xA810227E, 0x24662210, 0x01FCDA56,
+   0xA9154721, 0xE8543511, 0xE47AEEC9, 0x2914E67C,
+   0x45A2AEC8, 0x85243B16, 0x4DB1DCCC, 0x1055599C,
+   0x3D1EE37A, 0xD8C2E07A, 0x91FF64F6, 0xB2407486,
+   0x000000E3, 0xC47AD646, 0x89D53742, 0x21D95CC6,
+   0x887493ED, 0x252A6EFF, 0x9EC6E14C, 0xB7C7AF4D,
+   0xDEAA3EED, 0xDC2BE798, 0x0B5CEB7C, 0xE8559739,
+   0x95F753C3, 0xA188513C, 0x3CA3A7C8, 0xDB1CCC8C,
+   0x4F9912CF, 0x00000085,
+   0xB203D524, 0x2BFA1554, 0x64DAFB80, 0xC6D86D8C,
+   0x3EE93E42, 0x26807C02, 0xDE86DC52, 0xA384B2F0,
+   0x5725DF01, 0xC5816A9F, 0x58FBAAE1, 0x89BBAEC7,
+   0x0957C4AC, 0x2F452EB6, 0x913C1A72, 0x119F0291,
+   0x00000121, 0x2EF523F1, 0xF173DF1D, 0x5C934CD7,
+   0xF7491B47, 0x965C47E2, 0x83698BA3, 0x287406C3,
+   0x7C88C285, 0xF3D293E3, 0x241E36FF, 0x8F6A23AF,
+   0x43C72879, 0xFB1ED946, 0x0F6571EA, 0x5514FD3C,
+   0x5A627FEC, 0x000000F4,
+   0xF6B1AB74, 0xFBA33000, 0x0C96EEBF, 0xA9E1F2F5,
+   0x5C33000F, 0xE84F0EDA, 0x153679C1, 0x33789A12,
+   0x89209EE2, 0xDA4629F5, 0x0E22FE7B, 0xCE3785B2,
+   0x6F0C0EC3, 0x53183B46, 0x5285B4BC, 0x6FE1779E,
+   0x00000056, 0xA5D768D3, 0x1EAF8ECC, 0x10C1561A,
+   0x224EE373, 0xFC7AF9F7, 0x519298E8, 0x4AF7C25C,
+   0xCDCA2563, 0xD862BFEF, 0xF4096CB4, 0xF5223CBC,
+   0xD49B6F4F, 0x1AC83C79, 0x678D2E9F, 0x8F1DDC04,
+   0xAADF01B7, 0x000001F6,
+   0x00EF2A72, 0x3BB43BEB, 0x8A65BED6, 0x0EA2EE34,
+   0x25CF2864, 0x4A07C01A, 0xDEF2D374, 0x81F50428,
+   0x31D5CE65, 0xB5B902F7, 0x478326B1, 0x740F1CE1,
+   0x6905C052, 0xAF7A2560, 0x1FC70939, 0x4E6E4F6E,
+   0x0000008B, 0xB1EDAA65, 0xC32EF5C1, 0x28E6D983,
+   0xF0AB55AC, 0x708ACEB7, 0x954900D5, 0x3A326BAF,
+   0xEFD9F5C1, 0xBE1C4709, 0x05FD87D8, 0x7B6CAE96,
+   0xA40702B1, 0x65344D33, 0x9263A192, 0x576F073D,
+   0x141DBC82, 0x0000001B,
+   //Window 24
+   0x2FEDA8AC, 0x336B0622, 0x0C0B391C, 0x4658AE22,
+   0x1F2119D0, 0xE12F058F, 0x495525A1, 0xA1F96C94,
+   0xCD7D9F17, 0x32EFC7AE, 0xBEA7A5EB, 0x34E4FE2A,
+   0x7135C5F5, 0x0EFD2492, 0xB83241FF, 0xD7A04EB2,
+   0x00000036, 0x9CA40933, 0xF11B8E76, 0xD06857C8,
+   0x1951CD54, 0x29F13914, 0x0E9124F6, 0x3D67D0CD,
+   0xE6EBBBE3, 0xBF16F9C2, 0x5483A2BC, 0x255EA8CA,
+   0xD4E4EA52, 0x734EEF50, 0xEE0DB0B5, 0x16207775,
+   0x54434B51, 0x00000017,
+   0x7B1A7381, 0x44D1DCB6, 0x541488C5, 0x88AF97D4,
+   0xE065E612, 0x6D9DFF01, 0x20E73756, 0x61FBE70F,
+   0x41379C43, 0x493B9080, 0x8391C070, 0x7D969BE1,
+   0x8A3B0242, 0x04BC1AE1, 0x946C7856, 0x417D5158,
+   0x000000EA, 0x17F7E492, 0x45F996F3, 0x0704EFEC,
+   0xB2904E51, 0x7CB6CF84, 0x0F89BAB9, 0x98E07858,
+   0x32A4D458, 0xA1BE9838, 0x7202EFB9, 0x4E8743DA,
+   0x98A4E8AF, 0x657D4C74, 0x605CF158, 0x7E0EBA38,
+   0xCCB12E26, 0x000000EE,
+   0x97FAABFF, 0x3875C2C9, 0x0A8A8A3E, 0x7D2E0B15,
+   0xE5C00FA1, 0x1E9892E4, 0x8271DA55, 0xFDAE6C4A,
+   0xD0C98F92, 0xBEA2C42B, 0x49F83707, 0x229FB76C,
+   0x062755E8, 0xFE084798, 0xDBD4F518, 0x5D5D514D,
+   0x000001E9, 0xE9EB3349, 0x7037FC7C, 0xA3F25B16,
+   0x80D2AC4B, 0x4B46B33C, 0x37BEBC0D, 0xF5ECE30D,
+   0x90DEC4B5, 0x98259B5D, 0xA3AE4977, 0xEA2D121B,
+   0xC60C07B4, 0x36D24A42, 0x2B431681, 0xDB64A83E,
+   0xDAAF2349, 0x000001B5,
+   0x47C3D608, 0x19911D13, 0x258CE1C1, 0x267573DA,
+   0x5D563B12, 0xB378183F, 0x84A1EC2B, 0x2A09AC78,
+   0x991D1F10, 0x5AC59A10, 0xEDB7CA7D, 0x9F58D55E,
+   0x7E3B9893, 0xFD41710B, 0x2D7F8E00, 0x4572D510,
+   0x0000015E, 0x706B8E8E, 0xD25F4424, 0x75653D00,
+   0xF38550CF, 0xD9940106, 0xCB55F785, 0xB52EF320,
+   0xC0BA5C65, 0x3777F7B4, 0x86450684, 0x85C22A24,
+   0x24D73B7B, 0xF53B1338, 0xC7F1AC86, 0x454E8CF9,
+   0x8D4BF141, 0x0000011C,
+   0xF33078D3, 0x4BA7EECE, 0xE4938E69, 0x6C19514E,
+   0x7AAAC94F, 0x422C6428, 0x77A45CA7, 0x5E405A9F,
+   0x00149BC9, 0x73387BB7, 0xE0AD22F7, 0x880C443D,
+   0xC124E4A0, 0x7A15A5D8, 0x10B468DA, 0x0920DFA3,
+   0x00000103, 0x5960A977, 0x0140A29D, 0xDF578F84,
+   0x69DBF269, 0xD3E33800, 0x3D58EB2C, 0x55C6D2ED,
+   0xD56A3CA3, 0xF9ECD035, 0x326DE33A, 0xF5E37117,
+   0xC2480B6D, 0xA120B6C0, 0xDE82D31B, 0x9A02AF7F,
+   0x6F2546EE, 0x000000C1,
+   0x6FCA44EC, 0xFA8F5084, 0x2DBD4DF1, 0x82B84B2E,
+   0x113F4102, 0x47615AB1, 0xF6953467, 0x79BB98C6,
+   0xFD265C98, 0x6893F29D, 0x8272830F, 0x9091A93D,
+   0x68F8DEC8, 0xB1C7314D, 0xDB629F3C, 0x2303534F,
+   0x0000003B, 0xE76E6FC7, 0x5CAFC9F5, 0x84C48EBE,
+   0x84947B7F, 0xF89F075F, 0xD37D1697, 0x05EA2481,
+   0xA7062CA0, 0x1FDF1E3A, 0xD4BF3D68, 0x434D4F8E,
+   0x75540953, 0x1274DC40, 0xCC2F2E9A, 0xF3392828,
+   0x589A00D5, 0x00000152,
+   0x25D36425, 0x777FC8AA, 0x89182FC4, 0x31604210,
+   0x974B40F1, 0xE191069D, 0xD8F73D7A, 0x97F4BD35,
+   0x0038A2A4, 0x95B9AAA1, 0x891DD290, 0x63FE962A,
+   0x4DE72191, 0xF305637F, 0xBE47E84C, 0x90C19709,
+   0x00000140, 0x847F0EA6, 0x0F5B6B27, 0xD98337DD,
+   0xD4BBBFB6, 0x72E7127F, 0xD95BEF53, 0x7B3C4604,
+   0xB873153B, 0xCFCD81E3, 0x9B1E02EE, 0x7CD9025F,
+   0x905E18F9, 0xF7C4AE62, 0x34E22797, 0xE1C201A0,
+   0xFDB364ED, 0x000001C6,
+   0x4AC5D687, 0xE3ECC629, 0x8094FF61, 0x330D122F,
+   0x6DFDD426, 0x90F66325, 0x666A6583, 0x63312050,
+   0xDAE067F7, 0x1288267B, 0xC98968BB, 0x5F1BBE73,
+   0xAC22EF5B, 0xE97DA1C2, 0x4B555B16, 0x650C7740,
+   0x000001AD, 0x74CC55C5, 0x5BEE242B, 0x00B29CE1,
+   0xAA4FDD83, 0xA2BD841B, 0xD7AAEF3B, 0x81E8601F,
+   0x12A87826, 0x004ED2D2, 0x0CCFB765, 0xA27EAA02,
+   0xA220BB04, 0xEE67F4CE, 0x4FDF3B5B, 0xEA5130D1,
+   0xB5436654, 0x000001A6,
+   //Window 25
+   0xC7734385, 0x067F879F, 0xB4A51794, 0x787C7F18,
+   0x72D9AF69, 0xA269C446, 0x87D71897, 0xA4498E73,
+   0xA91814AC, 0x28E3D84A, 0xF62FEDE0, 0x8CAF2F61,
+   0x5DC202BF, 0xAD36DA31, 0xA4689189, 0xFED8BC0F,
+   0x00000068, 0x96AA1400, 0x84A08542, 0xCD72B4A4,
+   0x871885F1, 0xE9D3027E, 0x00954202, 0x5C86A302,
+   0x19B35069, 0x6CFC52A2, 0xBE420B63, 0x87175B19,
+   0x8B752282, 0x9A22611D, 0xD1811B8C, 0x3E468601,
+   0xF9C23D80, 0x000001D2,
+   0xE402D747, 0x13996F30, 0xEBC31A51, 0x2524A83B,
+   0x95D7EBC0, 0xA41699B7, 0xAD867499, 0x602112C7,
+   0xD43B5A3E, 0xBF81B788, 0x1C736CEA, 0xF3CD2858,
+   0x0FF424DD, 0x01A6DF58, 0x95500BAA, 0x6E527DAA,
+   0x00000171, 0xD1B77FF2, 0x1D966ECB, 0x23985BD7,
+   0x2980D1C9, 0x35732BA6, 0x20A275A6, 0x430369D0,
+   0xA1B81F99, 0x3C0A4D36, 0x6052B018, 0x8A790B12,
+   0xB4FA4D6C, 0x353165BC, 0xF4EE3079, 0x7ED670DE,
+   0x79EF4679, 0x0000002D,
+   0x62C16459, 0x9886A229, 0xE5AA41C7, 0x0E0236AF,
+   0x61FEF10E, 0x468D4C3A, 0x3DB4D163, 0x8C3171AD,
+   0x1022BF50, 0xEA418080, 0xDD95500D, 0x29C61BFD,
+   0xFC1086D4, 0x79073998, 0xD880BED1, 0x18E62735,
+   0x0000008D, 0xBAB5ED67, 0x3772A3A6, 0xC4A82BE5,
+   0x59AEAA70, 0x3FA10EAA, 0xDEFD1569, 0x3D7A410F,
+   0x60CF6BBD, 0x061382ED, 0x9C3CE822, 0x48A0B43D,
+   0x4B45AF64, 0x752C5323, 0x4C7B5A07, 0xCFD710F2,
+   0x638F2663, 0x000000B9,
+   0x599A7682, 0xC9EED4F2, 0xA4F4F82A, 0xF1ADE4E4,
+   0x6AB6D04E, 0x7479DC8B, 0x271E42CF, 0x2DA874DC,
+   0x9265E2BB, 0xC700CA71, 0x255FDCC6, 0xAF88BA91,
+   0x5705E0DD, 0xF68C2970, 0x229FDC50, 0x6EE1135B,
+   0x000000FB, 0xA1A31961, 0xF4BD32A2, 0xC4785C20,
+   0x4E67ECCF, 0x17F740E3, 0x8C0CD85D, 0xD8C21194,
+   0xF6930E3A, 0x76B4C919, 0x2C9D9C73, 0xE69EA290,
+   0xD32DE819, 0x3724A066, 0xC1028DD3, 0x7538D3AD,
+   0xFD3F06EE, 0x00000054,
+   0xCAE6514F, 0x1FF09F33, 0x261FB47D, 0x191FE11B,
+   0xBDF0B228, 0x97E72C53, 0x8CAAD4A2, 0xF81CDEDB,
+   0x7542E922, 0xAA5F2836, 0xD68E225F, 0x090DF178,
+   0x2C8431D8, 0x9ADFB620, 0x0F010FF8, 0xB8F9BEA7,
+   0x0000016B, 0xF422E828, 0x78FC8973, 0xD149E76C,
+   0x8496B0B5, 0x565C8F4A, 0xB1F0911A, 0xA79F3220,
+   0xE580F18C, 0x6FE124BA, 0x8D3B7135, 0x673928B4,
+   0x8911601D, 0xE5209D66, 0x193C9FA9, 0xBEA837FF,
+   0x988483F1, 0x000000F3,
+   0x690B6BF1, 0x5CFC2F27, 0xF33BA977, 0xDC6E6043,
+   0x82D11BA7, 0x39DC991E, 0x2922C70D, 0xFB80C94E,
+   0xA5CDEAFF, 0x393DCC3B, 0xA687F07D, 0xD44D9C7C,
+   0x33BC5437, 0xBD25EBAB, 0xD71C4392, 0x9A389625,
+   0x000001E3, 0x228F0787, 0x0AC41A2F, 0xCDE860B7,
+   0xABB96A60, 0x04C04D14, 0x22CD3CE6, 0xF65E7B0D,
+   0x157669C6, 0x67ABCED9, 0x0EF03F61, 0x814717CC,
+   0x9D2CD63A, 0x77387F7A, 0x3991C349, 0x8A80A7F4,
+   0x3C1B38A5, 0x00000033,
+   0xB81F2D5F, 0x85A59A49, 0xD12CAFC2, 0x5AB98B4C,
+   0x9036F3D4, 0x7BE9E55C, 0xAC17DDA1, 0xB6644D14,
+   0xA23F330B, 0x0D6CAF4B, 0x567899FB, 0x960E78EF,
+   0x4BEDF73D, 0xB6EC1C3F, 0xA971C6B3, 0xBE7E5CAB,
+   0x000001B4, 0x66A01413, 0x20CB3A6A, 0x71DD7853,
+   0x1FC8C49D, 0xD0F467CD, 0xC6EEA4C1, 0xC442DC91,
+   0x72ADC39A, 0x9FD5A2E0, 0x1349AC1B, 0x26814C74,
+   0xA58D7692, 0x02685093, 0xBE23DA16, 0x4F2278A1,
+   0x411491B3, 0x000001C3,
+   0x47C91A15, 0xDCDFEDB1, 0xE8003763, 0x89C1654D,
+   0xE074525D, 0xEEF03C09, 0x0B7979D2, 0x1A75460C,
+   0xFED5AE1F, 0x58881343, 0xDDB9340A, 0x3FCD3227,
+   0x885BF042, 0x1E4DB699, 0x2340AFAE, 0x2923F938,
+   0x00000067, 0xCCE2E800, 0x934EF610, 0xBFB68EFE,
+   0x8DB3F34B, 0xC8DF9008, 0xD78192D6, 0xD3FA0C49,
+   0x94929564, 0xFB20D848, 0x2D0CDBAB, 0xCD307B38,
+   0xBE73F64F, 0x183096A8, 0xBDF434F3, 0x7BB336BF,
+   0x009A7AB9, 0x00000096,
+   //Window 26
+   0xBECFF63C, 0x5D3F00EC, 0x671A2835, 0x280FC963,
+   0x849AD2F5, 0x27CF9990, 0xB27C7F2D, 0xA1CFA523,
+   0xB8278B74, 0x9D9A6870, 0x9EE793B2, 0xD6176CDF,
+   0xB31E9501, 0x9A98521A, 0x7436E438, 0x4422E43E,
+   0x000000D9, 0xDAA8DC76, 0xDA4F7464, 0x919E1298,
+   0xA5B83150, 0x81C82C13, 0x00D3948D, 0x63724CDE,
+   0x95DEF324, 0x7D5A1038, 0x9B57597B, 0x57432B3A,
+   0x42D9D64E, 0x936E411C, 0x9807D998, 0xF1E57507,
+   0xE68EEFAC, 0x0000003E,
+   0x12ABD32E, 0x7D6D77C4, 0x5A1DC2C8, 0x8B58DF9D,
+   0x5F9C5B6F, 0x5DF66178, 0xFF715A3A, 0x3F78CCF5,
+   0x307A7DFB, 0x2376DF67, 0x5068A701, 0x5B5BDEE1,
+   0x0709FA2E, 0x21F46061, 0x9FC7E647, 0x4C280360,
+   0x00000117, 0xE7755B08, 0x55195E04, 0xD50F18E2,
+   0xD9B69A94, 0xA04C2B7D, 0xD1B750B5, 0xCA6F61D0,
+   0xC9A076B8, 0xDA1FB312, 0x65979F16, 0xD953EE94,
+   0xBB7D6D42, 0xAA5FF718, 0x1AD05E58, 0x0317E1E4,
+   0xAB94F480, 0x0000008A,
+   0x5E85EED0, 0x83623F4A, 0x701D91FC, 0xFF73A65E,
+   0x49127780, 0x3E93F7EF, 0x8E0A688A, 0x10047A36,
+   0xA7BD1727, 0x96F38840, 0x13809A85, 0x2F6759F2,
+   0xD94AFECF, 0x6A04F887, 0x95F9E69A, 0x8332179C,
+   0x00000071, 0x0660084F, 0x5D3F3C22, 0x2E0FB966,
+   0x3F769F32, 0x7DF64348, 0x3AAB2F1B, 0x4DA76AC9,
+   0x9C9AF67F, 0xD1BDC740, 0xE82432D2, 0x38C13136,
+   0xCA8186AC, 0x39238A7D, 0x45DC1B6F, 0xFFD73047,
+   0x020D45D8, 0x00000018,
+   0x84DCF978, 0x28C57F17, 0x17A3887C, 0x5D15960E,
+   0x82E3034C, 0x6A673E76, 0x8DDE388D, 0x5829936C,
+   0x73E99034, 0x8ABBCAED, 0x42ABD2EC, 0x3EFC69F3,
+   0x79F77443, 0xA9F24062, 0x25B3F63F, 0xAF1EBE54,
+   0x00000137, 0x8F9732DB, 0xE87D4B59, 0xB6CA6427,
+   0x72D8BED7, 0x07459F38, 0x660EB785, 0xFEA2EEFF,
+   0xF568DF52, 0x01B83CB3, 0x21B019AC, 0xD4AF53A9,
+   0x222EB174, 0x932EB702, 0xB04E0CB1, 0x764CF455,
+   0xC45125DA, 0x000000F3,
+   0x80AB8ED1, 0xA867BCED, 0x7330A15D, 0xC2F3E32F,
+   0x36D988BD, 0x73D23541, 0x603F8E56, 0xC8C373A6,
+   0xEA52C655, 0x757AF32A, 0x81EEBBE1, 0x95761E32,
+   0xC2DA2F06, 0x4AC5350F, 0x66E20832, 0x4842E43D,
+   0x000000DF, 0x8F8D5435, 0xF78B9241, 0xCB19A542,
+   0x39E3D11A, 0xDBB5F8F0, 0xC9404482, 0xE9290BF2,
+   0x9A501D56, 0xE7FF059E, 0xF20D78A2, 0x9CC0C75D,
+   0x89C0D42E, 0x7F12E08D, 0x9150E583, 0x6EA320F3,
+   0x1C3595B3, 0x0000002B,
+   0xC678377D, 0x92B2EEFD, 0x07232D1E, 0x6AED894E,
+   0xED0C288E, 0x830CE0BC, 0x54DEEEC2, 0x55F85C3B,
+   0x6592DA50, 0x7458AD90, 0x15B63150, 0xC4121F58,
+   0x2B593642, 0x3EE32509, 0x36FF6204, 0xF5AC75DA,
+   0x0000002E, 0x080763F1, 0xD5DA2102, 0xB49BA347,
+   0x7E15E9C9, 0x120640CA, 0x488040A8, 0x8599E896,
+   0xBC668206, 0x5C7B6656, 0x22851E41, 0x50E3B0ED,
+   0xF6E3A1F2, 0x0192D3AE, 0x61E46FEC, 0x4439F96B,
+   0x8B2E579D, 0x000000E5,
+   0x376F6FFB, 0x01CA7BD3, 0x86F4BBA5, 0xE5C1B10F,
+   0x556EC106, 0x6241845D, 0xA3D0C035, 0x3A2ACE8B,
+   0xB52B93A9, 0xDD90A0F3, 0x85BC19D0, 0x9EB510FC,
+   0x95261F9A, 0xED533223, 0xBFE90F90, 0x8C250328,
+   0x00000174, 0x14AB9890, 0xD5BB6B80, 0x577E18AE,
+   0x300F1FD1, 0x7392AB52, 0x76CEA1ED, 0x29580A1B,
+   0x12C36499, 0x8560D39C, 0x3FFD342C, 0x276D2C70,
+   0xE8C3F90C, 0x41C8AD4D, 0xB137FD6B, 0x06A09196,
+   0xE237F5B5, 0x00000125,
+   0x61604E9B, 0xC4EEC397, 0x6F0D43FD, 0x52B875A4,
+   0x6E8E42F8, 0xF9E8BB74, 0xF2F4B25A, 0x47C5A743,
+   0x36EC3740, 0x183170AE, 0x2B0E23D7, 0x391A34FE,
+   0xBF15B3EF, 0x9B4DF7D8, 0x4CE42FAD, 0x1C1F163A,
+   0x000000B3, 0x9608641D, 0x98BA447F, 0x67D316E6,
+   0x1442FA65, 0x70F6CA5D, 0xD032BE7B, 0xFAD15732,
+   0x17A8B262, 0x6A37085B, 0xF6BBA8E6, 0xA7B7CEBC,
+   0x08C86060, 0xCBEA56AE, 0x79D309C1, 0x3B5405B2,
+   0x51B40CD4, 0x000000B6,
+   //Window 27
+   0x2A7F01FC, 0xBEE09423, 0x998AF9A2, 0x75176A16,
+   0xFBE89A7A, 0x13273068, 0x13C42B6A, 0x3E74AA6F,
+   0x579C61B0, 0x7DA022BE, 0xFF23E10A, 0xAA759216,
+   0xFD852641, 0xCF7F7D1A, 0x1090B6C7, 0x0E9AAF1C,
+   0x000000DB, 0x6D9EBCAD, 0x483B1F8C, 0x987B2C42,
+   0x25F3AADC, 0xF70950D0, 0x83A7BD03, 0x14F250EE,
+   0x67AEFD6A, 0x90070D75, 0x6E90C4F9, 0x035FDD1E,
+   0xB9D65432, 0x2AB23F7E, 0x190281BB, 0xB69015DA,
+   0x36008CB1, 0x00000137,
+   0x657D30AF, 0xCACF976D, 0xE599602E, 0x8D99F439,
+   0x42C60609, 0x89B7BA51, 0x27695726, 0xBE1FD861,
+   0xCF48052E, 0xD1FE4929, 0x75A3938A, 0x785C9947,
+   0x62F5496F, 0x89C0D825, 0x24237D10, 0xCF585A3F,
+   0x000000EA, 0xF48C877E, 0x3D2D602D, 0xF094B87E,
+   0x56732DBC, 0x4C825B63, 0x5603DD5C, 0x49D45408,
+   0x41A74548, 0xDDFC690B, 0x573734F5, 0x2C2993AA,
+   0x5FA01641, 0xAADFE3CD, 0x1BD91FCA, 0xBE83C452,
+   0x3CD67D47, 0x000001D2,
+   0x093EDCB7, 0x8FF38AA4, 0xE8F5564F, 0xC3C6B459,
+   0xB8935FFC, 0x613E5157, 0xE10E448E, 0x1EBA7A2A,
+   0xFC31845B, 0xCF8D70C9, 0x77F5A42D, 0xE1E4D5BB,
+   0xDD07816D, 0xE61BC59E, 0xE85FABBE, 0xA0928CB3,
+   0x000000C4, 0xACC0393D, 0x12E7717E, 0x540BE4CB,
+   0xCA036B26, 0x36DCF32F, 0x4F59050E, 0x234B425D,
+   0xDD2E7FF9, 0x36B8D833, 0xBD178951, 0xF989D479,
+   0x132D27FE, 0xBA09EF6D, 0xC2049EA7, 0xC83A3B7C,
+   0xB526A9B5, 0x00000157,
+   0x38540B67, 0xFE88213A, 0xA30B9044, 0x16613CAD,
+   0x7861D61F, 0xB06DCE42, 0xE2B9CBE1, 0xFB5C9FFD,
+   0xA5AE6125, 0xAE4AF79B, 0x3FF351AE, 0x56E69B5A,
+   0x31DF9832, 0x68DE3B3F, 0xFA3FC1CB, 0x8D2C2960,
+   0x000000CE, 0x9FD40F91, 0x979C3DD4, 0xB5640389,
+   0xCA979B58, 0x836EA10C, 0x855DD28E, 0x17F1CC25,
+   0xBF40EE0E, 0x5FD556CC, 0xE02BBB2F, 0x05F32F3D,
+   0x6AADB110, 0x9366213D, 0x26BF5C11, 0x9A1CA27A,
+   0xC15F02C4, 0x000001B0,
+   0xA0326352, 0x81F4CC04, 0xF72EE377, 0xECFDD0FE,
+   0x49737D2F, 0x8ABAD537, 0x62673FB4, 0xAF80A436,
+   0x80108B8F, 0x1C79FA07, 0x09BA3ACD, 0x07D0C9AA,
+   0x1DC6941F, 0x74D0538A, 0xB6966721, 0xD0A688D5,
+   0x00000137, 0x353F803C, 0x36BBD2E0, 0x4F536244,
+   0x6107A9FA, 0x6381104D, 0xCAA3DF33, 0x76E300F4,
+   0xAD4C0694, 0x9230C20C, 0x5F26E952, 0xC252524C,
+   0xEBBED179, 0x90C1B14A, 0x2CF2736E, 0x4E5F39DA,
+   0x653C730F, 0x00000012,
+   0x9336FD14, 0xDE9E51CF, 0x537E7969, 0x9F4116D3,
+   0x3CDC17BE, 0x80780AA0, 0xE6DC8CC8, 0xF1DAB123,
+   0xAE8FD422, 0xB29CF88B, 0xC89D013A, 0x6A8A6375,
+   0xA72B77E5, 0x18806333, 0x15AC040A, 0x0C95C29E,
+   0x00000051, 0x24528A1D, 0x1799FA1F, 0x8862F446,
+   0xA01C9CA9, 0x5FE33357, 0x49530434, 0x0D614E1D,
+   0x705C9CE5, 0x356159EB, 0x46D3D820, 0xBB864432,
+   0x5523FECE, 0x0153455D, 0x2C23FF58, 0xB321F9C3,
+   0x95919951, 0x000000E5,
+   0x897A646D, 0xDFCD9B1C, 0x8B24C5A4, 0x82382DEB,
+   0x757AB75B, 0x498750AC, 0xAF400556, 0x7A6C8430,
+   0x8DB05291, 0xB315883D, 0x77392D75, 0x3AFBFD2A,
+   0xC6F0FACB, 0xB3864B36, 0xED5D335F, 0xC282A497,
+   0x000001C9, 0xE68AE630, 0x726A53BB, 0x17BDE630,
+   0xB3C4462D, 0xE0CF2E38, 0x48F111EF, 0xCBF5E3B7,
+   0x47AC0B41, 0x0C04F994, 0xF592806D, 0x1B4EC838,
+   0x3230AD43, 0xCC0A3F21, 0x2CF1140D, 0x493432C0,
+   0x45B7837E, 0x00000180,
+   0x6F4C3A2E, 0xC54C480D, 0x78DAB943, 0x435A138A,
+   0x9114AD8B, 0x01247B78, 0x243444EF, 0x36F66362,
+   0x186991DD, 0xCF660D89, 0xC98ECD0B, 0x555D9533,
+   0x1765E5F3, 0x0CFEC2F1, 0xB1C05B17, 0xBE497E2E,
+   0x00000183, 0x28E30114, 0x7A675DA5, 0xD3E1B478,
+   0x8384708C, 0x4ED0866C, 0x8D050AC0, 0xD3F603AA,
+   0x6B5CD7FB, 0x4DC04C2C, 0xF6F41592, 0xB2C5281F,
+   0x1D51AC3A, 0xFECA6930, 0xEEC53331, 0xEEE82216,
+   0x163CC738, 0x00000151,
+   //Window 28
+   0xC6884CE1, 0xC2D7EAA1, 0x9FAF6322, 0xD7B35C4F,
+   0x337EA884, 0x8D1A1D85, 0x0F946EBE, 0xBCC6A809,
+   0x754FB8D2, 0x45EAB172, 0x91DBD926, 0x1E0B251E,
+   0xFDCE8503, 0x4B61112A, 0x15FA4759, 0x80737C49,
+   0x0000000A, 0x40260E22, 0x1973C88B, 0xE48DCA69,
+   0x83078CB7, 0xB199E3EB, 0x4815D67F, 0x7B4DE5D3,
+   0xF57BDE1F, 0xE139DC10, 0x88A1EBB5, 0x6689DD21,
+   0x7C20E7C6, 0x80884875, 0x40CBA346, 0x39171E05,
+   0x5C821402, 0x00000062,
+   0xCB4C6645, 0xF2937EDE, 0x1B68F3AE, 0x1E8DDA6D,
+   0x5C45EAE7, 0x25A8CBCA, 0xB1A328E4, 0x6F07C48E,
+   0xEF4B3917, 0x473A67AC, 0x208C0836, 0x5E4EEAC1,
+   0xEC92F538, 0xCA67351B, 0x177CF537, 0x34A8F9F8,
+   0x0000015A, 0xB9A3216B, 0x7D7F6D7A, 0x0ED36D7F,
+   0xA4AD0BAB, 0xD4B646CD, 0xD58507F3, 0xA2950840,
+   0xBD275213, 0x76C25F08, 0x00F031C0, 0x3F46258D,
+   0x300E0A0C, 0xA03DFBD7, 0x6CE16CD6, 0x40C879F4,
+   0x35E0211D, 0x00000001,
+   0x84924113, 0x21FE770F, 0x0AB300CB, 0x2C5D0612,
+   0xED6C7197, 0xE1699E81, 0xF5948795, 0xDEC38F45,
+   0x3A48DA6C, 0x79DB54B8, 0xB3F3AF61, 0x95F9D633,
+   0xA772F809, 0x3E4E733D, 0x605E477F, 0x48DBE53A,
+   0x00000142, 0x86F2714F, 0x5AB3454E, 0x939B3218,
+   0x87D83DE7, 0x96D16FF0, 0xB980FBC0, 0xDD96A283,
+   0xBA3CFAAD, 0x16C3B69F, 0xED413244, 0x968C773E,
+   0x57968830, 0xED4D4DFA, 0xF315B38C, 0xA24CFB0F,
+   0xA013ACC5, 0x000000CA,
+   0x7E59DDE8, 0xC6D7698F, 0x08AAB860, 0xB1AB83AC,
+   0xC7FCAC6B, 0xE1972059, 0x656119BD, 0xDE4446AE,
+   0xF9F8D976, 0x8DFBBEDE, 0x009BE348, 0xE3B8E6D2,
+   0x974CB79F, 0xA8EAD6EE, 0xB7A415BF, 0x4A566503,
+   0x00000002, 0x24C0D839, 0xD661701B, 0x11C338CB,
+   0x6A3200D1, 0x37F3769B, 0x5016BA32, 0xA00F1D08,
+   0xF4396987, 0x2ADD49AE, 0x16ABF906, 0x04F3DBD4,
+   0x17DC53E8, 0x54A44690, 0x9EE15F53, 0xA27E4C96,
+   0xAAA77F7E, 0x000000BF,
+   0x5602A1B0, 0x668D132F, 0xEF7A02A1, 0xBC4A769F,
+   0x4126A867, 0xE67A3B7A, 0xA775D18F, 0x6BCB37D5,
+   0x11901E4B, 0x719B93EF, 0x31F7386A, 0x3AAA34D5,
+   0x56335BB0, 0x7F81F951, 0x1D9A8FB5, 0x22CE53AA,
+   0x000001BF, 0x580D76D3, 0xB901F8B5, 0xA4D6E345,
+   0x9AE57D49, 0x4E5B689D, 0xF7AF2DEE, 0x10E321E9,
+   0x5D791601, 0x301F6090, 0x43F66981, 0x23C4F0CC,
+   0x8835A85F, 0x083B5B68, 0xDAB2DE3B, 0x1E97C0FA,
+   0x7FC613F5, 0x00000051,
+   0xA8E16494, 0x98CFFE72, 0x990F6AE5, 0x990DCDEF,
+   0x7718E6AC, 0x2FFE758F, 0x94B86A5A, 0x08FFFE7F,
+   0x24F249EC, 0x29EC8E38, 0x702E2EFC, 0x1115CF1E,
+   0xAC7863BC, 0x42D3B998, 0xA8469112, 0x9DE49C4B,
+   0x000001B3, 0x7F0F461A, 0x23C141D4, 0x1A75EA51,
+   0xD622EBB5, 0x98084EF2, 0x671DAC9B, 0x8FBE7D8A,
+   0x930FC09D, 0x8FA1E70E, 0xB8EF755E, 0x89920CF0,
+   0xFE65E8A3, 0x876F0425, 0xE79B849E, 0x46C016E1,
+   0x1C6BA4DF, 0x00000130,
+   0xE31A2875, 0x1D7948E7, 0x55F21221, 0x305E549D,
+   0xEBBF39FF, 0xAF6D2FC5, 0x0FFED2FE, 0xEABB12C8,
+   0x7B32D227, 0xAF421CD0, 0xA9BEC07C, 0xF8226502,
+   0x149EF0F7, 0x065359AC, 0x4F1CBCE5, 0x9E5E784E,
+   0x00000027, 0xE8995641, 0xE64BDF95, 0x4E803ED5,
+   0x4F00AC4C, 0x6B51176B, 0x04AC0DEC, 0x2C3FE476,
+   0x6DE24964, 0x0DFD1E8D, 0xF765F224, 0x44709CC0,
+   0xDAE016D7, 0x8EE0B68C, 0xDCAA2F3B, 0x0B6BDAA5,
+   0xAE531C98, 0x00000192,
+   0x54F6C3C2, 0xB4C8A95F, 0xB4BB79EE, 0x75CB6585,
+   0x3AF10B62, 0x42ACF981, 0xB1FBE61E, 0x390E90F9,
+   0x73C905DB, 0x8B38992A, 0xB2772547, 0xEB8EEAA4,
+   0x9FB26D56, 0x50F22673, 0xBC8FF539, 0xA7FD3621,
+   0x000001FD, 0x47CB14E9, 0x9F5F71C0, 0xA4EEA6F5,
+   0x57EFDE78, 0x9720279A, 0xFFDCCE97, 0x42407354,
+   0xF2602F0C, 0x4F8047B7, 0xC32E952E, 0x120EA438,
+   0x6BEF44FB, 0xD5EC1B83, 0x64D8E221, 0x8EF102A3,
+   0xD99027B7, 0x0000003B,
+   //Window 29
+   0x3DCA9409, 0x8002B6D6, 0x163B8124, 0xD31714C1,
+   0x720A124A, 0xCA655B42, 0x9596636B, 0x88388DBE,
+   0xC0B7DC61, 0xA321822D, 0x5824E60F, 0xCDD952C8,
+   0x6CB4916A, 0x79FF4436, 0x5F88DAB8, 0xA115847E,
+   0x00000009, 0x0AED0C43, 0x1EAF3D40, 0xEA2A20A4,
+   0x7A7196F7, 0x97781948, 0x43123414, 0xE88D93FC,
+   0x856126D0, 0xD5710224, 0x96DAC31F, 0x243E6395,
+   0xC23548F5, 0x9613A79E, 0xF351DF8B, 0x626FB1FD,
+   0x0DAE5D50, 0x000000E2,
+   0x4AE20507, 0xA59D74FD, 0xA86A468C, 0x46D0ADBA,
+   0x0DF04371, 0xC004C36B, 0xC6138633, 0xA0F3CAD9,
+   0xEEB5863D, 0xFE2133C1, 0x84041AA3, 0x0EF5DC48,
+   0x1707F418, 0xBC3F0E49, 0xDD7CDF90, 0x3677E9EB,
+   0x00000178, 0x3A62115F, 0x45465662, 0x8192FA59,
+   0x4985E0A0, 0x2AE07A9F, 0xABD64EEC, 0x9182D301,
+   0xE0E94A6D, 0xB543C76B, 0x5230272B, 0x5B5B137B,
+   0xB7A9F6CE, 0x3E7B2872, 0x45903DEC, 0x44296989,
+   0xADE61117, 0x0000001C,
+   0x6AF9B798, 0xF59B124B, 0x63CD2C15, 0xBD11629A,
+   0xD983900E, 0x0A7AB101, 0x2672749B, 0x5A2F69C4,
+   0x056680B8, 0xED86B43A, 0x9D645453, 0x7F28BEFE,
+   0x36CAE0EC, 0xB3D22D32, 0xE9411471, 0xC90AE504,
+   0x000000C8, 0x6E0FA123, 0x799B139B, 0x06C5C4F6,
+   0x35BD8785, 0xE151A5C6, 0xA68161B2, 0xE3FE9E5C,
+   0xDA895823, 0x7A71156E, 0x19BBDC85, 0xCBCE30A5,
+   0x60ABEA42, 0x847094F9, 0x395D0F51, 0xD2DC77B0,
+   0x98AA3EBD, 0x00000078,
+   0xF2C1A41E, 0x05A0C8F0, 0x47B45835, 0x3FA3563C,
+   0x5F941BE6, 0x7D5464C6, 0xEA901ACF, 0xC8BA4C91,
+   0x2C5F3773, 0x69AAC776, 0xC04113A8, 0x1DDE0221,
+   0xE105A742, 0xE6BA3AC8, 0xCA196F6E, 0x60CEFE06,
+   0x0000008F, 0x3A53B281, 0x69A777CC, 0xFAB69CD1,
+   0x1BE97838, 0xC254B5AF, 0x6605957A, 0x304E8FB0,
+   0x22816501, 0x9EC4F2A2, 0xCE4234EA, 0x86C21C2D,
+   0xBD92A83A, 0x33CCCBE1, 0x953E1E73, 0xBB3DCD75,
+   0x6E25C079, 0x00000165,
+   0x20B99AF6, 0x05CD83FD, 0x974681AE, 0xBDCD754B,
+   0x7028F353, 0x5C495347, 0xB2F2740A, 0xB1D1419B,
+   0x8F237AC6, 0xC8792B3D, 0xDE2C12D3, 0x4DBEC931,
+   0x0434E145, 0x60D09F18, 0x4538A2FB, 0x1A8C3FF5,
+   0x00000137, 0x29BBEBCB, 0x86636711, 0xAD5876CC,
+   0xFB0F179E, 0xC4065634, 0xB8937EFE, 0x47B0D99A,
+   0x66EE1B1D, 0x728C212C, 0x5EBC7465, 0x198B7103,
+   0x4B3A10E2, 0xE93AE584, 0xE5FAD5FD, 0x6618DB3C,
+   0xABBD695A, 0x00000098,
+   0x2C112FED, 0xC7BC1187, 0xC3376170, 0x17B1A92A,
+   0x535224A0, 0x87973E98, 0x6994F23C, 0x1FF01E0B,
+   0xD4D607C4, 0xD5D68D4E, 0x0A48261C, 0xE717DBF0,
+   0x3516EFE0, 0x8A17DF7B, 0x41F34E03, 0x6E1AABB4,
+   0x0000013F, 0x6C8649B8, 0x0D4F0E07, 0x2266F551,
+   0x649F17D4, 0x084802EA, 0xF0FA5CFC, 0x6C781394,
+   0x11AD2E57, 0x05959BD0, 0xB2A516B7, 0x20D6928A,
+   0x674F8F5C, 0xD4A16C92, 0x9CE0C654, 0xE61621D9,
+   0xB6764697, 0x000000C6,
+   0xECAD34CC, 0x43BF37E7, 0xC81F0B30, 0x04C08D7A,
+   0xED05109C, 0x9815FA20, 0x6F0B3BF3, 0x754EC53C,
+   0xF98B5F37, 0x07C32325, 0xF9FDA3B6, 0xCE1E98E0,
+   0x4BCB0A5A, 0x695B9382, 0xE44EEE79, 0x900871DF,
+   0x000000BD, 0x96580E55, 0x66E8ECAF, 0xE9BAF9C3,
+   0x51520DAF, 0x57B57C92, 0xF615049E, 0xA0424801,
+   0x58C572D8, 0x3CE94AB7, 0x57A6484C, 0x60DFD054,
+   0x97178C74, 0x22870F6B, 0xC475D4D2, 0x02FC18EF,
+   0xDC0D2DB3, 0x0000006F,
+   0x9C3C1FB1, 0x793D5F80, 0xB68D257B, 0x58B89EDA,
+   0x21DC6BF0, 0xC5383EF9, 0x00435D2A, 0xC83AAC4D,
+   0xB5AEA595, 0xB35CFC1B, 0x70838563, 0x9D6C2C00,
+   0x1FE85CB4, 0xADFF5AE5, 0x8B06345C, 0xC2CDA693,
+   0x00000118, 0xB46AB052, 0x1989E565, 0x9E86BC51,
+   0x8F4F8224, 0x3C4419F1, 0xE217463D, 0x60995040,
+   0xCFBE5371, 0xEA9A6346, 0xDDD7BF98, 0xCF58E474,
+   0x1F0DC935, 0xF788B692, 0x4093262D, 0x4CDCDEFB,
+   0x603D556E, 0x00000053,
+   //Window 30
+   0xE09D583B, 0x9EBD0A79, 0x3F312038, 0x8890CEB3,
+   0xFE1C7D97, 0x254FF069, 0x3825DCB4, 0xCD82A50A,
+   0x4C37CDE0, 0x065BF2F9, 0xA7B458E7, 0x59B7C4E2,
+   0x7D105C29, 0xACE6716E, 0x9F26170E, 0x84D99934,
+   0x00000107, 0xFAADA7A3, 0xDCA7480B, 0x0D4FB693,
+   0x203303D3, 0xB9EF7822, 0x0EC1C4D2, 0x594552EA,
+   0x2B97216D, 0xB59C5490, 0xB93E533E, 0x0D6C3787,
+   0x50D31AD6, 0x5CB84476, 0x0F1014D6, 0x02B816AD,
+   0x0523796C, 0x000001FA,
+   0x603F4F62, 0x7E4FC745, 0x2F0EB97D, 0x300E7434,
+   0x11BE4195, 0x0E64A634, 0x52B038E7, 0x6C160B9D,
+   0xA62D7FB8, 0x4D130D75, 0x23B6BF71, 0x83B6412B,
+   0x19D0A2D2, 0xE92B5B07, 0xFE79AA1B, 0xF547F666,
+   0x000001DB, 0xA1364F6B, 0x609495E1, 0x9DE725E5,
+   0xC196A1C6, 0x051A1989, 0x24E0C338, 0x7132B77C,
+   0x5B24ECC1, 0x7D5F2440, 0xC3888953, 0xDDFFD474,
+   0x847186D0, 0x643C84F9, 0x0EA28F9C, 0x4CDFCC12,
+   0xAC9296CA, 0x00000151,
+   0xCC0AE72B, 0x60B11099, 0xD3588531, 0x51CF7973,
+   0x1F018F3E, 0x62AEA2EE, 0x28E42557, 0xCEAEC7A0,
+   0x52DF0599, 0x695F7CCE, 0x2A1B3F00, 0xF2282545,
+   0x6394DE22, 0x8C2DF32E, 0x2DB1770F, 0x18CE083E,
+   0x00000088, 0x4BA02F8F, 0x7989F8BF, 0xB69BD72B,
+   0x22FC813F, 0x0A383C73, 0xF4EEFA60, 0x6DBF9F7D,
+   0xD7AA3E7E, 0xD2D50A4D, 0x98113DB2, 0x4D81782D,
+   0x47E078B1, 0x27DF6ACE, 0xEF4CEA63, 0x577EEFC9,
+   0xF720012F, 0x000001C9,
+   0x03D54C5E, 0xD3C4E96B, 0x65450BA4, 0x962EF31F,
+   0x4DD512C0, 0x4A75AEB6, 0x233D2675, 0x4C4D23AA,
+   0x0055293F, 0x42CFC07C, 0x242A0317, 0xBBFF60C5,
+   0x5C4F2C32, 0x3F27D5C9, 0x746505B8, 0xCA352C57,
+   0x00000080, 0x92A1EF30, 0x5751EECA, 0x1F9EEE84,
+   0xB83A993E, 0x2E0AC56F, 0x5EEC2ED7, 0xCC0D1E16,
+   0x95AD825B, 0x8AF2A112, 0xD3AA7BA6, 0xC7EF1FCA,
+   0x3035C3F8, 0x5216A429, 0x5B5BF3E5, 0x0FCB5720,
+   0xDF187DDD, 0x00000025,
+   0x94DBCEF0, 0x64F8EC4C, 0xD006D598, 0xC97A5FE1,
+   0x5FEE99BA, 0x7CC416B1, 0x698113AC, 0x5E76561A,
+   0xFFA11AF2, 0xC81C6079, 0xCDAEE971, 0xC04B5048,
+   0xC46BB0B7, 0xA79EC707, 0x45F1CFD3, 0x20AEDD0F,
+   0x00000189, 0xF1AA0926, 0x678E01FD, 0x809BE2EB,
+   0xF6794950, 0x9F89E63E, 0x9420AA4B, 0xF8BE307B,
+   0x80440A43, 0xDABBB2E6, 0x5F745612, 0x78A61DF1,
+   0xC68EA3C2, 0xD67E5C46, 0x37C8C2F6, 0x2B38ED94,
+   0x32CAC526, 0x00000008,
+   0x5379208A, 0xB191BFC9, 0x1AD2A396, 0x2A1F2BA9,
+   0xCFF511F3, 0x8A482274, 0x5B03819F, 0x20FB7515,
+   0x7FDDE9D5, 0xEDC65232, 0xF88E8979, 0xA73B9708,
+   0x5E93F0A2, 0xE0BFE37F, 0x0F1F13C2, 0xBE3B0EF2,
+   0x00000008, 0x0E0288FD, 0x52CD7F26, 0x872F25E9,
+   0x6DC435D7, 0x0164564D, 0xFA45BEA7, 0x9D109FCD,
+   0xDD4667EB, 0xB282D30C, 0x1E23BD77, 0x78610E7C,
+   0xB3BB1A74, 0xCCEDDA5F, 0xF48EE3DF, 0x16942C44,
+   0x2483A44A, 0x00000048,
+   0x138490FE, 0x60CE32B9, 0xD2685B04, 0x3195CD4A,
+   0x239110A6, 0x0E36B35E, 0xD4740967, 0x63129C87,
+   0xDC6D3F99, 0x994570FA, 0x0031CAB0, 0x8EDAE694,
+   0x7AF36802, 0x504B1B8F, 0xC466FEC6, 0x5CFD2BDA,
+   0x000000C8, 0x703DE0C0, 0xD5DD304E, 0xDF8244D0,
+   0xE7E0F651, 0x240569CE, 0xC5BF943C, 0x2824E162,
+   0xA100EDA8, 0x3DDA41F9, 0xB7B7B3B6, 0x1E5455A9,
+   0x48F90DD9, 0x7B1DE463, 0x8C821E2A, 0x4EDE44E9,
+   0xE653F067, 0x000001EB,
+   0xE6CF516E, 0xD498BB74, 0x1D808796, 0x5142E4D3,
+   0x41CF0189, 0xA5E120B1, 0x41823038, 0x50B0208B,
+   0xECA548F7, 0x290DDA83, 0x41BD5A4C, 0x3617A829,
+   0x717CABCC, 0x3EE40E94, 0x97F09B10, 0x7801F6AA,
+   0x00000175, 0xE1E5636C, 0x00BC1F19, 0x790ABE39,
+   0x3EE1B2A1, 0xB6935099, 0x423DCD56, 0xB8189D05,
+   0x951FB17E, 0x83D235D9, 0x20864261, 0x99ABD480,
+   0x1D060A77, 0x871477E4, 0x393B00F9, 0x9A968951,
+   0x3D751BF0, 0x000001E3,
+   //Window 31
+   0xA6A08EDB, 0x0BC2FC66, 0x81D46942, 0x4F83DBE4,
+   0x4E44B819, 0xDD379BC1, 0xB5785CC1, 0x6F409F1A,
+   0x40232DA3, 0x3FAC6DDA, 0x11B9BC84, 0x83B4BFDC,
+   0xC91E3874, 0x4563149A, 0xF562966F, 0x210062C6,
+   0x00000126, 0x9548D9C4, 0x6A00191E, 0xD9716285,
+   0x800F66BC, 0x15DD9859, 0x3A8C05A3, 0xAC571627,
+   0xAF6DCDF5, 0x006A2A90, 0xEAE07417, 0xFCB7C955,
+   0x11B368FB, 0xC4ABE2B7, 0x5E47618F, 0x5AB9DD68,
+   0x328F44C8, 0x0000015D,
+   0x6C2569C9, 0x1EA6A1B6, 0x0B8D26FA, 0x0B13D316,
+   0x723A1780, 0x68C05F76, 0x4877E102, 0x5131968D,
+   0xB306C24E, 0x6E187E84, 0x2633A205, 0xC8193255,
+   0x55B73112, 0x9B4C373E, 0xD25ED330, 0x14255743,
+   0x000000F9, 0x1AAA611D, 0x2B48DB01, 0x1D2BF0A9,
+   0x4D70FE3D, 0x43546512, 0x81659E91, 0x68A7CDEF,
+   0xF846864F, 0x988A5592, 0x4F7836B0, 0x943B6365,
+   0x8E2DF580, 0x585BF2D4, 0xD93315F8, 0x8FB166BE,
+   0x6D04F86B, 0x00000049,
+   0xBD779498, 0x561F1FC0, 0xDA32023B, 0xE893E206,
+   0x325E13F2, 0x09B1D8C0, 0x2349FD6F, 0xA3CB2AAB,
+   0x4CC4096A, 0xA9118E96, 0x4B1919A9, 0xF38D1FDF,
+   0x2A987A53, 0x97F159F9, 0x8C44C5E0, 0x312FBD5E,
+   0x00000095, 0xE5DCAB70, 0xAB2BD7D1, 0x4FDDCD69,
+   0xF40AF5E2, 0xEB621752, 0x1CD24613, 0x0A878ED0,
+   0x88FA2A35, 0x7196530F, 0xA32EB798, 0x8006FCFD,
+   0xE65D4AD6, 0xD212B2A6, 0x21F3AECC, 0x1ADC0F2E,
+   0x727667E4, 0x00000179,
+   0xE1B0FC29, 0x89E56BAD, 0x88FEEEAF, 0xA0A84C44,
+   0xBE076BC9, 0x3AADF31A, 0xD6D07B9F, 0x8DAAE2E8,
+   0x481832E3, 0x9EC902C9, 0xEEBA640A, 0xFD27F0D4,
+   0x7799BF38, 0x6E18C2D9, 0x34D572B6, 0x32D3303F,
+   0x0000017B, 0x9D4EBC77, 0x53C93CD1, 0x0648BB52,
+   0x26F25E8D, 0xE62DC715, 0x01B7C33C, 0xDEC92CBC,
+   0x38B3F6C3, 0xDF7561BD, 0x79298A06, 0x8591EB32,
+   0x3677B3C9, 0x8EDA9409, 0x85AA47AF, 0x64D8F03B,
+   0x8BE6F810, 0x000000B4,
+   0xB7339C17, 0xCF5C8731, 0x7C0AA23C, 0xE0C3FFF7,
+   0xC21C0008, 0xE115BAEA, 0x3FF150B8, 0x50198CB7,
+   0xAC2399F9, 0xE7714E6F, 0x0F553F1E, 0xE0865C31,
+   0xA40936C9, 0x7241A2F1, 0xB2ABF5B4, 0x4BFAD58C,
+   0x0000003E, 0xAACB8C68, 0xA21F9AD2, 0xCA96DC74,
+   0x96BA35E4, 0x05461B06, 0xD2F03913, 0x1C307DBF,
+   0xE9F0A8AE, 0x1500FF88, 0x71502C8C, 0xE43D7F44,
+   0xF65D5D6C, 0x38CCB8A2, 0xDBC273E1, 0xE6FDDCBF,
+   0x8041B039, 0x000001DF,
+   0x61411AF9, 0x21594904, 0x1B35BB28, 0xFB00D842,
+   0x852730A8, 0xEDA1CD04, 0xE968B102, 0xDF83DC5A,
+   0xB1557986, 0x27AA898D, 0xC095CA40, 0xF66AAEC7,
+   0x93AA006A, 0x74784FA9, 0x5C87DFD3, 0x353E9FDF,
+   0x0000006A, 0x0E9AA922, 0x0B61D194, 0x910BC3DD,
+   0x5676C16B, 0x08B3E89C, 0x71FC5950, 0x652D58CB,
+   0x5D00DB3B, 0x88648CE1, 0xCC21A436, 0xF9727719,
+   0xCCF48970, 0x582A7294, 0x46C1C2B4, 0xBA582061,
+   0x5950415C, 0x000000C6,
+   0x5AA10AD7, 0x160ED3D6, 0x7D43A5C2, 0xBE7FB7B9,
+   0xB748CCFE, 0x9E392618, 0x23DCAB0E, 0xFF206736,
+   0xDFD04809, 0x390A2C23, 0xE090EBAC, 0xAF5B3DAB,
+   0x88CE39AB, 0xF44B95F0, 0xF8A1C089, 0x7108B516,
+   0x0000009A, 0x3DE0EAFB, 0x97C63E02, 0xB24DC6A4,
+   0x6A40DC29, 0x076CD3B6, 0xD6BBD487, 0x439A7138,
+   0x57998BFC, 0x3C901BD9, 0x9314D303, 0x87CF690E,
+   0xC7BA9211, 0x76ADFCB1, 0x153F41DF, 0x2C771CAD,
+   0x2C275B24, 0x000001C6,
+   0xEFF99A56, 0x98CA2B7B, 0x12665587, 0x32D91F1A,
+   0x2426C7E2, 0xCA37A76A, 0x2E04C569, 0x8A50202A,
+   0xA62734E6, 0x0C9D77B7, 0x52B78BB8, 0xDD643EF1,
+   0x1451BFA8, 0xFA23CBE4, 0x0C38329A, 0x40E426F8,
+   0x00000018, 0x0788ADB9, 0xE50AC47A, 0xC387D891,
+   0x0A90975A, 0x6BEDC141, 0x7DF37F24, 0xBEA4D8B0,
+   0x82929F04, 0xECABABF6, 0x2ECE090E, 0xB0C79A56,
+   0x220932EF, 0x962E9853, 0xD6B08EF4, 0x2D3B87F3,
+   0x86BD48D7, 0x000001BD,
+   //Window 32
+   0x6A3CF15F, 0x9AECAE2D, 0x9C959376, 0xD9D0B49A,
+   0x57CC7E25, 0x4AAD9454, 0x3876FE58, 0x68361832,
+   0x2BD9DC24, 0xCCC6F2D8, 0x605BAFBE, 0x3970525C,
+   0xA2C5499D, 0xF17524ED, 0xB0C7BF4F, 0xE30B69D5,
+   0x0000005F, 0xB5D073B0, 0xA71532AD, 0xB4FB97B3,
+   0x37159FB3, 0x7A1FFF6D, 0x15B655B2, 0x9E08A89C,
+   0x55AC89EE, 0xBC027776, 0x13CFAB6B, 0x9DECE9A9,
+   0xA57A7F28, 0xC03A1D45, 0x65A3D815, 0x95515DBA,
+   0xE5CD61EA, 0x00000100,
+   0x4CE9ABD3, 0x21CBB2C7, 0x45073C39, 0x7F157A48,
+   0x0DE2380E, 0xBC887F72, 0x6F96A397, 0x295BAD1C,
+   0x8FF6DAFF, 0x9BB39BE4, 0xD80498E3, 0x65B52767,
+   0x02B936A0, 0x1B075294, 0xB90EC0FC, 0x04C89F2F,
+   0x000000B4, 0xF3BF4B3D, 0x47F62CE6, 0x0E3E0BD4,
+   0xF7992125, 0xA14A6183, 0xE1555BF8, 0x67F3936C,
+   0x8169E025, 0x846CE4B0, 0x62DAE8AE, 0xFE0B0558,
+   0xCEE40B04, 0x8FE270E1, 0x520C3E20, 0xC44DE629,
+   0xA1F2420E, 0x00000150,
+   0x4D0A48D1, 0x3CA5AE61, 0x7F021444, 0x39648CEC,
+   0x1E90C6DD, 0x3C92B252, 0x94A49837, 0x776994BC,
+   0x7DDBF5B2, 0x53E54C20, 0xD4576141, 0xFAF593C7,
+   0x26CC7AB2, 0x17E000C2, 0x0BF5318A, 0x9484DE38,
+   0x000001C9, 0x97546078, 0x7AA1D4D3, 0xF1E5FD32,
+   0x06B60EE9, 0x8447917D, 0xCE10BDF0, 0x0E3DE8AB,
+   0x40FD8D61, 0x34E29CC4, 0xA3C917AF, 0x2C27DE76,
+   0xA7BB1B54, 0x31E6C453, 0x69929799, 0x2F185B22,
+   0xC668FBE4, 0x00000142,
+   0xC1E4A87C, 0x80FD3DD3, 0xE63E847B, 0xF2230946,
+   0x477178B7, 0x9D51E3A3, 0x60B2E4DE, 0x06B089A4,
+   0x53CCD5F0, 0xF98E4CDC, 0xE9E18AEC, 0xFABA504A,
+   0x34DBA1CA, 0x22B799BE, 0xA4C9CA6E, 0x75409D50,
+   0x000000F9, 0x617902E1, 0xEC619962, 0x4C58C299,
+   0xED26BE73, 0x6D1C30E8, 0x083E94E4, 0x8BE269BD,
+   0x2C8F7115, 0xE0FED762, 0xF7C13EA9, 0xB517E55B,
+   0xB6C9BEA0, 0xAEB4BEC0, 0x7D656933, 0xCA01BF37,
+   0xF386FED9, 0x0000007D,
+   0x33C1333A, 0x2B675AAD, 0xE3F70BC6, 0x5B635D5D,
+   0xCC3993DF, 0xDC1B161F, 0x07E1C9CB, 0x3A966F3C,
+   0x9FCDEC80, 0xBD684A32, 0xF12C7088, 0xD7B51C19,
+   0xF549B4DC, 0xADFDEFB4, 0x58DB90BF, 0xE542877B,
+   0x000000C0, 0xF2B37E98, 0xD7A8F7CB, 0xB303EAA2,
+   0x0898FEAC, 0x8AB3EC65, 0xC4096803, 0xD7D2F42F,
+   0x178D3F6F, 0xC31552EB, 0xCEB00CD5, 0xD878396D,
+   0x85D9D2B5, 0x2173B3B9, 0xC6B51A1F, 0xC997717F,
+   0x3DE5F48A, 0x0000008D,
+   0xB878C367, 0xEA856CB6, 0x4A4FE60C, 0xA9C54621,
+   0xABF32138, 0x1019FC69, 0x06730992, 0x6C4B6CCD,
+   0x0E41375B, 0x1A311A6D, 0x114992A3, 0xF0248235,
+   0x764B38C8, 0xF41B1B39, 0xDC105E9E, 0xCE60DA46,
+   0x00000114, 0xB3994B60, 0x6AA1E85B, 0xC86972BB,
+   0x71512EA2, 0xEE618490, 0x0741F2C4, 0xA39E9C5F,
+   0xCA37BB0D, 0xAC5D2A89, 0xDE4D4610, 0x9AB5D88C,
+   0x4F6C0DB0, 0x76AC9892, 0x81BC4E88, 0x85406E8B,
+   0x69C37CC8, 0x000000D0,
+   0xB927FAF4, 0x84B08FD1, 0x54FC3722, 0x236EAE26,
+   0xF4836CC0, 0x1A7CB9BF, 0x0DB8508D, 0x25183348,
+   0x9D1B8764, 0x36A19E7C, 0xDE352F40, 0x8EB89180,
+   0x6E1A3EA0, 0xCCF37283, 0x0A72C4D4, 0x3E550C0A,
+   0x00000136, 0xF7B2EA82, 0x8E83AF37, 0x395BDBDC,
+   0x03C78B22, 0xEF042D8E, 0xC229423F, 0x4ED515F9,
+   0xF9EB603D, 0x27176DDC, 0x2F563376, 0x112AF839,
+   0x8390B596, 0x0774A6AB, 0x617BED41, 0xD5F44B62,
+   0x52903A20, 0x00000014,
+   0xD19D50A1, 0xAA272AAA, 0xB1D206B7, 0x3571D10B,
+   0xC3B75AD4, 0x13D9FD10, 0x546DAF84, 0xD8DFB50B,
+   0x3A1F736B, 0xD2B77B3A, 0x683F310C, 0x33725766,
+   0x9FC3B081, 0x5C27D38B, 0xD1642FF7, 0xD74611BA,
+   0x00000026, 0xF30E1C09, 0xDB5EEE71, 0xCA6DA656,
+   0x819FDB72, 0x4CDE6546, 0x312F0D73, 0x7BF7C656,
+   0xA45FFDBB, 0xF71F5257, 0x3FE1359A, 0xC34E9A29,
+   0x6EE0EA0A, 0xB1E77C79, 0x969E2682, 0x4A901CB8,
+   0x1E832386, 0x000000DA,
+   //Window 33
+   0xDF9314E0, 0x904F2D4B, 0xE7A00AAC, 0xDAAE850D,
+   0x582EFB03, 0x79231083, 0xEC7FE6D2, 0x80F1C283,
+   0x199D74A8, 0x2D5B3996, 0x395007E7, 0x5F120B9B,
+   0x4773F03E, 0x30D23773, 0x3B78B686, 0xF4C19273,
+   0x00000121, 0xFA8B51F0, 0xF103FF6D, 0x40E2BDF0,
+   0xAE7AFB51, 0x83254171, 0x1130380E, 0xCDA10D95,
+   0xE83501B8, 0x4F3A8C01, 0x1057771E, 0xAC807069,
+   0x8F52196A, 0xA5623821, 0x3609B0AA, 0x94A0A7F1,
+   0x8C257906, 0x000001DB,
+   0x96CECD8D, 0x361DF1A4, 0x120E0DA6, 0x46A52D2B,
+   0x18A399C7, 0xDAEC3192, 0xFE750171, 0xE7D7E2F9,
+   0xE7638892, 0x2538D1A8, 0x0A4BC874, 0x6D93E213,
+   0xE8063EA0, 0xABD52586, 0xCC23A672, 0x160DA4EF,
+   0x0000016F, 0xBBE499E8, 0x3FB480C9, 0xB6A4AD3C,
+   0x458ABCE1, 0x280A60BD, 0x852F59F1, 0x9EB3ABE2,
+   0xDD52DC06, 0x11066348, 0x88C45485, 0x55A268FB,
+   0x0EE83420, 0x114A29C0, 0x71D8F9FD, 0x8DC08C3B,
+   0x70C5338E, 0x000001BC,
+   0x2184BB7D, 0xCE0CAFC1, 0x8C843303, 0x15335849,
+   0xE6F4B4BA, 0x18EC18BB, 0xF08A6FF9, 0x9A34A7C6,
+   0xBFC0DEA8, 0x7FFE87BB, 0x689307B2, 0x77019C95,
+   0x8122B505, 0x80678743, 0x034C8D8E, 0xF71A3CCA,
+   0x00000076, 0x26774BBC, 0x07426E57, 0xC9A22D42,
+   0x046829D4, 0x6DBE5A7B, 0xF437F066, 0x4068C336,
+   0xD582CABA, 0xA43F362D, 0x9135DDBA, 0x1B30E4B2,
+   0x68C6CDB3, 0xC21D15D2, 0x42B97D48, 0x845DFAF6,
+   0xD7571F38, 0x00000012,
+   0xF52BBD0E, 0x5255A6B2, 0x3A427AA5, 0x25BC9A30,
+   0xC05B4E39, 0x0672CF27, 0xE1C1BA70, 0x0EC3E665,
+   0x076E1D79, 0x4EB83C1B, 0xEE0A4FEB, 0xC639E919,
+   0x9D705FC7, 0xE208FED5, 0x672534AD, 0x84877C1A,
+   0x000001F6, 0x22D3E4CF, 0x7618E18F, 0x8B6B1A53,
+   0x6A6747A6, 0xAD83B5D8, 0x2766D2CC, 0xBE7C22B2,
+   0x304194B0, 0x0C76BAF3, 0x3AC468E7, 0x72A552A9,
+   0xAF0247C5, 0x23E444F3, 0xB19FA902, 0xFCEFCD95,
+   0xC854C7AD, 0x000000B9,
+   0x6DF2D004, 0xA0377425, 0x8B587CFF, 0x9D00325B,
+   0xF87CF976, 0xB466B841, 0xF75F2EDB, 0xEDAB374D,
+   0x12C197ED, 0x8E9EEC5F, 0x89BC9389, 0x50AAA5D9,
+   0x763BB194, 0x4AF2C82A, 0x34C8C1F3, 0xBAB1ED08,
+   0x00000086, 0xCC18E166, 0x772C2059, 0x10EB9FDF,
+   0xF1C02E01, 0x5A84A9CA, 0xA447D3E6, 0xB12B3058,
+   0x6CE1C58D, 0x51D80E66, 0x367FF986, 0xF658852F,
+   0xF4B45924, 0x5DEE2588, 0xBD2E29E4, 0xFFA9FFCE,
+   0x1F3F06C8, 0x0000017A,
+   0xEB3B9F8B, 0xB04F199F, 0x153FCFD9, 0x80243FE9,
+   0x76AA9864, 0x11DA4098, 0xEBAB3040, 0x3BB76B95,
+   0x6335B1F0, 0xBD84C666, 0x945F565E, 0xB83DA9AC,
+   0xC210BED2, 0xB1462685, 0x8172AA34, 0x5A7ED2DE,
+   0x00000188, 0x4757115E, 0xBB53DF9A, 0x1C6D4096,
+   0x90058799, 0x3A228705, 0xD2E6A2DB, 0x738B21FD,
+   0x7B961C8D, 0xB7CD3A6B, 0xE93A3BE5, 0x46646D78,
+   0x06081932, 0xB5EC69EE, 0xB23C7E41, 0x814DFFAF,
+   0x422E6B21, 0x00000006,
+   0xC4103BA9, 0xA163994D, 0x634A761C, 0xD12D5CFD,
+   0xCCE6E65E, 0x53FBE970, 0xF3DE64AF, 0xDF9A86D4,
+   0xDB6AFB3D, 0xA2EB726F, 0x3B6CED78, 0xDA0C5D88,
+   0xAD815592, 0x8E0C6FF9, 0x31ABE3DE, 0x763E3F3A,
+   0x000001C1, 0xD486D571, 0xBA83EB37, 0x9C970E02,
+   0x7D06E787, 0xC94EDC44, 0xA6F869C9, 0x6B339C7C,
+   0xB509477E, 0xADD2AF63, 0x9515CA81, 0x6504A9AB,
+   0x98B2B3D8, 0x5EE4580F, 0x98178A7B, 0xC3F9784C,
+   0x35BEB4A2, 0x0000009B,
+   0xAA026E77, 0x4CA2DE78, 0x4DB749FA, 0x0C8A435C,
+   0x8B0F97F2, 0xD866FE86, 0x721478E7, 0x5318BEF1,
+   0x78D574F9, 0xDDCD7C33, 0x0C653081, 0xF258516F,
+   0x2CBD3506, 0x5E47AA9D, 0x76EF6CB3, 0x56C29888,
+   0x00000115, 0xA2B162C3, 0x696B6A6A, 0x84791356,
+   0x26ED27B9, 0x93B4394B, 0x0CD62D08, 0x836EFB61,
+   0xC58FE1DE, 0x86C31AFD, 0x3BD92491, 0xFC5BD37F,
+   0x0661A249, 0xFCA72EB3, 0x6CEE7CA7, 0xDAB31634,
+   0x0AB2850F, 0x000001D6,
+   //Window 34
+   0x6E4A010A, 0x714C9D4D, 0x98BBDD05, 0x9E8621EB,
+   0xEFC60F48, 0xF3F33305, 0x0706C352, 0x4E392A4C,
+   0x94DCFC6C, 0x5D0F7B3A, 0x2434D058, 0x28C34306,
+   0x41885900, 0xDBA377BB, 0xAD73DF88, 0x0ED4082D,
+   0x0000012A, 0xFCDADFEB, 0xC0899758, 0x54319374,
+   0x1638C314, 0xC8AE469C, 0x1831028E, 0x3A0E36A7,
+   0x41093FFE, 0x2860701A, 0x75C6667B, 0x64DE0A06,
+   0x38C843A2, 0x949389D1, 0xC6E2C8A0, 0x3A1CC818,
+   0x754F22B7, 0x000001FE,
+   0x79D6593D, 0x17110392, 0xD6D1E388, 0x7D88866E,
+   0xC9A20E92, 0x27E0AA5F, 0xB781BC4C, 0xC82EF455,
+   0xA1E9A984, 0x36888AD0, 0x962EB333, 0xA51D1804,
+   0x6589216A, 0x3964BF4A, 0x7529C9FD, 0x88904FFA,
+   0x0000016B, 0xE59081D4, 0x9E0ACA53, 0x09C4315C,
+   0x8B9066C0, 0x44DAFB2E, 0x51D18E8B, 0x3C757835,
+   0xA86CD85C, 0xED8B25E4, 0x7534CBA2, 0xE59C5EBB,
+   0xE1DB4AEB, 0x72024396, 0x77AF93DE, 0x77F5A9BE,
+   0x0779F6AF, 0x00000090,
+   0x640E6A08, 0xF9573F8D, 0x1138E3E6, 0xAE4874B3,
+   0xDA7C7652, 0x9DE063DC, 0x5C5E679A, 0x3F4F2590,
+   0x6355457C, 0xBF26D528, 0x2FBDC5AB, 0x071B6EB1,
+   0xB8344ED2, 0x66F75278, 0x52898292, 0xFCAE83AC,
+   0x0000014C, 0xC652CBB5, 0x13B69D24, 0x120253A9,
+   0x072F96E6, 0x64985F28, 0xE8F88C75, 0x089A1E10,
+   0xC7EAFD4F, 0x9562B680, 0x6D4D0FBC, 0xB91B73BF,
+   0x6E4E5AF7, 0x07278B89, 0x253F58CE, 0xE8A56798,
+   0x1DF25657, 0x000001FC,
+   0x700CD193, 0x06FEC2DF, 0x002863A6, 0xF077AFEE,
+   0x6CF0C0C2, 0xB60894FD, 0xF8B7C551, 0xC7D01CD0,
+   0xC33C337A, 0x7ADB74E4, 0xA8867AF3, 0xB4B5767E,
+   0x2F3D57A7, 0xBDB10AA6, 0xB1FF9D7D, 0x80D5AC5E,
+   0x00000116, 0x91867318, 0x0E0DF41C, 0x1912BED5,
+   0xE3CBB1AE, 0xC15465BD, 0x006DCEE9, 0x352746C5,
+   0xF4768566, 0x767E554D, 0x567E2BCF, 0xCFC14923,
+   0xA4EDDFAC, 0x5E096C3A, 0x5C661C2E, 0x8123FB58,
+   0x5B13488D, 0x00000045,
+   0x036DCD2C, 0x9861603E, 0x6320E41B, 0x48AF4728,
+   0xDD2B96B1, 0x8138FB07, 0x7B0038FF, 0x2FB14E24,
+   0xCC76B62B, 0x7C9FD678, 0x90BA8145, 0x804D66C4,
+   0xF648D6D2, 0x7744F891, 0xF4DB35C7, 0x0850A1BC,
+   0x00000163, 0x03B00E31, 0x8EA9969F, 0xCAA48991,
+   0x4DABBA6C, 0x2E664C76, 0xDCA513A2, 0x4D2B208C,
+   0xB1374337, 0x187BC7FA, 0xE3C058CF, 0xFA8126F2,
+   0x47210A32, 0x6A9587E2, 0xCDDE35A3, 0xC7D17EE7,
+   0x0503C0CF, 0x00000177,
+   0x3BBB2752, 0x199B34EF, 0x14DA10B6, 0xAF349BD2,
+   0x959CE9E5, 0xFCC357F6, 0x34A32D88, 0xC90BF5CD,
+   0x7C06D65C, 0xD8461D47, 0xFF0C374F, 0xD2D8C0F5,
+   0xAF92178B, 0x11329B15, 0x99258479, 0xFA9CAEDA,
+   0x0000010B, 0x3134B0E2, 0x72E9A049, 0x5C0896E5,
+   0x5811B564, 0xEED4B0C2, 0x65BD9197, 0x6C3C3AA0,
+   0xA5E1DAA6, 0x8BC10FA2, 0xF98ED72B, 0x5800741A,
+   0x3EDBDE6F, 0x807E6853, 0x656CB7F8, 0x0AA4DDB5,
+   0x130C5D15, 0x00000015,
+   0x42A75DA3, 0x92BEDE9E, 0x9F18E66D, 0x071164CA,
+   0xF46EA354, 0x84AB54ED, 0xBB19F925, 0x10DE71A7,
+   0x80EC1173, 0x7A426011, 0x38903219, 0xF1D78801,
+   0x76845761, 0x2A8876B2, 0x3095533B, 0xE94D8596,
+   0x000001E5, 0xF232ECF9, 0xE36D22A0, 0x338291A3,
+   0x84A21E43, 0x0C3B7B40, 0x4A552296, 0x710F5A7A,
+   0xFE08898D, 0x579D7F19, 0x3B00A095, 0xDF5933D3,
+   0xF36FBBB9, 0x05DA2AEC, 0x33D4062A, 0xD1C62E22,
+   0x6C013A91, 0x000001EE,
+   0x0307136C, 0x3A546D51, 0x65A1BCAC, 0x7C4486C9,
+   0x3E137500, 0x4C7F0D4E, 0x5F3DC270, 0x419A374E,
+   0xFB68A787, 0x2D3BC7FB, 0xCF5A6FBE, 0x133807B7,
+   0x999D7DB5, 0x3157FD2D, 0xFD7FA9BB, 0xBF430CF8,
+   0x0000010A, 0x138EF50B, 0x640F385A, 0x45CC0FDA,
+   0x67C224EA, 0xEF6F2E8F, 0x4584439F, 0xC3B81F6E,
+   0x25B857C8, 0x614BADB0, 0x9F3249B7, 0xFBE93DF7,
+   0xFDEC05FF, 0x1DBB1FF5, 0x998B74FC, 0x34B19C2A,
+   0xA6B3A036, 0x00000038,
+   //Window 35
+   0xD19906D0, 0x7FACF165, 0xAD92D455, 0xD8E059AF,
+   0x6EBEC576, 0x7356696F, 0x1D6D311D, 0x67044E55,
+   0x3A2E50CF, 0xE2BC81DC, 0xC00EA37F, 0x860036DE,
+   0xFF32D69D, 0x71DFBE61, 0xF502BAFF, 0x298B766B,
+   0x0000019F, 0x01BB03F8, 0x5E5E1239, 0x5304BA94,
+   0xD36C3583, 0xB49F6A95, 0x5025F960, 0x75E5B6E3,
+   0x72DD554F, 0x869C9D17, 0x85BFB398, 0x9CACE4A7,
+   0xD71CF71F, 0x7291DD9D, 0x0F6FD3AD, 0xD1B5758F,
+   0x5DA8A689, 0x0000018B,
+   0xAF8C8CCD, 0x99D91691, 0x33764C92, 0x2BE26486,
+   0x2477AA78, 0xB6E68149, 0xC52D4964, 0x90430FC6,
+   0x4E1647A5, 0x4CED96C5, 0xC1489674, 0x5B52A279,
+   0xC26EC42B, 0xAB7F4127, 0xF1097B9B, 0xCD5528FC,
+   0x0000019A, 0x3A47E5C2, 0x7785ADD6, 0x635CB4AC,
+   0x9C82FAE9, 0xCED83245, 0xADCB0DE0, 0xCCB91B16,
+   0xA42230C8, 0x3A3E11A7, 0x6AF43E95, 0xA3145D6B,
+   0x36288135, 0xE2DED224, 0xB74A3E63, 0x48AAB5A7,
+   0x15DF0D29, 0x000001BC,
+   0xB7F279FC, 0x089FBB85, 0x547A1EFA, 0xB3562A0B,
+   0x98080868, 0x40A3FA3C, 0x94597F7D, 0x90CE47DD,
+   0x0C6F4B4B, 0xB3BB2085, 0x5953AB03, 0x8C24EDA7,
+   0x4EEE13EC, 0xB8B110F0, 0x1BDB3CBF, 0x3ACE7B90,
+   0x000001D7, 0x335C7820, 0x33B6B36F, 0x6B2B5992,
+   0x43EFEEBC, 0x36DED655, 0x3B56649D, 0xA9DD98A3,
+   0x15419020, 0x63F405AE, 0x08D081B5, 0x2C588C8A,
+   0x5B1F59D0, 0xFF822E70, 0x745C687E, 0x69EF398C,
+   0x7AB7B9F1, 0x0000017F,
+   0xC2911AEC, 0x49D93794, 0xA810C993, 0x586554F1,
+   0xF2322411, 0x867B77A3, 0xC2E4CBC5, 0x6083B099,
+   0x7CBD094D, 0x0445ED8E, 0xE0FEAA26, 0x417BA195,
+   0xC178ED78, 0x432B645F, 0xC9948690, 0x429282DF,
+   0x0000010F, 0xADDC286F, 0x3045657B, 0x863FA4C0,
+   0x10F36372, 0xDCA96FE2, 0xAB804FD7, 0x18C34D71,
+   0x6B0A12A6, 0x2A7C0EA4, 0xBAE3DC77, 0xABC48F80,
+   0x241E63A0, 0xEF1843F8, 0x34EFEAA3, 0x8498816E,
+   0x321D171A, 0x000001C1,
+   0x37F4B554, 0xD210619A, 0x0B01FA7E, 0xA2CC4BE4,
+   0x5488768E, 0xBF380580, 0x8A100AE5, 0xCB190C6F,
+   0x749BF03E, 0x6F82BCE1, 0xC75EFD73, 0x0914BCF0,
+   0x86E6B29E, 0xBDAE2358, 0xEC5DEB30, 0x6E286B36,
+   0x000000E7, 0xFF080663, 0xF4EB4FEF, 0xF93BA24E,
+   0x0702453D, 0x56EDFB3C, 0x1EE5C4E5, 0x7AFD8870,
+   0xDC5BEF4B, 0xC025F4AB, 0x74BEE7CD, 0x5597771B,
+   0xAF63727B, 0xDC0CB4FA, 0x2A51FEE0, 0x309E2A54,
+   0xD9EB893D, 0x0000017A,
+   0xD1D81EC5, 0x86D444CD, 0xC29B3744, 0xE5F57D64,
+   0xF74F9589, 0xE606ADA6, 0x28F6B922, 0x5FA4DFAD,
+   0x5B5D30E9, 0xF90993EC, 0xB0541C49, 0x307D234B,
+   0xF75B0402, 0xC010A0DA, 0x2D0D3135, 0x2F36EC8B,
+   0x00000168, 0xB51917F2, 0x1EBDFAD4, 0x411FAA6E,
+   0x7F7F6C94, 0xD74EC215, 0xAEF4C9A7, 0x4041EF68,
+   0x3F7FF15D, 0x30B6B53B, 0x21D6DDDC, 0x6F918CEB,
+   0x1ECAC9BC, 0xFCB67A22, 0x05CE1210, 0xC5C0E9E3,
+   0x7AA44454, 0x00000139,
+   0x8597CA44, 0xFEF84687, 0xD227C76E, 0xA1379684,
+   0x7517D749, 0x66176432, 0x295D8438, 0x1420872D,
+   0xD91221F2, 0xF296988C, 0x6241E88E, 0xB6115A02,
+   0xA0969D25, 0x589DCE4E, 0xE35919FA, 0x4318724E,
+   0x000001D7, 0x41FA8073, 0xF3EA462A, 0x56900887,
+   0x8F577C21, 0x29E43377, 0xB4318C99, 0xA7686967,
+   0x821A520C, 0x354C5868, 0xB62B1149, 0x6A9DFE8E,
+   0xFC76E87F, 0xBDC6443D, 0x8AEB05C6, 0x51A3FD6A,
+   0xABCBB41C, 0x0000000F,
+   0x0149C225, 0x8D2B7357, 0xB1294D56, 0x6F048760,
+   0x53097A6E, 0x4FEEBEFE, 0xCA846C24, 0xDEB1ABBE,
+   0x1BA7F7C5, 0xC920FE52, 0x74295FBE, 0xA851D871,
+   0x717E5FE3, 0x8A977818, 0x5320F185, 0x4E35D70C,
+   0x0000000F, 0xBFB2D00F, 0xCC43DE63, 0x70414BB4,
+   0xFC526E51, 0x696EF1CD, 0x45574B72, 0x4F96A64C,
+   0xF29B91CC, 0x3D419BBF, 0x17B2E350, 0x16DC8AAC,
+   0x13F28739, 0x55B08A44, 0x3A8AFBB7, 0x4E23F8DD,
+   0xF1CECDF3, 0x0000000D,
+   //Window 36
+   0xC4D6AB08, 0x69CAD3CC, 0x3B8990B8, 0x3ADB5777,
+   0x8D958801, 0xD0CAD8CE, 0x6D728F9E, 0xCB572E66,
+   0xCD5131FC, 0xE3D9E7C4, 0x6145DC06, 0xAFCEB6B0,
+   0xE213043A, 0x12ECD392, 0x3A64C87C, 0xBD599294,
+   0x0000000B, 0xF6EA9CF1, 0x8623BDBB, 0x547AA650,
+   0x3AAD9495, 0xBEB27159, 0xD3D853FC, 0x30B40833,
+   0x3D25A648, 0xDEC51BD1, 0x12D188E8, 0xB348C3FA,
+   0x836330D2, 0x73C2EA59, 0x9DF50CFE, 0x61DED0B8,
+   0xB5DFFB20, 0x0000018A,
+   0x18A82CCD, 0x6B8F8304, 0x1B132B2C, 0xC3C56001,
+   0x8DED65A4, 0xAFB9250D, 0x945B6410, 0x921B4635,
+   0x9F168610, 0x100306BD, 0x66EDAB88, 0xDAE04ED3,
+   0xD86B2664, 0x4EDAB84E, 0xC815C6B2, 0xDEDAA28C,
+   0x00000142, 0x7B7161C2, 0xDB8265F1, 0x8F11558C,
+   0xF022683F, 0xCF5FE6EF, 0xB8859F1F, 0xAD90BE7E,
+   0x7419ABD8, 0x24AA372C, 0x8289C33F, 0x7C9D3BE5,
+   0x3871CB40, 0xB3034315, 0x55402906, 0xA7E70821,
+   0xAE557332, 0x00000014,
+   0xCA0544A7, 0xBAA18E98, 0xED60926D, 0x1FA840A3,
+   0xF583BF44, 0xC901285B, 0x2F2744DD, 0x1E658554,
+   0x033574B7, 0x7D1F3FAB, 0x5D34D187, 0x29BF8B27,
+   0x013F2B8A, 0x02018A3B, 0x7D0B0654, 0x7C0D108F,
+   0x000001D6, 0xDBB51651, 0x56E335F2, 0x0CA2BFD0,
+   0xB0FAA53C, 0xA9CF1059, 0x519B0979, 0x82E7A7E9,
+   0x5073CBC9, 0x9C56804B, 0x59D59D16, 0x6F1FDA98,
+   0x8AA44138, 0x71430784, 0xB59516A7, 0x5EE4C065,
+   0x7E4742E7, 0x00000013,
+   0x8D439A2A, 0x956E5BAB, 0x45CDAA3E, 0x70731E9D,
+   0x57720254, 0x3E13BF09, 0x97E84B98, 0x87759C0C,
+   0x5D558933, 0x73E76343, 0x1C8E0B0D, 0x63981174,
+   0x4D59454F, 0xBCFCB1C0, 0xC266E0C9, 0x230D81F0,
+   0x00000185, 0xBD01132F, 0x21F9D779, 0xB24D193A,
+   0xF2FEC285, 0x23E6C8D7, 0x248513EC, 0x50EF338C,
+   0xCA611EBF, 0x21E42C9E, 0x8276397C, 0x9F6E2FED,
+   0x0A88DB63, 0x42F1FA0E, 0x54547994, 0xC6CA6F09,
+   0x3DA19301, 0x000001DC,
+   0xCF158384, 0xEE00454F, 0x4F86C85B, 0xA5FD9A8E,
+   0x67DE6BB5, 0xB123EA8B, 0x43891EA1, 0xD7188DA7,
+   0xE2B2C93F, 0x2623A8D5, 0x8F75CAD2, 0x9F2703D4,
+   0xF759D03B, 0x177F4D20, 0xC56499E3, 0xDDC14C9C,
+   0x00000149, 0xA0FF38CA, 0x8AB6448E, 0x0126A5AD,
+   0xD235918C, 0xAFCE87F5, 0x8D30B461, 0x09D6B9FD,
+   0xEB9E25BB, 0x46C20DBA, 0xD600B21C, 0xB4D2C9D3,
+   0x6C211926, 0x9661D65B, 0x35292484, 0x908DD76E,
+   0x23762115, 0x0000017B,
+   0x4CCEB5A9, 0x46526625, 0xE5EF8C80, 0x0F1D0417,
+   0x040DDB86, 0xC4FB08EA, 0x05D7F4EB, 0xC048C66F,
+   0xDE712B34, 0xAF3A8DB1, 0x18A4C4F5, 0xF4F5A564,
+   0xF923A04B, 0xC440931C, 0x6A2A98D3, 0x3C24173A,
+   0x000000A2, 0x88BD9558, 0x64E32F82, 0x2C193599,
+   0x389C0B81, 0x857670B3, 0x0170849E, 0xB7743283,
+   0x8AA93F11, 0xDC9037FA, 0x51530A59, 0x96408A7F,
+   0x5F8C8326, 0x3CC69BF9, 0x91B0D6C9, 0xC61E39F4,
+   0x12AA4C74, 0x000000BE,
+   0xB2FE8B27, 0x08B49A24, 0xAAA2F43C, 0xB9EFD19C,
+   0xD0FA8BE4, 0xF804EE4B, 0x5050D37A, 0x591F9D42,
+   0x5AEF03BA, 0x769F7D89, 0x237488E4, 0x7C478E0D,
+   0x590A2B75, 0xE94A570E, 0x629505E9, 0xA3D690D7,
+   0x0000014D, 0xF168CB7B, 0x9A12FB5A, 0x4C36AECA,
+   0xE5D0239B, 0x5A38A19D, 0xA3E08612, 0x8816361D,
+   0xB828E0D0, 0x7F12E1E5, 0xC79C0647, 0xAA7380D6,
+   0x9E421984, 0xBBB2A1E9, 0xC5D1EF6A, 0xD73A3A66,
+   0xD3B67B8B, 0x00000193,
+   0x76EE601C, 0xDC9AB8D6, 0x60B83FFA, 0xA9991AEF,
+   0x08AFCC16, 0xB30DC5F6, 0x907DBE27, 0x815DA575,
+   0x4277E0CD, 0x89234D4B, 0x03087465, 0x71FDF6AD,
+   0x227789EF, 0x6480186C, 0x00DFA79F, 0xA26631E3,
+   0x00000117, 0xDF8D677B, 0xDE0C4CB3, 0x6661D17A,
+   0x8BCC7385, 0xCB682C5C, 0x681DEC04, 0x80ACDDF7,
+   0xE4F286C6, 0x2AD93327, 0x78DABB64, 0xE5E8591E,
+   0x51630BF3, 0x98E1343C, 0xEE2964C1, 0xF4B48F54,
+   0x0C9A681B, 0x00000053,
+   //Window 37
+   0xA1DA3C44, 0x5E94C2A2, 0x6C05A3E2, 0x90D95091,
+   0x74871EB1, 0xB29B791E, 0x50C2D855, 0xE82A41FA,
+   0x1E689F42, 0xD2D24DF9, 0x0CF6ED2F, 0xE9E93545,
+   0xC6ED3E7E, 0x5FC9D992, 0x3606713D, 0xB4EB7DF0,
+   0x0000004D, 0x2099171A, 0x248FD9D7, 0x1D16D66C,
+   0x908D539E, 0x171BFD3B, 0xAB47B9EB, 0xECDD8E37,
+   0x70E5DE8C, 0x51EED557, 0xEDD44AE0, 0xAD95AEB2,
+   0x4983C6FA, 0xCDC8214F, 0xDEDBFEA1, 0x131549B3,
+   0xC6AE2030, 0x000000C9,
+   0x2F134A93, 0x5C9DA142, 0x65DD482A, 0x898C25BA,
+   0xF6EF3E64, 0xA8CE92FE, 0x5DA54ECB, 0xE462FAEC,
+   0xB81E3EC3, 0xDFF68F3F, 0x4B8EF144, 0x5278EB6C,
+   0x0DC84F3C, 0xF98A36D5, 0xA94EF000, 0x8EDD6EDB,
+   0x00000191, 0xCE8F5403, 0x738606C4, 0x1A20B349,
+   0x102F1B3A, 0x28F73251, 0xE7F1BF33, 0x1DCCBBDC,
+   0x0136F3EB, 0x3DF6D9A6, 0x5B2B7763, 0xC9EE09FB,
+   0x02B03DC6, 0xEA421742, 0xFF600116, 0x40D3C3EB,
+   0x432728E8, 0x00000034,
+   0x8D4FEC63, 0x1D7B9B77, 0x690C571A, 0x47EB33FB,
+   0x05A01CE5, 0x3D2BB2DE, 0x78C47FFF, 0x16CDE99B,
+   0x699656B3, 0x0359242C, 0xBDD416B9, 0xDE0C7D81,
+   0xB6144F4E, 0x60863068, 0x7583C05A, 0xDFA66D19,
+   0x00000142, 0x8CCAD1D1, 0x892F8B4E, 0xCCEAAC0F,
+   0x085CF7F6, 0x5DF33B07, 0xA0760842, 0xA8747EC7,
+   0xD4737BC3, 0x28F4CADD, 0x7F8147A1, 0x8480DE3C,
+   0x49D9DB4C, 0x872DEA19, 0x5BAA01D5, 0xE84044C3,
+   0x2A8726B1, 0x00000126,
+   0x2DBFF4F0, 0xE5B551EA, 0x8ED22F87, 0x43819556,
+   0xD42F4897, 0x1A42769C, 0xA1A6EE3A, 0xE5A6F518,
+   0x3AB29B90, 0x9B53A9E6, 0xC2FBF1E6, 0x6189A415,
+   0x2599D956, 0x6EE4570E, 0xDD1F4BCB, 0xEBC865B6,
+   0x000000A4, 0x843E4791, 0x66ABACD8, 0x7A8CDC84,
+   0x3BB5C48E, 0x7B5A2F8C, 0x3F4E2D19, 0xCAFFDA4F,
+   0xBB945D44, 0xB7BFB4D5, 0xD09A8F34, 0x3501D709,
+   0x1308F3D8, 0x352B9435, 0x0BFB71E4, 0x403E594C,
+   0x92C77D2A, 0x0000019B,
+   0x0EED122F, 0x90276BD8, 0x51AF464F, 0x5FEB9A3A,
+   0x591AFDA1, 0x6723D65F, 0x0F6233C3, 0x4612B5B2,
+   0xAA39D6E6, 0x8427E3B7, 0x5050A2A8, 0xA6311DA2,
+   0x384A189D, 0xFCF3C90A, 0xC0E2CB3A, 0x956C6FA5,
+   0x0000010A, 0x00B63FAC, 0x665BF310, 0x37C71EA8,
+   0xCB8CFEE1, 0xC1BC2F1A, 0x8B3CDFEA, 0x956EB88F,
+   0x712F91A9, 0xB979486B, 0x3E7AB8C3, 0xE540D2B4,
+   0x376B1F96, 0x8CB06E29, 0x01EF726F, 0xCC582BD2,
+   0x240B1DF4, 0x000000D2,
+   0x23342E9D, 0x5ADD1D5F, 0x230F2DDE, 0xDFC4C696,
+   0x049C89BA, 0xD925C3A6, 0x074B981C, 0x9E2E23D5,
+   0xF8766D4E, 0xA11DB26C, 0xC37CE4CF, 0xC0A69D7F,
+   0xB102E1D0, 0xF6DE27C4, 0x10409988, 0x9921EC70,
+   0x000000C1, 0x7B6F0DE2, 0xA66B3265, 0x78871BFB,
+   0x2BD9A657, 0x53BB697D, 0x29F760A3, 0xAD080BDE,
+   0xBD91B082, 0x8E96EA2F, 0x8644A332, 0x10D83CF8,
+   0xB3E71CDB, 0x758300C0, 0xD8611580, 0x8146381D,
+   0x7EBB9FD4, 0x0000009F,
+   0x1F9D09A9, 0xF1321A60, 0x0C863F7A, 0xF4D31EA3,
+   0xAD2CE3AD, 0x8A43A25A, 0x99BC8BD4, 0xE3388377,
+   0xA8E816FC, 0x062857C2, 0x96C41801, 0x56378AC2,
+   0x0E66AF1D, 0xDC0F04DB, 0x56FFCEDB, 0x8848081A,
+   0x0000011A, 0x60B59A1E, 0xEA2A3E60, 0xF6FFB469,
+   0x85720082, 0xD3E820FE, 0xE10DC94C, 0x43243370,
+   0xBBEAD00B, 0x715983BC, 0x9C4F4AAF, 0x37AAB294,
+   0xB53C4873, 0x49239950, 0x527C167F, 0x9C1D2B15,
+   0xFC0884FE, 0x000000F1,
+   0xD51EA4ED, 0x12A5B6B9, 0x65396AF7, 0x6EE257DC,
+   0xECFE3419, 0xD921C77A, 0x463E4D69, 0xDB9D587E,
+   0x03FE3388, 0x0224CC9F, 0x3EC5049F, 0x062C0397,
+   0xB1E1D2BE, 0x705FDB3F, 0xECD64766, 0xB9C77024,
+   0x00000140, 0xCC7FC0FA, 0x9591F031, 0xC0B49C59,
+   0x2EB3BC1C, 0x97CE9A6B, 0xBD540817, 0x41B37630,
+   0xD5285B36, 0x7A1313A2, 0x85137B72, 0x3BB3C320,
+   0xCE410DB0, 0x193ACE4C, 0x2D3628D4, 0x75B26D92,
+   0xA39B6D87, 0x000001AC,
+   //Window 38
+   0x3FDD638D, 0x16BC3341, 0x8C518C30, 0x8C37C58A,
+   0x79DF75D1, 0x9DDDB8EE, 0xC91A620A, 0x0BC82320,
+   0x9126A200, 0x6E924A6C, 0xD20C8C89, 0x744594A9,
+   0x4CC73CAE, 0x0E9B59AC, 0x0B276B4C, 0xCE872F0A,
+   0x0000008B, 0x2C35933C, 0x651F7422, 0xE025609E,
+   0x95238355, 0x6C14D96E, 0xE7891B5B, 0x0304D219,
+   0x89C0FA37, 0x61B597EF, 0xDF7DA33D, 0x4120905C,
+   0x43DF0357, 0x718DF73D, 0xACF01355, 0x631ADA96,
+   0x7CA32D0E, 0x000000B8,
+   0x6CE8B232, 0x0B3B410E, 0x018A42B1, 0xE7B399A0,
+   0x1B75FA86, 0xDC46BCAC, 0x60747DFD, 0xD301F31A,
+   0xC1055A3F, 0x489E0254, 0xFDA87D6A, 0x0CE91CAC,
+   0xDBB94D06, 0xA63C714F, 0xEDDF2A9C, 0xEFA0D5D8,
+   0x0000006F, 0x2B2AC620, 0x63BF1E9D, 0x6D8C0AF5,
+   0x319ADF79, 0x2A562804, 0xF6F61274, 0x64CE1442,
+   0x49933936, 0xA19FACF2, 0x5E16710A, 0x72DF19F3,
+   0xAAF7FDB4, 0x6A2A864E, 0x941B3E02, 0xDE1319EE,
+   0x06D197B9, 0x00000004,
+   0x2DEE1954, 0x7F45CD24, 0x3F810988, 0x8E6C1D43,
+   0xB7E3F9A8, 0x97DE2E4A, 0x258D1168, 0x283CA85D,
+   0x60AD0F79, 0xDB928C55, 0xABDA4F60, 0x70A11E94,
+   0x0D890F28, 0x2D9B7EB2, 0xF7B67EB4, 0x52C221BB,
+   0x000000BB, 0xEAC0E2AD, 0xEBA58C5E, 0x70F18409,
+   0xB3D7DD58, 0xA334E1C3, 0x31B1BA68, 0xB366CB9C,
+   0x7A94F4D4, 0xF4CC492A, 0xB557081A, 0x1DF87DBF,
+   0xEA62FD3F, 0xD465A045, 0x7C2241BA, 0x6EEE5453,
+   0x68C23CCD, 0x00000043,
+   0xC809B1A6, 0x3114B122, 0x26A3FCA8, 0x2E3D6E91,
+   0xF06451F8, 0x0EA11E2B, 0xFEC8821C, 0x5A17B862,
+   0x036190B6, 0xA6EAEAA3, 0x46B98135, 0x116F7899,
+   0x7BD89C8D, 0xC31D8219, 0x3BDD85ED, 0x14A9A6D0,
+   0x00000019, 0xAE211B82, 0xFD626A66, 0x672F6D82,
+   0x1DAA78DB, 0x871A7E83, 0xA1ADEA20, 0x545F434F,
+   0xB12C7FD1, 0x5EE1A1EA, 0x7EC53DAA, 0x0FBBCC16,
+   0x999DCE13, 0x72B4E576, 0xC2D16B27, 0x10D55CC9,
+   0x47FDC427, 0x0000002E,
+   0x9DBF1EA7, 0xDF70A7CF, 0x9CCEF8F0, 0x9C5877F6,
+   0xB59A29E7, 0x59F7C3D8, 0x696BAA2E, 0xD58B7469,
+   0x27EF408C, 0xF5DA4D33, 0x12D2C16D, 0xD3A7D5C6,
+   0xE6A83CD1, 0x2446DC63, 0x43706D3C, 0x9CC740DA,
+   0x000000CA, 0xF72E67DB, 0xFA86FD40, 0x635D7EEB,
+   0x0E3D9678, 0x24054CAE, 0xC5AC06C6, 0xCED20367,
+   0x9BF35F20, 0x3EF62C50, 0xD5D96153, 0x9D7FC502,
+   0x961B6484, 0x6722AE42, 0x2051FED4, 0x60CBCF28,
+   0x85107C4D, 0x00000003,
+   0xC2FEFC5F, 0x7D918578, 0x69AF2F78, 0xECB2FAA9,
+   0x10069156, 0x64DD465D, 0xDAC43837, 0x7973E3FB,
+   0xE829DB46, 0xED77E998, 0xD02098E3, 0x3FA25DA9,
+   0x9FE214DF, 0x3D1AD35E, 0xEAECE293, 0xD5429750,
+   0x00000130, 0x8B7372A5, 0x4301E9AE, 0x311085A2,
+   0x383ADE7F, 0x77DB45A4, 0xBD2CE005, 0x39FDC0F5,
+   0x5F6FF224, 0x32932E4A, 0xB9820B8A, 0x46A22332,
+   0xA9B39A3F, 0xA5550B52, 0x084BC24B, 0xDC7BB3DB,
+   0x5BC62269, 0x00000091,
+   0x18475312, 0x076F242B, 0xD9940374, 0xD6B988F5,
+   0xF1EFB9A6, 0x74E80E36, 0xBFF788BA, 0x9FFF616F,
+   0x7FB404A0, 0xA25B5390, 0x8C93908B, 0xA4AA674B,
+   0xBD347E8B, 0x56A19385, 0x6BB58D80, 0x8B49A66D,
+   0x000001EA, 0x2119189D, 0x959C25A4, 0x62068A10,
+   0x951072D7, 0xA00F4BB4, 0x7CC07783, 0x3CDAA6FA,
+   0xBC0041A4, 0x70674604, 0x6117C1C5, 0x87A8AF10,
+   0xF4DE3A95, 0x97DDEEC4, 0x0CEF9713, 0x8318655E,
+   0x8A7D7AB6, 0x000001D0,
+   0xA5AFD6AA, 0x17B965FE, 0x3E4067B6, 0xECD2EBA4,
+   0x5969AB23, 0x51E6D552, 0xF4F7C1D5, 0x93447AE4,
+   0xA29C04BF, 0x771C8360, 0x1DBD96C4, 0x5370ABCA,
+   0xD003412A, 0xF61D1369, 0x8D5C1B8A, 0x40DF8486,
+   0x00000058, 0xB7D66561, 0xE683CAAB, 0xDE16B2A9,
+   0xF7F4B520, 0x925F1650, 0x459795F0, 0x31560BF1,
+   0x330921CC, 0xC10CDF62, 0x2CFBF019, 0x337E3189,
+   0x66D45C7C, 0x952B34A3, 0xDFEC76CB, 0x54CE945F,
+   0xB094CE12, 0x000001F7,
+   //Window 39
+   0x9F004528, 0x8756B00A, 0xE9C2B2E2, 0x20374136,
+   0xCCA54915, 0x9E6C6A22, 0xF6629736, 0xC5DC6015,
+   0xC4510C8B, 0x5EF3EFA8, 0xDCC2CE9A, 0x1FE7836C,
+   0x0B55A453, 0xAC80124A, 0xDBB7A64F, 0xE430CD86,
+   0x00000104, 0xA385741D, 0x939B5896, 0x3A6C90E9,
+   0xA80C7D7E, 0xE4C02621, 0x8DF754D6, 0x72958D91,
+   0xCCC73FF1, 0xE911D8D9, 0xA80CD923, 0x8C0171E8,
+   0xEE0DCA49, 0xFECADDE6, 0x850D8439, 0x4F714086,
+   0x37550FC2, 0x000000C8,
+   0x7D5E235D, 0xA22790AE, 0x4A9A5780, 0x6EC954BE,
+   0xE38FFA50, 0x26AEEDDC, 0xEB3FEEE0, 0xBEB75310,
+   0x40A31067, 0x44CBB508, 0x380E0BAA, 0x4A0FF701,
+   0x20CFE922, 0xB23528C8, 0x8FDF6C51, 0xCFF1AC94,
+   0x00000158, 0x01D7F58B, 0x80ACB800, 0xAF2D7B4D,
+   0x2181A99D, 0x146506D9, 0x30FF9020, 0x7967A5DC,
+   0xF091D305, 0x1CD6C51A, 0xB37C1052, 0x6B0DB694,
+   0x401010B5, 0x60FC5F73, 0x1B1BC5E9, 0xAB3AAC42,
+   0x8AB0CF8E, 0x0000019B,
+   0x5B923896, 0xB7C90BF8, 0xD3F08076, 0x42F96BAF,
+   0x0BD90A84, 0xDDBD3B0B, 0xE00A7E7B, 0x8ADBBB43,
+   0xB2059C91, 0xD3205108, 0x6223FD65, 0xCCB379B7,
+   0xA6F8571E, 0x2C1EB7E2, 0xD80EBB13, 0x13F3BC56,
+   0x00000092, 0x8D30DF11, 0x5E23BC73, 0x4AABDCD3,
+   0xAAB73A1F, 0x3E764E18, 0x4CD66082, 0x1D0C98C4,
+   0x94232816, 0x5B5048F0, 0xD8B64C22, 0xD2A17F6F,
+   0xAF741F8A, 0xCDB03F14, 0xC1540070, 0xA2476EE5,
+   0xA16E5E67, 0x000000A7,
+   0x29FFFDEE, 0xC3B2ADB7, 0x51FB8606, 0x154F4D79,
+   0x9D7F4B0C, 0x56E497FE, 0x0DF7FD94, 0xE5E69FAA,
+   0x114FA3CA, 0x1891FE5D, 0x045C3286, 0x4162F0E9,
+   0x780253D6, 0x98DE02C4, 0x7947B60F, 0x70308002,
+   0x0000019C, 0xA9510BD2, 0xE77F7B12, 0x2D32A857,
+   0xC663FBE7, 0xB9274D4F, 0x6538A301, 0xBB01302D,
+   0xB2C191D0, 0x6366BBF5, 0x567474F2, 0xAE1E52E9,
+   0x8446925C, 0x209B55E8, 0x3EE00EA9, 0x2419E4BC,
+   0x3D76982D, 0x00000091,
+   0x1DBEEC0A, 0x15DBA0D8, 0x3145554F, 0x6A1671E2,
+   0x13588C31, 0x6F590008, 0x783BB97D, 0x404B6424,
+   0xCC7922FE, 0x30502B92, 0x1517A238, 0xA1BD25CE,
+   0x5FBC51A5, 0xEB81E9DD, 0xBDC3B1F2, 0xEA919DF3,
+   0x0000009D, 0xA4AA5953, 0x70802002, 0x23FBDF34,
+   0xB908E35D, 0xD971A142, 0xB47DDC1A, 0x4C6EBD7D,
+   0xE4F88A18, 0x3065ED39, 0xB2F7177F, 0x162B61AA,
+   0xD7B8CC98, 0x774C6AD4, 0x8472DBD5, 0x8F87D2D0,
+   0x8D1DFEA9, 0x0000018A,
+   0x9995B39F, 0x22D05A07, 0x97572E8B, 0x95D85F0E,
+   0x4CB31201, 0xCD026242, 0xA9661CFF, 0x15C10195,
+   0x3D4D42B5, 0x7366E994, 0xD08B2304, 0x3D89205F,
+   0xC72F3319, 0x4F08BFE1, 0x51DA0362, 0xF2BB6FEF,
+   0x0000000C, 0xDAA8789C, 0x61689ED6, 0xC80EBE32,
+   0x1342F413, 0x6CF15C5D, 0x10E3C8BC, 0x9E380E00,
+   0xB59A6F20, 0x16A0A01A, 0x6FAF882B, 0x96DEB592,
+   0x5B43FF2C, 0x22CDA20A, 0x61FFA81C, 0x45D1497C,
+   0x825E5E45, 0x00000070,
+   0x23371E14, 0x9429698B, 0x3FDB1B92, 0xD9D9270C,
+   0xDD4BA2A1, 0xA4A76289, 0x9AD4DC60, 0xD9DD43D6,
+   0x63DC6801, 0xBA762360, 0xB8A45231, 0x210BE4E3,
+   0xF764E727, 0xAAA24379, 0x2B1FED01, 0x7B1A75A8,
+   0x0000006D, 0x5F621487, 0x89E40D21, 0xA2F303D5,
+   0x70C38498, 0x0FAFFEBD, 0xA88CE189, 0x735EBCEE,
+   0x0CC0EAE6, 0x8518C06B, 0x2B755A3D, 0x62F92C33,
+   0xF3CD31DC, 0xC7562C48, 0x6F7FE733, 0x83B00376,
+   0x749F7A1C, 0x000001E2,
+   0x59D5D8E0, 0x704D4660, 0x52D7CA1E, 0xA4A222B2,
+   0x9C26A86E, 0xA45B5CE2, 0xDFB9FB62, 0xC9668E73,
+   0xD58183FF, 0x13EFDE0A, 0x850DEDB0, 0xDC752A59,
+   0xEBF8C27D, 0x0314CBC5, 0xD1AB5F41, 0x279680F3,
+   0x00000118, 0x3184E940, 0x3B8A1D58, 0xCD1FA6C1,
+   0x8CC52F17, 0x3F701026, 0x5118B909, 0xAC34A4AF,
+   0xE04D31DA, 0x282FEBAC, 0xF3A66F73, 0xE8D029F8,
+   0x05018340, 0x2058C971, 0x1A8BD000, 0x7E962723,
+   0x61198C7E, 0x000000D9,
+   //Window 40
+   0x378CAB85, 0x11446EFE, 0xBC48BF6D, 0x4C3C68CF,
+   0x64C19BAF, 0x5E514661, 0xD5CBB135, 0xC0F00735,
+   0xA693B1A9, 0x5D4844A7, 0x9579FDAF, 0x517A4871,
+   0x532C1E6E, 0x5EAD064B, 0x4135ECB1, 0x60207C2D,
+   0x00000172, 0x843DC902, 0x4B033A37, 0xC27A9863,
+   0xB2D3664C, 0x18280E54, 0xF4EBDC35, 0xAE02B757,
+   0xAC7789A6, 0x10DD96F8, 0x50084BA4, 0x1F5F6349,
+   0xCC345937, 0xFDEE6F84, 0x5F65ACA8, 0x02D841CF,
+   0x4AAC5F59, 0x000001B9,
+   0x638C39DC, 0xFEBD71BD, 0x016E39F1, 0x599852C1,
+   0x96EB6AF6, 0x678D5442, 0x1EA773FF, 0x4A1CE1D0,
+   0x62AD7D21, 0x23FA5FFD, 0x8C41D004, 0x845CAB52,
+   0xBB683C2A, 0x60A4CA10, 0x586ABA40, 0x62092692,
+   0x00000110, 0x08262627, 0xDD30D6A1, 0xAAB1312E,
+   0x410CD76D, 0x87EF2A6D, 0xD7816548, 0x740171C0,
+   0x9CA850C7, 0xF4E746E6, 0x6881C9BA, 0xDF470442,
+   0x20B5F165, 0xA625D961, 0x09F109D2, 0xC1D1DF61,
+   0x64CF9864, 0x00000078,
+   0x7C4C1251, 0x22AF165C, 0xB49D08A6, 0x0638EF62,
+   0x18ED98CC, 0x80DFF986, 0xA541C5E5, 0x8E3B7186,
+   0xD0F729D4, 0x3C309734, 0x2F30C85C, 0xC3439363,
+   0x3B099E11, 0xD90474FA, 0x06C8C546, 0xDC726A4A,
+   0x0000013B, 0x1A531C8F, 0x06792436, 0x3C2633CF,
+   0xCB5C860E, 0xDCDE99CB, 0xFEF97B7E, 0xE4C02691,
+   0x085E6288, 0x353255D8, 0x08C3E30C, 0xBF01A904,
+   0xE50A641C, 0x108D6EB6, 0xBE2980B1, 0xED2BDE9D,
+   0xD5547FB7, 0x000000DD,
+   0xF443807C, 0x7881C53C, 0x861089DC, 0x95060F3C,
+   0x0B096123, 0x0B406684, 0x86A8D5F6, 0xBAFDECBB,
+   0x5C89A0A2, 0x2F5961BF, 0x6AC1191D, 0x3034175A,
+   0x4F1CBA38, 0x7521B10B, 0xA7CF95B1, 0x96EE1BA8,
+   0x000001AA, 0x13DFF296, 0x51B2B27B, 0x10683230,
+   0xA3597D71, 0xF1026F39, 0x82C4A1CE, 0x363F89B3,
+   0x9ACDB7EA, 0x30BAD05E, 0x14E0797F, 0xC9F5C1CF,
+   0x4BCB9331, 0xC248CD02, 0x2DA2F33F, 0xCE32B8E1,
+   0xE9409B9F, 0x00000072,
+   0xB7A1C131, 0xFC1863B7, 0x292BA627, 0x3749D27E,
+   0x43E2E8C2, 0x702B7395, 0x86802DB2, 0xBD851DD8,
+   0xDBFF8E77, 0x07262573, 0xBFF806FA, 0x17297732,
+   0xA17B5A68, 0x4C51E1E9, 0xE3C6ABAC, 0x7A1B65A2,
+   0x00000105, 0x02489D0E, 0x40339DA7, 0x200AFB73,
+   0x8DCFEE4E, 0x0978EF4E, 0xE7E598BE, 0x7219DD92,
+   0x6F9B982D, 0xE482628B, 0xC0907C77, 0xEB31A7F0,
+   0xE7408352, 0x40FF8FB0, 0xDC07BEBB, 0xE060FA27,
+   0xE4FB9626, 0x0000012E,
+   0x7D6E0745, 0x8D703BE2, 0xC46BF190, 0xEA52D39E,
+   0x7EE2ED74, 0x6D139E51, 0x9236B950, 0x407E6A9E,
+   0x8E424F58, 0x4338CD4B, 0x3016FA2F, 0xFDFB4F8A,
+   0x12A8E5C7, 0x0329A855, 0xA4259578, 0x9526AAF9,
+   0x000001C6, 0x59BFC10A, 0x587D6B04, 0xFB7066F9,
+   0xB0047278, 0x21324027, 0xD27E1207, 0x076DBDB1,
+   0xEBA345BD, 0xD2CD9360, 0x543ABCA7, 0x22FBD86E,
+   0xBAA528B7, 0x09B586C1, 0x02942B05, 0x1F0E7DFE,
+   0xA91C8F58, 0x00000132,
+   0x2DC5F96D, 0x1EBC2D02, 0xC4D032BD, 0x13F5B2B3,
+   0x5F4C0EAC, 0xB94C8F1F, 0x61863205, 0x50E8D4FF,
+   0xA8B2AA3C, 0x1B5F74C5, 0xCEC4B4DD, 0x2D3B84A7,
+   0x16208506, 0xEDFBCFCC, 0x39324FD7, 0xFD96A71D,
+   0x000001B2, 0x254368F6, 0xD7A1E4AB, 0xAA4E3C3C,
+   0xDD6DFB9B, 0xA06770AC, 0x416B02FE, 0x3561F699,
+   0x12DE3DB3, 0xA7F8B36C, 0xCB4DE872, 0x5D89699E,
+   0x418A843A, 0x9C875832, 0x6EF2BBA4, 0x32817F78,
+   0x2F7A007C, 0x000000B6,
+   0x0FC51D07, 0xB38962A9, 0xC07D92D8, 0x2570FFB7,
+   0x1F351AB0, 0x3C851100, 0x84C21F4D, 0x175E6200,
+   0x32295D53, 0x8F159548, 0xA5A9BA09, 0x1CD6495A,
+   0x9E1B6240, 0x0C3517CC, 0x0393E7DE, 0x0E263166,
+   0x000000C4, 0xB76F7B20, 0x1C206BE0, 0x51AF63B6,
+   0xA15FDB2B, 0x43191F7D, 0x64E4ECB5, 0xAB5D343B,
+   0xACC8FB7D, 0xFF230243, 0x722E390F, 0xBB77EDA3,
+   0xFA72E84B, 0xCA3070D5, 0x72967CB0, 0x81C795AA,
+   0x93524CCC, 0x00000192,
+   //Window 41
+   0x42DF612F, 0x7B9409BB, 0x1BC66A3F, 0x32F47DD2,
+   0x23F375FE, 0x213F80E0, 0x06AA6C21, 0xAA71C57F,
+   0x84298947, 0x5BF7B3A7, 0x5B608FA3, 0x001C2C96,
+   0x173C7F4F, 0x417619C6, 0xD4A20677, 0xBCFF66AC,
+   0x000000B3, 0x0603BC79, 0x81B9B564, 0xF875E591,
+   0x8F39155E, 0xDFD32C0D, 0xF6A508FD, 0x6B0DAC71,
+   0x7EACE6F9, 0x9E4C1EB3, 0xE40163D8, 0xFF10FA6D,
+   0x265226C5, 0xDA76D272, 0x1E1AF5CB, 0xA10DC788,
+   0x954BC056, 0x0000012C,
+   0x7471A905, 0x02E206C3, 0x34D0C122, 0xB6CE0139,
+   0xCA1EC8AD, 0xCDA8A158, 0x6EB26374, 0x17BA844B,
+   0x2AE7179C, 0xF8DCA5A6, 0x807AE8F2, 0xDAB1DA42,
+   0x4083D6A7, 0xDCC18AC9, 0xDF65F291, 0x1464E68E,
+   0x00000038, 0xD22A48C2, 0x6599FD7B, 0x477ABE8A,
+   0xFD36F482, 0x30756F73, 0x403663C9, 0x805B2E09,
+   0x1B38F348, 0xC142D148, 0x213FEB71, 0x8855D42F,
+   0x9878091A, 0x2821AF05, 0x31742196, 0x80457E5B,
+   0x90234735, 0x00000053,
+   0x5FD30BBD, 0xE410D8F7, 0x031CFF85, 0x966E71D6,
+   0xA6F4B6A7, 0xFE51C6C9, 0xD5681412, 0x6AA83CA8,
+   0x57A5D801, 0x28A61D2E, 0x52BC0413, 0xB699F6CB,
+   0x443BB821, 0x1729F8D0, 0x04452A00, 0x6E22F512,
+   0x00000076, 0x0CC2608E, 0x7B51FFAC, 0x495E770A,
+   0x370F9A54, 0xF574B07C, 0xE32A66E2, 0x7C808C30,
+   0xC3EAD5C5, 0x20D3D51A, 0xF04BDEBD, 0x04FFD31C,
+   0x82B07F28, 0xB6DF8FB3, 0xD2D81AE3, 0x002EA4E2,
+   0x3978BB58, 0x000001AB,
+   0x18DB2823, 0xF85C1B6A, 0x2203EEA7, 0xDA36FA1C,
+   0xCDAC541B, 0x81F96771, 0x605C943D, 0x52E33F39,
+   0x37C23121, 0xADF4C066, 0x8AD2C86C, 0xE9E5AA4B,
+   0x0354AD23, 0x3D4A6163, 0xAE152C75, 0x44B4D8EB,
+   0x000000FD, 0xAB2D2652, 0xD5D3D35D, 0x382B2FB7,
+   0x55B6F8ED, 0xA7E69B83, 0x3A1EEE79, 0xB5C6DA08,
+   0x98F430AA, 0x56CCE57B, 0xF4AF6CD9, 0x7AF2EA27,
+   0xD67E787B, 0xD8841E4F, 0xC276F0A7, 0xC0478C59,
+   0x2E23F60F, 0x00000026,
+   0x7D699A94, 0x7FCBDFED, 0xB4EA860C, 0xC7EEAD04,
+   0xA80BB133, 0x76A4654D, 0x335D67C0, 0x9C5EE058,
+   0x4570D4A7, 0xCC9D8C86, 0x506D2B29, 0x722DBF93,
+   0x0018F3AF, 0x67695F34, 0xB4AB6DDC, 0x6BE99994,
+   0x00000146, 0x15233C45, 0x9B73CBEB, 0x350BB94D,
+   0xA6B8CC37, 0x4475BEA9, 0x3882EACE, 0x0FE6A2FD,
+   0x5BD1A895, 0xF6A6AF41, 0xFB7F6EC4, 0xF6C34E25,
+   0x5C0EE0F9, 0x3077130B, 0x12FA7259, 0xEBC3EDA5,
+   0xEEE54FBD, 0x0000013F,
+   0x64991075, 0xFE16530A, 0x4C26BB58, 0xC1EE5B79,
+   0x11F34D7A, 0xBA74FCDB, 0xDF9FB241, 0xC2249005,
+   0x42CB9CB2, 0x3208FB5F, 0xC54C1CFF, 0x0D4BEAD8,
+   0x41EF4746, 0xE81BB7B6, 0xFAC2BDEB, 0x36C8B1DA,
+   0x000000AE, 0xD9673E05, 0x2CCCF150, 0x96BD08CF,
+   0x47D5B106, 0x7287369D, 0xF9BB4D5D, 0x33986A37,
+   0x8F4D1D06, 0xBD23B267, 0xEF03903D, 0x0DA9403B,
+   0xB5A94BB0, 0x661DED77, 0x3D1F2753, 0xD5DEC6CD,
+   0x0F2AB312, 0x0000010B,
+   0xE291354B, 0xF5730CF9, 0xC7144B0F, 0x9488B1DA,
+   0x142AD7F6, 0x3DCF5AEF, 0xD35F7489, 0x953CEB6E,
+   0xFF1FE56B, 0x1AF4DA31, 0x9EDCB503, 0xAC9330B2,
+   0xADCE304E, 0xFFBA50F0, 0x75A6E9D1, 0xD462BC6C,
+   0x000000BC, 0xAF5B261E, 0xD47CD878, 0x6EAFBBC1,
+   0x2FA533F0, 0x49E987F2, 0xE62C6ECE, 0x3203EC87,
+   0x0A95D69E, 0x84D10FAA, 0xDDBDA1EC, 0x1D24612D,
+   0xDDEFD8F6, 0x5592D62C, 0xD735FC4C, 0xBE6489AA,
+   0x6264A9F7, 0x00000045,
+   0xF975B450, 0xE57AE340, 0xAADAA0B0, 0x82646F87,
+   0x46584D65, 0xFFD783C2, 0x030A2563, 0xB2170481,
+   0x0BFBF176, 0xC1D485AB, 0xA4B5C714, 0xF85E5D93,
+   0x284CA3F9, 0xC58F74D3, 0xA8FA88E1, 0x8F302EF2,
+   0x000000FC, 0xCAC239B7, 0xBCE7F7B0, 0x325B5A89,
+   0x512643CD, 0xE2BFF3E8, 0x8A17424C, 0xEFD1395A,
+   0x32BAEF2C, 0x3084BDF1, 0xC69F2644, 0xCB57E824,
+   0xDB5A3BB8, 0x337074E1, 0x3391F528, 0x44526B8C,
+   0x57FCEC18, 0x000001DC,
+   //Window 42
+   0xD4CD8948, 0xD8FAA3BC, 0x9D2888D8, 0xDDC43783,
+   0x581ABBA5, 0x1E951BD5, 0x2947D11F, 0xA52DFAB2,
+   0x728A40EA, 0x8FBB0ED8, 0x31D769CC, 0xD4F4D06F,
+   0xFAC908D2, 0xD93B1D93, 0xF5A3B0CD, 0x8852B438,
+   0x000000BB, 0xC8C88DE9, 0x84EA0E03, 0x63CDB21F,
+   0x621A8088, 0xCD6EC216, 0x332C292E, 0xC4CD0DCA,
+   0xFD01EE09, 0xFDFCE95C, 0x5354EC9E, 0xA6B8DB30,
+   0x05C307B2, 0xB44784AE, 0xF7B254EA, 0x7E61408A,
+   0xD3848125, 0x00000128,
+   0xF6B5E497, 0x1A80E022, 0x8D73860A, 0x210B6F4B,
+   0x7B7F92C4, 0x16F2E7BD, 0xD068DE98, 0xDED9E969,
+   0x546ACE60, 0x68105E12, 0xEFB6F66F, 0x56A0C5B0,
+   0x85D590D0, 0xF0D5FDB9, 0xB69D5821, 0xF15E274F,
+   0x000000BB, 0xDE543268, 0xD8D0621D, 0x04B71011,
+   0x9E0AB44C, 0xDB9FE3CC, 0x25C135CB, 0x024B4CE3,
+   0xF0A9044B, 0x49D2589A, 0xECFB54FA, 0x8BCA2C50,
+   0xF5749538, 0xF8F8E5F6, 0xD76BF119, 0x292A452E,
+   0xBD946E2C, 0x000000B2,
+   0x8256720C, 0xD1E60E5F, 0x7C49FA90, 0x171027F5,
+   0xF6549F3C, 0xF64E8839, 0x69B799B0, 0xFFA14904,
+   0x34553FDC, 0xADD4E8FB, 0x741A95BA, 0x7CF91923,
+   0x93A1BA5A, 0xC9FA2FE9, 0x0980ACC1, 0x5D9E3402,
+   0x00000020, 0x98D2C9FF, 0x2A5CB99C, 0x6C3294E9,
+   0x448896BF, 0x81E067A4, 0xF76232CB, 0x3757184D,
+   0xBDA3583A, 0x2E0C61AA, 0xFA41813B, 0xC106499D,
+   0x6BA2AEB6, 0xA19E4B30, 0x93782286, 0x86E8C59A,
+   0x13E2306F, 0x000000A4,
+   0x3792D0E1, 0x5169A5BA, 0x866A52B1, 0xA94F38AE,
+   0x60F5270D, 0x52123A08, 0xA5B51694, 0x3753C8F7,
+   0x4C0DC22B, 0xC28F1BD1, 0xE55184F5, 0x39279193,
+   0x528C4498, 0xB9FE5BDA, 0xBCE7DE75, 0x1A04E978,
+   0x000001C9, 0xED890690, 0x95B584D1, 0x65D82F4A,
+   0xD02B7FC9, 0x3F0B031A, 0xA630A8DC, 0x5BE69E84,
+   0x79759D95, 0x45539242, 0x8CDB211F, 0x1032DAD8,
+   0x523FBD10, 0x5B003E94, 0x40C47F4D, 0x20D6FD97,
+   0x02DE5519, 0x00000144,
+   0xD7B4FDED, 0x1A90DEFE, 0x6336C055, 0x195BEE8F,
+   0x96A94272, 0xE843D427, 0x4D7DD6E9, 0x86CAE8E6,
+   0x119151E0, 0x5403B7B7, 0x5037DA6B, 0x3314AFC8,
+   0x12CA9455, 0x6D7F8F82, 0xB94463AA, 0x3937BC09,
+   0x00000081, 0xCB8E9B37, 0x306E5A03, 0x3C8B52F2,
+   0x12647304, 0xF93CAE12, 0xC869679E, 0xAB4F3D13,
+   0x20F33375, 0x0501336C, 0x90D9C5CF, 0x849DF5EC,
+   0x35C85984, 0x6244C6C3, 0x42F84628, 0x8B835C13,
+   0x901D2A93, 0x00000113,
+   0x452F6968, 0x37D8AD51, 0x0BE46391, 0x9ABF7603,
+   0x4F51F996, 0xC64BA0AA, 0x2BEF5FA2, 0xB71CF4B7,
+   0x4AEA3ECC, 0xDADCBF14, 0x5CA7ABEA, 0x86619A4A,
+   0xAF54E743, 0x17BBBD06, 0x6D5362EB, 0x70C9D3B7,
+   0x00000057, 0xFBF53393, 0xF2486BBD, 0xB87C38AC,
+   0xBF16873C, 0x87557348, 0xCA1694B5, 0x60DD9D75,
+   0x95AD3CB8, 0xB097E1EE, 0x61177E70, 0xC4D1FAAE,
+   0xB481729F, 0x30F14CE4, 0xAA073521, 0xE534F9E6,
+   0x8C3E81E6, 0x00000104,
+   0x60740F5C, 0x86AAD63F, 0x6EE3EE57, 0x32B7CC31,
+   0xA16DF7D9, 0x14340252, 0x30867552, 0xC70632BD,
+   0xE536C3EB, 0xC34AB941, 0x1B8C9771, 0xB8CEA58F,
+   0x42876FC8, 0x4F128489, 0xA2B9447C, 0x2B6009FC,
+   0x000001ED, 0x82B5E6EB, 0xC93452D8, 0xAC7DEE6F,
+   0x29958D78, 0xBF6FA7E3, 0x22DD8FD9, 0x6A75F72C,
+   0xC59C6951, 0x6123B596, 0x1C6101E3, 0xE3F2D479,
+   0xF5907C48, 0x71BD58B7, 0xE5D0B6A6, 0x56D9185F,
+   0x840FF28C, 0x000000A7,
+   0x6BC539E8, 0x96140413, 0xE4524C6B, 0xE6EDFEE1,
+   0xD07CCCF5, 0x09749744, 0xC03BDBA2, 0x1748B47E,
+   0x2BC9C91E, 0x2690D019, 0xBADE77F3, 0xD3F34165,
+   0x805EE388, 0x1903C781, 0x20EE5637, 0x56EDE143,
+   0x0000015F, 0x7B5B9F4A, 0x4300285A, 0x1B6AE86E,
+   0xDD3A022F, 0x376288F0, 0xC54A8ABE, 0x26E3394D,
+   0xC1D8EC4F, 0x91CE3AD0, 0xA3979D7B, 0xD1798CC8,
+   0x0AAF9CE7, 0x4649A9B3, 0xE972A6D1, 0xF260DEFC,
+   0xB0D0E5B7, 0x0000002B,
+   //Window 43
+   0x3E206F1D, 0x327EEC48, 0xFD9E0124, 0x20BAE09C,
+   0x12FE91F1, 0x90E15A50, 0x359590D6, 0x0DD6DE71,
+   0x7346265F, 0xB47FF787, 0xD72B31FC, 0xF68C7538,
+   0x853E2029, 0x1210AA5E, 0xF09C0C81, 0x22955A4D,
+   0x00000040, 0x7335F4A6, 0xE194DBA0, 0x4BDE2F58,
+   0x9D6532FB, 0x9016930A, 0xFAC563C5, 0xAF9E2095,
+   0x626EAEEF, 0xB7D9FDE1, 0x7AF29B71, 0x36360BBF,
+   0x809B7FE4, 0xE3CD1C8E, 0x57B5E52D, 0x37B01251,
+   0x52B90409, 0x00000032,
+   0x6DA23955, 0xFBDD71D7, 0x4E9DCA11, 0x58AED61E,
+   0xC41906AC, 0xC8F75DDC, 0x8AE30A21, 0x37020B11,
+   0x3FE85C4F, 0xF9129523, 0xBE4B3724, 0x201400FD,
+   0x3A2D4446, 0x9739962D, 0xA0F4B655, 0x917E35CD,
+   0x0000018F, 0xAE9E0FFD, 0x99496B29, 0x6DC1CB95,
+   0x98A9369F, 0xCF116E11, 0x5DB5CA11, 0x08FB818C,
+   0x3DF10D85, 0x91DDCD37, 0xDDC80CC9, 0x496AF53B,
+   0x8E8647DA, 0x573A894A, 0xE244C394, 0x41B4DE2D,
+   0x056A45E7, 0x000001A1,
+   0x17D2C887, 0x1EF0C5B0, 0x8F4493FA, 0xA593F011,
+   0x63D4A941, 0xCAA027ED, 0x055891B3, 0x56EDD1A0,
+   0x5AE7958F, 0x2597E88C, 0xB9B6B189, 0x3CB83F5E,
+   0x94645703, 0x8A80C84B, 0x4537080E, 0x31B75296,
+   0x00000127, 0xDC5510D8, 0x4A72FA41, 0x56098683,
+   0x0974F66B, 0x3EF53A52, 0xCEC5E8FF, 0x6B7DB395,
+   0xFA5D5DDD, 0x2085C160, 0xBEE1560F, 0x673DAC7C,
+   0x51C86C14, 0x8F72CB17, 0x0A932E8B, 0x2D25A31B,
+   0xCE685250, 0x0000017D,
+   0x1BD83A5C, 0x859D6C56, 0x28DBA1F4, 0x239053EE,
+   0x4A37DDF2, 0x999651C0, 0xD207328F, 0xA0A6C58B,
+   0xDAAA8A32, 0xDCECFDE0, 0xB45DCD62, 0xAF7D07B9,
+   0x646E6CA5, 0x22D90DA5, 0x89796B5E, 0xEFADE502,
+   0x00000142, 0x2C783BDF, 0xAFA5AF77, 0x0C12453C,
+   0xC24F65BD, 0x06EBFA19, 0x1B84276E, 0x05A96B12,
+   0x3B11B679, 0x13D7B934, 0x12F6B076, 0x626F6201,
+   0x27DFB98D, 0x9E534BF8, 0x0B942F47, 0x27A320EC,
+   0xAE1D2D91, 0x0000014D,
+   0xAEBB5527, 0xEDAACD35, 0x20A89E95, 0x2BDB00A8,
+   0xA3B9D046, 0x2E3D4AE1, 0x8D03C4AA, 0xFADA1246,
+   0x970B3870, 0xC558B52D, 0x9315F879, 0x2529829E,
+   0x66071940, 0xC798E1D5, 0x99DE1E14, 0x64025D6A,
+   0x000000C6, 0xA868682D, 0xE9012D5E, 0xDAA7EDE9,
+   0x03955E49, 0x25847CBC, 0xEFE1F39A, 0x603DC3CC,
+   0x4AA902CD, 0x2470A473, 0xD61BA6D9, 0x38B2D846,
+   0x6F2F37AD, 0x99EF925F, 0x5F74E770, 0x256AFFF7,
+   0x3C88ADA4, 0x000001A3,
+   0x041391E9, 0xFCBE80E2, 0x2B839134, 0x85C88B0D,
+   0x3E70FDB3, 0x05FF5CD9, 0x567F0EE8, 0xEDAEB5CC,
+   0x4866664B, 0x864CD4A2, 0xD9B8A354, 0x1D17CEB9,
+   0x08C4B1F3, 0x2C69AFA3, 0xDD6E95B6, 0x00B48E38,
+   0x000000D2, 0xF24ED4AB, 0xE7D05859, 0xCD510E45,
+   0x995E2841, 0xD0481211, 0xF2EF6EEE, 0x91F24031,
+   0x7895DA9A, 0xB6F4C95D, 0x0B6B2F70, 0xF5E76C25,
+   0xE933B195, 0x803B2B1B, 0x721ED663, 0x5E48F8E2,
+   0x798FAF6D, 0x00000098,
+   0x11DCE4C9, 0x977469FB, 0x9FDF846A, 0x1CE662A5,
+   0x61069D90, 0x7B1354CE, 0x46B01325, 0xD8814907,
+   0x7A282A41, 0xC3940A3F, 0x8E76AECC, 0x6C4FEBA1,
+   0xBC7A9EBF, 0xB5247B89, 0x5B705F9C, 0x155AF61F,
+   0x0000003E, 0x371E3CF2, 0xF4B9494B, 0xAD1A6243,
+   0x90172CB5, 0x5F840891, 0xFD8E631A, 0xDE6E7931,
+   0x0079EE0F, 0x0E341DE6, 0x707481D7, 0x682D9D44,
+   0xF9FC32D6, 0x2C5F135D, 0xDEFBEF02, 0xD15D80D0,
+   0xB700B22C, 0x000000E1,
+   0x0F9853EA, 0xA9F95976, 0x4B21047F, 0x40452B14,
+   0x44C48A97, 0x5547B384, 0x175F071C, 0xCD1E71A9,
+   0x2BEC68A4, 0xDCF49F28, 0x26A71DBF, 0x45A5B3B8,
+   0xA77F1ACD, 0x0A718077, 0x3064290E, 0xE56ECED7,
+   0x0000011D, 0x8C0F4F52, 0xB75324C7, 0x8077F9B9,
+   0xCD325565, 0x6E1B2DC5, 0xF8E13A37, 0x54AF6DE6,
+   0xBCFB5511, 0x0ED1B6EF, 0x396F4CE9, 0x98972DCD,
+   0x67C204D7, 0xCCB2F59D, 0x6AC0FB18, 0x53A4B745,
+   0x3A802EB8, 0x000000AF,
+   //Window 44
+   0xDA44FF51, 0xB342D85D, 0xD08596FF, 0x54BA0522,
+   0xB0AC99C2, 0x3DA8E8CE, 0x91F37DCB, 0xCEBE6A96,
+   0xC24D7D1C, 0x8EBAD3D9, 0xC75945EF, 0xF11A4319,
+   0xED1AC001, 0xD4DFE534, 0x1A521E4D, 0x745E2772,
+   0x000000C4, 0xDF65E0BB, 0x745E5B41, 0x3B84ED58,
+   0xF8887B53, 0x9C0684EA, 0x1A54BC47, 0xCE9C7672,
+   0xFD4F1D36, 0xCE5730FC, 0x490BC265, 0x8430ADB9,
+   0x2FA1AD6D, 0xB7DB19B4, 0x0F117BDC, 0x9C246E44,
+   0xBD339A78, 0x0000005B,
+   0xB666FF60, 0xCCC1BB64, 0xBA04B5C3, 0xE786F358,
+   0x384C0AD4, 0xBCD5E56D, 0xD0372BBD, 0x5D22436F,
+   0xA061A543, 0xFEEA9ED9, 0xFA3D34BE, 0x6F81F168,
+   0x4BA47193, 0xF52059D2, 0x4ADA65AD, 0x5FF05589,
+   0x0000006F, 0x6D4CABF2, 0x346ADED5, 0x4F1A8EE1,
+   0x65E4B11F, 0x07EBA73A, 0x1521718B, 0xD16D7D56,
+   0x8A2F32BA, 0xD3ACBB17, 0x01D49595, 0xD3F62095,
+   0x67625FAA, 0x613B6059, 0x7C3CBECF, 0x6118C496,
+   0x3908F650, 0x0000016B,
+   0xC80291F9, 0x7303EC69, 0x0C9FF7F4, 0x0F2C6439,
+   0xF3ADA285, 0x96C08EA0, 0xDEAE887C, 0x3CB50F3D,
+   0xFEFE26DC, 0xABA571FA, 0x6C6F1071, 0x4E4DBA33,
+   0xF02BDA38, 0xF5796982, 0x40485DE2, 0xA59C60B1,
+   0x000000A1, 0xCAB044F7, 0x28D7C281, 0x515D247A,
+   0xA5EB04FE, 0xBA014B10, 0x5B42D919, 0xDE221CC1,
+   0xB150B4FB, 0x22A5A502, 0xB5CB8C3A, 0xCC37E34A,
+   0x62C0DA97, 0x9E827814, 0x4B9BFB1F, 0xC97679AC,
+   0x96666256, 0x000000E6,
+   0x83EF0448, 0xC1F76984, 0xFB276974, 0xC4D18389,
+   0xE52836C2, 0xFEF2C810, 0xC09E4020, 0x3687104B,
+   0x0CC4BF06, 0xEC3248EF, 0xC401078B, 0x38DAA51B,
+   0x57BC72F2, 0x84BD9F61, 0x003676EB, 0x68B23E45,
+   0x0000009D, 0xD78B9D6B, 0x22526E98, 0xC4F28366,
+   0xC4CCDC71, 0x1C646B9D, 0x7DD12D94, 0x931BD51B,
+   0x0CC00136, 0x512EC8A6, 0xFEBF1E1E, 0xBDC888B1,
+   0x6BC281F6, 0xF6AB354F, 0x0BC271F3, 0x30C4E559,
+   0x27D1EE76, 0x00000038,
+   0x4FFA68BF, 0x2AC928FA, 0x6B647009, 0xAFB48223,
+   0x4CFAE9CD, 0xA7B54F13, 0xBB3F772C, 0x8A271E4B,
+   0xBF953D68, 0x78FAAF7E, 0x519AA8E4, 0xB5F12134,
+   0x359AE969, 0xEF343445, 0x76816A06, 0x86E25AAD,
+   0x00000110, 0x36A88707, 0xA0B18145, 0x1F9A1284,
+   0xDD48D1F2, 0x845E01BE, 0x48670DAD, 0xFC7FE6A9,
+   0xC13D5AA9, 0x64757542, 0x611969B9, 0x689BB1C7,
+   0xA4529C72, 0x06F31F72, 0xD7C3F96A, 0x5418D15E,
+   0x8B09A45A, 0x00000121,
+   0x58EF1600, 0x886C7F22, 0x4EB5BBA0, 0xD581F2BC,
+   0xE64666B2, 0xD6C7B858, 0x4E813BB2, 0x11425088,
+   0x00C98E08, 0x428E86F0, 0x76EB5C59, 0x3AC9B403,
+   0x61BD2DB8, 0x904F3139, 0xC71CFA5D, 0xA3144A05,
+   0x0000002A, 0xB69FA450, 0x002EE77C, 0x87240A19,
+   0xA1F5050C, 0xBE333836, 0xD7DF65AB, 0xB8CD4A96,
+   0xB64362DC, 0xD814096B, 0x058D9BC3, 0x9687901C,
+   0xAD04C7E3, 0xF5527030, 0x67AEF9E2, 0x6F375A8B,
+   0x20DAE809, 0x000001DD,
+   0x28DBBEF1, 0x11113AFF, 0x9515632D, 0xAC6AC532,
+   0x42A245A7, 0x1E88244E, 0x9B0E20E2, 0x30F28F4A,
+   0x2B15E0EC, 0x8BC17872, 0xBA5A885A, 0xC15E2549,
+   0x1685CE7C, 0xB42F0620, 0xDF452E98, 0xD80F13B9,
+   0x0000008B, 0xF9A80BBA, 0x39DF7724, 0x28DCF06D,
+   0xC734B0BB, 0xB43A5CD4, 0x6E09C92B, 0x8C0EE83E,
+   0x175127DA, 0xF88485B4, 0x50BDE213, 0x24A0EF83,
+   0xD9F6C901, 0xC205D20E, 0x66CE46BF, 0xDE4968AD,
+   0xD6F1C04F, 0x000001A2,
+   0xED942A64, 0x13F45D45, 0x705CBEC8, 0xFCAFEE83,
+   0x52186F58, 0xBC9A11D0, 0x41EE3189, 0xB5EC9249,
+   0xC95C6C4F, 0x71D770CB, 0xD610F241, 0x7F348C27,
+   0x64AB476F, 0x91167475, 0x6D8350AB, 0x30396F90,
+   0x000000B6, 0xA9C8B74B, 0xB866CA72, 0x3D3DF97B,
+   0x26AEABDB, 0x65CAE75A, 0xD4EA56A3, 0x88FACF27,
+   0xC873FDE0, 0xDB995516, 0x4D4211CE, 0x89799B04,
+   0xA01CF052, 0xD0F0C2A4, 0x55D85824, 0xDD83DED2,
+   0x434682B0, 0x0000011D,
+   //Window 45
+   0x851368EE, 0xC03C182D, 0x57C919F2, 0xBB94A33D,
+   0xE333ACE3, 0x9CF0C767, 0xD974DE7F, 0x037C7D47,
+   0x8B18FA5C, 0xE96E02CF, 0x26CF35F7, 0x6F1A3E91,
+   0x33486C59, 0x47AFFDC0, 0xEC8C2A2B, 0x2C370BFE,
+   0x000000E1, 0x18A3F84B, 0xDCE5DE2C, 0x2AD42CA2,
+   0xC4BB672E, 0xDD0731B2, 0xB6581D7E, 0x2809AC7E,
+   0xB6CA46CA, 0x189B0FF8, 0xDE8EDBA2, 0x1FF4631D,
+   0xA72EE3E8, 0xF1004BCB, 0xF44A8FC6, 0xC8878531,
+   0x103DD1B9, 0x000001CA,
+   0xDE024391, 0x98A781D5, 0xAE6A8131, 0xA4E752B1,
+   0x88919924, 0x8AD7E980, 0x57C8DEE7, 0x5700178A,
+   0x28FA8EA8, 0x531AD672, 0x96B9FC60, 0x625C0889,
+   0xA848FF64, 0x9B13BB3D, 0xC12E0A98, 0xA9AD8CEF,
+   0x00000118, 0x9E9AB68C, 0x0D4B05DA, 0x94C26124,
+   0x318DBB73, 0xDF5F527C, 0x1F377147, 0xAF077B4D,
+   0x14A59165, 0xBB4AC96E, 0xC8EE5181, 0x8F13CFB7,
+   0x4C90381B, 0x233547D1, 0xE84349C8, 0x58F7DA4F,
+   0x75AA5EA4, 0x0000003B,
+   0x19496A3E, 0x26779CC4, 0xB93F9890, 0x1C474EEC,
+   0xC70FCAE2, 0x8528F2F4, 0xC43683B3, 0xC9DDBB4C,
+   0xF3B3593F, 0xE33EE677, 0x714608BB, 0xA3AE1C99,
+   0xAB92D89E, 0x8A15A48B, 0xC4C8344B, 0x1549D787,
+   0x000000E8, 0xD4B88B67, 0xFA337896, 0x0B45613E,
+   0xB092967F, 0x1ED2840E, 0x99266FAA, 0x8480FCAA,
+   0x97385E81, 0xBF834C19, 0xCFC9058B, 0xA89D1623,
+   0xD4A622D5, 0xA101CC1F, 0xAA93E9DB, 0x3DA3113F,
+   0x619A1E81, 0x000000B3,
+   0xD076683D, 0xA676BEE0, 0x21D6BEBD, 0x4F0C0843,
+   0xDC7657E6, 0x53C8011E, 0x234C59B6, 0x5E0E0192,
+   0x1EA313A8, 0xFFEBC6D1, 0xBCB84AFD, 0xA8CCEF85,
+   0x138327C5, 0xC8F930C3, 0xB83994BB, 0x6A9EB749,
+   0x000001CC, 0xBB99594F, 0xAAB00795, 0xF1BE2F9E,
+   0x5F27CE0E, 0x524F18BF, 0xF76A4760, 0xA8D81CF9,
+   0xDE00974E, 0x5A0A5A67, 0x2AE521AA, 0x46986D91,
+   0xAABF5EA9, 0xC3713B98, 0x26D97947, 0x32AB0EEE,
+   0x6B040E0F, 0x00000177,
+   0xB2662A6A, 0xB1721BA5, 0xEBC45FD9, 0x99A85511,
+   0x3ECC5D3D, 0xE538FDB8, 0x69B1B389, 0xCF31F885,
+   0x0BE3489E, 0x8D337BC9, 0xA4ACFE8D, 0x3CDFBCD8,
+   0xDF97C1F0, 0xA4698999, 0xE74EBB9A, 0xF1568F6B,
+   0x0000003F, 0xCD76A58E, 0xD5995519, 0xC101617B,
+   0x494B70E8, 0xDCAE3A68, 0xAAA9461D, 0x8687BCF0,
+   0x5B6CE897, 0xCA54B0D5, 0xE7933088, 0xA150EA5F,
+   0xEDEFF8BF, 0x139F7F09, 0x1CF4DF75, 0xCD4005A1,
+   0x410E086A, 0x000000FE,
+   0x0DA09D54, 0xD46AF763, 0x11315FCA, 0xF4742AEA,
+   0xC1832567, 0xFA2EFC9A, 0xF3F4F180, 0xACA1C92C,
+   0xA04969EE, 0x5F916475, 0xBB95EDF8, 0x3619DA17,
+   0x9E7E68AB, 0xA4C3C0C0, 0xBF1D3B32, 0xC98B4036,
+   0x000001B2, 0x045007F6, 0x5477C78B, 0xE4683020,
+   0x07AF3389, 0xDB89F24D, 0xAB505688, 0xF6F7750F,
+   0x0D669305, 0x3A80BF74, 0x965D090B, 0xFBDDA3B5,
+   0x3E2B11EF, 0xCE26B74A, 0x42F8B116, 0xB2CD8F84,
+   0x8CD56F7A, 0x000000B9,
+   0x0FB0D3ED, 0x5783E5A5, 0x61EE2AD5, 0xD45D144D,
+   0x6783B97B, 0x35387B1C, 0xADE06CD1, 0x83FED918,
+   0xFD5DFB50, 0x065EF0A4, 0x333D2E20, 0x2BE01418,
+   0x526084C4, 0xC5EC15B0, 0x96427204, 0x18E131F6,
+   0x00000163, 0x240FA002, 0x799B4B41, 0x93A45054,
+   0x5B0C4AEA, 0x07D9FACF, 0x70741809, 0xDD2CCE25,
+   0xA7FA721D, 0x7E17EBCC, 0xC2F22429, 0x3C204BBA,
+   0xCB2912B7, 0x5F6294B1, 0xDFC7E968, 0x3EC9E0D6,
+   0x12AC45AB, 0x00000017,
+   0xF696BA83, 0xBC6603D4, 0xBF9C42D4, 0x155348B2,
+   0x019255DD, 0x36664A86, 0x7A1BB9D6, 0x463A6DF6,
+   0x4051D5CE, 0x0F61B9BA, 0x3A41B408, 0xEA3B7773,
+   0x31AB53E1, 0xAE9405C8, 0x9F644A63, 0x9AB3D566,
+   0x000000A4, 0x5E8C01EF, 0xB0C3477F, 0xCFBB47D1,
+   0x9EEB3FE2, 0xDBF2A125, 0xA7C9E588, 0x02BA3E65,
+   0xDA5F9F6F, 0x84232123, 0x0C9710DA, 0xBF9E7225,
+   0x311DA7F3, 0x4D4FE809, 0x5744BAE9, 0x114E4089,
+   0x0E25AE34, 0x000001F5,
+   //Window 46
+   0x31FF6E80, 0x4585D3AA, 0xC19AE65B, 0x8521AC35,
+   0xF9F78334, 0x983E0C6A, 0x435DB0F0, 0xC4131279,
+   0x51BDB67F, 0x0F2D350B, 0xD65D265F, 0x1FEA5391,
+   0x798E80AA, 0x7F0B55F7, 0xD549EAA9, 0xF322493A,
+   0x000000CE, 0xFE9E5DAB, 0xDF7B80AA, 0x1861E785,
+   0x5585F93A, 0xBBB5764C, 0xB70FA9AB, 0x3A39EF40,
+   0x23CE8AED, 0x14920FF9, 0xA719329A, 0x4A00E5B9,
+   0xA7451112, 0xFF5C3588, 0x48B0001B, 0x0E0551CE,
+   0x8DCB5FE1, 0x000000F1,
+   0x2EB6D453, 0xD3107DC4, 0xA3F6B312, 0x3897A60B,
+   0xA26EBD5E, 0x5D8AE4B9, 0x445F3EA9, 0xF83E1EFA,
+   0xE9C5AE62, 0xCDF3F2D6, 0xFE4A7F11, 0x43624A7F,
+   0x6634235D, 0x9169460F, 0x2F75464E, 0x642B8B11,
+   0x00000186, 0xC84496A4, 0x7924B1CD, 0x5F8F5F30,
+   0x0A5EB42C, 0x492CD04A, 0x14068D49, 0xF2A5F227,
+   0xE0824856, 0xAD328ED4, 0x6E146CDE, 0x9118FABD,
+   0xC63A68C1, 0x7E56624B, 0xA295B412, 0x87055125,
+   0xC1D31ED1, 0x0000001E,
+   0x6E0604E7, 0xD83376B0, 0xB9BDABCD, 0xF3DA2540,
+   0xB0069B9C, 0x8A64129A, 0x4ED21F8A, 0xF98D8A69,
+   0x17C1FDD1, 0xCD7950FB, 0xA1B303F3, 0x988AC822,
+   0x44468A4A, 0x2D6DC224, 0x23F65549, 0xED780EB1,
+   0x000000C2, 0x7C4F29CB, 0x38E4F1E1, 0x63776AF6,
+   0x030F5636, 0x8032B066, 0xEA357F37, 0x2141EBBA,
+   0xBC96AFA1, 0x7CACBE45, 0xE1396E9F, 0xC62172A2,
+   0xDC5E9F07, 0xA26039A1, 0x00CA038F, 0x96C93FA4,
+   0x23796EDF, 0x0000014B,
+   0x3A12BE03, 0x2D0E0E8C, 0x75AAA59D, 0xA4FEBEBA,
+   0x7E8056D8, 0xE5AC02D6, 0xBACD030C, 0xF3788C67,
+   0x21FDA504, 0x4018AE39, 0xF16AA240, 0x690259DC,
+   0x91AD5D2F, 0xF51723B2, 0x1F0AA525, 0x9CF89322,
+   0x00000166, 0x09388E2C, 0x0F4B0C2A, 0xF40B8763,
+   0xB8308CEF, 0x61A66221, 0x24624580, 0x165AAA95,
+   0xB67A79E8, 0x08789BC2, 0x94BC0B47, 0x08114D2C,
+   0x8B234C87, 0xBEC8D5EF, 0x1EE26556, 0xF315D134,
+   0x22E3055D, 0x00000118,
+   0x4E588DF1, 0x5D07A296, 0x19B144A5, 0x141993BB,
+   0x7AEF2CFC, 0xABC8B7F1, 0xADF5F260, 0x6A447E47,
+   0x413523AA, 0x3617BBF9, 0x8658871B, 0xAE2DF356,
+   0xECA0D3D9, 0xB73A2681, 0x45905049, 0x9FAA02A8,
+   0x000001DA, 0x9249E1F3, 0xCEA9672C, 0x92B80377,
+   0xD6030DD7, 0xB430427A, 0x1731A9B6, 0xDD23ECD8,
+   0x707319A7, 0x137EAC72, 0x7497F2D3, 0x9FC57ECD,
+   0xFD455E14, 0xF7A02326, 0x1D5BE9F6, 0x35AC3188,
+   0x58127F16, 0x000001DA,
+   0x73EE88F7, 0x3E157F22, 0x4384BB96, 0x1C063046,
+   0x163124AB, 0xFA8CCFF1, 0xE1C82E20, 0xF2A63516,
+   0xECC52CBD, 0x06F7A495, 0xD546B8B3, 0xD00255D7,
+   0xF2C1BD00, 0xA4E0EA97, 0xD8367846, 0xC279C9B9,
+   0x0000018C, 0xF4846640, 0x493CA0D2, 0x836101BB,
+   0xF2F65176, 0x7C4F5F62, 0x9A213150, 0x33CA1654,
+   0xE7A4D6CB, 0x59E1757A, 0x67055659, 0x8BBDDA8E,
+   0xAE223373, 0xE856975E, 0xE915BE3B, 0xB40DB96E,
+   0xCD6117ED, 0x000001CF,
+   0x26BD0385, 0x9649B0C1, 0xAC77DD42, 0xDF659955,
+   0x5F1D946F, 0x512CAB0F, 0xB8E888CE, 0x3365C06C,
+   0x4003AD9B, 0xD5B13936, 0x2E777936, 0xB9DDF742,
+   0xF0A2EA17, 0xD882A2E7, 0x329706F7, 0xCA25477D,
+   0x0000002C, 0x1F14B985, 0x10914428, 0x5F7BCAFB,
+   0x8C672748, 0x1A6B62B8, 0x43DA8161, 0xFFC82ECC,
+   0xADEE9242, 0x8F391FA4, 0xB7DCDB41, 0x593ADD60,
+   0x1FBBF2E0, 0x9EC74127, 0xFB551A69, 0x7443A903,
+   0x2AE9B20E, 0x00000116,
+   0x6E77AEF9, 0x3069B9D6, 0x2EB93FB9, 0xD042AC05,
+   0x12830002, 0x8335FE42, 0xE1B614FB, 0x293146E6,
+   0x6DDB3AE5, 0x652317E7, 0xFEFBA037, 0xECF47236,
+   0x58EB0B7B, 0x24B51ADF, 0x4874FB35, 0x5109F7DF,
+   0x000000D6, 0x5F1D5485, 0xFF02AC88, 0x530607FE,
+   0x8A993DAF, 0x3BA41F73, 0xC63139C9, 0x45F411A8,
+   0x934A2F94, 0xC95AAE6B, 0x2208220B, 0x63292771,
+   0x96710A9C, 0x5B2A77A3, 0xC1B102E3, 0xA35D5E23,
+   0xC8177ECB, 0x0000014C,
+   //Window 47
+   0xCFD387AD, 0xDBEEB421, 0x5BB4D523, 0xD208FE08,
+   0xED24EDF7, 0xFF2282DB, 0xC806B492, 0x30556FF9,
+   0xD5B5BF57, 0xE7716C3C, 0x153FB3B2, 0x847E3A43,
+   0x391809C5, 0xE9A8FB3C, 0x92596244, 0x52B4A729,
+   0x000001C0, 0x59D9AE12, 0xE49B344E, 0xC925B6DA,
+   0x5A5E32A1, 0xF054A1C6, 0xE81D38D1, 0xF15FB6D7,
+   0x4AE4FE0C, 0x5CF03296, 0x6EF46DCD, 0x12DA300D,
+   0xBF46B976, 0x35FA7FDD, 0xFB373FE8, 0x62BCAF82,
+   0x0F78E5EE, 0x0000003B,
+   0xEC95BFBB, 0x7E8AE915, 0x8CC39CC3, 0x7B4BCC89,
+   0x3F466A65, 0xD7A389BF, 0xE8BA8813, 0x7620F5E1,
+   0x9100972C, 0xEA27DE5B, 0xD8D87E7A, 0xD6CF9430,
+   0xB4FDAE7E, 0x78B6E5F8, 0x9A216A4B, 0x921A7E32,
+   0x0000010A, 0xEC6C2D84, 0xBDB7E79B, 0xDB16F282,
+   0xE77C3945, 0x411BE2D3, 0x6ECD2885, 0xB4D40D53,
+   0xCB034559, 0xC6CAEF37, 0x9B27A5B5, 0x30EC1026,
+   0xA4B12DD5, 0xB3663660, 0xD7FC0E2C, 0x2E1B00F1,
+   0xE83E4D0C, 0x00000023,
+   0xB02DE9BD, 0x921CDDF9, 0x54CB70BD, 0x5284E403,
+   0x485DE511, 0x47CB75FE, 0xE754A4F5, 0x844BB7F2,
+   0x01C4C5C5, 0xD8E646FB, 0x9A4D1688, 0x2F105590,
+   0x00AD301A, 0x38C08F8E, 0x49211208, 0xEB1EAB17,
+   0x00000017, 0x055725CB, 0xEF36CB1B, 0xEA940F24,
+   0xDCCE426C, 0x665F5CB9, 0x29921FCD, 0x666D7A07,
+   0x04BF0DA8, 0xAFD71003, 0x43F45CFA, 0x29E78F9A,
+   0x03EEC445, 0xE17694B7, 0xE2A5F7EE, 0x4B7CB8F2,
+   0xCD841ABA, 0x000001D6,
+   0x8EF092B9, 0x3345300A, 0x33A01AB2, 0x3824081F,
+   0xEA5B5A09, 0xE685D205, 0xF455D169, 0x44B7A967,
+   0x7442AED8, 0x2C9E9155, 0x75A96917, 0x64DBF3A6,
+   0x449F53AB, 0x49FAEC7B, 0xCBFE4F33, 0x35BA7EBA,
+   0x00000198, 0x19FC3126, 0x811C4BDD, 0x6C46CC5C,
+   0xFCDA0AEC, 0xD486C15A, 0xB51C467D, 0x4BD4174C,
+   0x704C3755, 0xBBC329A6, 0xFB5EA371, 0x55447586,
+   0x31486007, 0x56AA7225, 0x5482E551, 0x8F51EA5A,
+   0x94295989, 0x0000005D,
+   0x7342C5CF, 0x0181F2CD, 0x61286BEE, 0x2F7FFF6D,
+   0xF75DF407, 0xA47D2598, 0xC00A1FB4, 0x0571C708,
+   0x9773DFA5, 0x3ADDF5E7, 0x06F201CF, 0x2996A03A,
+   0x47D8EF84, 0xAB51127C, 0x0472B14E, 0x0FAEE940,
+   0x000001BF, 0x71F8B12A, 0x60D06296, 0xC0AEDAB2,
+   0xD0F88DA1, 0x70437E2B, 0x9835F2F3, 0xC86CF385,
+   0xD0E78781, 0x384225AA, 0xB5A2870F, 0x0191D4DC,
+   0xF53D2C1A, 0x1C080B55, 0x3B44D418, 0x2C884241,
+   0x6C7B0FFA, 0x00000049,
+   0x43EF45FD, 0xBA77CD49, 0x14ABBCE5, 0x5EAE5D83,
+   0x7BA79C20, 0x3DED2244, 0x18978464, 0xA09310AD,
+   0xECAA75F6, 0x4D9A4F58, 0xCEEBA7DD, 0x2461CF62,
+   0x9BAC333A, 0xAED1EEC6, 0x6F3D713E, 0xC6AB1B3C,
+   0x0000015F, 0x45FFF29A, 0xF39FAC23, 0x7B611EFE,
+   0xCF878F40, 0xE3BD3BCC, 0xA5C2DC3C, 0x5E0F88B4,
+   0x0970D259, 0x87EAF4A9, 0x40631B32, 0x53916DD2,
+   0xAB309615, 0x8A76FAE4, 0x10AEEB26, 0x61102A5B,
+   0xB9D4A7C0, 0x0000012F,
+   0x07CD9E9E, 0x1EC43A87, 0x6EE1ACCD, 0x02702692,
+   0x639E55E8, 0x1046EF63, 0xEFA78E78, 0xFB61349B,
+   0xD1F04936, 0xF4BADD33, 0xC6AC2AC1, 0xBA37EB11,
+   0x11B98003, 0x615452DE, 0xE5B61D26, 0x6186280B,
+   0x00000135, 0x8A9606A2, 0x5C4ADA15, 0xFF81D9B7,
+   0xB67BE6F1, 0xC248F000, 0x6ECAB24F, 0x49413727,
+   0x83F4E3FB, 0xF00F2AAD, 0x6D244519, 0x521D5032,
+   0x3F8778BE, 0x854BC501, 0x0B34B167, 0x9339C469,
+   0x9A989E71, 0x000000A3,
+   0xDD537F88, 0x61E47833, 0x42B97A97, 0xF8729B63,
+   0xAD19722E, 0x292CA6CD, 0x56B5494A, 0xFC44C2DE,
+   0x2175A3B9, 0xB26AD915, 0x267F1479, 0x6A9A86CD,
+   0x48771244, 0xC79445B2, 0xD1D9C112, 0x2C7C1DEB,
+   0x000000B4, 0xE8B487C9, 0x105668EB, 0x2CF039E0,
+   0x3EFE20DF, 0xE457AA37, 0x07B40137, 0x36A5D117,
+   0x8BF32588, 0xD1CE7AFE, 0x71D392B9, 0x636D930B,
+   0x66D91FF0, 0x7E8CCA52, 0xD538DECB, 0x7A538D2F,
+   0xCF74FFFD, 0x0000010A,
+   //Window 48
+   0x6DEBBCF6, 0xFDF7681D, 0x600EA3C3, 0xE21AEF25,
+   0xBB30B75B, 0x181FB048, 0x8D8B7B4F, 0xF9D8C43D,
+   0xCA68EC32, 0x3D3BC6DE, 0xAF1641EB, 0x6D469252,
+   0x10252291, 0x1BE3C9BA, 0x8FA4C10B, 0xB57F2C32,
+   0x00000155, 0x9EA96C94, 0x599E10E5, 0x40593CE0,
+   0x4426DEB7, 0x2D48D29F, 0x948D9286, 0xC03F5CC5,
+   0xD3AD8E54, 0x219CD0D4, 0x53FE15E4, 0x0C8FC479,
+   0x03B91421, 0xE5AA96E6, 0xA023C978, 0xEDB69F81,
+   0xDEE00502, 0x000000B7,
+   0x6A7E545F, 0x3555F75C, 0x7A15BD6C, 0x1EA37A8E,
+   0x66F5C712, 0x188207A3, 0x4926901E, 0x0FC45BD9,
+   0xD34B1E01, 0xC55D2D8C, 0xD84F7268, 0xFC75E1AF,
+   0xBEC74EE3, 0xDED24E68, 0xB82806BA, 0x0F611682,
+   0x000000E2, 0xF1943440, 0x5454065A, 0xD01B257E,
+   0x88291BFF, 0xC6AE2502, 0x6EACA283, 0x8A74CBE8,
+   0x88F29CE0, 0xADCE5E80, 0x6DDB3AE9, 0xBD911187,
+   0x93DF4593, 0xA6B62E07, 0x16BDC203, 0xE8EAAC95,
+   0x3A0AD818, 0x0000011F,
+   0xEFB91DE7, 0x1F8215F9, 0x8A2F74D9, 0xF3ADD5D0,
+   0xA520D556, 0x56433008, 0x8628AC75, 0xB6DF83C5,
+   0x7390EEA0, 0xF3C38EA2, 0x6078A673, 0xB1AADF0F,
+   0x27B6B8FB, 0xA9E08328, 0xF3B7CE53, 0x22E64291,
+   0x0000017F, 0x6E69500A, 0xB3E7AE4C, 0xC441E02C,
+   0x740B9752, 0xF503D4A0, 0x3D04D6DC, 0x862F3496,
+   0x22490A59, 0xB2472177, 0x0F4A62AA, 0x79720C85,
+   0x668475B9, 0xED9B4FD9, 0xF6EBEB0B, 0x914E8BF4,
+   0x8A5A6926, 0x000000F2,
+   0x4C2A4CEF, 0x3D91EA60, 0x3DE838AD, 0x8DE8F69C,
+   0x538C37D7, 0x9A725723, 0x7948B4EC, 0x3923FA07,
+   0xD23E67F0, 0xD1A25D23, 0x396FBC50, 0xA2D7B9D7,
+   0x1D36F98C, 0x8F8504E4, 0x59191798, 0xAA9E5851,
+   0x00000147, 0xE3DB7296, 0x8EDBF0C2, 0x81FC8F30,
+   0x677A2996, 0xB727E6AA, 0x05E27B8D, 0x03113B4E,
+   0x4F5A9A69, 0x3ED42117, 0x9D4724E8, 0x72FCB859,
+   0x06C0B8A5, 0xAD040B87, 0xECDCF4D8, 0x8CDA9EB0,
+   0xE6BB9A0E, 0x000001D4,
+   0xD76B6346, 0x10D99B8D, 0xA7920F0A, 0x480C9BEF,
+   0xB706637A, 0x41953A21, 0xEF7A9469, 0xB5ADDD60,
+   0xBF845F04, 0xB066808F, 0x611F7050, 0x2C8D2C45,
+   0x79251581, 0xC9CFEA7D, 0xD23D024D, 0x000249D5,
+   0x00000027, 0x42E026E8, 0x9CA6F04F, 0x4C9B2714,
+   0xF09A7B4B, 0xD79C4D23, 0xA6E3C1B0, 0xBCB1CA2C,
+   0x5725F810, 0x24593118, 0x3D609E17, 0x74BD9A26,
+   0x73C465A3, 0xCA3FB6FA, 0xFA9EEEAF, 0x73CC366D,
+   0xE1976E95, 0x000000AB,
+   0x315A71EA, 0xC1776AD5, 0x874F2F9C, 0x1A923984,
+   0x1A632C4C, 0x8467D0E9, 0xDC5125BB, 0xBAD29DE6,
+   0xBD99E730, 0x13DBC6BE, 0xE96EEF3E, 0xB02BAE45,
+   0x9AC7A136, 0xB587375D, 0x9316B303, 0xAC9B1279,
+   0x000000F3, 0xC9E89959, 0x824A435C, 0xAA7F75BA,
+   0xDEA49D7A, 0x89B273BA, 0x4C1400B0, 0x5B2AC1FB,
+   0x14E0F356, 0x9DF3E52C, 0x4C10109B, 0x3EF9028D,
+   0x508D9DE4, 0x7E06E687, 0x03919BA4, 0x6A8AD120,
+   0x5FC75EF8, 0x0000012F,
+   0xE2B42C89, 0x66ACF9E0, 0xDF96AB0C, 0x0AC5D407,
+   0x2A609BD4, 0x160B1234, 0x018BF390, 0x175DD749,
+   0xEF953C4B, 0xAA6279B8, 0x96BB7BA0, 0x7488E739,
+   0x5B3B0558, 0x248C673D, 0xBCB7C973, 0x4C833A0D,
+   0x000001F8, 0x4D2CF409, 0x7BC20F68, 0xEFE3FEA4,
+   0xDF69707B, 0x73698DDC, 0xBB76FF24, 0x35CDEF99,
+   0xEA4EF14D, 0x09A8855E, 0x1B1E107A, 0xC05F8207,
+   0xAB7C0F94, 0xE49C7AE6, 0x41D7AC36, 0xA0FB9BB4,
+   0xC180FBDC, 0x000000C2,
+   0x3A726E03, 0xB4CB7440, 0xA8D459D2, 0xF5A2E570,
+   0xA183F45C, 0xBACA555F, 0x09DAF66F, 0xA66468C3,
+   0xA6457550, 0x0C775322, 0x23AFC0E3, 0xCDBF046F,
+   0x60D4B0B7, 0x701B1D3C, 0x436899C0, 0x40C08564,
+   0x000001E3, 0xF0179FDB, 0xEA712788, 0xC3E8C717,
+   0x1E4FA6B5, 0xEE1665F5, 0x91635FF0, 0x57FF8D6D,
+   0x71A79554, 0xC9764B15, 0xEF4486AC, 0x407A9D72,
+   0xF7279A54, 0x083F4AF2, 0x297F5EFE, 0x95C3D3D9,
+   0x082D870E, 0x000000CC,
+   //Window 49
+   0x8F1EF579, 0x1E226A93, 0x138FEDD2, 0x8AEEBEC9,
+   0x1CA4C4E2, 0xA7E39D7D, 0x49724F86, 0x5E53F86D,
+   0xEB759DB4, 0x9815987D, 0x0E9CD47A, 0x538C9F70,
+   0x1A7FAC87, 0xFFFC98C7, 0x7CE980E1, 0x3195776E,
+   0x0000019F, 0xE33CDCBD, 0xCCAB7B37, 0x855619D0,
+   0x561D18F2, 0x818F21D0, 0x56AA5963, 0x571C3C5E,
+   0x1413193B, 0xFD748C72, 0x9B30214C, 0x8EADF936,
+   0xEF0BD8D4, 0xD1964B92, 0xEB6D831F, 0x9BC42BEB,
+   0x4B37D5E0, 0x000001EF,
+   0x9A73EBA3, 0xF31853C9, 0x0E6E4613, 0x3FD88955,
+   0x32A3D4AC, 0x0F685BB9, 0x8CCA35FA, 0xAEAB0CD8,
+   0xEF18D468, 0x8F65C0F7, 0x09F0F948, 0xBD45DD25,
+   0x6BA83339, 0xFC2EA6E4, 0xAE6934CE, 0xF6F79E60,
+   0x00000158, 0xE60D9028, 0x3D279791, 0xF0C3CF4F,
+   0xC2CA4234, 0x85AC780A, 0xF21EC8F0, 0xE6FDB32B,
+   0xC2D9B19E, 0x0827C781, 0x9E2811FE, 0x49E61BDB,
+   0x42E15387, 0x414D6887, 0x936B8E23, 0xD7EDC198,
+   0x7FE54043, 0x0000008A,
+   0x886B7B20, 0xEF850C0A, 0xBB9943C6, 0x8F635025,
+   0x73EA21AE, 0xB81D4C7D, 0x99D3A6EE, 0xCB8F069F,
+   0xFA33EEB0, 0x6CF775A6, 0x8F96805D, 0x4E222F77,
+   0xA6141EA6, 0x143517AA, 0x167210C0, 0xE38A3C64,
+   0x00000116, 0x1FC78DBB, 0x0FB62F62, 0x6CAB326B,
+   0x2C641023, 0xF1549E38, 0xA72EA35A, 0x830F25CE,
+   0x537F6EA3, 0x33EEFB84, 0x9E079CAE, 0xB87DDBF0,
+   0x38C173BA, 0x7184AF77, 0x1B437389, 0xB1868BCC,
+   0xF978084C, 0x000000AE,
+   0xF4222533, 0x09DAC9ED, 0xFD65CF38, 0x241333A9,
+   0xAF69F2F4, 0xAA15ECBA, 0xE6AFA6E0, 0x680CC1A0,
+   0x5F6F8C82, 0x581099C9, 0x4DCAE40B, 0x32F94810,
+   0x4FF8175C, 0x0FAD007D, 0x5450471E, 0x5DFD3638,
+   0x000000BB, 0x9BEDAD5E, 0x57A1BD6B, 0x77139166,
+   0xB187EDE7, 0xD66AB437, 0x66AB56BB, 0x0875CC7B,
+   0x8D67305E, 0x2130FBAB, 0xD1221E1D, 0x0A435B57,
+   0xED448270, 0xF4089497, 0xEA5DA47B, 0xE8BFB1F6,
+   0x280B2CD4, 0x00000115,
+   0xC4AA5646, 0xC03F25C3, 0xF5058946, 0x86C63161,
+   0x2C02DA6B, 0x524D9F42, 0xD08CFC8F, 0xFFD709D2,
+   0xBD67D9AC, 0x1E8214F8, 0xA4953705, 0xFDB0716E,
+   0x637D647C, 0xCEE198F0, 0x1FC50C8F, 0x0EDA3341,
+   0x0000014C, 0xA26D80EC, 0x3771081B, 0x7EE1F2E6,
+   0xF495AC4F, 0xCC9F8790, 0x458ECDA5, 0x11D6C1D8,
+   0xA98F84AA, 0x7B694BD4, 0xE9D06799, 0x3EB0C3F8,
+   0x510A0F75, 0x40F2693D, 0x9747F31B, 0x5C3A8FDB,
+   0xA0879827, 0x0000014D,
+   0xA5F6CEDA, 0x31509AFC, 0x5010591C, 0x147406DD,
+   0x9341D9CE, 0xBC35C569, 0xBA35F50A, 0x7CE9ACE9,
+   0xEA9234BB, 0x19928AC5, 0x7FE039F4, 0xE036D398,
+   0x004965E5, 0x920FFCA4, 0x051A7E12, 0xD18E5104,
+   0x00000040, 0xA22366A1, 0xF5630CF3, 0x5CA6AB82,
+   0x52E3FF04, 0x053A65E4, 0x98B95576, 0x08B986A1,
+   0x8E7F4A1B, 0xE03A5DBC, 0x7E4F3C04, 0xA3CC2E38,
+   0xCA92D084, 0xEFCD06F6, 0x92EBFE5F, 0x5A709EAB,
+   0x88F060B3, 0x000000D6,
+   0x06456038, 0xB6A85B11, 0xD48AF4A7, 0xA422307C,
+   0xE781207F, 0x25C9835C, 0x67C18DCB, 0x61E1A5AC,
+   0x81F948F2, 0xE2943535, 0x0F7FB178, 0x427F9AC3,
+   0x2E2BB161, 0x2DC53C00, 0xB838B9F7, 0xDA0D1835,
+   0x00000122, 0xDF6800CF, 0x2E4D3E46, 0x55D86505,
+   0x66910D06, 0xF0D1ED6E, 0xAE5A0DD7, 0x84643A02,
+   0x0F3F3D6A, 0xEECF2E38, 0xE9D03F79, 0xEF3E2228,
+   0x8A7C07D8, 0x35A3F709, 0xBA7786AF, 0xD43DA7C4,
+   0xFF8997EA, 0x00000044,
+   0x8A90D8C0, 0xD2006FAD, 0xB872540B, 0xAE1A509A,
+   0xEA281ECB, 0x774048A4, 0x7A84CFC0, 0xA53EFEAD,
+   0x332CB313, 0x5D970194, 0x2866ED7E, 0x4B273635,
+   0xA3D68D32, 0xB646A148, 0xCF8B5D7A, 0xFACA3712,
+   0x0000011F, 0xC789ACF1, 0xC726FBC2, 0x93F6D7F4,
+   0xABF50958, 0x8791335A, 0x5C9B593F, 0xE5E84484,
+   0x83523E7D, 0x9F06EDAC, 0x5DCCAB39, 0xBC2CD75E,
+   0xCB72C6D6, 0x2638469F, 0x5038AF21, 0x54B0DBA0,
+   0xFA7EBA19, 0x00000165,
+   //Window 50
+   0x7468E327, 0xFD026128, 0xEE755906, 0x789E8DC4,
+   0x80218C94, 0xEA0453E4, 0x088D7C56, 0xE263FE27,
+   0x30277200, 0x9219CEE6, 0x8CE5AD85, 0x293401D2,
+   0xB960EBBA, 0x627036D3, 0xF92DA0EA, 0x8BE032FE,
+   0x00000030, 0x9DAF8D6D, 0x7AB52E73, 0x3F789F6C,
+   0xD6D75D4C, 0xBFC9A31E, 0xC3B7560E, 0xD7DB7AD5,
+   0x87B7F183, 0x9C213425, 0x0F60A2DB, 0x52C58981,
+   0xC2E67C94, 0x1B6D0B43, 0x001CF3E8, 0x78235B3F,
+   0x31EFA39B, 0x000000CE,
+   0xD2A1F241, 0x22D8C3C4, 0x8ED2C14B, 0xCB605515,
+   0x2939F855, 0xBD634A2E, 0x1E9519B4, 0x30B2B6B9,
+   0x08A31D22, 0x19911C00, 0x979CD33C, 0x60B0713B,
+   0xB94F9B61, 0xF41A8ABD, 0xEF72CF1E, 0x3F2D8C91,
+   0x000001B4, 0xD78B56EE, 0xF0ACF9B3, 0xE915A265,
+   0x12112D24, 0xC1D7025F, 0xA18C93AD, 0x2E652107,
+   0x279A4DB8, 0x2BFFB5DA, 0xBCA73AD0, 0xE2D168EE,
+   0x2CDFEEE4, 0x5A4ACA12, 0x6D83A77F, 0x1D22E8F4,
+   0xC203514B, 0x000000F8,
+   0x43F7453A, 0xD5B0D5A4, 0xBB43D3A8, 0xF96B7FFB,
+   0xD0C86229, 0xB61C49F2, 0x8D18B4C1, 0xB37D3160,
+   0x2379514C, 0x7A18F0B9, 0x0E440995, 0x8A7BF63C,
+   0xD77C09B2, 0xDEEF9EA1, 0x364ED115, 0x3901E8B3,
+   0x0000012A, 0xE5A32971, 0x66888CF0, 0x7A9C3886,
+   0xA1E4C1BB, 0x64822F55, 0x19F73884, 0xD925D4FB,
+   0x7C31E97A, 0xED044B10, 0x131BAAD0, 0x589074E5,
+   0x2477A6B3, 0xD8E1044B, 0xBC5CAFFF, 0xB14C4291,
+   0xB8D26D09, 0x000000D8,
+   0xEC5BA37E, 0x007BFFC0, 0x154F22FC, 0x8A9B51AC,
+   0x25F8E4C5, 0xD54FDBF5, 0xDB848843, 0x90DD4FFE,
+   0xF05ABCC5, 0x428E6E53, 0xB8DBE8D0, 0x37801AA6,
+   0x97B4D76D, 0x9C4C0292, 0xF8F667E6, 0xA5970346,
+   0x000001FA, 0xB42D2421, 0xBB69FA25, 0x28B20798,
+   0xF2AB0C5F, 0x02996989, 0x1EDF762A, 0x01C8F5EE,
+   0xD2CFC47B, 0x6913E414, 0x427D7D5B, 0x12920CCB,
+   0x12B1CD40, 0x5F552D45, 0x04443F3F, 0x6EB463B5,
+   0xB3B0D58F, 0x0000005B,
+   0x203D3B51, 0x32A2AA64, 0xE4826DD9, 0xF0D8F978,
+   0x08B1E0A0, 0x5B2DDAE3, 0x68984128, 0xAE0573A9,
+   0x8BF3A344, 0x1855BFE4, 0xFCF6160C, 0xA6B7EB6A,
+   0x8AC1B173, 0xE83644FD, 0xBBA4AC0D, 0x401AC6CD,
+   0x0000003C, 0x79EFA1CE, 0xE55E7B76, 0x9010F35E,
+   0xF2F329EB, 0xE98A6C48, 0xFF22DB9F, 0xC1C134C1,
+   0x3620D337, 0x38991F57, 0xE406000D, 0xDB34389B,
+   0x79FF983E, 0xBB1431C4, 0x38D6D3D1, 0x42EB89F2,
+   0xCE14CC11, 0x0000003C,
+   0x2D02DC14, 0x3A5F2C02, 0x00F1CEB1, 0x44985629,
+   0xE7A78555, 0x326BEC51, 0x04D9BA2E, 0xA74B0891,
+   0x80314109, 0x44B8829C, 0x820BF675, 0xE62A0E41,
+   0xFEAB4BF7, 0x3BE1084F, 0xC9164C21, 0xA1655365,
+   0x00000082, 0x6E327EEE, 0xE699E9A5, 0x4FD40F59,
+   0x4B23BC7A, 0x2ECE5156, 0xD65FBAAA, 0xB2C1FE79,
+   0xDF8AC059, 0x307FDCE2, 0xFB1ED16D, 0x3531ED21,
+   0x7627AD6B, 0xD9E0F7C3, 0x39010E8E, 0x7E783223,
+   0x486FAFCE, 0x000000E7,
+   0xDC2A3114, 0x68D61A80, 0x780B31CC, 0xF8D5F56A,
+   0x486B4B7B, 0xE63B8739, 0x80E002A1, 0x2B82BD39,
+   0xA4FB662D, 0x20B9403F, 0x5BEA3101, 0xE8515035,
+   0xD2939D5A, 0x066C8724, 0xDA98F9FE, 0x5D3D400F,
+   0x000001D9, 0x8B5C9489, 0x2E766A46, 0x13B49FC0,
+   0xE8289E72, 0xDA57FAAD, 0xE8803FC9, 0x1E07512B,
+   0x4F67D033, 0xADAA1224, 0x3D850293, 0xB241DE49,
+   0x4649CBC9, 0x642F0382, 0x82B14A1A, 0xCAC20C01,
+   0x01D09209, 0x0000017B,
+   0x6CA433D8, 0x402F7DF7, 0x3CFE61A8, 0x82B0C66B,
+   0x43062A7F, 0x46E016B8, 0x975E3563, 0x1B5A2DE5,
+   0x9A7FEC08, 0x47A8956D, 0x8BE0557E, 0x7DF651A0,
+   0xC0B33D07, 0xFEE8F682, 0x13E03A8C, 0xD92B59BF,
+   0x0000012C, 0x86483788, 0xA3A81FEE, 0xD7507EC9,
+   0x9C6052AE, 0x8C8290BD, 0xED2EE49B, 0x60AFF68E,
+   0xEBFD06DA, 0x09CC9BA2, 0x0EBC9C11, 0x3BF24667,
+   0x36EE290B, 0xBF75C490, 0xEBEBC4CA, 0xD33489BD,
+   0x862F9F78, 0x0000002D,
+   //Window 51
+   0xBDEC6EFB, 0xE7BFC99F, 0x67326C7B, 0x2BD3D26B,
+   0x594C614E, 0x23F041FF, 0xEC9B4420, 0x5A778C67,
+   0x30EAA444, 0x75B5618B, 0xAE6D50A4, 0xF8E2BB92,
+   0x1FDEB6F0, 0x7278C60B, 0x97C654CC, 0x5B8471DD,
+   0x00000139, 0x3E959CA8, 0x115A8112, 0x8BED7EEE,
+   0x13DC4AA3, 0xEF94C5FD, 0x02340F86, 0x99A5D5CC,
+   0x519293A4, 0x294349A0, 0x09573381, 0xDA33B39F,
+   0xDEFE063F, 0xA382A806, 0x6A18640A, 0xD227A86F,
+   0xB3E25FDB, 0x000000D3,
+   0xAC49D960, 0x1499FF98, 0x3940FF6F, 0x98F7925A,
+   0x743F2CCD, 0xF6C696DD, 0xEF310A73, 0xE7C6C272,
+   0x91AD1858, 0x4029492D, 0x483037CC, 0xA2E65AF9,
+   0xD3453348, 0x080C3FD0, 0x068380C0, 0x4A1F9803,
+   0x000001BC, 0xD9DC2514, 0xA39427DD, 0xB2A91D48,
+   0xE0F733EC, 0x29219E28, 0x0144D74F, 0xE3FC6C5F,
+   0x25DDCC92, 0x91F871E5, 0xB90E3713, 0x81A245CA,
+   0x3F763ADB, 0x2F3E2323, 0x1FC6A149, 0xB41F0B93,
+   0x92CC2090, 0x000000A7,
+   0x1FE5F835, 0xF5FE39ED, 0x164E9741, 0xE17A6FB3,
+   0x0F1180E9, 0xEB9A084A, 0xA1174F31, 0x95F55D56,
+   0x03850AC7, 0xC33FA3D1, 0x6E0DDD06, 0x15A29BAC,
+   0x36F2F29E, 0xB80A0B78, 0x67CDE67A, 0xE5D8DDF4,
+   0x00000133, 0xC5EE0DD4, 0x1767C74C, 0xD7E4BDDB,
+   0x1D61299B, 0xFA74FB11, 0xF4D89A2F, 0x0037FB90,
+   0xE8A63C4A, 0x7800EC4A, 0x30FCDB04, 0xD490DF3B,
+   0x49A1E298, 0xDA5ACAE7, 0x3D3510A2, 0x78CE9832,
+   0x2D4184AA, 0x00000024,
+   0x0741634E, 0xDA963DC9, 0x6A62E31D, 0xC2B6B3CC,
+   0x926A9817, 0x726FFDB0, 0xA7A05347, 0x2BC8A0C6,
+   0xDAD1F7A5, 0xB440BEF6, 0x666EBFB7, 0x96AE7CB3,
+   0x6955BBA1, 0xF3B41EA3, 0xB1869190, 0x2ED577FF,
+   0x00000025, 0xB188B5E5, 0xCD5DC527, 0xCE6E943E,
+   0xA3FA5778, 0x22DAF81F, 0x463B9AA8, 0xDFB44926,
+   0x2A0544EF, 0xC5F56C83, 0x7C78F0E5, 0x87A0CACF,
+   0x83A5552B, 0xF491AFFE, 0x8A5A5CDB, 0x1B8398D3,
+   0x419BA884, 0x000000BF,
+   0x3B2B4777, 0x11DA1673, 0xEE05ECA4, 0x0DA01F6B,
+   0xB5C102BF, 0x4A39B2C1, 0x0180ECAF, 0xB1C398F4,
+   0x88C87533, 0x0F340765, 0xC3C66289, 0x0C47914A,
+   0x0DD34C31, 0x3696A6FA, 0xA368C6D7, 0x81E365A2,
+   0x000001F0, 0xBD408342, 0x840B207F, 0xFECE17E0,
+   0x30261282, 0x3DA41FB8, 0x40257C9F, 0x3B1AC31A,
+   0xA4CAE760, 0x594F704C, 0x5FBCFF5F, 0x85314299,
+   0xE351CEFE, 0x12B975CE, 0xE22CB75C, 0xAA5CAC15,
+   0xB1F453D9, 0x00000004,
+   0x9F66BF23, 0x127344E2, 0xC3FF9B2A, 0xE5072714,
+   0x571E9D32, 0x9AA6B001, 0xE6738A5D, 0xE92E4AE6,
+   0x433DEFAB, 0x4616E315, 0x0B892330, 0xE1309A4A,
+   0x1ACD85A9, 0xDE5F54F8, 0xA0013A39, 0x6615D532,
+   0x000000B2, 0x1948C112, 0xAE7FE946, 0x5FC94EEF,
+   0xABA4B1F2, 0x2EEBEEDF, 0x62234460, 0x8C0C8AFE,
+   0xE9794E6C, 0xAA7D5990, 0xA2DBAC68, 0xD07E966C,
+   0xF59D5A7A, 0x4490BB8B, 0xC301F133, 0xFAC91F14,
+   0x05102377, 0x00000076,
+   0xEEA1B609, 0x5D942F48, 0x5D45821E, 0x5B5928F5,
+   0xE4334D8C, 0x4E902A63, 0xFD9C133A, 0x9487288D,
+   0x0562AFA4, 0x076583EC, 0x847620A8, 0x15AC51CE,
+   0x6BB7DB20, 0x75614DCD, 0x79817A3C, 0x61B4F0AC,
+   0x00000135, 0x17E1ADE5, 0xAFA3DB29, 0x303A98A8,
+   0x34C874F1, 0xB21AA653, 0x46A0324D, 0x5845D604,
+   0x6BBD6E14, 0x4C41DA8D, 0xA08A6442, 0xD381C0BF,
+   0xA86F0ECE, 0x6177267E, 0x680383DE, 0x2EB78F7A,
+   0xD8A8C02C, 0x00000182,
+   0x3FE8F109, 0xB22B6DF5, 0xC00EDCD4, 0xE4AE50E7,
+   0x6387044C, 0xBF891CE3, 0xD08FB385, 0x0716F49B,
+   0x54934B45, 0x0EFBE8C1, 0x982F659D, 0x08E66176,
+   0x91962A9E, 0x042CE736, 0xA2974528, 0x1F08748C,
+   0x0000006E, 0x6B9AF5D7, 0x8FA7ABDD, 0x978B04CC,
+   0xAA2FBF79, 0x7F3136B7, 0x4EA61BAE, 0x150CAD9C,
+   0x406B670E, 0x08AA96F6, 0x22BE2A1B, 0x566C56D7,
+   0xFFCC680D, 0x9A111236, 0xE6520781, 0x69D2E843,
+   0x940AEF1C, 0x00000062,
+   //Window 52
+   0xC4C762BC, 0x0FC6C549, 0x4E5EB96F, 0xC43915E3,
+   0xD1BB0B5B, 0xAD88EE68, 0x3F1F26A3, 0x484A9FAD,
+   0x2BC15E9D, 0x0D93055C, 0x06D26BB7, 0xA745ABBB,
+   0x464F0731, 0xF60ED3B8, 0xEA9058BF, 0x963D8D94,
+   0x00000039, 0x7B67B298, 0x4608AC08, 0xC85CF812,
+   0x3BAF2AE6, 0x0D25BEDF, 0xB30AEC55, 0x7CE48459,
+   0x58149350, 0xD3C41E2D, 0xFCB39F45, 0x126E11A7,
+   0x48D241A0, 0x909A1621, 0x7B425421, 0xE746BF4B,
+   0x9BB349DD, 0x000000AB,
+   0x10392DB1, 0x9DE5C6D8, 0x7912DAE2, 0xF58B3C58,
+   0xC559FD2E, 0xA367F217, 0x466A352B, 0x78F2AABB,
+   0xE8271660, 0xFF58D1A3, 0x8BD06035, 0x0D06FA5B,
+   0xFEA2895A, 0x026934B2, 0xB7E1A1FF, 0x99899ABC,
+   0x00000187, 0x55BB32EC, 0xFD0BCBB3, 0x7F5D72D8,
+   0xAC96A04D, 0xD939D606, 0x0D5626E3, 0x04504A8B,
+   0x145BBEF6, 0xE4132C27, 0x4D946B4E, 0x3EC1CFEB,
+   0x4E7887FB, 0xE1D6E0E6, 0xEDEBCC5B, 0x2BF4379C,
+   0xEB42BD23, 0x000000FA,
+   0x632B1ECF, 0x971B8F03, 0xE4B06088, 0x4052AE98,
+   0x5AEE5313, 0x323C3E29, 0x635E62C0, 0x7574C5DE,
+   0xF0595C76, 0x2F53804C, 0xBF3BC3AF, 0x2ECD2BC5,
+   0xFABA7271, 0x5C7EFEC0, 0x867C13BC, 0xDB04A6EE,
+   0x00000155, 0xCE3FF1E4, 0xD971CB39, 0x7F56172F,
+   0x15D128CB, 0x4B6EE708, 0xA1DF4ABB, 0x3C9EBBEA,
+   0x06A4BC6C, 0xB3FA98D4, 0x766544EB, 0xA2C44D89,
+   0x78399E61, 0xA25D711D, 0xA6EF214C, 0xDB54091B,
+   0x643648C3, 0x000000BD,
+   0x0F694063, 0x4DC3246F, 0xAEBD3125, 0xED3DD53C,
+   0x0E985D76, 0x9B3BE97F, 0x9A5EC60C, 0x37EB09EA,
+   0xF0C7D07C, 0x14FD9893, 0x7FC04709, 0xE085E642,
+   0x80FC7AA4, 0xD56DB4A7, 0x4398A2C4, 0x16ECF07A,
+   0x000000BA, 0xF48054E8, 0x672219F5, 0xC56E157F,
+   0x116743EE, 0xFD5885C4, 0xE9B616AC, 0x1BBE92E4,
+   0xA9DBC3E3, 0x1FB4DD56, 0x0E3BC901, 0x590246F5,
+   0x51D3A59D, 0xFDBADCE8, 0x6B003576, 0x09A1973F,
+   0xE8DDFD6B, 0x000001E0,
+   0xB256556D, 0x5A24D834, 0xF63C1DF8, 0x6E39E6B9,
+   0xF481C4A9, 0x6DC4ED5B, 0x387BB7A6, 0xDEF702A2,
+   0x2A3A8D3B, 0xEDD61BBA, 0x76598B94, 0x7727A946,
+   0x8C5DFE3C, 0xCE2BB30C, 0x5CBB743F, 0xDD17E4DA,
+   0x000000A9, 0x7A2C22F6, 0xD333E98D, 0x6F67D8AF,
+   0x94D66690, 0x4466A868, 0xD7EDE2CD, 0xE092C972,
+   0x3897004C, 0x30A617F5, 0x1003A6D1, 0xFB55C4B4,
+   0xD167F6E5, 0x22377313, 0xBE825364, 0xBAB6EDE9,
+   0x4E1D6368, 0x0000019E,
+   0x65841D0A, 0xD6A82C97, 0x0D7552A1, 0xAB5206B0,
+   0x23E31563, 0xC998B6E6, 0xE8866040, 0xBA00726B,
+   0x64648DE5, 0x34572DC3, 0x6ED070FE, 0x68D725CE,
+   0x4C4E86EB, 0xED54A126, 0x35D1B360, 0xD124DC8E,
+   0x0000002D, 0x65DD26DD, 0x35EC7CC1, 0x5813D0AD,
+   0x9C7C68FA, 0x165C0DFE, 0x8CA6197D, 0x0BE67F55,
+   0x83076790, 0x86FAB7B8, 0xC81F6CCF, 0x5EFF5E12,
+   0x11BCF829, 0x36E20E6D, 0x443EA517, 0xD762B952,
+   0x35AF3228, 0x00000080,
+   0xB1216CE4, 0x8117F853, 0x5D41EF4F, 0x98AB6223,
+   0x57C7E4C1, 0xC92A77A2, 0xB54180F6, 0xD8A5B415,
+   0xE06D316D, 0xF0125978, 0x76B2CD06, 0x4FC93522,
+   0x24F61F6E, 0x98DB80B1, 0x17CB49B1, 0x830572B9,
+   0x0000008A, 0x07419F5D, 0x4AD48B1B, 0x365D33D0,
+   0x2262398C, 0xDA9E2455, 0xF3DE22D7, 0xDC79026E,
+   0x766B6119, 0xC35A7A0D, 0x7A9ECAC3, 0x689C9FD0,
+   0x96918899, 0xB3B787EB, 0x9C52D485, 0x1DC27891,
+   0x40325996, 0x0000017D,
+   0x3B27C2E1, 0x28CD5790, 0xCB936251, 0xBD719855,
+   0x75C25C6C, 0x41383EF1, 0xAD562C40, 0x4D866B56,
+   0xD8061011, 0x58AB134B, 0xC2527684, 0xF57D5AF2,
+   0xA9488268, 0x27E7CD9B, 0x95FC6B3C, 0x501825D3,
+   0x00000040, 0xEB68A11A, 0x89926079, 0xD201EF86,
+   0x0F240BF5, 0x4FDB1E0E, 0x11F38E08, 0xD09F6682,
+   0x551C189D, 0xF4D489B5, 0x1DFE94A3, 0x052752CA,
+   0xE1631CE0, 0x6FB98A0D, 0x3B0629AA, 0xEA475E6D,
+   0x13AE4507, 0x0000016F,
+   //Window 53
+   0xD90119AE, 0x2BAD7686, 0x464B230C, 0x8DCD64F0,
+   0xDAD19CB1, 0x1D1EEB94, 0x86F0EB48, 0x3B470389,
+   0x2C50F380, 0x42ABB37D, 0xA7A99EB1, 0xFABBCEBB,
+   0x33FB0B08, 0xFEED69DD, 0x31DC2B1E, 0x8DE8B50E,
+   0x00000057, 0x054ED7A9, 0xE10DC8A6, 0xCF39BEC8,
+   0x7094FC36, 0x25848527, 0x487789A8, 0x39974124,
+   0x8786EAA3, 0xA6E3E5AB, 0x47A0D6B0, 0xE981E517,
+   0x54ED0B21, 0xE768123B, 0x85CF17EA, 0x636E78C6,
+   0xD9A933B0, 0x00000127,
+   0xDF234E4E, 0x4B736D32, 0xD14BED77, 0x66237D17,
+   0x4DDE4942, 0x552BAA3E, 0x23756FFC, 0x947169DC,
+   0x6749EED0, 0xE595F264, 0xE3C8EC5F, 0x2ED82E6E,
+   0x495B60A0, 0xD52DD4BC, 0x40553CFC, 0xCCD7A2B3,
+   0x000001B7, 0x889FBDA2, 0x9DE7E73E, 0xC02A698B,
+   0xEB68C0D9, 0x1510C24B, 0xC433363B, 0xE2AF686F,
+   0x329F6B4E, 0x3CD6CBD5, 0x3BF95CB3, 0x39E49B52,
+   0x2C9924B3, 0x3E1AE491, 0x3A4322BB, 0x504F582E,
+   0x3EFB3B85, 0x00000150,
+   0x7BADAA12, 0x63C83543, 0x93D1298F, 0x2929FBF9,
+   0xA6D3C271, 0x22D8A8E5, 0x6CC70FEA, 0x4361A096,
+   0x0B060761, 0x4C169892, 0x7B83B19A, 0x43B3A57B,
+   0x5D1E0382, 0x8E4E16ED, 0x01FB83B1, 0x1C4596C1,
+   0x000000D2, 0x2D0878BB, 0x571E0F7A, 0x3BA6448B,
+   0x28EFBF80, 0x3F53EC10, 0xC49EADD5, 0x9B6B85B6,
+   0x5F67C579, 0x0F279676, 0x999676ED, 0x129E0870,
+   0x62BA191B, 0x21475E41, 0x5F0823B6, 0xF2C8B56B,
+   0x8BC381AD, 0x00000164,
+   0xE34E4C6A, 0xEA0D44C4, 0xE8B02105, 0x6F50243D,
+   0x796C212C, 0xEDE2B16C, 0x42A087C6, 0x3F7169F2,
+   0xA4762CDC, 0x33FA8470, 0x13FFC120, 0x05F65DB6,
+   0x4FB1C4F7, 0x9BF29F3F, 0x45433134, 0xEF4CA473,
+   0x000000F8, 0x331968BC, 0xE59DA628, 0x6946B696,
+   0x3FBF6BC4, 0xF82EF2AF, 0xEC6AB1D7, 0x260BB4A9,
+   0xD0423E4F, 0x1D44CBF6, 0x956FEF51, 0x8E5195C9,
+   0x26F86122, 0x5DACA40A, 0xBE8B410C, 0x9D08BDAD,
+   0x3FAC01F2, 0x00000104,
+   0xA4B8ECDC, 0xFBFA18BF, 0xFA7C7C3D, 0xDB161F18,
+   0x24A21F6C, 0x1EC53BAD, 0xF4F6CE31, 0x3E5343AA,
+   0x1B669758, 0x8AE86FCD, 0x7BEFD9BE, 0x394B964B,
+   0x5C60A585, 0x84B25AF4, 0xA5888FFA, 0x02AD7F6B,
+   0x000000D1, 0xC83FB0AE, 0x0B86E101, 0xD2B8E139,
+   0x6E16E6E6, 0x0333FAF0, 0x29425FB6, 0x0CEB6480,
+   0x8D0D9AD2, 0xB3E18AD7, 0x9249E8D0, 0xC94D5491,
+   0xAE3B935B, 0x44260B3A, 0x06FE7F07, 0x39EC64D8,
+   0x1D8AF883, 0x00000158,
+   0x888F4BFA, 0x7F7941D9, 0x476BC929, 0xC4F99685,
+   0x8E853CE0, 0x3F73018D, 0x34FDF8E9, 0x68A86F61,
+   0x2A6FB200, 0x7C88B031, 0xF6911821, 0x3BAB6755,
+   0x88917FC6, 0x06B84C17, 0xF5254039, 0xA9F91561,
+   0x000000DB, 0x6DD119D8, 0x76C52293, 0xEB1CB340,
+   0x6571DD2B, 0x3A33B42B, 0xC66E8C82, 0xFC43DDFC,
+   0xAF289EBE, 0xED2B085B, 0x203BBA75, 0x8176F169,
+   0xDB1D8604, 0xD91AFE68, 0xF762FBE0, 0x2026CF1C,
+   0x7DD617AF, 0x0000005C,
+   0xF1B7C167, 0xFE4CD502, 0xDAB47F91, 0x679FADC6,
+   0x3037E209, 0x1BF2BB51, 0x822E8A02, 0xD9EA6D92,
+   0x30CCB948, 0x7A2A77D5, 0x29A7A46D, 0x6FDE6280,
+   0x1BD2BDC9, 0x8B71CB73, 0xA3C0CA96, 0xAF8D591C,
+   0x0000004A, 0xD852C164, 0x63FCC569, 0x4F07D6F0,
+   0xCA720276, 0xE7DC1581, 0xA7E6E11E, 0x440980CC,
+   0x325D3921, 0x148A56A4, 0x098BD53A, 0xEBC5E005,
+   0x4EEA0C37, 0xB9773A5C, 0x89434AC1, 0x75CAE957,
+   0x97BD03A8, 0x0000017E,
+   0x5DC2AA4A, 0xA10CDA06, 0x05AD6CBE, 0x89D874E6,
+   0xD061DA12, 0x7D51BFD5, 0x376141D4, 0x457D656C,
+   0x1A715C73, 0x36CED50A, 0x1D27223A, 0x252B0B02,
+   0xE2D6E01E, 0x053AEF6F, 0x32716027, 0x8096C5E3,
+   0x0000013F, 0xCD3635DE, 0x1864A030, 0x59CC5701,
+   0x5AA25DA6, 0xFF2BCDD9, 0x8AF63026, 0x17C277FF,
+   0xEBDB7F17, 0x758B7979, 0xF94D8299, 0x09BD3EB9,
+   0x38025E00, 0x5BD5C30A, 0xF7C4C29E, 0x52F90B3B,
+   0x202201C7, 0x000001D5,
+   //Window 54
+   0xF6D20ECA, 0xEC9A8956, 0x684E0169, 0xEDA0A24D,
+   0xE583C40A, 0xA55AE258, 0x455D3CE1, 0xBE8C6286,
+   0x2096AE62, 0x05BF6313, 0x20B48BDE, 0xF68E0249,
+   0x4D99CD14, 0x1B6595BC, 0x774958BE, 0x0E740830,
+   0x00000030, 0x9FD73274, 0x3241B0DF, 0x8FE5A5DD,
+   0x7B653239, 0x38412A8D, 0x2D4DD56E, 0xCC58A62A,
+   0xE2925F33, 0xF5CEE12B, 0xB859EA32, 0x7C25D1D2,
+   0x5AF7C402, 0x6F196E55, 0xE172CEC1, 0xDE00641C,
+   0x34815491, 0x0000010B,
+   0x4E7E98F2, 0x80CA977C, 0xCD7A9AE3, 0x0A0BD3D8,
+   0x8EE369BA, 0x122C33DA, 0xDFE25A99, 0x340A8462,
+   0xCBDBC904, 0x79FF5C18, 0xF1818B44, 0x0BC05B6C,
+   0x77E9157E, 0xFE9F3C65, 0xA1064D23, 0xCA1717C7,
+   0x00000051, 0x6A365B28, 0xCE8ECCB8, 0x73819001,
+   0x6208E872, 0x015365FC, 0xC774AB6F, 0x9F9D80BC,
+   0x22339223, 0x52E59382, 0x1C008664, 0xEB747619,
+   0x28D7846B, 0x56F1B541, 0x44AFB844, 0xCE7504C4,
+   0x161BD257, 0x0000013B,
+   0x6E98D8D9, 0x8A810058, 0xD4B641C6, 0xF61EB17A,
+   0x48D88066, 0xAF5FF280, 0x525A6863, 0xB74D5092,
+   0x90D44C03, 0x41F2166E, 0xAC397C83, 0x40CFB825,
+   0x67F050F0, 0x873F9A60, 0x3B290DD7, 0x5F7A12A3,
+   0x00000170, 0x4CE77C04, 0xC4E73DE8, 0xD20DA7E5,
+   0xD9EDE081, 0x61C3E3B1, 0x049A706F, 0x1180CAB8,
+   0x2F9EB2CE, 0xF1041068, 0x04128D8A, 0x8542062E,
+   0x0D480B12, 0x2EA578E1, 0x1ACB604F, 0xA2A8E97B,
+   0x636A4F2D, 0x000001A0,
+   0x0D46AD1F, 0x4AA44435, 0x66460711, 0x3E30D952,
+   0x859419F8, 0x49A9ABF1, 0x54D20A3E, 0x75804950,
+   0xEC3E54EA, 0x1FC9C16C, 0x407F5314, 0xA40B0D69,
+   0x0C5ABFA3, 0x97329397, 0xCE6D2457, 0xA5128890,
+   0x0000010D, 0x32452B45, 0xD6BF1962, 0x6DE3A847,
+   0x9FD7A448, 0x5ED5C47E, 0x3E4CDF08, 0x2364C81E,
+   0x29A69301, 0xAC3E4BDD, 0x942DE3E8, 0x6076A4DE,
+   0xDAFFF8DC, 0x77829D01, 0x2AF83211, 0x1F3358DF,
+   0x5D3D4369, 0x00000015,
+   0x0043E22A, 0xE31D208E, 0x1DB48D74, 0x47862D4E,
+   0x279B4F8D, 0x3BC86E99, 0xFC3AB597, 0xB74345E7,
+   0xD0D86BE7, 0x0957320F, 0x02F3862A, 0xDFAC8507,
+   0x76D03825, 0x402A49A7, 0x493E7D8B, 0x736F0E04,
+   0x00000172, 0x4680D6DE, 0x1F6862A8, 0x46A27EED,
+   0xBC310873, 0xA16D4660, 0xD6694888, 0x931F0F65,
+   0x75F91BC3, 0x686EBF65, 0x04EC7B58, 0xC3FCA400,
+   0xF80D6FC3, 0x262CB38E, 0x7E0DD84C, 0x8F222FB9,
+   0xF41EA7DF, 0x000001AF,
+   0x4A46138B, 0xAC180DC4, 0x7156CBE4, 0xEC88269B,
+   0x456688C1, 0x5FEA4E6E, 0xAD2A8B83, 0x11B90FB8,
+   0x97CEAE59, 0x5B087A33, 0x4E5E4FDB, 0x1F5AE400,
+   0xAF394C93, 0xF5303955, 0x5EDC79EE, 0xAD329CCA,
+   0x0000015D, 0x257AE3FB, 0xB8CEEF2D, 0x90F39767,
+   0x32DC201F, 0x49D8B173, 0x45114BEC, 0xE99E6516,
+   0x729EA6CE, 0xCECDB32E, 0x3307D11C, 0xA83848B1,
+   0xC30F1BC2, 0xDB265ACB, 0x22873D0C, 0xCCB90FFC,
+   0xE816F4A4, 0x000000A9,
+   0xB176719C, 0x1BCCCC5F, 0x9C78FEE2, 0x581464AD,
+   0x29C1F187, 0x81EE8C35, 0xBD76A8DA, 0x751D08AD,
+   0x18F1E8CA, 0xA6D95575, 0xFAC80570, 0xAF1B4D6E,
+   0x7EF47FBB, 0x1EC245C0, 0xFED120FB, 0x27D20F06,
+   0x000001BA, 0xBA257F4B, 0x6A34E57E, 0xD4E31FAC,
+   0xD3B7E492, 0xAFA245B4, 0x0F1873B7, 0x59453554,
+   0xEE08DC49, 0xEFC6CC7A, 0xE51FAB0B, 0xB29CD7F0,
+   0x913E414E, 0xAF773928, 0xCFA27845, 0x0C259DD8,
+   0xCDC15774, 0x0000018E,
+   0x4150918F, 0x23285132, 0x41CDF564, 0x855B7B35,
+   0xF0637183, 0x35FEF624, 0xDEF871EF, 0xB49D6851,
+   0x80366D0C, 0x94F2C39F, 0xF0DC00A0, 0x221FCE35,
+   0x2249779B, 0xB4AF81F8, 0x19984EE4, 0xF00275A8,
+   0x00000036, 0x90C8D67B, 0x3CF7B1A7, 0x25B36499,
+   0x4B86CF97, 0x6AD68698, 0x69A209D6, 0xF9E23536,
+   0x92E7442B, 0x5FBCBB9D, 0xFD2A386A, 0xF5F29B8E,
+   0x392CDD75, 0xC318F122, 0x265CC96C, 0xC72DED64,
+   0xB6CBCF9C, 0x00000012,
+   //Window 55
+   0x24ACB1FA, 0x36CDC3E6, 0x6C6D43AD, 0xF593D32D,
+   0x373C8E18, 0x766C2FCD, 0x3D12B7F3, 0x0A151836,
+   0xB4234A24, 0x924427F4, 0x2335FF44, 0xAAB87785,
+   0x7C362011, 0x9E581189, 0x5EE724DB, 0xD86F8FBA,
+   0x00000184, 0xC9558569, 0x25F04ED9, 0xEF9562C5,
+   0x0A315324, 0x9CCEFB92, 0x65A02A28, 0x88115608,
+   0xB2429DD4, 0x641D646B, 0xC1714C93, 0x48BB144A,
+   0xBA4D3691, 0x9EFA3A6F, 0x48EC2D9D, 0xF1A93AE3,
+   0x5FF6A4FB, 0x000001ED,
+   0x2C825D50, 0x8B2F31A0, 0x0B3DD67A, 0x5FA4A38E,
+   0xDD220E0F, 0xCC07EAFE, 0x53666CD5, 0x3A8496F8,
+   0x116DA23E, 0xF1E8B23E, 0x1631080D, 0xF48DE9F4,
+   0x4139C8DB, 0xCC327445, 0x1DBE7C3D, 0x3270CE0A,
+   0x000001C6, 0x5054F6B3, 0x21089578, 0xD94BF609,
+   0x8295EC2D, 0x854941F4, 0x1922BDBA, 0x357020E9,
+   0xA95EB4DE, 0xDF0D7747, 0xD15FE663, 0xFF86B9CE,
+   0x89CA6DB1, 0x4F1A6D6D, 0xC3BBAADC, 0x8A0C471E,
+   0xDEAB3F65, 0x000001BC,
+   0x8F3756C2, 0x67745082, 0x0A7BFCC9, 0xABF1E75D,
+   0xB8BAD3AF, 0x047931DB, 0x5E392278, 0xA380C985,
+   0x0237D6BC, 0x5195E47D, 0xFEE7427C, 0x8C7EF452,
+   0x585B6365, 0x4F078DD2, 0x1E10D24E, 0x4E82EB4B,
+   0x000000D8, 0x610B349B, 0xDA54DC52, 0x904633F2,
+   0x96746E43, 0x2C50AA46, 0xD2A58F33, 0x987F9FC3,
+   0xFFEA4D06, 0xCC521553, 0x5505265A, 0xC316DF83,
+   0xAF2B7DA0, 0xEA362ECB, 0xA74F09B1, 0xA2E1F4F5,
+   0xCF9F0AC3, 0x00000078,
+   0x3BB93EAF, 0x17100A61, 0xD80AC200, 0x7CCB5BF3,
+   0xEAB320C3, 0x585D17B6, 0xE7258F8D, 0x8D53EFF1,
+   0x3F21F78A, 0x9D671EE1, 0x3DC4AD54, 0x76E7AB70,
+   0x19B3FFC7, 0x9EF22724, 0xAFD5A3CA, 0x67B54B1F,
+   0x00000122, 0x33A86EDF, 0x629DFAFB, 0x7E4AE084,
+   0x237E33D9, 0x4CA49A1A, 0xE1D10234, 0xB6E2E180,
+   0x768D5901, 0xD2EC4AD3, 0xFEBBD9DA, 0xA9E332DC,
+   0x90AB63EB, 0x8DA3786B, 0x5E2636C7, 0xD3F6FF9F,
+   0xCBABB3FA, 0x00000190,
+   0xDA03CB43, 0x49C6886C, 0x631AEC16, 0xAF81240A,
+   0x96D20F3D, 0x15EFF9A9, 0xFA2379BF, 0xAAF0A5D2,
+   0xB279FF95, 0xCC91DE9C, 0xA453592C, 0x27D37BD6,
+   0x6D10FA0A, 0x8AF89B81, 0xBCC25388, 0xEA7C3D1C,
+   0x0000015F, 0x213887CA, 0xDD9B3067, 0xC61E7CD6,
+   0x92DC7756, 0x86B3D4B1, 0xF63490C0, 0x4778834D,
+   0xA1351C98, 0xB6DFA602, 0xA7141AE6, 0xCDF11CAA,
+   0x20C4FF83, 0x6FA13194, 0x17DEEA87, 0xF9B356F4,
+   0xF1286846, 0x000001B8,
+   0xDFA2506B, 0xD468652E, 0x8AB9749F, 0x9378773A,
+   0x76E78929, 0x7A884B6F, 0x85D87414, 0xF27C3921,
+   0xBB0F8D83, 0x0EAF6752, 0xABA733CC, 0xA4F32AC1,
+   0x5909A3A7, 0x9101179C, 0x1C8A4D03, 0x1866FEEA,
+   0x0000011E, 0x6C3C0A65, 0x05A92EEC, 0x975953C4,
+   0xBE407A0E, 0xB392DBAF, 0x2CA88431, 0xEF45D2C1,
+   0xA850EACE, 0x522C5D9E, 0x9F20AF9D, 0x10A81FAD,
+   0x1087A41C, 0x9C1C6423, 0xD00C3025, 0xC9D576C8,
+   0x247BB309, 0x000000DC,
+   0x7D504A33, 0xADE6F589, 0x77515969, 0x28BB830D,
+   0xA70C1A3C, 0x6EE92747, 0x1A37553A, 0xCCF8AAA7,
+   0xF7EEED39, 0x908C54A0, 0x6AC78002, 0x122660AC,
+   0x1CF08785, 0xD6C96174, 0xE999678E, 0xFA0E5A5F,
+   0x00000061, 0x5A59CB95, 0xC7A7FCC6, 0x7D17E7CF,
+   0x24DD05D5, 0xD7B40D6E, 0x18C6C398, 0x900AE9EB,
+   0x3381A0D2, 0x1CD20CD5, 0xFBE294CC, 0xAEF1E1A3,
+   0x76876C8C, 0x87A539BB, 0xBFB25F70, 0x7E1B9AAE,
+   0x794EB14C, 0x00000022,
+   0xF2C104E7, 0x86000CDF, 0x172B52B0, 0x26231065,
+   0x02058B05, 0x8196AB2D, 0x28C29576, 0x17E40ACA,
+   0xBC91AA6E, 0xB28F21CB, 0x82096967, 0xD0769EE7,
+   0x2DF6354A, 0x52CEFDF7, 0xF13CA06D, 0xF5FA182E,
+   0x000001DD, 0x29EF4065, 0x6B09768B, 0xC7C7827F,
+   0xD763CF37, 0x95D9DD90, 0x27F8E1DE, 0xCBBFC5F5,
+   0xA771BD3B, 0xCE052D7F, 0xF4AC71CE, 0x198DB3C3,
+   0x61A89C45, 0xF2EC89A4, 0xA98419EE, 0xB3285905,
+   0x60DC319F, 0x000000FF,
+   //Window 56
+   0x1733B3C3, 0x7DDF4705, 0xF4A25D85, 0x7C7878A3,
+   0x29AD09A6, 0x4D86F57C, 0xB26D5C69, 0xA97D4AB6,
+   0x04B07913, 0x71CC9250, 0xB4C0B7B2, 0x08A84131,
+   0x5119F83E, 0x388FC8AA, 0x6BFDA0CB, 0x23A3BD0B,
+   0x0000007E, 0x8E549373, 0xDFC7C844, 0xB52AD215,
+   0x439DC785, 0xFB9DE6DC, 0x9E157E18, 0x8793D562,
+   0x9283C331, 0x33DDC16C, 0x79F9EC90, 0xCEFF5086,
+   0xED0DBB7F, 0x8765145E, 0xFA466807, 0xA3B387B7,
+   0xBA9411A9, 0x00000176,
+   0x6F07EEF9, 0x2D9BA7E3, 0xEB692362, 0x46EF4CE6,
+   0x2FA2CDC9, 0xA869EE26, 0x642A2378, 0x5B7D3A81,
+   0xD4D6BCD4, 0xC024410A, 0x21CEAFEF, 0x88CC0F71,
+   0xE04AF152, 0xEEE011EB, 0x7829107F, 0x9CF87D1D,
+   0x0000002E, 0xE07147B1, 0x49260571, 0x0CA0C303,
+   0x63258346, 0x6602E056, 0xF1CDA5AE, 0x81A45861,
+   0x418B6186, 0xD1921FA5, 0xCBF17FCD, 0xE07A08F1,
+   0x355E5D1A, 0xA26B6B2F, 0x3F4F5BB0, 0xADE69B50,
+   0x898CA884, 0x0000008F,
+   0xFE772021, 0x1D2D4AB0, 0x041053D5, 0xD6E75054,
+   0x5705D868, 0xDB480D2E, 0x6AA63E89, 0xF68A09F7,
+   0x379A4D0C, 0x0BCF4C31, 0xB681873C, 0xCBC0C737,
+   0xB886D407, 0xDB6931A6, 0xF84E033D, 0x0FBAA44B,
+   0x00000056, 0x4F90A0FC, 0x5339B4F3, 0x8EBC0B28,
+   0x2743F681, 0xF7DB2715, 0x37567E5B, 0xA5B1053A,
+   0xF339C91A, 0x8125EBFB, 0xDE65F718, 0x6BF4ED15,
+   0x32F7C06D, 0x40353DCF, 0x8071D1AA, 0x3C994068,
+   0xB8FDDDD9, 0x00000198,
+   0x6016E8F8, 0xD50C9FCF, 0xB8C12F9A, 0x27F12C32,
+   0x08E0E13C, 0x2E13FD2B, 0x89E659EF, 0xE48A1BCE,
+   0xF62A49D6, 0x1BBE7F01, 0xD417E497, 0x87E0CA4F,
+   0x364EE9CF, 0x1CF55A48, 0xF66635A7, 0xF4FBC7EA,
+   0x000001A6, 0x3EB12A0B, 0xBE3E5511, 0x462EBDCD,
+   0xAFFCAD4B, 0xE8F4D182, 0xF6F097AC, 0x404A92FE,
+   0xDB1FE0F2, 0x4FC084EB, 0x9E2A5159, 0x7AF882B2,
+   0x6ACD3A8E, 0x9602FC6B, 0x17654A57, 0x71DE39CF,
+   0x1307D122, 0x000000DE,
+   0x37315BA1, 0xA844A48F, 0x6F401D40, 0x2DB10DF9,
+   0x59508B56, 0xB0920313, 0x1DF7356B, 0x4CCD40A5,
+   0x7CBA0994, 0xF6E6DE66, 0xAFF1E407, 0x8D052D22,
+   0xE1AD5185, 0x6579F0AE, 0x2FE56FF9, 0x02A2654C,
+   0x00000107, 0xC52E3A9A, 0xFBE7245F, 0x767802EA,
+   0x5CF1F315, 0x5CFA064B, 0xD1BC9886, 0x218C2D74,
+   0x6FE2E272, 0xE105D3C2, 0xFBC0F239, 0x6C2D5D8D,
+   0xE93040F8, 0x44F0C1DD, 0x35642078, 0x34A20E65,
+   0x526CAFB5, 0x0000007B,
+   0x2734BC7C, 0x7055735E, 0x2015DAFF, 0xDBBB0D7F,
+   0xD048C6F7, 0xDE7F735A, 0x3D025035, 0x1401C4FE,
+   0xF09B1518, 0x3017088A, 0x8C919403, 0x53BEAA12,
+   0x6E6F4894, 0xE623FF8D, 0xA6C45B25, 0x1622621F,
+   0x000001A6, 0x20E1FD32, 0x3AACBD81, 0xF0C52D67,
+   0x21963A49, 0xDA79F988, 0xB521F29D, 0xB632A340,
+   0x5CA6538A, 0xA1C38793, 0xFECCB403, 0x6C1993A7,
+   0x800A81E4, 0x08775F1F, 0xBFE7989E, 0x5F6056CB,
+   0xA7C0BB93, 0x0000007B,
+   0xD8DC7694, 0xAC6ED780, 0x7F0CE3C9, 0x1517DB0F,
+   0xE2724276, 0x14E574EF, 0xD420A1B9, 0x06BF1C0A,
+   0xECB5BB09, 0x092FCDC0, 0xB3C22E3F, 0x00B1952D,
+   0x66DFEF5C, 0x8486050D, 0xB4AA2363, 0x4162BAF5,
+   0x00000035, 0xCCD62E93, 0x5F188EF1, 0xA78FC426,
+   0x357224C0, 0xF311D595, 0x6A38A6A0, 0x9363D024,
+   0x632D3B1D, 0xEFD29098, 0xDA7EDB5A, 0x46198910,
+   0x1AE7E000, 0x8637F141, 0xD299EA6C, 0x6DCE1F27,
+   0xA33A21D9, 0x00000191,
+   0x1FE4B65F, 0x0574B1C1, 0x99FC3470, 0x564BC4EB,
+   0x8AD913EA, 0x040CF7E8, 0x21E6DC7A, 0x72F64FDE,
+   0x45E43F1E, 0xF061A2F9, 0x4CF73CD7, 0xB30D7ACE,
+   0xED5303F8, 0x4E67338F, 0x27FB18B4, 0xD1CA92F8,
+   0x00000123, 0xB2FF61B9, 0xEC92FF11, 0xDD3BD645,
+   0xA1196425, 0xFFC4A720, 0xEAB1A0B3, 0xCDE12819,
+   0xBB01E20D, 0x2F6F9062, 0x222FCA78, 0xBF735E40,
+   0x5343239F, 0x7A1EFA11, 0x8E4C78EE, 0xACEE5111,
+   0xBB68361C, 0x0000009B,
+   //Window 57
+   0x4175E7E0, 0xBCE0F107, 0x1965464D, 0x51AC63D7,
+   0x52AAA9EB, 0x429F6B9F, 0x2A1846D7, 0x6ED3C53B,
+   0x6DCDA98A, 0xFA87D587, 0xC72D6D0A, 0x9858C801,
+   0x67681451, 0x94A5BCF3, 0xD3DE0285, 0xB7C46ECD,
+   0x00000183, 0xD2DFD89C, 0xFD301B76, 0x0F38E6C1,
+   0xAC9C2B0D, 0x2DA8E6D4, 0xCF9D3ACF, 0xEB9024C5,
+   0x99DB13DC, 0x9EE659A9, 0x4EBFC5BA, 0x9B2FA547,
+   0xBDED8094, 0xC08D98C5, 0xFCF035F9, 0x56B8B217,
+   0xB50DD136, 0x0000014D,
+   0x6987A9BC, 0xE83DFBFB, 0xE03B29B7, 0x311372DF,
+   0xF4176BDC, 0x1B88AD50, 0x37733CF5, 0x5771946F,
+   0xD5C0CD18, 0x4A020165, 0xC7603086, 0xB8E35A40,
+   0xDB55F57E, 0x3D06B8D0, 0xB17B440A, 0x9CDB00CA,
+   0x000000FB, 0x34BD8619, 0x840EC341, 0x00AB86C3,
+   0x40B0C107, 0x85C69C9F, 0xF4782058, 0x10D63734,
+   0x22E8D92E, 0x20A53CDF, 0x5B8E6374, 0xFEC8A052,
+   0xE80C3D14, 0xEDE62895, 0xB9C0834E, 0xDE2EF959,
+   0xB2AE0EB3, 0x000001AA,
+   0x718BE467, 0x0691B415, 0x5722BF66, 0xBBFF7149,
+   0x88474C74, 0xB5446094, 0xBE02C6E2, 0x30609081,
+   0x5052D780, 0x746F7000, 0xEE805F64, 0xCBF590A9,
+   0xDD7BD5E7, 0x9A7B080C, 0xDD80A8C7, 0x56B717BD,
+   0x000000EE, 0xAC340691, 0x64274157, 0x804BE8D1,
+   0x9B309A8F, 0x121AE0F1, 0xCE5420F1, 0x5EC8A509,
+   0xADF456A8, 0xC02EA242, 0x5E76792A, 0xE58AF730,
+   0x8388B323, 0x3136780B, 0x72DB99B7, 0x14E39CDD,
+   0x1A3E9205, 0x00000125,
+   0xED446A1B, 0xDD0E59A1, 0x5307EF75, 0xA92EB882,
+   0xE13EF1A0, 0xA85D2C29, 0xFD55AF75, 0xE558C1AC,
+   0x3E133B0B, 0x60C45ACE, 0x0F7DA3D0, 0x4F08A43E,
+   0x028495DD, 0x0298BE5D, 0x58FEEB24, 0x894E253B,
+   0x00000105, 0xA37DDD3C, 0xFA9524D3, 0x9DE4FBD7,
+   0x8158B85C, 0x0D22ADF8, 0x0D5E4EE6, 0x71FF6639,
+   0x9547F861, 0xA01712BE, 0x457FB0DE, 0x997116D1,
+   0xECDF193B, 0x76F06573, 0xF74312BC, 0xE990A692,
+   0x74FEED35, 0x00000186,
+   0x7F9E71D9, 0x078D1AD6, 0x852895D1, 0xECB551C2,
+   0xD687B477, 0x5F1E2520, 0x457A77C5, 0xC19D6353,
+   0xADCB06D5, 0x7FB6A771, 0xE4B2E297, 0x29251295,
+   0xE982C9C3, 0x71561F60, 0xFCB514C5, 0x258B0FEE,
+   0x00000179, 0xD4DE7F3D, 0xDC337F17, 0x8CA78841,
+   0xD5EEAD5A, 0xAF4DE8EA, 0xE22BF810, 0x3771C38E,
+   0x7064A8FA, 0x26BB6EE5, 0x7FF10AC8, 0xC904508A,
+   0x908646C1, 0x7F6DBBE2, 0xBCAEDC45, 0xE86DB3BF,
+   0x33293382, 0x000001D8,
+   0x2CDC9B50, 0x11034946, 0x62DC4EF5, 0x67E6BF58,
+   0xF6E38FA0, 0x9E9DDF8B, 0xA416175D, 0x54EB8B69,
+   0x8E347A29, 0x072EF5A8, 0x7BD889B1, 0x73937BA6,
+   0xC8C7038A, 0x668C11D6, 0xC0F3A3B2, 0x7D5C4BB7,
+   0x00000042, 0x26696C3F, 0xB414D8AE, 0x82EB9EE4,
+   0x268CC5F7, 0x389570F2, 0xB8992111, 0x3C9EF0C7,
+   0xCA37C13F, 0x6CF3BE04, 0xA86E5131, 0xDEBE2E4D,
+   0xF7E0DACD, 0xF60BAA9A, 0xAB04EBEB, 0x0EBECA18,
+   0xA0FBE175, 0x00000197,
+   0x8FC86DDB, 0x2D530322, 0xC6CE68A2, 0x05AB8E8C,
+   0xC2BAF433, 0x3BB25B18, 0x5AB76FFB, 0x5CE24145,
+   0x4B24B77E, 0xBB4F95AF, 0x451B0C0E, 0x06B0D172,
+   0xEF058F82, 0xED3E64C1, 0x737295D3, 0x2FAC77E0,
+   0x000000A6, 0xBB21DDA8, 0xAFEB533A, 0xD42C427E,
+   0xC116B648, 0x9442BB65, 0x5D02B648, 0x22C2D6A7,
+   0x55CB7ACB, 0xFAADDE8D, 0x31427A5C, 0x557B3840,
+   0x56C2EBA1, 0xE4F0353F, 0x578892D7, 0xF6C6055B,
+   0x37813DA4, 0x000000D7,
+   0x709EACCC, 0x0748D64B, 0x9554FCAD, 0x233A0CA9,
+   0x30FEA281, 0xA00E09E4, 0x16D59F0F, 0xDB39EF4F,
+   0x2633C3B6, 0x2C80B547, 0x3A418480, 0x97179ACC,
+   0xAA29CDD5, 0x85F1C624, 0x4819B5A3, 0xB48B5AE2,
+   0x0000017C, 0xA654EA3D, 0x4242F52A, 0x7F1BBCAE,
+   0x73169A2C, 0x36BDF131, 0xAD5788E9, 0x21001931,
+   0x5A151D1C, 0x33AD5EEE, 0xA0D0EB0C, 0x6ADCA012,
+   0xE98FDF08, 0x5034739B, 0x41C992CF, 0x4E494A95,
+   0xB2C7C2BD, 0x00000033,
+   //Window 58
+   0x578B7A3F, 0x27068F87, 0x423A5346, 0x506446F1,
+   0x58DAC5E4, 0xE9D9C75B, 0x61B8F695, 0x8EBC86E5,
+   0x611C51E3, 0x272AC14E, 0x4E24FB32, 0x67863A1D,
+   0x02E5B539, 0x270D4FDC, 0xA4186D8D, 0x96D7B7A9,
+   0x000000F4, 0x26627252, 0x1A60EF05, 0x9BDC0F5F,
+   0x31682A83, 0xA112BE82, 0x52A055AD, 0x4ECF7367,
+   0x9C3A8848, 0x49E70680, 0x52350872, 0xB881B9CF,
+   0x61B6B478, 0x887D3C1E, 0xBEC16C5A, 0xD598A671,
+   0x8A8B2B82, 0x000000EF,
+   0xCEDC41C5, 0x943DBC45, 0x075FBCDD, 0xA3889CFC,
+   0xBEE1AC11, 0xAB0A889D, 0xD8721711, 0x9A5319B1,
+   0x87ECEA8E, 0xC4228D89, 0xE8221D39, 0x55CFCE64,
+   0x39E3E962, 0xD3E9699D, 0x0549F4CF, 0x8ED1DD02,
+   0x000000BA, 0xFB5FEC20, 0x1729967D, 0x7A6208F5,
+   0x16246AB3, 0x5F5AF897, 0x10904E4B, 0x273B4049,
+   0x68C575BB, 0x97335687, 0x973F128B, 0xD6CB8CD4,
+   0xB696381E, 0xD2FBA17B, 0x3EF2EC73, 0x5233AEB4,
+   0xE4C62FDE, 0x000000BB,
+   0x1631F481, 0xF61F5690, 0x60057252, 0x31CD4A44,
+   0x7F3683ED, 0x11C6764A, 0x855ABD6D, 0x813E617D,
+   0x74BFFC99, 0x07DD6C66, 0x3D28A486, 0x4EFF7790,
+   0x1236CC16, 0xDA809B5A, 0xE1B1FA07, 0xF3A0A984,
+   0x00000015, 0xFDBAA820, 0xC1557C02, 0x490ACE41,
+   0x22F1B155, 0xBB30FE96, 0xAADDE80B, 0x8005FCBC,
+   0x3ECB3B1E, 0x68A1DB30, 0xBFEF06D9, 0xA6B85ED3,
+   0xA8E0A6A1, 0x2B82AE83, 0xA602E5B5, 0xFA699305,
+   0x567EABD6, 0x00000177,
+   0x8BFF6D2C, 0x9E71F0BB, 0x67B26058, 0xF35C6C13,
+   0x9FB2CD17, 0xB8791D9E, 0x655344B7, 0x834F77FB,
+   0x88C6106B, 0xF6727494, 0x83BF0B92, 0x1D51D49A,
+   0xB2598CC2, 0x2888CA81, 0x8377DCF4, 0x454C0025,
+   0x0000000F, 0xE9046DC1, 0x622AB6EB, 0x40D5F30E,
+   0x3594E53E, 0x632372BE, 0xAF4FD362, 0xAA276034,
+   0x08601954, 0xA10A69EF, 0xA2369D15, 0x25BF301B,
+   0x9C9FFCF5, 0xDBAF10E3, 0x7CD516D5, 0xF35E5F7C,
+   0xC24AACC1, 0x000001F9,
+   0x90C8A719, 0x716CAD1E, 0x882637E0, 0x631D6ACF,
+   0xB140D288, 0x42FD6468, 0x88B10F5E, 0xE8DFB494,
+   0x71D6849D, 0x5FD33944, 0xC0026192, 0x51459C14,
+   0xD25C7D5B, 0x4C72B94F, 0xC3A7ED7B, 0x157CF7E3,
+   0x00000123, 0x6BD8DBE9, 0x046419AB, 0x37EEE4D3,
+   0x4BE7F1C8, 0xAC98AB3A, 0x27F5A81A, 0xBF7071F0,
+   0x830A7200, 0x4EBD5B40, 0xA4DBA25C, 0xF94BAB5D,
+   0xA8AF3ADD, 0x4FD3E972, 0xC5156C40, 0xC1A472C5,
+   0x1FE23347, 0x00000096,
+   0x972B1D30, 0x0D8A75E7, 0x4F05A10B, 0x9556F1EE,
+   0xFE233210, 0xB0A90E0A, 0xE8C3AB51, 0x5899ED3F,
+   0x411D224F, 0xB3F56019, 0x9A30B1B3, 0x2FC2AD6F,
+   0x60C33436, 0x66B1A368, 0xE3490548, 0xCB5310CD,
+   0x0000011E, 0x11647BAB, 0x520FB4E7, 0x4E4C5F55,
+   0x2C540355, 0x58A8E072, 0x3B4F3CBD, 0x5D4DBCAA,
+   0xAAC1CF33, 0x26AC1C58, 0xB5FF4B04, 0xCF35E684,
+   0x456D3FB2, 0x4B1EEBAA, 0x6C05AAC0, 0x7D0DEBB1,
+   0x3EB4E144, 0x000001FB,
+   0xCF51ACF8, 0x86BB6A2F, 0x47A49E34, 0x8CFB5784,
+   0xE3B6D1FA, 0xA931FC6B, 0x4A9D14A8, 0xD960CDE6,
+   0x45B21189, 0xE4C41162, 0xBBBEB75E, 0xE4AEB21A,
+   0xD9BE6508, 0xE45DB020, 0x789AD9E8, 0xA001AFB4,
+   0x0000002B, 0xC271C0D6, 0x5F754551, 0x0543B435,
+   0x4926B87F, 0xB3123BBE, 0x3157188A, 0x7B3ADDFC,
+   0x2A77D454, 0x0EE40AE4, 0xB1C6000B, 0x72F6A072,
+   0x6DE2CC28, 0xF1DD26B5, 0x64FD97F7, 0x8F229A39,
+   0xD43467C3, 0x00000041,
+   0xB631AB3C, 0x7B5E2027, 0xF2C42E69, 0xA4AB4559,
+   0xB1670C20, 0xD8A3ADC1, 0x0ABC7C17, 0xA2240DB4,
+   0xF054F41F, 0x104AE5CF, 0x128DF5F1, 0x5C08B0BF,
+   0x877D5D9E, 0x651F1BE1, 0x65E13F7F, 0xAFB79922,
+   0x0000015A, 0x632AC61A, 0x140370EE, 0x8A188E1E,
+   0x7CC39305, 0xF6EAC7D0, 0x21A228D9, 0x3FD21C04,
+   0x8A6F1561, 0xC35936A2, 0x64418721, 0xF3E01680,
+   0xF9F06B28, 0xFDEACE5B, 0x7EFE7361, 0x6E30226A,
+   0x6A7264A9, 0x00000017,
+   //Window 59
+   0xFCFEFDB2, 0xE1F0C1AE, 0x44930C59, 0xB5BC33D3,
+   0x64D2C6E0, 0x253D5F49, 0xE316BA1F, 0x25EFDDED,
+   0xE30C3A34, 0xEB3AB21F, 0xCFA52A9D, 0x797A1AD6,
+   0xA81BA831, 0x6A3CA2E0, 0xE112DD07, 0x27BB664C,
+   0x0000007E, 0x1961AA16, 0x91FA1E12, 0x67DD7513,
+   0x381B2D71, 0x44DB8A51, 0xBAE86351, 0xBC31C1CD,
+   0x4CC1915F, 0x8EC6E9E1, 0xF79F4059, 0xA8929A72,
+   0xB142B6EC, 0x8ED71FB2, 0x4629C648, 0xBD52FAA7,
+   0x9F79BCCF, 0x00000029,
+   0x24F3E2FE, 0x381C9254, 0xDEE535E2, 0x71E5478E,
+   0x6E673D25, 0x191946A8, 0xF2D629C0, 0x79802C83,
+   0x3BBCAE3B, 0x46EABC89, 0x1BE23CBF, 0xB8C8D414,
+   0x62EE0E85, 0x21A38CBA, 0x3AEDEA6C, 0xFBAD1629,
+   0x00000099, 0x3FD062ED, 0xEEA93393, 0xDDE340C3,
+   0x8434C033, 0xCFBD71A9, 0x5FBAFD98, 0x6F9C6632,
+   0x4A1DE5D8, 0xDB268826, 0x975FF1ED, 0x3D2EEF58,
+   0xCFAB8B1A, 0x0680FE1A, 0x6A50E2E3, 0x0E0F3FA3,
+   0xE02154F1, 0x00000196,
+   0x8F0FC596, 0x0D359834, 0xB20E73D4, 0x3A7EF54A,
+   0x37CE7F53, 0xD99446C0, 0x07CDCF9E, 0xC198A755,
+   0x41622E72, 0xC170D6B2, 0x593B7C41, 0x7DF33F4F,
+   0xD176DED6, 0x58D8ADE8, 0xA5EC80C1, 0xECE1335C,
+   0x0000013D, 0xBB0543B8, 0x1F125D6F, 0x5F084A01,
+   0xB97E6E28, 0x496482E0, 0x0907A203, 0xB2A38099,
+   0x0EB9FA4E, 0xB5C8B504, 0xB3E5054F, 0x931D0353,
+   0x7E5204C7, 0x86636261, 0xEAB5BBDF, 0xBAD92B8B,
+   0xB0627E5F, 0x00000189,
+   0xE25F8B1C, 0xC0F92A02, 0xC619DA00, 0x60474421,
+   0x68CBCCEF, 0x14638CA7, 0x15E8CEC4, 0xD4C5CB62,
+   0xA1194B51, 0xBBB32091, 0x5F0EF063, 0xD1133ACB,
+   0x53EB56B7, 0xA7141056, 0x4F250643, 0xC1D582F5,
+   0x000000C5, 0x9789ABAA, 0x6F5F7174, 0xDE5C9651,
+   0x29045949, 0x3683EF86, 0x5B34A35D, 0x664F4510,
+   0xD84501E5, 0xD2CB563C, 0x3A32D2F9, 0x11B5C949,
+   0x68DB2EAE, 0xE22EBDD4, 0x5A5F799F, 0x8E01D2AE,
+   0xD08DE31B, 0x000001AE,
+   0xB9E83A3F, 0xB2534B51, 0x7648D40C, 0x3C07F995,
+   0x580B4363, 0x4898E16E, 0x155C966C, 0xA5CB6B67,
+   0x807EBEB9, 0xB3FC38BF, 0xD68E0B88, 0x798544C1,
+   0x3D7A48DF, 0x02AA1636, 0xBB842157, 0x7006B69A,
+   0x00000090, 0x673B972D, 0x7CFA15B7, 0x14F2DD22,
+   0x4C047959, 0x0AB1E7D3, 0xE3059854, 0x5EDB0580,
+   0xDD22FF42, 0x4E0FC90D, 0xDAAE123E, 0x9F2E7EC3,
+   0xA60A9C8B, 0xAC09B64E, 0x233F9668, 0x0B826C49,
+   0x96E3BCE8, 0x000001D4,
+   0xC8EC13CA, 0xCFB013C6, 0x2ABA5EA7, 0xFB9355F6,
+   0x2CC82D38, 0xFB2553A3, 0x82EC98BB, 0xD42F3571,
+   0x57BEE942, 0x06FD8FC4, 0xAE48A527, 0xA30CD88D,
+   0x22DC4557, 0xCA39F8CB, 0x8B366836, 0x77FCA5DE,
+   0x000000FF, 0x78D119FD, 0x6A78299E, 0xA68E8856,
+   0xDF5F90CA, 0x71A64327, 0x112174F1, 0x3E28FB76,
+   0x4C183D3D, 0x7A59FC19, 0x141DA13B, 0x65C4667A,
+   0x3DFF6EA6, 0x08E17049, 0xDAC4F87F, 0xD622CC83,
+   0xAB313984, 0x0000016E,
+   0x6A7908EB, 0xC04052A0, 0x3F7A61C9, 0xC0DD34FB,
+   0x8C383C8B, 0xA72BD10E, 0x7516B2E6, 0x7A4A872C,
+   0xE25843DA, 0xF00570CC, 0x8A741583, 0xB6800F06,
+   0xD2E1E3D7, 0xBD1D38C1, 0xBD51E6CA, 0x6F3B6DA2,
+   0x00000171, 0x4DA67565, 0xD598A4AD, 0x8FEC9378,
+   0x3C8016A3, 0xAB7EC42D, 0x586BDCC9, 0x5F2E1FAC,
+   0xFF90EE85, 0x9C20D2D8, 0xF0A0E72A, 0x3B7843A3,
+   0x94EC863B, 0xB4160103, 0x6329AD19, 0x43758F0E,
+   0xC1CEF8F5, 0x00000023,
+   0x9B46276E, 0x042404E2, 0x4185728E, 0xE7206E43,
+   0x6003F4D7, 0x354289B6, 0x8F2B9F5D, 0xA7F5F27D,
+   0x57DFC134, 0xCC5E556B, 0xFD212481, 0xE7638D95,
+   0x2C480FA8, 0xB140FD9A, 0x7181F0C6, 0xF2D9D390,
+   0x0000010F, 0xF53F6873, 0xFE512D05, 0xB3A8C31E,
+   0x8036E7C8, 0xE71FE4AB, 0xBC695160, 0x17C10BCC,
+   0x33DAC2EB, 0x29B01272, 0x8A54DD5F, 0x0912F34E,
+   0x17BF47B1, 0xF872E732, 0x0237A52E, 0x47C624F4,
+   0x6306591F, 0x000001F9,
+   //Window 60
+   0x21DD6E7A, 0x0F8341FE, 0xEA93E5C1, 0x5C106F8E,
+   0xAD0114BC, 0x8E2AD8E9, 0xF059D291, 0x277EF823,
+   0xDC50FD78, 0xED4A28E5, 0x89CDF20D, 0xA0719651,
+   0x1FDE162C, 0xE393B264, 0x30A5B16D, 0xD383B86D,
+   0x00000041, 0xAD6DBEAF, 0x04B8115B, 0xA996519B,
+   0x7D7F0BB9, 0x9C397C91, 0xAB54D4C8, 0x77A6A3E3,
+   0x1750B97D, 0x14554321, 0x1637909B, 0x7A5AEEA3,
+   0x7311DA68, 0x52130453, 0x1F91A0FD, 0x86753F28,
+   0x4338B3D6, 0x0000014C,
+   0xE411C88B, 0x3671D520, 0xAF747CAA, 0xE56D2622,
+   0x3F298A36, 0x8C2D939F, 0x38B36307, 0xD09F955E,
+   0xACFE3A5F, 0x7AEF92FD, 0x3C3413E3, 0xAA1B543A,
+   0x85E8EEA2, 0xA68BCF75, 0x57271AB1, 0x1C33B909,
+   0x00000175, 0x0993374B, 0xE829B548, 0x3758FA53,
+   0x93ACE6B4, 0xFB48D303, 0x378932AD, 0x7B9ACA58,
+   0xA0BE54CD, 0x07D56BFC, 0x6F020D2F, 0x332D5724,
+   0x661CC6DF, 0x4702E14E, 0xE1C67B4C, 0xFE0CE1F4,
+   0x6D7E1534, 0x00000165,
+   0x9DE748B4, 0xB83FDB66, 0x0C41F158, 0xC46F8100,
+   0xB8F8F374, 0xADE8932F, 0xC7AB11FE, 0x5728E8AA,
+   0x601535D1, 0xA3BE4365, 0x50C52B71, 0xF366F0D4,
+   0x84DB7699, 0x6E008600, 0x32BD9061, 0x39C5934C,
+   0x00000003, 0x9C964A3F, 0x4C5F3AB4, 0x69A70BA7,
+   0x30EE02C3, 0x1699B55B, 0xE4F4E772, 0xF2104682,
+   0x957EFD09, 0x298947D8, 0x7BE1BDB0, 0xA6CE37DA,
+   0x128BE588, 0x5110D219, 0x10F0ABBB, 0x6C433528,
+   0xFE63DE4B, 0x000000A5,
+   0x30AE5727, 0x64F0AE66, 0xCCFE2F46, 0xEB7FEE1C,
+   0xC17226F5, 0xCB52D65C, 0x4BDE2FF6, 0x11BFDD3C,
+   0x22F56523, 0x14593DBA, 0xE5A07B06, 0x7549C2A8,
+   0xA259420C, 0x27E857B0, 0xD795BF2B, 0x5F2702CF,
+   0x000000CE, 0x99EF6F42, 0x50247B77, 0xA9496281,
+   0xC5D4D501, 0x848EE90A, 0xC2898FD0, 0x3B105EA7,
+   0x5916DF47, 0xA3FC2A93, 0xC963D568, 0xA71E69FF,
+   0x4F5DBD88, 0xED98520A, 0xB1DFB820, 0x5BBB0779,
+   0xF91D6E9E, 0x0000010E,
+   0x4717DA49, 0x2640B047, 0xF0A90682, 0x6B303097,
+   0xA4756B74, 0xE3FBB37B, 0xE3F7EA6A, 0x084581B1,
+   0x67A536E8, 0x942B168D, 0x8E8E4DBD, 0x4CECB7EF,
+   0xB17164D3, 0x48F4B7C0, 0x93BFCA74, 0x8A464B3A,
+   0x000001FF, 0x7268EC93, 0x21F4906F, 0x2ACBDE61,
+   0xD61C2443, 0xD6FA2261, 0xDE475D32, 0xA02F45C5,
+   0xBAAE1526, 0x0212C1FD, 0x16B2C6B3, 0xFDDEA6A2,
+   0xD6AFDFE9, 0x5DAF789D, 0x1F8FB94D, 0x576846A0,
+   0x2F89389B, 0x000000FF,
+   0x3516E4D9, 0xAA089840, 0xFBA094AB, 0xDFBB159A,
+   0x6BB49EBF, 0xDCB895E2, 0x56CF3C64, 0x7A7B5727,
+   0x38C7BC1D, 0x52861B3C, 0x27352C7B, 0x7C34176C,
+   0x7D33AE38, 0x5B3CC217, 0x8C494A63, 0x4A208369,
+   0x0000002E, 0x5F514FAD, 0xD3292662, 0x6020B420,
+   0x5DEE9970, 0xFDAE8486, 0x8AFF8C84, 0x51E60C42,
+   0xFDC0EE65, 0x236681DA, 0x564287BD, 0xCAA82AF6,
+   0x6DA3E12E, 0xE1EFBE58, 0x6D17C67C, 0xCCC6C519,
+   0xA0334020, 0x0000006A,
+   0x92756C0E, 0x46D6266D, 0x305E1611, 0x3164F6A8,
+   0x613B00C0, 0x65DFEA3D, 0x571828A5, 0x75EA9AB9,
+   0x8BE872A9, 0x5184DC13, 0x92347D22, 0x8C59C141,
+   0x4BAA4678, 0x96B33191, 0x2AE17A1B, 0x0D34CC5A,
+   0x0000000D, 0x6FCB342D, 0xC05C3C51, 0x677D6EA3,
+   0xB36A7EFB, 0xA8067B2B, 0x016811B2, 0x4822FA85,
+   0xFFFF97F9, 0x45883BB0, 0xFC646B51, 0xC28D61DB,
+   0x56C40D49, 0xEADD1593, 0x91BE8847, 0x128D8AD9,
+   0xECF0A8F5, 0x0000002B,
+   0xE10DB8F5, 0x33CCF08D, 0xD2B4CBA5, 0xE481EA75,
+   0xEE9CDB6F, 0x8DB73D5B, 0xB5C523BA, 0x5D11D992,
+   0xD11B927B, 0xE9D79978, 0x7A355C88, 0x61BE8FC1,
+   0x5A062E74, 0x5C31C7A6, 0x17A4A844, 0x2AFF5A11,
+   0x00000061, 0x3C9F31B4, 0x9F538677, 0x766DFCB0,
+   0x7F7681C7, 0xCB41B746, 0x1D759DD9, 0x3DF8B332,
+   0x1842CE5A, 0x46CF5438, 0xD6650A1D, 0xD8E57A31,
+   0x3AFAD154, 0xC779EC95, 0x72DF5ED3, 0x733F1F9A,
+   0xA9F04F62, 0x00000072,
+   //Window 61
+   0x2D3D7641, 0xDD916628, 0x39C02CEE, 0x99029E9B,
+   0xB6DE7881, 0xCE03FAC9, 0x4F66EBBC, 0xC2CD0F78,
+   0x64C83E37, 0xE3919483, 0xFD7BB155, 0xFC853CB8,
+   0x432314CC, 0xA5A99B24, 0x133B2709, 0xEF0B7ED0,
+   0x000001D0, 0x54DE3ECB, 0xE4C4D8A0, 0x5F8CB5CE,
+   0xE2F88AC2, 0x68EB11A2, 0x17A4E60D, 0x3B79619A,
+   0x6D0E05FB, 0xD5DA75EF, 0xA54874B7, 0xC77F6AC1,
+   0x18C2B1B3, 0x829736C3, 0x5A2A6FDD, 0xCD44843B,
+   0x9CE62F22, 0x00000059,
+   0xD006477E, 0xE521DCE8, 0xEA3F2B6D, 0xD566FC0B,
+   0x18CCAD87, 0x472EA469, 0x1FE4719C, 0xF15FE9D9,
+   0x8B7015F9, 0xD275B8CE, 0x86894ED7, 0x3F04FCAD,
+   0xC023A915, 0xC02D8386, 0x5ABDA947, 0x6B29D94D,
+   0x000000A3, 0x96135659, 0x707122C4, 0xEDA8C2D4,
+   0xAE00DC93, 0x164EBA39, 0x0EA664C3, 0xF36B5B72,
+   0x0DCB1880, 0x337E6DEB, 0x1EC8BC56, 0x20DB8B04,
+   0x34237EED, 0xED7BAF4A, 0x026FA069, 0xEC16CFBB,
+   0x88B1EA03, 0x0000005B,
+   0x44EAC0B1, 0x1C676BBC, 0x6FEA6C20, 0x95E84810,
+   0xE182DE39, 0xF0AFB403, 0xF6DAADB9, 0x180FD76B,
+   0xAC485527, 0x9F2D412D, 0xB8565861, 0xCD59060A,
+   0x4F05CABE, 0x99385875, 0xB829E025, 0xB21C7C70,
+   0x000000D3, 0x554AD734, 0xE9B60D5D, 0xA30D86A2,
+   0xE70BAE12, 0x442CFEA6, 0x34113E1D, 0xCF199E84,
+   0x586FB932, 0x74D28CC4, 0xC66AD7E6, 0xFD5F8CDA,
+   0x2CCD27D2, 0xC78032F6, 0x1F47FDCB, 0x8D5B2254,
+   0x8D4B66F1, 0x00000141,
+   0xDB4265E1, 0x8BE4DED5, 0x2700418E, 0x9F65ABF2,
+   0x55108266, 0x457AD4E2, 0xA6138CCE, 0x43D48A67,
+   0x8AFCCDAB, 0xC6C6C647, 0x64DE4D77, 0x87F5811D,
+   0xF48F36BB, 0xA02EFC05, 0xBC51E05C, 0x21F8EB11,
+   0x0000017D, 0x215B4477, 0xE1EFE9AC, 0x209CAACD,
+   0x44D6AE20, 0x49E9661D, 0x2CEBFA64, 0x5E169DFB,
+   0x5F1EA194, 0xF5DF63A3, 0xE6705A2E, 0x2A22E3DE,
+   0x6339EA70, 0x668F1234, 0xB56EF344, 0x896E23B9,
+   0xAD598D6A, 0x00000124,
+   0x6422383A, 0x67AE2B8C, 0x6B950051, 0xC2FFEC0E,
+   0x4DB885BB, 0x8E2470A3, 0x12D25CD3, 0x2CCB0C48,
+   0x47029173, 0x745143BF, 0xA5E5D08E, 0x0025FD4E,
+   0x03D6EEE5, 0x11344FE7, 0x7D956F6A, 0x99DA7482,
+   0x0000008B, 0xE8A56D7E, 0x7AFAF9B1, 0x9AB62EA4,
+   0x37BCDBD3, 0x01DBEE6D, 0xD949B09A, 0x7E8D04B4,
+   0x09928E32, 0x31681122, 0x4EBFC15B, 0x04D32B62,
+   0x14005782, 0xCBF26F4C, 0x42B2CB68, 0x59034A08,
+   0x57D17DC8, 0x000001FE,
+   0x1983F79E, 0x0A57BD31, 0xE3160EBE, 0x60CC9782,
+   0xAA372647, 0xD8D39ACC, 0xD56913D3, 0x2BF8771C,
+   0x1E54D54D, 0xF8AEB63B, 0xB468D8CF, 0xBBC42DCE,
+   0x08FBB9E7, 0x44D77C43, 0xAEDA7D70, 0x5AA66DF2,
+   0x0000007A, 0xB4E930D0, 0xB5EA1DFD, 0x234A1AAE,
+   0xF364063E, 0xB03003B2, 0x808B959C, 0xC1A101FD,
+   0xC0479EE0, 0x6D550D43, 0x4E9DE14D, 0x398681F0,
+   0xC8EB9DD6, 0x67C976AB, 0xDD31E4F0, 0xD7124D48,
+   0xBB18A005, 0x0000012B,
+   0x745853FC, 0x4BD78A0A, 0x51743C37, 0x5DC4E1A4,
+   0xD8D6FD7E, 0x7DD66926, 0x7888E634, 0x9773396F,
+   0x7EFAE90B, 0x6BEFCCD4, 0x725AA660, 0xC7670E2C,
+   0xA658FCDC, 0xDDC5873C, 0xE0F5F359, 0x1224E4BD,
+   0x000000E3, 0xC6A2932A, 0xCDFB21FD, 0x082412ED,
+   0x46E351C7, 0xD78EFB2F, 0xEBE52FE1, 0x4571C790,
+   0x42024E5F, 0x02F62985, 0x52437562, 0x21AE1521,
+   0x3DD58B61, 0x615262E0, 0x659AFBF6, 0xEA06F5AB,
+   0x71492809, 0x000001FC,
+   0x932BBBBF, 0x1B4EAAFF, 0x5047D29A, 0x6D3C553E,
+   0xDE3ADE41, 0xB7E633E7, 0xC480BDD4, 0xC4B782E4,
+   0x8B7274BB, 0x59523DFA, 0xDF339D34, 0xD07D0308,
+   0x86BFFAAB, 0xB289E9E0, 0x84D0FF1C, 0xEC8D2EBE,
+   0x0000016B, 0x758FC7C5, 0x88FAA957, 0x82F1CC7B,
+   0x15EA30CC, 0x4E1A3BF2, 0x10D79D4E, 0x4321A137,
+   0xF1C1B0CE, 0xB54440C1, 0x8EE3028F, 0x2CB330AB,
+   0x352F58A2, 0x5EE439B1, 0xC7BF6F4F, 0xBE77C93F,
+   0x162D027E, 0x0000003F,
+   //Window 62
+   0xB6BF5EC4, 0x1EBC5309, 0x3A92BA16, 0x29CA5BA7,
+   0x70839C14, 0xBDB1BCE4, 0xDE1F966C, 0x963FD369,
+   0x4FABA5B7, 0x208FDC75, 0x678FC163, 0x2F1EA65A,
+   0xA773BBC5, 0x792FA255, 0xB22A653B, 0x752A08FA,
+   0x0000008F, 0x2E58F405, 0x096AFF66, 0xD6658910,
+   0xEE92B17D, 0xD33B5B5A, 0x65792CB3, 0x5678F269,
+   0xFA503F21, 0xEFDFFC67, 0x4E2757C8, 0x665347F5,
+   0xBE46A6F1, 0x6D9773E7, 0xD049A158, 0xB0A28AC5,
+   0x9555B002, 0x00000145,
+   0x77B9ABA6, 0x353AE6FD, 0x013F3158, 0xBAAB19AF,
+   0x7B9B7AAA, 0x14D0564C, 0x2D9FF473, 0xE591B96A,
+   0x73F46109, 0x327E3FB8, 0x6BE11242, 0x61C0191E,
+   0x6345CF6D, 0x9696F1BD, 0x684C060B, 0x3DD87573,
+   0x00000058, 0x285A6DDE, 0xDAB49BA0, 0x075EA1C1,
+   0x7D66E2C3, 0x2D8CE1F9, 0x72197350, 0xAE730C53,
+   0x5E64C366, 0xD30475E5, 0x17154D6D, 0x3341D88B,
+   0x14153F7A, 0x6235304E, 0x711DFAB6, 0xBD4533FC,
+   0x0E010897, 0x00000177,
+   0x2177C1C1, 0xAA4A212A, 0x4C8A2A83, 0xF08F1F5D,
+   0x0FE14C27, 0xEEB0A894, 0x3F0C1F0B, 0x564A1C8F,
+   0x9297B55E, 0x6B73048C, 0x7A810E5B, 0x3DDCE907,
+   0x3DE8797F, 0xD8F99EFC, 0x37379157, 0xD9B3FA2E,
+   0x000001B0, 0xFE9275E2, 0x65A7DC22, 0x6960A690,
+   0xBE8B93FB, 0x63F437EA, 0xC783DF88, 0x5A22F1EF,
+   0x4FBCF146, 0xCFDCF231, 0xA1B86AB3, 0x50CB90C7,
+   0x0B1309CF, 0xFC3CCE3C, 0xA77F0BDE, 0xC30AC697,
+   0x86DEFF3C, 0x00000170,
+   0xB580E3A2, 0x1A4D19D6, 0x20834FCC, 0xCEE647C2,
+   0x2E9454E0, 0x94066A7C, 0xB1B480E6, 0x220B4993,
+   0x30E72308, 0x0A89C3E3, 0x6294E865, 0xF22F323E,
+   0x645C364D, 0x27DAD374, 0xB47A7A2C, 0x16B70ED4,
+   0x000000CD, 0xCC79E99A, 0x208A7F56, 0x1991087E,
+   0xB844ED7D, 0x7EE9FC8B, 0x6F19C1C0, 0xB9208633,
+   0x12A4140B, 0x2C1A5947, 0x8F976B25, 0xA1BFC7C3,
+   0x083544DD, 0x206DF951, 0xD432604B, 0x7ECA93B3,
+   0x0F3C03B5, 0x00000115,
+   0x10BDDB29, 0x04CEB998, 0x442F2C74, 0x9FAB2EE4,
+   0x19667AE0, 0x43356141, 0xFC81B56F, 0xD5F83412,
+   0x9E856C30, 0x5E6ED8E9, 0xB4A7E832, 0x78C996CF,
+   0x6FDF4883, 0x8D4B42FB, 0x44413470, 0x2DB8FDDD,
+   0x00000003, 0x3B6DB1CF, 0x92493362, 0x7188ED35,
+   0x8E613F6F, 0xF3B826D5, 0xF0744604, 0xFF49C7D4,
+   0xABC6AB2D, 0x946A8711, 0x228F6AF4, 0xEE2C8214,
+   0x39DDA5A2, 0x4F1FD467, 0xD44BF874, 0xEECF1105,
+   0xD1B931AA, 0x000001C4,
+   0x986D7822, 0x1C0D7CBB, 0x6BB648E9, 0x213BDA7C,
+   0xE29E68C1, 0x51743E4B, 0x4CD28F08, 0x74D1DDEE,
+   0x8C3C3F8D, 0x4437989C, 0xAEFB33E2, 0xD403A60F,
+   0x65B46A84, 0x4D61A730, 0x6D94CC26, 0x4CD324D7,
+   0x000001D6, 0x036CF7C9, 0x9693319F, 0x12028A77,
+   0xF5457F55, 0x592AFD27, 0xDEDC5573, 0x299FACAC,
+   0xFBAB1069, 0xCC2D88F6, 0xC4AF7F75, 0x3C873D6F,
+   0x94AAD39D, 0xBE4C8438, 0xB0F9A767, 0xD7FFECD3,
+   0x4685419D, 0x0000001D,
+   0xC5521C2D, 0x0F70C5E0, 0x0FC84AF1, 0x72DF660F,
+   0x2F5F45A7, 0x07C56689, 0x01B67FA4, 0xC3FC3B7C,
+   0xA4F91F37, 0xB858952E, 0x52668222, 0xE39E37E2,
+   0x9DC7794F, 0xA30B47F8, 0x64EF0F8D, 0x83CEF635,
+   0x00000170, 0x51F3288A, 0x28BC223E, 0xB218B266,
+   0xF3E683F2, 0x408A15EF, 0x93157CE5, 0x964E4AEF,
+   0x22BCC030, 0x9E6F911A, 0x7887CD2C, 0x59C34B65,
+   0x391B0CA6, 0x726F4AB3, 0x3BFA6D84, 0x83ECFC29,
+   0x2B0D81D0, 0x00000106,
+   0x3C9A7FF9, 0x57E31F16, 0xD24471A0, 0x44BCA9A6,
+   0x5DF58BE0, 0x92C25866, 0xDD84263B, 0x09A27C8D,
+   0x3EB6554F, 0x1C276A35, 0x564BD80A, 0xDDBFD7BB,
+   0x5798B89E, 0x82469AB6, 0xEDFF69B9, 0xF3945D8C,
+   0x00000105, 0x2F2FF79D, 0x0C7A9385, 0xE5892D2E,
+   0xC2389A90, 0x1F36EAED, 0xC1790B92, 0xCF448875,
+   0xAA701EE7, 0x19D6D0E4, 0xD82EA4E1, 0xA05DE67D,
+   0xE3F4853B, 0xE8811C2D, 0xE77C6A38, 0xE83B79AC,
+   0x03D5F231, 0x000001EA,
+   //Window 63
+   0xDBBD171F, 0xA6D6B095, 0x44F06181, 0xF0D3B957,
+   0x78FAB381, 0x46B97865, 0xAE356E29, 0x7DA97845,
+   0xD01B3C09, 0x4A0C3E00, 0xE106D5BE, 0xAED18677,
+   0x1AFFDB67, 0xD7309C76, 0x25F2B8C2, 0x97158754,
+   0x00000193, 0x24785079, 0x65D3657B, 0x5E064334,
+   0xB1D2B5F7, 0x2B7B61E1, 0x0736BFDA, 0x284E4FA6,
+   0xB39C4DB1, 0xBD934998, 0x66CEDF43, 0x324D2DE1,
+   0x8F9F6243, 0x4C193171, 0x92F2524E, 0x964A8383,
+   0x75705ACD, 0x00000031,
+   0x0F810445, 0xEDEC6D35, 0x5FE4215A, 0x2EE46844,
+   0x969ACDE4, 0xDACE7F0E, 0xC754DFF6, 0x3708F4F4,
+   0x6C0370AB, 0xA510303F, 0xB4ADC2FE, 0x9D5CAC3A,
+   0x395A765B, 0xF33D4A2B, 0x1856E0C8, 0x437BFDCA,
+   0x000000C5, 0x0812A78C, 0x287DC7F7, 0x05DC3FCD,
+   0x30CB0CD9, 0x008EC68B, 0x80343B51, 0xCC404F65,
+   0xBB3DA3A5, 0x93D9F303, 0xD5276AF5, 0x7DAA5950,
+   0x85A875D4, 0x078E6556, 0x5BAAE52F, 0xE58A4E97,
+   0xDDD9E3EF, 0x000001C5,
+   0x2A7CBE50, 0x322EFE14, 0xB2F85051, 0xAF425A7D,
+   0x812B26A2, 0xCC7C9D91, 0x68066E44, 0xD89FD049,
+   0xEC83B2F1, 0x79BA895F, 0x10E90A64, 0x570C2DB4,
+   0x89C59658, 0xE00F1AE8, 0x78EDD742, 0xD94F065C,
+   0x00000021, 0xC5B5B0BD, 0x3FA27BD8, 0xA5121DE7,
+   0x432599D6, 0x2E8294CF, 0x528925DA, 0xCF0F9464,
+   0x28C15142, 0xA6FA7F3C, 0x38498320, 0xBA93F4B8,
+   0x92CDE9B1, 0x4BB98CAC, 0xEFE2455E, 0xD1B0E59C,
+   0xE0CC0EF1, 0x000000D6,
+   0xA1D24F4B, 0x64F62DCB, 0xF5776EF9, 0x134DA7C1,
+   0x534BF835, 0xB6699E3F, 0xEF275259, 0xC9B93539,
+   0x0F7CF548, 0xA9D68C87, 0xFBD2D9A9, 0x4EE54FF7,
+   0x465E7C2C, 0xCAF81404, 0x048CAD5D, 0xA02FCE30,
+   0x000000D4, 0x6E76C091, 0x9CE2E24C, 0x41EC4C75,
+   0x8353D7C9, 0x43A019D0, 0xE7F5BFBB, 0x508E92C9,
+   0x74CF2BBE, 0x8DFCBACA, 0x58F2E1B6, 0x98BDC65D,
+   0xBE79DF8B, 0xC699DB7E, 0xCEABFA1C, 0x0E3F9421,
+   0xE237815E, 0x00000093,
+   0x4DA6061A, 0x35CA7B71, 0x003E19C8, 0xA9BF19F0,
+   0x4C3C37F1, 0x1298C703, 0x921F123D, 0xEF43FC92,
+   0xCF8ACDBB, 0x065E9CB5, 0x0A25165F, 0xAF1392DF,
+   0x344D3FC5, 0x2174CEEA, 0x29D22225, 0xEBFE81C5,
+   0x000000D6, 0xBFF99BA3, 0x0FD8FDF2, 0x28498D5C,
+   0x7789D27D, 0x72535985, 0xC5D731B8, 0x44E0EC8D,
+   0x4DAC7615, 0x53628596, 0x1997B349, 0x3DF08420,
+   0xDA8F1B45, 0xE0DF23FD, 0x2CF56FDC, 0xF2C7864D,
+   0x3C9A7005, 0x0000019D,
+   0xD75DD2D2, 0xD558D1C2, 0x83C47104, 0x835A5291,
+   0xD6A8D82E, 0xBE1680CB, 0x71B65F2D, 0xF1ED7755,
+   0x7EDD4AA0, 0x375AC413, 0x863979E3, 0xCA2BF9C9,
+   0xB6A3F48C, 0x8B2D261E, 0x74FD8349, 0xE3FA313D,
+   0x0000001C, 0x3E70DD66, 0x0B866438, 0x15CEF5DC,
+   0x6A5FB43B, 0xF8871F0C, 0x83A0FE8C, 0x848F9812,
+   0xB879A0E6, 0xF35CA817, 0xF93CE978, 0x687D2A6D,
+   0x74643F68, 0xC6DF8A5F, 0xB9E7BA00, 0xFDD5D515,
+   0x151A645A, 0x000000C6,
+   0xBE54C3A6, 0x8C90E71A, 0xF71C5359, 0x449B10EA,
+   0x829FA44E, 0xEEA87DFD, 0x2CA80E90, 0xD8353EF0,
+   0xD1229447, 0xAA71620C, 0xD4344CAE, 0xB0445EF2,
+   0x451CE474, 0x2792EBB0, 0xC2907707, 0x3581DEED,
+   0x00000199, 0x94ADEFA4, 0x39EBEF02, 0x3AC01CA7,
+   0xC44FB92C, 0xC456C3CA, 0x4DF141E2, 0x471DBF3C,
+   0x20AED69B, 0xE85B7CE0, 0xB31DB16C, 0x6911A4FC,
+   0xC239E716, 0x21F7392E, 0x3D8C2303, 0xE19B03EB,
+   0x98F6F7E6, 0x00000142,
+   0xDDB4EB9E, 0xB8E81A2D, 0x3947B43A, 0x89F9C08F,
+   0xB0E758A3, 0x69D84B2B, 0x72BC3E5F, 0x862F5599,
+   0x4AC68EAB, 0xE9C56791, 0x8912BD54, 0x8D66059F,
+   0xEE35A78C, 0xA386E77F, 0x4303B216, 0xA434E2E6,
+   0x00000165, 0x13593D90, 0x545F7434, 0x55BBCB3F,
+   0x745C9100, 0xBB344485, 0x45E63824, 0x38C0F16B,
+   0xC26C34DD, 0xDF952E71, 0x55C10ECD, 0x98FD979A,
+   0x60C4A2E5, 0xA6FF9EF9, 0x5FF003EF, 0x5E578209,
+   0xDFB5FCE9, 0x00000077,
+   //Window 64
+   0xEAFFD713, 0xA87650D1, 0xA797AD44, 0xEC781C97,
+   0xB4BCAC17, 0x1E94ACCD, 0xB3981CC9, 0x2284F96F,
+   0x091634EB, 0xB8B2EF57, 0xCAD053D0, 0x4ACCF5E8,
+   0x5D1EF480, 0x0ECA4F9B, 0xD6E76957, 0x1598EF27,
+   0x00000131, 0xB72D8840, 0x7CBC9061, 0x86A5BA36,
+   0xE611924D, 0xE066D292, 0xE02E9CA8, 0xA68A0466,
+   0xDB092F52, 0x0C0B18F8, 0xF5D97F5D, 0x5C99B95C,
+   0xB5E17146, 0x9D3D6ACF, 0x1BAFBE74, 0xF370BD5F,
+   0x606103FE, 0x0000013B,
+   0x6599420C, 0xC65023DB, 0x2DE4F201, 0xD5F25993,
+   0x325DB6DE, 0xDF04EB7F, 0x088C5B7B, 0xBA7A4C67,
+   0x14FFF349, 0x42880303, 0xCED29B1C, 0x5D8C5AC1,
+   0xA9D0FF4F, 0xBA44893A, 0xED3F3117, 0xC94974BA,
+   0x0000010F, 0xFFE235F6, 0xD804DAFC, 0x67C31EFD,
+   0x1701E38D, 0x6B9307C1, 0xD6B49909, 0x1FA96EBA,
+   0xF33C7496, 0x92099D0B, 0xFAB4F9F8, 0x6D5334F5,
+   0x3CC5ED86, 0xC94E6D74, 0x41745249, 0xDD4B2B7C,
+   0x27EF9399, 0x0000018F,
+   0x1FFEBCA8, 0x9B27FAE4, 0xC5C859D5, 0xE9F906D8,
+   0x36E50ADE, 0xA3B727FF, 0xD7685714, 0x95307CF6,
+   0xB12746CD, 0xDDC0DF1F, 0x38D91211, 0x46128492,
+   0x1D3EC9C2, 0x09CB00C7, 0x556AEC93, 0x45BCC736,
+   0x00000147, 0x3B06B817, 0x08CAAAF7, 0x6F0EF309,
+   0x7664BB13, 0xF9D1878D, 0x6AE38711, 0xF8BE5C1F,
+   0x30BE2E46, 0x79E9064E, 0x6158AE6F, 0x6FBEDEA7,
+   0x52E5CBE0, 0x6DEF5C69, 0x0B8F64E7, 0xD1F043ED,
+   0x6AEA5E7C, 0x000000B6,
+   0x6939F7CC, 0x30FF765E, 0xE29539FA, 0x6B45FE45,
+   0x3DE8DEFF, 0x9BEE02F0, 0x422BB010, 0x5CFB4D5B,
+   0x66C50B56, 0x864E6A6F, 0x3CB97C42, 0x2B36BAEF,
+   0xF6376684, 0x5A2FDF30, 0xB8064230, 0x5FBF2F7A,
+   0x0000011B, 0x208CCE19, 0x6394407D, 0xF4A37C9E,
+   0x0FBE4793, 0x602CFFDB, 0x635DC6AA, 0xACE2DAF5,
+   0x914F6669, 0xF042C02D, 0xD66F7167, 0xDC027BE7,
+   0xFE264CEF, 0xF4742027, 0xA345D34A, 0x06F4FDAF,
+   0x2E4E5757, 0x0000005D,
+   0xE63F4E7F, 0xBCCB3642, 0x869F7099, 0x9F343A94,
+   0x42EEE4DB, 0xB8B3BC4C, 0xF998F8A2, 0x8E1D8586,
+   0x26725E25, 0x36154056, 0xD81D7899, 0x26652CA7,
+   0x67B9D205, 0xFDDC91CC, 0xCE8CFD5F, 0x2059B0D0,
+   0x00000047, 0x1440B4F2, 0x107BAE47, 0x64D7607F,
+   0x378189E0, 0x470A1059, 0x73CA91AE, 0x4D456089,
+   0x6AB675EB, 0xE0656F05, 0x306DA7F0, 0x1C3A4646,
+   0x804F3BAA, 0xD00A652F, 0x80511053, 0x9F4D092A,
+   0x4F67841B, 0x00000026,
+   0x28CE39C2, 0x5DBBFC3F, 0xE41302BB, 0xCE5D984A,
+   0x5F62ACAC, 0x060CC004, 0xF7D432EC, 0x41AD7D60,
+   0x291D987A, 0x4EB69079, 0xEC28F5D4, 0xFAA4D061,
+   0xAE9A0DDF, 0xDA420113, 0xF74E0364, 0xCB2031CB,
+   0x00000026, 0xDB64B474, 0x9B26F39A, 0x40E04631,
+   0x2B9AC464, 0x37FFC8B9, 0x7D2C268E, 0x3C25399A,
+   0x6368B04B, 0x7630B55A, 0xFBE401E4, 0x419BC5DF,
+   0x984F0D31, 0x83C0B5C8, 0x37F4A02E, 0x4EDFB554,
+   0x25BE36E0, 0x000000C0,
+   0xE5DF1EE8, 0x539620B3, 0x98A4376D, 0x724BDDC4,
+   0x33234887, 0x6F6AE029, 0x03F46458, 0x26197D14,
+   0xE404D18A, 0x4465B0D8, 0x611C982E, 0x366E65B5,
+   0x660CD920, 0x9A07F792, 0x4BF3E007, 0x85AD08D6,
+   0x000001EA, 0x8B2D1974, 0xEACDD6BD, 0x5879C25C,
+   0xC37E4816, 0x4260BEB6, 0x94009C61, 0x8D22FBDE,
+   0x454401C7, 0x74D28C0A, 0x97500E89, 0x6510E13E,
+   0xC8AC343A, 0xEF32B9AE, 0x93A4EC07, 0xCD156E07,
+   0x168AE283, 0x000001B1,
+   0x59E7D8E5, 0x4CD44065, 0x2FA7D08D, 0xF4D23765,
+   0x037E25D4, 0x369B860B, 0x83A2A990, 0xE3212A13,
+   0xE8FA5F22, 0xBB1D231A, 0x8A8FE4B7, 0xF9F74C12,
+   0x41880CC3, 0x161425D7, 0x26AA85A0, 0xAD5CF8E5,
+   0x0000005A, 0xDD38B2E7, 0x7C5D9354, 0x4359B98B,
+   0xEA7E6A9C, 0x3A0549BE, 0x76878D14, 0xE0D25608,
+   0x36582001, 0x5864C300, 0xCDADE390, 0x64649600,
+   0x2B76E2DE, 0x73012F98, 0xF25C6C87, 0x2192AC32,
+   0x7B20050F, 0x000001C6,
+   //Window 65
+   0x9185544D, 0x6D9B0C3C, 0x8DF2765F, 0xAD21890E,
+   0xCBE030A2, 0x47836EE3, 0xF7651AED, 0x606B9133,
+   0x71C00932, 0xB1A31586, 0xCFE05F47, 0x9806A369,
+   0xF57F3700, 0xC2EBC613, 0xF065F07C, 0x1022D6D2,
+   0x00000109, 0x514C45ED, 0xB292C583, 0x947E68A1,
+   0x89AC5BF2, 0xAF507C14, 0x633C4300, 0x7DA4020A,
+   0x943D7BA5, 0xC0ED8274, 0xD1E90C7A, 0xE59426E6,
+   0x9634868C, 0xC26BC9DE, 0x24A6FFF2, 0x152416CD,
+   0x1A012168, 0x0000000C,
+   0x86660E96, 0xD8BE53EB, 0x8BE7763D, 0x72C2673C,
+   0xC6B55BF0, 0xA7C5462E, 0x574A104B, 0x9DEF337B,
+   0x9E9A1386, 0xA8FE70AE, 0xBD010CF1, 0x6070F210,
+   0x94AE907B, 0x5D3EDA38, 0x1BEA88CB, 0xA69D8679,
+   0x00000000, 0x03C8DD6A, 0xD1DDE972, 0xD8950C30,
+   0x562332D1, 0x5EA340F7, 0x33BE213E, 0xEB40E91E,
+   0xEBB49ED4, 0x70B2CA5A, 0xEFE4AAC2, 0x900CEEB3,
+   0xF6AD3CC1, 0x6CC704D6, 0x67E9A881, 0x12FE8A0A,
+   0xDD3F2BAF, 0x000000BE,
+   0xB1167003, 0xE774EED9, 0x932845B9, 0xECDE86E1,
+   0x97A8A10D, 0x0381D178, 0xAEB8BEF7, 0x995A4926,
+   0x2304BAE0, 0x3EE19C81, 0xFE977E97, 0x541449E3,
+   0xA517B358, 0xD7EF476B, 0xE0D847CB, 0xE55330BC,
+   0x00000012, 0xF06A91D6, 0x1620A1D6, 0xAC578BFA,
+   0x714B3502, 0x6BED112D, 0x2606EBDB, 0x63F8E778,
+   0x8B7B2715, 0x651FD543, 0x31833913, 0xDC9638FE,
+   0x14929F1A, 0x3EE709D3, 0x2637EC81, 0x05547EAA,
+   0x39FAF7E7, 0x0000009C,
+   0xD7ECB581, 0xE77C03EE, 0xCEF15BEA, 0xB0B4DE18,
+   0xFA1EA3FF, 0x318E5B24, 0x710E95FD, 0xFD1D902E,
+   0x55CAFA30, 0x8DAEDA06, 0x2BD11001, 0xCABA29BF,
+   0xD88085BD, 0xAEC1861B, 0xE591D19A, 0xFAA66562,
+   0x000001F6, 0xB68C7429, 0xEEE386F7, 0x502C0797,
+   0x0A876AEC, 0xC6806FA9, 0xCB587DF8, 0xA84DE772,
+   0x4F7CB6DC, 0xF746CC93, 0x407A1F0F, 0x6B953E5C,
+   0x7862E9BB, 0x0A4C9357, 0x6C106CAA, 0xC0096E5D,
+   0x04213043, 0x000001AB,
+   0xBD35D8CB, 0x2AAEA367, 0xAE020E8F, 0xF2A64BD7,
+   0xD6DC5572, 0xD7F80264, 0x1F36C56F, 0x890E2362,
+   0xA09342DD, 0xB9DAF028, 0x90BF076F, 0x6CEE1FB1,
+   0x0F0412CE, 0xFAE167E7, 0x8A2FD483, 0x2A79D89A,
+   0x000000E0, 0x0849A624, 0xC222A245, 0x0082DEDA,
+   0xED4033DD, 0xDF0DC525, 0x11F78E31, 0xBB3EB85D,
+   0x34240B3E, 0xC287296A, 0x135D407D, 0x741FF1B3,
+   0xC47FBFCE, 0xDA643502, 0xE34DD021, 0x65E3BA7A,
+   0xF183174D, 0x00000116,
+   0x89B3A5A0, 0xFA37C4D0, 0x6065DECC, 0xA8ED9BD8,
+   0xEF8CC1DF, 0xC5068ACF, 0x8C98A08E, 0xEA2A7101,
+   0x1B4BAEAE, 0xDE77DD77, 0x2B794F71, 0x855A8B67,
+   0xCFC02477, 0x1ACF5585, 0xC30F94C2, 0x1535D73C,
+   0x00000149, 0xA566C87B, 0xC7F723EB, 0x2CD0A69D,
+   0x88D22C71, 0xF60C47C0, 0xD7F9318B, 0x9C239254,
+   0x8D652ED7, 0xC46760CB, 0x186AB5D6, 0x88E7879D,
+   0xF83BB0D5, 0x122A83B2, 0x2976DAAC, 0xF240460A,
+   0xC7BC8602, 0x0000010A,
+   0x08EA3335, 0x866FF3C9, 0x88D2EC52, 0xFB58377C,
+   0x14A8829C, 0x5715D9E0, 0x0595D929, 0x9376778B,
+   0x9B8ED6B5, 0xC1CCD5D5, 0x00D1367F, 0xD90D82DC,
+   0x4CD41C48, 0x15BCE4D8, 0x44A2B97E, 0x11448741,
+   0x0000017F, 0x60AA94E0, 0x0E3E35FE, 0x4891E593,
+   0xAA145696, 0x402EAD1B, 0x51EC590F, 0x7345D47D,
+   0x23C0996D, 0x2CA244E6, 0xD93E5A1A, 0xDF85D7F8,
+   0x80C00F6F, 0x867D760E, 0x1CA50525, 0x0984377B,
+   0x29CF9FB2, 0x00000196,
+   0x1E073747, 0xD8BF062C, 0xEE2E6D05, 0x26C96D9F,
+   0x890B4D75, 0x79D919D7, 0x00653FBB, 0xB42E2BB9,
+   0xE3CCC877, 0xF8987798, 0x5033DE8D, 0xB47D6EB2,
+   0x6C5FD1A3, 0x39F94C59, 0x2FA0AB65, 0xF3C0C388,
+   0x000000C9, 0x2B18B119, 0x9661D7F8, 0xC4B5C3D0,
+   0x6FA045EC, 0x3BCF37A2, 0xC858DE88, 0x3224D885,
+   0xD81D90FB, 0x7A8377E5, 0xF251A9F7, 0xA3D8C771,
+   0xFEB83A50, 0xB5394FE7, 0x853CFABC, 0x67C9EBA6,
+   0x950559BF, 0x00000000,
+   //Window 66
+   0x286492AD, 0xEE31E71A, 0x65F86AC4, 0x08F3DE44,
+   0xDA713CB4, 0xE89700D4, 0xA86B7104, 0x7AD0F5E9,
+   0x2572C161, 0xD9A62E4F, 0x25CC1C99, 0x77D223EF,
+   0x3B962E0C, 0xEDFF6961, 0x81D8B205, 0x818D28F3,
+   0x0000008E, 0x8CDF1F60, 0x721231CF, 0x6717760F,
+   0x8B640F2B, 0xE045A403, 0xBE726F8C, 0x0370689F,
+   0x422285DC, 0x72EA0DCB, 0x7196BF8F, 0xC8086623,
+   0xA16F7855, 0xC326FE48, 0xD4E19FC7, 0x8F68BF44,
+   0xFDBC856E, 0x0000013E,
+   0xB1773DFD, 0x615D6F52, 0x4E0042A3, 0x10247D0B,
+   0x6D50EEA4, 0xEBEA88D6, 0x912C0AAA, 0x51FBDD41,
+   0x9B0497AA, 0x2B487636, 0xAA18B8E6, 0x202D12DE,
+   0xA19B76CC, 0x719A9526, 0x6A37386C, 0xA91A4509,
+   0x000000BD, 0x967C2E8A, 0xBB846181, 0x796FED3B,
+   0x1A547496, 0x34C152FA, 0x3AE904FD, 0x21C58DAC,
+   0x185C46F8, 0xC999F2A9, 0x2D8F1B5C, 0x06C88BDD,
+   0x9C99663C, 0x7DC27E48, 0x417038F1, 0x0C025D84,
+   0xFFB6343B, 0x000000E6,
+   0xD6057266, 0xC9E4ADA3, 0xDCC7CEC8, 0xC6488350,
+   0xBC4568E6, 0x2069C962, 0x694DB690, 0x29DF0E10,
+   0x5177E692, 0xD6985BFF, 0x08CD287F, 0x27983B3A,
+   0x6345B7F1, 0x4D22350E, 0x9D0C2BF4, 0x28341DE9,
+   0x000001D8, 0xF30E2472, 0x70F6A7CB, 0x1C7EDB49,
+   0xABADEB7B, 0x66CFBC6A, 0x8A985664, 0x1C912BD7,
+   0x27B7657B, 0x2E9820A8, 0x91BBDE9D, 0x1B43A2BE,
+   0xBD6CBBC1, 0xD68FF203, 0xC9865101, 0xE1A9E48B,
+   0xDB44C847, 0x000000BD,
+   0x3004860A, 0x8B24FFB5, 0x54D544F4, 0xD400D906,
+   0xEAF7C7FD, 0x6B33DE80, 0x80B37417, 0x830FDFEE,
+   0xEC3016F3, 0xC465549D, 0x731EAB5F, 0x5E944E56,
+   0x98BBB88D, 0xBD4E24E3, 0xEE3CC23A, 0x0EC84651,
+   0x00000017, 0x41F46949, 0x1EC4CC3F, 0xD1F65059,
+   0x689A004B, 0x613B2A84, 0x198E7CEE, 0xD6CABCE4,
+   0x35A07118, 0xF0BE8230, 0xBD2F4B6B, 0x744E78BF,
+   0x6DD42C2E, 0x024D8140, 0x8EF14CB4, 0x3126010B,
+   0x60769521, 0x00000016,
+   0xB8F1A369, 0x205EF08E, 0x8BE6F437, 0xB3E91D22,
+   0xCDC36585, 0xB52B53A7, 0x3A1E3DBC, 0xA972DDCF,
+   0x1EBF3C19, 0xE61A1AD4, 0xD97D3DD5, 0x409E4E39,
+   0x896E267B, 0x97FDE509, 0xD121E069, 0xD291040D,
+   0x0000015B, 0x58E89C28, 0xC2EF5FC5, 0x8D9D25B1,
+   0x2F1F738C, 0xF8EC3234, 0x5ABB99AC, 0xCD690312,
+   0xDF1BD864, 0xBDB2220C, 0x67BF5942, 0x5614DD59,
+   0x5890FC74, 0xE569CF5C, 0x5846E4FA, 0x2C535C2B,
+   0xD73F0FCF, 0x00000191,
+   0xD6078A87, 0xEF66EDE3, 0x82DC8DB9, 0x4D3351FE,
+   0xA8F49720, 0x46D5CFEE, 0x6CF805FD, 0xF96768F7,
+   0x9CD89717, 0x151386EC, 0x4C34698B, 0x615C4E04,
+   0x88BEA055, 0xA8CA749B, 0xD3E29B1E, 0x4AE7493D,
+   0x000000FA, 0x0FEF8E10, 0x99534B36, 0xF2A5E723,
+   0x9175AF31, 0xCE01F193, 0x64104C36, 0x0C708522,
+   0x8B4D3BE6, 0x91B8A738, 0x025702FA, 0x5D20E200,
+   0xF8FC91C9, 0x9981D22F, 0x7A88F458, 0x319B3D09,
+   0xCE4F31DF, 0x0000018E,
+   0x25735327, 0xF047E887, 0x0DF0EBFF, 0x66967206,
+   0xC9697E6A, 0x007F523A, 0x8218B455, 0x0714166C,
+   0xCDA64495, 0x70346F06, 0x28C121A4, 0x2F04AE28,
+   0xDA6B6EB2, 0xD1AE7709, 0xEEB4F704, 0x44754972,
+   0x00000107, 0x116FF4B6, 0xEA066B58, 0x8F7258CD,
+   0xC530E8BA, 0xFE9CC8EE, 0x95805AA0, 0xAC4A044B,
+   0x1D171FAF, 0x9586171D, 0x8D15C832, 0x672E59D2,
+   0x4BF3C652, 0x9B4BA05C, 0xA28A3A25, 0x568FBF88,
+   0xD4BEDB84, 0x00000170,
+   0xB05AE955, 0x82627C91, 0x826A1B43, 0x7D170FE6,
+   0x3F32FCED, 0x0DA74DA2, 0xF683E531, 0x71A23910,
+   0x281A3B76, 0x8867FF76, 0xADC2BAD9, 0x972F75E5,
+   0x71AA96F9, 0x5634AE77, 0x6C50328A, 0x2EDD8B08,
+   0x00000011, 0x85353D21, 0x4DF0DCEA, 0x6BB6AF00,
+   0x666ACBF5, 0x57B17928, 0xBACDFFA0, 0xA6A5A474,
+   0xD1216436, 0x9A3AFD1F, 0xC4D05FDC, 0x631F8B1B,
+   0xB9031B05, 0x59FC2D69, 0x01721DFD, 0xEAFEE783,
+   0xB6999C22, 0x000001F0,
+   //Window 67
+   0x85EDC827, 0x56F74E69, 0x6A731640, 0xAFE2EF0A,
+   0xD51647D7, 0x61F8BCFD, 0x41E33FA7, 0xBEABBB8F,
+   0xEC83C547, 0x3E4C3AAE, 0x2CC8DD97, 0x48A9D1E9,
+   0xE57D3822, 0x7B4D53B5, 0xA45C0584, 0x92387AC8,
+   0x000000D5, 0xFACDB1CB, 0x802ECE3D, 0x9E537236,
+   0x9E4F5D20, 0x386A5610, 0xD10ACC25, 0x4C6C0247,
+   0x53F55D46, 0x8C419FA4, 0x390FE980, 0xBED2BD92,
+   0x8B0A8AA6, 0xF854424F, 0x90E7F479, 0x9E7F4392,
+   0xD714BFB5, 0x00000074,
+   0xEDFCBEDE, 0x74AF3F63, 0x1356F827, 0x6B0830B1,
+   0x02536F8A, 0x060DB15A, 0xF7095358, 0x166F9099,
+   0xE03B9601, 0xD759EFB4, 0x68484F67, 0x05A4E297,
+   0xDC631A7A, 0x469B4832, 0x0BB2B1B6, 0x7C540615,
+   0x000001B2, 0x12481C04, 0x590174E0, 0xD7180A84,
+   0x8D4EF6C7, 0x303674DD, 0xD134B543, 0x00C378B0,
+   0x60DBF726, 0x93D8406C, 0xC60E026A, 0x082C527C,
+   0x57AF4A82, 0x349A607F, 0xE3D038FE, 0x5A3582E5,
+   0xA7CB9B47, 0x000000C6,
+   0x1FE423C0, 0x5466A990, 0xA57E7875, 0x59F6A48B,
+   0xCB7BD46A, 0x09A9F84A, 0x69E02DF0, 0xB5AE0D94,
+   0xD9FEC11C, 0xAECC3392, 0xA4BCD130, 0xC94DE920,
+   0x82C78F1B, 0xFB5B36F8, 0x2D4FC970, 0x32AD1CF2,
+   0x000001FB, 0xDF0A2534, 0x8CD894D5, 0x9735FC04,
+   0xCB83665C, 0x35169F6F, 0xCBD91576, 0x2775C9D4,
+   0x2F3B64A7, 0xDD6410D3, 0x80C9608F, 0xBCAD20D5,
+   0x6503BADC, 0x1B2B1640, 0xBDB30857, 0x78FBC82A,
+   0x92338C78, 0x000000D6,
+   0xE8A300EC, 0x3EE61D53, 0xE0CD8617, 0x65E529C7,
+   0x077B303B, 0xB8C03CB0, 0xD5C88DD2, 0x05EBA936,
+   0xD42BB4AF, 0xC1E54497, 0xB0589057, 0xAB477AAF,
+   0xE8F70A56, 0x55ACDDC8, 0x4FC80182, 0x6579B78B,
+   0x00000164, 0xBC97C72E, 0x535E7FF0, 0x809DC093,
+   0x65E954C9, 0xCD182EE3, 0x49EDC4B8, 0x877D38AD,
+   0x804874F9, 0x6DF1638D, 0x20104AB1, 0x748EE6F2,
+   0x78459A4B, 0x3504AA35, 0xB895205D, 0xF8089E32,
+   0xBF26AC8A, 0x00000041,
+   0x6FC3E4D4, 0xD877404A, 0x43959C60, 0x90F44241,
+   0xADD26AA4, 0xB11BC0DF, 0x8773BDDE, 0x45C833FE,
+   0xCA264F8D, 0x26E39709, 0x46314F2A, 0xCC875924,
+   0x53DDF49A, 0xD9DEF198, 0x95742A00, 0xCD60DE64,
+   0x000000BB, 0x87D742A0, 0x5CB12074, 0x655AFE45,
+   0x41DDAA31, 0xA54ECE2C, 0x69765BA5, 0x0B4B57B8,
+   0x575D2181, 0xFDEC936B, 0x8540DE4B, 0x13C17184,
+   0x2D73CCBA, 0xA345FE93, 0xDEBA26F2, 0x44FC190C,
+   0xF9A81158, 0x000000E6,
+   0x8D0BC669, 0xF0469163, 0xE939F5A9, 0x62B84488,
+   0x80FE63B5, 0x0D3F4953, 0x58880C15, 0xE39A7AA1,
+   0xE613F21D, 0x74DF281E, 0xFA016692, 0x908934DC,
+   0x980904B0, 0x5B9CF6CC, 0x3A17DD3A, 0x0F3AA0F4,
+   0x00000105, 0x651D59E1, 0x346BD219, 0xC71B37BF,
+   0x51024297, 0xF0640F18, 0xC634D031, 0xFF003294,
+   0xA657DA60, 0x15AABD29, 0x9CFC79FC, 0x7B4A869F,
+   0x56807DD7, 0x59D9033C, 0xCD97CD89, 0xA3233C39,
+   0x58640103, 0x00000090,
+   0xC8A4656D, 0xFEA0D82E, 0x03D94A84, 0x0FA181B5,
+   0xF8B5C4F4, 0x3666BFD2, 0x619D399C, 0x4E246013,
+   0xC11C1CE3, 0xEA46DFC9, 0x10AF3583, 0xDFB408AA,
+   0x785D7D61, 0x94FCE3F2, 0x1FEFF091, 0x3244F618,
+   0x000001B8, 0xADD4F84A, 0x939D98F4, 0xE9D04356,
+   0x4C2E3D15, 0xC5D1729D, 0x08529C57, 0x09597836,
+   0x4966BF77, 0xF4B32760, 0x03B9958C, 0x6A9536D0,
+   0x2E7213B4, 0x84FAA490, 0x455CEB59, 0x146ED682,
+   0x7D83E2F5, 0x00000004,
+   0xCD27FF10, 0x8626CBA3, 0xDC15323D, 0x5F83C650,
+   0x42CC94E3, 0x370D9730, 0xDB164003, 0x06EBD6EF,
+   0x82850E4B, 0xCDA6F2D7, 0x17A82FCB, 0x74E500EF,
+   0xB228248B, 0xDDAB08DB, 0x870A453E, 0x56E403D5,
+   0x00000083, 0x79DCFE50, 0x507272FC, 0xB3D2BA34,
+   0x25EE735D, 0xFC3349EE, 0x92386ED3, 0xF9EBDEB6,
+   0xB0A88DE8, 0xDD93ABF9, 0xF1EF010C, 0xA0838914,
+   0xEAD25256, 0xD54B6544, 0xCE2ACBC0, 0x7C94CE27,
+   0xBC78CE9A, 0x000000D9,
+   //Window 68
+   0xCECDF0DC, 0x0E13C1DD, 0xEEB9AA6C, 0xACD530B6,
+   0x0AF8D3A8, 0xBE3C0FC8, 0xCE44AE8B, 0xEE67F380,
+   0x3854B528, 0x9ADC5636, 0x130F4497, 0x527F7F90,
+   0xE80C35CE, 0xEE085713, 0x190FAE23, 0x29BC4B3E,
+   0x00000064, 0xDBB3838A, 0x17EA6FB5, 0xB425AF89,
+   0x192ECA92, 0x85A94659, 0x5FD3BFCF, 0xDAA4B4CC,
+   0x8D75B3F5, 0x9BEE144F, 0xBACC18B8, 0xFF60EC49,
+   0x57591774, 0x2363AC43, 0x319CBA95, 0x472EE36C,
+   0x6C0D079E, 0x000000F0,
+   0xA5D3A5D9, 0x580EC898, 0x9B2E3634, 0x0E28A410,
+   0x01745208, 0x102192B6, 0xF59C2C84, 0x4D825DC6,
+   0x7668CB0E, 0xD2B9B7F6, 0x71E242ED, 0xF05D43BB,
+   0x4CCA8CB4, 0x23F73DC2, 0xC7CB313D, 0x7234064E,
+   0x000000E9, 0x3A3635BC, 0xF4B4B560, 0xD9802D9B,
+   0xFEC87A30, 0x3E418320, 0x9C4D252A, 0x2EB17033,
+   0xC8C7B693, 0x2E742B43, 0xC0AA375C, 0xC02C9434,
+   0xB69BD932, 0xB6A13B4F, 0x9D910EB8, 0xE6C4A9B3,
+   0x5B554917, 0x00000030,
+   0xC9C4F27A, 0x36E215CD, 0x651A2560, 0xC5D2E709,
+   0xEF794A32, 0xD4A5BD4F, 0xAA33F31C, 0xB1771BA6,
+   0x057DA3E5, 0xF4C791A4, 0x90EC819A, 0x3547E13D,
+   0xD10059E2, 0x2E6971EF, 0x7804F13A, 0xF19C250C,
+   0x00000048, 0x113453AA, 0x968A695D, 0x0CC6EE85,
+   0xB904A5B5, 0xABDC4582, 0x272F50FE, 0x556B5A9F,
+   0x7B14D09C, 0xC7FE5D92, 0x2ED5EF74, 0xFCD4A5C5,
+   0x3C32A9E1, 0xDFFFF064, 0xAC5F1B7B, 0x67BA52AE,
+   0xA28FA361, 0x00000056,
+   0x6F0C982D, 0x32187B6A, 0x2106BDC5, 0x811425B3,
+   0x878BF63A, 0xF2636CA0, 0x3C1696BF, 0xA42B1436,
+   0x53EE54C8, 0x0BB71458, 0x37C638B3, 0x2C43B3AC,
+   0xF4464091, 0x9A404C2E, 0x7509002E, 0x7CDB0CD2,
+   0x000001FE, 0xEA37A696, 0xD333DB10, 0xD5914E15,
+   0xAC1F2FE8, 0x522FCB80, 0x91744924, 0x17E64A4B,
+   0x186A0551, 0x174E2689, 0x51DCD48B, 0x0F429C85,
+   0x84AE67EC, 0xBA520A90, 0xACD5C1C5, 0x20138359,
+   0x30654522, 0x000000A5,
+   0x27A6345F, 0x29920BF9, 0x77EB6A61, 0xAE5023A5,
+   0xD36668B6, 0x8BBB5093, 0x6A733464, 0xC7A5AFE2,
+   0xE2C46522, 0xF250D1B4, 0xC5179D99, 0xAB651BB7,
+   0x70F5DABF, 0x9807A5E2, 0xA7DAB4FA, 0x6DF70B5D,
+   0x00000092, 0x16CF86FD, 0xD8EE9B91, 0x413B0347,
+   0xB0B2A36B, 0x3785AF26, 0xD1162660, 0xE4EF883A,
+   0x5251232F, 0xABAC1CDB, 0xA59FD0A5, 0x5EC3D940,
+   0xD91DE87B, 0xBA259322, 0x363280FD, 0xF5B8DC29,
+   0xA978D347, 0x0000007E,
+   0x2A1C55FE, 0x427CB388, 0x74205929, 0x32426A70,
+   0x6A92AE9B, 0x356B1128, 0xF3BB8831, 0x8E9DF66A,
+   0xCDE8F7E1, 0x95343409, 0x3869398E, 0x4DA5C256,
+   0xBE3CD9C5, 0x545E620F, 0xD031D95B, 0x611D5000,
+   0x00000015, 0xD0DB8A71, 0x7476A724, 0x9F662806,
+   0x97D25FA1, 0x79E1D45F, 0x4AB9F2F2, 0xC09EB8A4,
+   0xC001E37C, 0x1CFE8D8C, 0xF4A49CCF, 0xEA24B1E1,
+   0x447030FD, 0xE6BC349C, 0x595DA6BF, 0xA7FBD189,
+   0x6B8FD85D, 0x00000076,
+   0x728923F7, 0x94A38EAC, 0x7C3F0E36, 0x5D1B8C06,
+   0x8D2127AB, 0x6EE038B7, 0x39933512, 0x8EF3ADED,
+   0xF3C78C96, 0x000A74D1, 0x83F9CB7B, 0x0D340BCD,
+   0x61488B29, 0x6E4E43B0, 0xF6A0519D, 0xA660C17B,
+   0x00000045, 0x7775DA65, 0x85F9E1AB, 0x8256CD67,
+   0xE07A4314, 0xF8668846, 0x766950D1, 0x92C04DA4,
+   0x296D0B2D, 0x17821662, 0x9E095B30, 0x4C925EA3,
+   0x4D561A20, 0xFD8D351C, 0x71F2C85E, 0x03134EBE,
+   0x56B110DB, 0x0000007A,
+   0x19703702, 0x5237A07C, 0x3AD0D053, 0x46C28A5C,
+   0x1A518E3F, 0x1FBEEED7, 0x2A3D429B, 0xDC635836,
+   0x95422D85, 0x39BCAC79, 0x1CE505AF, 0xB72A3173,
+   0x9A506100, 0x4149416A, 0xACB8F741, 0x9DC7A2FE,
+   0x000000DE, 0x55977BBA, 0x23C01A98, 0xFA04A7B7,
+   0xC5C16AD7, 0x92FB109F, 0x751CA1EE, 0xEF6D534C,
+   0x94E2FC37, 0x0B18FFAF, 0xF9A7BFC2, 0x41A1D0BC,
+   0x35B6BC9A, 0xF2DA291F, 0x2D76829F, 0x609D7B37,
+   0xF969C68E, 0x00000098,
+   //Window 69
+   0x07207165, 0x51DB2D9D, 0xC3D4C59C, 0xC7D56A41,
+   0x4E278B0E, 0xA47FADDA, 0x04FFC588, 0x5C3964E2,
+   0x9719ECFD, 0x52BC9F38, 0x35A04049, 0x2C9292C0,
+   0xFAE7580E, 0x885FF9BA, 0xD5CC866E, 0x2319A2DC,
+   0x0000015C, 0x0AE9AF6E, 0x8B77DDB7, 0xDD7FD36C,
+   0x0E21B050, 0xDC8B9C19, 0x35D968EC, 0xA624AD4F,
+   0x6F3F0785, 0x1D42C97E, 0x97778A68, 0xA2A4342C,
+   0x86103BF0, 0x3ABABC35, 0x0AEF36FD, 0x2FE10364,
+   0x46C8FB21, 0x000001E1,
+   0xF1EBE533, 0x604B730E, 0x0B4B9191, 0x336E362E,
+   0xB711E872, 0x246E5C1A, 0xF46E3F97, 0x652DC2C1,
+   0x1398E328, 0xC3492E15, 0x475CD2BF, 0xD85F2669,
+   0xA3C972BB, 0xB4B28424, 0x49A9AC4E, 0xF3D57116,
+   0x00000148, 0x25E365FE, 0x2A5E5F54, 0x6ABD415A,
+   0x9202DDFF, 0xCB24F45A, 0x314E872A, 0xB7BCC7D1,
+   0xCED1DCD9, 0x0377CE8F, 0x0D39CF24, 0xD1065414,
+   0x75EB96C9, 0x9FE0EE9A, 0x984B4A45, 0x04703AB1,
+   0x82376167, 0x0000011F,
+   0x6BB2C3B8, 0xAD4F1881, 0xD380CA18, 0xD45F9A0C,
+   0xACA25641, 0xFB839DAF, 0x7E519019, 0xB89884F2,
+   0x58CD6C25, 0xDE295E54, 0x25A1E8CB, 0x1BC5070E,
+   0x47C21E93, 0x66F16357, 0xA4BDDFA8, 0x379E8F32,
+   0x00000108, 0x87CC4A52, 0x9141EA4E, 0x72CFF2EB,
+   0x285CBAF9, 0xF492BE77, 0x27898F4D, 0x223C8859,
+   0xD49D035F, 0x726065CB, 0x763866C2, 0xB2EB9E8A,
+   0x0886E8D5, 0x1F70BF7B, 0x7DEB06B3, 0x889D3E33,
+   0x8CE6BCB7, 0x00000060,
+   0x7514E752, 0xC466FD7B, 0x8E1FD662, 0xC0C9A0AF,
+   0x7F3083FC, 0xD4B0AE39, 0x24CB5771, 0x9AF1C21F,
+   0x469DCD1E, 0x8C20329D, 0x6579990D, 0xB115FDD2,
+   0x3160B749, 0xCCD93D2A, 0x96F8FE36, 0x4AA17BB9,
+   0x0000004E, 0x4118EBF1, 0xEA95C80A, 0xE78B533B,
+   0x267CE3A6, 0x152EE4F3, 0x54167EB7, 0xD6D5B4C9,
+   0xDA581B52, 0x4F9408C6, 0x285DDAA4, 0x1FF6C988,
+   0xA1E4D6DC, 0x7540A223, 0x9D146407, 0xF46C92D9,
+   0x127967A3, 0x000000FF,
+   0x35FA7474, 0xEFF85D21, 0xA3B4B0A2, 0x478BA48F,
+   0x0EA2B802, 0x087CDF11, 0xBA11FF51, 0x48F897D3,
+   0x08DDEF7F, 0x623EB686, 0xF0E7A51C, 0xA0AAB59F,
+   0x24CFC222, 0xD57BF13D, 0xF3FF3D1F, 0x71F63064,
+   0x00000043, 0x29660CF3, 0xFF76D75B, 0x9DD9F504,
+   0x723D7DD6, 0x93A1D16C, 0xBDA1A7DF, 0xF13B9971,
+   0xB2F3A649, 0x4287624B, 0xE0E39401, 0x244274AF,
+   0x7B9B95B9, 0x64B5FC23, 0x4809FEDF, 0x8E597DC4,
+   0xCAE69EDD, 0x000001B0,
+   0xDB07A31C, 0xB1C5EB86, 0xCE9E977E, 0xC121E0F5,
+   0x0AB570AE, 0xE3163D99, 0x47FC4475, 0xD6DE9266,
+   0x23CC673C, 0x368DE13A, 0x8B441C52, 0x9EF5398E,
+   0xCDADACE5, 0xE79A4360, 0x395657A0, 0xFE282472,
+   0x00000148, 0x6111BA3B, 0x2DB98B55, 0x3B72F8E5,
+   0xA7E28D4D, 0xC466D322, 0x0A223411, 0xDF81B171,
+   0xC1559B60, 0x67859FC6, 0x6DD083A7, 0x4BB1D85C,
+   0x0A916F4E, 0xDF0DA188, 0xE6DC1F67, 0x4A6A6842,
+   0x82DF6504, 0x000000FA,
+   0x1C878A90, 0xC4A5C4D0, 0x6835CBD1, 0xC83400E5,
+   0x7203D0E5, 0x91DC0FD9, 0xF952ECA6, 0x4A3A88B9,
+   0x8F9EB1E8, 0x997DCE7B, 0xABB34A2A, 0x7411C37D,
+   0x1B1B8216, 0x7BAD66F7, 0xAAA64441, 0xDB4358AF,
+   0x0000011E, 0x536BCB88, 0xBB9C34F9, 0x5CA0BD3C,
+   0xD21D0754, 0x761DAAF0, 0x2A6593BE, 0x1FC6592B,
+   0x454ECA23, 0x17688CC7, 0x39B2FC3F, 0xBF5A5DF3,
+   0x72DB65C7, 0x258F3461, 0x7979335F, 0x4BF1F6D1,
+   0xE8970233, 0x000000B9,
+   0x1798AD85, 0xA6CBF9D2, 0x6503FD07, 0xCD0D0E04,
+   0x2A0328B7, 0xB1CA6345, 0x38618354, 0x8084E8DE,
+   0x8F63992B, 0x9A2C7E8E, 0xA2FC8EC6, 0x40E91FCF,
+   0x3387D75B, 0x006B8763, 0x15C2A46E, 0xF980C34E,
+   0x00000142, 0x07343464, 0x09BE979B, 0x1609954C,
+   0x7C8447BD, 0xA8D43B5D, 0x16664F7B, 0x6242E93D,
+   0xD7003AB8, 0x9BC6A8B7, 0x8C8113BE, 0x1424B6F4,
+   0x0464AFC3, 0xCF19C3F5, 0xDF4EFA6F, 0x97CD9CF2,
+   0xF371AEA5, 0x00000095,
+   //Window 70
+   0x0AC4CB66, 0x4C740AE1, 0x59C635FF, 0xC8A66D97,
+   0x2569DAC8, 0x328B65AF, 0x8838DBC9, 0xFDB6599B,
+   0x7FD83C9F, 0x702473F8, 0x128683F6, 0x0D1F2AD8,
+   0x5030B76B, 0x00AE5B50, 0x6D15B5ED, 0xB1375D70,
+   0x00000159, 0x1F1E1F7F, 0x7A772A90, 0xC669AA61,
+   0xA790DCB7, 0xC5E4F185, 0xDAD905AE, 0x116AD6CE,
+   0x3BD91C29, 0xC329D8A7, 0xF87C96EA, 0xB5B14581,
+   0x399C929C, 0x3A8253C0, 0x6FD2983C, 0xDA988B39,
+   0x616A8B61, 0x00000181,
+   0x524BC705, 0x3A070E58, 0xFBD0358F, 0x86404F01,
+   0x74567144, 0x88456D78, 0x4CB2BF46, 0x91AABC49,
+   0xB1E29372, 0x829DF4FD, 0x230CF9F5, 0xF177CE20,
+   0x7A3D29CA, 0x404ECA03, 0x231007DF, 0x6D9B609A,
+   0x00000159, 0xB1BF4593, 0x7FF3369E, 0x5E4049A7,
+   0x94FF624F, 0x34194BC1, 0x5B7EF741, 0x131B06F0,
+   0xF4BAC202, 0xB7549633, 0x70A46357, 0x761AE1BB,
+   0x0B293380, 0x974C1977, 0xB2D9C64D, 0x00E7751A,
+   0xE27E23B4, 0x000001DC,
+   0xAA505F62, 0x8B7BAD84, 0xECBD5F9E, 0x8052B3CB,
+   0xB3660A2B, 0x0E985E1A, 0xA69BDFAA, 0xC17E62D3,
+   0x89B5E1E8, 0x9BB10331, 0x6B55D39A, 0xC572485A,
+   0xDF1F6747, 0xC322F39A, 0xC81CB6FD, 0x88881E7F,
+   0x000000D9, 0x3310A660, 0x31D3F849, 0xFDC9DB36,
+   0xDD188984, 0x3C61B203, 0x89A0AF2C, 0x8E454871,
+   0x508FAE9C, 0x69879C4F, 0x2EBD3D7A, 0x83E6E3F8,
+   0x5AC4C93D, 0xC59F4C51, 0x71744332, 0xAD204B19,
+   0x0322F749, 0x00000057,
+   0x55B6F895, 0x6871A6E1, 0x9D7E2730, 0xB935913E,
+   0xA9AC21A4, 0xFE1EEBB1, 0x29C16938, 0xFDAB8794,
+   0xDEEB21B9, 0xEB9AFE9A, 0x797F546D, 0x967A2FB2,
+   0xB9CF34CB, 0x2FE2023B, 0xE049697B, 0x9272977E,
+   0x000000CA, 0x50B4A316, 0x348928EF, 0xE32C9A4F,
+   0x115E58EC, 0xE3A235FF, 0x6D858BE4, 0x72B943B7,
+   0x7464D704, 0xE862030B, 0x6E785131, 0xB8A27819,
+   0x4060A8C7, 0xD3E4F0D6, 0x831B7288, 0xB36C3F8B,
+   0x81C21F75, 0x00000004,
+   0x9E107222, 0x23AC84CD, 0x130ABB36, 0x011F6752,
+   0x5931A184, 0x83D1979F, 0x4349BEE2, 0x87880BE0,
+   0x6B06EBE2, 0x78520956, 0x5C02EECF, 0xA12C6E2F,
+   0x2C027B98, 0xCFB3B87D, 0x59D49343, 0xE399B69F,
+   0x000000DF, 0xF763472A, 0x73F60492, 0xA32C8E02,
+   0xD0630D7A, 0x0B7EB763, 0x64FDA274, 0xC0295433,
+   0xD2EBDD95, 0xF8650B05, 0xD3BF0C58, 0xDF491D11,
+   0xC0C0A4AB, 0xBEC2EFD6, 0xFDD83464, 0x63FEC348,
+   0x42DBBF33, 0x000001E4,
+   0xF196B6A1, 0x02E9C325, 0xB0374324, 0xCFC01DE1,
+   0x0121A620, 0x289B25BE, 0xF09B541F, 0xEC188AF9,
+   0xFCB86A52, 0xAC954BC5, 0x87A757B9, 0xD883B21F,
+   0x2741CD24, 0x1194E3A1, 0x1E3EF5EA, 0x3D1914B6,
+   0x000001FB, 0x6BFD085D, 0xB13EA483, 0x04A5DCD1,
+   0x6E20B8D5, 0x7F7AF4FE, 0xCF5FBA25, 0x914D9C51,
+   0x58625751, 0xEB304193, 0x1005BCC9, 0x579943F8,
+   0x7B54EF23, 0xC7D1C9BA, 0x50EAD06C, 0x3664CF97,
+   0xCD987767, 0x0000010A,
+   0xE40E993D, 0xC8B31578, 0x041D243F, 0xDD419459,
+   0x2FBAF7C6, 0x0C47E449, 0x7D71B295, 0x10B731C4,
+   0xF36A08C0, 0x41DCA681, 0x3D924E38, 0xEC358240,
+   0x8593F600, 0x891991A8, 0x4A984C9E, 0x8D684B37,
+   0x00000109, 0xA8A706DC, 0x44787399, 0x53CAA9BA,
+   0x307E57CB, 0x76A3276E, 0xEA0AD375, 0x2E025195,
+   0xB1B79DB1, 0xAA828A3F, 0x96703F51, 0x536E5266,
+   0x174F1C27, 0xFBA650E5, 0xC2D7DA86, 0x1BED53A0,
+   0xE6920805, 0x0000010F,
+   0x53938400, 0x409BEFF8, 0xC460D38B, 0x3593E4F9,
+   0xF0673911, 0x6D0B5D57, 0xC72C6491, 0x22C8DCAE,
+   0x73E0EA62, 0xE6E263F1, 0x12ECE129, 0x14C1E165,
+   0x9A474FF0, 0x45B34F06, 0xB96851D9, 0x36C07C4F,
+   0x000001FC, 0x8259BF92, 0x250B8E25, 0x866E22FE,
+   0xFB6826A6, 0x35566F47, 0x1D0FB6D9, 0x04537FAA,
+   0x63810185, 0xF1D6BCDC, 0xF8F10B30, 0xABBF20C8,
+   0x6CE068C4, 0x44FCF678, 0x3CEAA8C9, 0xAA121E6B,
+   0x44C0EE4D, 0x0000012C,
+   //Window 71
+   0xDF5EE186, 0x3878C70A, 0x6FFFEF9F, 0x62F4F54A,
+   0x80400FA0, 0x0A7664C3, 0xD0EA21B9, 0x99BE58C2,
+   0xE311AA6D, 0xFA70B9AD, 0xABF43A4D, 0xAFADD452,
+   0x0F7B5DE5, 0xE6291C61, 0x78D61E62, 0x388A4215,
+   0x00000024, 0xEE1BCDAF, 0xF188F980, 0xC991F497,
+   0x9CCC1A6B, 0x21EC6F5D, 0x6F733D12, 0xDA9F5BDB,
+   0x59CE56B9, 0x40E88D50, 0xE03A9A1F, 0xC0190A2A,
+   0xA5E60328, 0x9FF9D482, 0x382BDBE6, 0xBB792DE6,
+   0x26895085, 0x00000013,
+   0x22B7448B, 0x521CB4E3, 0x4C726BEA, 0xB51BCA88,
+   0x39C312EE, 0x9391BDEA, 0x2C8B9A0A, 0xF9128EF7,
+   0xA8E51D04, 0x988F9F78, 0x96C8257E, 0xDD44418F,
+   0x2D7F2F00, 0x3688FB24, 0x1B1FDD4C, 0x2F92E5FF,
+   0x000000E3, 0xE98C49F5, 0xBA865459, 0x9DFE9DD3,
+   0x3545CF75, 0xCE823A85, 0xEB3EF7FF, 0x9B39A2A8,
+   0x39BC813A, 0x92A11C12, 0xB7534635, 0x1EE6D123,
+   0xB16A5BD6, 0x82FEF180, 0x3192E6DD, 0x287687C4,
+   0xEBFB81B4, 0x0000008F,
+   0xDCEDC377, 0x7D858CBF, 0xE1A5B46C, 0xC3F3875C,
+   0x79AD10F4, 0x49C4664B, 0x15564507, 0xCDB2138C,
+   0x9947BA35, 0x2EE0543B, 0xAD4638AA, 0x785A7271,
+   0x7C03E2CF, 0x7CCBAA92, 0x558CEB2D, 0xFDC5E912,
+   0x000000D4, 0x5BE2E05C, 0x982BBE21, 0x9EFC0A64,
+   0xCAD3F06C, 0x6D27C70C, 0x076D93BE, 0x90A905C6,
+   0x31267A26, 0xCC9842A5, 0x967AED2D, 0xCA64408D,
+   0x838121E8, 0xD073CD0D, 0x85CDED05, 0x2C36FF15,
+   0xE29384CB, 0x000001E5,
+   0x734512EF, 0xD1D23EFC, 0xBAFA887A, 0x8885C332,
+   0xB3E7242D, 0x98438804, 0x2CF966ED, 0x0AC89EEB,
+   0x2179440E, 0x0EB25C77, 0xC1DEC26A, 0xDD06CAD7,
+   0x2FE5EE8A, 0x7081375F, 0x16A968C8, 0x80EDEA99,
+   0x0000011F, 0xA8A00726, 0x8DB61568, 0xB22568ED,
+   0x493B2898, 0xACB41A35, 0xAFCE0D3A, 0xDDF0B39B,
+   0x148056FD, 0x16451772, 0x66507B68, 0xBE584D0E,
+   0x89020BB9, 0xB485A6FA, 0xA35E06C0, 0x1B1701CB,
+   0x877E1787, 0x00000168,
+   0xD28BB908, 0xD6A82AD3, 0x79C31C9A, 0xBD3F3856,
+   0x6062D159, 0x8ACFB60C, 0x2C3C1CBF, 0x224606C7,
+   0xC5209A99, 0xE60D8902, 0x0B2855E1, 0xB96E98A4,
+   0x2B75B008, 0x1EE04715, 0xBFDC1020, 0x71BB8ED5,
+   0x00000166, 0x10EFF42B, 0x1B30DD96, 0x44899CD3,
+   0xB3FE6F68, 0xBB3874AE, 0xBCAD31FF, 0x24660CEA,
+   0x836F7639, 0xAD4EFD57, 0xB92FE7F4, 0x23483D71,
+   0x627FA8AA, 0x17E4A8E2, 0x8FA4D9D6, 0xBE6C543C,
+   0xDE728D20, 0x0000016D,
+   0xA8815D90, 0xF498F852, 0xA5922350, 0x88A6ADDC,
+   0x05C4BBDF, 0x5CBA9139, 0x2E8DF210, 0x9CD0FE21,
+   0xF2359B53, 0xB36233D5, 0x54092738, 0xD3B1510B,
+   0x3BD78B3B, 0xCA2166DD, 0x6D9E7C90, 0x80E13B62,
+   0x00000094, 0x20404151, 0x0BA73A63, 0x506F5133,
+   0xDA5218CF, 0x52FB10F5, 0xB1F1193E, 0x2E32BD18,
+   0xAE735DE4, 0xBCDAE71A, 0xBDC19089, 0x97C87ABC,
+   0x4CB7980E, 0xD696C4F9, 0x018FECB4, 0x52361369,
+   0x04B4D8FC, 0x000001BF,
+   0x43D18546, 0x6E5CE6BD, 0xCB768466, 0x17781107,
+   0xCCD958AF, 0x35087E8A, 0xF1CEEEE7, 0x10BCEA85,
+   0x3E4AB51A, 0x149B815D, 0x7DF477C5, 0x9DDF701C,
+   0x37BDEFF9, 0x85A3184F, 0x9D5FC2C8, 0xE158FBFE,
+   0x000001A2, 0x545F88EA, 0xF2670D58, 0xB26A23E7,
+   0xB805679D, 0x243BFBB7, 0x3BA6FFCC, 0xC069053C,
+   0x39EE5876, 0xC5CFFDA9, 0xC39437C0, 0x6E0DF697,
+   0xB5748FFF, 0x7D570B3B, 0xD14FDBAB, 0xE07D547C,
+   0x9550ADFE, 0x00000185,
+   0xE223B20B, 0xF81678D0, 0x8707BCBF, 0xCC2DD469,
+   0x55C70E55, 0x2DF9EADC, 0xC85F129B, 0x33357401,
+   0xC6829ADF, 0x2A4B7C21, 0xA7CDA777, 0xAC6C2861,
+   0x58BEC9C0, 0xBF106462, 0x02DA2CB9, 0x3D51FDC9,
+   0x00000190, 0x7B69C39E, 0x589CC19B, 0x63A4FC83,
+   0x8F673823, 0xF96574FF, 0xFCC6749D, 0x7B356A59,
+   0x0A8BB69F, 0x6E5656C4, 0x0155C02C, 0xE5A48C80,
+   0x42BE43A5, 0xDB149179, 0x51C7FABD, 0xF28C73C9,
+   0xAD41B7CE, 0x00000121,
+   //Window 72
+   0x6E640A8D, 0xBF2FFCB7, 0xA0B5A07E, 0x63479501,
+   0x5F36F2E7, 0x55BB3001, 0x058A676A, 0x9890F999,
+   0x455C0D27, 0xD9EE341B, 0x18E08FC8, 0x6C95780C,
+   0x442A075D, 0xEB63A675, 0xFB69DA00, 0xCE46A1A5,
+   0x0000006B, 0xF3ED6253, 0x8C618934, 0x6E9433B4,
+   0xE0034244, 0x4260B2C5, 0x989B9921, 0xD9DF4747,
+   0x11699804, 0x763A7F63, 0x125FE61F, 0xC6EC395A,
+   0xA972786D, 0xB7B7B8C6, 0x662F9FE7, 0x5456556E,
+   0xFB644A61, 0x0000008A,
+   0xA3A5A2A2, 0x0AA08334, 0xDCFC5939, 0x7B1E2F91,
+   0x673E221A, 0xE1C64158, 0xCB3319D0, 0xA9CE2061,
+   0x977A9B41, 0xB359C34B, 0xB7F9FC83, 0xC127AF82,
+   0x81166C12, 0x18ADA734, 0x092D64D4, 0x1C4C48FB,
+   0x000000EE, 0x4C5015C4, 0xFED1A8DA, 0x526E1897,
+   0xEFD54478, 0x75BBDC91, 0x0AC4F640, 0x910661EC,
+   0xC0774CCE, 0xC30CCC07, 0x699BB035, 0x80952CCF,
+   0x836B7B17, 0x9788BDC1, 0x03B8BFEF, 0xFD47A69D,
+   0xB24604C5, 0x000000D6,
+   0x720AEBB3, 0xC17C5414, 0x7089E6BF, 0xEAA1A7B9,
+   0x36DE9F22, 0x9EE50BA1, 0x5B3BF8DD, 0x4BEB0068,
+   0x5B3F6992, 0x330E8C04, 0x6E7A978C, 0xF477636D,
+   0x9543861A, 0x5799678A, 0x810077E6, 0xCEB7D074,
+   0x00000019, 0xCAFEF71C, 0x0D20DB6D, 0x35FA4E9F,
+   0xB1C02CBA, 0x4630EE0E, 0xEB662868, 0x88265202,
+   0xDA4BBE8C, 0xE1AA127C, 0x71B53DC3, 0x0ABCAA62,
+   0xF4E2E52F, 0xF8F6C926, 0xE4C4CC96, 0x14AAF997,
+   0xF9CF5BA4, 0x000001E0,
+   0xC936A7E5, 0x6AF0B935, 0xD4A248AB, 0xDE94D724,
+   0x594E53B7, 0x0491C733, 0x1CCD7088, 0x238EF534,
+   0x4F5052C3, 0xAF0E791E, 0x10C3411D, 0x70CBEA81,
+   0x577D38BC, 0x6B7C8574, 0x4EA6A924, 0x00E147AE,
+   0x00000085, 0x497B793D, 0xCAB57E2A, 0xEDF47059,
+   0x3F642966, 0x2EB66B98, 0xA276326D, 0xA76E1221,
+   0xEBA64255, 0xD23677B9, 0x698FD276, 0x45A0625D,
+   0xCBB46374, 0x50B672EB, 0x5D92DDDC, 0x0839333C,
+   0xBEF8CCD0, 0x00000091,
+   0x065C3B1C, 0xFCE66781, 0xB5195F93, 0x2F28B538,
+   0xD5F99BA0, 0x9294FA3E, 0x66C624BD, 0x32EF709C,
+   0x4F610D8C, 0x4C555DF3, 0x438E3D99, 0x90EE123F,
+   0x919841E9, 0x92D19B98, 0xEAE83102, 0x2E228D8A,
+   0x000001E9, 0x009CF7C8, 0xB4566D09, 0x38105C3A,
+   0x60B0CA83, 0xA8DA65BE, 0x9A4FA08A, 0xB5FDE8EE,
+   0x3208AD03, 0x737B4EC8, 0x8462DAA4, 0xA5C1B058,
+   0xBC182470, 0x7F0B478A, 0xB1BF27CE, 0x67045B89,
+   0xDEDE341E, 0x00000156,
+   0xA968ACCD, 0x5F16528B, 0x261063CF, 0xDCFD5DC1,
+   0xAD45C838, 0x99C6A790, 0x811FF9D4, 0x4B83B5DC,
+   0x3C3DEAB8, 0xC3C067F2, 0x3496C2CD, 0x447ECCA8,
+   0xAD2663C3, 0x212E9948, 0x354FDC23, 0x080D13F5,
+   0x00000074, 0xF202BAE2, 0x4E4A2FFA, 0x0B704EA5,
+   0x12EE692F, 0x66A3E286, 0xDF48FE7D, 0x95BDF85F,
+   0x13228B50, 0x422DBE99, 0x65AB3FF9, 0xB376E1EE,
+   0xFD795432, 0x0DE9E917, 0x7DCA34AC, 0x8614521D,
+   0xF907AD9A, 0x00000159,
+   0xA3B3F8C3, 0xABF61A9E, 0xB62FC9DA, 0x90237370,
+   0x2C5128DB, 0xC1D3DE23, 0x65AE3521, 0xF67097FB,
+   0x78D68D97, 0x0016DEBD, 0xEEB9DF30, 0x23EA15DD,
+   0x431259F6, 0x4A09E240, 0x06FFDC4B, 0xEB811731,
+   0x0000001C, 0xA20611B6, 0x3C709776, 0x45D62433,
+   0xD6959486, 0xC8344819, 0x86C9232C, 0xA260C3B3,
+   0x636675F6, 0x2B6ADB42, 0xB927E00A, 0xF1C8C3F9,
+   0x9644F9E9, 0xE01260EE, 0xA0842190, 0xE2A15FA9,
+   0x6EA161F8, 0x00000127,
+   0x875E2133, 0xCCFC7051, 0x821F76A0, 0xFC3C0B55,
+   0xCD8EF672, 0x544E229F, 0x47494F15, 0x36664793,
+   0x109B2CE0, 0x22C05E5F, 0x492BCBB1, 0xC294314C,
+   0x16558D91, 0x15BEECDE, 0x61AE3008, 0x45183167,
+   0x000000A6, 0x26C28852, 0x80BC2B2C, 0x510B0086,
+   0x941F0224, 0xABFFEB4C, 0x0FCB9DE4, 0x66F723B4,
+   0x0B1E80A9, 0xE5CD0627, 0x186FCC2B, 0xCA71DCF8,
+   0x8B1DF932, 0xEB01452C, 0x789CB0A1, 0x81FFE1EA,
+   0xB2E81E36, 0x0000009D,
+   //Window 73
+   0x05487074, 0x5EC6427B, 0x80C426AD, 0x0B59FA1F,
+   0xC9946594, 0x0207D510, 0xD38F83D0, 0xBA1FE985,
+   0xC96EB133, 0x113AEC98, 0x82515193, 0x3424AD01,
+   0xFB6F9B10, 0x3EB15AEF, 0xF15D8BE1, 0xCCB719E8,
+   0x0000013C, 0x4C67518D, 0x63F89883, 0xF85EB1D9,
+   0xB5CA3508, 0xAF652B25, 0x1EA1C74F, 0xBDDEDC4D,
+   0x4FBC5476, 0xF4B33C74, 0x22DAA81A, 0x3F36AE29,
+   0x9F7941A0, 0xBCA5CA40, 0x90C2B8CE, 0xB587B3D6,
+   0x53E736A1, 0x000001B3,
+   0x9088C2CE, 0x6DF7CCCE, 0xB88F81B6, 0x6A8048BE,
+   0xE5F7673F, 0xA4B4F0E3, 0xBEC7C688, 0x26EB7B7D,
+   0x10BF71CE, 0xAA17B13E, 0xB36DCC8F, 0x5D486038,
+   0x0063F45E, 0x0256CCAF, 0x069B36B0, 0x88D8FDA4,
+   0x0000008D, 0xC42A3A8E, 0x2DD059FB, 0xB211932C,
+   0xD8765FC9, 0x4092EFA9, 0xBF35A409, 0xD247EA27,
+   0xCCC83C7D, 0xB76BB256, 0x9B3BE42E, 0x6B87921F,
+   0x8AE4A99B, 0xBD1013F5, 0x3034C4FF, 0xA3730B8D,
+   0x57F523B2, 0x000000C0,
+   0x4AC5EF8F, 0xC470F96F, 0xF41A1D41, 0xB06F3C09,
+   0x180BC759, 0x3D019BDC, 0x69ACDA2B, 0x53FFAC70,
+   0xCEEF6C20, 0xB2A01E7D, 0xB7C261AC, 0x144C2F6E,
+   0x6EADBCED, 0x012B098C, 0xB634A837, 0x85F2EA71,
+   0x00000144, 0x6A8FA909, 0x6D50B0AF, 0x944AE8C0,
+   0x052B772A, 0xD783103C, 0x6306369B, 0xE321A7A4,
+   0x4E11FAA2, 0x3024EE00, 0x1963D2AE, 0x4BBF4D91,
+   0xEA8CF87C, 0xF678AF53, 0x293B0207, 0x5CA3A809,
+   0x5299C812, 0x000000BD,
+   0x0D593359, 0x961AEDE7, 0x46BE7455, 0x0EDBE79C,
+   0x0C410034, 0x63E8ABDF, 0x4F878C40, 0xDC91162C,
+   0xE7935F7A, 0xB31D78B7, 0x2584A9D4, 0xE46FB88A,
+   0x5770F79D, 0x596B4BDB, 0x9BB969B9, 0xAE0A5FE8,
+   0x0000003D, 0xEE19802B, 0xE8E840F9, 0x4CD021FA,
+   0x33A36BD3, 0xBAD376F9, 0x13472C59, 0x304A8A88,
+   0x9C3A76A8, 0x594B5FC2, 0x1D17D867, 0xBC95244D,
+   0x1460F538, 0x7E5D2A0C, 0x3866C6EB, 0x79F27451,
+   0xDC63BC62, 0x00000039,
+   0x8AB9A39E, 0xC68C0272, 0x2C1DFA97, 0x59979CD3,
+   0x8D593633, 0x84BEC512, 0x3AC7211E, 0x117EC8B4,
+   0xF89ED1BF, 0x9AF16A1A, 0x7142D497, 0x2609C664,
+   0x63354621, 0xCB8E0385, 0x40A341BC, 0x887FE865,
+   0x000000D3, 0xF349587E, 0x3F3F3789, 0x1131BFA5,
+   0xD4B003F7, 0x192C9328, 0x2F744B76, 0xA1B280CA,
+   0xB6578EBC, 0x5C585185, 0xB835095D, 0x9EE3D8CE,
+   0x2FEC8084, 0x291A9486, 0x5BFD0DA0, 0x37EEAD8E,
+   0x38E71F48, 0x000001F3,
+   0xA80D888F, 0xE281E3F3, 0x5B20E3B3, 0x600CA15D,
+   0x8EAAB831, 0xA784FF0C, 0x06E27ECE, 0x2681B7F5,
+   0x879C58EF, 0x72C5139E, 0x8D25FD5E, 0x48B4340F,
+   0x9147666F, 0x0F6DB630, 0xBA32490B, 0xBD2A0FDF,
+   0x0000011C, 0x4C4E1A3C, 0xC8A7331B, 0x3C6399D0,
+   0xD03AFA76, 0x5482836A, 0x5398D712, 0xEE9C9CE2,
+   0xF83E8FEB, 0xA822D57C, 0x26902CAB, 0x82F651D1,
+   0x7EDE71AC, 0x1BF0E9CD, 0xBB49EC32, 0x0529FAF1,
+   0xC3685D4B, 0x0000014A,
+   0x4CF43305, 0xD4008109, 0xEE84D3CE, 0x394AB620,
+   0x7FB9C73B, 0xE529AA0C, 0xB605EB7C, 0xF790C1C7,
+   0xA9309198, 0x9B534B11, 0x68319410, 0xBA70EFB5,
+   0x0C1AA638, 0xD7F71B81, 0x76365A16, 0x1B45A27F,
+   0x000000D5, 0x88129B90, 0x7D3CC8F0, 0x8EBE551B,
+   0xCDA952C3, 0x31479B5B, 0xE2776192, 0x5BF8C65A,
+   0x94FCCC89, 0x440FC5CF, 0x599148B8, 0x33CD0D4E,
+   0x355EE507, 0x70D42A58, 0x8467BC4E, 0xF2B6D23A,
+   0x67CEA449, 0x000000A5,
+   0x3711F6EC, 0x0842E135, 0x35110D60, 0x3CE5FA45,
+   0x5475710C, 0x8312A278, 0xC01A451B, 0x1CEFBA22,
+   0x79553563, 0xECD7B598, 0x8E238E67, 0x35DDBB36,
+   0x6BF4CAF2, 0x5694AB17, 0x6EF380FC, 0xB2547332,
+   0x0000002D, 0x246BEBB2, 0xED1861C5, 0xA5C75331,
+   0x4210FC3A, 0x93D0EC38, 0x02CDD68B, 0xD3F13B0C,
+   0x05F64D14, 0x52CA18A3, 0xB6DE6F57, 0xA55B1D77,
+   0x9848DCF4, 0x49688962, 0x9A417CC3, 0x0DC11D09,
+   0xF55A4291, 0x0000006D,
+   //Window 74
+   0x448996E2, 0xE0828A5B, 0x516E440D, 0xDD3F4D9B,
+   0xAB10E109, 0x223B4F87, 0x4CE7241C, 0x766BDE38,
+   0xDCAF88A7, 0x0B1CC320, 0xD75440D5, 0xB0470E7D,
+   0xBA76B7E8, 0xE3894E41, 0xA762BB9E, 0xA0341305,
+   0x0000013F, 0x0EADF722, 0x4F5581D3, 0x50D8999B,
+   0x6E4E31E0, 0x02F03368, 0xC14BB148, 0x26A263B5,
+   0x41F19643, 0x3B5F480E, 0xC0642E4C, 0x63191881,
+   0x0A3280DF, 0x78FA9069, 0x4EE1959A, 0x557A8DC0,
+   0x7376078A, 0x00000181,
+   0x386C4E0C, 0xCB52BFA5, 0x173C0506, 0x9AD631CE,
+   0x1F481A10, 0x7779FD8D, 0xADBF3B01, 0x0CE5155C,
+   0x4A66E714, 0x946C3D6C, 0xFC39257A, 0x82363B8E,
+   0x9F7DDFA7, 0x5BFF5F52, 0xC959F74A, 0xF6019194,
+   0x00000195, 0xD1A7E5E3, 0x97E049CC, 0xBA5ABA47,
+   0x20B70812, 0xEED6D2FE, 0xAA1AE913, 0x668BB4B6,
+   0x3A742BCE, 0x64D51F79, 0x4527C1A5, 0x9295BFAD,
+   0x70E8A3C8, 0x1CC82FC0, 0xA3066303, 0xFD3F6160,
+   0x2C7C0291, 0x0000006B,
+   0xB1351AAB, 0xB9B6EBF9, 0x49A08F81, 0x3199F6E3,
+   0x5DF347A9, 0x3CFDB717, 0xB15D1ECD, 0xAD627841,
+   0xD4918F31, 0x994AC9A2, 0xA482E07E, 0x3F3B84A1,
+   0xD01DF2A1, 0x82F47118, 0x0612E165, 0x1CE7C253,
+   0x00000117, 0xB1A67846, 0xA4D357D1, 0xA5F6313B,
+   0x0ED36337, 0x6224B03D, 0xF759ACC5, 0x43833ACA,
+   0x9F79550A, 0x5B80BAB0, 0x71238A8D, 0xF5A7E9D2,
+   0x2F5D78D1, 0xAF79CF0C, 0x34844C10, 0x878E03C7,
+   0x202250A1, 0x000001DE,
+   0xF50A3D85, 0xF7ED6FFD, 0x25ECD014, 0x920B8075,
+   0x4EBBD57E, 0x9074D5D1, 0x8CE72DFE, 0x2C7656F0,
+   0x336DF7B8, 0xD17C1313, 0x4A6A7112, 0x34259389,
+   0x71D23283, 0xF9112C81, 0xB19617B0, 0x80EE8F87,
+   0x000000DA, 0xE36790D1, 0xD411F8B2, 0xC03B68A7,
+   0xE0352D7A, 0x55DD2C1F, 0xE2B16D4E, 0x3B874068,
+   0x3282A3DE, 0x1B3D4991, 0x26FBC96E, 0x20D08473,
+   0x42F10B45, 0xC84ED8E7, 0xF17DCE35, 0x91F15069,
+   0x78DA06E7, 0x000001DA,
+   0x12391B95, 0x7BFEB9AF, 0x3D2855D9, 0xD79181D8,
+   0x84BC3F73, 0xEB0CB5BA, 0xD4577568, 0xC7AAEE27,
+   0x6D62AAF2, 0xBEBB1D97, 0x1C0D2C76, 0xDF7F8771,
+   0x1390EFE5, 0x8E735DC0, 0x10B0342D, 0x324A3FEF,
+   0x000000DD, 0xE5EF45E7, 0x0F074D4B, 0xE6C99CFB,
+   0x2AF56ABE, 0x666B03E4, 0x55F70E37, 0xFED0A21E,
+   0xB1F0116A, 0x5603998D, 0xF9FE9C99, 0xA43BFA71,
+   0x70507E45, 0xCE0E4A10, 0x68D2F7D4, 0x96D5A95F,
+   0x819FD537, 0x0000006F,
+   0x14C98670, 0x23095FDF, 0x9DC0F253, 0xA48C421E,
+   0x0E23FFA6, 0xBE07424B, 0x6E8DC32E, 0x2D6B8AC8,
+   0xAD8E1120, 0xE3D6E195, 0xFFC71DAA, 0x2F1EE8E1,
+   0x648BD635, 0x603908BE, 0xE912C300, 0xFF134805,
+   0x000000DD, 0xD4322E89, 0x0FFCC425, 0x8F09F42A,
+   0xC809F5ED, 0xEF2508A2, 0xC1114010, 0xC51CB0C1,
+   0x5C07DC01, 0x1D946EB4, 0xF3D650A1, 0x51E6B2B3,
+   0xD907AD9A, 0xC945F2D0, 0xD588D588, 0xD1FAAB39,
+   0x7DAB07BF, 0x000001E1,
+   0xF5823BCA, 0xD185CFC3, 0x2D648A40, 0x94E83338,
+   0x4D22D2DE, 0x719DEF2C, 0x266E78A8, 0xE23BE64F,
+   0x752AC9CD, 0x8830CB3E, 0xD0F2CC62, 0x2598BC00,
+   0x62336ADA, 0x42513E2C, 0xB35E9E9D, 0x7343DA72,
+   0x000001A8, 0x19B56641, 0xA38D5D22, 0x94A2E805,
+   0xD7E2949E, 0xA850F355, 0x03F06FA6, 0xDEA5393A,
+   0x744779E0, 0x9CF8FF02, 0xF6078B4C, 0xD43248FA,
+   0x3A150184, 0x8CCE580A, 0xF2B064F8, 0x66EAF1AA,
+   0x3894F514, 0x00000049,
+   0xEA2D6F47, 0x8CDF5496, 0x1384A82D, 0xD16475CE,
+   0x79DCE016, 0x443C6BBE, 0x11C229E7, 0x520583EA,
+   0x32D1EE47, 0xC345965D, 0x4EFF5930, 0x046C5C21,
+   0x19D48E5C, 0x9810075E, 0x9CC794DD, 0x3E142590,
+   0x00000186, 0x79CF471E, 0x254D0036, 0x0D5A2F06,
+   0x87A8C5ED, 0x5516FBDF, 0xBC16FD94, 0x6FA2A909,
+   0x2E7C1BF2, 0x237BA960, 0x28297856, 0x091507FC,
+   0xCFB6B336, 0x83A9939D, 0x0CAB1EB2, 0xAEC9CB63,
+   0xE49BC8D8, 0x000000B0,
+   //Window 75
+   0x817221D9, 0xCDB8A92C, 0x780ED8A2, 0x7FF2643E,
+   0x56FC9CAA, 0x5EFCCEDA, 0xF823D2FC, 0x59B5AA12,
+   0x9DBFEB54, 0xFE97818B, 0xA13DDE72, 0x2BECCEAF,
+   0xE8692B1B, 0x5D5B53CE, 0xCAE9DDC6, 0xF5E5AC69,
+   0x0000000F, 0xC692D9CC, 0x6EE75741, 0x62A91D4D,
+   0xD97EB6F2, 0xE2924E75, 0x8858BA5D, 0x517030B1,
+   0xB8E1B22A, 0x2AF83DFB, 0x651A6838, 0x1C21BE14,
+   0xC1FB14D2, 0xC9EBA60E, 0x87689D46, 0x0DA1A29D,
+   0xE16CFC1A, 0x00000107,
+   0xB0A899D2, 0xC9A5E2D7, 0xEC01AD8C, 0x225E0A7C,
+   0x1B354803, 0x184D1C3D, 0xB9B5BA7C, 0x28026887,
+   0x26DC425E, 0x59EB397F, 0x55D8724A, 0x719DE971,
+   0xACA58401, 0x9823C8FD, 0x38A1558C, 0x5793D2C7,
+   0x00000010, 0x2ED1274F, 0xD14908B2, 0x8B51E15F,
+   0x087A1B8F, 0x7D3336DE, 0x879FADC6, 0x92D80167,
+   0x9F78BC54, 0xD21BCB96, 0xF5EBDDC4, 0x5B68A23B,
+   0x7D24EE7A, 0xFD9BA4E8, 0xCD432917, 0xF829E95B,
+   0x38B9E8B7, 0x00000102,
+   0xFF25C5D0, 0x489E62BF, 0x9EB33D69, 0x347D0F51,
+   0x45C99F94, 0xBE69C42F, 0xE51E7E40, 0xD626C5C9,
+   0x4F840BD3, 0x9CC39095, 0xECA2B6D5, 0xAA0B0DF4,
+   0x075946FC, 0xD0E1F1D9, 0x5706086B, 0x66CDDF30,
+   0x00000162, 0x064FA85C, 0x9B2CAA63, 0x20720800,
+   0xA3A5E2BB, 0x5295B6F9, 0x2485913A, 0xB769D794,
+   0xE5428476, 0x031D0495, 0xC6CDE727, 0x6088822B,
+   0x4A7BCF34, 0x307659AD, 0x649B0492, 0x79E8F7FA,
+   0x80FB444F, 0x00000008,
+   0x2F39703C, 0x202AD82E, 0x281B6010, 0x9A3F515E,
+   0xE376BCC7, 0x2A67B042, 0x98EF60E5, 0xCED04EA8,
+   0x875EADEC, 0x3DFC3602, 0xEB3BE4B3, 0x99FFA8B4,
+   0x2C56B275, 0x2643CAAB, 0xB6EF478C, 0x3DBCD4F2,
+   0x000000B0, 0x9A85AACD, 0x9FAE7376, 0xDE6EC1C1,
+   0x41DE8DCD, 0x09F66E0C, 0x7C1F3CD0, 0xD39B844A,
+   0xB918C9E9, 0xDECCB196, 0x1A11B5D8, 0x2A606F50,
+   0x2B37CA08, 0x42B68F99, 0x5550CA7A, 0x371C9CF5,
+   0x29AA94D6, 0x00000196,
+   0x9B6375D7, 0xBFE87EE4, 0x1E8564A8, 0x5F00F30A,
+   0x3FB999F9, 0x318412B8, 0x809B4FBC, 0x12FBCEAE,
+   0xF085F106, 0x0C02BA4C, 0x35127B0E, 0x5811BB57,
+   0x618F41CC, 0xD7E6B1C5, 0xF66E84E6, 0xB493C269,
+   0x00000029, 0xF3BA9AA6, 0x5318648E, 0x2A487C21,
+   0xF7848B81, 0xB05BF01C, 0x58D3BC79, 0xDF942CBF,
+   0xE15E32B3, 0x5C3BBB45, 0x92244CD2, 0x43F3A481,
+   0x05C09936, 0x395F854D, 0x381CF34A, 0x61989306,
+   0xDD989530, 0x0000017D,
+   0xE86173CB, 0x56213EBE, 0xED2D7173, 0x440BFFDB,
+   0x2C77B64A, 0x48E92CCA, 0x1D940567, 0xBE08B1FB,
+   0xD61D8922, 0x12DD16DA, 0xBBF13F60, 0x993CBDBB,
+   0x38CD390E, 0xD9F8D757, 0xAAB7342A, 0xAAB1F507,
+   0x00000035, 0x07007518, 0x2CCA1F82, 0x7F62C203,
+   0x2F9E1ACA, 0x23819FCB, 0x20583B44, 0xD7919ACD,
+   0x886DB824, 0x591BE9FE, 0x1DF13CA0, 0xB3826F9E,
+   0x5784CC61, 0x3D66935B, 0xB54060A1, 0x4D515D97,
+   0x4BA60348, 0x0000019D,
+   0xF1A4F8BC, 0xC54B9F04, 0x63116228, 0x87CE476D,
+   0xBFC97DA3, 0x956256F5, 0xE8CADD3E, 0xF3C7329E,
+   0xF3FADF0D, 0xF557C82B, 0xDE2ED8C8, 0x0BBEAC6A,
+   0xFE73D1B8, 0x192D0206, 0x834956DF, 0xAA7B9F81,
+   0x00000127, 0x36C5BBFA, 0x0FBD989F, 0xA2CCB934,
+   0x9A8A380F, 0x5E065762, 0xEBC3CF6D, 0xE089985A,
+   0x5BF1D8F8, 0x914D3F58, 0x0DC41B95, 0x8E0B0412,
+   0x2CE8CC41, 0x48E0A548, 0xC5718239, 0xD8C05CDF,
+   0x9595FEAE, 0x00000161,
+   0x50AEBE81, 0xC0D55E4F, 0x35FD0846, 0xED7B05D6,
+   0xDD7588DB, 0xF9B004A8, 0x34D41DAE, 0x871531A3,
+   0x379F2535, 0x380A08E0, 0x48F7835C, 0x75B4F5AC,
+   0x80DC1121, 0x789356F4, 0x47A35998, 0x4AD112EB,
+   0x0000004A, 0xE6A57EBB, 0xCE9A32BE, 0xC63A9C56,
+   0x47CD1A1D, 0x22D8AC6B, 0x2A74BB25, 0x774648BC,
+   0xAABC0C37, 0xA6D23947, 0xEDCAA64F, 0x2A7530E9,
+   0x14E8E752, 0xE6F6D059, 0xB59758DC, 0x7DAA28A8,
+   0xF9106A16, 0x0000013D,
+   //Window 76
+   0xEEC6E312, 0x163A9E62, 0x459162D8, 0xD11432C1,
+   0xA25D4934, 0xDDE7D941, 0x8D868AAD, 0x9067028E,
+   0x5B6E3D21, 0xB71B1708, 0xE95D3C7F, 0xAED73637,
+   0x1DCE0D78, 0x51BCC93C, 0x504A9D0B, 0x2F45D06A,
+   0x000000BE, 0x300B2478, 0xEC12EA4B, 0xF2A48388,
+   0x91AC6EED, 0x7A7631AD, 0xFBDC1BBA, 0x79D5F4CE,
+   0x5B2669CB, 0x48C8F025, 0x219D64F9, 0xAADB5873,
+   0xADCAAB29, 0x671BD673, 0x3B07AF1C, 0xB7F2D8F5,
+   0xE66E7C67, 0x000000C9,
+   0x92701A9A, 0xD142BFA9, 0x47539E92, 0x0B59D014,
+   0x8724475B, 0x7CEFEC6E, 0xBCFD641F, 0x5C77D10D,
+   0xDD42EB47, 0x4946DBAB, 0x14F1C33B, 0x4AE66C3A,
+   0x4C9F2C71, 0x05BA3E75, 0x1FC0F7B7, 0xB618A507,
+   0x00000065, 0x7C169A16, 0xDD94EE05, 0x5A337E5E,
+   0xA29E2619, 0x9AD816B6, 0x30E106EB, 0x1A17810A,
+   0xB91E66F7, 0x5B672E86, 0x46ABF80D, 0xF89626FF,
+   0x0F40F077, 0x8B67B224, 0xA474DFBE, 0x8053AA79,
+   0x9D3AF924, 0x000001FF,
+   0x7938D98E, 0x97DEFE3D, 0xFD0BEC69, 0xE2458FEA,
+   0x8B42DDBB, 0x7DF8D2B5, 0xFF39914C, 0xA82AAB40,
+   0xD30F07E6, 0x78549B01, 0x1331557E, 0x253F8C46,
+   0x19648CCE, 0x771750D9, 0xD045BC36, 0x96AD6776,
+   0x000000F2, 0xE08B83F8, 0x4A2EE334, 0x2E3086DE,
+   0x3E9C4CB7, 0x9936BAB0, 0x913EAE4B, 0xD23CD36A,
+   0x3CF83551, 0xDFD27D4A, 0x7C51D84A, 0x4D006EDD,
+   0x2595A90F, 0x61CC7BE7, 0xB2D5C684, 0xA4B310F9,
+   0xBB02BD59, 0x0000018A,
+   0x3110EF21, 0x47212CD8, 0x7DAB31DA, 0x351356CA,
+   0x777A302F, 0x5C31ADD7, 0xDC66A1C6, 0x44844EB4,
+   0x28384807, 0x559F3FB4, 0xFF78DEE6, 0x95DAB974,
+   0xFB20857B, 0x2FE12E92, 0xEF499BBA, 0x41436000,
+   0x00000106, 0x9DF7B969, 0x5E0E5F36, 0xDC819D59,
+   0x2C96F308, 0x11CF4119, 0x3258DB74, 0x76676D2F,
+   0x6246DA54, 0xCA079F54, 0x5BE278CF, 0x6E36452F,
+   0x61AB6EB0, 0x461FC9A3, 0xE7742741, 0x6A926FE5,
+   0x252FB638, 0x00000171,
+   0x369BFE8B, 0x3E7F4206, 0xAF7CDBC3, 0xF7C42274,
+   0xC0EDB213, 0x8FA8ED40, 0xE06D72A8, 0x5852ECD3,
+   0xD29F7845, 0xE52F1845, 0x0AFE7FC2, 0xB372FFC8,
+   0x8EA3CC17, 0xF229E1D9, 0x55BBC4FD, 0x13A0E691,
+   0x00000164, 0x090F7E0B, 0x6815798F, 0x1BD0D868,
+   0x1C201141, 0x50DFF2F7, 0x5259AEEF, 0x7A2313DF,
+   0x25FB13C9, 0xC9E244B2, 0x06669F01, 0xBA79CF7D,
+   0x7B68A1C0, 0xB5DB0C4D, 0x9C4A4CB0, 0x82A53630,
+   0x48BA2649, 0x0000018A,
+   0x0717E973, 0x0C0B5A85, 0x54775273, 0x9365F99D,
+   0x93AB23AC, 0x7D9186D9, 0x2647CE6A, 0x7DE82D80,
+   0x6EFF4116, 0x7A93B7E8, 0xB906E7B4, 0xC319564A,
+   0xC89A5CC8, 0x34DB307B, 0x43E6EEAF, 0xDE5986C1,
+   0x00000143, 0x101E9D25, 0x0629EC0A, 0x298346DA,
+   0x0EAB815D, 0x757AA114, 0x14B1F00F, 0x244EFB91,
+   0xD231D637, 0x6C54EA71, 0xD2F4B36C, 0xECBAD76F,
+   0x9A10897B, 0xB3A99370, 0xA24A8C3F, 0xF92BC101,
+   0x718A5671, 0x000000FC,
+   0x65DC789D, 0x42341DE6, 0x0D2AFE09, 0x7949F29C,
+   0x07105206, 0x3B788B07, 0x85B015D2, 0x241A0371,
+   0xB3BFAEEB, 0x6F1BAF76, 0xDB1C2C34, 0xC75913F5,
+   0xC9846129, 0x0C3B58BC, 0x04AAB509, 0x3F45E4DA,
+   0x000000E9, 0xA98D5406, 0xC93FE1FF, 0xF019AB2C,
+   0x5964E109, 0x92D60D46, 0x5BAA3190, 0x21301CEC,
+   0x616513DA, 0xF3A41A0A, 0x09C67E93, 0x4D11DF32,
+   0xCBB75E26, 0x8A3D3846, 0x47A59583, 0x5E307C49,
+   0x7413EC0A, 0x000000E9,
+   0x18F65BAB, 0xDAC5583B, 0xB50FE6E5, 0xB9166FE7,
+   0x30328982, 0x5FD84EC1, 0xD8CB9EB7, 0x473C09BA,
+   0xCE1A2949, 0xC2941CF8, 0x0560D2B1, 0x9605D42C,
+   0x4DEE24E1, 0xDAFAB101, 0x403E8242, 0x0F7EC492,
+   0x00000054, 0xC3DAE982, 0x89A718B2, 0x63E88A93,
+   0x0E40BE8A, 0xD8755A95, 0x59013DDE, 0x726FB0C6,
+   0x148827E5, 0x9973B383, 0xA54E3F5A, 0xBEB80663,
+   0x4029C48D, 0xD7037616, 0xCD3301CD, 0xC5D387F2,
+   0xF7B88FA7, 0x00000016,
+   //Window 77
+   0x67DB4570, 0x358EB536, 0x685FA5BA, 0xAED3F999,
+   0xCB571FCA, 0x4593C950, 0x0411DC5D, 0xDFF7278C,
+   0x3BFE7E51, 0xD62A4464, 0x49F6F05A, 0x53B87CA2,
+   0xF2C3D2DC, 0x72327899, 0x9DF4DA5E, 0xBAA194AA,
+   0x000000C7, 0xB50A3E06, 0x3E73ACCF, 0x0754F2FD,
+   0x0D8EBEE3, 0x4B3F3FD1, 0x3CD0AE95, 0xC08BB2DB,
+   0xC4A4EEE0, 0x19D71E5D, 0x79552963, 0x872E35C9,
+   0xF91E1AB7, 0xF6C102AF, 0xC85090F6, 0x1E42A1BA,
+   0x8EDF8C5D, 0x00000179,
+   0x80905A7A, 0x421B840E, 0x94B48CBC, 0x97C7F1D3,
+   0x3B79F360, 0x421A2384, 0xEAF59EF3, 0x1121A2D8,
+   0x59FB65D3, 0xDDBE9D99, 0x71D9D306, 0x6AD2BE23,
+   0x789AF534, 0x36FA0077, 0x8013DC59, 0xB928A6E7,
+   0x0000017B, 0xA38D78E5, 0xB4C26798, 0x4CF38545,
+   0x8884DD39, 0x12A2023B, 0xB74DD461, 0x4133277D,
+   0x1B242F85, 0xD29D7071, 0x401D32F2, 0x3D2E2A0C,
+   0xCD7C9AA4, 0x06BA6AD8, 0x9DF2157E, 0x80E2C3C5,
+   0x749BFC4C, 0x0000018B,
+   0x62EFD94D, 0xEC1F6A57, 0x7B95536C, 0x1D80B5E8,
+   0xAF47E2B4, 0x01F8BA60, 0xA3B0E6D0, 0x6E8AE542,
+   0xE45FEFB7, 0x5ECB52D9, 0x327299A8, 0x2108032A,
+   0x044ED33F, 0xC49FC5C5, 0x52CD0833, 0xD1FD0837,
+   0x000000E1, 0xCDAD11AC, 0x3F6AE9B6, 0x13BB828B,
+   0xAD3F0FA8, 0x6FF056E1, 0x81262681, 0xA73196CF,
+   0x2FD37492, 0xDF90D5F4, 0x172BEB76, 0x66144036,
+   0x63F2C6E4, 0x57F6D086, 0x3E1F4974, 0xFB6EB366,
+   0x5E0D8E49, 0x00000095,
+   0x95989889, 0x630190BB, 0x4E659DD2, 0xE041DA50,
+   0x5DF8E753, 0x5D88D99B, 0x5AC2E158, 0xDBAC2544,
+   0x699EDA49, 0x1FF6ECE7, 0x1051BD60, 0x3D0860A2,
+   0x40C3A989, 0xD4D86857, 0x4002D915, 0x2BFCC26C,
+   0x0000012A, 0x2F4ACC7F, 0x0C43772C, 0xE3753D32,
+   0x54963F2F, 0x65DC40E8, 0xC699BE87, 0x81560A01,
+   0x6DBC95AD, 0x1DEDF025, 0xC805D741, 0x77FA74C6,
+   0x46B049C1, 0x288C1133, 0x7C0F62FB, 0xE6F066BA,
+   0xA8A2E1F9, 0x000001FE,
+   0x64EA99C5, 0x31105C78, 0x396E75E9, 0x513FAF09,
+   0xA04B75A5, 0x34A79931, 0xD4C954F0, 0x3E026B0E,
+   0x235BF7E9, 0x70D2AEEB, 0xDF5682B4, 0xDD6C193B,
+   0x9B1D9704, 0x7CF6E8F2, 0x026EAAC2, 0x41FC6B32,
+   0x00000132, 0x5413AA96, 0xD09919EF, 0x393FC9E6,
+   0xDB06523A, 0x74809CC3, 0x8C6F8BCB, 0xB27E50AB,
+   0x7D2A5B46, 0x2A507C1F, 0xC4F0D079, 0x4A751FE8,
+   0x28C3944B, 0xBF88E984, 0xCD55D261, 0x16DA21B0,
+   0x56D48D06, 0x0000008C,
+   0x473E6D47, 0xF8D97141, 0x1E25F25E, 0xE73699D3,
+   0x00986563, 0xBB3AA860, 0x653B68E8, 0xD8158F88,
+   0xB586D23B, 0x1C7D943E, 0x88EE5191, 0x1074EE68,
+   0x0B60C796, 0x6F60808B, 0x84DD4730, 0xA7FA912D,
+   0x0000002A, 0x6B6FE852, 0x589BCCF2, 0x6ABBB0E2,
+   0x902C7B94, 0x22DB1367, 0x91453098, 0x555FF37D,
+   0x6FEBDA2D, 0x08771767, 0xB6FD9B30, 0xE5A8B409,
+   0x968892EC, 0xE1233793, 0xFE1910A2, 0x213D591E,
+   0x13FE7F04, 0x00000184,
+   0x9A705668, 0xA047B2E8, 0x4CD0215D, 0x2FB2A1B7,
+   0x34146DE2, 0x90EF0BB7, 0x8C103E1E, 0x34007445,
+   0xD95E743A, 0x4803EE28, 0xBB762BDF, 0x574F1CA6,
+   0x2ED0DC5F, 0x703FEC4E, 0xD27172CA, 0x3F19A069,
+   0x0000002E, 0xC44BCF81, 0x3DD8F275, 0x517A8AFB,
+   0xA32F84AC, 0xF26384B8, 0xC065BA2B, 0x19D14499,
+   0xB3FADB96, 0x07523EB7, 0x6258447D, 0xFD107696,
+   0x4C8C791A, 0xD111B4D3, 0x041AB2E7, 0xE28A3A07,
+   0xFD008507, 0x00000165,
+   0x9283F38A, 0x5FA1AA9D, 0x4846CFA5, 0xE0DCEF92,
+   0xE4C20234, 0xEA5D81E7, 0xDF690B8C, 0x5959DBCA,
+   0xC6E466A6, 0xB77391B0, 0x3982757A, 0xDF6353C2,
+   0xB064D2C4, 0x6516E711, 0xDF8F77C9, 0x6A29F216,
+   0x000000E5, 0x7A2702B1, 0xB5FD9818, 0x49291BCF,
+   0xDC2A2E1D, 0x493DBB22, 0xF18DB82A, 0x31732B87,
+   0xAAEF9AA4, 0x0F27262F, 0x6CE115F7, 0x93AFC24B,
+   0x4784C2ED, 0x32540AD9, 0x97DF3C89, 0x69F2A2C6,
+   0xC01564C1, 0x000001DC,
+   //Window 78
+   0x853572E7, 0x92401AB5, 0xEDDEA020, 0x957D2CA6,
+   0x3F9FBD6F, 0x7D54DD65, 0x2E05D05D, 0xAD0C7D09,
+   0x04183B30, 0x6656FBAB, 0x0B716D5B, 0x543B5017,
+   0x9857D796, 0x2481449D, 0xE3A39722, 0x86173B6D,
+   0x0000005D, 0xE71E511D, 0x7130D0CA, 0x35663592,
+   0x168EF9D9, 0xADBF816F, 0x63A9936E, 0xD4F7A44A,
+   0xAF63EE57, 0xCD0EA152, 0x59F21032, 0xA881056F,
+   0x2F552046, 0x21BA6BF5, 0x26EDA9A6, 0xD0A0CAF9,
+   0xE75991C7, 0x0000004C,
+   0x01ECEA43, 0x52A60DA4, 0x41BF6835, 0x00E1AB14,
+   0xDD97B88A, 0x785545CA, 0xD2F2894E, 0xE2BC1326,
+   0xE398BF19, 0x3C730457, 0x1BDD3170, 0xA4C29753,
+   0x92EC7E73, 0x7F01A084, 0x24BB9D11, 0x54D483B8,
+   0x0000005A, 0xBEEA4DD5, 0xEDC13DD6, 0x125EC53A,
+   0xBCECC285, 0x5BCD72CC, 0x8B7DE1BA, 0xDDBBC9B6,
+   0x1853DBCC, 0x8F47FC1E, 0x799B97B2, 0x176CCE73,
+   0xC01253B8, 0x5430BF2E, 0xAB6C5FDD, 0xCF5B31E6,
+   0xF9250653, 0x00000042,
+   0xADA6FDE2, 0x7BD03EFE, 0x33D65185, 0xBBE77A69,
+   0xDA2DB001, 0xA23A4C71, 0x32A63515, 0x3ED58B43,
+   0x80DB0330, 0x3AE797B5, 0xBBE686E0, 0x73B1113C,
+   0x01CAC265, 0x08F4630F, 0x2471F057, 0x2C06080D,
+   0x00000084, 0xD72ECD49, 0x575BFD8C, 0x056FF098,
+   0x67E84670, 0x255B8EAC, 0x01FA38E5, 0xE9233746,
+   0x0B7B82DC, 0xB8093F35, 0x057D4FD9, 0x4FFA1D03,
+   0x9C755197, 0x4B535517, 0xEFB21A91, 0x0BC11412,
+   0xBED68EDE, 0x000000B8,
+   0xD1C08EFE, 0xD4F24879, 0x9ADA24B4, 0xA5E9BA05,
+   0x084971F1, 0xD2CDF316, 0xDDA81C06, 0x51B2C138,
+   0xD2115D16, 0x50DEA9BB, 0x272B0ECC, 0xD472424C,
+   0x3513E8EF, 0x4A7B5644, 0x3277134C, 0x4A64F0FC,
+   0x0000004A, 0x507427FA, 0x7AE9BAA3, 0x96D38106,
+   0x1AEA2A49, 0x95F53E5A, 0x0209A4E9, 0x9F87AA0D,
+   0x2A6D84AD, 0x47769D56, 0xC00B858B, 0xB64A452F,
+   0x42F17CD2, 0xCE95AA06, 0x58A23140, 0x418F5F55,
+   0xDB36A78A, 0x0000001D,
+   0xDAC5A843, 0xEFB02E38, 0xF82BF9FD, 0xA721043C,
+   0xF29EB485, 0x3486A36C, 0x4DF0EB86, 0xF3DA92D2,
+   0x920151B5, 0x92B7DC8F, 0x51AC7E31, 0x4029BE69,
+   0xCE306539, 0xF805C396, 0x855DF2DB, 0x2915B7E3,
+   0x00000058, 0x105DA111, 0x144E4AD7, 0xE8093234,
+   0xA29E58B6, 0xE6EAECD6, 0x289EBF17, 0xE47686D8,
+   0x7A66164F, 0x0026506F, 0x9B777A6A, 0x7AFE205F,
+   0x6B5B02A4, 0xDD661E69, 0x3DFAA74A, 0xBF55254B,
+   0xA22269CF, 0x00000003,
+   0xA34B6386, 0xA32000D2, 0x6C95A6EF, 0x9764CD9C,
+   0x5EA38139, 0x45068966, 0x6F5CF696, 0xE049CAFB,
+   0x4D44868D, 0xF1CA1D7C, 0x9051AF05, 0xCBCD0B95,
+   0xFED0B440, 0x6E684A6C, 0x5EBE77DF, 0x8A251E60,
+   0x0000018F, 0x09C53D0C, 0x4B0B1086, 0xFE3CEE86,
+   0x9E6D1C53, 0x2AAE7587, 0x3C3E5F2A, 0x106E0E63,
+   0x282D3E85, 0xBF45050E, 0x3DAE698B, 0x52474646,
+   0x783C0D07, 0x56997ED5, 0xC62E2327, 0x61D50D46,
+   0xB3868E76, 0x0000004E,
+   0xD27D4C2E, 0x5CF90261, 0x32D853DF, 0x6C3AA4E9,
+   0xA24BE9F9, 0xFE4C043D, 0xEF99892D, 0x8D5F7BE8,
+   0x088B2631, 0x84852032, 0x8DFA11AC, 0xD6F625D3,
+   0xB0BE68DC, 0x0260BF61, 0xA5BAE5E9, 0x59A4CDFA,
+   0x00000124, 0x3FBA397A, 0xF9F239E5, 0xB9F0D4DD,
+   0xD46A5A0D, 0x1C8A385B, 0x88ED975E, 0xDF279B89,
+   0xC1AE52CE, 0x954C766D, 0x76F10A46, 0x74BBE6F8,
+   0x11C766F1, 0xE51FBD13, 0xF0AF009A, 0x72CD8575,
+   0xEEB7559A, 0x0000002D,
+   0xFC42B580, 0x3B43B14C, 0x321B6B60, 0xB9DE4C31,
+   0x55596D23, 0x901E3CD4, 0x09789B1D, 0xEDB74DB7,
+   0x54D55D69, 0x66CE9732, 0x5A63FAC8, 0x3BE8AF9D,
+   0xD84340B8, 0xAB95076A, 0x8C79EA93, 0xC5B0D10E,
+   0x00000009, 0xD81928E3, 0xF8E10327, 0xD425A250,
+   0x0A7F7D10, 0x90B3C4F5, 0x145900CF, 0xF0A3B41E,
+   0x41E5AE94, 0x760D8E56, 0xB89EBFCA, 0x8C152CDF,
+   0x9B4A2F46, 0x94E7433F, 0xB89C0897, 0xAB140DA9,
+   0x4F1BA579, 0x0000018D,
+   //Window 79
+   0xA03EFD8C, 0x18CADDDD, 0xAEB3A762, 0x9D59BB52,
+   0xD1FD3F91, 0x571D86BE, 0xD2F26D6D, 0x81642AA1,
+   0x99877251, 0x7D1C3BC9, 0xD7C2FD25, 0x0518EFF8,
+   0x37B6C641, 0x6A54F170, 0x0D33A426, 0x8FFEDFC0,
+   0x000000C8, 0xBB54847B, 0xACF67416, 0xF2B54B28,
+   0xA293A8D7, 0x1F7F6B47, 0x32F2B11A, 0xC6D67A9D,
+   0xC11948BC, 0x47623783, 0xC8B86B1F, 0x5C2362E6,
+   0x357326AA, 0x6CF79126, 0xC298BE1B, 0x84C5A79C,
+   0xF07B3EA7, 0x0000006C,
+   0x5A0C9415, 0x5EBBD701, 0x29572D13, 0x7BCEF0E2,
+   0x3F5A169B, 0x539A7813, 0xBAC0ABFA, 0x6F3A84A4,
+   0xEA1D0B7A, 0x822DA09B, 0x05C00DBF, 0x9B2D6A6C,
+   0xCD8C7E6E, 0x134FE65D, 0x6301E4CA, 0xE4622A9F,
+   0x000001FF, 0x073963DD, 0x5FBEB1F8, 0xE595AAD8,
+   0xCCA648B0, 0x3D15C1D4, 0x5CC97E77, 0x62989B5E,
+   0xF2D76970, 0x8AFE8351, 0xF321C0C7, 0x93A60C7B,
+   0xBF361AA2, 0x74C2503A, 0xD9938C11, 0xE409747A,
+   0xB05DAAA5, 0x00000008,
+   0x0254D2D3, 0xFDE8D0ED, 0xF24357A8, 0xDC6868C5,
+   0x26106991, 0x1806776F, 0x387D0F81, 0xA3A1446D,
+   0x19591FDC, 0xEB83F7B3, 0x136E098C, 0x97678D46,
+   0x42E7487F, 0x89292AD3, 0xB3C12865, 0x53B24C0A,
+   0x000000B3, 0x7A74E056, 0x06FC68F3, 0x9D0DD6D1,
+   0x10354BAE, 0x67092C45, 0x713509D9, 0x52C97523,
+   0x5DDD0FBA, 0x4616EAF9, 0x421E8160, 0xA795B907,
+   0xACAF5CF0, 0xBEB5A28C, 0x1CA067C8, 0xB79CEA20,
+   0xE07CBBCD, 0x00000179,
+   0x1DF30301, 0x72E34849, 0xA7AE2709, 0x71BA20A6,
+   0xEAC84515, 0x2AC2B9E7, 0x684FDD3D, 0x7DB23E2C,
+   0xB1B07C3B, 0xB7FF18F9, 0x22F64D40, 0x296F8054,
+   0xACA26121, 0xE7E74E51, 0xA4ABF51A, 0x2382BAEB,
+   0x0000004F, 0xA03677F6, 0x076D34BB, 0x6484F153,
+   0x42BCC9C7, 0xD74DD1BB, 0x7B5FD617, 0x797CF9D5,
+   0x1BA3E99C, 0x87403DC5, 0xA9078007, 0xD6D1E062,
+   0x98278850, 0x6CC37A89, 0x456314CA, 0x0A6DAF4B,
+   0x3D3CFF1B, 0x00000117,
+   0x8C8601DC, 0xBD742BB5, 0xBBD68FAA, 0x0D577D51,
+   0x98B6E280, 0xB1BA3C33, 0x3E8A148E, 0x1BFC6C72,
+   0x6E41826E, 0x59A16F76, 0x161094F5, 0x3EE5C3E7,
+   0x24C86F2E, 0xA98675BC, 0xE2761752, 0xB94C47AB,
+   0x000000B9, 0x56DC8149, 0x18246730, 0x4FF82F9F,
+   0x846838C9, 0x450AFB9A, 0x23C95268, 0x14FB3828,
+   0x40CC51AA, 0x11F0D733, 0x28D16197, 0x513057A2,
+   0x0EFCCE77, 0xED0A7D9E, 0x9EDB17BE, 0xC7B17549,
+   0x4D6ED1FA, 0x000000D8,
+   0x2D7A2680, 0x930CAD15, 0xC719CF5B, 0x6D7A0454,
+   0xBBB88406, 0x7478744E, 0x5883C3C3, 0x2598C488,
+   0x4F5FAB3A, 0x46692501, 0xDD8A471E, 0xC803C49D,
+   0x831D5062, 0x10CFA5B5, 0x8CD03021, 0x2BCE8E3C,
+   0x0000004D, 0x09A2CCA3, 0x8A75F6CD, 0xB03CFF30,
+   0x44598D59, 0x9B9D4AC1, 0xF49EEFDC, 0x116A7518,
+   0x6D759AEA, 0x02B18830, 0x0F330EDC, 0xC41FC942,
+   0x52612307, 0x41B5E855, 0xEA4652FB, 0x3AD0F9A9,
+   0x5DCE0D5C, 0x00000018,
+   0xD0A59FE9, 0xF8F4C244, 0x76402697, 0x0B34084B,
+   0x3E032519, 0xE4240B86, 0xC2065720, 0x7CF7B7AA,
+   0x4CB1FFE5, 0x798134D6, 0x75F60549, 0x78E358F2,
+   0x70582D54, 0x45574303, 0x828DFBFA, 0x452570D4,
+   0x0000009E, 0x68D79237, 0x1B0BCBC4, 0x4F5A6A6C,
+   0x8BCB0D80, 0x99609CFA, 0xD108B4F0, 0x71BE7D63,
+   0xE08DB1FF, 0x27BD2D03, 0x7AD777DA, 0x5749C830,
+   0xCE7FAE77, 0xC4565777, 0x1AD692F7, 0xFF8B8327,
+   0x93798A2A, 0x00000010,
+   0x9C2DE291, 0x04CC8A0B, 0x1B774116, 0xBDE190D4,
+   0x0CEF5563, 0x76FD915E, 0xA3AD15AB, 0x08980204,
+   0x0047227E, 0x8532BFF0, 0xDF68231C, 0x93713303,
+   0xB1B0DE98, 0xA4D4B863, 0xE0CAD308, 0x67686192,
+   0x0000007D, 0x72CF3E2F, 0x6748CD26, 0xEB321523,
+   0xA342C5D7, 0x5021D422, 0x0466141C, 0x6A70D2D8,
+   0x116BF224, 0xCE05F6FC, 0x7129A3A4, 0xD9185DA8,
+   0x86600259, 0xDD965C37, 0x8A6DB564, 0x79E8F792,
+   0xB073F80C, 0x00000049,
+   //Window 80
+   0xAB9923D7, 0x5F47DDB9, 0x8E3FAC52, 0x839865D4,
+   0x647424B0, 0x0214E93F, 0x31D65C6B, 0x266C909C,
+   0x51457FAC, 0x956DECA4, 0xA85CE8A5, 0x8E8D240E,
+   0xA4D9B281, 0x736652C4, 0xB77A526D, 0x131A4191,
+   0x0000008A, 0x32D8542E, 0xA8483195, 0xC3F38387,
+   0x1F7A8E67, 0xD6797F2E, 0x162AC248, 0x0A6A1118,
+   0xD26469E1, 0xF203102D, 0xB33AFF1F, 0xAADF0AE9,
+   0x63A52154, 0x4BB313A7, 0xF0431DBB, 0xCA9DA156,
+   0xF93C18FB, 0x0000015C,
+   0xDB0B7846, 0xE5D80096, 0x907BAE46, 0x1EC79296,
+   0x362B9307, 0x6CB09D0D, 0x2C89BA81, 0x76B5AC52,
+   0x7D83920B, 0x12D37CD2, 0x8C031B82, 0x22A18F6B,
+   0x93822770, 0x8C1BD009, 0x7528177A, 0xF5F69926,
+   0x000001C1, 0xACB136B5, 0x1C08DB46, 0x27D539F1,
+   0xD3BC1FE1, 0x59AA9DDB, 0xD87F1073, 0x7E8A3E33,
+   0xD8487FF9, 0x60581C89, 0x3FA1A3F1, 0xA5980F30,
+   0xE0379485, 0x6C7687E8, 0xE5D3C87E, 0x5F6FF261,
+   0x6286E05D, 0x00000155,
+   0x2E769805, 0x1C30F6C0, 0x741916E0, 0xF4BA830A,
+   0x9A7F97D7, 0x6D44914E, 0x2A5220CC, 0x873BE2FE,
+   0x77F0CD9A, 0x6C349086, 0x5725527A, 0xA11F9DAA,
+   0xBCBB7F2C, 0xF691B79B, 0x316C9811, 0x0C9D568B,
+   0x0000009C, 0x0F75AE83, 0xA0333545, 0x507B1783,
+   0x904E5959, 0xD4DBD664, 0x92110DBD, 0x061CC502,
+   0x767CFDAB, 0xAA2A0300, 0x3771EA16, 0x35C82065,
+   0x3D8CFDCC, 0xBA413636, 0x1E0AFA55, 0x1F73EF3B,
+   0x5C1D5F58, 0x0000019B,
+   0x13714771, 0x964975D7, 0x8639C0A0, 0xEFB11E27,
+   0x6109122A, 0xA83B403A, 0x3DB62A02, 0xC3120D86,
+   0x114181F7, 0x479F1597, 0x4A902962, 0x2FD71BC1,
+   0xA616219C, 0x6B5A2225, 0x86E78CA8, 0x2AABC22D,
+   0x00000022, 0x197ADCF4, 0x9037A233, 0xDFEC0430,
+   0x9C676F3F, 0x92AB3514, 0x42ABA69B, 0x64CB5C48,
+   0xB1B7B693, 0x0066EA08, 0x866D10CC, 0xEA7DBC33,
+   0x13C190A6, 0x6D2D3558, 0x64EACE1D, 0xCBB4A44B,
+   0xC2075B82, 0x000000F0,
+   0x2B2DAC67, 0x1EDA1171, 0xC6FC4BBD, 0x2A50CE6D,
+   0x3B09D412, 0x68ED6522, 0x3BDE989E, 0xC1AA3375,
+   0x0CB2F289, 0xDF186024, 0x90FA51BF, 0xB9E67923,
+   0x1BA20748, 0x912EBAD7, 0x23E76EB4, 0x7CC7C8F8,
+   0x00000090, 0xB4A1D3CE, 0xE639EA6D, 0xFF19F1B8,
+   0x760F5172, 0x5617CACF, 0x82947724, 0x97AA09F6,
+   0x22F0BDD3, 0x637133A7, 0x6CACE44C, 0xE63EF73D,
+   0xC8A42AA1, 0x9A0F309D, 0xC4B6481A, 0xEE3C7247,
+   0x169CC506, 0x000000E2,
+   0xDE03108E, 0x268872EB, 0x4357C102, 0xEA65ACD4,
+   0x02EF5A7F, 0x4FEADB3C, 0x09BE4878, 0x3125D1C5,
+   0x5E59ABB3, 0x185585F9, 0x863A0ACD, 0x1D530AE5,
+   0xFBEEE48A, 0x70CC10C2, 0x6303F7A2, 0x1DCC0FFF,
+   0x000001A2, 0x9681CF50, 0x8BC9AF6F, 0xF32520CA,
+   0x81DE189C, 0x28296C91, 0x78D6EE25, 0x958E33F3,
+   0x79EC34EB, 0x2141099E, 0xCCE3B4E1, 0x62CFFCBB,
+   0x84851CAE, 0xCCD79AA7, 0x39FAED37, 0x832A0AB0,
+   0xF6269FEA, 0x0000006E,
+   0x857BBD62, 0x252E60E1, 0x6CF87A3D, 0x54219607,
+   0xF6CAA907, 0x7A3E5E40, 0x12E825F1, 0x8D437ECB,
+   0x73C57EA5, 0xE5C893A5, 0xE6051480, 0xE519B68A,
+   0xEA91E8A2, 0xF6569C11, 0xD389974B, 0x185D9CCA,
+   0x00000163, 0x9A0A8986, 0xF580AFEC, 0x48995123,
+   0x6805EBCD, 0xEB0F2F2F, 0x91EA17E6, 0x938B3CF4,
+   0x1A0A5F3D, 0x187DB744, 0xA04402FC, 0xD9E0E0A1,
+   0xC07A2174, 0xAF348188, 0x6F2E321F, 0x14348E08,
+   0xC6E1FA06, 0x0000002B,
+   0x85892E2A, 0x17B8A036, 0xA64BE1E6, 0x9C15440A,
+   0xD31FC228, 0xCB472BF1, 0x1F36B542, 0x5F4A465C,
+   0xD5BE1A4B, 0xDAC69679, 0xB77370E1, 0x4BF0AAAB,
+   0xBB6C3E36, 0xA8E119C5, 0xC06C0114, 0x21949699,
+   0x0000007D, 0x3BA74EE9, 0x88AE2DF2, 0x9BB49F24,
+   0xA3CD8BCE, 0xD7D3F5FC, 0x7FACF9A5, 0xCA309DC7,
+   0xE6ECFFD8, 0xDB9EBCA3, 0x25A2C984, 0xC5CE2AC1,
+   0x0A794AEA, 0x82E8D490, 0x4C96AD86, 0x419D91FC,
+   0xFF2B5ED5, 0x00000011,
+   //Window 81
+   0x569DFCD1, 0x5637CEAB, 0xB2C13802, 0x0D1CF091,
+   0x731087B6, 0x09115A1F, 0xBDB45B2B, 0xEDA479FE,
+   0x8E6E5507, 0xED883A7D, 0x30BD8162, 0xBC9206BA,
+   0xC6294B24, 0xFF2AF28E, 0xC8947BC9, 0x2058521A,
+   0x0000003C, 0x5A82FBAA, 0xFCFA87A5, 0x1569F45B,
+   0x988A9A6C, 0x5D3D6AA5, 0xE65849F6, 0x05446B48,
+   0xA3D0879F, 0x76F480D1, 0x45571CCF, 0x0EFD5F79,
+   0xACD9A323, 0xAE956132, 0xF30E5EC4, 0xEA93F245,
+   0x325306D0, 0x000000A7,
+   0xAC5FAB15, 0xC1D74D05, 0x9B102D52, 0x6EA132C4,
+   0x0D890CD3, 0xD3ADA4CE, 0x92823F62, 0xAB7248F0,
+   0x23871113, 0x246C3730, 0x98424F07, 0xEBBCA0B9,
+   0x2E62E741, 0x0061EB2C, 0x5E90C5B4, 0xAC1B03D2,
+   0x00000136, 0x7EEFAE68, 0x0748C14A, 0x81F8A2CE,
+   0x82525B35, 0x398363E1, 0x31A64097, 0x57B6B33B,
+   0xCBF57E02, 0x807217E6, 0x523F0584, 0x80B9700F,
+   0xD607EFE7, 0x35596890, 0x79AFCC94, 0x6985A97E,
+   0x140ED6F4, 0x00000160,
+   0x8EC70A8D, 0xAFC75C17, 0x7B117380, 0x32686EBF,
+   0x21E28C47, 0x16050CDA, 0xE731B083, 0x70C05654,
+   0x71D1F6D2, 0xAFA2E575, 0xC1982FD6, 0x0DF1A032,
+   0x1E86F69B, 0xC0E7B146, 0xDCE1864C, 0x0DF3C6BC,
+   0x0000012A, 0x00B0D0B1, 0x46FA0FA6, 0x1691A590,
+   0x1F0A42B2, 0xAC8C1189, 0xF5A6E4E8, 0x73A0AB49,
+   0xA2CC9879, 0xCF17F795, 0x721CA290, 0xECF32B7B,
+   0x4026F9C3, 0x19CD7057, 0xBABD20C0, 0x5C30CBCC,
+   0x99378E8C, 0x000000D2,
+   0xB7DC0F64, 0x161B9770, 0x84F67076, 0x42AD385A,
+   0x710D4992, 0x6A94116C, 0x3EC54457, 0xDDFA3003,
+   0x2D520342, 0xA17C61D1, 0xF36C6F21, 0x7E673638,
+   0xEAA1A95A, 0x7654E648, 0x0DD8029D, 0xC4B4A3C4,
+   0x000001CD, 0x00C9033C, 0xD7485255, 0x51ACD2CD,
+   0xCF0D9C35, 0x596A8678, 0x02022DED, 0xD90B82EC,
+   0x56FE8164, 0x863801C8, 0xE376A376, 0xAD337694,
+   0x559B0F3F, 0x06E23E58, 0x3C720B4F, 0x91914C96,
+   0xE02DCD81, 0x0000003A,
+   0x886B2E59, 0x0E4B463A, 0xE1730E93, 0xA7091BDD,
+   0xE485313C, 0x53693DE2, 0x9D335D4B, 0x32137CEC,
+   0xE7B8F7B6, 0x30983F46, 0x36785D2F, 0xA8F5732C,
+   0x27F2DB5A, 0xFC96DD6D, 0x5A562614, 0x649054E2,
+   0x00000164, 0x14766D09, 0xA4B1B997, 0x2001ECEA,
+   0x93AF1A13, 0x69BB5799, 0x436FDF6A, 0xEAE264AD,
+   0xB0F3E655, 0x61838A92, 0x1FF369C7, 0xA24DA60C,
+   0x3780D328, 0x41CADE42, 0xE126D992, 0x9EA7D1B4,
+   0x9CC0E1EA, 0x00000056,
+   0x9439311E, 0x8ED9E22A, 0x314B0141, 0xD3F46E41,
+   0x68382359, 0xBDB15705, 0xB65D3AAB, 0x149ADEBF,
+   0x4FB4C8C2, 0x4F73E325, 0xECDFB62C, 0xEF7883CC,
+   0x123003B4, 0x7A0ECAA2, 0x15A2A7FB, 0x8DA68ECE,
+   0x000000CE, 0x42250748, 0xAAC484E5, 0xE43C22E1,
+   0x5E1020B2, 0x5F3C8E7B, 0x755475A7, 0x533061B7,
+   0xBC1FD16E, 0x011D193C, 0xD10D8530, 0x4AE8EFDD,
+   0xB8D9C97E, 0x8F813FC8, 0xF19DE264, 0x415DAF6D,
+   0x3A0B5F66, 0x0000009E,
+   0x17001AB9, 0x42C6902D, 0xE3C3BEF7, 0x6BCD13B0,
+   0xA3B5A78C, 0xE61D8161, 0x05B85E95, 0xA201774E,
+   0xD7E54543, 0x9C0940AB, 0x1066397F, 0xD8C739A7,
+   0xA49687E8, 0x2A086159, 0x92222916, 0x6E5A1B25,
+   0x000001D9, 0x069126EE, 0xC2FE70BE, 0xDA37306A,
+   0xD337FF0C, 0x57F8EB8C, 0xD91E07F1, 0xC3E8974F,
+   0x83EEF5E6, 0x665F08CF, 0xA0584968, 0xB5297C10,
+   0x377CDCE9, 0x3D1F2799, 0x581D1C01, 0xBC2E1714,
+   0xA1B669D8, 0x00000096,
+   0x78E658C5, 0x5F4BA23B, 0xDD8F6428, 0xA9463D66,
+   0xFB241842, 0x2B6792E9, 0x934AA1F1, 0x10DFA360,
+   0xB7BF8A36, 0x7769322A, 0xF127AA05, 0x223C1474,
+   0xD048D6C5, 0xEBEE2760, 0xE7B13526, 0xF495B445,
+   0x00000032, 0x8BB79C71, 0x7BAA637E, 0x1681A7B2,
+   0x34970905, 0xEDD0293A, 0x12359173, 0x4E888C4C,
+   0xBD9DEB85, 0x563C6C2B, 0x43F03F70, 0xF20FE520,
+   0x42D131B2, 0xDCF32D61, 0xB080E82C, 0x0817EA86,
+   0x7ACA6B8C, 0x000001F4,
+   //Window 82
+   0xC000E4F4, 0x4D1BA365, 0x7B2CAA8F, 0xCF34A1A8,
+   0x783E3C39, 0x0E4A58D5, 0x2C1FCBD9, 0x1AD4B5CE,
+   0xE8B9556C, 0x6B30BFB9, 0x6301B3A4, 0x304AD236,
+   0xC8D571F1, 0xDACF31B8, 0xEC93E088, 0x25B7A0FD,
+   0x0000012E, 0x3B6CC6DD, 0x2863BCBF, 0xE9430F99,
+   0x70760671, 0x7586CDDE, 0x46CCE87B, 0x161A045F,
+   0xC1F58398, 0x291636AE, 0xA84CA0CF, 0x26892BD1,
+   0x11242D27, 0x8C971E9F, 0xB1D85DA7, 0x61AA5039,
+   0xC66E0E1D, 0x000001B1,
+   0x8A6AC4B8, 0x1E55BD59, 0x7F9B3261, 0x4D2FF641,
+   0xAE650E54, 0x7357BA73, 0xA534EAF1, 0xFC787C61,
+   0x292ABBDA, 0xDBB8C786, 0x19E5429C, 0x177FE5BC,
+   0x5C9E9AD6, 0x8EBA99F0, 0x8970847B, 0x28BC9369,
+   0x000001BF, 0x012A3B19, 0xEA2FE5C6, 0x120A832E,
+   0xD1B5DD53, 0x5511DB76, 0xB6D7981F, 0x86DFDC2F,
+   0x32DAE3F9, 0xFD49509B, 0x647143B5, 0xAE5DED18,
+   0xE975FF91, 0x8D60F9F2, 0x1DE3C3CB, 0xF5365428,
+   0x958C21AA, 0x00000171,
+   0x78A26AD1, 0x08068768, 0x4A4E0A00, 0x01D14668,
+   0xDF68A10B, 0xF47A3F33, 0xCB9B660F, 0x26C714DE,
+   0xFEB94C62, 0x177C6DB6, 0x88FD6FD9, 0x9D859DBC,
+   0x45CDDA91, 0xFAF924FE, 0xAB8F7635, 0x9ABC26E3,
+   0x0000009B, 0x023D360D, 0x5B24D5D0, 0x9F8FDC2A,
+   0x568BE974, 0x0BD7C5B2, 0xCDA7AD21, 0x8794C868,
+   0x13CC6F4E, 0xCC9C99D4, 0x39574E32, 0x598DABC8,
+   0xCFBA662C, 0xC19BE405, 0x13A18B8E, 0x71F860FA,
+   0x7E68CD3F, 0x00000104,
+   0x72DCBDA3, 0x584410B6, 0x29E3894E, 0x8BEA7142,
+   0xAEA5190A, 0x1A155410, 0x26192C76, 0xDCD905FD,
+   0x323F0EC1, 0xCD398643, 0xF3645C09, 0x75ED17FA,
+   0xC809CA20, 0xD7F031AB, 0x45D35024, 0x50A51D93,
+   0x0000007A, 0x5AE92EB2, 0xF5F7D19E, 0xA68F24C0,
+   0x358CF7A0, 0x6E6E1059, 0x48D8485E, 0x650B703A,
+   0x42CEB50E, 0x81E19069, 0x4F717CCB, 0x86CF55F1,
+   0x88EC063E, 0xDD6FFBA5, 0x7928166B, 0x1716E36F,
+   0x6315AE49, 0x000001BC,
+   0xB3C284EF, 0x0F90CD67, 0x0E5B9DE0, 0x951C43EF,
+   0x5038FA53, 0x9CBDDA8F, 0x472F23F6, 0x44F33E90,
+   0xF8511A21, 0xC88B8EE0, 0xF0FA173E, 0x6FFBCECF,
+   0x200A8DFC, 0xA10D66C2, 0xC27F52D9, 0x4CAC6348,
+   0x0000012A, 0x2D67D1D5, 0x6370A948, 0x143D8BC7,
+   0xCBDA158C, 0x3C8FBA5C, 0x1063F74F, 0x5CE883A4,
+   0x6B9993E9, 0xCC003953, 0xEE4BEF73, 0xD5469935,
+   0x1C1E9119, 0xACD564BA, 0xB1744545, 0xF10398A5,
+   0x1F34EFF6, 0x000000EC,
+   0x09A6CC56, 0xBC580CE2, 0x75C678EA, 0x71087629,
+   0x6AEB6118, 0x88287F0E, 0xF8F02141, 0xB20199F2,
+   0x684714DE, 0x682C00FF, 0x1B0B2D2D, 0x14476152,
+   0x9DB385AF, 0x211E0000, 0xFE6CBD00, 0xE5253108,
+   0x000001C2, 0xD34D3D44, 0xD3E3667E, 0x1AD609BC,
+   0x30265A17, 0xB76C964C, 0xBF165EA2, 0x1E7175AD,
+   0xA090D0CD, 0xEE8E0C4D, 0x8AC76FBA, 0x2F4E6388,
+   0x0AA977B5, 0x8AFD305B, 0xC2F5F3FB, 0xA4CCDCF2,
+   0x390D3CF1, 0x0000003F,
+   0xD4502C57, 0x90D6932F, 0xA118BA3F, 0x33A02504,
+   0x636F94B6, 0xF5F74804, 0xB9B9318F, 0xCE842ACE,
+   0x4C794C80, 0xA67CBBA2, 0x6539B685, 0xB9A5244B,
+   0x8812E098, 0x571321E6, 0x98B10609, 0x8A329A05,
+   0x0000008B, 0xB8942609, 0x33ECC643, 0xD9EFBFAF,
+   0x7082B10C, 0x02B46ABB, 0x5CE6F68F, 0xF47929AA,
+   0xF642692F, 0xDFCAF995, 0x29BB4A70, 0xBCEA2005,
+   0xE8C69640, 0x92D13977, 0x6AFEE11B, 0x0E1D1076,
+   0xF3D44F87, 0x0000016D,
+   0x8ADBD3EB, 0x27F69A0E, 0x2D09F533, 0x63EB042A,
+   0x1A004ADF, 0xAAF6D218, 0x0DD53ED2, 0x9BD449E8,
+   0x480F8DFA, 0xAF0DAF82, 0xF5F79306, 0x645307D5,
+   0x41E10D2D, 0x99DD7D60, 0x6C70D16E, 0x090D034A,
+   0x00000066, 0x5FB42F7E, 0x7CD68448, 0xD74292C6,
+   0xD359274E, 0x8D66B38C, 0x8949BBCA, 0x6F558F88,
+   0x6BE51B4E, 0xC8227E9E, 0x59725120, 0x2AF08FA1,
+   0xA0B37557, 0xBE8AA863, 0x171E50E4, 0xCD944FFB,
+   0x5306419D, 0x00000178,
+   //Window 83
+   0xD34B138F, 0xBF0B5EA3, 0x3AC7CAD4, 0xC4951381,
+   0xCAB6A319, 0x82CA5536, 0x88BB4EA8, 0xFF569136,
+   0x4761D3E9, 0xCEE2512A, 0x55EF9647, 0x4695E521,
+   0x9378F132, 0xBB83316B, 0x8D43BB4C, 0x1D447F04,
+   0x0000002B, 0xCE5889F5, 0x777AB201, 0x4C6F0545,
+   0x635D968F, 0x872777EA, 0xBB48A0CF, 0xC616138F,
+   0x33F4DE62, 0xBC8D65CE, 0x93E74192, 0x5EBAE1F0,
+   0x532CA9BD, 0xFBABA8D0, 0xD783E104, 0xBDF2D850,
+   0xB32AF569, 0x000001BA,
+   0xE43B6C21, 0x9FA30F39, 0xB9FC57BB, 0x4D3822AA,
+   0x69A8A55E, 0x0230ADCF, 0x6F87F988, 0xDC8AB279,
+   0xB2AF81FC, 0x2D642A82, 0x30765913, 0xB9E63A77,
+   0x25F2A77C, 0x57874006, 0x5BFEE0F1, 0x0AA30A6F,
+   0x0000003D, 0xFCE49DAA, 0x796F6508, 0xBF907285,
+   0xB586299F, 0x5838145B, 0x21CCFC55, 0xE6D43B4D,
+   0x20A0F8C0, 0xE5E80FC6, 0x17170A2B, 0x88FBA946,
+   0xBB8F8406, 0x411FCBE7, 0x5C226B0E, 0x2AE8E090,
+   0x35ACE6E0, 0x000000B0,
+   0x162DD91D, 0xA39D4AC8, 0x22E67A01, 0x57047693,
+   0x7C446028, 0xDFE57F99, 0xD131A2C8, 0x0F49DF77,
+   0xF7F779BD, 0xC8F26682, 0x18E884F1, 0x16966558,
+   0xF390907B, 0xC5D9D516, 0x617F5F5C, 0x23356E77,
+   0x000001ED, 0x679DEABA, 0x5E6830B9, 0x9FD1A70E,
+   0x18BCC37F, 0x72225892, 0xFA84E862, 0xC610763C,
+   0x2E6CD938, 0x671378EA, 0xC179376A, 0xF502EA1F,
+   0xE3B844B5, 0x5FB4DC36, 0x74A390B7, 0x0ED8D535,
+   0x51F01940, 0x0000018F,
+   0x3D70360C, 0x8879637B, 0x72F41087, 0x053C278F,
+   0xF07F009E, 0xCC895E1F, 0x68DB6690, 0x4C9B8C64,
+   0x1B97DAC5, 0xB4547398, 0xAF65FF38, 0x0399CAC8,
+   0x1FD0A6C0, 0x295E0914, 0x871BDEFA, 0xAB605FCD,
+   0x000000D0, 0x5AD63582, 0x3F2D4297, 0xDC7D3A40,
+   0x28FDA2BB, 0x65672D9E, 0x7F144367, 0x2937E8C8,
+   0x9322AB08, 0xAF748929, 0xF351279F, 0x149D6F5D,
+   0x63A624F5, 0x989F5325, 0x3351F4FF, 0xBC7DD8D9,
+   0x0456187B, 0x000001B1,
+   0x52B7210D, 0x1777C43A, 0x88CF1CEC, 0xD6496DC4,
+   0xD2326BAA, 0x1AFC70A9, 0xEEFEE797, 0xF3464F03,
+   0xC431A2BF, 0x98FDA748, 0xF6E2DD07, 0x658E8ADD,
+   0x8D4D40DD, 0xEA46C264, 0x1D5C0B95, 0xD176AC8E,
+   0x00000025, 0xD6068679, 0x5982AAD3, 0x10F248BF,
+   0x441CE56C, 0xA1B42DC9, 0xEA69B563, 0x48CB7E86,
+   0x1852A889, 0x746D5378, 0x5C15948C, 0xA96DABA3,
+   0xF975AD39, 0xC24E4659, 0x8A24C559, 0xDAEC6FBA,
+   0x26B90DE1, 0x00000193,
+   0xE1A64D88, 0x3C447F12, 0xDC716C2F, 0x227CD2A8,
+   0xDCD8DD11, 0xBB74F8CD, 0x44470D08, 0x8068EEF1,
+   0xBFF0B87F, 0xAF26EE62, 0xF1D13FBF, 0xD7E3C625,
+   0xBB4FBDAA, 0x5507A88D, 0x5C90F896, 0x222B1B38,
+   0x000001B9, 0xFCBFFEDD, 0xAED21D70, 0xCC7176AE,
+   0x78F774A9, 0x5935F39F, 0xC41670E8, 0x47B1F321,
+   0x154026F1, 0x774A7B33, 0x8C96D0BB, 0xB6736839,
+   0xF1708F4E, 0xE104E052, 0xAB7BDD94, 0x205C733B,
+   0x847EA13D, 0x0000006B,
+   0x38E43B1F, 0xCB693957, 0xEF760C39, 0x5C325EE2,
+   0x2182C907, 0x57685B1C, 0x509C9158, 0x5152F4CD,
+   0x8B118674, 0x849CF934, 0x47C03BF6, 0xB49BD091,
+   0x7755FC2D, 0x9404A4A1, 0xA95B8EA0, 0xF8600FDB,
+   0x0000008F, 0xC919662E, 0xA88E6CA5, 0xD85D30AD,
+   0x95A8487B, 0x4E156FD8, 0x9DFE5015, 0x1D42EB21,
+   0x52D34608, 0x5197E727, 0x80BD6FAA, 0x2295DF4C,
+   0x63DD034E, 0xF14D5BB2, 0x808A306F, 0xFF5B4448,
+   0x58A8B76A, 0x000001C2,
+   0x44020170, 0xF44C8563, 0x7DDD6FA9, 0x90E45B1C,
+   0x42C66254, 0xF13839A2, 0xD7BE4F1D, 0x99EA9656,
+   0xABAFCE56, 0xA9823806, 0x1DE1B35D, 0xB4BC02EF,
+   0x69841816, 0x6958138C, 0xCFE8DF9E, 0xFFA23B56,
+   0x00000121, 0xC1B4C6CD, 0x309B979D, 0x99BC27BF,
+   0xB074A813, 0xAF10538A, 0x70AC0E9F, 0x822B6200,
+   0x4EC3C71A, 0xD0E1E740, 0xD8567EEF, 0x518E0EE9,
+   0xDED8EBF0, 0x73F304A9, 0xAF015254, 0xE7946C63,
+   0x12FE8D03, 0x0000009B,
+   //Window 84
+   0xA79CB073, 0xADF5E06E, 0x8BF180E6, 0xCB46ACA9,
+   0x835F8E22, 0x5BF0D9EB, 0x7713F3AD, 0xD692CD20,
+   0xF0D87F74, 0xA33E9D7F, 0xF602A362, 0x9F2B6950,
+   0xDFA4F77C, 0x27A4C70B, 0x3C56080A, 0x99C699DD,
+   0x00000105, 0x95338FA8, 0xDFB1B255, 0xD59E754D,
+   0xABADBA3A, 0x436E70FC, 0x2338452B, 0xE07A21B6,
+   0x34CFB5B2, 0xF81EA5A2, 0x25DDB684, 0xAA325FC8,
+   0x98F463C0, 0x94AEB02E, 0x963BBC80, 0x434AB9FA,
+   0xA98FE976, 0x00000188,
+   0x56500523, 0x2EA6E184, 0xF44D63FB, 0x566CCDD0,
+   0xB01114CC, 0x8CC0208D, 0x11E5DD4E, 0xDB7BF613,
+   0xFF83D7B1, 0x65E4263E, 0xD6DA83E9, 0x12D2924C,
+   0x78380401, 0x093BD190, 0xFF97C4F9, 0xD2835BDB,
+   0x0000013C, 0x1D8E9521, 0xD3AE4C90, 0x42DC5BBB,
+   0xE2C92A4C, 0x8C96057D, 0x478E934B, 0xEC6155F7,
+   0x0E526187, 0x2BBE77D5, 0x3ACA950D, 0x6E492364,
+   0xE7EDF96A, 0x2FE76745, 0xFC039FD2, 0x53928C27,
+   0x68DFCE96, 0x000000F3,
+   0xB7F3D4B1, 0xB0FECE2B, 0x47B042FB, 0x8B6168AA,
+   0x01658A57, 0x207D9B0F, 0x5CF0BB71, 0x52DEEBF2,
+   0x2FC808A8, 0xC678DCC7, 0x75A39999, 0x8BEA9D09,
+   0x7042C5A7, 0xF26B5D2B, 0xDBE12667, 0x58B1D1BB,
+   0x00000120, 0xD821C3EA, 0x10CF0B69, 0xC684E985,
+   0x045A9342, 0x56BABDCB, 0x2245C17F, 0xB40C5F7D,
+   0x7859852A, 0x35B36FE0, 0xCBC11CAF, 0xDDC4ABE5,
+   0xCBCE03BA, 0x9E11EE36, 0xFA479726, 0x8B993B9A,
+   0xC70CF89A, 0x0000013F,
+   0x6EE24007, 0x731BE59D, 0xB97EFD86, 0xE96884C4,
+   0xCF73D698, 0x9E4A2BBE, 0x2EF12084, 0x7820A2D7,
+   0xC5692055, 0x1EBBF048, 0xC1B300F9, 0x707194DA,
+   0xC0D5DC37, 0xF45FE3FE, 0xDF061C3C, 0x20CB9BF6,
+   0x00000000, 0x49841247, 0xEF76E093, 0x5673EEE7,
+   0x7E963D5C, 0xC5EAB79F, 0x135D2CA7, 0xCEEB60E6,
+   0xF0D3AC04, 0x1D07B5F9, 0xDB33FC36, 0xF1443AE5,
+   0x37EF4405, 0x6EC33BD0, 0xE4716FAE, 0x4FD6F657,
+   0x3A6E33A1, 0x0000003F,
+   0xA3D49D3D, 0x9F88FF35, 0xFCE247F8, 0xE4284139,
+   0xF9DCB985, 0x6C4D5C7A, 0x161D138A, 0xFBCF4FA1,
+   0xA06A95F5, 0x2704EF59, 0x0D0E4D15, 0x2A277E20,
+   0xC5DE8F83, 0x3105F965, 0xEABD284E, 0x10FD313D,
+   0x00000133, 0x0774AB51, 0x308BBDEE, 0x00F231BE,
+   0x3E273E42, 0xF8392927, 0x843C53D8, 0xC0007797,
+   0xBBAE99A3, 0xE1F84317, 0x110B8E4C, 0xE26FC087,
+   0x456790C6, 0xBF6798E3, 0x13144322, 0x217A52CE,
+   0x35D44ED5, 0x00000020,
+   0x5774FC6E, 0xAD24D78C, 0x8DCCC508, 0x0AE7E57B,
+   0xE70F8E39, 0x92D4A44C, 0x837DE2F6, 0x3915C8EB,
+   0x54DD047A, 0xF7FD6888, 0xD1BBD515, 0x13BCAD45,
+   0x302BEE43, 0x86E766A1, 0x0986A53A, 0x788EA08A,
+   0x00000188, 0x716F966C, 0xE0117403, 0x91CBDB03,
+   0xF2FF9109, 0xF6368671, 0xB30A2A3C, 0xADF90B6F,
+   0x29D49766, 0x38D741C7, 0xE7333E23, 0x7E584997,
+   0x11995AE9, 0xBBC84668, 0x0F46AAD3, 0x89992582,
+   0x98AD5A3F, 0x00000197,
+   0x5C1C6DDC, 0x95AECAD6, 0x9AE10BD1, 0xDD32CD74,
+   0xA84C69DF, 0x81882AB6, 0x8838D94F, 0x8A7D8CBE,
+   0xBCC1300B, 0x099AD520, 0xC30E4469, 0xD63BB039,
+   0x17356877, 0xB3BEF314, 0x3238C2D5, 0x48FEA906,
+   0x00000047, 0x8E8FBFBA, 0x772AA8F6, 0x5845A5FF,
+   0xE852C8F1, 0xA907E9D5, 0xF1355EE5, 0x5BA624E3,
+   0x18C0BA0E, 0xB72C700A, 0x32A3B125, 0x6AFD2A5E,
+   0xE4E19FE4, 0x07E95944, 0x08009BD9, 0x19294091,
+   0x14A813F0, 0x00000106,
+   0x96367153, 0x4D829159, 0x10E88061, 0x60562A59,
+   0x942BD412, 0x2B2C480B, 0xEFBBE7B6, 0xC015240F,
+   0xF084FBA3, 0x363DDB1D, 0xD1C2F9EA, 0x21739DFF,
+   0xEFE1AC54, 0xBF972D6F, 0xEDBEF772, 0xDFC5FF12,
+   0x000001E7, 0x39250F37, 0x2F0A919A, 0x11CB4BDD,
+   0xCA4B3F97, 0xC15252C3, 0x85909EBF, 0xF81D74C4,
+   0xEF2421D0, 0xFAA5D679, 0x7F8A45D7, 0xAF2C27AC,
+   0xCC97E0CA, 0xF0393356, 0x11FA8448, 0x091F3A2F,
+   0xD0727C3B, 0x00000098,
+   //Window 85
+   0x81FE2FBD, 0xD17BC059, 0xCDFC711D, 0x8247A0C7,
+   0x63CE74EE, 0x973EAB2F, 0x4191B5F1, 0x270A6BDC,
+   0x637F5917, 0xE21AFB51, 0x50326C7B, 0xA84E71C5,
+   0xF30C35CF, 0x14CEF332, 0xB7407D5E, 0xFF0E5F89,
+   0x00000011, 0xF8B6B176, 0x7B23A55D, 0xC679C536,
+   0xBC660C66, 0x897FDE1A, 0xAD82144A, 0x545BAF12,
+   0x5082037D, 0x4448059F, 0x4BF2B117, 0xF1E8C52D,
+   0x59C25C1B, 0x8E030E69, 0xC01A4B8D, 0x229951C1,
+   0x45077803, 0x00000184,
+   0x4B60E7D4, 0x8EE76FB8, 0x66DF99E4, 0xCDCF2893,
+   0x80648B08, 0xF0A80879, 0xAE3ADE6D, 0x3C499205,
+   0x03D4984A, 0x73D8D035, 0xE21A233C, 0x4FCD2C1C,
+   0xBF51CA1C, 0x0B5C1E89, 0x237792D1, 0x1B7A009F,
+   0x00000116, 0x44961EF0, 0xD2DCA970, 0xA97A7B6A,
+   0xD5A6FBCB, 0x5A4F98C9, 0x5E6DA597, 0xBCA536B6,
+   0x2421C548, 0x1F7EE8A4, 0x7A591AF1, 0x8A8817C3,
+   0x32030881, 0x2AF67257, 0xD98A2178, 0x3828BBDD,
+   0x31FB8F95, 0x000001CB,
+   0xC8856636, 0x92E34BA8, 0x72FBA792, 0x7C3FED1D,
+   0xBE6A4B3C, 0x1B6165C5, 0x6D28920B, 0x2D00EFC1,
+   0x4DD93E8D, 0xEC8ADC9D, 0xAEF2D574, 0x3066D308,
+   0xA82598EE, 0xC860DE4A, 0x7AD8BD69, 0x1B50BD37,
+   0x00000153, 0xB5B8679D, 0x69BD34AF, 0xEAD5BD72,
+   0x1FC682A3, 0x5653A45D, 0xE476BC93, 0x7EA41F0A,
+   0xCCD683F5, 0xFCCEC23D, 0xC0A4A77F, 0x405EAA14,
+   0x928D18A0, 0xDA4A173C, 0xDD427FDE, 0x3703452A,
+   0xA46FC818, 0x000001D2,
+   0x683CE282, 0x69DD6EE8, 0xD644B745, 0xE8446D3C,
+   0x9049B9FE, 0x7738CFA7, 0x8E449ABC, 0xC84EDBAA,
+   0x20BA8D8D, 0x003A5B98, 0xB4967514, 0x4A490725,
+   0xC5E72A76, 0x6A2E96CF, 0x2445FD97, 0xF54E30CB,
+   0x000001B8, 0x5D00E246, 0xC5B7369C, 0xED622D2A,
+   0x9CD08237, 0xEDA55962, 0xA64AE48B, 0xBE8B197F,
+   0x13583919, 0x129FA7C3, 0xADDC927F, 0x397E156B,
+   0x54191F4B, 0x8EDB1CCE, 0x6F0EA7B0, 0x9ADDB3F7,
+   0x5C814220, 0x00000023,
+   0xCAE13D8D, 0x4D2513BF, 0xF266D036, 0x28EF46E8,
+   0x5F762418, 0x9A713878, 0xC09754A8, 0x96C0B179,
+   0x26EA8C9F, 0xA077D4A4, 0xDD557CC4, 0x92B2EC60,
+   0x5FA4D160, 0x4EEF8093, 0xAF5EE34C, 0x44EF893A,
+   0x00000164, 0x5DAA76B4, 0x6CFE0A24, 0x46BE4847,
+   0x9EAC02D0, 0x14779816, 0xC79F950A, 0xD30FA3F8,
+   0x750D55F6, 0xE1ED28FE, 0xC72BE7D6, 0xC91FC0E4,
+   0x107DD9C4, 0xED20D7F9, 0x2487EE09, 0xF35344AA,
+   0x8C07636F, 0x000000B0,
+   0x87CB7C14, 0xBE869855, 0xCE85246B, 0x15616EE6,
+   0xFD42EE43, 0x3CF7F06E, 0x32D3A12E, 0xF8D3672F,
+   0xA3B50D4D, 0x332029E0, 0x4B5EB81E, 0xAEDE54A1,
+   0x2244CA17, 0xEE3DCCD0, 0xF90392DD, 0x2D805525,
+   0x000001F2, 0xE316E059, 0x82A7F544, 0x8E019117,
+   0xC6273DDF, 0x7F5720FA, 0x43529423, 0x03A150C7,
+   0xE0970C39, 0x21023415, 0xED65A8A0, 0x61EF72CB,
+   0xD73597A4, 0xB6FFE468, 0x35AAE325, 0x6A73E8F2,
+   0x474ADA84, 0x0000004B,
+   0x3C21843B, 0x7935F247, 0x9813E479, 0xB657FBBC,
+   0xE56E9357, 0x963035DA, 0x1ADAD7EC, 0xBA552325,
+   0xE0D96590, 0x530B6935, 0xD0B8F665, 0xED0650CE,
+   0xFC766699, 0x7B8F88C0, 0xC9B6C92D, 0x3D34094F,
+   0x000000D2, 0x76E5A786, 0xE7CCE7A6, 0xD3DDCDF3,
+   0xF6C639A7, 0x2C806685, 0xDB5D2A86, 0x63CED6DD,
+   0xC6C1D555, 0xD835F530, 0xCC0A8D3C, 0xA2D27261,
+   0xF7BE37FF, 0x35DA9E0D, 0xE1207531, 0xBEEA6AF0,
+   0xCB491F20, 0x0000006C,
+   0x64CBDEF3, 0x2F97D9BE, 0x035805BB, 0xDB014C24,
+   0x0EAA0F05, 0xDA56447C, 0x87AB765C, 0x6282362D,
+   0x4A7CB936, 0xE1572F13, 0x5A69A68A, 0x6CBEE6BA,
+   0xD5297AED, 0x982709A6, 0xCCFC7076, 0xBB388821,
+   0x0000015D, 0x14C61123, 0xEB7C190A, 0xD67C82B6,
+   0x6352C151, 0xEDCFC589, 0xE94AC8A2, 0x27D1ABDE,
+   0xF4AD07E9, 0x4946EFAE, 0x56DD2650, 0x208AD7B8,
+   0x180E5C7B, 0x935F83EA, 0xD15CB3FC, 0x4C6C746E,
+   0xF529E4E6, 0x00000105,
+   //Window 86
+   0x796DE182, 0x9A579DEE, 0xF6FD67C5, 0x6F780AA7,
+   0x6C566337, 0x8E2E0D6D, 0xE5314714, 0xD8D685B5,
+   0x8099F308, 0xBC0BCB3A, 0x585CE610, 0x7127691F,
+   0xFE15ED8A, 0xB1DD4F51, 0x217BD3C7, 0xAB542E06,
+   0x00000183, 0x5F29DBD2, 0x67E18983, 0x74D67113,
+   0xF0092C9F, 0x847DC935, 0x3FAA747C, 0x7F5BE1B1,
+   0x798604F2, 0x8C76C26A, 0xF766DB9A, 0x5C205CA3,
+   0xA38D86F0, 0x8C6E65AD, 0xFEC09777, 0x156B3B92,
+   0x1C2B356C, 0x000000D1,
+   0x974D9B78, 0xDFB64F02, 0x41CCE8D3, 0x31F9A91B,
+   0x4999E143, 0x34DCB6E3, 0x739197EE, 0x01D57CA3,
+   0x78B9F00A, 0xC0F2108C, 0x4A735404, 0xADC6692C,
+   0x3BCC3B72, 0x8358671E, 0x6F09F3C5, 0x3FC1EA7D,
+   0x000000E7, 0xE86D270C, 0x9C983854, 0xAE44B27E,
+   0x4D51AA04, 0xD49C136C, 0xFF192DB6, 0xE0F2963C,
+   0x8B4EB830, 0x894608A5, 0x839723CC, 0xFD6315EC,
+   0x39DF449C, 0xF69010DB, 0xA65F47EF, 0x94F69BAC,
+   0xDF702036, 0x0000017C,
+   0x91BF9E59, 0x5E6DAEB4, 0x28978A08, 0x9DC3D789,
+   0x3CF5AB93, 0x8BA21379, 0x9F7F32D8, 0x13E05A84,
+   0x24D864CD, 0xCA46A51D, 0x58F27AB1, 0x49DA1D09,
+   0x1DD5BB6B, 0x3D44AC19, 0x960BA63F, 0x14EB042F,
+   0x00000031, 0x857451B4, 0x8C9A73C4, 0x29E1992E,
+   0x61A5F60D, 0x1AFF692D, 0x6B6CD67B, 0xB835AFC3,
+   0x3B702F11, 0xBFC9D3C0, 0x4270A9BA, 0xCA0C7CC0,
+   0x68C63F32, 0x6EA38E95, 0x841CF282, 0x0D60D28A,
+   0x85C69BAF, 0x000001EE,
+   0xA3D933EC, 0x360E5A48, 0xF7BBEA20, 0x0AB120BD,
+   0xDB780CDC, 0x30B58F9A, 0x95285853, 0x30736D95,
+   0x1B3839DE, 0xD52795FB, 0xF74F223A, 0x61ABB62E,
+   0x31F8EC5C, 0x7134F16B, 0x9BECED0D, 0x71608945,
+   0x000000A1, 0x8D5E323D, 0xE346FC2D, 0xAE6C4AA1,
+   0x56AA6EF5, 0x130796EE, 0xDEA1E40D, 0xD71960E8,
+   0x7685EFDC, 0x1040E1BB, 0x07E19BB5, 0x4709427D,
+   0xB89E54E6, 0xAB677CCF, 0xB09E9978, 0xE4E79E41,
+   0xD155E8CA, 0x0000017F,
+   0x8D7A1A55, 0x70F293F7, 0x8DBD1BCB, 0x6D47AE69,
+   0x2A482890, 0xD972CE7E, 0xAE414647, 0x565B5A69,
+   0xFAC08052, 0x1FF7F1F4, 0xA6B8EA59, 0x6AC7E4F7,
+   0x4C758546, 0xB00046D5, 0x78C94B54, 0x57FDA892,
+   0x000001EF, 0xAB9B1FD8, 0xC89C53D4, 0x1939D37F,
+   0x120412C0, 0x178A657D, 0xACF8AB74, 0x6277E2F9,
+   0xF02FF62E, 0xDEF2648F, 0x6D388ADA, 0xD18D7EC9,
+   0x0A21D194, 0x620AF185, 0x28A91FB9, 0xCB7EBF4B,
+   0x9A4BE9C4, 0x00000025,
+   0x21E2E26E, 0x185CB8E7, 0xF82C3492, 0x1866DBBF,
+   0x13FE27AB, 0x5A5E2A89, 0xBA74BC51, 0x2A97A225,
+   0x754D7055, 0x9699342B, 0x2395566F, 0x11CBB11A,
+   0x98DED0A3, 0x7A1A2E8D, 0x79B54681, 0x17986E23,
+   0x00000003, 0xDA8C44D5, 0x646F4099, 0x451EEAEA,
+   0xB738986D, 0x7A3B8625, 0x09DBB26B, 0xDB3935BD,
+   0x5B427F68, 0xA7131AE5, 0xD946C20D, 0x8A745C0D,
+   0xAE04CA91, 0x3F2341A6, 0xA1B0EF3A, 0xD6C790E1,
+   0x7B87FE01, 0x00000098,
+   0x04035FBC, 0x23686702, 0xA09FFD39, 0x494B7BD0,
+   0xD3D1A346, 0x24D81683, 0xA15611ED, 0xD8717302,
+   0x235FBE70, 0x67D48150, 0x92733E93, 0x7056885B,
+   0x149E63C7, 0x7088DD8D, 0x9FA2B660, 0x9D1FA18C,
+   0x00000093, 0xAB42E341, 0x05CCC95B, 0x8D84B663,
+   0xF8DDAE59, 0x710E5D05, 0xECBABDFF, 0xE7D83FA7,
+   0x6BF408EF, 0xCC612F03, 0x01E9FBA9, 0x4B68351F,
+   0xB11B149A, 0xC441FDC5, 0x2EB12CB1, 0x3F1779F2,
+   0x1C5AA707, 0x00000079,
+   0x490FCB56, 0x6261F11A, 0x2166A7FC, 0x80E1E5B9,
+   0x410CA8F1, 0x2156E7B7, 0xCF083D43, 0x6BA2949D,
+   0x85F7A658, 0x6F8C280E, 0xC5362A6F, 0x86921A03,
+   0xA82059EC, 0x212C2960, 0x5535B1FB, 0xCD6E8BF6,
+   0x0000003E, 0x4FA231D9, 0xDE0DEBF9, 0xBB251008,
+   0x3891EE50, 0x1D3CF2F7, 0x4F2E882B, 0xA441EA5E,
+   0x55AE8AB4, 0x97F3D7D0, 0x1A2FD896, 0x240F6844,
+   0xADDCEBB8, 0x7C1AE8A1, 0x00C9E36A, 0xB8C7C299,
+   0x017A9763, 0x000000BB,
+   //Window 87
+   0x35210DF1, 0x1E2DF236, 0x9AACE566, 0x387B5C56,
+   0xEE401323, 0xDD8152C9, 0x9CAC0076, 0x56FE9EC9,
+   0xE1A9F782, 0x88ED7FC1, 0x681F0428, 0x6551487D,
+   0x97689006, 0xEAACC101, 0x3B7E7FE6, 0x626BCAD1,
+   0x0000015E, 0x7ACB23CA, 0xE1B3574A, 0x3636A1C2,
+   0xADDA7C9E, 0x9F3D947C, 0xFC998CF8, 0x1BA0511B,
+   0x38EE4DF4, 0x03E4694B, 0x1F40CC14, 0x800FB6D9,
+   0xCCECF4E0, 0xE1665D06, 0x021F708A, 0xC492D329,
+   0x2BCD7975, 0x00000063,
+   0xAE0F18F7, 0xC7DDD089, 0x2D964B17, 0x95EAB6D8,
+   0xB46505F3, 0x009F85D7, 0xA9A1C11A, 0xB67945A0,
+   0x1BBBC573, 0xD9FF1202, 0xB7362ADA, 0x6BD2CCC2,
+   0x01DD0F97, 0x4CCE7E08, 0x07812CB0, 0x561695F0,
+   0x0000006F, 0xF3215E8A, 0xA077FDA2, 0x500D446B,
+   0x6AF16D30, 0xC74FCC40, 0xA41A906F, 0x522A4CF3,
+   0x4134CE42, 0xA915D9FF, 0xBC3D327C, 0xCEEA5A67,
+   0xB337C069, 0x18026771, 0x887DB117, 0x8BEBAC88,
+   0x5CF16393, 0x00000172,
+   0x6978F0DB, 0x5F68A1AC, 0x005885E7, 0xB3329BA5,
+   0x5DEDCA85, 0xD266D61D, 0x36D128CC, 0x51FCCA0B,
+   0xC3025CAD, 0x8BEE0599, 0x78E1C6B3, 0x0D3AA61C,
+   0x3FAB73E4, 0xE030DAEB, 0x2FA127E7, 0xDC536F28,
+   0x0000016A, 0x4549F784, 0x803482FC, 0x741BD062,
+   0x0D6EC627, 0x5A834635, 0xA16F16F8, 0xC99B1275,
+   0x59E41E2A, 0x252F28F5, 0x9B758008, 0xD3B85B44,
+   0x26784958, 0x740E330F, 0xD1BF7AEB, 0x62CE2EC0,
+   0x438AD021, 0x000001B4,
+   0x968B2D8F, 0x687BBDFD, 0x08974650, 0x1D287808,
+   0x5C7B12CB, 0xBC35D66E, 0x81E92ABE, 0x0CA1ACB1,
+   0xADFEB821, 0x0086135D, 0x0EBEF769, 0xE0E0E15B,
+   0x86A2ADCC, 0x9E38C067, 0xA2CCD0EB, 0x8DA847D1,
+   0x0000016E, 0x07F500C3, 0xF1951534, 0x80A5D232,
+   0x73384195, 0xF6C3D6D7, 0x71E668C1, 0x315DCA1F,
+   0x8C3510E7, 0xBC78C67D, 0xE2E86FE8, 0x98E98452,
+   0x690CDF9E, 0x8D2345B3, 0x8FE94C96, 0xC152008C,
+   0xACA25C4D, 0x000000F3,
+   0x0009BCB3, 0xB3BC6052, 0x4D132953, 0x8F2841D7,
+   0x9BC2071D, 0x41B18307, 0x9EEFFC0D, 0x6DE32A61,
+   0xF6258572, 0xD16B0C86, 0x9DC1BB50, 0x50EA76A3,
+   0xEBCAB743, 0x3E33DF99, 0x9A2108BD, 0xD5732B6B,
+   0x0000004A, 0x0C863D23, 0xA81C904F, 0xBE97CB6D,
+   0x6F6A54E5, 0x35F8A8F9, 0x69F4C822, 0xE5A76F62,
+   0x8F1A0AE4, 0xDF72F008, 0xB4FC5C69, 0x8DE7170C,
+   0x0AFF97F0, 0xD6809BDC, 0xC66E24EF, 0x69F09E52,
+   0xF69634E0, 0x0000019A,
+   0xBFDC59EE, 0x2A28A131, 0x7DC5E016, 0xF6807215,
+   0xDE1C8334, 0xA9259436, 0xE29F6E41, 0x42992F1D,
+   0xC65B5CB4, 0x97E431F2, 0xC3826F03, 0x833AB1AE,
+   0xEC4E2982, 0x2832BE35, 0x077C72E2, 0xB4D321F5,
+   0x0000002E, 0x35FAD0E5, 0xFEE0A81C, 0x2CDA00F5,
+   0x57809E77, 0x5D66AC96, 0x876378FE, 0xF772A965,
+   0x576AC520, 0xE82DEB0A, 0x582AFDDF, 0x8C178781,
+   0xDBFCFCA6, 0xC3D3A4F6, 0x9942A3CF, 0x38697B0E,
+   0xB09D1505, 0x0000016E,
+   0x3E6B433F, 0xF327CE24, 0xF975CAA0, 0xCFCD5229,
+   0x6BC491D4, 0xB302B4A3, 0xA9A67752, 0x00C81DA9,
+   0xA6EA2ED6, 0xE806C66D, 0xB48A62C6, 0xE36659CD,
+   0xD632F848, 0x0AC9994C, 0x7EB6F4EF, 0x61545A1B,
+   0x00000073, 0x978961F1, 0xEDAF476C, 0x303987F5,
+   0xA304CF86, 0x88944AD6, 0x41E098CF, 0xC8D574BF,
+   0xBDB71BFB, 0x61BF991A, 0xA7AB0146, 0x244930D5,
+   0x15C0243D, 0x458429A7, 0xD5760047, 0xA041EB75,
+   0x2A014407, 0x000000B1,
+   0x357C5F82, 0xED2E611F, 0xEC201B42, 0x4CE09707,
+   0xA0193F95, 0xEF11F1DB, 0x8FAF2BEB, 0xE0E7FC77,
+   0x36E14D0F, 0x4E5710BD, 0xA32ADEE9, 0xCDC2650E,
+   0x3CBE7785, 0x5A6C6BA9, 0xA9DEBF8C, 0xA2EA1512,
+   0x000001A6, 0x298CA459, 0x1867B652, 0x33835415,
+   0xA977FB58, 0x4D04BFB2, 0xAE725C6B, 0x34CA55D9,
+   0x8FDD6042, 0xAC28E60F, 0x3C0F9214, 0x14F6483A,
+   0x717A2418, 0x6DB52622, 0x93EA1DAC, 0x3534A876,
+   0xB93AC450, 0x00000144,
+   //Window 88
+   0x0261ADA4, 0x674E392F, 0x5BB103A8, 0x5AF762F5,
+   0xC9E8BF69, 0x281AD6A5, 0x5C57AF63, 0xA88AD2E4,
+   0x3B909CE5, 0x7FBCE1F2, 0x4A8C86DA, 0x37883DA8,
+   0x8FC8357A, 0x94F7C570, 0xC7C21EA8, 0xA1F2FB59,
+   0x000001AC, 0x1CBA57C5, 0x30C79E7B, 0x6062FA39,
+   0xF71D84BE, 0xE2B9C131, 0x8FB70B03, 0xCD862B12,
+   0xBB0F27E7, 0x4FFD6A0A, 0x2FEA1087, 0x2A7A7B08,
+   0x17787158, 0x8653CE49, 0xF79606CC, 0x629A5FF9,
+   0x9514C960, 0x000001A0,
+   0xE5375E53, 0x238D0F45, 0x60B1447C, 0xB576C6CA,
+   0x62216556, 0xA3A372A6, 0x8649C9D5, 0xA36F6C4A,
+   0xAB50C2CB, 0x00E80B35, 0x2556C5A2, 0x11E5520E,
+   0xD3AA02DF, 0xAC58D6F1, 0x8B95FDDF, 0xD56BF822,
+   0x00000094, 0x2A513CC5, 0xD172331A, 0x5EF6A6BA,
+   0x35EEE697, 0xB0ACDC95, 0x4F02B17F, 0x1EB68058,
+   0x07EC621E, 0xDAC73D4C, 0xF266346C, 0xECAB7DDA,
+   0xBE978E8A, 0x968C2EB6, 0xDA0244E8, 0xCEE91ED9,
+   0x50B38345, 0x0000014B,
+   0x1D6F6E88, 0x2AF67B2B, 0x58551562, 0x02B012D3,
+   0xCAFA5D8A, 0x6B82B1FE, 0xE6FEFE9B, 0x7F82B4E2,
+   0xE6B8BBDC, 0xAC91D292, 0xAEB0467D, 0x1E330708,
+   0xD2226EC1, 0xE5723339, 0x11CE4198, 0xDCB1DFC4,
+   0x0000017C, 0xA74E39FB, 0x4C55853A, 0x3E55ADD6,
+   0xDEADB934, 0x4D9052CE, 0xBB7F6B23, 0x2F3E7BAD,
+   0xC3959003, 0xAD990758, 0x78636279, 0x34BCB90B,
+   0xC476679E, 0xF9FE3F2A, 0x9AB2BADC, 0x1B69EF65,
+   0x414A32C0, 0x000000C1,
+   0xE2CCE69E, 0x422833D5, 0x69FF8B37, 0x3C1C8BDB,
+   0xC9FB427F, 0x44D41DFB, 0xC54A1824, 0x15BEE2DD,
+   0xE8CE4AEE, 0x9C804025, 0x9E5665B2, 0x5BCC7E5D,
+   0x40B6270D, 0xF38636A0, 0x60B6778E, 0x84CADA1A,
+   0x0000014B, 0x9B47CCBB, 0x28B4411B, 0x6C368197,
+   0xE4BC1E91, 0x2562C900, 0xC0F36E6B, 0x88C55430,
+   0xC60D5628, 0xFB81C20F, 0x2E9613DF, 0x56872B5C,
+   0xFDD934ED, 0x187BBDDD, 0x6BACD3AD, 0xD1E42D9B,
+   0xF6F821D7, 0x0000012E,
+   0x472A1C76, 0x9C427EFD, 0x2BB334B6, 0xBB1ABFF2,
+   0x8050C592, 0xEC7C1146, 0x51C77DFF, 0x3795AB58,
+   0xD0A8565A, 0x403FA93C, 0x8560A630, 0x7EA1B2CA,
+   0xD92FF341, 0x644B40BF, 0x25F2CBBA, 0xB83C8B3E,
+   0x00000178, 0x355D1A67, 0xE46C901A, 0x077D71CC,
+   0x0C8AAB17, 0x04F187A4, 0x7D045733, 0xBD2DEF81,
+   0x3849DE53, 0xB334041B, 0xB0B7DD7B, 0x245DF6E6,
+   0xB05F3B1D, 0x3433E78C, 0x561B16A9, 0x995C0111,
+   0x25E1F0A1, 0x000001B1,
+   0xFF3579CE, 0x354D7D39, 0x687273DC, 0xD61A6C33,
+   0x0BF66EA7, 0x8E79F8BA, 0xC532810F, 0x0914B68C,
+   0x19D74CD1, 0x86A1F3BE, 0xEA1DE01A, 0xF663A8D2,
+   0xF989647A, 0xE890D4E8, 0x4C3460F6, 0x1C31BDC5,
+   0x000000ED, 0x4D05C7C2, 0xC48F0B65, 0x87586519,
+   0x10F08306, 0xB0B0B6ED, 0x3A28A202, 0xA5655D5D,
+   0xA1EBB5B9, 0x05790E30, 0xBF19A5AB, 0x7D237AD6,
+   0x1E4AD7B1, 0xA98C9125, 0x829AE2DA, 0x544704B3,
+   0x5406F57A, 0x00000099,
+   0x82808E09, 0xE05AD502, 0x01E4F0B6, 0x7B5DC160,
+   0x33A6EEA2, 0x78D1CA19, 0x509CB3CA, 0x9AF18043,
+   0xFF953005, 0x1E796CE5, 0xA26B33F2, 0xCAC11CAD,
+   0x7D84E525, 0xFB9DB0D6, 0x8BB37875, 0x1B66890A,
+   0x000000AD, 0x75D780EF, 0x7BDCA423, 0xD16D7858,
+   0x0AF21A0B, 0xCF42AEE6, 0xB56371F7, 0x14BC7AE3,
+   0x0ED25422, 0x8C5DE97E, 0xAFAFD894, 0xBB065E75,
+   0x340A2C54, 0x861C19D2, 0x4ADB4195, 0xA914DC62,
+   0x98C390DB, 0x0000001F,
+   0x67A1352D, 0xE769D8F7, 0xE9856974, 0x49B1D2C3,
+   0x86E54AFE, 0x9C15A1FC, 0xB0E5B119, 0x2D2C7E68,
+   0x432CF4A2, 0x3556AC15, 0xF39D2D76, 0xE25EBE20,
+   0x51E8C89E, 0x048843AE, 0x02531BE3, 0xCE4822E8,
+   0x0000004D, 0xC947B6D7, 0x4992A988, 0xEB717C00,
+   0x7EB5FE67, 0xE33B7F1F, 0xD4F2215B, 0xA4511D0A,
+   0x32B9FCC2, 0x4D1089C0, 0x4884419D, 0x3DEAD6F2,
+   0xD7457E3E, 0xC66123F8, 0xF12C9F16, 0xA2831727,
+   0x2FF7BCCD, 0x00000025,
+   //Window 89
+   0xEA2E4075, 0x58E8CA2C, 0xF271D545, 0x5307BA37,
+   0x7AE7AD07, 0x14DE3B6E, 0x169EFEB3, 0x6BF3DAC6,
+   0xF0996AC4, 0x7BE665B6, 0x60A81EA5, 0x3CBD0766,
+   0xB0876044, 0x93369D84, 0x8A489412, 0x33CD68DC,
+   0x00000133, 0xDCA5B802, 0x44912D16, 0x808DB8C1,
+   0x3C30F445, 0x4D2B7D5C, 0xD59E9290, 0x2697A600,
+   0xC1E20A6B, 0x3A028772, 0xFBBE023C, 0xC6E3B099,
+   0x8873D0BB, 0x050828AD, 0x5FE76AC9, 0xC0AB0AB0,
+   0xCF2AC286, 0x0000003E,
+   0xA1E93E26, 0x38F34463, 0xA933AD7B, 0x536F9FE3,
+   0xEEAF58FD, 0x49AA8A6C, 0x8548A60B, 0x590A9014,
+   0xC34B6A3E, 0xDA53DFA8, 0x2393CD71, 0x92A83FCD,
+   0x21D4394A, 0x802A7CC9, 0xA00B1E13, 0xC565B327,
+   0x00000036, 0x8143ECFE, 0x155DB782, 0x7DE2CD53,
+   0x17CB85EB, 0xAF4AB2EA, 0x74B165A8, 0xB2D9F719,
+   0x9B27A18B, 0x7F45F2A2, 0xDAE468E1, 0x6F20B170,
+   0x4F0B09ED, 0xAB1E2351, 0x5A15A831, 0x3B7FC656,
+   0x7D64FE68, 0x00000149,
+   0xE4DA7574, 0x457DB9FD, 0x5885E55E, 0x7A0A2897,
+   0xA9B51665, 0x9AB3CD5E, 0xD9477C8E, 0x321E2F08,
+   0xF8F37F58, 0x41E7C2FC, 0xA87D975D, 0xF32D7426,
+   0xCE959A1F, 0xF4BEB557, 0x4DD97BC4, 0x858A6D9D,
+   0x000000A9, 0xE8C2F351, 0x5F10563C, 0x36E2FAC5,
+   0x112B7D63, 0xAA08B49C, 0x32951764, 0x6E6CD71E,
+   0x3E39AA16, 0x7B47C211, 0x63E54AF6, 0xC9ECE8D1,
+   0x8C05ED23, 0x12ED9538, 0xB315B2D3, 0xFC0BCA7D,
+   0x1CFFFB33, 0x00000133,
+   0x19230651, 0x7D1CB4E1, 0x3F601E3B, 0xD2B97137,
+   0x5FD38F46, 0x0B69955D, 0xD816E924, 0xDE4097AD,
+   0xC04A98EA, 0x3A34E753, 0x48839FAA, 0x522AC82A,
+   0x1A571619, 0x9BB3D26E, 0xA1E9BDC7, 0x637F4B56,
+   0x0000018B, 0x45AF1D3B, 0x7156BAA6, 0xB7F8AAF1,
+   0x72FF3815, 0xA19C4F45, 0xAAE7E5AB, 0x9C736939,
+   0xDC47A5D2, 0x77A2B40D, 0x1AC3D442, 0x373A68E1,
+   0xE3EB3CAC, 0xF6AED8C4, 0xD28A0E83, 0x51A2CD35,
+   0x4DD537B0, 0x000000AC,
+   0xBB54E4A4, 0xB71E9DF2, 0x6A2A9ECB, 0x719E8B7E,
+   0xB57129FC, 0x949974C5, 0xE95BB43D, 0x40791DB3,
+   0x8C837114, 0xF7172AC1, 0xB0875175, 0x9C35B2A6,
+   0xAC6CB1A6, 0x4190FB4D, 0xE27A4496, 0xB85A8C2A,
+   0x00000007, 0x3EE3F76C, 0x0BF52A2A, 0xC91B7B0C,
+   0xB4EA53FB, 0x3982DD27, 0xDDB9FB32, 0x564D8104,
+   0x342543F2, 0x48E5D315, 0x4697EE1C, 0xFAB5AAF6,
+   0x21C0DB99, 0x3780A22C, 0xD2D00423, 0x005695E0,
+   0xAF1C84AF, 0x000000FE,
+   0x9B162679, 0x76A8E54B, 0x9A0DB1F3, 0xB30A4E54,
+   0xE5B7D077, 0x6FAD97B5, 0x7747997E, 0x5BB0AE38,
+   0x4F2CD7B1, 0x14999F28, 0xF0893CF6, 0x8DF6E16B,
+   0xF81EA7BB, 0x3F24A3D2, 0xA51263E5, 0x7E272EC4,
+   0x00000072, 0x7D62C5F6, 0x80259F3B, 0x188A2BAF,
+   0xB96E86C6, 0xDFC02EF1, 0x8A52D834, 0x7F2143F9,
+   0x5F8BEE07, 0x99C485EF, 0x6115763F, 0x22BB03B5,
+   0x652E2D7C, 0x940EEC2C, 0xE1215F81, 0x9DBD6EB8,
+   0x75D050D4, 0x000000F8,
+   0xED7F60A6, 0x12B4AB41, 0xB0E733CB, 0x82E070B5,
+   0xA61F7F5E, 0x8615568D, 0xF33C7660, 0x93EEDA4A,
+   0xA9454D5A, 0xC159D74E, 0xE8206045, 0x24D117E5,
+   0x49256D3C, 0xCB137EB2, 0x69E4F9B6, 0xFEFE9F2B,
+   0x00000057, 0x2002F86D, 0xD68D066E, 0xD7036956,
+   0x6298FF43, 0xC281122D, 0x17D720C8, 0x77A4E8DB,
+   0xF78E58C6, 0xFA3CD180, 0x975FD22B, 0x830DCDCE,
+   0x4475849F, 0xC52981B6, 0xE296E0EC, 0x801B656B,
+   0x3316EAFD, 0x000001FB,
+   0x48E2B9C0, 0xA6286426, 0xE84E4678, 0xE154691C,
+   0x877DE67F, 0xF87040EB, 0xF97DB089, 0x1181BC3E,
+   0x974CE68A, 0xB3136FF0, 0x19ACAE0A, 0xF56ED8EC,
+   0x4B96E4B9, 0x48817E3F, 0x8955942D, 0xC3173CAA,
+   0x00000094, 0xE1002024, 0x47B82BFD, 0xEF168C61,
+   0xAC084D4F, 0x8575609A, 0x1DFA9EC3, 0x3783C722,
+   0xF13CC9AA, 0x9C9E4769, 0xC4F9B8D7, 0x5E9B7CCD,
+   0xC3739D0A, 0x7046341C, 0xD71AACF8, 0xF543DDC7,
+   0x03A68FD0, 0x0000019E,
+   //Window 90
+   0xF8ECE594, 0x9DAE6D7A, 0xCCE0B041, 0x7AD12F48,
+   0xE7374970, 0x9D97EFC7, 0x311F5E2E, 0x7B8B1668,
+   0xBB741640, 0x0D68A7B6, 0x9BE65AA4, 0xF9EA3DEA,
+   0xA11C78A5, 0xAA3E6811, 0x0AC6E65E, 0x155AD4E5,
+   0x00000062, 0xFEBBFAD7, 0x5936D4FE, 0xA30ED6C6,
+   0xC94F1262, 0xB2081A7D, 0x6013FAF4, 0x85A4E883,
+   0x684FFDBF, 0x19DBDAD1, 0xAAFF2438, 0x1F91E40F,
+   0x8F348444, 0x1ECEA707, 0x145D06F6, 0xECBADE82,
+   0xEB7A4980, 0x0000004D,
+   0x008164D4, 0xEAA998A0, 0x413F4FF0, 0x15D52DCD,
+   0xE4FF76A9, 0x3B180C19, 0xC30ECBF4, 0x879FDC34,
+   0x518FD432, 0x7EC379CD, 0xE6161641, 0x8A51BB32,
+   0xD582E0E8, 0x92E85885, 0xE00847A0, 0x5503550A,
+   0x0000008F, 0x039B003C, 0xDDF4C5CC, 0xC4814D97,
+   0x0C8D3F93, 0x02075F02, 0x213CA9B5, 0x88920F8E,
+   0x347D87B9, 0x96DBF1B7, 0x96EF11C8, 0xCF927DC6,
+   0xB092BA1C, 0xD068F694, 0x6A12DCC7, 0x16A6E447,
+   0xE98DB68D, 0x000000AE,
+   0xEB78796F, 0x8B335FA8, 0x98C921FE, 0x632A1E35,
+   0x13EBB873, 0x8A81E3DC, 0x392AC9A2, 0x6EA0A1CA,
+   0x7A111FE3, 0x12AC8F7D, 0x1B74982F, 0xE8019E48,
+   0x372BD012, 0x970840AB, 0x8030B6BA, 0xF08F4677,
+   0x00000191, 0xFF6CA70B, 0xF1DAFF85, 0xC4C98B48,
+   0x83A30831, 0x4B44F090, 0xB3D1402F, 0xFFC5FC43,
+   0xEA42A852, 0x5ADB2237, 0x64FB5A0E, 0xEF91D510,
+   0xA3F97D5C, 0xF0D6D405, 0xAA8A0026, 0xFEDCD04A,
+   0xA9DB41BE, 0x00000061,
+   0x26762E69, 0x4ADE586F, 0x5C5452E9, 0xA4D590D7,
+   0xA3D17B63, 0x866D96D7, 0x54373909, 0x4820299B,
+   0x71889F59, 0x9C4970F0, 0xA47395C5, 0xBE409EA4,
+   0x960A0EA2, 0xA1C14B17, 0x307327B7, 0x4A33C8A0,
+   0x00000102, 0x2B54A6C6, 0xE590FE7C, 0xC8F7ED0C,
+   0xB4A1AB5B, 0x0051C927, 0x91F19A29, 0x8EAC2400,
+   0xD9F5D607, 0xF0CF556B, 0x9BC268F6, 0x4112A75F,
+   0x823C7740, 0x7D3647C4, 0x1A816849, 0xB3B45D09,
+   0x46F70E49, 0x00000050,
+   0x47F5FEA0, 0xCD68F149, 0x66AE79B2, 0x0381DA7A,
+   0x18C89E21, 0x59C81325, 0xA0306A1A, 0xD443276D,
+   0x2ED6053C, 0xEDF962A4, 0x174C3750, 0xE081D949,
+   0x8F0944E2, 0x6B2FAB44, 0x71951A0C, 0xC11DC577,
+   0x00000152, 0x802E1A49, 0x18241773, 0x0DE01FE1,
+   0x4BE6EBDC, 0x7A48FA49, 0xEAADFD3C, 0x9405C043,
+   0x5E5F4A47, 0x75485737, 0xBF9FE386, 0xBDDE6D0F,
+   0xBABC982C, 0x5F412FF3, 0x8029E0A9, 0x27F13FFC,
+   0x5BFCB1CE, 0x00000152,
+   0x093A81E5, 0x07E552EA, 0x5FA3B64A, 0xD79A26CF,
+   0x09AC81D0, 0x45E0F420, 0x4D1152A6, 0x599605EB,
+   0xE2910F69, 0xEEC960B5, 0xBF61E7C0, 0x449C49AC,
+   0x7227BC06, 0x867E18BB, 0x1E942370, 0xBFA6129C,
+   0x000001C5, 0x748353E7, 0xDA6A51D1, 0x4893015B,
+   0x05E6051D, 0x6EAA8835, 0x29ED0C62, 0x7B8C9E0C,
+   0xA684E89E, 0x20D8F515, 0xF35134FF, 0x130FE388,
+   0xE12C67CA, 0x60EC122E, 0x2454C354, 0x2C613A67,
+   0x144C6B14, 0x00000021,
+   0xD93C77DA, 0x011D351A, 0x27A91D1E, 0x9E2EA854,
+   0x9BD1EF48, 0x21C49865, 0xC171F355, 0xA570D70C,
+   0x74078260, 0x489DF3AE, 0xF14C50F2, 0x8EA865C9,
+   0xAA42C984, 0x23A1A86B, 0xB104B338, 0x87D78B16,
+   0x00000173, 0xD541016D, 0x504AA27A, 0x49B92139,
+   0x89E60925, 0x12423D00, 0xF1A4EAB3, 0x75FC4690,
+   0x76BD4986, 0x063682A1, 0x3D2A8A56, 0x9ED4E911,
+   0x9C8C7C94, 0x384795B9, 0x156190D5, 0xD7D0F84C,
+   0x0290F60C, 0x000000AD,
+   0x6D526DD9, 0x192D2A43, 0xB75B65E3, 0x48573500,
+   0xE861B88A, 0xAD44CA58, 0x5982D8F0, 0x344950B5,
+   0xAC661A50, 0xF0C11B7C, 0xA1644BB1, 0x0A42C0A1,
+   0x074386C5, 0x706C5C88, 0xAFE0EAE0, 0xE276190D,
+   0x000000C7, 0xCE4F4EFB, 0xA6C2EF02, 0x8A3BA394,
+   0x9ACDB18A, 0x3DEA6660, 0x1B4D4771, 0x6B192C6C,
+   0x4697D9CD, 0x0C33E87E, 0x7F4B0183, 0x3AA2DB69,
+   0x837DA712, 0xE28A7681, 0xC1444E09, 0xB5C3D0E0,
+   0xBA5CB675, 0x00000100,
+   //Window 91
+   0x91609A61, 0x1D40359E, 0x6890616D, 0x9ADF4E08,
+   0x8B14A62E, 0x89DD6635, 0x49ADEB20, 0xFAA34C0A,
+   0x105A9BF0, 0x174689F7, 0xA83A1154, 0xBF727A3D,
+   0x0D6D5D50, 0x4AFE90C1, 0x1F2FE4FF, 0x9954D9D0,
+   0x00000126, 0x5D2AC4B2, 0x027DF255, 0x83078809,
+   0xA61A5557, 0x0237C9BD, 0x6F5D2CD4, 0xCEF7C441,
+   0x7CD9F911, 0xABC19578, 0x0D5256EF, 0xF338DB58,
+   0xD86047AF, 0x14D7C98E, 0xAA2A1B50, 0xF5E65A3A,
+   0xBE9EDFFA, 0x000001BD,
+   0x2648A187, 0xF76D94EA, 0x841945B5, 0x65CD1ED8,
+   0x6D3B41CC, 0xA8B8B52C, 0xC03E31C3, 0x729F4F50,
+   0x4D930A40, 0x2B315B9D, 0x7C78DB5B, 0x32C50364,
+   0xE0CAB657, 0x53B03B69, 0xD343324A, 0x1CB16125,
+   0x0000007A, 0xCBBA148C, 0x0D0CC220, 0x066281E5,
+   0x21E13A15, 0xAE6BB049, 0x304904E6, 0x580464DA,
+   0x9ED34CF1, 0x84A6CDAE, 0xB1C66D46, 0x751E42A6,
+   0x6AD36012, 0xC89EDBBE, 0xFEEED4DC, 0xA31A337D,
+   0xD9897853, 0x00000002,
+   0x97DE0E00, 0xF62C03A3, 0x2611619D, 0xF48D1DE8,
+   0x721BC870, 0x15D1A317, 0x4ED06BF2, 0x6AC60D81,
+   0x890CDBD6, 0xB8BC2CE0, 0x46F4B48F, 0x78108228,
+   0x287C7697, 0x04EF830C, 0xA49838DA, 0x32961E64,
+   0x000000FE, 0xD8551D19, 0x97CD5E96, 0xB2B1FD05,
+   0x68053374, 0xCCF9A8F2, 0xE3013CFC, 0x981FA6C1,
+   0xCEFDD29F, 0x02683FFB, 0xEF3A4BA4, 0x55EDC412,
+   0x2E945F58, 0xBFD433F1, 0xA4A58E25, 0x513F74F4,
+   0x621EF049, 0x00000120,
+   0x0847C82E, 0x16A82634, 0x5F9A9912, 0xB7004254,
+   0x8D0B4DFF, 0x798F9E62, 0x03C638D1, 0x65342A65,
+   0x5C54E53F, 0x4F20EEBE, 0xF840E2CC, 0xC14BBFC9,
+   0xBF5122A8, 0xB7BDAEC4, 0x47B6EE89, 0x36F77704,
+   0x0000014C, 0x452878A4, 0x1A055B39, 0xA4357006,
+   0xEC912E63, 0xFFC61CED, 0xFA8318C8, 0xF05C5661,
+   0x2B0D1441, 0xF197AB70, 0x0B31A6B7, 0x99BC8257,
+   0x69D91F59, 0x6B1FE057, 0x62CE7782, 0x8FBF4A9F,
+   0xCC37B64E, 0x00000160,
+   0x3342C8CF, 0xFA51638C, 0x3860E485, 0x0F68B9AF,
+   0x06CD5F80, 0xEA4D914D, 0x3D548A1A, 0xD5A9B612,
+   0x28C71D7A, 0x19CF1673, 0xE3EA941B, 0xF88496F3,
+   0x4CD8D096, 0xF7458D46, 0xC3A72C66, 0x40A7ECCD,
+   0x0000009E, 0xF067B7EB, 0x017E43B0, 0xAE8610FE,
+   0x0E89BB59, 0xB2BC6765, 0x0C2437F2, 0x49BF2EED,
+   0x58C0A844, 0xC13A6053, 0x723B0A50, 0x1D1B46A0,
+   0x3C2F581A, 0x68E9E875, 0x2A930C3A, 0x59874673,
+   0xF6144DD4, 0x0000013C,
+   0xBA77AE3D, 0xC3561D8A, 0x84E9A9FA, 0x96685448,
+   0xFABB2BC7, 0xD02A219C, 0x19500A0D, 0xF05419FF,
+   0xFD9DB302, 0xDDEC1E04, 0x27BB75E8, 0xE8163EED,
+   0xF55BEDAC, 0x167A448C, 0xCF331BB5, 0x0674936F,
+   0x00000112, 0x05915D9E, 0x6FDD6A8F, 0x6BC230BC,
+   0xD10ABA56, 0x6495B1DE, 0x3D08B2BE, 0x25D490F3,
+   0x1A677D3E, 0xABBB4E9A, 0x5435CABF, 0x9DD066FA,
+   0xB1B88FE0, 0x96AD240C, 0x4143D97F, 0x8105C161,
+   0x84D22C1A, 0x000000BB,
+   0x9B725C0B, 0xE37816DE, 0x166BB8FD, 0xCC2A89C9,
+   0xD89FE85B, 0x49CA0257, 0x9B83FCE1, 0x48FD498A,
+   0x0CF52C0E, 0x6BA52564, 0x28EF21FF, 0x1123FBDE,
+   0x4D0CDEBA, 0x85F8991D, 0x772B53B3, 0xFE5797D8,
+   0x0000007B, 0xDD6B4D3F, 0x3FDF5C44, 0xE2DCD484,
+   0x5321B885, 0xDFB203B2, 0x69CE5C11, 0x6F8935BB,
+   0xE9A48238, 0x75CC99B6, 0x9FCD2C9C, 0xE76DAEC2,
+   0x251AC714, 0x4802F1C5, 0x77261156, 0x5D6E5D84,
+   0xAF4E8D57, 0x00000170,
+   0x95408D0A, 0xC06EB52D, 0xE6CD02BD, 0x617F37AA,
+   0x1493BE3C, 0x605C3D6C, 0xF516ED28, 0x74F50AED,
+   0x120F76FA, 0xE57889AF, 0xA4BBDA56, 0xCAD1CD04,
+   0xFC158650, 0xFD346ECB, 0xAE3C475A, 0xAEE419B5,
+   0x000001FA, 0xEBA5C579, 0x53AB6494, 0x66501244,
+   0x89BAEAA3, 0x0E1DFCD7, 0x76714C0A, 0x05CE3982,
+   0xC31B6AE0, 0x192BFB7E, 0x38742418, 0x9FA107F8,
+   0xB303FDC6, 0x23401680, 0x50F6E467, 0x032DB727,
+   0xED7828E6, 0x000001EA,
+   //Window 92
+   0x75804DA9, 0x2A7E8AC1, 0x8D50BDC6, 0x0B41F611,
+   0xD8FAFB1C, 0xCFA0A757, 0xD231A6B0, 0x75540D94,
+   0x0C4FE03D, 0x524440FB, 0xCE9738DD, 0xB8665FBF,
+   0x8F1BD64F, 0xBB74F6A8, 0xBB8D6C67, 0x063AFA3C,
+   0x00000189, 0xA864385F, 0x259B9DA4, 0x17C2597B,
+   0xDBAFC55C, 0x56BF5D23, 0xDE890ACB, 0xF8455B59,
+   0xE51182C0, 0xC456E1C7, 0x75D51A03, 0xB318E747,
+   0x9C7929C6, 0x39B3ED84, 0xAF23A7F1, 0x910F4AB2,
+   0xEE136A2B, 0x000001AC,
+   0xEF873F3E, 0x5D8C23C4, 0xCE7BAE33, 0x2A29D680,
+   0xBC00FC8E, 0x5109E098, 0x3CFAD961, 0x9BF92EFC,
+   0x62036BCF, 0x272DFA33, 0xC2B13688, 0x5ABB516C,
+   0xDDCB08AB, 0xBFAD4CCC, 0x4F260709, 0x05945B93,
+   0x00000043, 0x08A5F87F, 0x67FE093B, 0x6C6FE1B1,
+   0x5F8E248A, 0xA3B887A2, 0xF54F710B, 0x90F7E972,
+   0x12E1B687, 0x429CD6C6, 0x7002BD70, 0xE896B58B,
+   0x0F010D4A, 0x1A7F5713, 0x44FB054B, 0x65508714,
+   0xB9F30268, 0x00000173,
+   0x9510D278, 0xF41D38D4, 0x2C1AA285, 0xFA2C2B94,
+   0xD512246E, 0xDF7BB55C, 0xCB15D14D, 0x980B046A,
+   0xDBAF8AD4, 0x3FE4F4D4, 0xD3D4F7AC, 0x6CBFCE0E,
+   0xDEBBBC9C, 0x81FF0F46, 0x6F1AADAB, 0x2550BC94,
+   0x000000AC, 0x7488849F, 0x2CC18103, 0xC1DD8868,
+   0x78DD9FB3, 0x37790AF2, 0xB433B8ED, 0x896219FB,
+   0xFF3689C4, 0x0151C7D3, 0x0AAA321E, 0xCDE3D282,
+   0x1F39B461, 0x5BE49EC6, 0x10B3783A, 0x5462C805,
+   0xB8B801D3, 0x0000013A,
+   0x51D8C679, 0x976B0EB7, 0xA55BEB39, 0x5308C32C,
+   0xB935189B, 0x43F46AE2, 0x18420B08, 0xC29299EE,
+   0x94DC4570, 0xFE346CF4, 0x53C6C99E, 0xC6207E3E,
+   0x5D708240, 0x3E202EC2, 0x5D608C48, 0xC790BEC7,
+   0x00000082, 0xDB07B8AC, 0x6F30F944, 0x6C090BC2,
+   0x7B4F2213, 0x2D325DCA, 0xD03A6097, 0x3DAA7EC7,
+   0xD079042D, 0x039AEFCB, 0x959BF843, 0x84ADD69C,
+   0x956DA50C, 0xBA49D06D, 0x2F47DAB7, 0x7F80AC00,
+   0xA57F444F, 0x000000D4,
+   0xED9FF0CC, 0x70476444, 0x4E61E48E, 0x94A26100,
+   0xA4D28FDD, 0x4FBCB840, 0xB68044D4, 0x2631F2F2,
+   0x77DCDCB5, 0x9241BA52, 0xCBE53C16, 0xAC209E88,
+   0x5B57FAC7, 0x40B7FE00, 0x8AEDCD02, 0x4F554E6E,
+   0x00000053, 0xACA8433E, 0xF188F96B, 0xA6EAAF50,
+   0xCACE916C, 0x6CAE425F, 0x9386A1F7, 0xE810FD9F,
+   0x10BB0209, 0x215BE739, 0x56471D16, 0x17E56C71,
+   0xDE76D878, 0x3FE6504F, 0xB2E81960, 0x28C50C66,
+   0x713C17BE, 0x0000009D,
+   0xFE8DF000, 0xB34C3B27, 0x9CDC5700, 0xDF339673,
+   0x11CB9AD2, 0x1BB29F71, 0x7BA7D395, 0x3F6A26AB,
+   0x7849C272, 0x4265DD16, 0x80036C34, 0xAD75E46F,
+   0xAACD57DF, 0x7B68CB30, 0xF34031CA, 0xF9F95028,
+   0x00000157, 0xA535BA39, 0x2483A208, 0x390CD035,
+   0xD2A8C67F, 0x6C091584, 0x6FD00477, 0x5207BC4F,
+   0xD75FEB1A, 0x2D916544, 0xEA0293A2, 0x88105D3E,
+   0x7C8EEFFA, 0x9981E998, 0x292666A9, 0x15E4E8F1,
+   0xD32C0EAC, 0x0000012A,
+   0xDD64B652, 0x6D2F3E9A, 0x733C58C0, 0xC753F944,
+   0x11BF60FC, 0x6C41946E, 0x1C36AEDE, 0xC0280FE5,
+   0x0564AA24, 0x2AD93FFE, 0x4FAAC555, 0x8FC16326,
+   0xEB7CF510, 0x1A6AD7E4, 0x1A12FF2D, 0x539C8383,
+   0x000001E4, 0xA63BFEFE, 0x02A35B2F, 0x39BA1701,
+   0x7062D0C0, 0xA6C0634D, 0x6C34460D, 0xB8A1284E,
+   0x060A3A79, 0x5FAFB702, 0x051C1334, 0x4827D95A,
+   0x65EB00A3, 0xDC2FAA66, 0xD6F1D69E, 0x98D5F264,
+   0xD3BD8217, 0x000000DA,
+   0x33F75B15, 0x4F0B54E9, 0x36FA5B5A, 0xA003B963,
+   0x34EF804E, 0x13636B74, 0x33A8DE33, 0xF4873594,
+   0x68BF741C, 0x6FCB70B9, 0x4011AD6A, 0xF257C303,
+   0x28C9CFC3, 0xD8103CF1, 0xF3C1C78A, 0x40C10CF4,
+   0x0000002A, 0x75E483C8, 0xE595EAA8, 0x45230209,
+   0x6F1F33B1, 0x09E07A8F, 0xCDE65C1E, 0xEE74A952,
+   0xD1DD3121, 0x52243E2E, 0xF7F7CE16, 0x75F7F1E8,
+   0xFD9412A9, 0x21AA60B0, 0x418F8C86, 0xF2A7648B,
+   0x39BA7C05, 0x000000AF,
+   //Window 93
+   0x76BCD267, 0xA8C68B9D, 0x96362C64, 0x95F78CA8,
+   0x03603F09, 0xBB8302F3, 0x272622B9, 0xF15B0D54,
+   0x97692826, 0x4CEBFCD1, 0x19C758FC, 0x4D29D2B1,
+   0xE11AC4FE, 0x4703BB56, 0x36B53BDB, 0x7152ABD5,
+   0x00000060, 0x27BEDE63, 0x68AC9834, 0xE54A999B,
+   0xD5C6C405, 0x231E8EB0, 0x3D763E32, 0x47C7EDB7,
+   0xE36CA2FF, 0x8D2B6016, 0xD9F18505, 0x60D55105,
+   0x4E576EB0, 0x76E3F591, 0xE3E9F249, 0x83EA6A2C,
+   0xD5BF8F00, 0x00000157,
+   0x9278F093, 0x14B97DA0, 0xAAF50774, 0x77B62EB2,
+   0x595788EB, 0xC94C47E5, 0xE78A7ACB, 0x3F6FBF17,
+   0xD648CDAE, 0x8BEAED91, 0xB0281EEA, 0x1402478D,
+   0x057A9CC4, 0x06F48D3E, 0x56F972CF, 0x9A75CB7B,
+   0x0000001F, 0xA7049117, 0x74749B84, 0x275EFA96,
+   0xEE6187DF, 0xA7DAEFB7, 0xC8A4DD7F, 0xF26B4DEE,
+   0xC2A5680F, 0x02C8ED96, 0xE64AE238, 0xC75AB457,
+   0x55D8E7BD, 0x13DAAD11, 0xC29F93F6, 0x10EF96B4,
+   0x7E485B3F, 0x0000001C,
+   0xCDF52775, 0x12DF8924, 0x6E3BC06F, 0xD8974966,
+   0x3E68CF93, 0x7F3310CE, 0x97117FE2, 0x0A012C7F,
+   0xA16ADBB8, 0x65288F5B, 0x92BC7054, 0xB1E26BB8,
+   0x8A63D1C7, 0xA6833AC9, 0x5DE7F156, 0x5F3B945A,
+   0x00000176, 0x0DD3A366, 0xEB895899, 0x958AA6F3,
+   0xEF27B635, 0x1DABEC19, 0x8EF1DF5F, 0x0F53BDD9,
+   0x871FEC8B, 0x9EFE0C6A, 0xFBB413BE, 0xAA16ADD4,
+   0x06E372B6, 0xA945E423, 0xDD08C66F, 0xF3B12FEB,
+   0x66C1B806, 0x00000166,
+   0x51ED20EC, 0x627F65FD, 0x6DEC3A4E, 0x1C31D4A3,
+   0xEA76B32C, 0x8F222EC0, 0xBD5A76A5, 0x890E15C3,
+   0x7A3E2D67, 0x23617469, 0xD8178F45, 0xBED29D6D,
+   0xC90E2DF7, 0xD61F7707, 0x91BE7739, 0x31C286DD,
+   0x0000008F, 0xE3D9F5A5, 0x7EA9AE7C, 0x9DDA23C5,
+   0xCC26143E, 0xFD1EF741, 0xC231022E, 0xDC1FA1DC,
+   0x66E91F63, 0x364D03E9, 0xE831781E, 0x629AF703,
+   0xF2247B2B, 0xAE2B773B, 0x08F7EB82, 0xA0A208B0,
+   0x7C543051, 0x000001D3,
+   0x77331596, 0x7F428DAC, 0xC255949F, 0xBF977F5F,
+   0xC4D98BE0, 0x3DA177D5, 0xA8527C4B, 0x7CB4B3B7,
+   0x8032CA6B, 0x04068390, 0xBB04C171, 0xFAB16224,
+   0x9C5610CB, 0x6660197A, 0x91C7C2FC, 0x8FE2AD30,
+   0x0000018F, 0x1BC9C007, 0xC8DF5498, 0x6AEEB5EC,
+   0x9901A26B, 0x85B8D02B, 0x0C6CD18F, 0x972A7EA2,
+   0xCDDD3B72, 0x8C6FEC2C, 0x60384331, 0x211F8358,
+   0xD4200454, 0xE44CCACB, 0xC7F5670E, 0x97A7417D,
+   0x9FCB7D2D, 0x000000BD,
+   0xFD804EF7, 0xE86339BA, 0x76BBF53F, 0x01673692,
+   0x3918EC65, 0x41236F2E, 0xC14159D2, 0x1043B6B3,
+   0xAB04BB98, 0x732BCB46, 0x30D86216, 0x88D1CB4C,
+   0x85DDD190, 0x3DCA271B, 0x58E758CA, 0x927FBA7B,
+   0x00000182, 0xF46E0E28, 0xCA047C60, 0x92B64674,
+   0x915C93FC, 0x794D425D, 0x8FD233C6, 0x44A3EC1F,
+   0x028132B5, 0x16509EFC, 0x975C8AA8, 0x622584E8,
+   0x041EF627, 0x938C99DF, 0x1989A692, 0xBFBBC611,
+   0x7704D7C7, 0x00000192,
+   0x0AC926C8, 0x1A07BB1C, 0x7CDE114D, 0xDBDAD1E7,
+   0xC1F3A574, 0xD677815B, 0x28DFF5E7, 0x5758E606,
+   0xA7501407, 0x95C76291, 0xDCB4D1F6, 0x5CD2407F,
+   0xB9472593, 0xEB6D28C4, 0x0B6FD187, 0x0092A86B,
+   0x000000FB, 0x791DEC5C, 0x961F53CB, 0x9A8CD9D7,
+   0x77E3A312, 0x75F8FC57, 0xCFC28C07, 0x531E8336,
+   0x748AB16F, 0x05192627, 0x100E37FE, 0xD0292D0C,
+   0x9477FB71, 0x46A38BA8, 0x924C1E05, 0x4543F219,
+   0x2018A9DA, 0x000000C8,
+   0x598D6047, 0xD9D203C4, 0x04351A31, 0xE1356B61,
+   0x58B1E12F, 0x8657A9C4, 0x8ED5AAF3, 0xCC26F637,
+   0x3B6C0450, 0x7272B2E0, 0x212AAA79, 0x2AC17670,
+   0x23E6ACBD, 0x354B3754, 0x2A4F7ADF, 0x22B9DEAE,
+   0x0000005E, 0xB405D02B, 0x20421426, 0x20ED4116,
+   0x62F72A9F, 0x308D525D, 0xB93C24E0, 0xDBC245EC,
+   0x5489564E, 0x3B6D7C99, 0xA904AB8F, 0x99F5D096,
+   0xE4C11C4D, 0x88930DAE, 0x16852205, 0xFAEF9B94,
+   0xC2569FE5, 0x00000079,
+   //Window 94
+   0xA2FDA60F, 0x0079A845, 0xDA8DB63A, 0x6DFDF102,
+   0x0148A559, 0x7D275960, 0x684B9737, 0xE089C346,
+   0x820BDB1C, 0x09F865B2, 0x891AE57E, 0x000DAEF6,
+   0xA4F64F15, 0x384F5EEE, 0x3DA7E79C, 0xDD68E490,
+   0x0000013A, 0x514AC5DB, 0x20B7457D, 0x954721FD,
+   0xA03028FB, 0x5C77CB17, 0x6F20D518, 0xAD74495A,
+   0x28F92697, 0x6B327DC8, 0x630E0156, 0x65832CA9,
+   0x6C5067D6, 0xD3F6DB89, 0x9C9305FB, 0x905FFFDF,
+   0x681013FA, 0x00000188,
+   0x318448E6, 0x7A10BE40, 0xCE412830, 0xA09AB497,
+   0x70D88770, 0xE31C4343, 0xE8D30D6D, 0xA52FBA9F,
+   0x228558D5, 0x121E6D15, 0xFD0D7D5E, 0xD2435C13,
+   0x18AA5676, 0x600DD279, 0xE5179D2A, 0xA6F5C318,
+   0x000001A4, 0x2AD8D75E, 0xE822AF01, 0x858BEFF4,
+   0x30E19389, 0x83D74ABD, 0xF9F942FD, 0x1696C1EA,
+   0xC9219982, 0xC3198D4D, 0xD3153B60, 0xFCBE0073,
+   0xEA6C2263, 0x2E1B79E1, 0x85754D63, 0xC26E0148,
+   0xB1B80018, 0x000001CA,
+   0x8DF57790, 0x128BC3C6, 0xEC53BC56, 0x43C56BC0,
+   0xCAE49EED, 0x7910B88B, 0x18A0D687, 0x3EA6A0DF,
+   0x448F5D7A, 0xB28B1D89, 0x89351D2E, 0x3F03FDD1,
+   0x2C3E495B, 0x139D03DF, 0x6F18F00F, 0x7C088A9A,
+   0x00000173, 0x241D777B, 0x719FC61A, 0x4539225E,
+   0x1F0CE653, 0x7A4FCA8E, 0xEA96D552, 0xF9CFEF0B,
+   0x37858C68, 0x38DD070D, 0x052382D0, 0x12A26448,
+   0xF14D02BF, 0xA98265AE, 0xCAE30526, 0x2B32266A,
+   0xE9694DB2, 0x000000B0,
+   0xDE58C7C3, 0x8D1A5A77, 0x442B5CAF, 0xD0A69124,
+   0x8EC7DC07, 0x941A596A, 0x03F666F4, 0xFA464087,
+   0x2E2444E8, 0x517C887B, 0xCC4FED90, 0x23336FB2,
+   0xF6D6BEDA, 0x42E16757, 0x0334867A, 0x31028CFC,
+   0x00000069, 0x28D45D76, 0x23AF4719, 0x3F620742,
+   0x32FBDF65, 0xC8FA6CEB, 0x049C2152, 0xBFBDFB05,
+   0x3ADA0B48, 0x729E6FE5, 0xB8A01F53, 0xFC1183C6,
+   0xC0204462, 0xDDB24298, 0x5F9A9454, 0xDA7DC145,
+   0xCD9A5C6E, 0x00000074,
+   0xCE65E46C, 0x93C72785, 0xD036A395, 0xCC34BAAE,
+   0x1FA7FB90, 0xE51D3BCC, 0xE6A685E0, 0xDD62CC37,
+   0x9D6273D6, 0x440C287D, 0x732E5788, 0x70CBB68F,
+   0xB896A191, 0x1E711346, 0x81E94D1C, 0xA2E89DFD,
+   0x000000F1, 0x6CCCEF65, 0x6F5DCDF4, 0x41CC5953,
+   0x66935F90, 0x9CF67B27, 0xEC2D929D, 0x9D95D373,
+   0xCF8A5AE3, 0xDA0668D9, 0x172B09FD, 0x5DB6710B,
+   0x4C0F3FD4, 0x0FD20F5A, 0x1020ACA4, 0x5E0A0725,
+   0x2A126D10, 0x000001C5,
+   0xF323796B, 0x6021EB67, 0x2AE978FB, 0x2735E2E7,
+   0x243C976C, 0xAB0ACCEA, 0x6DF235CE, 0x37140DD6,
+   0x3BE80263, 0x28530215, 0xB485401B, 0x8DC91DBD,
+   0x0E48B4EF, 0x998C84F8, 0x3CF2FA95, 0x3AF68786,
+   0x000001FA, 0x3B99884B, 0x58A0EED2, 0x4B2F6436,
+   0xE044C643, 0x8BFBB9EF, 0x593D8534, 0xB614C597,
+   0x3390291A, 0x5E2DB165, 0xD45F5990, 0x3225C405,
+   0x34A30DE0, 0xB7154958, 0x398E3201, 0x96521007,
+   0x2A9E7619, 0x000001A2,
+   0xF304C1BC, 0xC7164E8F, 0x97440445, 0x62D38116,
+   0x309BF2EC, 0x594D284F, 0xA1A3F419, 0x39E8CEBC,
+   0x2311A0A4, 0xC19A5451, 0xA3E3FD96, 0x4B6A4C60,
+   0xA28B1F78, 0xA3F92664, 0xA19E6A85, 0x559049A1,
+   0x000000D7, 0x2CDBE432, 0xA97411AE, 0x1F727B22,
+   0xBBA9055C, 0x7F0DA2DB, 0xF881F788, 0xD88AAEF9,
+   0xDBABEDA7, 0x340D85A3, 0x3123E4A8, 0xB30E7BC7,
+   0x415251C4, 0x9CB7D2C7, 0xB62437CB, 0xA8F314B9,
+   0x6394C0E2, 0x000000EC,
+   0x6B34F3DD, 0xDE37A92E, 0xE31DFA1C, 0x951E43F2,
+   0x52E2EF0D, 0x58581532, 0x7FEB1898, 0x620012A0,
+   0x67F4CC4F, 0x5A17627D, 0x07D8033A, 0x2132318F,
+   0x0B5EC702, 0xF0493935, 0xF8BAA44F, 0xD9F309AC,
+   0x000001A7, 0x8526C18F, 0x45585A80, 0x22628089,
+   0xE9AF2127, 0xF40B3255, 0x075752D8, 0xAC0F8F9E,
+   0x02C07AB8, 0x29D778F5, 0x72ED381F, 0x3B1A48A8,
+   0xE2C67B7B, 0xC0CC19BB, 0x983E3CA1, 0x7415AF20,
+   0x038048AE, 0x00000050,
+   //Window 95
+   0xEFBF6B21, 0x18CAFF50, 0x51F2BA1D, 0x0EEB65EC,
+   0x296C458B, 0x2CD8A43F, 0x9747CEAB, 0x04D795B2,
+   0xDC306C57, 0x52B0BCA6, 0x17EC9C28, 0x39FE8AD5,
+   0x81A0CB57, 0xA4A9E3FB, 0xA638D6F5, 0xDD6933A9,
+   0x0000017D, 0xD39AC021, 0x9893EB50, 0x39BD296B,
+   0x3BF70873, 0x792DEC05, 0xA10440A7, 0xA67AD18F,
+   0x96BE97E7, 0x17AE5F6D, 0xCF2175AE, 0x0B6F0503,
+   0x70FBB8BF, 0xF7A755AD, 0xBB565FAD, 0x93CCFD37,
+   0x8904F9A0, 0x000000F8,
+   0x2CFF741F, 0xF669C458, 0xCB12D0F3, 0x558296D0,
+   0x70BE227A, 0x4CA064D7, 0xCF89F9F2, 0x02B8D5CA,
+   0x8F1E5A13, 0xB4E06660, 0x9C08B765, 0xA030D85A,
+   0x922E04E8, 0xDFEB77D6, 0x9603967A, 0x65930C72,
+   0x0000015D, 0x4FF2E952, 0x70CDEAFF, 0x8B6332A9,
+   0xBAA81BA8, 0x798836FD, 0xE573D5B4, 0x605C5ECC,
+   0x5B68B878, 0x47BC37EB, 0x3F0A6ABD, 0xDFA7F440,
+   0x823A54E1, 0x5C500937, 0x2FC0AA7A, 0x35953C9B,
+   0xB97B588C, 0x000001AB,
+   0x2FD93AD6, 0x39A64D5D, 0x2637E7F1, 0x667FF12D,
+   0x5151441B, 0xED31162E, 0x8277E2BB, 0x9ABDF916,
+   0xEC0A5F93, 0x1B7630F0, 0x5B002930, 0x89A828CC,
+   0xB246BEFA, 0x912428AD, 0x765DBFE1, 0x632B0787,
+   0x0000018D, 0x6693BAFA, 0xEBF44BA8, 0x8A12BB84,
+   0x3AD44731, 0x5D02D2FD, 0xC0E12ABB, 0x9AC44290,
+   0xCCDCBC00, 0xEA70A61B, 0xFCC3F910, 0x7DBBD680,
+   0xCAED5619, 0x2D159763, 0xECA08D0B, 0x6D9DC6DB,
+   0x4F51A9AF, 0x00000095,
+   0x4DD2D2D3, 0xF0B9EDE3, 0x8C4D1CEE, 0xB0607939,
+   0x0611DF8F, 0x1CA4EC57, 0x53B914D6, 0x7F32D197,
+   0xDFA4DF49, 0x99B6F882, 0xB265F518, 0xFBE161CF,
+   0x40C76BBC, 0xC6DB288E, 0x281437B1, 0xC8970E3F,
+   0x00000139, 0x1A18DB0A, 0x9D76D4A5, 0x238445C6,
+   0x59E76809, 0x6A48DEAE, 0xA0F52E64, 0x338904D4,
+   0x3692A8A8, 0xBA28D02A, 0x3FE48D48, 0xB958B23D,
+   0x9F2130AA, 0xCF8CD8E9, 0x210A547E, 0x5179029A,
+   0x46E7623E, 0x000000BC,
+   0x852CD09D, 0xC988F588, 0xAF218601, 0x67D21418,
+   0x0C10A857, 0xDA5F50EC, 0x0E2B2960, 0x504418A3,
+   0xF4038971, 0x9F44EA6B, 0x2E458D2D, 0x6B5D406A,
+   0x801E5FA5, 0xFC240795, 0xF7584734, 0x0356185C,
+   0x00000102, 0x77A57D4F, 0x7A948FD1, 0x2FBB8782,
+   0x5DE3AFBA, 0xBCFFC674, 0x1AE44706, 0x563F5C74,
+   0xB97083B5, 0x5466EBD5, 0xA9185057, 0xEA623A4B,
+   0xF9C3A26C, 0x94105039, 0xC9175519, 0x819C3CDA,
+   0xA570C1C1, 0x00000075,
+   0xA3ACDB65, 0x3C3814B8, 0x3AC121C9, 0x42CEA868,
+   0x554EDBD9, 0x95CCDCA1, 0xBADD4E7A, 0xC8127847,
+   0xC95FE784, 0x8249A372, 0x20661224, 0x1E5998D5,
+   0x15019264, 0xF88A1A08, 0x619DE345, 0x501BA0A9,
+   0x000000BB, 0xDABD6ECC, 0x27BCE70E, 0x41144962,
+   0xBDBF47AD, 0x302C2F1F, 0x949D92FD, 0xDAC7D399,
+   0x7EE6077E, 0x70CBD239, 0x4B1CA3AB, 0x9C08640C,
+   0xBE03CF16, 0xE90BB15C, 0x67D91DDA, 0x3584FE3F,
+   0x989110BF, 0x00000033,
+   0xF7A4D317, 0xA58E52D8, 0xDC6F7AEC, 0xAF23BF92,
+   0x1C520880, 0x70121C82, 0x7BC182B5, 0xF68499F3,
+   0xB02B3E34, 0x0EDC4E6F, 0xE425564D, 0x4378BADC,
+   0xE75EB0BC, 0x3B74B05F, 0x599D4D45, 0x5A234BAE,
+   0x0000011B, 0x91572EFB, 0x3094E3C0, 0x6F509233,
+   0xC370662F, 0xBEB6AF1E, 0xC741EF37, 0x5BF3BBD6,
+   0x5E1D6265, 0x1029591D, 0x39044BC6, 0x7C1724F3,
+   0x05FF006B, 0xA492BB41, 0xDE62A8FC, 0xD3F4A832,
+   0x9682C9EB, 0x00000159,
+   0x9D702E02, 0xBC3F4C47, 0x86C216D1, 0x6A06F96D,
+   0x8C2DC6F3, 0x9469CEF2, 0xC98D9271, 0x753D64D2,
+   0x051508C9, 0x7C7EC13B, 0x95FD48E2, 0x7B94098D,
+   0x6BB4F8D3, 0x72435800, 0x88EEE18A, 0x01D3F3D1,
+   0x00000039, 0x1A6A057D, 0x764BAACF, 0xF7326213,
+   0x7D880282, 0x43D2615B, 0x37C23940, 0x6EEF57DE,
+   0x7E09836A, 0xD790BBF6, 0x3F7E265C, 0x49A4F757,
+   0x10025E45, 0xDCB5B373, 0x515D51BB, 0xF534F5FB,
+   0x05699BE5, 0x0000005E,
+   //Window 96
+   0x0BCF3B88, 0x442EBF30, 0xDC5BFD2B, 0x4B863857,
+   0xC50960C2, 0x632A1056, 0xC9D74020, 0xDBF49444,
+   0x78287D19, 0x335F464B, 0x5C490A63, 0x0CF8D5C7,
+   0xD7D2D2C6, 0x4F9D9BD7, 0xAD52D8A9, 0x1490FB61,
+   0x000000EB, 0x34A088DB, 0x42AABE74, 0x9E5B69EE,
+   0x871248C8, 0x55A87EDB, 0x7D624D6E, 0xBAEE4473,
+   0x81BC0BCF, 0x9559A1B0, 0xF450C5AD, 0xDF4C738C,
+   0xA604379C, 0x10EC0574, 0x36B304E2, 0x8D8CF3D9,
+   0x948A50D3, 0x0000018E,
+   0x58FEAF6B, 0x005D8EA9, 0xF524807D, 0x9D2B24C0,
+   0x21D9535D, 0x96AF717B, 0x4FBD0106, 0x5F9A6F42,
+   0xBA7D83DC, 0xA9DAC62A, 0x62347736, 0xE2E5FF33,
+   0xB6605428, 0x1621A6D5, 0xBC4BB252, 0xFC96AE5E,
+   0x0000019B, 0x21D079D5, 0x878EE5E4, 0x2C46177F,
+   0x40395449, 0x183F779D, 0x334B26FA, 0xCA226599,
+   0x8C07F237, 0x018C83CE, 0xE079FD96, 0x664AB781,
+   0x62391DF0, 0x0B9565EC, 0xC3D390E3, 0x8698FF98,
+   0x98227C5B, 0x000001BB,
+   0x0CC43FA1, 0x07AF0A7A, 0xAC346374, 0x577DCC1C,
+   0xDC46A3EF, 0x0430BA5A, 0x51D77F50, 0x19623A33,
+   0xC47EC055, 0xBB69E56E, 0x367B694A, 0xADDDDE29,
+   0x7334CDC3, 0xBCC27634, 0xB6DBBDAF, 0x3605A214,
+   0x0000008C, 0x333A23D4, 0xB9E26813, 0x9DFD1C2E,
+   0xB4084043, 0x5948F69C, 0xB26958AA, 0x836B04E9,
+   0x4E0E41CE, 0xAD2F0F9C, 0xE8781517, 0xF398EADE,
+   0x44411CEB, 0x7CCA9C3D, 0xE0394B52, 0x184812F2,
+   0x3692BB42, 0x000001A5,
+   0x9B5E849C, 0x96D64AF4, 0x7D8BC95A, 0xF994BF47,
+   0x437F36AE, 0x75A4E5C0, 0x7C7BCEC9, 0xEE75C710,
+   0x437C8987, 0x40F1BEBC, 0xDB220F60, 0xEA8288DC,
+   0x1353D1D9, 0xF9C197BA, 0x196C5B7E, 0x8128EC86,
+   0x000001AE, 0xF41CCE83, 0x608268BD, 0x49DBD8B9,
+   0xB061D942, 0x846039D6, 0x71A2710A, 0x972580E9,
+   0xE2F432B4, 0x9BE7C986, 0x34F1A711, 0xC02E5EDE,
+   0xEADEF54D, 0x8E9FCB26, 0xE215A5E8, 0x1D8C7C29,
+   0x9A2A4F76, 0x000001B4,
+   0xB1A91A30, 0x8DADD3B9, 0xFDC8080D, 0x7C1A7B2B,
+   0x97ADD67B, 0x636EC725, 0xB848586D, 0x55EF3346,
+   0x9FAB4DEB, 0xA2DDA1DB, 0xD7F05281, 0xF5902CA6,
+   0xC49D12E7, 0xB3B1C011, 0x62710C83, 0x8667F018,
+   0x000000F9, 0xFEBB932B, 0x793CB015, 0x4ADC729D,
+   0x728C1C98, 0x8065526C, 0x7CD28441, 0xA3DF7B43,
+   0x8F505CED, 0xE9E7C0A4, 0x5CA31F3A, 0xA1F2A5FF,
+   0x41DE8FB6, 0x8E9682CF, 0xA325B26B, 0x34072ADC,
+   0x76A2C09C, 0x0000002A,
+   0xE3309DCA, 0x208A4D40, 0xED752B10, 0xD720DDC2,
+   0xF4A522A0, 0x05ECCAB3, 0x0B0F5D2E, 0x190C361F,
+   0xF944922B, 0x7B545BCA, 0x14B46CCD, 0x76065137,
+   0x05F8ED90, 0x9AC90BFC, 0xE01262AA, 0xD9662699,
+   0x00000031, 0x5971B0FD, 0x2B52F35E, 0xC785889C,
+   0x9608EC0A, 0x3F63BA6D, 0x0700B1CE, 0x4D414971,
+   0xFA7CBE2F, 0xAAC0489B, 0x34432D63, 0x15159B56,
+   0x3A0E756B, 0xEE06AF09, 0xCFA5E9E5, 0xBDC35E7A,
+   0xF7868A00, 0x000000D4,
+   0xE7577C4F, 0xE1BDBA76, 0x1AEC855B, 0x7C7A2BD0,
+   0x9D94D7EE, 0xBBE20929, 0xD2163FD3, 0x03514926,
+   0x25D05B98, 0x20F57050, 0x5B533C7D, 0x4D6EDD51,
+   0x4C5B6D3B, 0x95F75C80, 0x6240AB73, 0xCB1E542B,
+   0x000000BF, 0x6E47C22C, 0xC325DA07, 0x85C3CC06,
+   0x128F86A3, 0x1024230B, 0xAD3E1512, 0xF83654A7,
+   0x15EDB6AA, 0x07C699D4, 0x889E3063, 0x0D1796CA,
+   0x5D8A38B5, 0x768889CA, 0xAD38A634, 0x730723F7,
+   0x61416EA7, 0x000001DA,
+   0x4DD5FA13, 0x6090AF09, 0x45FCC533, 0x2692662F,
+   0x996EB47D, 0xD5A50950, 0x4E05F928, 0x282AA07E,
+   0x8AC85517, 0xA36C3746, 0x3EFD2216, 0xD1E15CFC,
+   0x41919F55, 0x60BE70D6, 0x6718805E, 0x87B39740,
+   0x0000002E, 0x2E5DE3D8, 0xF82842B2, 0xB94E5442,
+   0x0C5EC9F1, 0xF1564D79, 0x3C540E54, 0x96AD7E49,
+   0x5925A290, 0x6F3549E7, 0x20B0D262, 0x918852E3,
+   0xCB5F02E2, 0x86223552, 0x5DEADE8F, 0x6F078DC9,
+   0xB82D0490, 0x0000005E,
+   //Window 97
+   0x74BA879A, 0x51318AC9, 0xA68B584C, 0x23723B6D,
+   0x02AC441E, 0xA7872BF0, 0x65C7B9F4, 0x1E0C8FD6,
+   0xB893449D, 0xE8E3BC24, 0xF06E02A6, 0x2E83C6B8,
+   0x78D50EF5, 0xBA754C01, 0x2C547C38, 0x7C6C06EF,
+   0x00000132, 0x6DEE6431, 0xABBFE426, 0x12FD88EA,
+   0x2D51AAC6, 0x1C83591E, 0xC6F21525, 0x9EE42180,
+   0x85C550E5, 0xA8CD1C50, 0xE1A4297D, 0xB55723CF,
+   0x28F07CF6, 0x4113977B, 0xBEDE788E, 0xBEDAEEAB,
+   0x8C7572FC, 0x000001AB,
+   0x2B1148CC, 0x32C0CF8F, 0xC2086AA9, 0x881D8C7C,
+   0x7C9FD47B, 0x6B25DAF5, 0xCD5EC48B, 0xBFBB7226,
+   0x9F2307BA, 0xF2B79DEB, 0x5FCFB278, 0x03D30DE5,
+   0x71EF137B, 0x4B2D3A46, 0xCAD4495C, 0x4E4A24B1,
+   0x00000173, 0x1ECFC10C, 0x36316047, 0x75C27AAD,
+   0x8A4AC3BD, 0xCA6F6103, 0x6FD1ABEF, 0xB741C7CC,
+   0x6AB15369, 0x86719621, 0xDB25D3CD, 0xEE85249B,
+   0xE0D34A98, 0x370EFC6A, 0x25BEECEA, 0xA2CEFBF6,
+   0x7D8A2FFC, 0x00000057,
+   0x504F8B28, 0xE929B729, 0xB887EF71, 0xE706657C,
+   0x0B83DB33, 0xB4BD5CDA, 0xE761913C, 0x465187F0,
+   0x040B98AF, 0xBD632BD6, 0x91C37379, 0xD82BF2AF,
+   0x5380AEC9, 0xCC1058B1, 0xC506F0BD, 0x243967A1,
+   0x000000D1, 0x87D73C34, 0xB2984426, 0x46CBE44A,
+   0x5FFA94EA, 0x20DDB255, 0x5814A34F, 0x89B68F69,
+   0x8EA54368, 0xD26B66C6, 0xE21603B0, 0x320B6862,
+   0x4695DFF2, 0x42D53E67, 0xA5D53327, 0xA5931FD7,
+   0xF17DF48A, 0x000001BB,
+   0x8D00DA24, 0x1B50FA62, 0x0A0590BC, 0x98C7AC50,
+   0x6C101946, 0xC33C9F7F, 0x0C4EAF7D, 0x653848C3,
+   0xDC892656, 0x7AB38C79, 0x420316CE, 0x2CE0AE53,
+   0x7012D563, 0x9DF9A008, 0x6D51BD57, 0x130CD565,
+   0x000000B7, 0x78FFE5EF, 0x21A2C950, 0x7B991B38,
+   0xBC330A09, 0x2D4A375B, 0xC5151E1B, 0x80C0F67A,
+   0x70A29D10, 0x2247B284, 0x2E75A55F, 0x58F332F1,
+   0xC95A6380, 0xA8FE1CC9, 0x0D7A5242, 0xA712A8CE,
+   0xC0B1176C, 0x00000035,
+   0xC9BBD131, 0x679BDF48, 0x2A51D8EB, 0xDBB2843C,
+   0xF24F8538, 0x1BD3B522, 0x194A77AF, 0xD94EF0E0,
+   0x4CDCA642, 0x01940A3F, 0x85E88692, 0xA4BD46BF,
+   0x7C3EBAB6, 0x35F15B55, 0x9B15FBC4, 0xF9CA4DD9,
+   0x00000073, 0x87B3FB49, 0x05AAFD41, 0x01CC6409,
+   0x365D712B, 0x4E12C979, 0x208968C3, 0x33E64621,
+   0x3728B80E, 0xE80B58CD, 0xE30FDD56, 0x4FEC8836,
+   0x384AA6D1, 0xAE461678, 0xC24EFEB1, 0x4A64F28A,
+   0xEA7BBBAE, 0x00000139,
+   0x74443123, 0x1809B1B2, 0xA61477DD, 0xB3AF06F6,
+   0xB6D81198, 0xCEAC98C2, 0xE603FEBB, 0x06DEE82E,
+   0xBD75245E, 0xD6D647DC, 0xFA90D977, 0xF84D8DAA,
+   0xE563BD93, 0x25FC59DA, 0x7136202D, 0xDE02D705,
+   0x00000139, 0xE3F1C7BA, 0x563A9DE3, 0x869C65CF,
+   0x82CC084F, 0xC128C5C2, 0xC4422C0C, 0x8B151834,
+   0x77198BF2, 0xFB44CEAC, 0xAEBCD566, 0x4A48B704,
+   0xD5D14DC2, 0x96F68B39, 0x9037F90E, 0x2139ABD1,
+   0x1FD62056, 0x0000017B,
+   0xFC270282, 0x11C68D32, 0xCBB9ADCE, 0xE86C1869,
+   0x8EC3E7B2, 0x5D19FD45, 0x14E0C42E, 0xA97924C9,
+   0xE614F642, 0xCB26D9F5, 0xF4E9664F, 0xE0281148,
+   0xA8323FD4, 0x1A1FF74B, 0xF1FF01B9, 0x17D81B37,
+   0x00000060, 0x6D49AD5B, 0x7A7AA719, 0xCF6CBDF1,
+   0xEBD73076, 0x9A9A30C0, 0xE01E29E0, 0x3D96FE1A,
+   0xEFABAFE9, 0xBC1A8C20, 0x875902D2, 0x017444FD,
+   0x45842F5E, 0xFDBB0C23, 0x734DC417, 0x49FB63C0,
+   0xB8624F52, 0x000001BA,
+   0xFA285859, 0x3B8065E5, 0x017A52E5, 0x9DABD85A,
+   0x615B37D2, 0x7C1C2DAD, 0xA4197F77, 0x180420DE,
+   0x4B42B112, 0x87C7C86C, 0xAA6A7A6D, 0x1CD544C9,
+   0xEA61DD31, 0xE1FC2FAA, 0xEDE66B85, 0x990E475F,
+   0x000001F4, 0x667C5DB8, 0x5157EC25, 0xC5B2EF31,
+   0x85746DA2, 0x85160D33, 0x68C9C60A, 0xACFE5C9F,
+   0x877FCDD5, 0x3801DB0F, 0x275952D9, 0x9D529708,
+   0xB5A2A4D2, 0x22CA71CA, 0x871C8D0C, 0x91DA21D7,
+   0x06C61F4C, 0x00000008,
+   //Window 98
+   0xA308E123, 0x5663F565, 0x157C2290, 0x91A48983,
+   0xC054408A, 0x222F7F93, 0xB839A520, 0xD8694963,
+   0xD314DA50, 0x864B491D, 0xD675CC09, 0xA315D96E,
+   0x390531B6, 0x32964930, 0x21E11F6E, 0x93876719,
+   0x000001D0, 0x0C3477FA, 0x20F4598E, 0xCCF7F114,
+   0x14C758B4, 0x051B875E, 0x0C83F642, 0x1B290E7D,
+   0x14AB1B50, 0xF1B18FA8, 0x99F812C7, 0x88CA8E75,
+   0xAA60F399, 0xB9C6C5F7, 0x00DE2BD0, 0x28703A2A,
+   0x765DA973, 0x00000015,
+   0xEE2F1290, 0x06BA35C1, 0xD403D1E7, 0xEC34093F,
+   0xA659075E, 0xC1B8ED8F, 0xBFE99020, 0xEA322AD8,
+   0xD5148B86, 0x3B7A95D8, 0xC2CD9ADE, 0x979D99BE,
+   0x85DBA94C, 0x89A6A552, 0xE090E6A7, 0xA5B7E51B,
+   0x00000120, 0xAF82552A, 0x033B73CE, 0x5CA604C1,
+   0x8C98E0B5, 0x533ADDF7, 0x177A92E5, 0xED1AD360,
+   0x6EAB8277, 0xBFB8E3E1, 0x05937E24, 0xD061128A,
+   0x4193E5CF, 0xFC1326FC, 0x4F781B5D, 0x9D0056BF,
+   0x74403EB1, 0x000001F1,
+   0xDF3566EC, 0xE7718E9B, 0xD1D77E5E, 0x2ACD4C45,
+   0xD9787985, 0xC78694AD, 0xF645C923, 0xC7C600C5,
+   0xC393F54B, 0xCD1E697A, 0x20054D6E, 0x7928ED5B,
+   0x3CAFEABF, 0xD3C839E0, 0xC46A4425, 0xBFAAFDCE,
+   0x00000196, 0xE1804D34, 0x6BAEECA1, 0x70AA5E48,
+   0x6996DB6C, 0xB9577C2E, 0x24E11983, 0x04335832,
+   0x3966F9A1, 0x50889C2A, 0x5654CBDD, 0x32DF0DEA,
+   0xEE86177F, 0xF8D76ECF, 0x7E9C591D, 0xDDBAC362,
+   0x57DE93BF, 0x00000022,
+   0x07D2778E, 0xEB525FBB, 0xC965143E, 0x4CD96634,
+   0x742E1FCB, 0xB2EA802D, 0x75BC3CD4, 0xA2F1EC4C,
+   0x125EBAF8, 0xE778F1E1, 0x650B81EB, 0xC700E4E4,
+   0x9C841F1B, 0x66D593A5, 0x8D2984C9, 0x4DA41757,
+   0x000000A1, 0x57D4A16E, 0x6E9ED77D, 0x1C1696AE,
+   0xEFB8F94C, 0x8ACBC2A6, 0xF2961D2C, 0xE1D5DE1F,
+   0x8FC9352D, 0xA7B8579C, 0x786158D1, 0xFDCBAC8A,
+   0x3AB33268, 0xD583ED20, 0xF237B433, 0xE4C10D57,
+   0x3EDCC184, 0x000000CD,
+   0x7C9BEAC4, 0x67F5679C, 0x6230B567, 0x985A7833,
+   0x064E4738, 0xA250D8DE, 0xB564700E, 0xB8BFBDD3,
+   0x2E14AD7D, 0x087BF9E8, 0xA0317FAF, 0x4CF9220A,
+   0xB05BC341, 0x6614AE6E, 0x9E41105F, 0x1DEFF5D5,
+   0x000000FE, 0x03966619, 0x8B47D53A, 0xBFF94109,
+   0x72D5B26C, 0x10B76762, 0xDFC37D15, 0x64B09F94,
+   0x669E7156, 0xD3FB006B, 0x16E999E2, 0x6AA4487F,
+   0x3E5AA52B, 0x33C1350A, 0x8BFD7F55, 0x4E72EA36,
+   0x68FF6CD4, 0x00000161,
+   0xFC0F4A8B, 0x9B7D1F3B, 0x5CCB978B, 0x7A8F0B0F,
+   0xD3415AE8, 0x00D61C73, 0xC6AEDE9D, 0xF46D7B22,
+   0x14822DF1, 0x1FC29371, 0x5F740F97, 0xE3E1D467,
+   0xB9159596, 0x3A7E3BA3, 0x03B5EC47, 0xF99CA1A8,
+   0x00000029, 0xBB5CCD4E, 0x04243BDF, 0x8802BD75,
+   0x055A49F7, 0x306EA61E, 0x51F2D40A, 0xDA558BDC,
+   0xA70666EC, 0x3E523A23, 0x92AE69D1, 0xC4EF7644,
+   0x98055B32, 0x0E228566, 0x3748D45E, 0x70BAE7D8,
+   0x9C4991A1, 0x00000106,
+   0xFE207454, 0x143510E9, 0xBBF845F0, 0xB0FD9824,
+   0xE8BF1A9E, 0x39C13279, 0x0FECA613, 0x75FA89A1,
+   0x825A3DD7, 0x2C66A7EB, 0xB26368AE, 0x9C2B32C8,
+   0xF619A005, 0xF92E1AAA, 0xAACCFCA3, 0x4DE668FD,
+   0x0000012B, 0x45CFCF06, 0xA92801B4, 0xF74D70DD,
+   0xFBD77F9C, 0x6340644D, 0x1E47198C, 0x6B4DAE22,
+   0xFFBA0B1F, 0xC7B899DF, 0xE48CB9BB, 0xC71B8B4A,
+   0xA2F0ECE2, 0x2A173EBE, 0x5D9815E6, 0x0E9906DA,
+   0xB9B11BC5, 0x0000011A,
+   0xB0D0888A, 0x592528BC, 0xCABDE573, 0x32B7CA4D,
+   0x404F7268, 0xA25E1B62, 0x16381BF7, 0xA3DA442D,
+   0x5D6ACDC7, 0x62CAEAAF, 0x7E764A4F, 0xC9F64CD3,
+   0x4E48F5CD, 0x297687A8, 0x5E2D02A9, 0xB315F234,
+   0x00000012, 0x20ACAEBC, 0x4F91C005, 0xDB8CBFE4,
+   0x61CE683C, 0x55EE34CE, 0x22A4EFD5, 0x64516080,
+   0xF8D7D3CA, 0x27AF0007, 0x38D087A0, 0xE0DE0EF0,
+   0xDDA0DFB2, 0xF4C91376, 0x7E0601F0, 0x2EBD6270,
+   0x23D16E10, 0x00000141,
+   //Window 99
+   0x5A53C22B, 0x1BD8CE7B, 0x7CAB446A, 0x78733FCD,
+   0x48ACB394, 0xC44CA4E2, 0xA38C790F, 0xA9888B1E,
+   0x15C34237, 0x36AFB6EB, 0xFB702063, 0xB913B8A8,
+   0x917508FA, 0x34B77CC5, 0xF9E4732B, 0xA931D7A7,
+   0x00000050, 0x56D21D18, 0xA90A4290, 0x55B410A1,
+   0x82666307, 0x894A6B05, 0xB4684A8B, 0x828CF75C,
+   0x8A1ADE63, 0x127702A3, 0x4FB2F85A, 0xADF7B709,
+   0x83FF7D05, 0xA68D1DB6, 0x1D3F5A92, 0xC093CD5C,
+   0x243CE1DB, 0x000000F5,
+   0xC1F9124F, 0xF77AFC9E, 0x5D958392, 0x010AF17A,
+   0xEEB66CB6, 0xA9AA7D55, 0x816DEA76, 0xB41570CA,
+   0xA983B39C, 0xB2138D58, 0xCD6CBAA5, 0x0FD404CF,
+   0x40C224CC, 0x29C1F2FD, 0x99C23815, 0x1E263CAB,
+   0x000000E0, 0x7649D2FF, 0x371CD093, 0x02038FF9,
+   0x7C79D3CC, 0x5CA5E1B9, 0xEF326185, 0xE02C0478,
+   0x1BEB030B, 0xF859FD4A, 0x134D0C94, 0xEE41B919,
+   0xA767FAA5, 0xD5D9E3C5, 0x8D957AAC, 0x191FCA35,
+   0x4B1C1DEB, 0x00000175,
+   0x690C9C13, 0x91B8719F, 0x6D91DE54, 0x1932A953,
+   0xCACBDC0E, 0xA4B86387, 0x8BAF648F, 0x706CA7DD,
+   0x819C8BBA, 0xBE6702B5, 0x006BE63E, 0xD8E503A8,
+   0x2DFAEE90, 0x7CA8DD6A, 0x8DC428B7, 0x15BC698C,
+   0x0000003A, 0x865E5E1B, 0x1FECF27E, 0x56BDA0E8,
+   0x20F26B44, 0x88DCE3FF, 0x274CD07A, 0xDC3EDDA0,
+   0x89B8BFDD, 0x22CF062D, 0xADC93A6E, 0xF57D091D,
+   0x2092780F, 0xB799B1AE, 0xC7D33C53, 0xD6272724,
+   0x803E54D7, 0x000001E2,
+   0x638F4BF3, 0xEDC83F7D, 0x76E89AE1, 0xA14F5465,
+   0xCC6EF43E, 0x38C36854, 0x94C010C2, 0xD26DE664,
+   0xB8403839, 0x79410987, 0x1B6E018B, 0x3119056E,
+   0xE195E68F, 0xFC6CEBFD, 0x2EE4BC5B, 0x23FF26C7,
+   0x000000EB, 0xBB1A38ED, 0xFE4D342C, 0x3F7C3D26,
+   0xDC6B99B8, 0xBB6301BF, 0xEBA992E8, 0x8D9B6AA8,
+   0xDA145FDF, 0x99A9D166, 0x568ECE4D, 0x07CB01EF,
+   0xFE783E6F, 0xBA0F3663, 0x3156339C, 0x092139DA,
+   0x909FA7E5, 0x000001FB,
+   0xA6B7273A, 0x132BBC26, 0x474A253C, 0xCF61C187,
+   0x28FA498C, 0xD585FB0E, 0xC16BD41D, 0xF0FBCB10,
+   0x7799A48F, 0xB9E4985C, 0xCD6F7AE9, 0x6A3B3C2A,
+   0xD836427A, 0xC222E36D, 0x2F00213E, 0xD4538A0C,
+   0x00000014, 0x0C9471C2, 0x60616F1F, 0x96A7A73C,
+   0x444401B0, 0x52E7491F, 0x0D0D81D2, 0x0E90BDAD,
+   0x0187C2BE, 0xAA941EF0, 0x84A0B409, 0x69915089,
+   0xBDA20A57, 0x1E71A5DF, 0xB5FA8BE8, 0xE763A843,
+   0x2BF3042E, 0x000000BE,
+   0x34EBF7AD, 0x7AF8E1F4, 0xA4D427DB, 0x6CBEB971,
+   0x1CE006AC, 0xEB0CDEB4, 0x2BEFEF71, 0xAD09E2C3,
+   0x1C7602F6, 0xBAACC71D, 0xB63E4D9E, 0xF147ECCA,
+   0x907C7AC9, 0x64B59D3E, 0xA9A2C34E, 0x05981898,
+   0x00000050, 0x7467E7C2, 0x980BEACE, 0x970341D0,
+   0xD2AE8C4F, 0x5184213F, 0x0880DDE9, 0x3463CF73,
+   0x94BD710C, 0xE15B70E9, 0x4D49D328, 0xEB357560,
+   0x8EBADAEB, 0x7E8C60C6, 0x763AD6C0, 0xF22707A7,
+   0xFA0C3F47, 0x0000017C,
+   0xCA85BD53, 0x3151003B, 0x88BC7B2E, 0x654B9304,
+   0x1EAB1C79, 0x63F6B743, 0x77C5862E, 0x301DD16A,
+   0xE8578BB6, 0x39107905, 0xF5F255D3, 0x48CEB8D5,
+   0xF8A85253, 0x05EDCDAC, 0x8DBF333E, 0xD803A809,
+   0x000001C2, 0x08035533, 0x23036EBB, 0x7496D042,
+   0x0811521C, 0x348739DF, 0x8F001571, 0x733A0E5C,
+   0xA1E70BC9, 0x2749D9A4, 0xCBD72613, 0xBBBF0566,
+   0xF9B28C13, 0xF848D39F, 0x0224F0E8, 0x16E65861,
+   0xE85C8014, 0x0000006D,
+   0xDC90D667, 0xDA48F1C4, 0xB0CE40AC, 0xD8C35A3F,
+   0x0600DFCB, 0xAFDAB1B7, 0xB7BC8531, 0x3F37FE8B,
+   0xB44A5E7E, 0xFE921F70, 0xCA51866F, 0xF79DD8A4,
+   0xC43B4FA8, 0xFD8995F9, 0x81DDB91A, 0x54508FA6,
+   0x000000D7, 0xE0ACB157, 0x99621E3B, 0xBFD8E94D,
+   0xC9103EB2, 0x069B8D34, 0xDEA2BB5F, 0xA496B9D9,
+   0x25DF19F0, 0x8D49CB34, 0x5229DDFD, 0x1215DACC,
+   0xE9075834, 0x73A800D8, 0x3F8FC88C, 0xBDFCE376,
+   0xB36A97F0, 0x00000128,
+   //Window 100
+   0x90185363, 0xF5C1A4C6, 0x20C04ED5, 0x15F58FD9,
+   0xE913A1B2, 0xA7B46E0C, 0x36F1D8C5, 0x1E7167C6,
+   0xBF5FCFB1, 0xF4FE6BFE, 0xA6C2027B, 0xC46FAF10,
+   0x4E1F12F4, 0x45D59300, 0x12185485, 0x46BCC873,
+   0x000000CA, 0x6432C12B, 0x7C518071, 0x90AE7556,
+   0xB7E004AD, 0xD8532693, 0xDF847160, 0xA18B3802,
+   0x4D8C7B8A, 0x96872AF8, 0x90E25045, 0xAECB6FAD,
+   0xE69D4894, 0x17D0FE85, 0x6DDAA06C, 0x340C3528,
+   0x49F1A466, 0x000000D9,
+   0x58B77137, 0x68F4A4E0, 0xF12F5BBF, 0xD8A34E67,
+   0x1E0619C2, 0x1781240F, 0x498328BD, 0x44495373,
+   0x545B7D41, 0x98E9F61A, 0x602A0C48, 0x767DB401,
+   0x806301DE, 0xE138E5E8, 0x4B21AA89, 0x65A3883B,
+   0x0000012D, 0x0423FE94, 0x647B0078, 0xFD276310,
+   0x424F483F, 0xD6A06303, 0xACA222FB, 0xFFA52C17,
+   0x47162ACB, 0x9DE267FE, 0x7AE0C501, 0x667A30C8,
+   0x998DC9BB, 0xAF48C727, 0x988CF192, 0xDFA23A3F,
+   0x0A270986, 0x000001FC,
+   0x9C1D86CC, 0xA5FC51EF, 0x0B3FAAD3, 0x66A9B898,
+   0x21D124ED, 0x96C73C25, 0x050626CE, 0x392440DB,
+   0x50A4A12A, 0x02BFB1AC, 0x1742DDDD, 0xC70A3074,
+   0x47FE811D, 0xF1F9DAA6, 0xFB3CE6CC, 0xD4BAA6B1,
+   0x0000016E, 0x09D96CE7, 0x09042D75, 0x3315F77A,
+   0x4C92CE69, 0xA9C0D9F6, 0x4992B1F9, 0xD18EC980,
+   0x7C0FFBAC, 0xA008AB38, 0x53D205DC, 0xC908481D,
+   0xF0A098F7, 0x0BA397BE, 0x2BFFD363, 0x49003F86,
+   0xCA36E99F, 0x000000A2,
+   0x20F12986, 0x284E98F3, 0x749EA8D5, 0x3112BF24,
+   0x2782914D, 0x5FC7A2C4, 0xD94786AF, 0xB2F7C229,
+   0xC7158280, 0x4B17BCAE, 0xE6189A46, 0xA139D563,
+   0x83CC9173, 0x9C72E9C5, 0xBE56B6A8, 0x5CD5A6A0,
+   0x000001A5, 0x235A8051, 0x51F0E802, 0xC4C5FB7C,
+   0x153DC987, 0x9868A706, 0xB549E9C7, 0x9BDF5C1F,
+   0x71739008, 0xCCBEC99B, 0x0D04F60C, 0x7F4BD294,
+   0xDE66C961, 0x51156724, 0xA787D95E, 0xAE12B9B3,
+   0x7CE4B4A5, 0x00000091,
+   0x0356EF50, 0x0CE0F89F, 0x37F24A9A, 0xD8CDF51E,
+   0xD237FD55, 0xD0720E9B, 0xAEB71292, 0x20B75973,
+   0xE42B2758, 0x0D6EFB23, 0x8721AECA, 0x0FCBDD56,
+   0x0FDA8AE5, 0x11658CE9, 0x700782D9, 0x23A4D576,
+   0x000001AC, 0x903BB623, 0x77FC6F2F, 0x5B2A0237,
+   0x36710BA7, 0xD55A12F4, 0x4EA518D1, 0x4C95DEE0,
+   0x0C0509E1, 0x4BF6C59F, 0x67E24078, 0xC925E26F,
+   0xA9BD12B5, 0x8FABDBA8, 0x5865B6C3, 0x33B34605,
+   0xC6E3433B, 0x00000101,
+   0xDA309336, 0x548235D6, 0xD0CE4B03, 0xDC058555,
+   0x117D9FB1, 0x8103A260, 0x962FBEAE, 0x7AAC6EA7,
+   0x5F9F7C6F, 0xDF219BC7, 0x39755A22, 0xDB529BD2,
+   0x72676F34, 0x7B68E004, 0xC5011F75, 0x99590CAA,
+   0x00000027, 0x80E9BFE7, 0x8B591DDE, 0x259B4046,
+   0x510DAA29, 0x41CFDBD2, 0xA6F4C61F, 0xF175B862,
+   0x6934A20E, 0x68CD3951, 0x2A732440, 0xD119730A,
+   0xCF3CA559, 0xDF77EBFA, 0xB8AA2298, 0xF78ECE91,
+   0x8B85CD46, 0x0000015C,
+   0x73F397E2, 0x16AAD8D8, 0x40BB988B, 0x8CDA09D4,
+   0xA881CD6D, 0xE351CD2D, 0xC9A6FD41, 0xB92FDDA9,
+   0x3932267A, 0x2298EFAD, 0xA099BB25, 0x76546625,
+   0x58230B71, 0xDC48A348, 0xC6ED085B, 0xD98ECACC,
+   0x00000107, 0xDC95F5D1, 0xE3BD2DE5, 0x2E2C2366,
+   0xB890DA1F, 0xC4F26CC0, 0x7C6226A1, 0x00356C62,
+   0xFC1F77BF, 0xD87EE6F9, 0x0C8E11F7, 0x0AF9A4A1,
+   0x84CC68AA, 0xCE01EA76, 0x70EB714A, 0x6ECDBDC4,
+   0xDC9E3C69, 0x000001FA,
+   0x48D5F1FB, 0x01FD929D, 0x724AD844, 0x5FB11462,
+   0x707ACE9E, 0x29442573, 0xDEF7DBD1, 0x38B790BC,
+   0xD77C1C89, 0xB33EEF7D, 0xF8B1403C, 0x952246E9,
+   0xE78D9EFE, 0x11AB7EC0, 0x02C22634, 0x538AF4C7,
+   0x000000AA, 0x04C6EB59, 0x3827660D, 0x3CD9597B,
+   0x62A02DE8, 0x46ECE58B, 0x57FA76F2, 0x3C21145E,
+   0x03B9FB53, 0xFA60662D, 0x9E04EC45, 0x944A4A44,
+   0xC28CC184, 0x41FF380B, 0xF26C1DF3, 0x13C7F613,
+   0x6D48B57C, 0x000000D1,
+   //Window 101
+   0xE2ECA03C, 0xFED9B067, 0xEB3230B2, 0x34FF6F2A,
+   0x31BC82BE, 0xDA83B96A, 0xCC89C862, 0x3B138D2C,
+   0xEBD59505, 0xF4A27AEE, 0x8BB49DDA, 0x29DF153A,
+   0x50A555BA, 0x2DFFEC46, 0x0FEC5D80, 0xC899108D,
+   0x000000BF, 0x88DA1A0F, 0xC834E659, 0xEEBE47A8,
+   0xB9BFBA08, 0x7B3A2B73, 0xF59D3393, 0x8DECF4E4,
+   0xFFC7CB5D, 0x83DC5F4E, 0x72477DD5, 0x43AC64EB,
+   0x0A59E11E, 0xCB10A6AB, 0xDA8AA16C, 0x3759C37C,
+   0xE571EC8C, 0x00000047,
+   0x1FD309B5, 0x2B6C0EF3, 0xEF2D0448, 0x9CF760A0,
+   0xB66BC99E, 0x9C5D587B, 0xABC086A2, 0xEBE5D8E7,
+   0x589F8B4D, 0x52E78ABB, 0xD3B36CD6, 0xB7FA2135,
+   0xCF0922AF, 0x5286FA97, 0x9AF4A905, 0xA703ACC1,
+   0x00000061, 0x44A79B6B, 0xE82D9ECA, 0xD825AE14,
+   0x706ABBAD, 0x4AD3D59F, 0xAAF59C1E, 0xCE6FDDB8,
+   0x3DACB4E4, 0xF253EF2F, 0x0B975484, 0xF625AD33,
+   0xAE33BF3E, 0xEC2ED026, 0x049256C1, 0x44B5CB48,
+   0xA50EBA55, 0x00000113,
+   0x6E626779, 0xAAFAE901, 0x0084ACC1, 0xDE9BED6C,
+   0xB706FC75, 0xA585BA05, 0x7AB4BF6B, 0x3FC03160,
+   0x62E10B42, 0xA78E2644, 0x95A748A5, 0x6068DA6E,
+   0x49B03550, 0x2E139CF7, 0xBCE94653, 0x7D92002D,
+   0x000001CF, 0x14423E00, 0x73334D5E, 0xAF33C5A1,
+   0xB8E759DC, 0xC9FF5513, 0x6E3953C3, 0x3182B2E8,
+   0x198EF797, 0xD49664FC, 0x2F8D699D, 0x117AD6EC,
+   0x7F629506, 0x9149E5F5, 0x23E8B6F5, 0x6F8D2609,
+   0xDDBB61C0, 0x00000059,
+   0x508B6ADE, 0xD96C3210, 0xE6DEF561, 0xFBF4D8DD,
+   0xFA051F03, 0x452B0895, 0x3D760C1B, 0xB2DC6399,
+   0xD6F24232, 0xB6611865, 0x2A2EA820, 0x6D21C3D5,
+   0x10EA1E0C, 0x043DD2C8, 0x46F07714, 0x57A65B70,
+   0x00000183, 0x994F580D, 0xAB35EF1D, 0xD6A54985,
+   0xAEB0EFB1, 0x6CFA6133, 0xA90CD196, 0xEAE0B601,
+   0xEAA90355, 0x4EF4EA24, 0x78171BBA, 0xAE78D9F4,
+   0x7ED15BA8, 0xEBD06C49, 0xC07D39C4, 0x7CFDD13D,
+   0x4F90FAF0, 0x00000160,
+   0xF3CAC96D, 0xCB94FB66, 0x8E997743, 0xD6053CB9,
+   0xCF0C6FF2, 0x5CC84357, 0x0355A498, 0xC1BD23AE,
+   0x8F093D09, 0x589CF79D, 0x830CFDF3, 0xEFD18442,
+   0x005A0C82, 0xF44A9EF6, 0xD817C05B, 0xD16E877A,
+   0x00000025, 0x4AFBC78C, 0x6C512001, 0xBEA9EA62,
+   0x3E564AAB, 0x37D83DB0, 0x4D55443B, 0x2E9CBFD5,
+   0xD48CC006, 0xF7B185A0, 0x698208C3, 0x26DFEF85,
+   0x62D689F3, 0x3E04AC62, 0x589252ED, 0x156943F6,
+   0xCF0675C2, 0x0000008F,
+   0xCDB4FB3A, 0x7E4DB891, 0x856703BE, 0x14A807EE,
+   0x95616FC7, 0xE10CA359, 0x66B135B8, 0x4C10D471,
+   0xF97A90D9, 0x72382298, 0x6CBC962B, 0xC29B7525,
+   0xE3C48D89, 0x850C864F, 0xCEAEE7EC, 0xD33E8B27,
+   0x00000017, 0x9BF282AC, 0xF9DDD173, 0x6763052A,
+   0xDE0405B5, 0xE9FF6EE0, 0xF605493E, 0xE766F21F,
+   0xD6CDED0E, 0x42B22BA3, 0x67D91A26, 0xA7CA99D7,
+   0xFC20399F, 0xDDE567F2, 0x55DB476D, 0xFDE01B88,
+   0x8B29591C, 0x0000019B,
+   0x62E57A3B, 0xF9058206, 0x2EB5AADB, 0x58E41554,
+   0x95625DBE, 0xEA05642B, 0x23966CA1, 0x48810442,
+   0xF5ACC58B, 0xA2BC2827, 0x9B8DF8F5, 0x4464293B,
+   0x86AF29A1, 0x90C9FD15, 0x8C63910E, 0x5086E57D,
+   0x00000127, 0x03DF3D73, 0x1CF94681, 0x07FBEDE1,
+   0x6228A9E7, 0x613FB243, 0x37A321CF, 0x5BE97BF5,
+   0x637D3795, 0xAB023201, 0xE975ADA9, 0x580EE2FF,
+   0xD16B226F, 0x34D78E9A, 0x4099752B, 0x35B75DF5,
+   0xD8D00C04, 0x000001F6,
+   0xBB4C6D80, 0x19957452, 0x834D7102, 0x109B9606,
+   0x0FF0D9E4, 0xADA3C572, 0x70ECFD2F, 0x1CF741E7,
+   0x7CFF6BD8, 0xA65F82E6, 0x0DC81838, 0xA33521AE,
+   0xA3A25FD5, 0x161A1362, 0xC42F92B9, 0x48EBBB94,
+   0x000001D2, 0xDC225E60, 0x600996E5, 0x8B002CFD,
+   0x5A389FAB, 0x11AA4637, 0x5E641FD1, 0x31F0A5B7,
+   0x2FADB944, 0xC8CAF19F, 0xA487CA0B, 0xFB755123,
+   0x671255CE, 0x56D6D88C, 0x17E9F0FF, 0x206820AF,
+   0x215A53A1, 0x0000008E,
+   //Window 102
+   0x512E743F, 0xBCA656EB, 0xBA4F85EC, 0xCD94FC24,
+   0x048BDF6F, 0xF4383AD0, 0x587F47A6, 0xDB10E381,
+   0xDA3EC391, 0x47F244E7, 0x0C33624B, 0x5F337E38,
+   0x82A3C375, 0x9259425F, 0xF276BF73, 0x509E56C3,
+   0x00000014, 0xD94CB899, 0x2D65148D, 0x3B28185E,
+   0xCAC38630, 0xE102ADB5, 0xA36BB7BD, 0xFF3FFFB6,
+   0xA1E7E0B5, 0xE628E1AF, 0xC842CEAC, 0x8647613E,
+   0x8E6DFA7C, 0x84ADE38B, 0xEAFD7585, 0x00188D5E,
+   0x7C4C0B0A, 0x00000151,
+   0x5E3F9A6F, 0x72B02324, 0x08DEFDB5, 0xC8893745,
+   0x2ACD0AF4, 0xAB723536, 0x5D02BACE, 0x7CE916A8,
+   0x96314AE6, 0xB2ABE9DD, 0xCC74749E, 0x6B664D88,
+   0xA5595E97, 0x59F417BE, 0x52EF341A, 0xE77F2E3B,
+   0x0000003C, 0xE3AA5B6D, 0x1F57CEBB, 0x8901CD97,
+   0x870522A6, 0x57CF5E3A, 0x926CE7D9, 0x31E15A34,
+   0x2D8FC693, 0x009B6274, 0xC3A756AD, 0xF82857A8,
+   0x498748F3, 0xB5531159, 0x7B27D095, 0xC7E359A7,
+   0xE2783284, 0x00000082,
+   0xB6501DC3, 0x039C81F5, 0xD507075B, 0xBEAED737,
+   0x5C367A46, 0x080BA34A, 0xECD54633, 0x06A583C5,
+   0x20EFF4CB, 0x2085119B, 0xA193A015, 0x26F27B7A,
+   0x37B34FB1, 0xA2DD99C9, 0xFFF66C7F, 0x99227938,
+   0x00000107, 0x1CEC40F8, 0xEE87C18E, 0x65532DA1,
+   0x760E880D, 0xBE9ED489, 0x78D00F69, 0x8CC9BE51,
+   0xF6111494, 0xAAFD71E2, 0x79D826AB, 0x9F39CD9F,
+   0x831BC305, 0xC214629C, 0xFFFEBC7E, 0xC0A202E7,
+   0xAB14A5CD, 0x00000083,
+   0x4F244783, 0x810305AB, 0x0E2C1A83, 0x99471C5A,
+   0x9BD2BA8D, 0xBB3BEEB3, 0x9C189A01, 0xE7FE7B92,
+   0x667F8683, 0x0F5A31C9, 0xFB7BFBB0, 0x28EE1A59,
+   0x8E14240E, 0x4CB86E09, 0x9BAB970C, 0x47039EC2,
+   0x00000183, 0xF4EA7190, 0x09B761F8, 0x637F19C3,
+   0x5B109E93, 0xEDD588D7, 0xE40AA435, 0x81A3B4AE,
+   0x6B257378, 0x591F5CAE, 0xF5B5CC60, 0x811B80FE,
+   0x2E787D34, 0xB0D84075, 0x28BE1DB7, 0xA4DB6982,
+   0x2579D623, 0x000000B8,
+   0xD07B0D60, 0x164A9E29, 0x4A4CED37, 0x7D9325BC,
+   0x0A22EA31, 0x38984641, 0x659C12AE, 0xC33E1FC1,
+   0x78CC3AD9, 0x76094756, 0x4CF14874, 0x3C30033A,
+   0x23F58493, 0x6C7ED92D, 0x9A41B806, 0x0040C6D9,
+   0x000000C8, 0xA4F89D26, 0xE9652D66, 0x1E56DAA6,
+   0x97ACA7AE, 0xB8B76045, 0xA1650F15, 0xFC159585,
+   0x2F2338B3, 0xF243CF7F, 0x9AF48930, 0x923DE549,
+   0xDD333C3D, 0x3083991D, 0x415A035F, 0xB8F179D8,
+   0x0257BCF5, 0x000001B8,
+   0xBEB6745B, 0xC0135E27, 0x7AC01E8B, 0x1FA3E9D5,
+   0x4EFAA6AD, 0xA713CCD3, 0x32492FA1, 0x6B824142,
+   0xC5A1550A, 0x1E3DC6B3, 0x429F42C3, 0xE3C7EA75,
+   0xD1D97ACA, 0x93F0CADB, 0xF7091927, 0x7B23EE53,
+   0x000001AF, 0xECB37A50, 0x708DC83A, 0x8F9EDCAA,
+   0x802E69B3, 0xC66D3A68, 0x02ABCD3C, 0x1101AFAA,
+   0x814EC38B, 0xA1B52623, 0x20E5D950, 0xD4DD624E,
+   0x0AC6EA5F, 0x27A0C3B4, 0xAB260082, 0x9368736B,
+   0x577F5CA0, 0x0000001F,
+   0x7C4F8F4E, 0x66CB0DB4, 0xFC21F5F6, 0x81AE6D75,
+   0x14951A87, 0x19E8FB87, 0x602C5224, 0x52ECEE54,
+   0xE408B25E, 0x50A823A8, 0xE372C922, 0x32AAD7D9,
+   0xE03A5CE6, 0x80A117C8, 0x2CA7F6B5, 0x9B62059C,
+   0x000001B2, 0x9D676975, 0xC5039773, 0xBECFC0F0,
+   0x6959C6B5, 0x43D30B32, 0x7B73318A, 0x6048CAFD,
+   0x0C0AAC5B, 0xBA7D3C59, 0x77F3201D, 0x09004FDD,
+   0xA5A05D3E, 0xADA3810B, 0x711B1B17, 0xA6EB6D1E,
+   0x0B9F7679, 0x0000017B,
+   0x23D30FA4, 0xC543163D, 0xB32B27C9, 0x45CC53A2,
+   0x7953C4B4, 0x894B9CA0, 0xBBA613A7, 0xAABBA057,
+   0x6CCBB39D, 0xC50371AE, 0x3FD4F3C3, 0x610CDCF5,
+   0x19A9D357, 0xAD08443A, 0xD519C9CD, 0xABF74787,
+   0x00000076, 0xE5502AE4, 0x4EE3A817, 0x8B39A71D,
+   0x7AB2462D, 0xFCFE642B, 0xD6736EAB, 0x25C914E3,
+   0x77479BAE, 0x2A14E2C0, 0x95FB92AF, 0x58BD112C,
+   0xCD334647, 0x5BC0ED8B, 0x3165B9A3, 0xD89BF952,
+   0x980F3176, 0x0000006F,
+   //Window 103
+   0xE63885D6, 0xF7593760, 0x86E546CA, 0xCE5054BB,
+   0x6E9567B2, 0x5910AD52, 0xE420AFF3, 0xE812CF7B,
+   0x904E9676, 0x266049FD, 0x2C8B34AD, 0x42D0E2AB,
+   0xA4382F29, 0xF79F8F91, 0x41D531DE, 0xF8CDE3ED,
+   0x00000035, 0xB16CC1F3, 0xE514497F, 0x627DB2F6,
+   0xBC044F39, 0xA1FA2BDC, 0x76FA5148, 0x5FE3FD7A,
+   0xCF7EB72E, 0xEE3D45E6, 0x83236C11, 0xC4EDDB54,
+   0xA02D7E92, 0x4D4982A5, 0xCFB5BB89, 0x7C217EA5,
+   0xEE6AC2A2, 0x000000BD,
+   0x5751A4F4, 0x38FF6EA3, 0x0F0EC448, 0x0D3B2CB1,
+   0x93A502C0, 0x5BC5BAA3, 0xC62E3061, 0x87D6A136,
+   0x130F3523, 0x1B970DF2, 0xFD691595, 0x89787BDC,
+   0x517EF324, 0x0C8E0A70, 0x97924054, 0x3BABDBF6,
+   0x0000008F, 0x491F0B40, 0xD425EA77, 0x5C253856,
+   0x9C214D2B, 0xDBB65488, 0xF74A9B15, 0x17BED5D9,
+   0x87369E1D, 0xE589A38F, 0x67CC0214, 0xBFA1E6E7,
+   0x6A141AB9, 0xD193C133, 0xA3253AA2, 0x7E63917D,
+   0xDFF0A10F, 0x00000057,
+   0x517A4CD0, 0x641FBE08, 0x890D5388, 0x71973104,
+   0xB3E7BD17, 0x390AA2B5, 0x1F861153, 0xF9B38BD4,
+   0x42796670, 0xD2617A18, 0xFBBE6DC1, 0x7D3C4EBE,
+   0x161342D4, 0x418D3DA1, 0x25BFF257, 0x3009DDA8,
+   0x00000089, 0x6369DA47, 0x04888A4D, 0xF9BC50E5,
+   0x10975F89, 0x7415D98B, 0xFD1BDA69, 0xDEFA1DBE,
+   0x978021E9, 0x0B97FCD4, 0x4AF400C9, 0x062345E4,
+   0x66EB174E, 0x643339AE, 0x5A8E92D0, 0x1EBDC132,
+   0x2E36B35E, 0x00000176,
+   0xD6FF5A2D, 0x081FE748, 0xB93AFA57, 0x52B184A6,
+   0x46E11AB9, 0x83C0C666, 0x5350A841, 0x274DF41F,
+   0x4A3FEE0E, 0xED23080B, 0xBF0ABB4E, 0x4BC1FB50,
+   0xA37D4E7B, 0x4CA11F49, 0xBB6C8307, 0x3A7284A1,
+   0x000001B7, 0x2A535E97, 0x340E4AA0, 0x01A36DA4,
+   0x6A0F9700, 0x94F67DDC, 0x140F4676, 0x51D24551,
+   0x81F3A138, 0x1F5481CA, 0xF8930765, 0xDB6865A1,
+   0x23007EA9, 0x9C46AD26, 0xB37376C9, 0xC2FA4CCE,
+   0x53C8F29C, 0x0000000F,
+   0x28B6D103, 0xDB9FBE30, 0x9836F57C, 0x86C8C536,
+   0x968479BB, 0x2B984966, 0x6FCEE1A1, 0xCAE8E0FB,
+   0x83921A02, 0x5ADAF939, 0xC9B9E566, 0xB2334045,
+   0x7EF59B61, 0xFE27488E, 0xB5C12BFB, 0x39B23FE7,
+   0x00000001, 0xDE3DCBAB, 0x404D09A2, 0xB96C7834,
+   0x98C35151, 0x6ED3ABA8, 0x41C735E7, 0x2E085B3F,
+   0xF131563C, 0x4C57DC30, 0x3FCDB43D, 0x2B8C88F2,
+   0x76BBF46B, 0x086605BB, 0x5B3FC2BC, 0x4AE0EEC5,
+   0xDBED081B, 0x0000012E,
+   0xE7F0E20B, 0x4877FE63, 0x80797905, 0x7B15FE9F,
+   0x8ED95A20, 0xDE885B66, 0x1D118489, 0xAFDE4049,
+   0x15D8E92E, 0x160472C7, 0x41E49D5B, 0x411DB3FF,
+   0xB0E083F7, 0x01001883, 0x30B9CC65, 0x11AC87E4,
+   0x0000008A, 0x0A716A17, 0xCACF2648, 0xE7493E70,
+   0xC94CD8A6, 0xFDB4F637, 0x1DDF83FC, 0xD36B3A34,
+   0xBA2EE5E3, 0x5C706FD2, 0xFBC23315, 0x6B20F13C,
+   0xD9EACBDB, 0x2FCDD5C4, 0x5551B49B, 0x0C6351B5,
+   0xF490CADF, 0x0000002C,
+   0x53BEF9BE, 0x80C63FF2, 0xB39166FC, 0xA729D48A,
+   0xB9D7B998, 0xFC60D268, 0x5BAB10F8, 0x7C389CDE,
+   0x40EBD2E6, 0x238CA028, 0x177459C0, 0x1D5D88AE,
+   0x6A0EBA11, 0x4D35EDF5, 0xF51702D8, 0x8BE1CABD,
+   0x000000E8, 0xAB511547, 0x2E38FC9E, 0x87733483,
+   0x5CBF5B85, 0x7B06B4F1, 0x721166A0, 0xAC421E3A,
+   0xA80EC106, 0x1A32F6F1, 0x2ECDC59A, 0x6B144B54,
+   0x74520FF4, 0x493F7D27, 0x41A1EBDB, 0xE95B5128,
+   0xF2D3501A, 0x00000065,
+   0xC5F4DDE7, 0x3F285D1D, 0x00D79435, 0x3C1FCD56,
+   0xF6570B80, 0x01BEF8FB, 0x30D58ED7, 0x33E600A6,
+   0x21E9882B, 0xFA4CBED9, 0xD7D39D84, 0x1B9EEAA7,
+   0xD7B2D1FB, 0x9FCA4DBF, 0xCC4AAABD, 0xE13B1519,
+   0x000001C2, 0xE193D7D2, 0x66A754AE, 0x0E8C174F,
+   0xE3C88242, 0xDD625328, 0x28CC71CD, 0x9BE78C6E,
+   0x42138048, 0x6B502185, 0x5C0BAA8B, 0x069B22E8,
+   0x39E22BEA, 0x885429CD, 0x6EC0D474, 0x681C705E,
+   0xE7473034, 0x00000172,
+   //Window 104
+   0x8FE6F511, 0x141838BF, 0xEE745E2E, 0x8E9FF343,
+   0x02325306, 0x71DA9FD5, 0xF0D0D68E, 0xA527B9BA,
+   0x31144649, 0xCE19B22C, 0x0BFAA46C, 0xCA9B778B,
+   0x6CE31145, 0x66E689A7, 0xD8D1DA21, 0xED43460D,
+   0x000000BF, 0xC1669168, 0x241323F7, 0x79B94B5A,
+   0x9934B3DE, 0xD9F9A406, 0xD332C1A2, 0xE4A49EAC,
+   0xBE3EBE21, 0x678BE3ED, 0x4A00648E, 0xFF09DB31,
+   0xC9F534EA, 0x5EFDD859, 0x2DE77406, 0x00F5C7A5,
+   0x2C218CD8, 0x00000152,
+   0x0A823516, 0x323E1B7F, 0x673254F7, 0x8F4E9152,
+   0x41599B9C, 0x5E5D7190, 0xA1198ACC, 0x96BFBA24,
+   0xBBFCD72C, 0xB1B6E75B, 0xF4894626, 0xFD5955F2,
+   0x898BBBFD, 0x109EDFEA, 0x1F468074, 0xD3692904,
+   0x0000016A, 0x9BB7D749, 0x089D12A9, 0x4FFC33D9,
+   0x893EBF25, 0x9097FF49, 0x6ED72C60, 0xB4E1D91D,
+   0x9291E1EE, 0x72A07882, 0x0DBFE582, 0xBE0636EC,
+   0xAC41065F, 0xF4234BD5, 0x43D74F8B, 0x0A28FDEF,
+   0x01BFB085, 0x000000B5,
+   0xD1A4A65E, 0x4054B365, 0xA04B2F59, 0xFA395E2A,
+   0xBF63D17A, 0x1C6C3B41, 0xABE2AAD0, 0xA639FB26,
+   0x0C9A565D, 0x008F8160, 0x91061E61, 0xF5EFA9E6,
+   0x6E881F7F, 0x7731C2F7, 0x9074B4AA, 0x3623CD7C,
+   0x00000016, 0x1037873E, 0x20BA924B, 0xABCFD34E,
+   0x7B7107AC, 0x05E13406, 0xB492EBB9, 0xF08FD2FA,
+   0x6DCC3342, 0x64126080, 0x08F3A1D3, 0xFB5BF009,
+   0x8FB54869, 0x82442DCD, 0x5E661632, 0x5C21D62A,
+   0xBAB2D8DD, 0x0000003D,
+   0xAEB0D0F0, 0xEA6E467A, 0xEB5EE813, 0x9FA030D9,
+   0x515CDBF8, 0x9BE99873, 0xA805D16A, 0xE608DB63,
+   0x9CE2F64B, 0x5E6255DD, 0x7418BB31, 0x2D88FB42,
+   0xE7AC60BF, 0x147C74FE, 0x672B0F90, 0x34DF0171,
+   0x0000004D, 0x77F1F4FE, 0x6C1F2671, 0x138FA188,
+   0xF64D4242, 0x4C0097CA, 0x55AB5DDD, 0xBDBDB465,
+   0x354BB5F3, 0x79060E68, 0xAD6142D5, 0x1017B5FB,
+   0xD9ADC110, 0x9F510299, 0x656FFC3A, 0x741EBE49,
+   0x568945BD, 0x0000009F,
+   0xD08376ED, 0xBECFAFE5, 0xE8BBF04D, 0x9D8FD1DF,
+   0x8273C85D, 0x2C9227DD, 0x4B542089, 0xC6EC87E2,
+   0xD93A3086, 0x37EA5B01, 0xA030E39A, 0x46D6DEE3,
+   0x91F41864, 0x5418C1FB, 0x10F9C3A7, 0x97FD2D3B,
+   0x000001F0, 0xBF623C8F, 0xC4A32D07, 0xB7EFC74B,
+   0x60D66908, 0x1101A44B, 0xC835763B, 0x2569F191,
+   0x7E8D41DA, 0x2A8E1F58, 0x71F8A149, 0xBE62809A,
+   0x1EB616AD, 0x3CEB0C07, 0xBF834D7E, 0x63B4593C,
+   0x16A16C98, 0x0000005D,
+   0x596537B3, 0x6BE30296, 0x1493A353, 0x2728CBB5,
+   0xD9C477D7, 0xDA2754F8, 0x3873A14F, 0x696B7153,
+   0x2743C148, 0xE7CD0B95, 0xAADE8ED5, 0x989A63BC,
+   0x06306D91, 0x68FB4ED9, 0x45E756FB, 0x76AD939E,
+   0x00000150, 0xC9179F79, 0xF1B67D3E, 0xC850A05E,
+   0x65908602, 0x7E051E15, 0x39AE1AEB, 0x3AD0FB2C,
+   0xE20EB4DD, 0x105C48B3, 0xBBF80215, 0x34FB1968,
+   0xE86607CB, 0x602F86B0, 0x68148E18, 0x0B4E1323,
+   0x2499C357, 0x000000D2,
+   0xCF6F524F, 0x28865B78, 0xF3ED59EA, 0xCDE1470C,
+   0x148F71A8, 0xFED6EF9B, 0xC75FB43C, 0xE395C472,
+   0xB869F7FC, 0x634ED2BD, 0xB44B76FF, 0x320F5116,
+   0x7A90B7A6, 0x4F292468, 0xBD5CE154, 0x787347DA,
+   0x000001B5, 0x29750F3A, 0xCB578E40, 0x99873ADF,
+   0xE87F3E4C, 0xD77FD99C, 0xD62209FB, 0xF66AD010,
+   0x88F0E933, 0xCDBC9565, 0xD380CC9C, 0xD67C1A15,
+   0x65F739F9, 0xD1084088, 0x2F3BF773, 0x8B89CEDF,
+   0x5888BB17, 0x00000174,
+   0x2D68B61A, 0xA7C98EF5, 0x0195DE0E, 0x6897A00E,
+   0xCF3BDA7B, 0xA64006D1, 0xBA7594F8, 0xDA27E467,
+   0xC08DAF52, 0x349AE42D, 0xEAA0103D, 0xC7D94AC6,
+   0x5A8AE089, 0xD46C2D60, 0xBF007687, 0x778292C5,
+   0x0000000C, 0xD8DB722D, 0xC7E7ABF9, 0x852672F1,
+   0xE489A8EB, 0xA436CE5E, 0x2DE40F86, 0x6D7B8223,
+   0xC09FF7BD, 0x34BBA02F, 0xFB65ECD9, 0x964D0137,
+   0x2DC839CD, 0xC9E27EE7, 0x1C0F119D, 0x8F8B3C4D,
+   0x21084DFA, 0x0000019F,
+   //Window 105
+   0x10A8C4FB, 0x73A6BA38, 0xECC93E5D, 0x5153D959,
+   0xB59E9871, 0x7CA58012, 0xAFD442F1, 0xEDC0DBEF,
+   0xB9CF7691, 0xB9050A22, 0x464D017D, 0x3D1E96FE,
+   0x82074DCA, 0x541781A4, 0x8B355413, 0xEDCE0DB3,
+   0x0000006B, 0xAE2B39C2, 0x1A13E3EE, 0x3C218179,
+   0xC431081D, 0xAE68B7C6, 0x5CBC14C1, 0x9005A304,
+   0xCF2559BB, 0x2EC7AED5, 0x14D7C1E9, 0x1E2E2F0D,
+   0x5C379BFE, 0x886F0CF9, 0xFC33E4D2, 0xAC4E1D17,
+   0x2F14E7D0, 0x00000071,
+   0x0093FD88, 0x9394910F, 0x547FC3E1, 0xFF7760D2,
+   0xA904C24E, 0x7B81FCF5, 0xFD80644C, 0x120A558D,
+   0xA715D6FC, 0xFAD07009, 0xABF6246F, 0x24BD3AD8,
+   0x79C968A7, 0x7C5B04C7, 0x108AD586, 0xC7DF9266,
+   0x000000D3, 0xB655B6E1, 0xE37DB2E0, 0x568C6373,
+   0x0A029277, 0x428A6B69, 0x0BD0526F, 0x3D4F3847,
+   0x54BD7B9B, 0xCB6BD60F, 0x42CACA2F, 0x6D10BFA6,
+   0x657B0F1F, 0x0FEF238D, 0x97F9F99D, 0xCC3795A8,
+   0x93171B4D, 0x0000009D,
+   0xA73A1AA4, 0xB7B63D0F, 0x5532EC0F, 0xFADBA595,
+   0xFF9E47D6, 0x19A61405, 0xAA210AFC, 0xD9A44EF1,
+   0x3C3E2B07, 0xCAB8BD2C, 0x4E1428A8, 0xDD8F8D15,
+   0x91F63FF2, 0xA5EABCC5, 0x66F368C9, 0x7DD96356,
+   0x0000018A, 0xD84C056D, 0xB35C9E17, 0xEDDFF5DE,
+   0x0F27CD01, 0x2C0D1066, 0x855C10A9, 0xB4BFB648,
+   0xC7AEE7FE, 0x5803338B, 0x9F9D978D, 0x4F4F2B95,
+   0xFCA5A25F, 0xADF37F8A, 0x9D5D5FBF, 0x5059C65C,
+   0x13482B1E, 0x000001A4,
+   0x7500F10A, 0x95DA5444, 0xA6B14D2A, 0x6935CA2A,
+   0x30DC9660, 0x58F4555C, 0xAC954B30, 0x949EC82A,
+   0xE7FA5C4D, 0x94027576, 0x21960C7F, 0x035D525A,
+   0xC2092C76, 0xE3ED1E66, 0xDF9779A1, 0xBD151AA3,
+   0x0000012C, 0xE59368FE, 0xDA7D7C3D, 0x8DDCE4FC,
+   0xB4C24064, 0x47EB7A34, 0x05360BF8, 0x700D30FD,
+   0xE0889804, 0x07F447F6, 0x99E1ADD2, 0x4A4E8762,
+   0x30E5B757, 0x3329B2FD, 0xEE9F0695, 0x6894A597,
+   0xBB6FD0FC, 0x000001A6,
+   0x1034BEA2, 0x1A20556E, 0x2BE51DF5, 0xD717D917,
+   0x86AC317D, 0xE95F0912, 0xC1304EE3, 0xF3923FBE,
+   0xE240F768, 0x3F763629, 0xC8C2AF96, 0xCBF933BC,
+   0x12C667F3, 0x0E7CBEF6, 0x95D25E69, 0x6F015992,
+   0x0000012F, 0x4B56BDAF, 0xF941627F, 0xEEC4ED47,
+   0x06EE3B59, 0x4D951B00, 0xB2C0882E, 0x8652DBCD,
+   0xF5304C7C, 0xA6245127, 0xF59E2884, 0x4E4444A4,
+   0x2F9752C1, 0xF8DED8F5, 0x91D5FA7A, 0x5C3A5632,
+   0xE5BDE598, 0x0000003D,
+   0x2AF340D9, 0xB765A24B, 0x0B487CDE, 0x95817805,
+   0xF47F322A, 0xF2B88C2C, 0x1EE6FA6C, 0x7FA33CE5,
+   0x11A0096E, 0x98002C9A, 0xBB6E514D, 0x5507EB0B,
+   0x1A52BDCE, 0x7B3DD65C, 0x67BDEB7F, 0x80A29CC8,
+   0x00000069, 0x6D7C8921, 0x0CDC241D, 0x039A455F,
+   0xB1506BFC, 0xEE18C2BF, 0x14ECF2F7, 0x027F00FE,
+   0x3317BA71, 0x6662FD91, 0x2C12D670, 0x87D5376F,
+   0xE9CEDBFD, 0xB3BC972B, 0x3E0F51B5, 0xB2C1A068,
+   0x2450C347, 0x000001E7,
+   0x7F55B79A, 0xCDDB65C3, 0x5D85B33E, 0x6E26C45F,
+   0xB1470ACA, 0x111919CE, 0xE6C06007, 0x7AA294E0,
+   0x3C009509, 0x35207DE6, 0xDDD0C472, 0xCF119448,
+   0x3C05546D, 0xC01BF29C, 0x54126FE9, 0xADF84658,
+   0x00000054, 0xFEF83427, 0x2C13D69D, 0x0960AF28,
+   0xE539C2DA, 0x97CCC699, 0xBE374A82, 0x523D7F91,
+   0x8020D224, 0x531B6154, 0xDAB7F7D6, 0x7CFAAF1B,
+   0x37AE5112, 0x6F69E8A9, 0xB5E3E203, 0x4B708B58,
+   0x4291B045, 0x000000E9,
+   0x9418CED8, 0xEB338847, 0x506ED21C, 0x68F55B32,
+   0x35EC2DFD, 0xCCDB0BD3, 0xB65F515E, 0x63B075E8,
+   0xF6905524, 0xD3D07AF8, 0xD1589131, 0xAD5A170A,
+   0x61582A3C, 0x97FFC56D, 0x34C2D2E4, 0xF15ADD9A,
+   0x000000E0, 0xF5D91B62, 0x79D0330E, 0xE46EB580,
+   0xF3E8F69C, 0x067E7599, 0x1B5EA4A8, 0x6B335559,
+   0x42508433, 0xB4AD41BD, 0x85863C2E, 0xAA1DB8FD,
+   0x9572CD16, 0x4F205835, 0x55756BE8, 0x53DE8F6A,
+   0x82ED485F, 0x00000049,
+   //Window 106
+   0x4E1080A4, 0x7D6E4240, 0xE1ADB078, 0x5CF6C427,
+   0x3D594E28, 0xE74EC603, 0xBDF853F2, 0xC0185404,
+   0xC3335717, 0x287D94DE, 0xC3179807, 0xF735656A,
+   0x604E93F7, 0xD356F2BF, 0xCBE27815, 0xB1FDC2F2,
+   0x00000151, 0xDA1D3EA1, 0x7B17E356, 0xA7AF9610,
+   0x0ED57D7E, 0x3AE89C0E, 0x4A6AC3E5, 0x5F82B4A3,
+   0xC8F722B8, 0x7F0850FA, 0x453D5A4A, 0x7B3AC4A3,
+   0xD6F79D23, 0x0DBAE800, 0xE1C9DFC2, 0xC4B9258E,
+   0x56E4F0F5, 0x000001CA,
+   0x6A52747D, 0xC7D45418, 0x523D74D6, 0x034CB6D1,
+   0x0E2B859B, 0x073A404E, 0x9345DA73, 0x9A38E6D8,
+   0xC7FDCCE3, 0x4C4771D5, 0x025C1423, 0xAEE8C00C,
+   0xD7203E0C, 0x10C94E72, 0x4547289C, 0xEA9F58BB,
+   0x0000000A, 0x31B952A7, 0x030C1DF5, 0x1D47E37E,
+   0x8177A6E1, 0xDE6F3C0E, 0x9E2222B0, 0x1399560F,
+   0x1ED75C87, 0x829AF1E8, 0x9B818C5D, 0x45DB80A1,
+   0x75C77519, 0xD73C446A, 0xFAC13445, 0x62844292,
+   0x91A27413, 0x00000027,
+   0xA421DED8, 0x8CC7E786, 0xE860A431, 0xA5A125F9,
+   0x48983574, 0xB7A8D712, 0xE8B35B3B, 0xC6002B7E,
+   0xCE6EEA34, 0x8F665648, 0x1034CBA8, 0x752979DA,
+   0x5C5CBEC8, 0xE2630CDA, 0x52E8924F, 0x3EC97990,
+   0x000001AE, 0xACC3A394, 0x5273DC9C, 0x49B36AE6,
+   0xB909BF20, 0x82B3EBEA, 0x171849E5, 0x02F14020,
+   0xBCD415DE, 0x6FD2DFE5, 0xBF3CFDDB, 0xFF83E32B,
+   0xB148440C, 0x12FD66EF, 0x47B5DB03, 0x649E2453,
+   0x1405294D, 0x00000119,
+   0x1BE22FD8, 0x0ADB4AE0, 0x983C07A7, 0xBBE623DD,
+   0x7AD35FDE, 0x7A3CCB04, 0x88139DA7, 0x940147B2,
+   0xCFD6AD33, 0x6CA7BC83, 0x2522E444, 0xDAF6805E,
+   0xB7A5DC1B, 0x81EDD301, 0x2775213E, 0x962222CC,
+   0x000000D0, 0xF3F1F2E9, 0xB66DA30E, 0x3DD69CFC,
+   0x1CECA804, 0x8E011253, 0x216FE23A, 0xA1BC0755,
+   0x1FA58241, 0x765CDF24, 0xDDBBFB9E, 0x52772AFC,
+   0x8ADC0268, 0xAA6C3528, 0xB2F7C543, 0xCE8978C5,
+   0x6571DB8B, 0x0000000B,
+   0x5E359C52, 0xBB07FC7B, 0x62A14425, 0x4967A343,
+   0x1512B682, 0xE443CD5B, 0x1711118A, 0x86BD7C5F,
+   0x0D8C03E1, 0xF5249F59, 0xBEAA26AB, 0x18C0F23C,
+   0x8C1D4324, 0x062B8345, 0xCBA76512, 0x59402ED3,
+   0x000001DD, 0x53BD6B5A, 0x230DD9F8, 0xF18348DD,
+   0x45FE89D9, 0x7BD44D52, 0x6DA2FF89, 0x98D530EC,
+   0x3D9ACAEE, 0xC5171D06, 0xA0EC09B1, 0xB7C074AA,
+   0x15AE7AE8, 0x4BC528F9, 0x346B1699, 0xD87E05CA,
+   0xB7B46789, 0x00000122,
+   0x1E093788, 0x4103A4EB, 0x756C67D1, 0xF9245C34,
+   0x25DC2FA9, 0x6896757A, 0x94EF7FDC, 0xE73DD43D,
+   0x0C97A643, 0x8FE8D038, 0x31F618A5, 0xB06E366F,
+   0xBB863CB6, 0xB55B172D, 0xF0704C7A, 0xDEEF1F49,
+   0x000000A5, 0x81A45B89, 0xD0B0AFF1, 0xD9C57C48,
+   0xD53C7590, 0x93EBA327, 0xC3A5233A, 0x3552AB44,
+   0x6706F75B, 0x4C71B9E3, 0x3B442BF5, 0x38D5A2E8,
+   0xAEC3C39D, 0x0FFFE6F7, 0xAE46666A, 0x1D938D4B,
+   0x3D002A02, 0x0000008F,
+   0x6F744DE5, 0xF858317F, 0xAE3291C8, 0xE1503766,
+   0xE08453AE, 0xAFE145C7, 0x6635BDD1, 0x3F2B248E,
+   0xBF8569E6, 0xCBD53A8F, 0xE4B333FE, 0x6FF1E4FA,
+   0xDD26E758, 0x8E5B24D8, 0x952B75EE, 0x71DA7965,
+   0x000001BD, 0x110ED54B, 0x806DC8FA, 0x45B3F399,
+   0xAD774512, 0x178A7BEC, 0xF9FAB139, 0x6254D7E7,
+   0x41E7601A, 0xF8BBB5FF, 0x3EABF82F, 0x7BBB68A0,
+   0xF2BD2ABB, 0x7A9E20A0, 0xE16727B7, 0xD1661502,
+   0x4E51C8E6, 0x0000000B,
+   0x6402E540, 0x06AA71B7, 0x569940F2, 0x68DAFD79,
+   0x87A54485, 0xA244F347, 0x486A4F54, 0x85F5EAAA,
+   0x68DD806D, 0xE401DA59, 0x2F005ED3, 0x8392C5F3,
+   0xB42988F1, 0xFFDF4749, 0x49218465, 0x20745CAB,
+   0x00000123, 0x364B1F8D, 0x8B88856A, 0xF72831C5,
+   0x912C8E40, 0xA492D445, 0xF62B14E7, 0x4418F279,
+   0xBE4E9DFC, 0x0D39A55D, 0x05BDC5D0, 0x83C27D23,
+   0x67A7D31F, 0x8DA4D858, 0x2554B974, 0xF701DEF9,
+   0xF31FA174, 0x000000EB,
+   //Window 107
+   0x7D874400, 0x8AF346C5, 0x71098F45, 0xD9E98CB5,
+   0x79565740, 0xDB400810, 0xED9A7DCF, 0x0F7625EB,
+   0xC93D2542, 0x5D1415D0, 0x688D0692, 0xF87F74B4,
+   0x9F648523, 0x9FA2E31B, 0xCB387129, 0x4E505024,
+   0x00000006, 0x446E7206, 0xE2087F9C, 0xB48BB585,
+   0x60F69447, 0x2020BBF2, 0xDA365862, 0x3CD51256,
+   0xC8A26367, 0xC62F7C5E, 0x8CC663B1, 0xE72BBD20,
+   0xC86D4165, 0xAAC68BE3, 0xFFCE9039, 0xC3C360A8,
+   0x6C6C747C, 0x000001D4,
+   0x1842EB75, 0xAD854BDE, 0xFD913403, 0x52D44A39,
+   0x964BF528, 0xDE2D5FDD, 0xBE2D138F, 0x00FC48B0,
+   0x7968E858, 0x49777828, 0x79B5F778, 0x326F8A63,
+   0x026EE753, 0xB093B6D8, 0x067C336F, 0x36BD9300,
+   0x000000B7, 0x3D3B0373, 0xF63D269D, 0x8901CE7A,
+   0x7FD4555E, 0xF0C00754, 0xFEB8A5AB, 0xD1E4F38A,
+   0x2B855524, 0x10593EA9, 0xEB245C9A, 0x5303AE29,
+   0x8D042891, 0x7BE4EC45, 0xCC86C461, 0xB1A35C03,
+   0xD05D843B, 0x000001A0,
+   0x1BF64AAB, 0x615A13D9, 0xEE125E48, 0xAD0C56A0,
+   0x2F1AB618, 0x5622DF0D, 0x7E465F36, 0x7331C9B9,
+   0x5E69238F, 0xE9F79F23, 0x22200715, 0xE71D8ADE,
+   0xC1111751, 0x0F2C7539, 0xB9287B5E, 0x0A3E1894,
+   0x00000172, 0x311C0623, 0x20E9E6D2, 0x1CC824F0,
+   0x2D2EA9D9, 0x344E1B73, 0x4F188539, 0xA32CE555,
+   0x468983B4, 0xB185EFC3, 0x5A610F7A, 0xDFF9F69B,
+   0xA65ED115, 0xF79D8BE4, 0x61F20B69, 0x21D50124,
+   0xA4968021, 0x00000036,
+   0xFC9BE442, 0xD7DE8CD0, 0xC9DDE6A1, 0x0A52E40F,
+   0x1C7149BC, 0x05A4FF64, 0x5F2F3AA5, 0xCC966D0D,
+   0x6E2D25CD, 0x5ECE6A19, 0xF6441A77, 0xCD0A1086,
+   0x85904D79, 0x1C273600, 0xCF8C85AC, 0x44A59F2E,
+   0x000000AA, 0xDB6BFCDE, 0x266FA397, 0x8BF6394F,
+   0xF68D7A36, 0x14A079D4, 0x0D191622, 0x3F93FDE7,
+   0x3FC59BD3, 0x691C417F, 0x9EDBB13E, 0x4B6D9AA9,
+   0x50A5045A, 0xA35B9642, 0xF5F738D8, 0x471D4F3C,
+   0xD0FAB4F3, 0x0000013A,
+   0xB1340C26, 0x38D50AE2, 0xBD6C48BD, 0x98D9A11B,
+   0x2A770FB2, 0x71342C9D, 0xD42C16B6, 0x641B25AA,
+   0x00A7B958, 0x9B9CAA69, 0x1C6F21FA, 0xB2E0F3D2,
+   0x4EBDFF9E, 0xCAA3C085, 0x7FF33500, 0x90744337,
+   0x000000A5, 0x9295497E, 0x680BFB3C, 0x5BE8F97D,
+   0xCD4C1CC2, 0xCB911F56, 0xFE7DEE3B, 0x6980D877,
+   0xABBDFD21, 0x66109F84, 0xC134EFD5, 0x3ADBCE88,
+   0x83200BC0, 0xDECBF40A, 0x1AE3359D, 0x2135D328,
+   0x4F63ADBE, 0x000000AA,
+   0x98A740FA, 0x13CC8A37, 0x2632ECE5, 0xC99AA3ED,
+   0xB9E1C72B, 0xEAAEECD6, 0x56487374, 0x3AEC5C49,
+   0x14674797, 0x89A403CC, 0x6E0C69EC, 0xCA0EA19A,
+   0x8ED9F435, 0x86B528A6, 0xBCE563B4, 0x06BE957D,
+   0x0000005D, 0xCA34ABFB, 0x35D9C838, 0x4F813C5E,
+   0x0DD8CB6D, 0x56DFECFD, 0xAAC57A03, 0x37223E93,
+   0x0F119093, 0x5B447B8E, 0x5F8781C9, 0xED13B66B,
+   0xAB2F96C0, 0xE3AF9074, 0xD38636EB, 0x68DA2B8A,
+   0x296C5782, 0x000000E1,
+   0xD3C3AA79, 0x393A7DCB, 0xA23C9656, 0x8A3A2240,
+   0xCF3EEFEE, 0xDBC3A5F8, 0x43801F53, 0x128E5DF2,
+   0x9F3B1E81, 0x2915BD67, 0x741C8852, 0x9C317104,
+   0x67107EB1, 0xDAD2C028, 0x94300EAC, 0x17C5C249,
+   0x000000DD, 0x90087C9C, 0x8E333830, 0x533F2A2C,
+   0x3B477580, 0xA0B8FC27, 0xB6395D04, 0x26AC5091,
+   0xE16F86D6, 0x1370DD63, 0x37696872, 0x0DBDA08B,
+   0x17277A7F, 0x00825EC2, 0x7CC056E8, 0x39724E7B,
+   0xA37C9522, 0x0000002D,
+   0x1426B278, 0x3F8344D5, 0x9A9B479B, 0x8F7DDF8A,
+   0xC669901C, 0x1A964EB3, 0xCACCB2C3, 0x6FA4CD8F,
+   0x06E7AD1F, 0x65FACC37, 0x90A7F25A, 0xF29FFBB4,
+   0xE68A505E, 0x3D1AD490, 0x88D6E4E6, 0x5A5CD3FA,
+   0x000000BA, 0xB503A9C8, 0x9CA4B1FB, 0xAD8685F3,
+   0x94938BF8, 0xF178C339, 0xE9C8FB4A, 0x5ED5928F,
+   0xBFC000D2, 0xE7298BF4, 0x7B8B0F6E, 0x7FBA0571,
+   0x46C7096A, 0x3DD656A8, 0xDE65DC55, 0x41A31A9D,
+   0xEE6B6223, 0x00000196,
+   //Window 108
+   0xD6E1BD72, 0xA66CCCC8, 0x4AE2FA5C, 0x1EA4E921,
+   0x2D021FA7, 0x66775AF2, 0x2A4C4677, 0x6D711DFB,
+   0x5AE380B3, 0xDDAAE8BB, 0x600F11FC, 0x53158994,
+   0xDA94D443, 0xFEB122DB, 0xDFFC21DD, 0x7CBF1AFA,
+   0x00000006, 0x834BF891, 0x03CFA731, 0x630B8032,
+   0x4E016085, 0x49DB4D96, 0x90CF9B59, 0x335C9DDD,
+   0x96FD2614, 0x8E3B98FB, 0xC0214510, 0x1DA2EA2F,
+   0x6DED0633, 0x9D0EAD76, 0x2BDA6D76, 0xF3E4FBF2,
+   0x4BA00E99, 0x00000169,
+   0x54203519, 0x20E1DBCB, 0x6854FA65, 0x4731F4A6,
+   0xF769FD0A, 0x79D73800, 0x86246CCE, 0x248F6752,
+   0x6D04D079, 0xB63DCA39, 0x0FE5DE22, 0xC90D6EB8,
+   0x0760287E, 0x0BD86EE3, 0x035A202B, 0x1687F7CC,
+   0x00000073, 0x5D18000D, 0x34FCAD34, 0x9808E5C8,
+   0x8E27D9D2, 0x5483836F, 0x5A3199E5, 0x62C5CAE8,
+   0xE786EC7C, 0x82F509DB, 0x22D732EE, 0xB6898EAF,
+   0xDE5C5E2C, 0x8BB31048, 0x0F051A38, 0xB732B905,
+   0x69536133, 0x00000003,
+   0x39E84CE3, 0x2373EAEB, 0x0B9EC7B3, 0xBA04CA2E,
+   0xBD2194BD, 0xE2B50DD2, 0x513F5EB8, 0xC663BB29,
+   0xB8E768D2, 0x46B010AC, 0x9514B2AE, 0xC8DD6993,
+   0xAC22E17C, 0xF90F39CA, 0xAC54AF6B, 0xA1420DC6,
+   0x0000016B, 0x8AF82DBB, 0x60F5772F, 0xF75E8910,
+   0x7E43A57C, 0x233CEA7B, 0xC53B8A3C, 0x98AF58B7,
+   0xE43935A7, 0xF772327B, 0xBF5354E9, 0xD8F71CCC,
+   0xA022B423, 0x8037F9C6, 0x58E76A75, 0x0DD3213E,
+   0x502B6D11, 0x00000001,
+   0xB04B2D70, 0x2600BAC3, 0x4CF3F9F9, 0xA595B33F,
+   0xD99E871D, 0x21660D3E, 0xA9394803, 0xEB5E976D,
+   0x8A1ED4EF, 0xE205F3CF, 0x81DFBB0C, 0xAA94C332,
+   0x055BB2D8, 0x00F0CD08, 0x5AFC00FB, 0xAD655248,
+   0x000000A2, 0xA2BF8AFB, 0x9B28D5EB, 0x4A8A5D19,
+   0x2196D770, 0xE884658E, 0x0ABD9B8D, 0x16799F11,
+   0xADA571E8, 0x87CA21A3, 0xBE86DC57, 0x3FE855DB,
+   0xAA5680F6, 0x1DB10908, 0x0B830860, 0x8DCEB82A,
+   0x3ED53BC2, 0x000000B4,
+   0x3256A2A9, 0xABE58A0B, 0x58EF9132, 0xEFD4E174,
+   0x1BD0239D, 0x852B55AD, 0x9886893C, 0xE13EAD71,
+   0x027DF6DA, 0x1F3D564A, 0x9DD69E26, 0x380277D4,
+   0xDAA13C20, 0x2F10271E, 0x57F5E69D, 0x05AD37F2,
+   0x0000003F, 0x084CF133, 0x05202CEB, 0x9F275791,
+   0x09C2AC4A, 0x4E0EAA44, 0x49F9FC48, 0x4F9AB612,
+   0xD58A0B21, 0xF9AE85AD, 0xDE7D9174, 0x994E0EC3,
+   0x98300CC9, 0x13D32ABD, 0x29354FAB, 0xE712E586,
+   0x5981C83F, 0x00000016,
+   0x6A8A53AA, 0x5A7577FE, 0xB43AA587, 0x87AE224F,
+   0x1AE1EFC5, 0xB369D831, 0xE6B83640, 0x2E7FEC9A,
+   0x854FDA1B, 0xA88165DB, 0xCD2E67AA, 0x04FDEF49,
+   0x68D3C412, 0x3DD3F688, 0x62B2EABB, 0x1E676493,
+   0x000000B8, 0x498E4198, 0x4D7B8A0B, 0xC657CFA4,
+   0x8EE7B890, 0x057171B3, 0xA67F6AED, 0x849438C0,
+   0x366299D4, 0x01439A26, 0x2F51668F, 0x4ACEF213,
+   0x1F2E7703, 0xDA175413, 0x97D26BA8, 0x13D9E1FC,
+   0x5975516E, 0x0000016F,
+   0xCE891C09, 0xEB20640A, 0x5F15E09A, 0xEA93BE78,
+   0xA0500353, 0xCD71C1C0, 0x9D421345, 0x69A5F49D,
+   0x9586DD2D, 0x27B7CEC0, 0x35ED0F09, 0x2916A3EA,
+   0x86D0F9D7, 0xDB2356D2, 0x16035F2D, 0xE763D6E7,
+   0x00000150, 0x5626F5F5, 0xED0A7004, 0x4DE0844B,
+   0xA88A218A, 0xE99CB20F, 0x49105B7A, 0xCA883D1B,
+   0xB7948829, 0xF3C37155, 0xCB83FB3F, 0x47C71921,
+   0xD0DC7D0A, 0xED260DDF, 0x2B8025CE, 0x333621E1,
+   0x501C1989, 0x00000079,
+   0x43D9EEFC, 0x5C908593, 0x7AB85F26, 0x8155CF92,
+   0x38843B4E, 0x1913352F, 0x86CE445D, 0x8E415804,
+   0x64C772C4, 0x713ACF53, 0x4A43FF4C, 0x4F0B9D87,
+   0x0CA46DC0, 0x08447D95, 0x177AD6B1, 0x3281D130,
+   0x0000009B, 0x504173FF, 0xA59598C0, 0x0525B317,
+   0x33D4B7B7, 0xF87D01CD, 0xEBD813AE, 0x71DD6AA4,
+   0xCB7B0C01, 0xE3A9D734, 0x5E3AF075, 0x7149593A,
+   0xC713D3B3, 0x3934FA98, 0x3C08554A, 0xA0EC8E99,
+   0x2DD58329, 0x0000014C,
+   //Window 109
+   0xEE32E2FF, 0x6985BBD6, 0x3C35A00B, 0xE69F0F22,
+   0x0EDE3C1B, 0xB1ABB4AE, 0x93D96532, 0xA3D7ECDE,
+   0x4F693CAB, 0x69EAE259, 0xFE3665F9, 0x52E38B65,
+   0xF2FA7A85, 0x17664E93, 0xA5300907, 0xE1A2FEBF,
+   0x00000000, 0xA538774A, 0xBB35EF0C, 0x2B28E6FB,
+   0xAC9AA3CE, 0x0A801EDB, 0x57E02D06, 0x94847324,
+   0x69775443, 0x29DD0A3B, 0xB526BB19, 0xC468815F,
+   0xAED93900, 0x221DF814, 0x3EB1B9B2, 0xD9472DAF,
+   0xE421E27A, 0x000000B9,
+   0xC03C8A93, 0xFD2C6BA8, 0x255A51A6, 0x6287BAAE,
+   0xFC336858, 0x6CDE095E, 0xACB5FB8C, 0x668C6F54,
+   0x568A5789, 0x26B65582, 0xFCFEB7BA, 0xD51684EF,
+   0x8DFE63FD, 0xB5D91D3D, 0x560188B9, 0xD366CAE7,
+   0x000001C6, 0x9844367E, 0x587D06CC, 0x589D9ACA,
+   0x527A075F, 0x4F88CCDB, 0xD581AD9F, 0x3A56CA59,
+   0x3499E807, 0xD6328D96, 0x50B8B14D, 0x5936A744,
+   0x9B06CE84, 0xE693DA36, 0xAB46F398, 0xBC55F498,
+   0x4C5E0D9A, 0x000001E0,
+   0x89B694F7, 0x14DE1069, 0x453ED74E, 0xFA202A91,
+   0xB7C462B0, 0x19344093, 0x9D5F7733, 0xDDB9F115,
+   0x6E71EFCB, 0x6110F1CD, 0xD27D9F95, 0xE9DBC336,
+   0x1BA3BB66, 0xD9B29E01, 0xA9677CF4, 0x7B218536,
+   0x00000178, 0x0EAFDB07, 0x7FE68784, 0x1C0D642F,
+   0xDE335A45, 0x208D5237, 0x11B4B98A, 0x36B0801D,
+   0x53F2C202, 0x5CDE08E1, 0xF07F2093, 0x0F34078D,
+   0x5E0E5D3A, 0x80286B22, 0xF1FC7F34, 0xC48E9216,
+   0x4C305A8B, 0x000000F4,
+   0x814ABC1C, 0xE030FEB9, 0x7387FCFD, 0xAA7EF742,
+   0x47E5CE93, 0x134E4EA8, 0x2949FFB0, 0xCE9F3CB5,
+   0x3E11A1C5, 0xA83252A8, 0xBA0F2644, 0x2B308229,
+   0xEA75A292, 0x1EB76FB7, 0x73CF1481, 0x0D9BD36B,
+   0x00000021, 0xC50E223B, 0x45BDD68D, 0xA6C0BE76,
+   0xC6A83635, 0xC0E1F910, 0xAA61EA3F, 0xE8FD27FB,
+   0x7AD38095, 0x796C8EFE, 0x2DEAA3B2, 0xD099BCDA,
+   0x9AD0A578, 0x2A953EA1, 0x5819856A, 0x593D3E2D,
+   0x2B7B7793, 0x000000DD,
+   0x799716A6, 0x8C0FBBD4, 0xAA53A2AF, 0xCC051818,
+   0x6044B4D4, 0xBCA333E8, 0x85C795F0, 0x119F4FF5,
+   0x7EA3CADE, 0x4B480CB5, 0xC4C1C28F, 0xCED7FB1D,
+   0xCCC703CE, 0xCB53655D, 0x8C5540D0, 0x1FE0B753,
+   0x000001CC, 0x7C5BC459, 0xD937F395, 0xAD67F0A0,
+   0xB6756328, 0xFE7C0533, 0x3A5BC8D0, 0xE4565F1E,
+   0x796AC0B0, 0x4913C2C0, 0x8377D588, 0x7D65704A,
+   0x2FAA11AC, 0x5E625BDE, 0xE207FFD2, 0x68BD440A,
+   0xBF3D6890, 0x00000147,
+   0xDC9FC49B, 0x32269C1B, 0x9FC27F50, 0xAD26E06E,
+   0x6B4E84A9, 0x40D2A97D, 0x910EF791, 0x736B98D4,
+   0x78702918, 0xC48559B0, 0x61BE6975, 0xB38B8608,
+   0x35B00E9C, 0xCC86B5AC, 0x335D2DCF, 0xF06C1FB5,
+   0x00000177, 0x658A4588, 0x24BFE015, 0xAB32678A,
+   0xBCF3AF27, 0x60ABC5B8, 0x55E6B2E1, 0x917C8360,
+   0x55FB213B, 0x2F427C30, 0x9E981ED5, 0xC4FAB94C,
+   0x43665885, 0xC0AFABE4, 0xBF8864FA, 0xCEE3A355,
+   0xCABD2939, 0x000000FC,
+   0xA0C707CB, 0xEEFC28BA, 0xB5E8A4B1, 0x610A0BF5,
+   0x9B53D25E, 0xD74559F3, 0x504C5E8B, 0xB987896D,
+   0x7B25A6B9, 0xAE65DD13, 0xCF659983, 0x967698FE,
+   0x302CB07B, 0xA10CF8FC, 0x4447F110, 0xC116F1C9,
+   0x0000019A, 0x74B590EE, 0xCA833C3F, 0xA90703DB,
+   0x6099AD10, 0x8DC0A094, 0x1B05EB47, 0xFD61F58B,
+   0x8E611A9F, 0xB6376B63, 0x220F8E3C, 0x6276C206,
+   0xD3EF40D0, 0x80BE240C, 0xB496ED2C, 0x4C62D68F,
+   0xCC1E4FEE, 0x000001E9,
+   0xF3338F86, 0x6A2D32B0, 0xC9710433, 0x4A5C3DB2,
+   0xA5F68F1A, 0xD298F3B0, 0x732D40D5, 0xAE78B804,
+   0xDC109412, 0x860D74D8, 0x2C898732, 0x0F3D42CE,
+   0x3D321599, 0x63E5CB19, 0x1462A77E, 0x796C17CF,
+   0x0000003C, 0x17837E4B, 0xBB71E1B9, 0x89CF36DE,
+   0x9711DFF8, 0xB1FD56B7, 0xDF6C0A2A, 0xD7E8E866,
+   0x6F07FDD1, 0xB4F1BD81, 0xECFC1BA5, 0x29DB023B,
+   0x4AC6B88A, 0x6DE37B7C, 0x2BB7F22A, 0x2C35FA00,
+   0x86E37D90, 0x00000113,
+   //Window 110
+   0x4C7F31F1, 0xA0F946B3, 0x004B810D, 0x122B97EC,
+   0x831A9CB2, 0x98F876D1, 0xAEBD922B, 0x6690030A,
+   0xA21B0412, 0x12A235D1, 0xE097208F, 0x5CED8104,
+   0x49D32FB6, 0x049B33ED, 0x87B187EB, 0x2E88D762,
+   0x0000007F, 0xAEAAA0D2, 0x08801D4E, 0x6FC2830A,
+   0x3B052B0A, 0x6FEF40C1, 0x4E02318F, 0x06F38ABB,
+   0x5A24478A, 0x6DEDD4F3, 0xC90C5392, 0xFF07397B,
+   0x402E4A9E, 0xF1BDEC37, 0xDE13D7BF, 0x727EB837,
+   0x8A363CCB, 0x0000014D,
+   0x02073B42, 0x9339BCD4, 0x508C4450, 0x464A00B7,
+   0x46920E8E, 0x682F569B, 0x60F834A4, 0x8A375EA9,
+   0x4FC9FFA6, 0xCAA2DE7F, 0x7FE428F9, 0xA459885F,
+   0x7E3615F8, 0x8E021946, 0x96B9672B, 0x5D474ACC,
+   0x00000009, 0x1CAD08CC, 0x2C82B730, 0x436617AB,
+   0x6946F74B, 0xD7609D10, 0x504929FD, 0x3A2F7D9E,
+   0x1B8D9D65, 0xA7334A68, 0x1E950D1A, 0x02579D4A,
+   0xF54624EC, 0x8ED35507, 0xA140CA97, 0x719B1CCA,
+   0x57D56BD4, 0x0000017B,
+   0x80C28BF4, 0xABBA86CF, 0x871CF3FA, 0x9538A468,
+   0xA1F3F1D1, 0x1E2585F5, 0xF4E26D02, 0xD8B5E352,
+   0x1D575767, 0x6B0AC27A, 0x67B4036F, 0x5BE4D5D9,
+   0x02A0F315, 0x9D395B76, 0x35500539, 0x61FD5FE0,
+   0x0000002E, 0x4BD2A24C, 0xC7BBD9A0, 0x59228721,
+   0xABD2E4B6, 0x70C8F092, 0xCC7DA00A, 0x851F19B5,
+   0x4BBDB0C1, 0x733CEE95, 0x983BB01F, 0x0F0A976E,
+   0x55C1E41E, 0x22B03859, 0x3ED74ECD, 0x581A900D,
+   0xCB950E0E, 0x00000169,
+   0x5FC08E46, 0x103AE8BB, 0x42569A60, 0xA91E2786,
+   0xF28AF01E, 0x0BC29EA3, 0x20B341B1, 0xDA612528,
+   0x388F1E0D, 0x84CA3C31, 0x4DD18EA0, 0xD6DDC0F4,
+   0x4296A5E6, 0xBFBD8013, 0x88C34065, 0x91F3F3E3,
+   0x000001A9, 0xFE14A17D, 0xD7D6DEA4, 0x574EDC98,
+   0xFFA3FB5B, 0x13730FF8, 0x92012332, 0x42AB408F,
+   0xADE8B732, 0x4D2FC00D, 0x1BC6FC5B, 0x7179A2E8,
+   0x70CFE234, 0x3727D19C, 0x77D164A1, 0x60B6C0A0,
+   0x99CDE7AD, 0x00000032,
+   0x4DF980EE, 0xDD33C7F0, 0x8EEB374C, 0x0D9F6DF5,
+   0x650994C0, 0x76546027, 0xA3295A3F, 0x56D220A7,
+   0x9D766C58, 0x3BA66FEA, 0x4DDBD549, 0x8F29308D,
+   0xD5FF0D1F, 0x5B91281A, 0xE129ED08, 0x17B0A13A,
+   0x00000152, 0x9FA0A068, 0x6EBD0769, 0x1887635F,
+   0x471CBD5F, 0xE70C32EF, 0x90BE2C9F, 0xE8BCEBCE,
+   0x9E48CDF4, 0x86176CFC, 0x3A946D9B, 0x298E8001,
+   0xC1396933, 0x94EDE84B, 0x2263BACD, 0x68473DEB,
+   0x4916552B, 0x00000048,
+   0x00093320, 0x36E646DA, 0x44FD6890, 0xF8AD0B6F,
+   0xF579A2D3, 0xD80F5894, 0xC953588F, 0xEBF0959B,
+   0xA8B7F6AD, 0xEFB4708A, 0xCFD950DD, 0xBD864867,
+   0x48DBBE5D, 0x2127BDB1, 0xFAEAABA5, 0xCBFCBB6B,
+   0x0000005D, 0xD992462C, 0xFE12CD7D, 0xE91274C6,
+   0xB35F2215, 0x71E12E2E, 0x5D4F3E3A, 0xB02CA3C1,
+   0xCA836FF3, 0x1A987915, 0x7A1C86A2, 0x7F55D465,
+   0x234E79AE, 0xC94D20D1, 0xD5F60470, 0x60C432DF,
+   0xB14A537A, 0x000000EE,
+   0xA7B24726, 0x077B993E, 0x1F52FC88, 0x3A154BC6,
+   0x03D0D6D9, 0x345D842C, 0xC2020B38, 0x3ABE2832,
+   0x80CC5686, 0x77B69CD9, 0xDA81F16F, 0xD5941509,
+   0x144FE24C, 0x175C5437, 0xA2C06C33, 0x920FF5BD,
+   0x00000104, 0x7DB14C67, 0x475F7404, 0xD5B5410A,
+   0x97576406, 0x9D75BB07, 0x7F3355EB, 0x13388958,
+   0xBE8D9E41, 0x29267594, 0x09C5821D, 0x7FDC8CF4,
+   0x02A32D34, 0xF4034960, 0x2B4D266C, 0x79883A2E,
+   0x97925542, 0x000000BE,
+   0xCA9B65AB, 0x55E93ADC, 0xEC608FC9, 0x04050554,
+   0x1545BA49, 0x452525FD, 0xFEF175DE, 0xE1671F6F,
+   0x510AB002, 0x94C7E1C1, 0x4A4DA615, 0x490E7CCD,
+   0xD36BA72F, 0x9116AD80, 0xCD7FE251, 0x8B72D3E0,
+   0x00000140, 0xE30FA947, 0xC4F0896A, 0xEC42E041,
+   0x90BB6AB2, 0xFCE3EDF0, 0x30C427F1, 0x9D63E28E,
+   0xBF4D1599, 0xC3C6B47B, 0x0B4E93D3, 0x01217870,
+   0x513A0609, 0x861391DD, 0x2B2383A0, 0xC813B08A,
+   0x8DF6CE1C, 0x00000178,
+   //Window 111
+   0x8114885D, 0xBF07E90D, 0x9F39A562, 0x76D513B2,
+   0x7E5446A1, 0xD98AE4F7, 0x6264B6C0, 0x7E3314E9,
+   0x6F3A7560, 0xE634DEE7, 0xA08D539E, 0x1DFA2392,
+   0xBDAE3C53, 0x45764812, 0xD824E9AC, 0x858B836F,
+   0x0000003E, 0xE324EA11, 0x9BDD0365, 0x1117CDC2,
+   0x9625D01B, 0x7F6C259C, 0x491EA642, 0x125826F0,
+   0x61B79486, 0x18A56486, 0x573DEBC8, 0x0D31132A,
+   0xE224DD3B, 0x80BE8263, 0x075C3BF7, 0xB84A07FA,
+   0x0ECED67A, 0x0000010E,
+   0xAFFBD971, 0x82E9010D, 0xC7AC3199, 0xAB6FEA0B,
+   0x50383D27, 0x8D388940, 0xBE775398, 0xC37AB3B3,
+   0x54BF74AA, 0x8EF10AF1, 0x52AEAF9B, 0xA1C39ED4,
+   0x70F42D7A, 0xCD2B6EE6, 0x38A53A34, 0xCB576437,
+   0x00000087, 0x6F80E03F, 0x5A141699, 0x408678E3,
+   0x0D7A7AB1, 0x7D279AA8, 0x33DB44D8, 0x32A33193,
+   0x25E82C90, 0x7FA96201, 0xC68F4373, 0x1C15C8C4,
+   0x4E2FBE8A, 0x5429A403, 0x5B5CE805, 0xF6543E19,
+   0x1DC2F304, 0x000000D0,
+   0x4319C263, 0x75605B03, 0x9E4740E2, 0x887FDFBB,
+   0xD43F9B89, 0xDE488A31, 0x8E84F79C, 0xB0E69166,
+   0x70A03015, 0x8AD2CF65, 0x9151CB55, 0x20C0C8A4,
+   0x0538315F, 0x9C4D5810, 0x12204FA8, 0x18B7EB27,
+   0x000001C0, 0xCD3D6255, 0x2701F40C, 0x684DB0FB,
+   0xB6302374, 0x5986C5A4, 0x1934BD38, 0xAC3EB927,
+   0x277CA623, 0x3C9260CA, 0x1F8E83F3, 0xCDD488C6,
+   0x1D42B0B1, 0x02069BED, 0x03DD5062, 0x0713FB4C,
+   0x1EDF5BE8, 0x0000012D,
+   0xAFA6274E, 0x8C466EC6, 0xE57D9338, 0x935AC8E6,
+   0x7B5CA188, 0x3FFE008E, 0xDFBB530A, 0xFFD8BA41,
+   0x67D0B3E8, 0x9504DBC0, 0x622F0B00, 0x95EBDE8C,
+   0x209C6309, 0x984BC63C, 0x6B23D9DB, 0xB2BDAF4A,
+   0x000001F8, 0x0E2BB6E9, 0x24836324, 0x65CC3116,
+   0xCEF90F5C, 0x16BBF8DD, 0x4C71C808, 0x8DE8D626,
+   0x0D6CCBC3, 0x60C000D7, 0x6E51FC29, 0xDFFF70D3,
+   0x1E3116E3, 0xDD570C6E, 0xF3D91182, 0x6827D006,
+   0xF02FBB1B, 0x00000191,
+   0x45C1EC84, 0x98E1B7CD, 0x97C41E14, 0x8DFD070F,
+   0xCE5584AA, 0x4F93F2D6, 0xDAF1AAE8, 0x83CCC00C,
+   0x5BD38070, 0x03F86BFF, 0x054598DC, 0x30CB6C33,
+   0x68374E10, 0xB1FED348, 0x5CF277CA, 0x9C897874,
+   0x00000169, 0xBA7202B8, 0x93E3292B, 0x5EFE5E0A,
+   0x9BF6BB8C, 0xA72BFB76, 0x4E60A072, 0xEAFBE064,
+   0xCF81DD11, 0x3CF22212, 0x78DD4B8E, 0xE06102F8,
+   0xE7BCFC86, 0x2216B8D3, 0xBD9EA3D1, 0xBC4070B1,
+   0x3BAE1822, 0x000000A4,
+   0xFA3BC4E4, 0x877929F8, 0xFAEF537C, 0xF80C68CF,
+   0xC3781055, 0x46155660, 0xD37E0555, 0x8B8751DD,
+   0xF4D36DD8, 0x3C7BD08C, 0x74E492CC, 0x34F961E9,
+   0xF8A1A62E, 0xCCF30DE3, 0x8E542B39, 0x1CE2AAB7,
+   0x0000003F, 0xE9045828, 0xA5FEA9FC, 0xB6F8F8C5,
+   0xCC644992, 0xDF87C951, 0x27B0E110, 0xF3DBE018,
+   0x13F4085D, 0x8CB0BB42, 0x9302425B, 0x3F75C533,
+   0x809DC445, 0xAD0CCA97, 0x195079D0, 0x825A7BAD,
+   0x771600A6, 0x00000169,
+   0x14008E42, 0x4ACFFB12, 0xF91928BF, 0x57FF2025,
+   0x35D4BC10, 0x143EE044, 0x5D88D031, 0xF399BA61,
+   0xDA5B2FB4, 0x001EBF89, 0x79B208A7, 0x87FA0C98,
+   0xFBBB3515, 0xE220C7F0, 0x5F998E14, 0xA164B1DD,
+   0x00000174, 0xC6F7B10E, 0xA7E6B624, 0x016986B8,
+   0x30689EAA, 0x47900CE5, 0x4CC8C5AC, 0x66015B32,
+   0xBDDE88F7, 0x537F1089, 0xFA448783, 0x6960D0DA,
+   0x600DF0E6, 0xFB7FF390, 0x4862B361, 0xDB599DF0,
+   0x3C49EB25, 0x00000162,
+   0xE13A4B52, 0x5F5321E7, 0xB8F57933, 0xDC01C122,
+   0xE4DDA5DC, 0x9C581932, 0x50EA66FC, 0x17DC2A5B,
+   0x0972A65F, 0xFCFA3931, 0x41574E43, 0x2F1D6E5E,
+   0x3284800D, 0xACC1B35D, 0xF86EDBF1, 0x33A5A980,
+   0x000001F0, 0xD6B8E0BF, 0x1E4B09CE, 0x4D865022,
+   0x8ED903E5, 0x4B000CD4, 0xAD77BEEC, 0xE6F37BD0,
+   0x702DE766, 0x1271DF67, 0x941B9AFA, 0x585028F5,
+   0x70DCF9EA, 0x3382BA86, 0x0FB74118, 0x9754CE73,
+   0x1790C78D, 0x0000012E,
+   //Window 112
+   0x8F69079E, 0x6D7EEDC4, 0x4F03B92F, 0xF02E8E40,
+   0xCB76B181, 0xDF751116, 0x234C1925, 0xC255EB2C,
+   0xA94AF9B2, 0xAF997D5E, 0xD1374A41, 0x797F3DF0,
+   0x23986CDA, 0x357FD20B, 0x1540ADB8, 0xF1CACCDA,
+   0x0000007D, 0xC01605A9, 0x2A04363C, 0x7D7D1E54,
+   0x0D7CC0D8, 0xA0F9FD2B, 0x0515EB70, 0xBB4EC5E8,
+   0x725D12A9, 0x3A6EB09A, 0xD1B5B8A3, 0x87027D7B,
+   0xB6C836B1, 0xAAF9CD03, 0xF4773322, 0x2500C647,
+   0x2FB3354E, 0x00000081,
+   0xF2AFAE47, 0xFF2FA49C, 0xF9F2B257, 0xA2C86068,
+   0x46CB76EE, 0x73DD56A4, 0x7DC0A64C, 0xBFFB9F01,
+   0x44B4A4EE, 0x0EE2B60D, 0x37C5959F, 0x49939F08,
+   0x78603DE3, 0xB302FCD1, 0x4017C122, 0x03C2A220,
+   0x000000A7, 0x57413107, 0x48ACDA97, 0x4C01CAF8,
+   0xBD8F584D, 0x1AC29755, 0x38F448A7, 0x6D29BF3E,
+   0xCC388483, 0x74401FED, 0x15C4BAF9, 0x9023BC05,
+   0x7826E5CD, 0x4F459413, 0xC7A70D09, 0x31896429,
+   0x1DE803C6, 0x000000B8,
+   0x13DC8B45, 0xD1DA41A1, 0x8A639B8D, 0xF4886D24,
+   0xDEF9C5C3, 0xF3431CCE, 0x8C204A2F, 0xAE07317D,
+   0xF3D6383A, 0xCBBD49A1, 0x29BBE61E, 0x43D35932,
+   0x9643A1A8, 0x6BFA0609, 0x2005A71F, 0x391499B2,
+   0x00000188, 0x79D0771B, 0x40774A7E, 0x595038A1,
+   0x31987151, 0xC48B5063, 0xFF6DF557, 0xC3751769,
+   0x26C03269, 0xD2D0CE99, 0x660C36CE, 0xD3D79EA0,
+   0x71378E21, 0x30BE88EA, 0x7B2EC7EA, 0xEAED0F73,
+   0x1B342D41, 0x0000016D,
+   0xE138D37E, 0x47DE9D47, 0x3E7E1C87, 0x7387F369,
+   0x0A48AF71, 0x9C00813E, 0xE8829FCD, 0x9DF47C63,
+   0x19E24A68, 0x7DC7C048, 0x6942E130, 0x3D1823E1,
+   0xA2CD6199, 0x2F4440FF, 0x98168AA8, 0xEBF60BE0,
+   0x00000049, 0x3B5F346C, 0x98969007, 0xB79AE683,
+   0x00A0ECF9, 0xF8FB676F, 0x1B6F0DDB, 0x7998C836,
+   0xD536D371, 0x9C4BC7CD, 0xE1DBDA54, 0x71E12239,
+   0x2B752CA3, 0xC296C03D, 0xD633D0EE, 0x9F6A0015,
+   0x548B37C5, 0x0000003F,
+   0xA4851434, 0x4DA845A0, 0xEC7C655C, 0x75176AA6,
+   0xF093C7DA, 0xCB64F9E9, 0x44BF8C6E, 0xF80504E6,
+   0x001AC4A3, 0x13958864, 0xDE28FBB9, 0x067E1167,
+   0x708782DD, 0x0EE319D6, 0xF0A8A799, 0x90E661F3,
+   0x000001C5, 0x5DB20757, 0xA161CAA1, 0x5350825A,
+   0x2ADAF4E0, 0xBCC582C0, 0x5E2BD35A, 0x71A3BC28,
+   0x9989C8FE, 0x28898A24, 0x454827E2, 0x2FD729FE,
+   0xA7108D02, 0x8C310F5C, 0xEB2B76AD, 0x634C3D7E,
+   0xEAFD847E, 0x000001AE,
+   0xD77089E3, 0xD7F60F17, 0xA10CB23F, 0xB68B3C61,
+   0x094E8BD2, 0x72A83575, 0x915A575D, 0xD9A28D29,
+   0x211C2F4B, 0xB30E811F, 0x58119EBF, 0x3A62FCF6,
+   0x679EAA2A, 0xB692E3BB, 0x3FE29C8A, 0x2375E13C,
+   0x00000069, 0x2B8B53C8, 0xD613B9EA, 0xAEFE8D7C,
+   0x6AD8D6EE, 0xB1D6FB5B, 0x25163969, 0x76A6F0D4,
+   0x6B37519E, 0x59EAA8EA, 0x8FC92083, 0x560539CF,
+   0xD2A15A1D, 0x0F7E555C, 0x35D7A7B7, 0x42A30FBB,
+   0x590426C0, 0x0000015A,
+   0x3A7F3608, 0x17905830, 0x26F0FC61, 0x172DE35E,
+   0x34D7C1A1, 0x323D2D73, 0xAEC45ADF, 0x464CD498,
+   0x62AE054F, 0xC4F38D50, 0xA66711E2, 0x3F016202,
+   0xE8D33E40, 0xD105F907, 0x75225100, 0x3A102B6A,
+   0x000000FD, 0xDD02719A, 0xC754A811, 0x4BCC6CEF,
+   0xE4A5EA1F, 0x5FCC954D, 0x3D64CBA4, 0x12CF1EC0,
+   0xEFE41B2C, 0x969C79CE, 0xA8E5B613, 0x288A3A37,
+   0x42E6FB9B, 0xAAC4DCA8, 0x1C9E65A6, 0x6BD7BC54,
+   0x160703B3, 0x0000013F,
+   0x62E9C602, 0x01587286, 0xC7803839, 0xE3F31AA9,
+   0x0CEA9177, 0xECD16D81, 0x82B139B5, 0xE203943E,
+   0xA59EA3AE, 0xCDAE675D, 0x79B0B7AF, 0xACAFC1FD,
+   0x6D0E87EF, 0x1F3FF6B9, 0xD84B4B55, 0x3C52993B,
+   0x00000172, 0x415E906C, 0xC8FCF451, 0xCC223AFC,
+   0xF25CC44F, 0xF80C4A7D, 0xA0FB3F66, 0xEBEEC08E,
+   0x6C936445, 0xA50739C8, 0x35215495, 0xD8322E65,
+   0x9C197B15, 0xECC81FB0, 0xE263F119, 0x37BD4D5A,
+   0xEEEA2E6F, 0x00000148,
+   //Window 113
+   0x6EA09A93, 0xD7C0EFA3, 0xFB01C2B3, 0x95F69E09,
+   0xD43150E2, 0x021B1721, 0x5879BC51, 0x39FF07E0,
+   0x6CF50CE3, 0x0DD73C32, 0x5758870F, 0x9D69D32A,
+   0x1C0E91D9, 0x5DF4CC8C, 0x15DF54AB, 0x00335088,
+   0x00000182, 0xF2DC12F5, 0xBB656A89, 0x5C46FCF4,
+   0x6C4A32BB, 0x70E7A152, 0xF324462C, 0x1F7EAAD2,
+   0x4B1D509A, 0x76E51583, 0x3DA87FA7, 0x19FC86CC,
+   0x9A435E20, 0x9EAB8DE3, 0xB97D3F44, 0x8F92304B,
+   0xC56C7C98, 0x000000A8,
+   0xDC831AC0, 0xBA0A5D23, 0xBD41CFA5, 0xCF0FE6FC,
+   0xADEE7925, 0x11D490D3, 0x491D988A, 0xA8C359FC,
+   0x3FF98345, 0xB97A48A5, 0x1B8BB845, 0x6C8AC5F2,
+   0x5F157746, 0xA9C9F2A8, 0xCF6AD9A4, 0x79125887,
+   0x000001AA, 0xE8469532, 0x3DC5DB89, 0x639DF36B,
+   0xA9610220, 0x828BABAB, 0x5806F730, 0x60EF0FBE,
+   0x5AD5E58F, 0xAAD0A654, 0xBCDFE863, 0x34F936DA,
+   0x818CDC61, 0xD47DD376, 0x3B6839B4, 0xBE99035F,
+   0x80DB0098, 0x0000002A,
+   0x43FD6EA9, 0xE0D1A684, 0x4B132B1C, 0x3C786285,
+   0xE1183223, 0xE70C8B50, 0x67064358, 0xAF7CE546,
+   0x20FB8E29, 0xF14E5473, 0xAEB37723, 0xD26E97D6,
+   0x357A9627, 0x1B6CFAED, 0x7D572C73, 0x86CBFA6C,
+   0x00000127, 0x615A655A, 0x41863BAA, 0xC0B8C8B5,
+   0xA1E46018, 0x1848E283, 0x91F9506A, 0x24F30ED9,
+   0x86311713, 0x73FF5192, 0x0E29095F, 0xA154AE3E,
+   0x7D174A6D, 0x56F418FF, 0x6D82FCA2, 0x6758E6DE,
+   0x169D74DE, 0x00000025,
+   0x9421BA81, 0x9F890CFD, 0xEB89C503, 0x170442E3,
+   0x0F6BB510, 0xB9A7CCFF, 0xCAC864BC, 0xE381C120,
+   0xDECBAF8C, 0x2DBE97AD, 0xD26D2BB5, 0x635D5914,
+   0xEDCF3B9B, 0xE101D55E, 0xB30B7B2D, 0x80BE6609,
+   0x00000008, 0x11095C14, 0x89D01827, 0xFCABD0F0,
+   0xC1A8BC5E, 0x54AFA2FD, 0x3208EB50, 0xDF626743,
+   0xF8A273C7, 0x3F970409, 0x5E12751A, 0xFBE47F1D,
+   0x4EA70FC5, 0x5D85D582, 0xB03CEFDB, 0x92740E84,
+   0x31B9A796, 0x00000090,
+   0x2BC72AC0, 0x7D41A45C, 0xD4B22A6D, 0x3FEE89C1,
+   0x1A3E5166, 0x8C9E931B, 0x13C017DD, 0xE7A82089,
+   0x8A94D77F, 0xE13A4F36, 0xA2639DD5, 0xE560CEA3,
+   0x13998074, 0x0C0E75AF, 0x6F627382, 0x600F7E21,
+   0x00000064, 0x20B92051, 0x71563E46, 0x1D59C764,
+   0x99B6CA38, 0xA0876B4E, 0xF9BC832F, 0xC0A27F20,
+   0x3929D722, 0x14B56B70, 0x4700D587, 0x45CE0920,
+   0x40A3DEBF, 0x242D9004, 0xC0AB7289, 0x0192B6BB,
+   0x17C1874D, 0x00000024,
+   0x6C538825, 0xDAEE9708, 0xAE5F9B86, 0x9853E1FB,
+   0x4A134CAB, 0xA3C4A044, 0x9979280F, 0xBE74A873,
+   0x17C2F5F1, 0x05C4C48C, 0x3D5CC384, 0x27646C21,
+   0xDA50F906, 0x6ED0ADB6, 0x9DEF0584, 0x639DA5CF,
+   0x000000F0, 0x73B5196E, 0x6598023E, 0x52880ED6,
+   0xEC5EE4AD, 0x5C8C0AF7, 0x4ECE3807, 0xC677D401,
+   0x6A9C02ED, 0x8AB476E1, 0x0DD4435C, 0x2DA54119,
+   0x6923634D, 0x29E6661B, 0x10BEAF59, 0xF546FFB0,
+   0xEA400C7D, 0x000001AE,
+   0xED5578F4, 0x7695A838, 0x3F9CAEC9, 0x89EC15C8,
+   0xBFDA0BC5, 0xCEED49BA, 0x9B3C5ED3, 0x4B1216DD,
+   0x819C4425, 0xE023E37F, 0xFD42824D, 0xAE0847BC,
+   0xA5D967FE, 0xB499263B, 0xD9CF17D3, 0x523E3456,
+   0x000001BB, 0x6F4B631B, 0x1088B82C, 0xFB092195,
+   0x4660A76E, 0x20D69B6C, 0x94400A13, 0xD962B3B2,
+   0x74D5DBCF, 0x6E7ADCC0, 0xD65A5708, 0xCEEB56B0,
+   0xA61A9F5F, 0x8D35C057, 0x2BB73326, 0xBC726DDD,
+   0x8123773D, 0x000000A8,
+   0xCDA7E4F5, 0x7B6DC760, 0xFAA5CC54, 0x10C1E9B4,
+   0x8D94B3F7, 0x0AD30F5F, 0x9EDA4C20, 0x255EF5C9,
+   0x93A43D50, 0x7D27117E, 0x07BFF0AE, 0x46076CA0,
+   0xE9C87544, 0xEEAFD273, 0xAE4467B1, 0xBD487969,
+   0x00000186, 0x7A4E46D7, 0xC987F3D4, 0xE97EF62C,
+   0x827B5822, 0xB9A0DC98, 0x3B770F88, 0xF6EDA84F,
+   0xA205366B, 0x465A39A5, 0x5E3C7DC7, 0x62F9B211,
+   0x7219AE79, 0x11252014, 0x225B614B, 0x38124FDC,
+   0x5542DD58, 0x0000014D,
+   //Window 114
+   0xD6A37BAB, 0x4331CDCD, 0x85C741C8, 0x67B89137,
+   0x4FC72389, 0xAEFFCBDB, 0x1C7AE6DD, 0xCC12E59A,
+   0xEE1E838B, 0x4A35540B, 0xECD3E84D, 0x6148FB60,
+   0xB2290730, 0x7319E868, 0x4DE5208B, 0x4321BAAE,
+   0x00000160, 0x87717BB9, 0x10C813E9, 0xCFB9252A,
+   0xD9E1F5A8, 0xD7BDE47C, 0x0983C1F7, 0x5474E52D,
+   0x7446023B, 0x1941B518, 0x1F189DE8, 0xB425810A,
+   0x1997C69B, 0x58BCA332, 0xE15B5F1E, 0x49092985,
+   0x715DA4C9, 0x00000076,
+   0x33430EDB, 0x2CDA3987, 0xEE487EB9, 0x7F0593F8,
+   0xD8765895, 0xE458E275, 0x11BE3DF5, 0x45C2E093,
+   0x51450F54, 0x32545B1E, 0x49D52CFA, 0xF35BC1EE,
+   0xDA91CEC2, 0x59B8B719, 0xAB7FE631, 0x4426171B,
+   0x00000135, 0xE00A5618, 0x17C4E11C, 0xFE8BE941,
+   0x7A6FF5B1, 0x2C90C5D3, 0x72E91C8C, 0x80CFDF98,
+   0x9F450879, 0x06CE62FB, 0xB0D5D0D1, 0x57FA7188,
+   0xD9DEB715, 0xAC85D50B, 0xF1D09702, 0xA170E75E,
+   0x65AB22B5, 0x0000018C,
+   0xC2A1B7ED, 0x52BEA9DB, 0xE0D786E2, 0x7844CD85,
+   0x4D565A2E, 0x17168D7A, 0x155AFFB4, 0x1213C72B,
+   0x606A308E, 0x26A4857D, 0xB55B0018, 0x6F0560D6,
+   0x74E1B9CD, 0x7C8549E8, 0x9DEEEC3D, 0x322BA062,
+   0x000001CF, 0xF59FD1D3, 0x0A7016B8, 0xAEEBDF96,
+   0xA81CE2F8, 0x0F7E145A, 0x3AC89A8A, 0x70351907,
+   0x3FE8A38D, 0xBF10697A, 0xA636FD48, 0x7F93878C,
+   0x4C0F860D, 0x957D25E3, 0x546E63F5, 0x1DF8262A,
+   0x1FD01E4A, 0x000001BA,
+   0x8F3110B8, 0xE4EA02CF, 0xDE50A1E9, 0xFED60231,
+   0x0A8FE01A, 0x62BDA5E8, 0xADE31339, 0x882F5313,
+   0x26F12837, 0x30102CB9, 0xC1851E44, 0xBBFCD761,
+   0x073B2AE5, 0x6E1C5D2B, 0x357AD561, 0x1542324C,
+   0x000000FA, 0xC37D1A01, 0xA8EAC464, 0xAEEDD902,
+   0x8E5B465D, 0xFDAF7257, 0x7F7B68F5, 0xB4BADB28,
+   0xD88A2CF6, 0xE4102B12, 0xE0DFDE89, 0xAB851C47,
+   0x9ED8DAB7, 0xB4865D1E, 0xBB44BD5D, 0x7F2F666A,
+   0x0C6D69D5, 0x0000004B,
+   0x3B8D5865, 0x3346C5DA, 0x8F785CA1, 0xF9E60377,
+   0x6D5DC885, 0xCD7267D2, 0xD69CCFAF, 0x96DDF769,
+   0xD9594959, 0x2D6DBB25, 0x6B6F3992, 0xA04CB283,
+   0xF70BA665, 0x1A525509, 0x62535572, 0xD92BB7DC,
+   0x00000089, 0xD325263C, 0x11CED4D3, 0x67A97800,
+   0x7722335F, 0xFFDB96CB, 0xC5A85F2D, 0x72F44BE4,
+   0x1F96D419, 0xB9261115, 0xC1D49B3A, 0x2419B535,
+   0x0E5855B5, 0x4BA83BE2, 0xD30BC50E, 0xBF33F0DC,
+   0xC32FC472, 0x000001EA,
+   0xDC10EB96, 0xD55A28A7, 0xB772C881, 0xAD0D50F0,
+   0xF391A2CC, 0xE1574305, 0xAF3C73F6, 0x0406799B,
+   0xB80D865D, 0xADB82A35, 0x3E74DDB2, 0xC4AA10C6,
+   0xA31C89B4, 0x0F9FA673, 0xAB05EB58, 0x134B2949,
+   0x00000101, 0xCD00F753, 0xD3718BCA, 0x5581CDC6,
+   0xA01C7F4C, 0x8AE54A23, 0x25E7432B, 0xA8864359,
+   0x9F1F4BE4, 0xBA8918F6, 0x2578E281, 0x8527E2AD,
+   0x3DF9CA3B, 0x98B23373, 0xCF133441, 0x45D70A62,
+   0x32AD0CE9, 0x0000010B,
+   0x494EC6D4, 0xA8228EB3, 0x66E6036D, 0xF4C3F2DF,
+   0x987742CF, 0x4A0BCBE1, 0xE26FC56A, 0xC95B99A8,
+   0xBC55AC05, 0xC97D73EA, 0xE346B78A, 0x4ED64770,
+   0xFF5BA2D8, 0x3BE208DF, 0xD9DE7D1C, 0xDD2B3048,
+   0x00000134, 0x88C3BBB7, 0xBA1C0470, 0x7A3F7F2D,
+   0xEC2A0E1B, 0x7A37C017, 0x6714B176, 0xFCA5DCD1,
+   0xF37978EB, 0x6FE75A3D, 0xE1294148, 0x7B5A6D85,
+   0x563CB546, 0xE6255730, 0x730A871A, 0x06B13C50,
+   0x0526E4AA, 0x000000B0,
+   0x38053CFE, 0xD958953F, 0x7982A66E, 0xD0DCA408,
+   0xEDF296D7, 0xD1E7E8FF, 0x46C71095, 0x89403F25,
+   0x2197E27E, 0xF9DD442A, 0xA1856828, 0x04C09109,
+   0xC30471FC, 0xE0F10851, 0xC5FBDDFD, 0x9845881C,
+   0x00000024, 0xDE6D1A79, 0x296B2075, 0x25BAF333,
+   0x31700B81, 0x1E723113, 0x7EACD419, 0x4DD7B2F2,
+   0xE296B912, 0x3284A3D7, 0xEC4A609C, 0x0EDCD7DF,
+   0x20D5B58C, 0x62A0A946, 0x4AE17E85, 0xACD03E7B,
+   0x05DB3034, 0x00000037,
+   //Window 115
+   0xC4DD900C, 0x6AD03106, 0x7CA08923, 0x8227FB5D,
+   0x863BA5D9, 0x2E3C1E7F, 0xB5BE20D0, 0x5F76D6BF,
+   0x9492569A, 0x841DC1D2, 0x47E0DC0D, 0xFDA5B20E,
+   0x2D720DC5, 0x65ABA106, 0x03E6765E, 0x9EAB8FFB,
+   0x00000046, 0x497DA0C6, 0x32D92252, 0xBEB7B1F1,
+   0xA2D4C8B1, 0xF01C7409, 0xEDE29968, 0xDA06607F,
+   0xAD902EB5, 0x5C1E7D9E, 0x2C60236C, 0x17A3B1F0,
+   0x51F51DDD, 0x40AB7CB8, 0xB71B393F, 0xA16AC6BD,
+   0x710FC9F9, 0x000001CC,
+   0x7748701A, 0xB87CE581, 0xA987513B, 0x78DA1F78,
+   0x9BAC7437, 0x31ECC1E5, 0x5EC57E2A, 0xCB7EBF5E,
+   0xCEE4F44F, 0x2C8D057F, 0x7BDFD6F6, 0xD84AFB46,
+   0x656BDE81, 0x565D12C2, 0xF2D41D20, 0x64CDDB9D,
+   0x00000160, 0x5104E3C7, 0x33049CD3, 0x8A8F3D05,
+   0x6EC3C08A, 0xE2434E6E, 0x63EEA672, 0x5D7D27C7,
+   0xC7596815, 0xEE0FB5A8, 0xDB96E435, 0xC2A4663A,
+   0xCA501829, 0xCAAA6091, 0x5A013B22, 0x38EC2555,
+   0x1A0E1D49, 0x000000AD,
+   0xB979B88B, 0x07C4D08B, 0x1639BBBB, 0x2D169E14,
+   0xC125D4C7, 0xCDCE5A6B, 0x3BB896E3, 0xD8BDA07E,
+   0x2CD77F48, 0x8EDDF8B4, 0xC16BED6F, 0x70F6F21B,
+   0x88A26D82, 0x468A156C, 0xCE174F12, 0x97B788EC,
+   0x000000E9, 0x5C89D533, 0x95F38019, 0xC2F6C63C,
+   0x81B5D1CB, 0x23901AA3, 0x797C11DD, 0x126C2418,
+   0x79008348, 0x8D61DB44, 0x2B5B4E68, 0xA2804DE4,
+   0x27F6CC87, 0xDF7586F0, 0x636D1764, 0x9D1F8E00,
+   0x40650017, 0x000000A1,
+   0x76B30FF1, 0x2AC801BD, 0x4DD813C6, 0x047ECDAA,
+   0xF17A07C0, 0xAE2B98AA, 0x33E55DAF, 0x19938061,
+   0x2F94190B, 0x4AA0D688, 0x69BEAE5D, 0x41FF7A47,
+   0x8BB828E8, 0xCA57BFC1, 0x61465132, 0x537A689D,
+   0x000001E7, 0xC35AFA1A, 0x77564B28, 0xB3494FCD,
+   0x54513990, 0xE61C567A, 0xC5227210, 0xDC29D37C,
+   0x2099E39E, 0x608B4F87, 0x659953B5, 0x87BC7D59,
+   0x873ED054, 0xB05875F4, 0x0F5CE1A9, 0x523BD9A3,
+   0x61F3E3A4, 0x000000C6,
+   0xB22C49C7, 0x7C373B2A, 0x1E4FDF5D, 0xBB599F46,
+   0x29756598, 0x773BBBF1, 0xC88D98EA, 0x30B9948A,
+   0xA3C24F44, 0xA502B3FD, 0x73CCBA25, 0x18D1A206,
+   0x394506D3, 0x80DF2E35, 0x02150FD3, 0x7F956E69,
+   0x00000091, 0xE94A09F4, 0x6F94FE0A, 0xD02E063E,
+   0x8CD27FB7, 0x0D164FD7, 0xD16522D4, 0x6F0D8D20,
+   0x95975807, 0xA32FB87B, 0xCC10F8E9, 0xA60944AE,
+   0x6069AB1B, 0x9D5A48C1, 0x630AC28B, 0xB32E141D,
+   0xEFC6DC99, 0x000000F0,
+   0xED7FB4E0, 0x1BD81509, 0x8F740759, 0xC0399AFC,
+   0xE1917C22, 0xFD77CD44, 0x28E9E6B8, 0x5DF3F8DA,
+   0x94C4D3EC, 0xEFEB37C0, 0x72790DF6, 0x0225A73C,
+   0xF380982A, 0xA3DEFABB, 0x2BE4D6C9, 0xE27111B4,
+   0x00000176, 0xFCB3B499, 0x941457F5, 0xB32EC283,
+   0x13853C55, 0x083BE23D, 0x9FCB6C96, 0x158675FC,
+   0xD569B317, 0x8E72C7A6, 0xC3443DF0, 0x6C7876A7,
+   0x86D562EA, 0xB246C643, 0xB5874BC0, 0xEB3E43C6,
+   0xCA850C2F, 0x00000011,
+   0xED359803, 0x0C3175F5, 0xEA16D5BD, 0x4FB91985,
+   0xB9239029, 0x789A7A4A, 0x83C7DA5E, 0x2011B47C,
+   0x0BFD1367, 0xEC45C871, 0x32D275CA, 0x486DAA03,
+   0xD741009A, 0xFD6DCD14, 0xBAB847B5, 0xEB2E4429,
+   0x00000182, 0x33A84E4B, 0x400E170A, 0xCFADE552,
+   0xF92DF616, 0xACDD9921, 0x8EE2D428, 0x839F6A4B,
+   0xBAA0F461, 0x6FEE4D71, 0xEBB80BB1, 0x4C1DBD42,
+   0xE2A66449, 0x46D77533, 0x494AD2F0, 0x0E82BEF9,
+   0xA5CD7C6E, 0x00000003,
+   0x91BB5BDB, 0x5FB45558, 0x70CAE47F, 0x9FC6FF60,
+   0x2B5C3BC5, 0x5ADE5C95, 0x6E189A54, 0x73F547E1,
+   0x4E71DAAA, 0xB5C56E3C, 0x1AFBEB0A, 0x49AE06D0,
+   0xFEFAE4BF, 0x2F33D608, 0xBDE74130, 0x7BB6B17F,
+   0x0000017E, 0xC26C99DF, 0x11BCEC29, 0xE0892000,
+   0x5314AC55, 0x116656AC, 0x1DEC3749, 0x27B381C2,
+   0x605EC0F9, 0x15D946E8, 0x686B09CA, 0xF175F081,
+   0x5714A4F9, 0xD2EED173, 0x88978A53, 0x8B7161E1,
+   0xB53B27CA, 0x000000CC,
+   //Window 116
+   0xCD5F918F, 0xE12D8922, 0x49F73F1B, 0xEC7C1763,
+   0xC744EB3D, 0xCC5A3A14, 0x782DBDA1, 0x2B96F342,
+   0xAB68DDE4, 0x87284905, 0xE720668A, 0x647354B9,
+   0x739C4393, 0xE07DA694, 0x2CC145F9, 0xBAE499BF,
+   0x000001AE, 0x77C16DB0, 0x74EEEAA4, 0xEB22CE92,
+   0x297624E8, 0x45098C91, 0x9D3944BC, 0xFA4DC50C,
+   0x6FF31FA0, 0xCC40C211, 0x3C7FB6DA, 0x96B4CD1C,
+   0x74D95DEC, 0xA6388941, 0x829423DB, 0xFC3123B5,
+   0xAA2B7D45, 0x00000119,
+   0x16E0F612, 0x01EF33CF, 0xEEB7A33D, 0xBCCC51C3,
+   0x46A12C50, 0xCC35C1E3, 0xB915B370, 0xD2151223,
+   0x3AFF625F, 0xB0303014, 0xB76ED5C4, 0xB7E34E67,
+   0x10B988F7, 0xD5B48E22, 0x57F1882F, 0x5EDADA05,
+   0x000001EE, 0x26A93C88, 0x70919A61, 0x11491A74,
+   0x2729BAF1, 0x541B2E39, 0x895470B5, 0xC85FEF39,
+   0x88E52A03, 0x5B35AD5A, 0x605D4808, 0x87561036,
+   0x3203783C, 0x546E9DE2, 0xAC1C8568, 0x62D3BC75,
+   0x61C5703C, 0x00000192,
+   0xD5AC5D48, 0x15AEA420, 0x178C5A77, 0x6E11BF30,
+   0x2651DEE6, 0x01F1180D, 0x59E7A8F6, 0xD7602ED4,
+   0xDE3746DE, 0x5D3EC901, 0xE2400304, 0x314D1580,
+   0x65F15588, 0x08F82592, 0xD9FFE64C, 0x22E8FF88,
+   0x000001D2, 0x99E0F136, 0xF3F23ABC, 0x0F1AE78C,
+   0xEF5D9484, 0xF6E34CA1, 0x616E957F, 0x80B7054A,
+   0xE2E237B0, 0x92BAA214, 0x79877615, 0xDD291296,
+   0xCD321299, 0x20D8BCF6, 0xF9B74ADB, 0x31661404,
+   0xEFCF3236, 0x000000E6,
+   0x052D2EA5, 0x68B81BE9, 0x05294D6E, 0xEADFB531,
+   0xA3258647, 0xCD41F773, 0xD70FD9D0, 0xF6B1C867,
+   0x7BE523E7, 0x9A89CC01, 0x487EBF56, 0x2499D793,
+   0xC0D072A2, 0xC82CEFE8, 0xE82CB4F8, 0x91C2BFBB,
+   0x00000105, 0x6705DCE5, 0xD705CF5A, 0x4462A67C,
+   0xFCBE204E, 0x430D627F, 0x5E198BC3, 0xE765991F,
+   0xE13DA562, 0x7032C5F8, 0xB6CFCA28, 0x1783308A,
+   0x0868D9AB, 0xC8050C8C, 0xC5B628C6, 0x3A93A8DE,
+   0x243E2EC1, 0x00000139,
+   0x01DD7411, 0xB20D7FEF, 0x47AA41C0, 0x9F9A1040,
+   0xAAEDBFB3, 0x37677F41, 0x22350C64, 0xE3E23E47,
+   0x30FF0CEA, 0x93964E8A, 0x4B5B4758, 0x956A8812,
+   0x7552AFF2, 0x6BAD595E, 0x2B93308B, 0x0DE81B3D,
+   0x00000199, 0x2F0BD592, 0x64899C66, 0xF3969762,
+   0x41616275, 0xC434793A, 0x8CFC9DDA, 0xCDF048F3,
+   0xEEEBA2D4, 0x2B87E0C5, 0x6F2D05B1, 0x1BF8117B,
+   0x1ABF4612, 0xB630A10A, 0x674DECA6, 0x79ACDE0D,
+   0x061CCA57, 0x0000006E,
+   0x0324BBAA, 0x8AA2FD3A, 0x28CB3EA1, 0xFB02DA2E,
+   0x6493B3FD, 0x93887614, 0xDA6D66B5, 0x68C6A8A4,
+   0x222398FC, 0x31477D83, 0x98DA59D1, 0x9498701A,
+   0x2BDD61A1, 0x73EAFD53, 0xD8B1B1BC, 0x6DEA3D8C,
+   0x0000005E, 0x929E403E, 0x30D3C83A, 0xC2C1881E,
+   0xFFD69CA5, 0x21383E3A, 0x36E2DD8F, 0xC42CD33B,
+   0xC0702450, 0x01146955, 0xDC2BA2AE, 0x3060EFD3,
+   0x74AE932A, 0x1F96136C, 0x1F01D81B, 0xA434D7D4,
+   0xED2A00CA, 0x00000121,
+   0xB8501555, 0x3AC08717, 0x812FBEE3, 0x884C3347,
+   0x77363609, 0xA9345807, 0x1AEDE158, 0xDB4DE684,
+   0x6312D55A, 0x6D3850EA, 0xA47C5A6E, 0xD4247574,
+   0x047C8EBF, 0xB5CD31B2, 0x1D8CEFE6, 0xCCA5ED85,
+   0x00000124, 0x2A51A7CD, 0x4AFE5137, 0xE510BA3B,
+   0xD28B0D5D, 0x5D1C1D2B, 0x1AC5ADE8, 0x4D330DDD,
+   0xDDECD802, 0x9259BC0F, 0x7F03C641, 0xB3CC0E2A,
+   0x9901F74B, 0xADEE582F, 0x997B76D0, 0x78DFF0F3,
+   0x45624194, 0x000000AD,
+   0xE9B072D5, 0xBF9C09D3, 0x1ACEAF57, 0x627E6487,
+   0x829175EE, 0x21938240, 0x5BC4D226, 0x781EA3F2,
+   0xA6726027, 0x996532AC, 0x1177E922, 0x567DA815,
+   0xEE0EA637, 0x9B3FEC8A, 0x091EEEF4, 0x793F1038,
+   0x000000DE, 0x81D2A890, 0x30A23A75, 0x973E9BA3,
+   0x41F22A0C, 0x5C1A136B, 0xDA3E7868, 0x084420D6,
+   0xBE524C93, 0x26661908, 0x53518E40, 0xFA169B4B,
+   0x7BD7C768, 0x4709E45C, 0x0477E883, 0x27ED78A7,
+   0x41B66D38, 0x000001A0,
+   //Window 117
+   0xAB7A841F, 0x2BF35F94, 0x78E3FB0D, 0xDCBDA338,
+   0xA0195F98, 0xB913947A, 0x4370E51D, 0xC8E30A9C,
+   0xF0E558EE, 0x8A403E1F, 0x606DB1DC, 0x7DD167C4,
+   0x5827EF91, 0xAA343CBE, 0xAACE0F43, 0x1404F2D6,
+   0x000001AC, 0x3DB1C500, 0xDFE19EA5, 0x48EF4A56,
+   0xDD047171, 0xB9A5EC76, 0x38AB939E, 0x5648F852,
+   0x8F2D5685, 0x2726F67E, 0x7F81313F, 0xF68F54BB,
+   0x41CF3794, 0xDE14D6EC, 0x9D400E52, 0x4C9EB1BA,
+   0xC046FDA1, 0x0000008A,
+   0xFF4EA449, 0xCAEA17BB, 0x91F114A1, 0x42EBAB1A,
+   0xEB7FFC78, 0xE9489571, 0xB86D5BDA, 0x6C12E907,
+   0x1FB55F3E, 0xD483CA52, 0x1E51DCD5, 0xFE15CA3E,
+   0x0DAD4105, 0xAD186B4C, 0x1700D1C6, 0x7ACE5778,
+   0x000000B6, 0x11878A42, 0x41B44850, 0xCE2799E7,
+   0x4DC4219D, 0xAFE8A462, 0x44C093F5, 0x18CB2F21,
+   0x279646F9, 0x7058E005, 0xD6722EA9, 0x02536EB9,
+   0x837D0A0C, 0x5AF19397, 0x6DAF4C15, 0x5BC8A5F5,
+   0xC4DC5D39, 0x0000014A,
+   0xEB2A9463, 0x26AD8924, 0x65239D57, 0x0050762D,
+   0x455C9F95, 0xEED3D2E9, 0x2D4455C7, 0xFB1C7435,
+   0xFE101F88, 0x830EB782, 0x57709E8B, 0xE63914BD,
+   0xC5E4CC3B, 0xFE87CD37, 0x1F4CC628, 0x762CF1BA,
+   0x0000004B, 0x61622EA8, 0x4DD6AB01, 0xBE0AD8A3,
+   0x7A53FB7D, 0xC33A6AE5, 0xD58DAAEA, 0xDAF8D9C8,
+   0xE23B2139, 0x22B6A3FA, 0xC6AD81D8, 0xD183D49A,
+   0x0065CBD7, 0xBAEF9EF4, 0x323363CC, 0x591BB7D9,
+   0x595C7048, 0x0000009C,
+   0xD962CB5F, 0xF6C5E153, 0x008897A9, 0x02C33715,
+   0x353A9BA0, 0x8334420A, 0x27081621, 0x0369DE7F,
+   0x89AE3E70, 0xDAEC4337, 0x320628A4, 0xD0D2FD4E,
+   0xB527C311, 0xCEEED59F, 0xE4C12CF6, 0x3111DE80,
+   0x00000127, 0x4D578154, 0xEEF5D048, 0x35E6A046,
+   0x2A752CC8, 0xABB9ED8E, 0x1DCC194A, 0x98C92EFC,
+   0x6E2E65BB, 0xBAE89E78, 0x780C6AF3, 0x9892D5E9,
+   0x6C0509E6, 0x01F3BE0A, 0x4C2CF9EA, 0xB1563854,
+   0xC9C5FD50, 0x000001AA,
+   0x0D879EEF, 0x18B17AF2, 0x80B21046, 0xDC4B92C4,
+   0x73E3FA24, 0xF35B8387, 0x3003B07E, 0x6F933594,
+   0x130AC323, 0x25668F5E, 0x381FAE74, 0x73CCFE56,
+   0x0AF14E55, 0x805C30A5, 0xE8970438, 0x3C3F10C2,
+   0x000001AA, 0x818DFE39, 0x73E329E9, 0x70D7A80C,
+   0x5683D23C, 0xB52FD7BF, 0x33BA1770, 0x41CE28B3,
+   0x66E96182, 0xA280CF2A, 0x695F2186, 0x203C3255,
+   0x895B2AD2, 0xAF31051C, 0xA2549DEB, 0x2FA670BC,
+   0xD25E38BA, 0x0000003A,
+   0x390AC5AC, 0xF2D5CFF6, 0x7840B7E1, 0xD80AF001,
+   0x35695B5B, 0x6BB925F5, 0xF0E76C66, 0x3AD3F6AF,
+   0x6C9BE77F, 0x33CE758B, 0x5EF5858D, 0xEAE5A7A7,
+   0x2AD757E3, 0x1FC3392B, 0xBA0183E0, 0xFEB79DD4,
+   0x00000155, 0x9C3D6752, 0xAB1B9294, 0x863482C5,
+   0xADDD3402, 0x064CD12D, 0x2754CD5D, 0x37FAE585,
+   0x3B009B7C, 0x42660C5B, 0x692EA948, 0x5D723DF6,
+   0x238C0581, 0x7DC75771, 0xE3F1D8CC, 0x5A049593,
+   0xC641DC20, 0x00000186,
+   0x60999369, 0xDCD82D6F, 0xB4DB8651, 0x4577BC41,
+   0xF8F37926, 0x6159A181, 0x64B29A3F, 0xA8A1AEAB,
+   0x9E18AD91, 0x878F2C13, 0xC0F2EBD0, 0xAEE5BB74,
+   0xC8B9AF28, 0x90FF4496, 0x8D9FE206, 0xB1D535E8,
+   0x000000BA, 0xA8E16FF2, 0xF4348881, 0xF9742336,
+   0xD0FA412E, 0x29C5C38C, 0xAE8DDB3C, 0xA6F0F9C6,
+   0x57463916, 0x45AE6F72, 0x9FCBB7BE, 0x7A47D8FD,
+   0x12A18F6C, 0x04E2ABA6, 0xA8C72639, 0x782DE3B4,
+   0x25F82852, 0x0000007D,
+   0xCACEC3D8, 0x9EA3A8CA, 0x9E29C71C, 0x4D430843,
+   0xC39958D3, 0x888B0EEC, 0xE6CE67E6, 0xFE7615FD,
+   0x68C9D3C7, 0x75A05E91, 0x4A321D9E, 0xFFF7B4A0,
+   0xE04B9807, 0x1E3D1334, 0xFCCDCCA6, 0x3B437C5C,
+   0x0000002D, 0x9314CDBD, 0xAB2788A2, 0xB692A742,
+   0x4B71B816, 0xFE4D7AA7, 0xDDA402F1, 0x0F9E5453,
+   0xA4F11BFC, 0x188AE92B, 0xDBFFC3A5, 0x7025091D,
+   0x99B924BB, 0x284E2029, 0xE4638173, 0xACBD2399,
+   0xF8E93001, 0x000001EA,
+   //Window 118
+   0x5F7ABAEA, 0x02FB84FD, 0xE991E445, 0xA238AD04,
+   0x7C972ADD, 0x0D9B2D41, 0x478C558A, 0xAC2439F9,
+   0x1EC86ED8, 0xC3C78A2C, 0x2D3B2F29, 0x3735839B,
+   0x50317454, 0x259728D4, 0xE2377ABA, 0x7B53A9CB,
+   0x00000179, 0x5E4846CE, 0x95F44ADD, 0x7211225E,
+   0x85D2A8E8, 0x091A6646, 0xCBF0ABD8, 0x102DEEAA,
+   0x9D8B3475, 0x602BA91C, 0xE2A0A4AB, 0x131DE0D4,
+   0xA6276D7F, 0x5F215C70, 0xBB90D117, 0x07E3AA82,
+   0x49A60E3E, 0x00000019,
+   0x76F521D5, 0xEE2CA82B, 0x8D54184C, 0x404C95B9,
+   0xD43E178E, 0x7EF78330, 0x05F36BD2, 0xED67F943,
+   0x45F09837, 0xD734F6B8, 0xBD8F5A29, 0x8760F0F7,
+   0x12059285, 0x2E7CF021, 0xEC54D3AF, 0x8D0BE801,
+   0x000000A6, 0x71042440, 0x51BA60C9, 0x614A4512,
+   0xEA9C35AE, 0x1D410F81, 0x006BBCA5, 0x1170157D,
+   0x3D31AC43, 0xFC7E723B, 0x69B0BE25, 0x38276789,
+   0x6DA152BA, 0x93492808, 0xBE486C05, 0x80AFA598,
+   0x3FD119D9, 0x0000008C,
+   0xE92E85B5, 0x14596043, 0x309BCC86, 0xE3CAA4F1,
+   0x6A004131, 0x0946EECD, 0x5D559370, 0xA8F39A0A,
+   0x9DD39852, 0x2907F0FB, 0xB3624B6C, 0xD26639C2,
+   0x034709B8, 0xB45F0D32, 0x8065C9D8, 0x0AE962D4,
+   0x00000144, 0xD521ED0E, 0x3DE036A5, 0x22E88BED,
+   0x5CE09900, 0x527F6BE6, 0x2170357D, 0x5B47A6C2,
+   0x7CC9E9FF, 0x9748EB94, 0x801FF33B, 0x372D1840,
+   0xCB3961D6, 0xBDA53A97, 0xC3DB0B3B, 0x9BD74F00,
+   0xFFF1A078, 0x00000127,
+   0x1AA88055, 0xCC51CB4B, 0x6DAC9C77, 0x55C2DFC4,
+   0xFB5E8DE9, 0x4E0019AF, 0xD0D60937, 0xD686F86D,
+   0x2F3AC7DB, 0xFE4BCB52, 0x1CBD8B5B, 0x102ADF66,
+   0xF89AD228, 0xFE830C11, 0x969B169B, 0xB635E0E1,
+   0x000001A6, 0xD5B1C229, 0x6B51C9AB, 0x9EE262CA,
+   0x1D2912BE, 0x838C6D6E, 0x6208F3DD, 0xD6E11544,
+   0xC3B9A9E5, 0x6A2696E9, 0xB88E9933, 0xEA9D3206,
+   0x81B5B9C8, 0x43123369, 0xA7F2F302, 0x73BC3A3B,
+   0xBB51E486, 0x00000113,
+   0xC2D5D1C9, 0xAD58DE78, 0x2663ECA5, 0xE7699941,
+   0x7FA5676D, 0x13AE5990, 0x353A23B9, 0x61D9B210,
+   0xE6A0555B, 0x9FA9CFFB, 0x32E08907, 0x8E1DF274,
+   0xDF885E1E, 0x02D035BC, 0x6B09E47A, 0x8EFA75FD,
+   0x000000C1, 0xEF652E49, 0x2746583E, 0xC93ABDF5,
+   0x82BA2F66, 0xFCDE98F3, 0x7A70DF37, 0x142D6C0B,
+   0x5D73F502, 0x31834EAD, 0x61370D14, 0x360F6136,
+   0x787D9608, 0x175282BD, 0x26798865, 0xA21FC0BF,
+   0x017DEE66, 0x000000A6,
+   0x0DC53AB1, 0xC00C140E, 0x6E181EC8, 0x5961BC16,
+   0x68C64D48, 0xF68BB1E2, 0xD29086EC, 0xCA74873D,
+   0x9D7B635F, 0x8016A81D, 0x86E7208B, 0x1F603DB2,
+   0x9BECC143, 0x31D02E4F, 0xAC5053E3, 0x82A33F2E,
+   0x000000EA, 0x5CECEA10, 0x52526AC7, 0x6F766D5C,
+   0xD083A304, 0x502B8CC5, 0xDB2B1C23, 0xB6505FAB,
+   0xA9B74520, 0x759D7E71, 0xD8DC8455, 0xE180F598,
+   0x0D5F5B15, 0xB7AAE8AF, 0x7B81EBE7, 0x6B57D9BE,
+   0x6EE1C602, 0x0000007F,
+   0xE07C115F, 0xB77EFCB9, 0xF24ACACB, 0xD5B6ED5F,
+   0x022D39BA, 0xC2205626, 0xAB592008, 0xB7218F28,
+   0x5862B90A, 0x996BD827, 0x59770258, 0x36553C57,
+   0xAB89BC30, 0x20338783, 0x9C8D028B, 0x696D72EE,
+   0x00000129, 0xCFC61B7F, 0x6F57F9A7, 0x55E3FC00,
+   0x08EFE023, 0x9CFD993A, 0x6CBC217A, 0x52BB03FD,
+   0x4F4762E2, 0x75021635, 0x7DE03234, 0xF2661CAC,
+   0x39EBAE49, 0xC106E255, 0x1F7DCF8C, 0x19076020,
+   0x6B1984F2, 0x00000102,
+   0x3F9534ED, 0xA1285303, 0x2C63280F, 0xC5A30DEA,
+   0x7ED8C1EA, 0x9015209C, 0x6CE665BA, 0x68C49008,
+   0x5D154A17, 0x8800B08E, 0x54429C36, 0xA8B5C31C,
+   0x25B60A15, 0xF3947625, 0xECD72450, 0x123F51BD,
+   0x0000004E, 0xB187B6A1, 0x8D601C76, 0xB25AC6D8,
+   0xD04EF5F1, 0x81995FF4, 0x1064FC70, 0x6950CED5,
+   0x1ED6C2B5, 0x5A13A531, 0x7E32161A, 0xA573AA56,
+   0x10459EAC, 0x30AFD37E, 0x39A56536, 0xE11F4922,
+   0xECA0BEE8, 0x0000011A,
+   //Window 119
+   0x09B5947B, 0xC7CC50FB, 0xD5EAE02F, 0xE166A9AF,
+   0xDA349C90, 0x47C7953F, 0x21C0984D, 0xC3D4BCAE,
+   0x45FF2419, 0xCEE13C2F, 0x47780DDC, 0x334CC1F1,
+   0xF1157180, 0x21381FB6, 0xEAEDE87B, 0x28FF4F86,
+   0x0000017D, 0x60E096A3, 0x10C72B82, 0x5FF796BA,
+   0xC73306EC, 0xFECC17EC, 0xB3F60666, 0x46F82C8D,
+   0xB9E0D51F, 0x296DA50C, 0x6CBE5C7E, 0x4FA6C1CE,
+   0x87CB1104, 0x491F9B8B, 0x5D5E0F6D, 0x70EB3D18,
+   0x187BAF69, 0x00000103,
+   0x0689CA3F, 0xDE032403, 0x14FD0202, 0x4584FD97,
+   0xC84BFE39, 0xBEA63186, 0xABA48F51, 0x0E579AAD,
+   0xC1A4C309, 0xCDA28545, 0xFD645C90, 0x33629507,
+   0x27B58E13, 0x0C77CD56, 0x64DDA00F, 0x4D843136,
+   0x0000016C, 0xE91A439C, 0x281CDDF1, 0x38BF386B,
+   0xAEDC15D5, 0xF35EA657, 0xF2F22343, 0x18A01F1F,
+   0xF9FE82EA, 0x0B5A27BD, 0x04F9F473, 0x025DF338,
+   0xD296626D, 0x633DCA68, 0x45B950BA, 0x19F73B2E,
+   0xEEEF58AD, 0x00000008,
+   0x9DF3894B, 0x035D0A01, 0xC2F36A07, 0xFCFB77C6,
+   0xC9319662, 0x04957358, 0x0E0FBE5B, 0x52FB2C65,
+   0xCF3EBED5, 0x26D1FB01, 0x6F338B83, 0x3A417DC0,
+   0xD11A9621, 0xFB234B48, 0xDB3F5CBB, 0xBBA96393,
+   0x000000D1, 0x95129FF9, 0x78B95F14, 0x4D5F0ABE,
+   0x10504DE1, 0x3F4DDE14, 0xE8C7250D, 0xEA00AC99,
+   0x20C04AB4, 0x6EB2143B, 0xFAED1168, 0x544284B5,
+   0x23E32BF4, 0xBAD3ACB7, 0x0512A28D, 0x86D008A6,
+   0xAA1926AA, 0x00000192,
+   0xCAF7FFF7, 0xBE5764C9, 0x6D606B04, 0x16CC873D,
+   0x4268CDFB, 0x6A6F2078, 0x27BD5738, 0x06CD7CE6,
+   0x42E47936, 0x532D5C42, 0x7D0F8758, 0x704F0B2A,
+   0x6D2E977A, 0x6046D9F3, 0x1327C874, 0x53FEB41A,
+   0x000000FB, 0x013EF2BE, 0x9425B4D1, 0x98A45194,
+   0x98B50C6E, 0x9DF34265, 0xBF181A2B, 0xC2DE575C,
+   0x39C40CE4, 0x883B4DCC, 0x6757DAEB, 0xF8B5EFBC,
+   0xCB224D4B, 0xED49A2A0, 0x2DCF10AE, 0x9FFDA898,
+   0x9C1FFF7A, 0x000000EC,
+   0xC9BF0C9B, 0xD2B17EFD, 0x4A3175E0, 0x79352DF9,
+   0x841B5F46, 0xDE19AF86, 0x8317FE9F, 0xD2BDEFC9,
+   0xA5AE3BC1, 0x4349C726, 0x43CAD229, 0x9991211E,
+   0xF16A1F19, 0x3245CE6E, 0xF6B0A022, 0xB7A43C99,
+   0x00000027, 0xBFDD7FA5, 0xA0D43E88, 0xA56AEF59,
+   0xB9FDB126, 0xEB1646B9, 0xE36FEDB3, 0xB2D25B2A,
+   0xC2A5B17F, 0x7526EE70, 0xD1DB0F0F, 0x739FE3B6,
+   0x526E46C6, 0xA6320001, 0x5CFA3185, 0x1717CEE8,
+   0x90828272, 0x00000054,
+   0xD1FC50F7, 0xBC23AEB2, 0x9B184C0C, 0x5A63B237,
+   0xE6794086, 0xBC43FF0E, 0x031F0138, 0x64713B62,
+   0x81DA7DAC, 0x3DB4B0BD, 0x36D6FB58, 0x4D6A996B,
+   0x22B4E62A, 0x6B064DF1, 0x7F6B9CBE, 0x0612931C,
+   0x000001C8, 0x462BBC5C, 0x55503228, 0x244999CC,
+   0x5651EC3A, 0x09872C80, 0x93B5B3D7, 0x070882C7,
+   0x8CF163AF, 0x3B30AFE3, 0x7A292322, 0xEE45A4FA,
+   0x8D92B4AA, 0x697A47B4, 0x94646BD3, 0x6423023B,
+   0x99BDE8F9, 0x000001FE,
+   0xCDF30F6C, 0xC288EE74, 0xD8B19859, 0xA8FA52B3,
+   0x23F725AC, 0x1FF94A30, 0x58B44EC1, 0xF02BEF5B,
+   0xB862BEC6, 0x0AF81BDF, 0x38D65BB7, 0xCB19979D,
+   0xC662ADF9, 0x4469BCF7, 0x95E8305F, 0x6F29E331,
+   0x000000BC, 0x2093D379, 0x72244E29, 0xEC9D9897,
+   0x590C16A0, 0xE45D50C3, 0xC635439E, 0x9B40B375,
+   0x5B556277, 0x43D0381E, 0x9C9C4496, 0x378D8002,
+   0xD61C59C2, 0xAC014D42, 0xF0811D15, 0x8AFA297C,
+   0x37DA2DE5, 0x000000F3,
+   0xEC9886F0, 0x73BBC51C, 0x76C9105A, 0x6D91832D,
+   0x7734DE0D, 0x3A4938FF, 0x9F71510F, 0x68613D27,
+   0x9C201233, 0xECC8B09F, 0x02F20792, 0x2B426B0D,
+   0x33F87AEB, 0x917BAB51, 0xB921E7E8, 0x21014269,
+   0x00000139, 0x91A3CEF2, 0x366B3A8B, 0x10BBA815,
+   0xBF63ED99, 0x44329E33, 0x98143AE9, 0x12C92E6F,
+   0x7BF47DB9, 0xDE7BF2E6, 0x3E298E35, 0x770DAA8D,
+   0x517D6A51, 0x85E292C7, 0x80A04C0E, 0x3A6CE0A0,
+   0x252AAC41, 0x0000009D,
+   //Window 120
+   0x3FBADC57, 0x62A1F73E, 0xB1BA2D35, 0xEABF4B68,
+   0x76F3BDE7, 0x711D7F63, 0xB31C3FB3, 0x162F5183,
+   0xD7D716F7, 0x0DCD66FE, 0xE46816D9, 0x6E1DBB78,
+   0xF833A6F7, 0x532831B8, 0x4CFED0CF, 0x64191CCB,
+   0x00000190, 0x6D7824AD, 0xDB376339, 0xB16A391B,
+   0x6B948AEF, 0x4AE9013E, 0x2D174FD6, 0x16A57DE2,
+   0x9B5C22EE, 0x9E857A25, 0x3BFED1DA, 0x4D644BBD,
+   0x635187A6, 0x6FE288AC, 0x94786E3A, 0xECE25962,
+   0x827C8B03, 0x00000092,
+   0xEF4B1B98, 0x6E965255, 0x8BA97BF6, 0x3F63B6BD,
+   0x19BB0BA0, 0xC6CACADB, 0x3C8EDCC4, 0x9F88F0C8,
+   0x1A489ACE, 0x3A2D4BC5, 0x5529BB67, 0xAA3075B7,
+   0xFFBBD2BF, 0xCDB0C4D6, 0x3A568FD4, 0x4A3B41D3,
+   0x00000146, 0xEFFA56AE, 0x46442711, 0x47ACC062,
+   0x941858D8, 0x7434D565, 0x9480D79C, 0x43322ECC,
+   0xA92E8859, 0x5F82931E, 0x650CD6DE, 0x97876156,
+   0x4EF5D483, 0xAAF946F4, 0x04CA704A, 0x0A95E02C,
+   0x75258AAC, 0x00000132,
+   0xE4DC6C47, 0xA5566CAF, 0xFD8F2789, 0x17226EF0,
+   0xC66FEEA4, 0xF6F20C86, 0x54F41B79, 0x19F5E459,
+   0xA05AEA83, 0x4288C4B4, 0xD8D42617, 0x107C800C,
+   0x2425EA3A, 0xA83D33A4, 0xEEC9D772, 0x8DEA172B,
+   0x00000132, 0x9EF2A747, 0xF75FEE0F, 0xBF360B7B,
+   0x107D2B54, 0x4C4DD036, 0x6A0B32F0, 0xE843BDF6,
+   0x4733A40D, 0xAE53A7D2, 0x5B17B282, 0x2070F209,
+   0xE15AF19E, 0xDC178326, 0x800540EC, 0x8A9691E5,
+   0x13D38AAC, 0x0000004E,
+   0x373055FD, 0x28B3C1E7, 0x066CC9BF, 0x8B5A5FDE,
+   0x4C213824, 0xF1F38698, 0xE7069ACA, 0xD3F812F6,
+   0x410B8E51, 0x7AF66243, 0xCCDBEB09, 0xB0B2C6CA,
+   0xF5EB1DAA, 0x3C31D93A, 0x8FCFD3FA, 0x487DA2D2,
+   0x0000003B, 0xD1091BCE, 0x111B77E8, 0x8F9A76F9,
+   0x12FD3BAE, 0x100340A2, 0x737049CE, 0x577FED17,
+   0xF514BE2E, 0xBAA6A384, 0x40E9F3E8, 0x4DF98480,
+   0xCB4AF017, 0xA9C0A1AF, 0x3A5E3983, 0x05B9D797,
+   0x7CA6BDAF, 0x0000005F,
+   0x022E78F0, 0x7C87F3A4, 0x027926B9, 0xCA0498DF,
+   0xE9EBB7F8, 0xBC8B9EA2, 0x5DABF797, 0xA8C83D31,
+   0xBFEA0853, 0x7DFA95C2, 0x42D0716D, 0x64E8AB25,
+   0x2FAA107F, 0x1740F8E0, 0xD857994F, 0x1458AF64,
+   0x00000175, 0xC8FAF75B, 0xC125A62D, 0xAE518B7F,
+   0x2521B0EB, 0x4CA307B3, 0x1DA40717, 0xE5650F5D,
+   0xB61A9D35, 0x7420F3D3, 0x915CF486, 0xBB059DCD,
+   0x0D686243, 0x861772A9, 0xEB9151F7, 0x32AEA0EE,
+   0xD7C0EBBD, 0x00000068,
+   0x3CA78A6D, 0x42D861D2, 0xAB0258D9, 0x1D19C466,
+   0xC0EDEAD7, 0x975C0A31, 0x450C9CEF, 0xA0CAFA8B,
+   0x6449715C, 0xE808EC53, 0xA608BEB6, 0xAB3A9430,
+   0xDE81C539, 0xEE9E1C9F, 0x473524DC, 0xF3D7B348,
+   0x0000000A, 0xC738461E, 0x6A80D50F, 0xAB0495A9,
+   0x308B8F73, 0xCFFCE061, 0xCCA7368A, 0xE74A7C81,
+   0xCBDC1793, 0xF32A0E92, 0xAC31501A, 0x7D49C00D,
+   0xF4140051, 0x6AC4A403, 0x79AAC516, 0x3E76C568,
+   0xF500CE39, 0x0000019B,
+   0xC3B7EED1, 0x9C34B7C5, 0xE4596437, 0xBB2BDA47,
+   0xF719530C, 0xA1AE187A, 0xB3AABD26, 0x39FEB40A,
+   0x97CCD1E7, 0xDF9B00C6, 0xE809223E, 0xA4241B76,
+   0x0552E863, 0xF8BC2EE4, 0x467BAE5D, 0x4287052A,
+   0x000001EC, 0x0510A2DF, 0xDFF0E77B, 0xB712464D,
+   0x729B372D, 0x3960C11A, 0x7B1E56D4, 0xAD60867D,
+   0x711FD058, 0x24BC1EE3, 0x619FC323, 0x51CB3A73,
+   0xA7BA4BD4, 0x74795B96, 0x7E86C326, 0xF52A251F,
+   0x86BDFF87, 0x000001CD,
+   0xD59EEBA9, 0xB9951CAD, 0x0B4E27E0, 0x05D08314,
+   0x320EF447, 0x00F3E87E, 0x04664C78, 0xD3E621DF,
+   0xA260860F, 0x23F712E3, 0xDACB26C6, 0x94631018,
+   0xB25436C7, 0xC24A7A18, 0x634885F9, 0x16D26A90,
+   0x000001C0, 0x9C65AB21, 0x8AB63B32, 0x70E559B8,
+   0x8027F0C8, 0x5D74E122, 0xE1886758, 0x0BCC706B,
+   0x64861CB5, 0x0D9CF4B3, 0x4B6EE54F, 0x0A8794A4,
+   0x450E6324, 0x8FD7D2A2, 0xDE1B5E3C, 0x565F1F8A,
+   0xA4D4DBF8, 0x00000027,
+   //Window 121
+   0x13B42E63, 0x651B47C8, 0x16BEE2B6, 0xE7054413,
+   0x86A71AC0, 0xDCF60CA3, 0xE3BAF787, 0xABDDB357,
+   0x81A2DB2D, 0x99D631D1, 0xC8C9B834, 0x3F1E3C7F,
+   0x61ADF4D7, 0x3B30FA18, 0x14B9F46B, 0xD1D8D980,
+   0x00000139, 0xF6AF1252, 0xAE6F6B72, 0x4FF8A00B,
+   0x0FC58398, 0xA81FD641, 0x1B2C0CC5, 0xE68B6FBA,
+   0xBDCAABE6, 0x70B14E44, 0xD1AF82FE, 0xE55CE735,
+   0xE9C35419, 0x01DCEFB9, 0x3C83D9DC, 0xFB5824C9,
+   0x42604200, 0x0000011F,
+   0xE22F1171, 0x753CE74A, 0x15F959EE, 0xAE29377F,
+   0xDACE4BDC, 0x90D8C9C5, 0xAB4DCFFC, 0x45F210F7,
+   0xE1283166, 0x32135E10, 0x32072197, 0x23A06109,
+   0x4D767572, 0x4D3CCCB7, 0x807A50D1, 0xCCDC43A3,
+   0x000000E5, 0x6880D712, 0x6A553420, 0xDD80C4CB,
+   0x92B60F04, 0xDCC9D35D, 0xF3538BA2, 0xD0787305,
+   0xD3166FAF, 0xB7D68560, 0xD2A1B177, 0x5E9F7915,
+   0x847AAF90, 0x5B83CC7A, 0x210046E5, 0xB4964926,
+   0xD26CE0BD, 0x00000179,
+   0xDED7931A, 0xDEBD96EC, 0xDFDB9955, 0x409A230C,
+   0xB65C48E6, 0x0EAE02D5, 0x3515EDC3, 0x3AB3DFF8,
+   0x3D119F82, 0x0440A0C5, 0xF7B8048F, 0x7601D278,
+   0x53655D73, 0x3E0DA581, 0x42C66D32, 0xA04162F3,
+   0x000000B9, 0xE0D030B2, 0xDC305022, 0xAF7D339E,
+   0xB812C6A1, 0x91973A30, 0xF845455F, 0x54ADE939,
+   0x3A40C4D4, 0x1E0972BF, 0x7D5B0F69, 0x8839861A,
+   0x7EADF7A2, 0x7D36E5A8, 0x87A2E706, 0xD13C7670,
+   0xA25554C5, 0x00000055,
+   0x2C79E1E7, 0x8EC2BC82, 0xFFB8B4D4, 0xEC5C692C,
+   0x0846B9F3, 0xA0D4D509, 0x33456629, 0x41EACCAC,
+   0xD484F510, 0x43E23429, 0x5018896D, 0x0BF959D3,
+   0xF257DAF3, 0xA817BFED, 0xA1FB8E26, 0xCD04BC49,
+   0x000000BC, 0xD92BCED4, 0xDA060441, 0x5D4EF4F0,
+   0x278C04C9, 0x396B753D, 0x8B6F0231, 0x4533E041,
+   0xF68CAA50, 0xD52BC9BC, 0x49D2F5F1, 0x0141E329,
+   0x83AC5515, 0xC866B038, 0x453951C6, 0x79ACDC69,
+   0x09B032D4, 0x00000196,
+   0xA848CF13, 0x5753BBB8, 0xD90C938D, 0x82B32A43,
+   0xE6FAA6E2, 0x7F5770D7, 0x7D684CBC, 0xC7CBCAF3,
+   0x2E7B48A1, 0xCF943B1B, 0x8D5C5321, 0xD1A7EE6F,
+   0x15CC06DC, 0x1AB34E2D, 0x74B5A5CD, 0x27D2CFBB,
+   0x0000006E, 0xAD3C3BF9, 0x022C5255, 0xF744D697,
+   0x3026A8B4, 0x74B6A2CE, 0x5CFB32D6, 0x5E50E51F,
+   0x8DF70A0B, 0xACE784B5, 0x8C9156A9, 0x487C3A9B,
+   0x2EFAD6CD, 0xAA2CEC88, 0xF5E804C0, 0xF9BD480C,
+   0x5780CC59, 0x00000035,
+   0x76178C94, 0x9E96EBDE, 0x53081E92, 0xB30646EB,
+   0xF47B37CE, 0xB2541CF8, 0x72CDFE16, 0xF5899B4A,
+   0xBC9855DF, 0xE86F9BEB, 0x2A3C7176, 0xCD97DE76,
+   0xAD4AF521, 0xE792C9CC, 0xE059FCEC, 0xF4EFAD3D,
+   0x00000153, 0x53A88FBB, 0xAD541C6A, 0xFB7C79B5,
+   0x817CEAC1, 0x7DAA33C6, 0xA4A04DAC, 0xF3D2D674,
+   0xFA09F56F, 0xEEC7D069, 0x9F53EF31, 0x9211CD93,
+   0xAD1E5AF4, 0x959D77D0, 0x0FF0A6DC, 0x76ED9AFF,
+   0xCB232DEF, 0x0000002E,
+   0x92F845FF, 0x586A5A4F, 0x433B9969, 0x4181E8BF,
+   0x1BB30E35, 0x8CA66503, 0x29EF7C76, 0xDDB88800,
+   0x93A91394, 0x91EC9439, 0x34ACF11F, 0xA1024387,
+   0xE3A99420, 0xB31BAB71, 0x823803AC, 0x46671DF0,
+   0x00000182, 0x23967817, 0x43116123, 0xD83ADD78,
+   0x10BCC7E1, 0x1B4D7EA3, 0x5CB65CE0, 0x5FC7AACF,
+   0xC204E739, 0x0DF86632, 0x138FD0EB, 0x2920E7AE,
+   0x5A7F3BF9, 0x74FB04A2, 0x323B55DA, 0xCF6B4579,
+   0x87A1CD2D, 0x00000105,
+   0x96AB1D1B, 0x28702DC4, 0x0DC11BA4, 0x2DBD7946,
+   0x883FAF9F, 0x0956696B, 0x227932D1, 0xCDB23F5F,
+   0x0DE851ED, 0x34957D5E, 0xD930F741, 0x40065B9E,
+   0x2138D1E5, 0x1BE82512, 0x34C7C9B7, 0xB9F0D759,
+   0x000001E3, 0x567EAD92, 0xBAF4143B, 0xFB9CC866,
+   0x5EEF3357, 0xCB122A8B, 0x4095892C, 0x14B8AA9F,
+   0xA3E50AE8, 0x376F6B0B, 0x72024C42, 0xDAE219E2,
+   0x6C63EE2D, 0x2069C115, 0xBBA10178, 0x7F96DEF1,
+   0x3BA8834D, 0x0000015D,
+   //Window 122
+   0x66BC31A5, 0x8DD33D1C, 0x9D19C1C0, 0x80A07495,
+   0xE03A1EE5, 0xDA13C485, 0x68ACFD38, 0x316D85F9,
+   0x0D9D6273, 0x8617C80D, 0xF94D5F22, 0x6DDEBB71,
+   0x8EFD0A44, 0x1C345203, 0x7B3746E3, 0x7CA0B406,
+   0x0000007B, 0x87436D56, 0xBEC7B150, 0xA01F6C04,
+   0x07CF1192, 0xF73971B0, 0x047B37F6, 0x5AE1F9D4,
+   0x7E7D8B9B, 0xCA1A9900, 0x0E311B4F, 0x6A81FB38,
+   0x5DC55F3D, 0x2956AF04, 0xE257401A, 0xF66AE95F,
+   0x90C2AD09, 0x0000016B,
+   0xA3FAA4B9, 0x15C0760B, 0x62D67946, 0xAC263E6F,
+   0x0E0F2550, 0x3F5E1ECF, 0xFE856EC7, 0xD6F9E25D,
+   0x89E42E60, 0xDB3156F4, 0x9D08DD80, 0x944CCCE2,
+   0xD586A10E, 0x241B875D, 0x8556ADCB, 0xE47CB500,
+   0x00000035, 0x4F99CE2F, 0x9C259AA7, 0x17FE9E72,
+   0x74198282, 0xCE9D9617, 0x53B45886, 0x9541BD1F,
+   0xBC7EE9C5, 0x91A3D63E, 0x0B985162, 0x358B75AB,
+   0x6E75F3F8, 0x2440CCDF, 0x34AFDC0E, 0x47A18648,
+   0x0F8D214F, 0x0000015C,
+   0x2D86220C, 0x5940D1D3, 0xF17EBB24, 0x0745F4C7,
+   0x611DA884, 0x043B323D, 0xE09E3BE1, 0x3AA9CC05,
+   0x9DCF7703, 0x357E6B9A, 0x4C13C6E5, 0xF9AC02BE,
+   0x3D1CCB65, 0x38212531, 0x9AE3BF3D, 0xED41DBB9,
+   0x00000074, 0x4139B92E, 0xFB7FC637, 0xA50A76AD,
+   0x46D5B8DE, 0x07BE1EB9, 0x281AC30F, 0xCB7414A9,
+   0x059DEB0C, 0x1CCEC832, 0xEA9DF76D, 0x0DC155E1,
+   0x0BD186D0, 0x329513CF, 0xF39D6482, 0x10911066,
+   0xAB97B70C, 0x00000163,
+   0x8EEEF2D6, 0x8943A18F, 0x8399362C, 0x2E5273F6,
+   0x41DEB9C1, 0x4DBB9BEF, 0x1088C6F4, 0x9E34C73E,
+   0xCC859471, 0x66047479, 0xFB704F9B, 0xEDE1B31E,
+   0xA4F3DDCF, 0x7C8FCEC4, 0x68AACAA4, 0xC8D156E3,
+   0x00000069, 0xC3D5F95F, 0x5C60E434, 0xD2BE9D81,
+   0x4CDF7439, 0x27745B69, 0xCDE0DFDD, 0x1DE6CA4B,
+   0x2F64DF96, 0xD1580DF0, 0x6604CBB6, 0xD0239649,
+   0x7F10BEE9, 0xCAA1F385, 0x5A5F9B06, 0x5287281E,
+   0x6C0D20A3, 0x000001F4,
+   0x31DF70BB, 0xE5163A21, 0xC9393D38, 0xDDFCCE47,
+   0x02C23EBF, 0x5BAF3EB8, 0x1C7BEE32, 0x8C899914,
+   0x0A259EAE, 0x32587D38, 0xEC6355A1, 0x01C19DC2,
+   0x87EF1798, 0x6A0D12AE, 0x29C3FBE1, 0x60D701BB,
+   0x000000F9, 0x0DB4C852, 0xFB3B62BF, 0x1C300C74,
+   0x7F3CC59A, 0x71D74A7E, 0x70836E60, 0x6DB4278C,
+   0xBD18BEA8, 0xA5EA467A, 0x93C68191, 0x9230D91F,
+   0x8DCD58BC, 0xB56339AC, 0xA1335C10, 0x42DE9EC4,
+   0x8D1127D7, 0x00000049,
+   0x85A4D17A, 0x07C7D1CF, 0x9DA9D4CD, 0xBB87ABD4,
+   0x6D6D7B03, 0xDFD1E63C, 0x43B978CD, 0xA0317851,
+   0x9E95A176, 0xA72B376C, 0x395256C8, 0xF79DAFF3,
+   0xBF714C8B, 0xDA28EA45, 0xA950D4C8, 0x1AA1D1F0,
+   0x000000EC, 0x1414CADC, 0x45C61E6C, 0x9CDC6C6D,
+   0x79E473A6, 0xDE550EFC, 0x63A401E2, 0xA4A1B241,
+   0xA007F3D8, 0xEDA2C1A0, 0x9FBE64FE, 0x2E840BE8,
+   0x86890BDC, 0x2A76E98A, 0xBBB490B9, 0x3D103446,
+   0x35B65CB4, 0x0000003F,
+   0x6DB327A0, 0x5B4FDEE3, 0x9BEA9535, 0x410BE5B3,
+   0xE8755850, 0xB54FE965, 0xE25FD1FF, 0x0FA3FE28,
+   0xF19E917B, 0xD8BA2016, 0x7F4DD845, 0x5F98897B,
+   0xA937CF44, 0x9457A7C8, 0x5BA3EA47, 0x0FDC895E,
+   0x000000E5, 0x4316C9F3, 0xFE6DD2D9, 0x4915E45F,
+   0x030F499D, 0xF0F44149, 0xA4304A35, 0x0B59FF89,
+   0xE72BAC7A, 0x5A17EE7E, 0x89FEA32C, 0x85F9C15A,
+   0x7E0DB6D8, 0xCA989283, 0x9DBB9DA6, 0x88C77E7F,
+   0x0CE924F9, 0x000001AA,
+   0x6D69D68B, 0xD9F6083A, 0x748E0E5B, 0x929F9C35,
+   0xB3AB3E11, 0x19E140A4, 0x7C0C3E5C, 0xCC32B60F,
+   0x60B3500A, 0x9EF01496, 0x2829F34E, 0xC1781B62,
+   0x6D90546B, 0x3858EEB9, 0x53EEEA6B, 0x91746C61,
+   0x000000B4, 0x488FB2C0, 0x1BDCB9A6, 0x0FE2BFD6,
+   0xC01591A9, 0x8BDC797F, 0xEE71286B, 0x7AB959D1,
+   0x76C384C8, 0x389C98BF, 0xA5076F2D, 0x247CDD43,
+   0x6B7B1656, 0x2FB5E539, 0xB269EADC, 0x4FB854EA,
+   0xE80F0B91, 0x0000014C,
+   //Window 123
+   0x72E2518A, 0x61064029, 0x7B5FBFC1, 0xFACD33FA,
+   0x7632AD67, 0xD50F7771, 0x1F0D2282, 0xBA868807,
+   0x04D90803, 0xACACD911, 0x51496EE8, 0xF94B3E0F,
+   0xECE3C365, 0xFB8A5406, 0x620400F2, 0x96F5C5E7,
+   0x00000109, 0x36988CBA, 0x7389F3DD, 0x762CA5F4,
+   0x4AB5C460, 0xB5CF8989, 0x9B96CF82, 0x158A4C79,
+   0x2FFA0DB5, 0x3A3D24F4, 0xB5821B1A, 0xF8C464D0,
+   0x17771CB7, 0x62C59A09, 0x9FFD7646, 0xDC162385,
+   0x0EEFA35F, 0x000001E1,
+   0xEA39D3BE, 0x2FF0F1CB, 0xC7F3195B, 0xA756A96E,
+   0xDEB42713, 0x1DFBDEDF, 0x4A87567A, 0x7CB9E1BE,
+   0x0D2CEC73, 0x64541AA3, 0x0A0327B0, 0x8EEC2269,
+   0x0C157F20, 0x967B1BC1, 0x2D8969E0, 0x2A6F1A40,
+   0x00000181, 0xC471C0CB, 0x42547F4C, 0x815EF0F1,
+   0xB990B1A2, 0xFBC29AAB, 0x672398CB, 0x104AC38F,
+   0xFB7E649B, 0xE9CF1E5A, 0xF0BA1354, 0x2CD48A07,
+   0xB0C191DA, 0xB41854F5, 0x1FC70FCD, 0x2504091B,
+   0xF1129546, 0x00000195,
+   0xF794BFED, 0x49082B82, 0xA7508BA4, 0x090AD58D,
+   0xABF36DE8, 0x016C6C61, 0xC17D97E8, 0x69744E76,
+   0x5087CCE7, 0x64BA471F, 0xF3FD22DA, 0x45BAC2BB,
+   0xE8F6671E, 0x1BBC08F0, 0x268427BE, 0x6E45905D,
+   0x0000007C, 0xD810AB70, 0xFDC632D4, 0xF9546668,
+   0x2D68F73C, 0x178148AB, 0xF506EF8B, 0x162C23C7,
+   0x95DB78DF, 0x33DBAE55, 0x4DF86CB9, 0x7D81EDC1,
+   0xE47825B7, 0x56E1496E, 0xBE784190, 0x48F497EC,
+   0xD707FA3A, 0x00000008,
+   0x14198957, 0x9A9D1B19, 0xB8B27468, 0x09272B36,
+   0x78D8695E, 0xA8ADB294, 0x28E6B551, 0xB2A77EF9,
+   0x71983BBD, 0xB92C59A1, 0x37661116, 0xAE272180,
+   0x9058858F, 0x8AEDB3DD, 0x716B7A4D, 0x2EA5BEBD,
+   0x00000188, 0xB534AC3F, 0x43BCD03E, 0x8D025A80,
+   0x0A3A6429, 0xDCAA5EA0, 0x3E6A0674, 0x2A7BED53,
+   0xA0B44692, 0x7D1D2FDC, 0x962C4543, 0xE3EC4A2C,
+   0x4651CCF2, 0xA883B3F8, 0xAA08F169, 0x513A5D60,
+   0xBCD939E4, 0x000001B8,
+   0xF31F03E4, 0x35900C17, 0xCACB20D0, 0xD46AB57E,
+   0x1F2EC957, 0x346E2E7D, 0xED3E9556, 0xCC002CED,
+   0xD2729AFC, 0x34AF851D, 0x7EF8AD10, 0x38F4C700,
+   0x2514F43A, 0x9383B41E, 0x3156A417, 0x41F5A0C4,
+   0x000000C9, 0x0573CF6E, 0x0430EB17, 0x27B7F3D0,
+   0x75CC52B2, 0xA0C813BD, 0xA0306601, 0xBF1A5BC9,
+   0x202894D4, 0x9CE7D613, 0xAA87196D, 0x644485AC,
+   0x23A3FB14, 0xE9854099, 0x5D9B9F3A, 0x91C4B3DA,
+   0x76D33837, 0x0000007B,
+   0x37932307, 0x3AEDEC9F, 0x3C278C5C, 0xC90BA7CC,
+   0x04BE1C8A, 0x2172D220, 0x7CE8E3F3, 0x9D9943B3,
+   0x211548BC, 0xBFEC2077, 0x1D011EE4, 0x938E1D2F,
+   0xF14F2246, 0xAC9BB9D5, 0xAD89A636, 0x44152B2D,
+   0x00000182, 0xC7E6C8A8, 0xEE7DA6C1, 0x61FD9A43,
+   0x3C6D8DBF, 0x74A9C52F, 0xBF8DAAEC, 0x9BFAD08D,
+   0xF71E888E, 0x8AAD6006, 0xB16028E5, 0x89A9EF88,
+   0x203343CA, 0xB9B624AD, 0xB218490D, 0xD01F5FA5,
+   0x8B7BA480, 0x000000E0,
+   0xB68CF907, 0x31DA39DB, 0xD1E99729, 0xB02E9060,
+   0x89BB1507, 0xADD55A96, 0x4B5470A1, 0xECC7856A,
+   0xEAB8CB1F, 0x40A83460, 0x2B2C9159, 0x1C1F3C11,
+   0x7883FF7A, 0x7B97B58F, 0xBDE1CAA7, 0xE7E97A4A,
+   0x00000139, 0xB8ECC0D1, 0xFA1DA9D4, 0x6E7641B3,
+   0xE6212DF1, 0xEBB36F6A, 0x828C55C6, 0x09D6A861,
+   0x5B7EAD16, 0xC2844248, 0xDB35A05F, 0x776DD2CB,
+   0x3C5089B2, 0xED9EB5B0, 0x2B6595BF, 0x4D176CC9,
+   0xBDDFAF00, 0x0000008F,
+   0x495AF650, 0xD8A907F1, 0x7A3AC35D, 0xBCB3F6E2,
+   0x606706AD, 0x1ACED00F, 0xA2E1CF9D, 0x8CE32C00,
+   0x05F91CAC, 0x1E0E9797, 0x9E98AF3A, 0xAB21E96B,
+   0xBBE3C415, 0x92F4E6DB, 0x46C929AF, 0xFD9B4076,
+   0x00000097, 0xEEE8423F, 0x5DA0209D, 0x098EEB14,
+   0xA22AF5CF, 0x16E722BE, 0x5E379BE2, 0x9680B5AC,
+   0xE06CDA5B, 0x311D0269, 0x832C5AEB, 0xE4943D03,
+   0x7471C5D7, 0x0776D3EC, 0x148E2EF2, 0x0C51EFC3,
+   0x658A17B5, 0x000001F2,
+   //Window 124
+   0x945039AC, 0x0CE1F2D1, 0xFDF94D41, 0x1D1E6504,
+   0x8752D630, 0xF36EAFD5, 0xEFBF0132, 0x24477F7F,
+   0xC02BF85B, 0xAE8FBA2C, 0xEB510E61, 0x53A24CA8,
+   0x9C2C453D, 0xEADBC7F7, 0x310EDA46, 0xCFDBC9DC,
+   0x000001A9, 0xD8F82B51, 0xFBF287C8, 0x7F0ECADA,
+   0xB7CA6096, 0x15242666, 0x1DC411B7, 0x3DC6ED96,
+   0xEBF82D6C, 0xD0A92B49, 0x8F82229D, 0x9DAC585A,
+   0x75A6A4A7, 0xC839248A, 0x443AE75E, 0x1BA7C9C3,
+   0x4DEFB89F, 0x000001B5,
+   0x065D6929, 0x68205CA5, 0x039168C3, 0x15F79567,
+   0x74DD0EFE, 0x055D11E3, 0x980ED709, 0x13D65191,
+   0x91CB9DAE, 0xC819A8BF, 0xC7A39E18, 0xD1EF1626,
+   0x274C7AD7, 0x1CFED493, 0xAA0280F5, 0xB2FF9CC1,
+   0x000001A0, 0x82BBE037, 0xAFEE1166, 0x5DD65916,
+   0xF54D3BF0, 0x47DA6A80, 0xCF8D694E, 0x787E892E,
+   0xC350309B, 0xF87D2CA5, 0x13A4BDBF, 0x0ABC535B,
+   0xE5C927D1, 0x8D2B5113, 0x5532B565, 0xD904BB5C,
+   0xC0F0222F, 0x000001F5,
+   0x48237525, 0x532BD215, 0xF826B4E5, 0xBB14742D,
+   0x4D9F4791, 0xDDADBE44, 0x6344CDDF, 0xCDD681D7,
+   0xB5AF617C, 0x721F15A2, 0x7433253C, 0x2740BC18,
+   0xA3C6809A, 0x727759A2, 0xE802EB9E, 0x2128A7A5,
+   0x0000007D, 0xD9C2052A, 0x41B7109E, 0x71A26434,
+   0xA0CB7262, 0xACA51897, 0x50F1DC72, 0x67067A10,
+   0x28CACA35, 0xCD61B985, 0xAB969C93, 0x491A61D2,
+   0xD3986E20, 0xDC034A35, 0xCFD5713C, 0x0525F8AA,
+   0x6FAD3626, 0x000001B3,
+   0x0ADFEE2F, 0x8104E371, 0x3A0AAF8B, 0x021A434F,
+   0xA2908065, 0xD2A2E82C, 0x1E0D4B4D, 0x770F059D,
+   0x962BA072, 0x7B4DEFE2, 0x31DD59BE, 0x81835947,
+   0xD6638F80, 0xDA69E9A5, 0x114759D3, 0x58F0BCA6,
+   0x00000154, 0x9EF7A0C7, 0x0DB1AA52, 0x16F4ABF3,
+   0xB2450BD8, 0xAD0D02AA, 0x0670492C, 0xE2C5C42B,
+   0x6CDB3460, 0xDDF42A06, 0x663BD232, 0xF76EBEF0,
+   0x23550ED5, 0x8D9CCB9C, 0x0FC63284, 0xD425EF44,
+   0xEB0B313F, 0x0000001A,
+   0x60BC6BDE, 0x0D68D12F, 0x09BBF4B4, 0x6001CA9F,
+   0xA9D3F22B, 0xDFEF43AC, 0x268008BC, 0x07F36EC2,
+   0x01E5CE02, 0x927D953E, 0x316D404B, 0x986A398D,
+   0xD6C69AF9, 0xA5F0B888, 0x4E047A86, 0x696EA4AB,
+   0x000001B9, 0x5AEC8177, 0x01D936B1, 0x29FF495E,
+   0xC9178F28, 0x6875AD0A, 0x85845A06, 0x3EA3DBEA,
+   0x2B65FDEA, 0x8908096E, 0xBC535C63, 0xB549637A,
+   0x2A3AFC5A, 0x3A31B4AF, 0xF54CB6ED, 0x4D19E739,
+   0xCD3FA4C1, 0x00000017,
+   0xF51788C3, 0xF32D5FAE, 0x815C16D0, 0x8346895B,
+   0x2E426F50, 0x27D4A43E, 0x93FDB664, 0x77CDDD7B,
+   0x2F3EC9CA, 0x70FC0BB7, 0x07957391, 0x6D04715B,
+   0xB2459241, 0xDF972FF1, 0x3E9F78E1, 0x66436160,
+   0x0000004C, 0x40DCB28A, 0x73EC8F90, 0x673FC68A,
+   0x044D454A, 0xB3024805, 0xC09F9EA3, 0x542FDC34,
+   0xF7BBE29C, 0xE26DF556, 0xB44F9C3C, 0x8863C75F,
+   0xAEA12307, 0x9FDCF582, 0xA229FEAD, 0xB3F1E6C7,
+   0xE84269B2, 0x0000004E,
+   0xF88E473B, 0x262448CD, 0x3A95BBD7, 0x93ABD477,
+   0xE4DFD381, 0x6AB8F2B6, 0x332001EC, 0x9C333DC5,
+   0xED85F215, 0x10F8F684, 0x6824087B, 0x6302FB12,
+   0xD8B56E13, 0xFD09387C, 0xE3D7FD78, 0x9798EE3B,
+   0x00000077, 0xB27A72D8, 0xA0C6DA08, 0x021A2C0D,
+   0xE8A34850, 0x077CCBA2, 0x7C61148E, 0x8E1E7E8E,
+   0x690FE02D, 0xE95A3952, 0x5E80DBAA, 0x7319900A,
+   0xC9E270AF, 0x6508E84B, 0xBDD5715E, 0xEA1D1CC8,
+   0x31BAA323, 0x00000037,
+   0xCE383299, 0x5D5E9512, 0x858FD0D2, 0x8FD49641,
+   0x932EE52D, 0x48C282F5, 0x980EB988, 0x53A0FE9A,
+   0x50D9BFA8, 0x947C916F, 0x4396BBE9, 0xDE9B933A,
+   0x25E64DEA, 0x0C56EFB4, 0x7FCE085D, 0x7BE79221,
+   0x00000125, 0x4193D3A0, 0x28132301, 0xBF8DFECF,
+   0xD5DC4679, 0x6984C1D7, 0x77513BAF, 0x389B5C34,
+   0xF46916F1, 0xF4A1AFA9, 0x2C271D08, 0x1653A5BD,
+   0x6CAFB28C, 0x6BE94DBC, 0x931DB269, 0xA455620A,
+   0x1A2FE5F1, 0x0000002D,
+   //Window 125
+   0x3C80F820, 0x4270A797, 0xD8E3DB55, 0xE1455E1C,
+   0xC31EEA36, 0xFC7D04B5, 0x8237619E, 0x86D4B43D,
+   0x5696AC8B, 0xCA90FEAD, 0xBE0A5D49, 0xD1DF350D,
+   0xAEA06270, 0x844E818F, 0xD89CC1DC, 0xFA19B70B,
+   0x000000FB, 0x52FE816F, 0xBAE72FF5, 0x9A5A3747,
+   0x7B5D9E52, 0xA689A68A, 0x7A7EADCC, 0x330BA649,
+   0x18DEC239, 0xEB30BD8F, 0xAFC49E4C, 0x80C1A715,
+   0x25042716, 0xBF6E92D9, 0x4D5AAFFF, 0x7577CC4F,
+   0x94AF51FB, 0x000001B9,
+   0x3E0BEF3F, 0x8E1A6C2F, 0x14018B23, 0xB715403E,
+   0x613F0C37, 0xEFC99827, 0x13170A30, 0x92437B56,
+   0x9468E300, 0xE84CBE8F, 0x4BAB3970, 0xE69B08F1,
+   0x1558E9D6, 0xFCB78F77, 0xAF25ED50, 0xC0140529,
+   0x0000017E, 0x168134C6, 0xFF3FA668, 0x2BCC2E99,
+   0x46E8EDC7, 0x86BFBF06, 0xBBEBB21C, 0xF204DD32,
+   0x6B7D6159, 0x1FC7E40A, 0x75BB85EC, 0xAD14C187,
+   0x0F3E1043, 0x000A86BA, 0x44187117, 0x13D09DEF,
+   0x556420BB, 0x00000177,
+   0x3B50A230, 0xF0FA90D8, 0xFD95910F, 0xDD15885F,
+   0x48038A64, 0x4105A4E1, 0xAE07FCD1, 0x2F69D817,
+   0xD0484F76, 0x0536353F, 0xB8D64BAA, 0xB3BEB1EE,
+   0x58ADC510, 0x2FF37FF5, 0x49F78E1F, 0x5677B991,
+   0x000001B0, 0x43B8275E, 0xE22BF1CE, 0xB7BC2931,
+   0x5EC18F04, 0xF01FA620, 0xCB53D3E0, 0x9587E525,
+   0x49DB793F, 0x5C884F2D, 0x7F1E4CA3, 0x59437624,
+   0x5AD4E4C4, 0x4994207A, 0xA1E3329F, 0x88594AEF,
+   0xE4CB938F, 0x000001CE,
+   0x734C5662, 0xCD2CDD2E, 0x52FCD5A2, 0x086508DD,
+   0x65545779, 0xD1789E1F, 0x3EBF0E2E, 0xA3E5A37A,
+   0x21F33614, 0xA648B511, 0x000154BE, 0xC1B816D4,
+   0xA8F82A71, 0x7D9C4292, 0x6F43867B, 0xF0F81CB8,
+   0x0000001B, 0x2B51C7D5, 0x1FE1F996, 0x06A54F1C,
+   0x5C77E780, 0xDCFA901B, 0x79DC60E2, 0xBBD1244E,
+   0x2C548507, 0x15CA7601, 0x59CCE9C3, 0x8F106B96,
+   0x2EC82571, 0xF5DC4E24, 0xC1EBCF8D, 0x1448C529,
+   0xB785EE5F, 0x000000D5,
+   0x7EE7BD6F, 0x2D097EB3, 0xAE5F90E0, 0x69F628B2,
+   0xC085AB02, 0xB66FDE22, 0x8C37D985, 0xB92EA693,
+   0xCBD2EDE0, 0xDF48A816, 0x39A54F77, 0x72FECA76,
+   0x1E010C59, 0x23C12AF2, 0x06D1B180, 0x70A98471,
+   0x000000A2, 0xD1A5C22E, 0x3D3D798D, 0x2449ECC1,
+   0x84A3B9CD, 0x5C945B4E, 0x663D1F11, 0x776095EA,
+   0xDF6EF3EE, 0x4123E9F6, 0x4ECEB1E8, 0xD51910F5,
+   0x43A5FC47, 0x7F82C9F2, 0x7ED8C168, 0x24829770,
+   0xE85DF3ED, 0x0000003A,
+   0xC860A565, 0xD43C6D81, 0x33F30C31, 0xE0A87EC9,
+   0x036F96CF, 0xFE006AD9, 0x92D0D9FC, 0xCD4C1000,
+   0xB2CE5F90, 0xC7EF53A3, 0x5BB8B35A, 0x61A9C480,
+   0x4C749C08, 0x55F91321, 0x285E3E42, 0x4E12D6EC,
+   0x00000144, 0xCD23314B, 0x80DB0B68, 0x79DA65C7,
+   0xD6880D3B, 0x81BF1BA8, 0x77B6B6DB, 0xFC478427,
+   0xE5FD0C4D, 0xF05B693C, 0x114C21E7, 0xBCDF7332,
+   0xAF4FB843, 0x42BD3159, 0xDCD23F08, 0x8376DF1A,
+   0xC01352DF, 0x00000093,
+   0x9FD49E87, 0x7B2E5A5D, 0x2FFEC17F, 0xAD5BEC2E,
+   0xE5A6A8A1, 0xDC49ACA9, 0x854B52D8, 0xF2CF905C,
+   0x0539271D, 0x921C2E58, 0x614C09DE, 0xA2A6CCE9,
+   0xBB1F7E74, 0x19515706, 0x4329F30F, 0xBD59E462,
+   0x000000B9, 0xFF093B63, 0x6875E814, 0x7C12C1CE,
+   0xA5527D42, 0xC732E727, 0xC959D9AF, 0x685962B1,
+   0x9FD4E513, 0x03116D62, 0x6FF55625, 0x1876A15E,
+   0xB3EFDDFD, 0x243A14A3, 0x2FA73256, 0x10E74AB3,
+   0x798C96DC, 0x0000007D,
+   0xF0626BFA, 0xFEA5C732, 0x9227FACF, 0x84F08F1B,
+   0x0DC94F56, 0xEF625513, 0x1B3F90A6, 0xFDF1F115,
+   0x37DA26AF, 0x13B8F36C, 0x762943E3, 0xDA51EFA9,
+   0x7ADE265C, 0x1CCAF39A, 0x970F4DE0, 0xA6EE8CE9,
+   0x000001CB, 0x6D955E29, 0x76336D3F, 0x240BEB57,
+   0xF620472A, 0x1FA41EF0, 0xD1C32A88, 0xBEC2C892,
+   0x97DA68DA, 0xE45B9667, 0xED864144, 0xBE5B29EA,
+   0x1741917B, 0x9FDDB570, 0x4B9DAC82, 0x113811D6,
+   0x905FD0B4, 0x000001BF,
+   //Window 126
+   0x9DA7BB54, 0xFC5BA8D5, 0xA7C7FBCB, 0x29F3E817,
+   0xA40AD3FC, 0x31A34412, 0x2D1711B0, 0xE17B9369,
+   0x16EE6505, 0x41C7BC17, 0x3D1DB8CA, 0x5FEECFFD,
+   0x02F9E04E, 0xCBB93378, 0x091DB41E, 0xAEB67B8B,
+   0x00000187, 0x4C695615, 0x611FE09D, 0x323B6DCC,
+   0x087334F6, 0xD53BCFDC, 0xF7BD51BB, 0x5A8BCDB4,
+   0x98AB5C92, 0xCCCD6F6A, 0xE7E9D273, 0x24B4A3EA,
+   0x2582B219, 0xF22C4405, 0xF8FEA0E3, 0xD3E5A701,
+   0x42C0F700, 0x0000006D,
+   0x76F468B8, 0x38E5B06F, 0xC79FA86D, 0xEAB47690,
+   0x6EF8CD4A, 0x990E59DE, 0x6884D059, 0x826C78E8,
+   0x341B20F7, 0x951732FE, 0x449DDAE6, 0xF249FAE4,
+   0xA30A08AF, 0x32C4B1E5, 0x15BE777B, 0x79FB2CAB,
+   0x00000027, 0xC3F609D4, 0x1C65411B, 0x6194FA7E,
+   0x4A8EC137, 0xA41C5F89, 0x025DD9CA, 0xE9D5AA4B,
+   0x878F8D01, 0x0F364D3B, 0x34C9E12E, 0x344CF712,
+   0x5F4403D0, 0x5BEA60C3, 0xE66BB782, 0xD40E673A,
+   0x4DC50E44, 0x00000125,
+   0x6221C6F8, 0x4515DA10, 0xBD34CAF6, 0xBF5FD8E5,
+   0xC7A869A1, 0x9174AD19, 0x57152EF1, 0x3E327C13,
+   0x222CBBE4, 0x58656B31, 0x1C4191EF, 0x11189214,
+   0xB7143EC8, 0xA5E5AD3E, 0x4536E2FD, 0xE0646AFA,
+   0x000000E9, 0x6D16BAE5, 0xB13D2448, 0xAF57B380,
+   0x42431B34, 0x5E097FD6, 0xCAFE4101, 0xE5B0937F,
+   0x5F794CD6, 0x55270A50, 0x4DE1813D, 0xB660BC2B,
+   0xCA0A5C09, 0x76579886, 0x08F20F6B, 0x2ADA1C30,
+   0x21268E68, 0x000000B1,
+   0xC0D037F7, 0x50714FB3, 0x8C050618, 0x071BFA5B,
+   0x9D15E2F1, 0x7F179826, 0x29E730FA, 0x20810397,
+   0xB45794D1, 0x7948C181, 0x171227AC, 0xC8FBDEE3,
+   0x45DA4E9C, 0x1FAA4670, 0x0D3FE74B, 0x565405C0,
+   0x0000007C, 0x3F42236A, 0x353FC94A, 0x7BC40D6C,
+   0x684A11C2, 0x52826E75, 0x182CA3AF, 0xD4058F7F,
+   0x7B24ECCC, 0x82386F7B, 0x6CADB9BA, 0x3567D0EA,
+   0xEEBCDEB5, 0x1E8C8CE2, 0x904FD55C, 0x6B578B37,
+   0x43FD20DB, 0x000000A5,
+   0x8B313476, 0xEC99F07E, 0x52530DE1, 0x9856C5B3,
+   0xF2693956, 0x08CA437C, 0x8F4122AA, 0x990F6A86,
+   0xD76BB2AB, 0xA36C9D84, 0x1E657EF9, 0x6004FBBF,
+   0x4108D873, 0x6C64F52F, 0x70224F93, 0xE3E589A6,
+   0x000001A4, 0xD6132691, 0xAE219487, 0x5BB911E5,
+   0xB2671150, 0x15177196, 0xCDD0BC5F, 0x2605FD89,
+   0xB093AAE0, 0xC319A26E, 0x26D1C416, 0x6EF59CB6,
+   0xE8916E3D, 0x6E79807D, 0xB05A13D5, 0xC039CD95,
+   0x8A178214, 0x000000B6,
+   0xF7286539, 0x6E985FDC, 0x26699ADF, 0xBF44AE05,
+   0x751DA127, 0xBFE83F9D, 0xD22871D2, 0x7DF2F5C0,
+   0x09F210A7, 0x61A184DA, 0x9E56E9BC, 0x69B4001A,
+   0xF5801782, 0x3F48DC50, 0xE0BC2F08, 0x114FB0A2,
+   0x0000002B, 0x011D6DE8, 0x44EB8F92, 0x20DF8124,
+   0x3E0FE243, 0x71B8153A, 0x494B83E0, 0x1CBC91E6,
+   0x6B50C1E3, 0xB8F14373, 0x260D1694, 0x98782CD5,
+   0xF12E1B92, 0x7211A9DE, 0xB8BC2AFE, 0x6EBBAD8B,
+   0x3604C239, 0x00000123,
+   0x93EE1688, 0xE8EAA2B0, 0x1BD7B754, 0xAB51392F,
+   0x7F0113F0, 0x70FAAF84, 0xCCDFA903, 0x0B68566C,
+   0x9114D07D, 0xBD54A08C, 0x2EB3D473, 0x4370AF4A,
+   0x30650B8E, 0x6F5596B4, 0xBDAEEBBB, 0x1D9D998E,
+   0x0000009B, 0xEB570CA0, 0x1E07AAB3, 0x83D78D65,
+   0x6CC57178, 0x27E07BA1, 0x5C13B039, 0x8593ACF1,
+   0x4A8DB725, 0x4560970B, 0xF2FBBA8B, 0x79FE5510,
+   0xA7EE45FB, 0x7DF14EDA, 0x8DEFA4EC, 0xF6249CAC,
+   0x664E0D14, 0x0000005A,
+   0x1CBA39AE, 0x93D8A6CC, 0x78B306EB, 0xC09391F0,
+   0x6BBE7209, 0xC5019279, 0x69C4000F, 0xAE87581B,
+   0xE29CDE0C, 0xAACA7F02, 0x87D2F7B9, 0xF4952367,
+   0xD01D00D5, 0x831F4D68, 0xBAE32D64, 0x17C135AC,
+   0x0000002A, 0xFA7A973E, 0xE83E6BBE, 0x8ED040DA,
+   0xAA3D6897, 0xB7726A22, 0xB2915BB0, 0xC39A8A47,
+   0x84C84815, 0xB29908B3, 0x42FB407E, 0x41B90531,
+   0x9A5BE918, 0x6025EC50, 0xD534B5CE, 0xBD08106D,
+   0x56F74C30, 0x000000AC,
+   //Window 127
+   0xA3A2BE76, 0x312DC896, 0x61DA109B, 0x9E77C0C3,
+   0xBF0993BE, 0xB1C5379D, 0xB7BCC4DD, 0x9272B9E8,
+   0x09337D54, 0x5437F625, 0xCF735302, 0x5C897A61,
+   0x002DB288, 0x368E21CA, 0x184AEE4A, 0x33197CC1,
+   0x000001AF, 0xE5C35F69, 0x76EC7312, 0xC07874D4,
+   0x6832A65A, 0xC121E8C9, 0x398DAB5A, 0x97B47C38,
+   0xF88AA2C8, 0x07678CF3, 0xFC77E1C0, 0x345A9B89,
+   0x7327A90F, 0x49240B3E, 0x267417A0, 0xE3912921,
+   0x3AA3EA97, 0x00000116,
+   0xDBA3263A, 0x29D30CCF, 0x58F319D0, 0x3DDEC6F4,
+   0xAA8889DE, 0x6859BE59, 0x37E57788, 0xD21B5A3F,
+   0x8E56E5F0, 0x0BC2F50B, 0x2B8C2B6D, 0xB76D24E4,
+   0x5731D66F, 0xD7B4C557, 0x8A0E50A1, 0x59D33A6E,
+   0x000001E3, 0x57DC5E0B, 0x4DECDB8E, 0xD8E33978,
+   0xE1FD10AE, 0x17F26C32, 0xBC70D10B, 0xA9D2255D,
+   0x15026720, 0xFB625FFA, 0x68A1E644, 0x0B24BB44,
+   0xDD3DCA9F, 0xF8932BC0, 0x3A192D90, 0x76268713,
+   0x0F7120B4, 0x000000D5,
+   0x8CE85B23, 0x24B869A6, 0x63B5011F, 0xCAEDAAFF,
+   0x82987CA1, 0xC8B5D84E, 0xA44A8BBB, 0xC6960DFE,
+   0x9FDC95CE, 0x83D1EC6B, 0x2D666E45, 0xF30C2D5E,
+   0x6D92A25B, 0xEB743DA7, 0xBAF0F20B, 0x3F4AC0F3,
+   0x000001EC, 0x10321910, 0x5DD95183, 0x1DD9D170,
+   0xFB9C06AD, 0xD5F9DBC6, 0x020AC2DA, 0x372D2ADE,
+   0x9A9E842B, 0x09A85C7F, 0xD62D4C64, 0xCCD72A88,
+   0xF12BFF21, 0x7FEE26FA, 0xDB1876D4, 0xC202BE11,
+   0x27913F5C, 0x000001A1,
+   0xE6C5B553, 0x5438F933, 0x1C80ACAC, 0x6F01A8A4,
+   0x9EB0B0F8, 0x5A25BD9B, 0x12959E24, 0xDF47BE5C,
+   0xE5B854AC, 0x10D9338F, 0xE7C3F1FD, 0x8545EB47,
+   0xD5A20D8A, 0x18E1F37B, 0x7A837AA9, 0x222A7056,
+   0x00000155, 0xA2862A80, 0x213B368C, 0x668758C8,
+   0x67A67CFA, 0x0E3C7BAD, 0xB262ABB1, 0xED814AA0,
+   0xD310888E, 0x6BDE422B, 0x1F258409, 0xD8D5E8DF,
+   0x7505C265, 0x12EB7885, 0xBC7CC14E, 0x9B41D8C0,
+   0xA78E6416, 0x00000097,
+   0x7AA42326, 0x2804CB22, 0x9687C2D6, 0x68362B9A,
+   0x1E27C7C3, 0x1DCE1160, 0x102F1275, 0x30D1AF19,
+   0x55DDEB94, 0xF74A075F, 0x7A4E9F87, 0x4F84DE61,
+   0x0AC18472, 0x4D53A035, 0x6E4290B4, 0xDBA3E51A,
+   0x000000D3, 0x32CFF069, 0xBCFC6CD3, 0x5BAF3F63,
+   0x5F20FA5E, 0x778E7C9F, 0xFEECB0FD, 0xCA4C764F,
+   0xD12849A7, 0x15029ECA, 0xB35F55A3, 0xB5B3C5C2,
+   0xE84AF54B, 0x897D049A, 0xE50A70E3, 0x7BFAF1FD,
+   0x7A0734D1, 0x00000042,
+   0xAF2EA01E, 0x6A34DD81, 0x284D94B6, 0x2491D8A0,
+   0x2ADA657B, 0x2634FB6D, 0x86772CE5, 0xCD2642E6,
+   0x31A8D8D7, 0xC46BEF41, 0xCFA957FE, 0x0EE6BD51,
+   0xBF0E4FE1, 0x9FD414D5, 0xFBC62A8B, 0xCCB01FE1,
+   0x00000123, 0x0F4B612F, 0x4B0E4F70, 0xB0325F37,
+   0x00F585F2, 0x949C7280, 0x459596A7, 0x7814B24E,
+   0x23CA5A41, 0x06F7A62C, 0x7B1CF9B5, 0x1E554A00,
+   0xDDE0C67D, 0xDB2E0EAD, 0x4754E3EF, 0x011E73BC,
+   0x89AAB96C, 0x0000004C,
+   0xD9E35701, 0x9C5FB9B7, 0x3568E84F, 0x957DBBE4,
+   0xD61E07D4, 0x0D0FFAEA, 0xA696866A, 0x212FA45E,
+   0x41BE8D09, 0x6164F6EB, 0x17F98FBB, 0xC7399003,
+   0xE5CDA651, 0x832377EA, 0x4F233F7B, 0x08E82122,
+   0x0000013A, 0x23DA8433, 0x2B50F00F, 0x9EEE9ABC,
+   0x4E6FA278, 0x4F692C3D, 0xA291E2A8, 0xC8DFC745,
+   0x4CF55255, 0xBAFC291F, 0x2A16F670, 0x6B7E3721,
+   0xDEF081FE, 0x154A678E, 0x28E10E5C, 0x440BD4AB,
+   0x89BFC442, 0x00000024,
+   0x02DF43D8, 0xD0CCCB6F, 0x912DEC6D, 0xF7BDD45A,
+   0x5D20DB42, 0x88E703DF, 0x5A544F82, 0x8F724BCB,
+   0x5E6B60F8, 0x92D6B55C, 0xD42D0C1A, 0x077C460B,
+   0x8B7F9DF9, 0x3C38D902, 0x12E92942, 0x81B79053,
+   0x0000008B, 0xB8AFD25F, 0x7B57D763, 0xCA2315AA,
+   0x39865D45, 0xD3664CA8, 0x8CCD18BE, 0x85EC3085,
+   0x530B5E03, 0x3C31FF8C, 0x5B714BE0, 0x5434294B,
+   0x8CC0BA28, 0x8735E81A, 0xB97649E7, 0x8DAB1E80,
+   0x474DE1AE, 0x0000006E,
+   //Window 128
+   0x56B092A2, 0x22B8ECCB, 0x736EA9AA, 0x0A47D70E,
+   0xD64A7D08, 0x3EEFC772, 0xBB2E0F14, 0x85408CEC,
+   0x285CB70E, 0x73047AFD, 0x63297A2A, 0x1732F016,
+   0x4CF37EAC, 0x4DFE656A, 0xC0EC357B, 0x147D6D66,
+   0x000000C7, 0x3C115125, 0x1F3E5910, 0xBFB07241,
+   0x0D2D18FC, 0xBA4B009D, 0x5D6AA860, 0x806FF8ED,
+   0x8D0D9368, 0x1A05C049, 0xCC5CA370, 0xE9AB4C41,
+   0x7BF21CAE, 0x001D5CCA, 0x6632C3E0, 0xB60E5593,
+   0x3A4F99B6, 0x00000008,
+   0x4CB99695, 0x3C32F4E3, 0xC1241E0C, 0x0DB56646,
+   0x28515D66, 0xA4CEA13B, 0x5F3AB5DC, 0x1C8F6397,
+   0x4DEFD3EB, 0xD466A1B3, 0xE6D860D2, 0xCDBB66B5,
+   0xFE87183E, 0x26FC2FD5, 0xD18233A9, 0x02D81A03,
+   0x000000D2, 0xCAA08959, 0xDC570644, 0xCF763C20,
+   0x7791CC35, 0x272A1068, 0x3C0DC132, 0xC8A74578,
+   0xD7AD702C, 0xADA1D72C, 0x7689C46E, 0x2B8B4369,
+   0xBFC2E06F, 0xC0BBD6C4, 0xDE85E36E, 0xF9849084,
+   0xD879E086, 0x00000077,
+   0xDC3577EC, 0x51DF490D, 0x7E28BE3E, 0x6D8A70E9,
+   0x1DE95E73, 0xD87A7ED3, 0xA6C7086E, 0xF97C968D,
+   0x6B4AFE00, 0xC47B64DC, 0x8B432676, 0x489F1D98,
+   0xF72C2153, 0x9F2B7996, 0xF820AF70, 0x4ACD5AE8,
+   0x000001A9, 0xD7263FCF, 0xA5CC854B, 0x864FEBF7,
+   0x7BD94B2F, 0x9460C5D4, 0xB3DEF0FF, 0x042D47B5,
+   0x5F0766B5, 0x8AE51B32, 0x9E8484F2, 0xF8C729E7,
+   0x26EC4EA6, 0x6C2AD315, 0xF279D733, 0xDAC3E8D0,
+   0xB2D22E6E, 0x000000F6,
+   0x5D73ED9A, 0x43C5BDF1, 0xE71C6E7F, 0xE3766738,
+   0x3947EA97, 0x625CB8C4, 0x82241BA7, 0xADF7CCC0,
+   0x07329130, 0x629F45B3, 0x8D0C281A, 0x9CFAC174,
+   0x7D14CA06, 0x92069E57, 0xDC9F83A5, 0xCA121495,
+   0x000000CF, 0x7DE97FCC, 0xF4E6DA37, 0x025D39DF,
+   0xD3A271B7, 0x389E12EA, 0xBF2EBFE8, 0x32F184F2,
+   0xF434F299, 0x366EF539, 0xFBC3CCB9, 0xCDEF4A8F,
+   0x4E159CDA, 0xB0F0BB8E, 0xC311BD82, 0x779669AD,
+   0x380B2EB1, 0x000000B8,
+   0x0D3825AE, 0x412EB9D0, 0x20B658EB, 0xED91E11C,
+   0xE6918918, 0x0DA403AE, 0xB084B920, 0x8EC67EA3,
+   0x1F3D3FF2, 0xA213AA3A, 0x9EFC3CAD, 0x21DFB551,
+   0x19845C68, 0x30EE2A8A, 0x1835550A, 0x07B47D28,
+   0x000000B6, 0x2657BEC2, 0xB3EF4619, 0x2CC2C528,
+   0x607D1012, 0xC07DB93E, 0xA86D31ED, 0x80C25CF2,
+   0xC07B3DA9, 0x5C83C1F7, 0x5C56CD07, 0xA0D7EA59,
+   0xF32A98B3, 0x0CEF77C1, 0x5F1E6FE1, 0xC5B5A9B7,
+   0xFAD8A85E, 0x000001D5,
+   0x0128270F, 0x22002489, 0x574584F3, 0x60DF1294,
+   0x339AFAA1, 0x80DA07D1, 0x4873BBE5, 0x49CB3FB5,
+   0x9E32907E, 0x5E274CE9, 0x9C2BD23B, 0x2AB695C6,
+   0x084084B6, 0x63A53145, 0xB7C43B59, 0x881EA559,
+   0x000000FA, 0xEC7F7938, 0x3D9DE6FF, 0xC53223BD,
+   0x1B40E323, 0x5D3FCE2B, 0x2B6F3378, 0x94BF2FF0,
+   0x5A16083F, 0xC30458B5, 0x4DA0AE8F, 0xF0D0B1C2,
+   0x743DFC12, 0x1863D312, 0xFFE8B859, 0x114DA460,
+   0x1FCBA995, 0x00000065,
+   0x43684AD6, 0x394547B6, 0xA4EFC0B7, 0x27C93A87,
+   0x3832C7EC, 0x97914B63, 0x995801B4, 0x89291EDD,
+   0x9ED8DFB4, 0x1B7E633B, 0x0CF5637C, 0xA2A21E65,
+   0x8428BE9A, 0x4AFEBEF0, 0x42269B08, 0x527FC65F,
+   0x0000011B, 0x278302BA, 0x30099375, 0x6B1ADE38,
+   0x0B15CC9A, 0xA4BB5288, 0x6B6AD14E, 0x6425657E,
+   0xC0DBBE3F, 0x7BC91657, 0xA611247F, 0x6BA54B82,
+   0x0FF0AA02, 0x1A44FA38, 0xA695A694, 0x2E491F15,
+   0x7FF5F88E, 0x0000005F,
+   0x8E4C1BB9, 0xCA2A6932, 0x89A810AD, 0x5406D95B,
+   0x07059605, 0x181690A0, 0xDB36C201, 0xF6B80571,
+   0xC0DA0FB1, 0xCDB7CEEF, 0x382DD238, 0x0E0F2C08,
+   0x943FD3D9, 0x530C9A2E, 0xA5F3E1F4, 0xC14D7C55,
+   0x0000005F, 0xCCF6EBC7, 0x38C5AFDF, 0xF0D0C1B8,
+   0x9F2E2D25, 0x3AF9BF69, 0xCB96D587, 0x89391DAA,
+   0x150F940C, 0x5901C338, 0x5D80C976, 0x7134A0B6,
+   0xCA2C7C5F, 0x9A37B224, 0x615ABD19, 0xE2B8790A,
+   0x03504959, 0x00000067,
+   //Window 129
+   0xDD04AFCE, 0x1D45C5C8, 0xBBD9C392, 0xCE141A50,
+   0xC9E0FC05, 0x44CA5FA5, 0x60CCFB3C, 0x4B9496FF,
+   0xDB5552A6, 0xBE260BC6, 0x7D3A7A09, 0xA0EABFDD,
+   0x1C77C1F9, 0xE9CC06AE, 0x2AABEE9E, 0xFA792D04,
+   0x000001DB, 0x72765171, 0xF2224E6F, 0x11B89E04,
+   0x3F9EA548, 0x138F1A43, 0x1E07C6EB, 0x621F1F7E,
+   0xD9B61817, 0x2F69AF1A, 0x08E851AA, 0xC0D63F32,
+   0x3E75DA6F, 0xF0F0D74D, 0x49A72D31, 0xC516A10C,
+   0xFCCFC561, 0x0000009F,
+   0x237051F4, 0x6DC021EF, 0x7316F0B0, 0x5A76D8D3,
+   0x9F26CF74, 0x48521AA0, 0xC106BD9D, 0xBA0C42B0,
+   0x58C48BE7, 0x17BCCC45, 0x2A7CE241, 0x434AA5B0,
+   0x239AEFA5, 0xBEF8A59B, 0xFC6FD78F, 0xCD8E682C,
+   0x000001F0, 0xEC41E617, 0x54DA0BFB, 0x9384DBD3,
+   0x1D0EBCF1, 0x3FDE74FA, 0x59EAFAB0, 0x5E7E3E8B,
+   0xED3A369E, 0x2DA9F712, 0xC3F1456A, 0x1C55F4E2,
+   0x62E6394A, 0xD3D53150, 0xC54CF34A, 0x13B480D3,
+   0x3849A2B2, 0x000001F9,
+   0x3C9D1905, 0x24707838, 0x3A2217ED, 0x5548F703,
+   0x501C6819, 0xC62BD196, 0xEB4FC9ED, 0xCB2C0893,
+   0x67C77ED0, 0x1A54E6DB, 0x04675183, 0xA985B167,
+   0xD572B956, 0x15EDCE42, 0x744F68CE, 0xF506A80A,
+   0x00000191, 0xF0E799EF, 0x8DD93D2B, 0x5C4B3712,
+   0x5919D9A9, 0x0604D46A, 0xCEE768C7, 0x9E299096,
+   0x4FDB86AE, 0xF3C22CE6, 0x5B300487, 0x45D1A7F8,
+   0x6C1738B1, 0xCF13684C, 0x890F8E55, 0xC87097D5,
+   0x634577CB, 0x00000073,
+   0x4D4F6808, 0x5606F4CA, 0xA466BD01, 0x98877BEE,
+   0x351ECBE2, 0x313D57A2, 0xF5249F37, 0xED501E47,
+   0xDB5B0E12, 0x8802E3E2, 0x55588A9C, 0xC6B81A77,
+   0xE68E0972, 0x3950C7E1, 0xBECA361C, 0x9EBB46A2,
+   0x00000182, 0x149CBE81, 0x9EAFD084, 0x908FC649,
+   0x3130D39D, 0x1B65FC3E, 0xF11BDD64, 0xE249304F,
+   0x782F4890, 0x9CC68884, 0x052AD050, 0x737F47FC,
+   0x4D830021, 0xC4DDC5A8, 0x97E5B00E, 0x5EAD892D,
+   0x01D91F25, 0x000001F3,
+   0x438E192D, 0xEE492EDA, 0xB6FB25B4, 0x7C90CE48,
+   0x92A6F98B, 0x1D913475, 0x3E303957, 0xE937729F,
+   0x68753BE7, 0x934AD41E, 0x388DBFEB, 0xC1055AD0,
+   0x37C39B47, 0x1EB07D12, 0x044D46E1, 0x43D67B30,
+   0x000000BE, 0xC100BBAB, 0x99BD8D9F, 0x0AB5FF5C,
+   0x83D18CFE, 0x3C83E1B5, 0x4A4F2B01, 0x037B574E,
+   0x794B7080, 0x7EF46528, 0x5E0BEE69, 0xD231CDE9,
+   0x6D1FAE53, 0x2BDCC506, 0xCCC2E6DC, 0x386C5721,
+   0x6EB73FAB, 0x000000EF,
+   0x0BF28A44, 0x591991BF, 0x791D957D, 0xA06E49DF,
+   0xF3C2D9BB, 0xA609D69B, 0xA9F2F046, 0x4F535568,
+   0x7069B621, 0x811884E4, 0xA7D706F6, 0x18D0AE6E,
+   0x94D498BA, 0x9385FB82, 0xDAD6DE10, 0x70687823,
+   0x0000018C, 0xD67FFD7A, 0x9357EFC6, 0xE117DC84,
+   0xBA47F73E, 0xB4F9C177, 0xAC62159E, 0x6DCEC707,
+   0x8E0A354E, 0xE86185BC, 0xC0DC49BF, 0xB4E357E3,
+   0x8C0952A3, 0x5A140719, 0x73DA679D, 0x4495318D,
+   0xF34D7B16, 0x0000004D,
+   0xA0C123CD, 0x018D01F0, 0xDD9AE750, 0x7142A556,
+   0xBA161BEA, 0x1C29E867, 0x2B0F1D22, 0x18882BA3,
+   0x03656D3E, 0x26FA6AEC, 0x34BB906D, 0x747B08EA,
+   0x5EA1E019, 0x8B6DE4AD, 0x70538E44, 0x9200DA5A,
+   0x000000BF, 0x0D81C672, 0x7621EE5F, 0x481B5EDF,
+   0x4B3DE5FF, 0x3A21F067, 0x4B0D2E19, 0x8B630F4B,
+   0x1AB1F075, 0xE0AF48F1, 0x853D0FF9, 0x75183AFE,
+   0x1C51EF6F, 0x55DAF850, 0x5C5852FB, 0x93C96D64,
+   0x1667E2EA, 0x0000013B,
+   0x0448854C, 0x14FD09FE, 0x99AF6FC3, 0xD722E829,
+   0x954C2490, 0x3E4323B5, 0x9E69AC28, 0x5A59234A,
+   0x73518F69, 0x1B3B9C1D, 0x3A9E7A10, 0x4F1DD2AE,
+   0xB5D10580, 0x3D462EA2, 0x6D5A6C1B, 0x27E0453C,
+   0x000001CC, 0xA7E19E26, 0xD179D903, 0xF00C2DE3,
+   0x71D352D9, 0x682A4A93, 0x57786465, 0x50F6966D,
+   0xE4CAA06F, 0x4B93F32F, 0xC5EB495E, 0x0E032094,
+   0x00033C70, 0xED7A4677, 0x016C4CC3, 0xA0F4EA63,
+   0x298138F4, 0x0000010B,
+   //Window 130
+   0xCE8F9A17, 0x61829972, 0xE0FDA47E, 0x2D21913C,
+   0x52466C05, 0x84CB9DA2, 0x9FD85710, 0xFCC4EAAB,
+   0x2F56FB90, 0xAB1EC541, 0x6A231D4A, 0xBB435BEC,
+   0xE16D3C47, 0xE1FFFEAE, 0x0F023A36, 0xA7DB0284,
+   0x0000002D, 0x38D77A9E, 0x7259E719, 0xA3661199,
+   0xCD2278B1, 0xBF6DFC59, 0xCF7FDF77, 0x96A2B632,
+   0x6265F9CB, 0x4EB09C8A, 0x1365E44A, 0x2B23BF87,
+   0xC1AC3054, 0x5AAEC208, 0x3161A2C0, 0x55DB8AE9,
+   0x1AF3A614, 0x00000098,
+   0xB3F18230, 0x93012BBD, 0xBE563374, 0x69B59C81,
+   0x8FBD8070, 0x0FCCC941, 0xDD353C6D, 0xB2E3E5FD,
+   0x65DCE413, 0x290F2D40, 0x6598620E, 0xB79D8741,
+   0x0CFA916C, 0x855ECA8C, 0x97EFEBB1, 0x45029EA1,
+   0x00000051, 0x90438BAE, 0x7C09EEF3, 0x9EC6217D,
+   0x898440C5, 0x30D90670, 0x89F13313, 0x26AE644C,
+   0x15887287, 0xE83D85F0, 0x353E5BFA, 0x456B1253,
+   0xE8F21860, 0xCC75E379, 0xEB0FEDEA, 0x19348CEC,
+   0x215AC252, 0x00000057,
+   0x1BDD31FC, 0x895A3623, 0xA499D99F, 0x3FF4B814,
+   0xAE8418DA, 0x3B0B3BC1, 0x5EAAA723, 0x3F6E8A89,
+   0x03ADBDF0, 0xF4F87E13, 0x01852F42, 0x989FCECD,
+   0xA4426BC1, 0x6DCAF5ED, 0xA43A2BBC, 0x36F55EFE,
+   0x000000FF, 0x18832A17, 0xC7180D58, 0x29C58F84,
+   0x47D76D93, 0x6EB5288A, 0xE54ECA93, 0x621C57B6,
+   0x4E7A0AE6, 0xCDAD70AF, 0x475C9919, 0x13D73C3C,
+   0x5E0D5C86, 0x15DB8108, 0xEE24C9F3, 0x286DDBDB,
+   0x80FF5E2C, 0x0000002B,
+   0x9A44620F, 0x97169646, 0xFCFA2EA4, 0x3523058D,
+   0x167C4C8D, 0x8C3E30D1, 0xE93A3A6A, 0xF3DE3D61,
+   0x642614F1, 0x56E42C97, 0x80CC3DCE, 0x3C9C8D24,
+   0x8CE9A9D8, 0x68D62A52, 0xDF7BE32A, 0x482041D2,
+   0x00000127, 0x67C7FD4B, 0xEB4439EA, 0x0A384DB6,
+   0x35011732, 0x2046F5D4, 0x19F9A338, 0x72CACC46,
+   0x5DBF9FCC, 0x9BB26921, 0x732CAA31, 0xCA05B118,
+   0xCD7C2088, 0xDBC0CA1B, 0x6C815494, 0x825890F6,
+   0x5334AFAB, 0x00000053,
+   0x6DD01BEF, 0x7EA34B83, 0xEFFAB7A5, 0xC36E2120,
+   0xB8845894, 0x1357672F, 0x0162AA61, 0x7F462C58,
+   0x5BAE0512, 0xB0095881, 0xF30BE373, 0x55E27B8E,
+   0xA1A367BF, 0x3B0B6882, 0x1F66D95F, 0x9177F735,
+   0x000001C0, 0xBFBE7524, 0xEEF0EBA1, 0x8025AA0D,
+   0x0CF73ED6, 0x4D9267FC, 0xAE531A88, 0xA78A045D,
+   0x29042EA6, 0xDB2582CF, 0xECEBF42A, 0x566D1BE1,
+   0x041BABDC, 0xCFE83774, 0x55C1D466, 0x40E305AB,
+   0x751C932B, 0x00000162,
+   0xD317C60C, 0x08A92760, 0x9529B4B8, 0x730D7383,
+   0x1A050F05, 0xFCF81C9D, 0x9F9E8BF5, 0x6B2CB805,
+   0x30FF7124, 0xD7D7C79E, 0x7206C662, 0x572A3A7F,
+   0x4915D988, 0xE2052B8C, 0x3D6CF04C, 0xA685A31E,
+   0x00000183, 0x3E71C584, 0x14408F42, 0x15998073,
+   0x8F24D134, 0x95F62F3C, 0x1EC3AD19, 0x03F06C8D,
+   0xF2D8EA18, 0x087730A5, 0x8DDC0FD6, 0x280B7D59,
+   0x7755ED4B, 0xBA67938C, 0x26C885DB, 0x27E81374,
+   0x25597536, 0x0000013C,
+   0x8E080AA6, 0x525C7034, 0x703A31D0, 0xFB65650B,
+   0x9708778B, 0xB3C9FC90, 0x5C0DE950, 0x712BABDD,
+   0xCF922A9C, 0x2336B614, 0x2D1541CC, 0xC9C01FDB,
+   0xDA984124, 0x3B0B5ACD, 0x5CA5237E, 0xC16EDB3E,
+   0x00000031, 0xBA96A3B1, 0x16D195DC, 0x5B2D839E,
+   0xAEB79513, 0x3F468379, 0xFF7CA75C, 0x2F7A4ECC,
+   0x195EBF45, 0x2CBA9FC8, 0x368BF1AC, 0xAD79DA65,
+   0x282778C5, 0x82204582, 0x1AE709A3, 0x80E162FC,
+   0x60DA3061, 0x000000A7,
+   0x4810CE1D, 0x28B80158, 0x9CD2A530, 0xA18F01CF,
+   0xBBACC56B, 0x3F882662, 0xC8DE9031, 0x25A09082,
+   0xC75A3487, 0xEE333F92, 0x8C93DC3C, 0xC3F231D7,
+   0xD94C4907, 0x6D53379A, 0x11F2D227, 0x11763682,
+   0x000001AC, 0xAB84DE42, 0x137AE216, 0xE4EE4C73,
+   0xBC00A7C1, 0xFC12B03C, 0x8A42AEB8, 0xCF6A0950,
+   0x9A717FF1, 0x0158B96C, 0x18CBEBE3, 0x50953719,
+   0x01846465, 0x194FDB1E, 0x2C73BD13, 0x3B0D2C34,
+   0xBD52A1CF, 0x00000022
+};
+
+#endif
+#endif
@@ -0,0 +1,748 @@
+/**
+ * @file secp256k1.c
+ * @brief secp256k1 scalar multiplication (GLV method)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * secp256k1 has an efficiently computable endomorphism (x, y) -> (beta.x, y)
+ * that maps any point P to lambda.P, where beta and lambda are cube roots
+ * of unity modulo p and q. A scalar k is split into two half-size scalars
+ * such that k = k1 + k2.lambda mod q, and k.P = k1.P + k2.(lambda.P) is
+ * computed with an interleaved multiplication, so that the number of point
+ * doublings is halved. Refer to the following paper for more details:
+ * - Faster point multiplication on elliptic curves with efficient
+ *   endomorphisms (Gallant, Lambert and Vanstone, 2001)
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec.h"
+#include "ecc/secp256k1.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (EC_SUPPORT == ENABLED && SECP256K1_SUPPORT == ENABLED && \
+   SECP256K1_GLV_SUPPORT == ENABLED)
+
+//Cube root of unity modulo p. The endomorphism (x, y) -> (beta.x, y)
+//multiplies any point by lambda = 0xAC9C52B3...B51283CE
+static const uint8_t SECP256K1_BETA[32] =
+{
+   0x85, 0x16, 0x95, 0xD4, 0x9A, 0x83, 0xF8, 0xEF, 0x91, 0x9B, 0xB8, 0x61, 0x53, 0xCB, 0xCB, 0x16,
+   0x63, 0x0F, 0xB6, 0x8A, 0xED, 0x0A, 0x76, 0x6A, 0x3E, 0xC6, 0x93, 0xD6, 0x8E, 0x6A, 0xFA, 0x40
+};
+
+//The vectors (A1, -A2) and (A2, B2) form a reduced basis of the lattice
+//of the pairs (a, b) such that a + b.lambda = 0 mod q
+static const uint8_t SECP256K1_A1[16] =
+{
+   0xE4, 0x43, 0x7E, 0xD6, 0x01, 0x0E, 0x88, 0x28, 0x6F, 0x54, 0x7F, 0xA9, 0x0A, 0xBF, 0xE4, 0xC3
+};
+
+static const uint8_t SECP256K1_A2[16] =
+{
+   0x30, 0x86, 0xD2, 0x21, 0xA7, 0xD4, 0x6B, 0xCD, 0xE8, 0x6C, 0x90, 0xE4, 0x92, 0x84, 0xEB, 0x15
+};
+
+static const uint8_t SECP256K1_B2[17] =
+{
+   0x01, 0x14, 0xCA, 0x50, 0xF7, 0xA8, 0xE2, 0xF3, 0xF6, 0x57, 0xC1, 0x10, 0x8D, 0x9D, 0x44, 0xCF,
+   0xD8
+};
+
+//G1 = round(2^384 * B2 / q)
+static const uint8_t SECP256K1_G1[33] =
+{
+   0x01, 0x14, 0xCA, 0x50, 0xF7, 0xA8, 0xE2, 0xF3, 0xF6, 0x57, 0xC1, 0x10, 0x8D, 0x9D, 0x44, 0xCF,
+   0xD9, 0x5F, 0xBC, 0x92, 0xC1, 0x0F, 0xDD, 0xD1, 0x45, 0xFE, 0x04, 0xD5, 0x48, 0xD0, 0xA0, 0x2F,
+   0xA2
+};
+
+//G2 = round(2^384 * A2 / q)
+static const uint8_t SECP256K1_G2[32] =
+{
+   0x30, 0x86, 0xD2, 0x21, 0xA7, 0xD4, 0x6B, 0xCD, 0xE8, 0x6C, 0x90, 0xE4, 0x92, 0x84, 0xEB, 0x15,
+   0x3D, 0xAA, 0x8A, 0x14, 0x71, 0xE8, 0xCA, 0x7F, 0xE8, 0x93, 0x20, 0x9A, 0x45, 0xDB, 0xB0, 0x31
+};
+
+
+/**
+ * @brief Check whether the domain parameters match secp256k1
+ * @param[in] params EC domain parameters
+ * @return TRUE if the domain parameters match secp256k1, else FALSE
+ **/
+
+bool_t secp256k1IsCurve(const EcDomainParameters *params)
+{
+   bool_t res;
+
+   //Check curve name
+   if(params->name != NULL && !osStrcmp(params->name, "secp256k1"))
+   {
+      res = TRUE;
+   }
+   else
+   {
+      res = FALSE;
+   }
+
+   //Return TRUE if the domain parameters match secp256k1
+   return res;
+}
+
+
+/**
+ * @brief Rounded product R = round(A * B / 2^384)
+ * @param[out] r Resulting integer R
+ * @param[in] a First operand A
+ * @param[in] b Second operand B, in big-endian format
+ * @param[in] length Length of the second operand, in bytes
+ * @return Error code
+ **/
+
+static error_t secp256k1MulShift(Mpi *r, const Mpi *a, const uint8_t *b,
+   size_t length)
+{
+   error_t error;
+   uint_t c;
+   Mpi t;
+
+   //Initialize multiple precision integer
+   mpiInit(&t);
+
+   //Compute A * B
+   MPI_CHECK(mpiImport(&t, b, length, MPI_FORMAT_BIG_ENDIAN));
+   MPI_CHECK(mpiMul(r, a, &t));
+
+   //Round the result to the nearest integer
+   c = mpiGetBitValue(r, 383);
+   MPI_CHECK(mpiShiftRight(r, 384));
+   MPI_CHECK(mpiAddInt(r, r, c));
+
+end:
+   //Release multiple precision integer
+   mpiFree(&t);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Split a scalar into two half-size scalars
+ *
+ * The closest lattice vector to (k, 0) is subtracted from (k, 0), so that
+ * |k1| and |k2| are less than 2^129
+ *
+ * @param[out] k1 First half-size scalar (signed)
+ * @param[out] k2 Second half-size scalar (signed)
+ * @param[in] k Scalar such as 0 <= k < q and k = k1 + k2.lambda mod q
+ * @return Error code
+ **/
+
+error_t secp256k1SplitScalar(Mpi *k1, Mpi *k2, const Mpi *k)
+{
+   error_t error;
+   Mpi a;
+   Mpi b;
+   Mpi c1;
+   Mpi c2;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
+
+   //Initialize multiple precision integers
+   mpiInit(&a);
+   mpiInit(&b);
+   mpiInit(&c1);
+   mpiInit(&c2);
+
+   //Compute c1 = round(k * B2 / q) and c2 = round(k * A2 / q)
+   MPI_CHECK(secp256k1MulShift(&c1, k, SECP256K1_G1, sizeof(SECP256K1_G1)));
+   MPI_CHECK(secp256k1MulShift(&c2, k, SECP256K1_G2, sizeof(SECP256K1_G2)));
+
+   //Compute k1 = k - c1 * A1 - c2 * A2
+   MPI_CHECK(mpiImport(&a, SECP256K1_A1, sizeof(SECP256K1_A1),
+      MPI_FORMAT_BIG_ENDIAN));
+   MPI_CHECK(mpiMul(&b, &c1, &a));
+   MPI_CHECK(mpiSub(k1, k, &b));
+   MPI_CHECK(mpiImport(&a, SECP256K1_A2, sizeof(SECP256K1_A2),
+      MPI_FORMAT_BIG_ENDIAN));
+   MPI_CHECK(mpiMul(&b, &c2, &a));
+   MPI_CHECK(mpiSub(k1, k1, &b));
+
+   //Compute k2 = c1 * A2 - c2 * B2
+   MPI_CHECK(mpiMul(k2, &c1, &a));
+   MPI_CHECK(mpiImport(&a, SECP256K1_B2, sizeof(SECP256K1_B2),
+      MPI_FORMAT_BIG_ENDIAN));
+   MPI_CHECK(mpiMul(&b, &c2, &a));
+   MPI_CHECK(mpiSub(k2, k2, &b));
+
+end:
+   //Release multiple precision integers
+   mpiFree(&a);
+   mpiFree(&b);
+   mpiFree(&c1);
+   mpiFree(&c2);
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Negate an EC point if requested (constant time)
+ * @param[in] params EC domain parameters
+ * @param[in,out] r EC point whose coordinates are n words long
+ * @param[in] n Size of the coordinates, in words
+ * @param[in] c The point is negated if this value is 1, else left unchanged
+ * @param[in] t Temporary integer
+ * @return Error code
+ **/
+
+static error_t secp256k1CondNeg(const EcDomainParameters *params, EcPoint *r,
+   uint_t n, uint_t c, Mpi *t)
+{
+   error_t error;
+   uint_t i;
+
+   //Compute p - Ry
+   MPI_CHECK(mpiSub(t, &params->p, &r->y));
+   MPI_CHECK(mpiGrow(t, n));
+
+   //Select the negated coordinate if c is set
+   for(i = 0; i < n; i++)
+   {
+      r->y.data[i] = (r->y.data[i] & (c - 1)) | (t->data[i] & (0U - c));
+   }
+
+end:
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Scalar multiplication (regular calculation)
+ *
+ * The scalar is split into two half-size scalars and both of them are
+ * recoded with odd signed digits in a window of w bits. This gives a regular
+ * operation sequence (w doublings and two additions per window, whatever the
+ * scalar) and the table entries are selected by a full scan. The point
+ * operations and the underlying multiple precision arithmetic are not
+ * constant-time, hence this function does not claim to run in constant time
+ *
+ * @param[in] params EC domain parameters
+ * @param[out] r Resulting point R = d.S
+ * @param[in] d An integer d such as 0 <= d < p
+ * @param[in] s EC point
+ * @return Error code
+ **/
+
+error_t secp256k1Mult(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d, const EcPoint *s)
+{
+   error_t error;
+   int_t i;
+   uint_t j;
+   uint_t h;
+   uint_t l;
+   uint_t m;
+   uint_t n;
+   uint_t c;
+   uint_t index;
+   uint_t sign;
+   uint_t neg[2];
+   uint_t parity[2];
+   int_t digit;
+   Mpi k[2];
+   Mpi e;
+   EcPoint t;
+   EcPoint u;
+   EcPoint table[2][1 << (EC_MULT_WINDOW_SIZE - 1)];
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
+
+   //Number of points in each table
+   n = 1 << (EC_MULT_WINDOW_SIZE - 1);
+
+   //Initialize multiple precision integers
+   mpiInit(&k[0]);
+   mpiInit(&k[1]);
+   mpiInit(&e);
+
+   //Initialize EC points
+   ecInit(&t);
+   ecInit(&u);
+
+   for(j = 0; j < n; j++)
+   {
+      ecInit(&table[0][j]);
+      ecInit(&table[1][j]);
+   }
+
+   //Check whether d == 0 or Sz == 0
+   if(mpiCompInt(d, 0) == 0 || mpiCompInt(&s->z, 0) == 0)
+   {
+      //Set R = (1, 1, 0)
+      MPI_CHECK(mpiSetValue(&r->x, 1));
+      MPI_CHECK(mpiSetValue(&r->y, 1));
+      MPI_CHECK(mpiSetValue(&r->z, 0));
+   }
+   else
+   {
+      //Every point of the curve has order q, hence d can be reduced
+      if(mpiComp(d, &params->q) >= 0)
+      {
+         MPI_CHECK(mpiMod(&e, d, &params->q));
+      }
+      else
+      {
+         MPI_CHECK(mpiCopy(&e, d));
+      }
+
+      //Split the scalar so that d = k1 + k2.lambda mod q
+      MPI_CHECK(secp256k1SplitScalar(&k[0], &k[1], &e));
+
+      //Set T1[0] = S (S is normalized together with the other entries)
+      EC_CHECK(ecCopy(&table[0][0], s));
+
+      //Compute U = 2.S
+      EC_CHECK(ecDouble(params, &u, &table[0][0]));
+
+      //Precompute the odd multiples T1[j] = (2.j + 1).S
+      for(j = 1; j < n; j++)
+      {
+         EC_CHECK(ecFullAdd(params, &table[0][j], &table[0][j - 1], &u));
+      }
+
+      //Convert the table to affine representation
+      EC_CHECK(ecAffinifyBatch(params, table[0], table[0], n));
+
+      //Apply the endomorphism to get T2[j] = (2.j + 1).lambda.S
+      MPI_CHECK(mpiImport(&e, SECP256K1_BETA, sizeof(SECP256K1_BETA),
+         MPI_FORMAT_BIG_ENDIAN));
+
+      for(j = 0; j < n; j++)
+      {
+         EC_CHECK(ecMulMod(params, &table[1][j].x, &table[0][j].x, &e));
+         MPI_CHECK(mpiCopy(&table[1][j].y, &table[0][j].y));
+         MPI_CHECK(mpiCopy(&table[1][j].z, &table[0][j].z));
+      }
+
+      //Length of the coordinates, in words
+      l = mpiGetLength(&params->p);
+
+      //The tables are scanned word by word, hence all the coordinates must
+      //have the same size
+      for(j = 0; j < n; j++)
+      {
+         EC_CHECK(ecGrowPoint(&table[0][j], l));
+         EC_CHECK(ecGrowPoint(&table[1][j], l));
+      }
+
+      EC_CHECK(ecGrowPoint(&t, l));
+
+      //Prepare the half-size scalars
+      for(h = 0; h < 2; h++)
+      {
+         //A negative scalar is handled by negating the corresponding point
+         neg[h] = (uint_t) k[h].sign >> (sizeof(uint_t) * 8 - 1);
+         k[h].sign = 1;
+
+         //The recoding requires an odd scalar. When k is even, k + 1 is
+         //used instead and the point is subtracted at the end
+         parity[h] = mpiGetBitValue(&k[h], 0);
+         MPI_CHECK(mpiAddInt(&k[h], &k[h], 1 - parity[h]));
+      }
+
+      //The number of windows only depends on the bound on the half-size
+      //scalars
+      m = SECP256K1_GLV_SCALAR_BIT_LEN / EC_MULT_WINDOW_SIZE + 1;
+
+      //Loop through the windows, starting with the most significant one
+      for(i = m - 1; i >= 0; i--)
+      {
+         //Compute R = 2^w.R
+         if(i < (int_t) (m - 1))
+         {
+            for(j = 0; j < EC_MULT_WINDOW_SIZE; j++)
+            {
+               EC_CHECK(ecDouble(params, r, r));
+            }
+         }
+
+         //Loop through the half-size scalars
+         for(h = 0; h < 2; h++)
+         {
+            //Extract w + 1 bits, the least significant one being forced to 1
+            for(c = 1, j = 1; j <= EC_MULT_WINDOW_SIZE; j++)
+            {
+               c |= mpiGetBitValue(&k[h], i * EC_MULT_WINDOW_SIZE + j) << j;
+            }
+
+            //The most significant digit is always positive
+            if(i < (int_t) (m - 1))
+            {
+               digit = (int_t) c - (1 << EC_MULT_WINDOW_SIZE);
+            }
+            else
+            {
+               digit = (int_t) c;
+            }
+
+            //The digit is odd and its absolute value is (2.index + 1)
+            sign = (uint_t) digit >> (sizeof(uint_t) * 8 - 1);
+            index = (((uint_t) digit ^ (0U - sign)) + sign) >> 1;
+
+            //Scan the whole table so that the memory access pattern does not
+            //depend on the value of the digit
+            for(j = 0; j < n; j++)
+            {
+               //Build a mask that selects the current entry if j == index
+               c = j ^ index;
+               c = ((c | (0U - c)) >> (sizeof(uint_t) * 8 - 1)) - 1;
+
+               //Conditional copy
+               ecCondCopy(&t, &table[h][j], l, c);
+            }
+
+            //Negate the selected point if either the digit or the scalar is
+            //negative
+            EC_CHECK(secp256k1CondNeg(params, &t, l, sign ^ neg[h], &e));
+
+            //Most significant window?
+            if(i == (int_t) (m - 1) && h == 0)
+            {
+               //Set R = T
+               EC_CHECK(ecCopy(r, &t));
+            }
+            else
+            {
+               //Compute R = R + T
+               EC_CHECK(ecFullAdd(params, r, r, &t));
+            }
+         }
+      }
+
+      //Undo the adjustment of the even scalars
+      for(h = 0; h < 2; h++)
+      {
+         //Retrieve the point that corresponds to the half-size scalar
+         EC_CHECK(ecCopy(&t, &table[h][0]));
+         EC_CHECK(ecGrowPoint(&t, l));
+         EC_CHECK(secp256k1CondNeg(params, &t, l, neg[h], &e));
+
+         //Compute U = R - T
+         EC_CHECK(ecFullSub(params, &u, r, &t));
+
+         //If the scalar is even, then R = U
+         EC_CHECK(ecGrowPoint(r, l));
+         EC_CHECK(ecGrowPoint(&u, l));
+         ecCondCopy(r, &u, l, parity[h] - 1);
+      }
+   }
+
+end:
+   //Erase the half-size scalars
+   mpiFree(&k[0]);
+   mpiFree(&k[1]);
+   //Release multiple precision integer
+   mpiFree(&e);
+
+   //Release EC points
+   ecFree(&t);
+   ecFree(&u);
+
+   for(j = 0; j < n; j++)
+   {
+      ecFree(&table[0][j]);
+      ecFree(&table[1][j]);
+   }
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Twin multiplication
+ *
+ * Both scalars are split into two half-size scalars, which are recoded in
+ * width-(w + 1) non-adjacent form. The four multiplications are interleaved
+ * so that they share the same doublings. The scalars are assumed to be
+ * public, hence the computation does not run in constant time. The
+ * resulting point is not normalized
+ *
+ * @param[in] params EC domain parameters
+ * @param[out] r Resulting point R = d0.S + d1.T (Jacobian coordinates)
+ * @param[in] d0 An integer d such as 0 <= d0 < p
+ * @param[in] s EC point
+ * @param[in] d1 An integer d such as 0 <= d1 < p
+ * @param[in] t EC point
+ * @return Error code
+ **/
+
+error_t secp256k1TwinMult(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d0, const EcPoint *s, const Mpi *d1, const EcPoint *t)
+{
+   error_t error;
+   uint_t i;
+   uint_t j;
+   uint_t n;
+   uint_t index;
+   int_t digit;
+   bool_t neg[4];
+   int8_t naf[4][SECP256K1_GLV_SCALAR_BYTE_LEN * 8 + 1];
+   uint8_t buffer[SECP256K1_GLV_SCALAR_BYTE_LEN];
+   Mpi k[4];
+   Mpi e;
+   EcPoint u;
+   EcPoint table[4][1 << (EC_MULT_WINDOW_SIZE - 1)];
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
+
+   //Number of points in each table
+   n = 1 << (EC_MULT_WINDOW_SIZE - 1);
+
+   //Initialize multiple precision integers
+   for(j = 0; j < 4; j++)
+   {
+      mpiInit(&k[j]);
+   }
+
+   mpiInit(&e);
+
+   //Initialize EC points
+   ecInit(&u);
+
+   for(j = 0; j < 4; j++)
+   {
+      for(i = 0; i < n; i++)
+      {
+         ecInit(&table[j][i]);
+      }
+   }
+
+   //Split the scalars so that d0 = k0 + k2.lambda mod q and
+   //d1 = k1 + k3.lambda mod q
+   for(j = 0; j < 2; j++)
+   {
+      //Every point of the curve has order q, hence d can be reduced
+      MPI_CHECK(mpiMod(&e, (j == 0) ? d0 : d1, &params->q));
+      MPI_CHECK(secp256k1SplitScalar(&k[j], &k[j + 2], &e));
+   }
+
+   //Recode the half-size scalars
+   for(j = 0; j < 4; j++)
+   {
+      //A negative scalar is handled by negating the corresponding point
+      neg[j] = (k[j].sign < 0) ? TRUE : FALSE;
+      k[j].sign = 1;
+
+      //Recode the scalar in width-(w + 1) non-adjacent form
+      MPI_CHECK(mpiExport(&k[j], buffer, SECP256K1_GLV_SCALAR_BYTE_LEN,
+         MPI_FORMAT_BIG_ENDIAN));
+
+      ecComputeWnaf(naf[j], buffer, SECP256K1_GLV_SCALAR_BYTE_LEN,
+         EC_MULT_WINDOW_SIZE + 1);
+   }
+
+   //Set T0[0] = S and T1[0] = T
+   EC_CHECK(ecCopy(&table[0][0], s));
+   EC_CHECK(ecCopy(&table[1][0], t));
+
+   //Precompute the odd multiples of S and T
+   for(j = 0; j < 2; j++)
+   {
+      //Compute U = 2.T[0]
+      EC_CHECK(ecDouble(params, &u, &table[j][0]));
+
+      //Compute T[i] = (2.i + 1).T[0]
+      for(i = 1; i < n; i++)
+      {
+         EC_CHECK(ecFullAdd(params, &table[j][i], &table[j][i - 1], &u));
+      }
+   }
+
+   //Convert both tables to affine representation at once
+   EC_CHECK(ecAffinifyBatch(params, table[0], table[0], 2 * n));
+
+   //Apply the endomorphism to get the odd multiples of lambda.S and
+   //lambda.T
+   MPI_CHECK(mpiImport(&e, SECP256K1_BETA, sizeof(SECP256K1_BETA),
+      MPI_FORMAT_BIG_ENDIAN));
+
+   for(j = 0; j < 2; j++)
+   {
+      for(i = 0; i < n; i++)
+      {
+         EC_CHECK(ecMulMod(params, &table[j + 2][i].x, &table[j][i].x, &e));
+         MPI_CHECK(mpiCopy(&table[j + 2][i].y, &table[j][i].y));
+         MPI_CHECK(mpiCopy(&table[j + 2][i].z, &table[j][i].z));
+      }
+   }
+
+   //Set R = (1, 1, 0)
+   MPI_CHECK(mpiSetValue(&r->x, 1));
+   MPI_CHECK(mpiSetValue(&r->y, 1));
+   MPI_CHECK(mpiSetValue(&r->z, 0));
+
+   //Process the digits from the most significant one
+   for(i = SECP256K1_GLV_SCALAR_BYTE_LEN * 8 + 1; i > 0; i--)
+   {
+      //Point doubling (not needed as long as R is the point at infinity)
+      if(mpiCompInt(&r->z, 0) != 0)
+      {
+         EC_CHECK(ecDouble(params, r, r));
+      }
+
+      //Loop through the half-size scalars
+      for(j = 0; j < 4; j++)
+      {
+         //Retrieve the current digit
+         digit = naf[j][i - 1];
+
+         //Zero digits do not require any point addition
+         if(digit != 0)
+         {
+            //The digit is odd and its absolute value is (2.index + 1)
+            index = (digit < 0) ? (uint_t) (-digit) >> 1 : (uint_t) digit >> 1;
+
+            //Compute R = R + digit.T, taking into account the sign of the
+            //half-size scalar
+            if((digit > 0) != neg[j])
+            {
+               EC_CHECK(ecFullAdd(params, r, r, &table[j][index]));
+            }
+            else
+            {
+               EC_CHECK(ecFullSub(params, r, r, &table[j][index]));
+            }
+         }
+      }
+   }
+
+end:
+   //Release multiple precision integers
+   for(j = 0; j < 4; j++)
+   {
+      mpiFree(&k[j]);
+   }
+
+   mpiFree(&e);
+
+   //Release EC points
+   ecFree(&u);
+
+   for(j = 0; j < 4; j++)
+   {
+      for(i = 0; i < n; i++)
+      {
+         ecFree(&table[j][i]);
+      }
+   }
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Twin multiplication with the base point
+ * @param[in] params EC domain parameters
+ * @param[out] r Resulting point R = d0.G + d1.Q (Jacobian coordinates)
+ * @param[in] d0 An integer d0 such as 0 <= d0 < q
+ * @param[in] d1 An integer d1 such as 0 <= d1 < q
+ * @param[in] q EC point Q (affine coordinates)
+ * @return Error code
+ **/
+
+error_t secp256k1TwinMultBase(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d0, const Mpi *d1, const EcPoint *q)
+{
+   error_t error;
+   EcPoint g;
+   EcPoint t;
+
+   //Initialize EC points
+   ecInit(&g);
+   ecInit(&t);
+
+   //Convert the base point and the public key to projective representation
+   EC_CHECK(ecProjectify(params, &g, &params->g));
+   EC_CHECK(ecProjectify(params, &t, q));
+
+   //Compute R = d0.G + d1.Q
+   EC_CHECK(secp256k1TwinMult(params, r, d0, &g, d1, &t));
+
+end:
+   //Release EC points
+   ecFree(&g);
+   ecFree(&t);
+
+   //Return status code
+   return error;
+}
+
+#endif
@@ -0,0 +1,73 @@
+/**
+ * @file secp256k1.h
+ * @brief secp256k1 scalar multiplication (GLV method)
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+#ifndef _SECP256K1_H
+#define _SECP256K1_H
+
+//Dependencies
+#include "core/crypto.h"
+#include "ecc/ec.h"
+
+//GLV method for secp256k1
+#ifndef SECP256K1_GLV_SUPPORT
+   #define SECP256K1_GLV_SUPPORT ENABLED
+#elif (SECP256K1_GLV_SUPPORT != ENABLED && SECP256K1_GLV_SUPPORT != DISABLED)
+   #error SECP256K1_GLV_SUPPORT parameter is not valid
+#endif
+
+//Maximum length, in bits, of the half-size scalars
+#define SECP256K1_GLV_SCALAR_BIT_LEN 130
+#define SECP256K1_GLV_SCALAR_BYTE_LEN 17
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+//secp256k1 related functions
+bool_t secp256k1IsCurve(const EcDomainParameters *params);
+
+error_t secp256k1SplitScalar(Mpi *k1, Mpi *k2, const Mpi *k);
+
+error_t secp256k1Mult(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d, const EcPoint *s);
+
+error_t secp256k1TwinMult(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d0, const EcPoint *s, const Mpi *d1, const EcPoint *t);
+
+error_t secp256k1TwinMultBase(const EcDomainParameters *params, EcPoint *r,
+   const Mpi *d0, const Mpi *d1, const EcPoint *q);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
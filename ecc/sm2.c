@@ -158,7 +158,7 @@ error_t sm2GenerateSignature(const PrngAlgo *prngAlgo, void *prngContext,
 
       //Calculate s = ((1 + dA)^-1 * (k - r * dA)) mod q
       MPI_CHECK(mpiAddInt(&t, &privateKey->d, 1));
-      MPI_CHECK(mpiInvMod(&signature->s, &t, &params->q));
+      MPI_CHECK(mpiInvModRegular(&signature->s, &t, &params->q));
       MPI_CHECK(mpiMulMod(&t, &signature->r, &privateKey->d, &params->q));
       MPI_CHECK(mpiSubMod(&t, &k, &t, &params->q));
       MPI_CHECK(mpiMulMod(&signature->s, &signature->s, &t, &params->q));
@@ -222,7 +222,6 @@ error_t sm2VerifySignature(const EcDomainParameters *params,
    Mpi e;
    Mpi t;
    Mpi r;
-   EcPoint pa;
    EcPoint p1;
    uint8_t buffer[32];
 #if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
@@ -285,8 +284,7 @@ error_t sm2VerifySignature(const EcDomainParameters *params,
    mpiInit(&e);
    mpiInit(&t);
    mpiInit(&r);
-   //Initialize EC points
-   ecInit(&pa);
+   //Initialize EC point
    ecInit(&p1);
 
    //Calculate ZA = H256(ENTLA || IDA || a || b || xG || yG || xA || yA)
@@ -315,8 +313,7 @@ error_t sm2VerifySignature(const EcDomainParameters *params,
    else
    {
       //Calculate the point (x1, y1)=[s]G + [t]PA
-      EC_CHECK(ecProjectify(params, &pa, &publicKey->q));
-      EC_CHECK(ecTwinMult(params, &p1, &signature->s, &params->g, &t, &pa));
+      EC_CHECK(ecTwinMultBase(params, &p1, &signature->s, &t, publicKey));
       EC_CHECK(ecAffinify(params, &p1, &p1));
 
       //Calculate R = (e + x1) mod q
@@ -340,8 +337,7 @@ end:
    mpiFree(&e);
    mpiFree(&t);
    mpiFree(&r);
-   //Release EC points
-   ecFree(&pa);
+   //Release EC point
    ecFree(&p1);
 
 #if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
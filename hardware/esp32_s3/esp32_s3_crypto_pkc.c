@@ -48,6 +48,11 @@
 //Check crypto library configuration
 #if (ESP32_S3_CRYPTO_PKC_SUPPORT == ENABLED)
 
+//The fixed-size Montgomery engine does not use the hardware accelerator
+#if (MPI_MONT_SUPPORT == ENABLED)
+   #error MPI_MONT_SUPPORT must be disabled when ESP32_S3_CRYPTO_PKC_SUPPORT is enabled
+#endif
+
 
 /**
  * @brief RSA module initialization
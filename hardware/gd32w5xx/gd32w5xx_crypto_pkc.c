@@ -476,6 +476,20 @@ error_t rsadp(const RsaPrivateKey *key, const Mpi *c, Mpi *m)
    if(mpiCompInt(c, 0) < 0 || mpiComp(c, &key->n) >= 0)
       return ERROR_OUT_OF_RANGE;
 
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   //The CRT computation only involves two prime factors. Multi-prime keys
+   //are processed without CRT, using the private exponent
+   if(key->numOtherPrimes > 0)
+   {
+      //Make sure the private exponent is available
+      if(mpiGetLength(&key->n) == 0 || mpiGetLength(&key->d) == 0)
+         return ERROR_INVALID_PARAMETER;
+
+      //Let m = c ^ d mod n
+      return pkcauModExp(m, c, &key->d, &key->n);
+   }
+#endif
+
    //Use the Chinese remainder algorithm?
    if(mpiGetLength(&key->n) > 0 && mpiGetLength(&key->p) > 0 &&
       mpiGetLength(&key->q) > 0 && mpiGetLength(&key->dp) > 0 &&
@@ -835,6 +849,22 @@ error_t ecdsaVerifySignature(const EcDomainParameters *params,
 }
 
 
+/**
+ * @brief ECDSA batch signature verification
+ * @param[in] params EC domain parameters
+ * @param[in,out] items Signatures to be verified
+ * @param[in] numItems Number of signatures in the batch
+ * @return Error code
+ **/
+
+error_t ecdsaVerifySignatureBatch(const EcDomainParameters *params,
+   EcdsaVerifyItem *items, uint_t numItems)
+{
+   //The signatures are verified one by one using the hardware accelerator
+   return ecdsaVerifySignatureSequence(params, items, numItems);
+}
+
+
 #if (X25519_SUPPORT == ENABLED || ED25519_SUPPORT == ENABLED)
 
 /**
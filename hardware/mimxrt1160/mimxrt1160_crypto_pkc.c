@@ -37,12 +37,18 @@
 #include "core/crypto.h"
 #include "hardware/mimxrt1160/mimxrt1160_crypto.h"
 #include "hardware/mimxrt1160/mimxrt1160_crypto_pkc.h"
+#include "mpi/mpi_mont.h"
 #include "ecc/ec.h"
 #include "debug.h"
 
 //Check crypto library configuration
 #if (MIMXRT1160_CRYPTO_PKC_SUPPORT == ENABLED)
 
+//The fixed-size Montgomery engine does not use the hardware accelerator
+#if (MPI_MONT_SUPPORT == ENABLED)
+   #error MPI_MONT_SUPPORT must be disabled when MIMXRT1160_CRYPTO_PKC_SUPPORT is enabled
+#endif
+
 //Global variables
 PkhaArgs pkhaArgs;
 PkhaEccArgs pkhaEccArgs;
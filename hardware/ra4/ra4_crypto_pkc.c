@@ -47,6 +47,11 @@
 //Check crypto library configuration
 #if (RA4_CRYPTO_PKC_SUPPORT == ENABLED)
 
+//The fixed-size Montgomery engine does not use the hardware accelerator
+#if (MPI_MONT_SUPPORT == ENABLED)
+   #error MPI_MONT_SUPPORT must be disabled when RA4_CRYPTO_PKC_SUPPORT is enabled
+#endif
+
 //Global variables
 static Ra4RsaArgs rsaArgs;
 static Ra4EcArgs ecArgs;
@@ -282,6 +287,20 @@ error_t rsadp(const RsaPrivateKey *key, const Mpi *c, Mpi *m)
    if(mpiCompInt(c, 0) < 0 || mpiComp(c, &key->n) >= 0)
       return ERROR_OUT_OF_RANGE;
 
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   //The CRT computation only involves two prime factors. Multi-prime keys
+   //are processed without CRT, using the private exponent
+   if(key->numOtherPrimes > 0)
+   {
+      //Make sure the private exponent is available
+      if(mpiGetLength(&key->n) == 0 || mpiGetLength(&key->d) == 0)
+         return ERROR_INVALID_PARAMETER;
+
+      //Let m = c ^ d mod n
+      return mpiExpModRegular(m, c, &key->d, &key->n);
+   }
+#endif
+
    //Check the length of the private key
    if(nLen <= 256 && dLen <= 256)
    {
@@ -760,4 +779,20 @@ error_t ecdsaVerifySignature(const EcDomainParameters *params,
    return (status == FSP_SUCCESS) ? NO_ERROR : ERROR_INVALID_SIGNATURE;
 }
 
+
+/**
+ * @brief ECDSA batch signature verification
+ * @param[in] params EC domain parameters
+ * @param[in,out] items Signatures to be verified
+ * @param[in] numItems Number of signatures in the batch
+ * @return Error code
+ **/
+
+error_t ecdsaVerifySignatureBatch(const EcDomainParameters *params,
+   EcdsaVerifyItem *items, uint_t numItems)
+{
+   //The signatures are verified one by one using the hardware accelerator
+   return ecdsaVerifySignatureSequence(params, items, numItems);
+}
+
 #endif
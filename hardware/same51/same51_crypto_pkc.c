@@ -47,6 +47,11 @@
 //Check crypto library configuration
 #if (SAME51_CRYPTO_PKC_SUPPORT == ENABLED)
 
+//The fixed-size Montgomery engine does not use the hardware accelerator
+#if (MPI_MONT_SUPPORT == ENABLED)
+   #error MPI_MONT_SUPPORT must be disabled when SAME51_CRYPTO_PKC_SUPPORT is enabled
+#endif
+
 //Global variables
 PPUKCL_PARAM pvPUKCLParam;
 PUKCL_PARAM PUKCLParam;
@@ -575,10 +580,13 @@ error_t mpiExpMod(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p)
 /**
  * @brief Test whether a number is probable prime
  * @param[in] a Pointer to a multiple precision integer
+ * @param[in] prngAlgo PRNG algorithm (unused)
+ * @param[in] prngContext Pointer to the PRNG context (unused)
  * @return Error code
  **/
 
-error_t mpiCheckProbablePrime(const Mpi *a)
+error_t mpiCheckProbablePrime(const Mpi *a, const PrngAlgo *prngAlgo,
+   void *prngContext)
 {
    error_t error;
    uint_t k;
@@ -750,6 +758,20 @@ error_t rsadp(const RsaPrivateKey *key, const Mpi *c, Mpi *m)
    if(mpiCompInt(c, 0) < 0 || mpiComp(c, &key->n) >= 0)
       return ERROR_OUT_OF_RANGE;
 
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   //The CRT computation only involves two prime factors. Multi-prime keys
+   //are processed without CRT, using the private exponent
+   if(key->numOtherPrimes > 0)
+   {
+      //Make sure the private exponent is available
+      if(mpiGetLength(&key->n) == 0 || mpiGetLength(&key->d) == 0)
+         return ERROR_INVALID_PARAMETER;
+
+      //Let m = c ^ d mod n
+      return mpiExpMod(m, c, &key->d, &key->n);
+   }
+#endif
+
    //Use the Chinese remainder algorithm?
    if(nLen > 0 && pLen > 0 && qLen > 0 && dpLen > 0 && dqLen > 0 && qinvLen > 0)
    {
@@ -1494,4 +1516,20 @@ error_t ecdsaVerifySignature(const EcDomainParameters *ecParams,
    return error;
 }
 
+
+/**
+ * @brief ECDSA batch signature verification
+ * @param[in] params EC domain parameters
+ * @param[in,out] items Signatures to be verified
+ * @param[in] numItems Number of signatures in the batch
+ * @return Error code
+ **/
+
+error_t ecdsaVerifySignatureBatch(const EcDomainParameters *params,
+   EcdsaVerifyItem *items, uint_t numItems)
+{
+   //The signatures are verified one by one using the hardware accelerator
+   return ecdsaVerifySignatureSequence(params, items, numItems);
+}
+
 #endif
@@ -89,58 +89,51 @@ error_t bcryptHashPassword(const PrngAlgo *prngAlgo, void *prngContext,
 error_t bcryptVerifyPassword(const char_t *password, const char_t *hash)
 {
    error_t error;
-   size_t i;
-   size_t n;
-   uint_t cost;
-   uint8_t mask;
-   char_t *p;
-   uint8_t salt[16];
-   char_t temp[BCRYPT_HASH_STRING_LEN + 1];
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   BcryptContext *context;
+#else
+   BcryptContext context[1];
+#endif
 
    //Check parameters
    if(password == NULL || hash == NULL)
       return ERROR_INVALID_PARAMETER;
 
-   //Check the length of the hash string
-   if(osStrlen(hash) != BCRYPT_HASH_STRING_LEN)
-      return ERROR_INVALID_PASSWORD;
-
-   //bcrypt uses the $2a$ prefix in the hash string
-   if(osMemcmp(hash, "$2a$", 4))
-      return ERROR_INVALID_PASSWORD;
-
-   //Parse cost parameter
-   cost = osStrtoul(hash + 4, &p, 10);
-
-   //Malformed hash string?
-   if(p != (hash + 6) || *p != '$')
-      return ERROR_INVALID_PASSWORD;
-
-   //Check the value of the cost parameter
-   if(cost < BCRYPT_MIN_COST || cost > BCRYPT_MAX_COST)
-      return ERROR_INVALID_PASSWORD;
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Allocate a memory buffer to hold the bcrypt context
+   context = cryptoAllocMem(sizeof(BcryptContext));
+   //Failed to allocate memory?
+   if(context == NULL)
+      return ERROR_OUT_OF_MEMORY;
+#endif
 
-   //Parse salt parameter
-   error = radix64Decode(hash + 7, 22, salt, &n);
-   //Any error to report?
-   if(error)
-      return error;
+   //Parse the hash string and perform the first key expansion
+   error = bcryptVerifyInit(context, password, hash);
 
-   //Hash the password using bcrypt algorithm
-   error = bcrypt(cost, salt, password, temp, &n);
-   //Any error to report?
-   if(error)
-      return error;
+   //Check status code
+   if(!error)
+   {
+      //Perform the whole expensive key setup at once
+      error = bcryptStep(context, context->totalRounds);
+   }
 
-   //The calculated string is bitwise compared to the hash string. The
-   //password is correct if and only if the strings match
-   for(mask = 0, i = 0; i < BCRYPT_HASH_STRING_LEN; i++)
+   //Check status code
+   if(!error)
    {
-      mask |= temp[i] ^ hash[i];
+      //Compare the calculated hash string with the expected one
+      error = bcryptVerifyFinal(context, hash);
    }
 
+   //Erase the bcrypt context
+   bcryptDeinit(context);
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Release bcrypt context
+   cryptoFreeMem(context);
+#endif
+
    //Return status code
-   return (mask == 0) ? NO_ERROR : ERROR_INVALID_PASSWORD;
+   return error;
 }
 
 
@@ -158,14 +151,10 @@ error_t bcrypt(uint_t cost, const uint8_t *salt, const char_t *password,
    char_t *hash, size_t *hashLen)
 {
    error_t error;
-   uint_t i;
-   size_t n;
-   size_t length;
-   uint8_t buffer[24];
 #if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
-   BlowfishContext *context;
+   BcryptContext *context;
 #else
-   BlowfishContext context[1];
+   BcryptContext context[1];
 #endif
 
    //Check parameters
@@ -173,65 +162,355 @@ error_t bcrypt(uint_t cost, const uint8_t *salt, const char_t *password,
       return ERROR_INVALID_PARAMETER;
 
 #if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
-   //Allocate a memory buffer to hold the Blowfish context
-   context = cryptoAllocMem(sizeof(BlowfishContext));
+   //Allocate a memory buffer to hold the bcrypt context
+   context = cryptoAllocMem(sizeof(BcryptContext));
    //Failed to allocate memory?
    if(context == NULL)
       return ERROR_OUT_OF_MEMORY;
 #endif
 
+   //Initialize the bcrypt context
+   error = bcryptInit(context, cost, salt, password);
+
+   //Check status code
+   if(!error)
+   {
+      //Perform the whole expensive key setup at once
+      error = bcryptStep(context, context->totalRounds);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Generate the hash string
+      error = bcryptFinal(context, hash, hashLen);
+   }
+
+   //Erase the bcrypt context
+   bcryptDeinit(context);
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Release bcrypt context
+   cryptoFreeMem(context);
+#endif
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Initialize a resumable bcrypt computation
+ *
+ * The expensive key setup is not performed here. It is carried out by
+ * successive calls to bcryptStep, each of them processing a bounded number
+ * of EksBlowfish rounds
+ *
+ * @param[in] context Pointer to the bcrypt context to initialize
+ * @param[in] cost Key expansion iteration count as a power of two
+ * @param[in] salt Random salt (16 bytes)
+ * @param[in] password NULL-terminated password to be encoded
+ * @return Error code
+ **/
+
+error_t bcryptInit(BcryptContext *context, uint_t cost, const uint8_t *salt,
+   const char_t *password)
+{
+   error_t error;
+   size_t length;
+
+   //Check parameters
+   if(context == NULL || salt == NULL || password == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Check the value of the cost parameter
+   if(cost < BCRYPT_MIN_COST || cost > BCRYPT_MAX_COST)
+      return ERROR_INVALID_PARAMETER;
+
+   //Save the cost parameter and the salt
+   context->cost = cost;
+   osMemcpy(context->salt, salt, 16);
+
    //Calculate the length of the password (including the NULL-terminator byte)
    length = osStrlen(password) + 1;
 
-   //The key setup begins with a modified form of the standard Blowfish key
-   //setup, in which both the salt and password are used to set all subkeys
-   error = eksBlowfishSetup(context, cost, salt, 16, password, length);
+   //The Blowfish key schedule never uses more than 72 bytes of the key, so
+   //only that many bytes of the password need to be kept
+   context->keyLen = MIN(length, BCRYPT_MAX_KEY_LEN);
+   osMemcpy(context->key, password, context->keyLen);
+
+   //The cost parameter specifies a key expansion iteration count as a power
+   //of two
+   context->rounds = 0;
+   context->totalRounds = 1U << cost;
+
+   //Initialize Blowfish state
+   error = blowfishInitState(&context->blowfishContext);
 
    //Check status code
    if(!error)
    {
-      //Initialize plaintext
-      osMemcpy(buffer, "OrpheanBeholderScryDoubt", 24);
+      //Perform the first key expansion
+      error = blowfishExpandKey(&context->blowfishContext, context->salt, 16,
+         context->key, context->keyLen);
+   }
 
-      //Repeatedly encrypt the text "OrpheanBeholderScryDoubt" 64 times
-      for(i = 0; i < 64; i++)
-      {
-         //Perform encryption using Blowfish in ECB mode
-         blowfishEncryptBlock(context, buffer, buffer);
-         blowfishEncryptBlock(context, buffer + 8, buffer + 8);
-         blowfishEncryptBlock(context, buffer + 16, buffer + 16);
-      }
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Perform a bounded number of EksBlowfish rounds
+ * @param[in] context Pointer to the bcrypt context
+ * @param[in] maxRounds Maximum number of rounds to perform during this call
+ * @return Error code. ERROR_WOULD_BLOCK is returned as long as the expensive
+ *   key setup is not complete
+ **/
+
+error_t bcryptStep(BcryptContext *context, uint32_t maxRounds)
+{
+   error_t error;
+   uint32_t i;
+   uint32_t n;
+
+   //Make sure the bcrypt context is valid
+   if(context == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Limit the number of rounds to perform during this call
+   n = MIN(maxRounds, context->totalRounds - context->rounds);
+
+   //Iterate as many times as allowed
+   for(i = 0; i < n; i++)
+   {
+      //Perform key expansion with password
+      error = blowfishExpandKey(&context->blowfishContext, NULL, 0,
+         context->key, context->keyLen);
+      //Any error to report?
+      if(error)
+         break;
+
+      //Perform key expansion with salt
+      error = blowfishExpandKey(&context->blowfishContext, NULL, 0,
+         context->salt, 16);
+      //Any error to report?
+      if(error)
+         break;
+
+      //Update progress
+      context->rounds++;
    }
 
    //Check status code
    if(!error)
    {
-      //bcrypt uses the $2a$ prefix in the hash string
-      length = osSprintf(hash, "$2a$%02u$", cost);
-
-      //Concatenate the salt and the ciphertext
-      radix64Encode(salt, 16, hash + length, &n);
-      length += n;
-      radix64Encode(buffer, 23, hash + length, &n);
-      length += n;
-
-      //Return the length of the resulting hash string
-      if(hashLen != NULL)
+      //Some rounds are still pending?
+      if(context->rounds < context->totalRounds)
       {
-         *hashLen = length;
+         error = ERROR_WOULD_BLOCK;
       }
    }
 
-#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
-   //Release Blowfish context
-   cryptoFreeMem(context);
-#endif
-
    //Return status code
    return error;
 }
 
 
+/**
+ * @brief Get the progress of a resumable bcrypt computation
+ * @param[in] context Pointer to the bcrypt context
+ * @param[out] rounds Number of EksBlowfish rounds already performed
+ * @param[out] totalRounds Total number of EksBlowfish rounds
+ **/
+
+void bcryptGetProgress(const BcryptContext *context, uint32_t *rounds,
+   uint32_t *totalRounds)
+{
+   //Make sure the bcrypt context is valid
+   if(context == NULL)
+      return;
+
+   //Number of rounds already performed
+   if(rounds != NULL)
+   {
+      *rounds = context->rounds;
+   }
+
+   //Total number of rounds (2^cost)
+   if(totalRounds != NULL)
+   {
+      *totalRounds = context->totalRounds;
+   }
+}
+
+
+/**
+ * @brief Finish a resumable bcrypt computation
+ * @param[in] context Pointer to the bcrypt context
+ * @param[out] hash NULL-terminated hash string
+ * @param[out] hashLen Length of the hash string (optional parameter)
+ * @return Error code
+ **/
+
+error_t bcryptFinal(BcryptContext *context, char_t *hash, size_t *hashLen)
+{
+   uint_t i;
+   size_t n;
+   size_t length;
+   uint8_t buffer[24];
+
+   //Check parameters
+   if(context == NULL || hash == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //The expensive key setup must be complete
+   if(context->rounds < context->totalRounds)
+      return ERROR_WRONG_STATE;
+
+   //Initialize plaintext
+   osMemcpy(buffer, "OrpheanBeholderScryDoubt", 24);
+
+   //Repeatedly encrypt the text "OrpheanBeholderScryDoubt" 64 times
+   for(i = 0; i < 64; i++)
+   {
+      //Perform encryption using Blowfish in ECB mode
+      blowfishEncryptBlock(&context->blowfishContext, buffer, buffer);
+      blowfishEncryptBlock(&context->blowfishContext, buffer + 8, buffer + 8);
+      blowfishEncryptBlock(&context->blowfishContext, buffer + 16, buffer + 16);
+   }
+
+   //bcrypt uses the $2a$ prefix in the hash string
+   length = osSprintf(hash, "$2a$%02u$", context->cost);
+
+   //Concatenate the salt and the ciphertext
+   radix64Encode(context->salt, 16, hash + length, &n);
+   length += n;
+   radix64Encode(buffer, 23, hash + length, &n);
+   length += n;
+
+   //Return the length of the resulting hash string
+   if(hashLen != NULL)
+   {
+      *hashLen = length;
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Initialize a resumable password verification
+ * @param[in] context Pointer to the bcrypt context to initialize
+ * @param[in] password NULL-terminated password to be checked
+ * @param[in] hash NULL-terminated hash string
+ * @return Error code
+ **/
+
+error_t bcryptVerifyInit(BcryptContext *context, const char_t *password,
+   const char_t *hash)
+{
+   error_t error;
+   size_t n;
+   uint_t cost;
+   char_t *p;
+   uint8_t salt[16];
+
+   //Check parameters
+   if(context == NULL || password == NULL || hash == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Check the length of the hash string
+   if(osStrlen(hash) != BCRYPT_HASH_STRING_LEN)
+      return ERROR_INVALID_PASSWORD;
+
+   //bcrypt uses the $2a$ prefix in the hash string
+   if(osMemcmp(hash, "$2a$", 4))
+      return ERROR_INVALID_PASSWORD;
+
+   //Parse cost parameter
+   cost = osStrtoul(hash + 4, &p, 10);
+
+   //Malformed hash string?
+   if(p != (hash + 6) || *p != '$')
+      return ERROR_INVALID_PASSWORD;
+
+   //Check the value of the cost parameter
+   if(cost < BCRYPT_MIN_COST || cost > BCRYPT_MAX_COST)
+      return ERROR_INVALID_PASSWORD;
+
+   //Parse salt parameter
+   error = radix64Decode(hash + 7, 22, salt, &n);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Initialize the bcrypt context
+   return bcryptInit(context, cost, salt, password);
+}
+
+
+/**
+ * @brief Finish a resumable password verification
+ * @param[in] context Pointer to the bcrypt context
+ * @param[in] hash NULL-terminated hash string
+ * @return Error code
+ **/
+
+error_t bcryptVerifyFinal(BcryptContext *context, const char_t *hash)
+{
+   error_t error;
+   size_t i;
+   size_t n;
+   uint8_t mask;
+   char_t temp[BCRYPT_HASH_STRING_LEN + 1];
+
+   //Check parameters
+   if(context == NULL || hash == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Check the length of the hash string
+   if(osStrlen(hash) != BCRYPT_HASH_STRING_LEN)
+      return ERROR_INVALID_PASSWORD;
+
+   //Compute the hash string
+   error = bcryptFinal(context, temp, &n);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //The calculated string is bitwise compared to the hash string. The
+   //password is correct if and only if the strings match
+   for(mask = 0, i = 0; i < BCRYPT_HASH_STRING_LEN; i++)
+   {
+      mask |= temp[i] ^ hash[i];
+   }
+
+   //Return status code
+   return (mask == 0) ? NO_ERROR : ERROR_INVALID_PASSWORD;
+}
+
+
+/**
+ * @brief Release bcrypt context
+ * @param[in] context Pointer to the bcrypt context
+ **/
+
+void bcryptDeinit(BcryptContext *context)
+{
+   //Make sure the bcrypt context is valid
+   if(context != NULL)
+   {
+      //Clear bcrypt context
+      osMemset(context, 0, sizeof(BcryptContext));
+   }
+}
+
+
 /**
  * @brief Expensive key setup
  * @param[in] context Pointer to the Blowfish context
@@ -51,12 +51,31 @@
 
 //Length of bcrypt hash string
 #define BCRYPT_HASH_STRING_LEN 60
+//Maximum number of key bytes used by the Blowfish key schedule
+#define BCRYPT_MAX_KEY_LEN 72
 
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+
+/**
+ * @brief bcrypt context (resumable computation)
+ **/
+
+typedef struct
+{
+   BlowfishContext blowfishContext;
+   uint_t cost;
+   uint8_t salt[16];
+   uint8_t key[BCRYPT_MAX_KEY_LEN];
+   size_t keyLen;
+   uint32_t rounds;
+   uint32_t totalRounds;
+} BcryptContext;
+
+
 //bcrypt related functions
 error_t bcryptHashPassword(const PrngAlgo *prngAlgo, void *prngContext,
    uint_t cost, const char_t *password, char_t *hash, size_t *hashLen);
@@ -66,6 +85,23 @@ error_t bcryptVerifyPassword(const char_t *password, const char_t *hash);
 error_t bcrypt(uint_t cost, const uint8_t *salt, const char_t *password,
    char_t *hash, size_t *hashLen);
 
+error_t bcryptInit(BcryptContext *context, uint_t cost, const uint8_t *salt,
+   const char_t *password);
+
+error_t bcryptStep(BcryptContext *context, uint32_t maxRounds);
+
+void bcryptGetProgress(const BcryptContext *context, uint32_t *rounds,
+   uint32_t *totalRounds);
+
+error_t bcryptFinal(BcryptContext *context, char_t *hash, size_t *hashLen);
+
+error_t bcryptVerifyInit(BcryptContext *context, const char_t *password,
+   const char_t *hash);
+
+error_t bcryptVerifyFinal(BcryptContext *context, const char_t *hash);
+
+void bcryptDeinit(BcryptContext *context);
+
 error_t eksBlowfishSetup(BlowfishContext *context, uint_t cost,
    const uint8_t *salt, size_t saltLen, const char_t *password,
    size_t passwordLen);
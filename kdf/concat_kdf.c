@@ -38,13 +38,31 @@
 
 //Dependencies
 #include "core/crypto.h"
-#include "kdf/pbkdf.h"
+#include "kdf/concat_kdf.h"
 #include "mac/hmac.h"
 
 //Check crypto library configuration
 #if (CONCAT_KDF_SUPPORT == ENABLED)
 
 
+/**
+ * @brief Concat KDF task parameters
+ **/
+
+typedef struct
+{
+   const HashAlgo *hash;
+   const uint8_t *z;
+   size_t zLen;
+   const uint8_t *otherInfo;
+   size_t otherInfoLen;
+   uint32_t counter;
+   uint8_t *dk;
+   size_t dkLen;
+   error_t error;
+} ConcatKdfTask;
+
+
 /**
  * @brief Concat KDF key derivation function
  * @param[in] hash Underlying hash function
@@ -59,10 +77,38 @@
 
 error_t concatKdf(const HashAlgo *hash, const uint8_t *z, size_t zLen,
    const uint8_t *otherInfo, size_t otherInfoLen, uint8_t *dk, size_t dkLen)
+{
+   //The counter starts at 1
+   return concatKdfBlocks(hash, z, zLen, otherInfo, otherInfoLen, 1, dk,
+      dkLen);
+}
+
+
+/**
+ * @brief Derive a range of Concat KDF output blocks
+ *
+ * The output blocks are independent of each other. This function computes
+ * the keying material starting at the block whose counter value is given,
+ * so that the output can be split across several workers
+ *
+ * @param[in] hash Underlying hash function
+ * @param[in] z Shared secret Z
+ * @param[in] zLen Length in octets of the shared secret Z
+ * @param[in] otherInfo Context-specific information (optional parameter)
+ * @param[in] otherInfoLen Length in octets of the context-specific information
+ * @param[in] counter Counter value of the first block (starting at 1)
+ * @param[out] dk Derived keying material
+ * @param[in] dkLen Length in octets of the keying material to be generated
+ * @return Error code
+ **/
+
+error_t concatKdfBlocks(const HashAlgo *hash, const uint8_t *z, size_t zLen,
+   const uint8_t *otherInfo, size_t otherInfoLen, uint32_t counter,
+   uint8_t *dk, size_t dkLen)
 {
    size_t n;
    uint32_t i;
-   uint8_t counter[4];
+   uint8_t buffer[4];
 #if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
    HashContext *hashContext;
 #else
@@ -77,6 +123,10 @@ error_t concatKdf(const HashAlgo *hash, const uint8_t *z, size_t zLen,
    if(otherInfo == NULL && otherInfoLen != 0)
       return ERROR_INVALID_PARAMETER;
 
+   //The counter value must be a positive integer
+   if(counter == 0)
+      return ERROR_INVALID_PARAMETER;
+
 #if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
    //Allocate a memory buffer to hold the hash context
    hashContext = cryptoAllocMem(hash->contextSize);
@@ -86,14 +136,14 @@ error_t concatKdf(const HashAlgo *hash, const uint8_t *z, size_t zLen,
 #endif
 
    //Derive the keying material
-   for(i = 1; dkLen > 0; i++)
+   for(i = counter; dkLen > 0; i++)
    {
       //Encode the counter as a 32-bit big-endian string
-      STORE32BE(i, counter);
+      STORE32BE(i, buffer);
 
       //Compute H(counter || Z || OtherInfo)
       hash->init(hashContext);
-      hash->update(hashContext, counter, sizeof(uint32_t));
+      hash->update(hashContext, buffer, sizeof(uint32_t));
       hash->update(hashContext, z, zLen);
 
       //The OtherInfo parameter is optional
@@ -124,4 +174,109 @@ error_t concatKdf(const HashAlgo *hash, const uint8_t *z, size_t zLen,
    return NO_ERROR;
 }
 
+
+/**
+ * @brief Concat KDF task (executed by a worker)
+ * @param[in] param Pointer to the task parameters
+ **/
+
+static void concatKdfTask(void *param)
+{
+   ConcatKdfTask *task;
+
+   //Point to the task parameters
+   task = (ConcatKdfTask *) param;
+
+   //Derive the range of blocks assigned to this task
+   task->error = concatKdfBlocks(task->hash, task->z, task->zLen,
+      task->otherInfo, task->otherInfoLen, task->counter, task->dk,
+      task->dkLen);
+}
+
+
+/**
+ * @brief Concat KDF key derivation function (parallel computation)
+ *
+ * The output blocks are split into at most CONCAT_KDF_MAX_TASKS contiguous
+ * ranges, which are derived concurrently by the supplied worker pool
+ *
+ * @param[in] workerPool Worker pool used to run the tasks (optional)
+ * @param[in] workerPoolContext Pointer to the worker pool context
+ * @param[in] hash Underlying hash function
+ * @param[in] z Shared secret Z
+ * @param[in] zLen Length in octets of the shared secret Z
+ * @param[in] otherInfo Context-specific information (optional parameter)
+ * @param[in] otherInfoLen Length in octets of the context-specific information
+ * @param[out] dk Derived keying material
+ * @param[in] dkLen Length in octets of the keying material to be generated
+ * @return Error code
+ **/
+
+error_t concatKdfParallel(const WorkerPool *workerPool,
+   void *workerPoolContext, const HashAlgo *hash, const uint8_t *z,
+   size_t zLen, const uint8_t *otherInfo, size_t otherInfoLen, uint8_t *dk,
+   size_t dkLen)
+{
+   error_t error;
+   uint_t i;
+   uint_t numTasks;
+   size_t numBlocks;
+   size_t blocksPerTask;
+   size_t offset;
+   ConcatKdfTask tasks[CONCAT_KDF_MAX_TASKS];
+
+   //Check parameters
+   if(hash == NULL || z == NULL || dk == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //The OtherInfo parameter is optional
+   if(otherInfo == NULL && otherInfoLen != 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Number of hash blocks to compute
+   numBlocks = (dkLen + hash->digestSize - 1) / hash->digestSize;
+
+   //Sequential processing is used when no worker pool is available or when
+   //a single block is needed
+   if(workerPool == NULL || numBlocks <= 1)
+   {
+      return concatKdf(hash, z, zLen, otherInfo, otherInfoLen, dk, dkLen);
+   }
+
+   //Distribute the blocks evenly among the tasks
+   numTasks = MIN(numBlocks, CONCAT_KDF_MAX_TASKS);
+   blocksPerTask = (numBlocks + numTasks - 1) / numTasks;
+   numTasks = (numBlocks + blocksPerTask - 1) / blocksPerTask;
+
+   //Prepare task parameters
+   for(offset = 0, i = 0; i < numTasks; i++)
+   {
+      tasks[i].hash = hash;
+      tasks[i].z = z;
+      tasks[i].zLen = zLen;
+      tasks[i].otherInfo = otherInfo;
+      tasks[i].otherInfoLen = otherInfoLen;
+      tasks[i].counter = (uint32_t) (i * blocksPerTask + 1);
+      tasks[i].dk = dk + offset;
+      tasks[i].dkLen = MIN(blocksPerTask * hash->digestSize, dkLen - offset);
+      tasks[i].error = ERROR_FAILURE;
+
+      //Point to the next range of blocks
+      offset += tasks[i].dkLen;
+   }
+
+   //Run the tasks
+   error = workerPool->run(workerPoolContext, concatKdfTask, tasks,
+      sizeof(ConcatKdfTask), numTasks);
+
+   //Check the status of each task
+   for(i = 0; i < numTasks && !error; i++)
+   {
+      error = tasks[i].error;
+   }
+
+   //Return status code
+   return error;
+}
+
 #endif
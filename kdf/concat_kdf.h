@@ -34,6 +34,13 @@
 //Dependencies
 #include "core/crypto.h"
 
+//Maximum number of tasks used by concatKdfParallel
+#ifndef CONCAT_KDF_MAX_TASKS
+   #define CONCAT_KDF_MAX_TASKS 8
+#elif (CONCAT_KDF_MAX_TASKS < 1)
+   #error CONCAT_KDF_MAX_TASKS parameter is not valid
+#endif
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
@@ -43,6 +50,15 @@ extern "C" {
 error_t concatKdf(const HashAlgo *hash, const uint8_t *z, size_t zLen,
    const uint8_t *otherInfo, size_t otherInfoLen, uint8_t *dk, size_t dkLen);
 
+error_t concatKdfBlocks(const HashAlgo *hash, const uint8_t *z, size_t zLen,
+   const uint8_t *otherInfo, size_t otherInfoLen, uint32_t counter,
+   uint8_t *dk, size_t dkLen);
+
+error_t concatKdfParallel(const WorkerPool *workerPool,
+   void *workerPoolContext, const HashAlgo *hash, const uint8_t *z,
+   size_t zLen, const uint8_t *otherInfo, size_t otherInfoLen, uint8_t *dk,
+   size_t dkLen);
+
 //C++ guard
 #ifdef __cplusplus
 }
@@ -158,51 +158,182 @@ error_t hkdfExtract(const HashAlgo *hash, const uint8_t *ikm, size_t ikmLen,
 error_t hkdfExpand(const HashAlgo *hash, const uint8_t *prk, size_t prkLen,
    const uint8_t *info, size_t infoLen, uint8_t *okm, size_t okmLen)
 {
-   uint8_t i;
-   size_t tLen;
-   uint8_t t[MAX_HASH_DIGEST_SIZE];
+   error_t error;
 #if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
-   HmacContext *hmacContext;
+   HkdfContext *context;
 #else
-   HmacContext hmacContext[1];
+   HkdfContext context[1];
 #endif
 
    //Check parameters
    if(hash == NULL || prk == NULL || okm == NULL)
       return ERROR_INVALID_PARAMETER;
 
-   //The application specific information parameter is optional
-   if(info == NULL && infoLen != 0)
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Allocate a memory buffer to hold the HKDF context
+   context = cryptoAllocMem(sizeof(HkdfContext));
+   //Failed to allocate memory?
+   if(context == NULL)
+      return ERROR_OUT_OF_MEMORY;
+#endif
+
+   //Key HMAC with the pseudorandom key
+   error = hkdfExpandInit(context, hash, prk, prkLen);
+
+   //Check status code
+   if(!error)
+   {
+      //Derive the output keying material
+      error = hkdfExpandDerive(context, info, infoLen, okm, okmLen);
+   }
+
+   //Erase the HKDF context
+   hkdfExpandDeinit(context);
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Free previously allocated memory
+   cryptoFreeMem(context);
+#endif
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Initialize HKDF expand context
+ *
+ * The HMAC inner and outer pads are digested once and the resulting
+ * midstates are kept in the context, so that any number of labels can be
+ * expanded from the same PRK without re-keying HMAC
+ *
+ * @param[in] context Pointer to the HKDF context to initialize
+ * @param[in] hash Underlying hash function
+ * @param[in] prk Pseudorandom key
+ * @param[in] prkLen Length of the pseudorandom key
+ * @return Error code
+ **/
+
+error_t hkdfExpandInit(HkdfContext *context, const HashAlgo *hash,
+   const uint8_t *prk, size_t prkLen)
+{
+   uint_t i;
+   uint8_t key[MAX_HASH_BLOCK_SIZE];
+
+   //Check parameters
+   if(context == NULL || hash == NULL || prk == NULL)
       return ERROR_INVALID_PARAMETER;
 
    //PRK must be at least HashLen octets
    if(prkLen < hash->digestSize)
       return ERROR_INVALID_LENGTH;
 
+   //Underlying hash function
+   context->hash = hash;
+
+   //The key is longer than the block size?
+   if(prkLen > hash->blockSize)
+   {
+      //Digest the original key
+      hash->init(&context->hashContext);
+      hash->update(&context->hashContext, prk, prkLen);
+      hash->final(&context->hashContext, key);
+
+      //Key is padded to the right with extra zeros
+      osMemset(key + hash->digestSize, 0, hash->blockSize - hash->digestSize);
+   }
+   else
+   {
+      //Copy the key
+      osMemcpy(key, prk, prkLen);
+      //Key is padded to the right with extra zeros
+      osMemset(key + prkLen, 0, hash->blockSize - prkLen);
+   }
+
+   //XOR the resulting key with ipad
+   for(i = 0; i < hash->blockSize; i++)
+   {
+      key[i] ^= HMAC_IPAD;
+   }
+
+   //Precompute the inner midstate
+   hash->init(&context->innerContext);
+   hash->update(&context->innerContext, key, hash->blockSize);
+
+   //XOR the original key with opad
+   for(i = 0; i < hash->blockSize; i++)
+   {
+      key[i] ^= HMAC_IPAD ^ HMAC_OPAD;
+   }
+
+   //Precompute the outer midstate
+   hash->init(&context->outerContext);
+   hash->update(&context->outerContext, key, hash->blockSize);
+
+   //Erase the padded key
+   osMemset(key, 0, sizeof(key));
+
+   //Successful initialization
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Derive output keying material from a single label
+ * @param[in] context Pointer to the HKDF context
+ * @param[in] info Optional application specific information
+ * @param[in] infoLen Length of the application specific information
+ * @param[out] okm output keying material
+ * @param[in] okmLen Length of the output keying material
+ * @return Error code
+ **/
+
+error_t hkdfExpandDerive(HkdfContext *context, const uint8_t *info,
+   size_t infoLen, uint8_t *okm, size_t okmLen)
+{
+   uint8_t i;
+   size_t tLen;
+   const HashAlgo *hash;
+   uint8_t t[MAX_HASH_DIGEST_SIZE];
+
+   //Check parameters
+   if(context == NULL || context->hash == NULL || okm == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //The application specific information parameter is optional
+   if(info == NULL && infoLen != 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Underlying hash function
+   hash = context->hash;
+
    //Check the length of the output keying material
    if(okmLen > (255 * hash->digestSize))
       return ERROR_INVALID_LENGTH;
 
-#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
-   //Allocate a memory buffer to hold the HMAC context
-   hmacContext = cryptoAllocMem(sizeof(HmacContext));
-   //Failed to allocate memory?
-   if(hmacContext == NULL)
-      return ERROR_OUT_OF_MEMORY;
-#endif
-
    //T(0) is an empty string (zero length)
    tLen = 0;
 
    //Iterate as many times as required
    for(i = 1; okmLen > 0; i++)
    {
+      //Restore the inner midstate
+      osMemcpy(&context->hashContext, &context->innerContext,
+         hash->contextSize);
+
       //Compute T(i) = HMAC-Hash(PRK, T(i-1) | info | i)
-      hmacInit(hmacContext, hash, prk, prkLen);
-      hmacUpdate(hmacContext, t, tLen);
-      hmacUpdate(hmacContext, info, infoLen);
-      hmacUpdate(hmacContext, &i, sizeof(i));
-      hmacFinal(hmacContext, t);
+      hash->update(&context->hashContext, t, tLen);
+      hash->update(&context->hashContext, info, infoLen);
+      hash->update(&context->hashContext, &i, sizeof(i));
+      hash->final(&context->hashContext, t);
+
+      //Restore the outer midstate
+      osMemcpy(&context->hashContext, &context->outerContext,
+         hash->contextSize);
+
+      //Digest the result of the inner hash
+      hash->update(&context->hashContext, t, hash->digestSize);
+      hash->final(&context->hashContext, t);
 
       //Number of octets in the current block
       tLen = MIN(okmLen, hash->digestSize);
@@ -214,13 +345,65 @@ error_t hkdfExpand(const HashAlgo *hash, const uint8_t *prk, size_t prkLen,
       okmLen -= tLen;
    }
 
-#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
-   //Free previously allocated memory
-   cryptoFreeMem(hmacContext);
-#endif
+   //Erase the last block
+   osMemset(t, 0, sizeof(t));
 
    //Successful processing
    return NO_ERROR;
 }
 
+
+/**
+ * @brief Derive output keying material from multiple labels
+ *
+ * All the requests are expanded from the same PRK. The HMAC midstates are
+ * shared between the labels, so that the key setup is paid only once
+ *
+ * @param[in] context Pointer to the HKDF context
+ * @param[in] requests Array of (info, okm) requests
+ * @param[in] numRequests Number of requests in the array
+ * @return Error code
+ **/
+
+error_t hkdfExpandMulti(HkdfContext *context,
+   const HkdfExpandRequest *requests, uint_t numRequests)
+{
+   error_t error;
+   uint_t i;
+
+   //Check parameters
+   if(context == NULL || (requests == NULL && numRequests != 0))
+      return ERROR_INVALID_PARAMETER;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Process each request
+   for(i = 0; i < numRequests && !error; i++)
+   {
+      //Derive the output keying material for the current label
+      error = hkdfExpandDerive(context, requests[i].info, requests[i].infoLen,
+         requests[i].okm, requests[i].okmLen);
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Release HKDF expand context
+ * @param[in] context Pointer to the HKDF context
+ **/
+
+void hkdfExpandDeinit(HkdfContext *context)
+{
+   //Make sure the HKDF context is valid
+   if(context != NULL)
+   {
+      //Clear HKDF context
+      osMemset(context, 0, sizeof(HkdfContext));
+   }
+}
+
 #endif
@@ -33,12 +33,40 @@
 
 //Dependencies
 #include "core/crypto.h"
+#include "hash/hash_algorithms.h"
 
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+
+/**
+ * @brief HKDF expand request
+ **/
+
+typedef struct
+{
+   const uint8_t *info;
+   size_t infoLen;
+   uint8_t *okm;
+   size_t okmLen;
+} HkdfExpandRequest;
+
+
+/**
+ * @brief HKDF expand context
+ **/
+
+typedef struct
+{
+   const HashAlgo *hash;
+   HashContext innerContext;
+   HashContext outerContext;
+   HashContext hashContext;
+} HkdfContext;
+
+
 //HKDF related functions
 error_t hkdf(const HashAlgo *hash, const uint8_t *ikm, size_t ikmLen,
    const uint8_t *salt, size_t saltLen, const uint8_t *info, size_t infoLen,
@@ -50,6 +78,17 @@ error_t hkdfExtract(const HashAlgo *hash, const uint8_t *ikm, size_t ikmLen,
 error_t hkdfExpand(const HashAlgo *hash, const uint8_t *prk, size_t prkLen,
    const uint8_t *info, size_t infoLen, uint8_t *okm, size_t okmLen);
 
+error_t hkdfExpandInit(HkdfContext *context, const HashAlgo *hash,
+   const uint8_t *prk, size_t prkLen);
+
+error_t hkdfExpandDerive(HkdfContext *context, const uint8_t *info,
+   size_t infoLen, uint8_t *okm, size_t okmLen);
+
+error_t hkdfExpandMulti(HkdfContext *context,
+   const HkdfExpandRequest *requests, uint_t numRequests);
+
+void hkdfExpandDeinit(HkdfContext *context);
+
 //C++ guard
 #ifdef __cplusplus
 }
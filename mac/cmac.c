@@ -307,6 +307,181 @@ void cmacDeinit(CmacContext *context)
 }
 
 
+/**
+ * @brief Compute CMAC over multiple independent messages
+ *
+ * CMAC is serial within a message, but the chains of distinct messages are
+ * independent. Up to CMAC_MULTI_LANES messages are processed side by side:
+ * one block of each message is prepared, then all the blocks are encrypted
+ * back to back so that their cipher invocations can overlap. Each request
+ * refers to a CMAC context initialized with cmacInit, which may be shared
+ * between requests that use the same key. The contexts are not modified
+ *
+ * @param[in] requests Array of (context, message, MAC) requests
+ * @param[in] numRequests Number of requests in the array
+ * @return Error code
+ **/
+
+error_t cmacComputeMulti(const CmacRequest *requests, uint_t numRequests)
+{
+   uint_t i;
+   uint_t k;
+   uint_t next;
+   uint_t active;
+   size_t n;
+   CmacContext *context;
+   uint_t index[CMAC_MULTI_LANES];
+   const uint8_t *data[CMAC_MULTI_LANES];
+   size_t length[CMAC_MULTI_LANES];
+   bool_t last[CMAC_MULTI_LANES];
+   uint8_t block[CMAC_MULTI_LANES][MAX_CIPHER_BLOCK_SIZE];
+   uint8_t chain[CMAC_MULTI_LANES][MAX_CIPHER_BLOCK_SIZE];
+
+   //Check parameters
+   if(requests == NULL && numRequests != 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure all the requests are valid before processing any message
+   for(i = 0; i < numRequests; i++)
+   {
+      //Point to the CMAC context
+      context = requests[i].context;
+
+      //The CMAC context must have been initialized
+      if(context == NULL || context->cipher == NULL)
+         return ERROR_INVALID_PARAMETER;
+
+      //Check the message
+      if(requests[i].data == NULL && requests[i].dataLen != 0)
+         return ERROR_INVALID_PARAMETER;
+
+      //Check the length of the MAC
+      if(requests[i].mac == NULL || requests[i].macLen < 1 ||
+         requests[i].macLen > context->cipher->blockSize)
+      {
+         return ERROR_INVALID_PARAMETER;
+      }
+   }
+
+   //All the lanes are initially empty
+   for(k = 0; k < CMAC_MULTI_LANES; k++)
+   {
+      index[k] = numRequests;
+   }
+
+   //Index of the next request to be scheduled
+   next = 0;
+
+   //Process the messages
+   do
+   {
+      //Number of lanes holding a message
+      active = 0;
+
+      //Prepare one block per lane
+      for(k = 0; k < CMAC_MULTI_LANES; k++)
+      {
+         //Refill empty lanes with pending requests
+         if(index[k] == numRequests && next < numRequests)
+         {
+            index[k] = next++;
+            data[k] = requests[index[k]].data;
+            length[k] = requests[index[k]].dataLen;
+
+            //Let C(0) = 0
+            osMemset(chain[k], 0, MAX_CIPHER_BLOCK_SIZE);
+         }
+
+         //Empty lane?
+         if(index[k] == numRequests)
+            continue;
+
+         //Point to the CMAC context
+         context = requests[index[k]].context;
+         //Block size of the underlying cipher
+         n = context->cipher->blockSize;
+
+         //Intermediate block?
+         if(length[k] > n)
+         {
+            //XOR M(i) with C(i-1)
+            cmacXorBlock(block[k], data[k], chain[k], n);
+
+            //Point to the next block
+            data[k] += n;
+            length[k] -= n;
+            last[k] = FALSE;
+         }
+         else
+         {
+            //Copy the final block M(n)
+            osMemcpy(block[k], data[k], length[k]);
+
+            //Check whether the last block is complete
+            if(length[k] == n)
+            {
+               //The final block M(n) is XOR-ed with the first subkey K1
+               cmacXorBlock(block[k], block[k], context->k1, n);
+            }
+            else
+            {
+               //Append padding string
+               block[k][length[k]] = 0x80;
+               osMemset(block[k] + length[k] + 1, 0, n - length[k] - 1);
+
+               //The final block M(n) is XOR-ed with the second subkey K2
+               cmacXorBlock(block[k], block[k], context->k2, n);
+            }
+
+            //XOR M(n) with C(n-1)
+            cmacXorBlock(block[k], block[k], chain[k], n);
+            last[k] = TRUE;
+         }
+
+         //One more active lane
+         active++;
+      }
+
+      //Encrypt the blocks of all the active lanes back to back
+      for(k = 0; k < CMAC_MULTI_LANES; k++)
+      {
+         //Active lane?
+         if(index[k] < numRequests)
+         {
+            //Compute C(i) = CIPH(M(i) ^ C(i-1))
+            context = requests[index[k]].context;
+            context->cipher->encryptBlock(&context->cipherContext, block[k],
+               chain[k]);
+         }
+      }
+
+      //Retire the lanes whose message is complete
+      for(k = 0; k < CMAC_MULTI_LANES; k++)
+      {
+         //Final block processed?
+         if(index[k] < numRequests && last[k])
+         {
+            //Copy the resulting MAC value (truncated if necessary)
+            osMemcpy(requests[index[k]].mac, chain[k],
+               requests[index[k]].macLen);
+
+            //The lane is now available
+            index[k] = numRequests;
+         }
+      }
+
+      //Loop as long as some messages are being processed
+   } while(active > 0);
+
+   //Clear intermediate values
+   osMemset(block, 0, sizeof(block));
+   osMemset(chain, 0, sizeof(chain));
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
 /**
  * @brief Multiplication by x in GF(2^128)
  * @param[out] x Pointer to the output block
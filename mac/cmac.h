@@ -40,6 +40,13 @@
    #define CMAC_PRIVATE_CONTEXT
 #endif
 
+//Number of messages processed in parallel by cmacComputeMulti
+#ifndef CMAC_MULTI_LANES
+   #define CMAC_MULTI_LANES 8
+#elif (CMAC_MULTI_LANES < 1)
+   #error CMAC_MULTI_LANES parameter is not valid
+#endif
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
@@ -63,6 +70,20 @@ typedef struct
 } CmacContext;
 
 
+/**
+ * @brief CMAC request (multi-message processing)
+ **/
+
+typedef struct
+{
+   CmacContext *context;
+   const void *data;
+   size_t dataLen;
+   uint8_t *mac;
+   size_t macLen;
+} CmacRequest;
+
+
 //CMAC related functions
 error_t cmacCompute(const CipherAlgo *cipher, const void *key, size_t keyLen,
    const void *data, size_t dataLen, uint8_t *mac, size_t macLen);
@@ -75,6 +96,8 @@ void cmacUpdate(CmacContext *context, const void *data, size_t dataLen);
 error_t cmacFinal(CmacContext *context, uint8_t *mac, size_t macLen);
 void cmacDeinit(CmacContext *context);
 
+error_t cmacComputeMulti(const CmacRequest *requests, uint_t numRequests);
+
 void cmacMul(uint8_t *x, const uint8_t *a, size_t n, uint8_t rb);
 void cmacXorBlock(uint8_t *x, const uint8_t *a, const uint8_t *b, size_t n);
 
@@ -169,11 +169,46 @@ error_t kmacInit(KmacContext *context, uint_t strength, const void *key,
       i++;
    }
 
+   //The encoded key fills a whole number of blocks, so the input buffer is
+   //empty and the keyed state is entirely captured by the state array
+   osMemcpy(context->keyedState, context->cshakeContext.keccakContext.a,
+      sizeof(context->keyedState));
+
    //Successful initialization
    return NO_ERROR;
 }
 
 
+/**
+ * @brief Reset KMAC context
+ *
+ * Restore the Keccak state saved after the absorption of the encoded
+ * function name, customization string and key, so that a new message can be
+ * authenticated without absorbing the key again
+ *
+ * @param[in] context Pointer to the KMAC context
+ **/
+
+void kmacReset(KmacContext *context)
+{
+   KeccakContext *keccakContext;
+
+   //Make sure the KMAC context is valid
+   if(context == NULL)
+      return;
+
+   //Point to the Keccak context
+   keccakContext = &context->cshakeContext.keccakContext;
+
+   //Restore the keyed state
+   osMemcpy(keccakContext->a, context->keyedState,
+      sizeof(context->keyedState));
+
+   //The input buffer is empty
+   keccakContext->length = 0;
+}
+
+
 /**
  * @brief Update the KMAC context with a portion of the message being hashed
  * @param[in] context Pointer to the KMAC context
@@ -240,6 +275,56 @@ void kmacDeinit(KmacContext *context)
 }
 
 
+/**
+ * @brief Compute KMAC over multiple messages with the same key
+ *
+ * The KMAC context must have been initialized with kmacInit. Each message is
+ * processed from the keyed state, so the key is absorbed only once for the
+ * whole batch
+ *
+ * @param[in] context Pointer to the KMAC context
+ * @param[in,out] requests Array of (message, MAC) requests
+ * @param[in] numRequests Number of requests in the array
+ * @return Error code
+ **/
+
+error_t kmacComputeMulti(KmacContext *context, const KmacRequest *requests,
+   uint_t numRequests)
+{
+   error_t error;
+   uint_t i;
+
+   //Check parameters
+   if(context == NULL || (requests == NULL && numRequests != 0))
+      return ERROR_INVALID_PARAMETER;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Process each message
+   for(i = 0; i < numRequests && !error; i++)
+   {
+      //Make sure the message is valid
+      if(requests[i].data == NULL && requests[i].dataLen != 0)
+      {
+         error = ERROR_INVALID_PARAMETER;
+      }
+      else
+      {
+         //Restore the keyed state
+         kmacReset(context);
+         //Digest the message
+         kmacUpdate(context, requests[i].data, requests[i].dataLen);
+         //Finalize the KMAC computation
+         error = kmacFinal(context, requests[i].mac, requests[i].macLen);
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
 /**
  * @brief Encode integer as byte string
  * @param[in] value Value of the integer to be encoded
@@ -53,10 +53,24 @@ extern "C" {
 typedef struct
 {
    CshakeContext cshakeContext;
+   keccak_lane_t keyedState[5][5];
    KMAC_PRIVATE_CONTEXT
 } KmacContext;
 
 
+/**
+ * @brief KMAC request (multi-message processing)
+ **/
+
+typedef struct
+{
+   const void *data;
+   size_t dataLen;
+   uint8_t *mac;
+   size_t macLen;
+} KmacRequest;
+
+
 //KMAC related constants
 extern const uint8_t kmac128Oid[9];
 extern const uint8_t kmac256Oid[9];
@@ -69,10 +83,14 @@ error_t kmacCompute(uint_t strength, const void *key, size_t keyLen,
 error_t kmacInit(KmacContext *context, uint_t strength, const void *key,
    size_t keyLen, const char_t *custom, size_t customLen);
 
+void kmacReset(KmacContext *context);
 void kmacUpdate(KmacContext *context, const void *data, size_t dataLen);
 error_t kmacFinal(KmacContext *context, uint8_t *mac, size_t macLen);
 void kmacDeinit(KmacContext *context);
 
+error_t kmacComputeMulti(KmacContext *context, const KmacRequest *requests,
+   uint_t numRequests);
+
 void kmacRightEncode(size_t value, uint8_t *buffer, size_t *length);
 
 //C++ guard
@@ -305,6 +305,180 @@ void xcbcMacDeinit(XcbcMacContext *context)
 }
 
 
+/**
+ * @brief Compute XCBC-MAC over multiple independent messages
+ *
+ * Up to XCBC_MAC_MULTI_LANES messages are processed side by side, one block
+ * of each message per round. Each request refers to an XCBC-MAC context
+ * initialized with xcbcMacInit, which may be shared between requests that
+ * use the same key. The contexts are not modified
+ *
+ * @param[in] requests Array of (context, message, MAC) requests
+ * @param[in] numRequests Number of requests in the array
+ * @return Error code
+ **/
+
+error_t xcbcMacComputeMulti(const XcbcMacRequest *requests,
+   uint_t numRequests)
+{
+   uint_t i;
+   uint_t k;
+   uint_t next;
+   uint_t active;
+   size_t n;
+   XcbcMacContext *context;
+   uint_t index[XCBC_MAC_MULTI_LANES];
+   const uint8_t *data[XCBC_MAC_MULTI_LANES];
+   size_t length[XCBC_MAC_MULTI_LANES];
+   bool_t last[XCBC_MAC_MULTI_LANES];
+   uint8_t block[XCBC_MAC_MULTI_LANES][MAX_CIPHER_BLOCK_SIZE];
+   uint8_t chain[XCBC_MAC_MULTI_LANES][MAX_CIPHER_BLOCK_SIZE];
+
+   //Check parameters
+   if(requests == NULL && numRequests != 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Make sure all the requests are valid before processing any message
+   for(i = 0; i < numRequests; i++)
+   {
+      //Point to the XCBC-MAC context
+      context = requests[i].context;
+
+      //The XCBC-MAC context must have been initialized
+      if(context == NULL || context->cipher == NULL)
+         return ERROR_INVALID_PARAMETER;
+
+      //Check the message
+      if(requests[i].data == NULL && requests[i].dataLen != 0)
+         return ERROR_INVALID_PARAMETER;
+
+      //Check the length of the MAC
+      if(requests[i].mac == NULL || requests[i].macLen < 1 ||
+         requests[i].macLen > context->cipher->blockSize)
+      {
+         return ERROR_INVALID_PARAMETER;
+      }
+   }
+
+   //All the lanes are initially empty
+   for(k = 0; k < XCBC_MAC_MULTI_LANES; k++)
+   {
+      index[k] = numRequests;
+   }
+
+   //Index of the next request to be scheduled
+   next = 0;
+
+   //Process the messages
+   do
+   {
+      //Number of lanes holding a message
+      active = 0;
+
+      //Prepare one block per lane
+      for(k = 0; k < XCBC_MAC_MULTI_LANES; k++)
+      {
+         //Refill empty lanes with pending requests
+         if(index[k] == numRequests && next < numRequests)
+         {
+            index[k] = next++;
+            data[k] = requests[index[k]].data;
+            length[k] = requests[index[k]].dataLen;
+
+            //Define E[0] = 0x00000000000000000000000000000000
+            osMemset(chain[k], 0, MAX_CIPHER_BLOCK_SIZE);
+         }
+
+         //Empty lane?
+         if(index[k] == numRequests)
+            continue;
+
+         //Point to the XCBC-MAC context
+         context = requests[index[k]].context;
+         //Block size of the underlying cipher
+         n = context->cipher->blockSize;
+
+         //Intermediate block?
+         if(length[k] > n)
+         {
+            //XOR M[i] with E[i-1]
+            xcbcMacXorBlock(block[k], data[k], chain[k], n);
+
+            //Point to the next block
+            data[k] += n;
+            length[k] -= n;
+            last[k] = FALSE;
+         }
+         else
+         {
+            //Copy the final block M[n]
+            osMemcpy(block[k], data[k], length[k]);
+
+            //Check whether the block size of M[n] is 128 bits
+            if(length[k] == n)
+            {
+               //XOR M[n] with key K2
+               xcbcMacXorBlock(block[k], block[k], context->k2, n);
+            }
+            else
+            {
+               //Pad M[n] with a single "1" bit followed by "0" bits
+               block[k][length[k]] = 0x80;
+               osMemset(block[k] + length[k] + 1, 0, n - length[k] - 1);
+
+               //XOR M[n] with key K3
+               xcbcMacXorBlock(block[k], block[k], context->k3, n);
+            }
+
+            //XOR M[n] with E[n-1]
+            xcbcMacXorBlock(block[k], block[k], chain[k], n);
+            last[k] = TRUE;
+         }
+
+         //One more active lane
+         active++;
+      }
+
+      //Encrypt the blocks of all the active lanes back to back
+      for(k = 0; k < XCBC_MAC_MULTI_LANES; k++)
+      {
+         //Active lane?
+         if(index[k] < numRequests)
+         {
+            //Encrypt the result with key K1, yielding E[i]
+            context = requests[index[k]].context;
+            context->cipher->encryptBlock(&context->cipherContext, block[k],
+               chain[k]);
+         }
+      }
+
+      //Retire the lanes whose message is complete
+      for(k = 0; k < XCBC_MAC_MULTI_LANES; k++)
+      {
+         //Final block processed?
+         if(index[k] < numRequests && last[k])
+         {
+            //The authenticator value is the leftmost bits of E[n]
+            osMemcpy(requests[index[k]].mac, chain[k],
+               requests[index[k]].macLen);
+
+            //The lane is now available
+            index[k] = numRequests;
+         }
+      }
+
+      //Loop as long as some messages are being processed
+   } while(active > 0);
+
+   //Clear intermediate values
+   osMemset(block, 0, sizeof(block));
+   osMemset(chain, 0, sizeof(chain));
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
 /**
  * @brief XOR operation
  * @param[out] x Block resulting from the XOR operation
@@ -40,6 +40,13 @@
    #define XCBC_MAC_PRIVATE_CONTEXT
 #endif
 
+//Number of messages processed in parallel by xcbcMacComputeMulti
+#ifndef XCBC_MAC_MULTI_LANES
+   #define XCBC_MAC_MULTI_LANES 8
+#elif (XCBC_MAC_MULTI_LANES < 1)
+   #error XCBC_MAC_MULTI_LANES parameter is not valid
+#endif
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
@@ -64,6 +71,20 @@ typedef struct
 } XcbcMacContext;
 
 
+/**
+ * @brief XCBC-MAC request (multi-message processing)
+ **/
+
+typedef struct
+{
+   XcbcMacContext *context;
+   const void *data;
+   size_t dataLen;
+   uint8_t *mac;
+   size_t macLen;
+} XcbcMacRequest;
+
+
 //XCBC-MAC related functions
 error_t xcbcMacCompute(const CipherAlgo *cipher, const void *key, size_t keyLen,
    const void *data, size_t dataLen, uint8_t *mac, size_t macLen);
@@ -76,6 +97,9 @@ void xcbcMacUpdate(XcbcMacContext *context, const void *data, size_t dataLen);
 error_t xcbcMacFinal(XcbcMacContext *context, uint8_t *mac, size_t macLen);
 void xcbcMacDeinit(XcbcMacContext *context);
 
+error_t xcbcMacComputeMulti(const XcbcMacRequest *requests,
+   uint_t numRequests);
+
 void xcbcMacXorBlock(uint8_t *x, const uint8_t *a, const uint8_t *b, size_t n);
 
 //C++ guard
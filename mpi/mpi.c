@@ -34,11 +34,265 @@
 //Dependencies
 #include "core/crypto.h"
 #include "mpi/mpi.h"
+#include "mpi/mpi_mont.h"
 #include "debug.h"
 
+//x86-64 specific headers
+#if (MPI_ASM_X86_64_SUPPORT == ENABLED)
+   #include <cpuid.h>
+#endif
+
 //Check crypto library configuration
 #if (MPI_SUPPORT == ENABLED)
 
+//Odd primes below 2048 (trial division and sieving)
+static const uint16_t mpiSmallPrimes[] =
+{
+   3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41,
+   43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97,
+   101, 103, 107, 109, 113, 127, 131, 137, 139, 149, 151, 157,
+   163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227,
+   229, 233, 239, 241, 251, 257, 263, 269, 271, 277, 281, 283,
+   293, 307, 311, 313, 317, 331, 337, 347, 349, 353, 359, 367,
+   373, 379, 383, 389, 397, 401, 409, 419, 421, 431, 433, 439,
+   443, 449, 457, 461, 463, 467, 479, 487, 491, 499, 503, 509,
+   521, 523, 541, 547, 557, 563, 569, 571, 577, 587, 593, 599,
+   601, 607, 613, 617, 619, 631, 641, 643, 647, 653, 659, 661,
+   673, 677, 683, 691, 701, 709, 719, 727, 733, 739, 743, 751,
+   757, 761, 769, 773, 787, 797, 809, 811, 821, 823, 827, 829,
+   839, 853, 857, 859, 863, 877, 881, 883, 887, 907, 911, 919,
+   929, 937, 941, 947, 953, 967, 971, 977, 983, 991, 997, 1009,
+   1013, 1019, 1021, 1031, 1033, 1039, 1049, 1051, 1061, 1063, 1069, 1087,
+   1091, 1093, 1097, 1103, 1109, 1117, 1123, 1129, 1151, 1153, 1163, 1171,
+   1181, 1187, 1193, 1201, 1213, 1217, 1223, 1229, 1231, 1237, 1249, 1259,
+   1277, 1279, 1283, 1289, 1291, 1297, 1301, 1303, 1307, 1319, 1321, 1327,
+   1361, 1367, 1373, 1381, 1399, 1409, 1423, 1427, 1429, 1433, 1439, 1447,
+   1451, 1453, 1459, 1471, 1481, 1483, 1487, 1489, 1493, 1499, 1511, 1523,
+   1531, 1543, 1549, 1553, 1559, 1567, 1571, 1579, 1583, 1597, 1601, 1607,
+   1609, 1613, 1619, 1621, 1627, 1637, 1657, 1663, 1667, 1669, 1693, 1697,
+   1699, 1709, 1721, 1723, 1733, 1741, 1747, 1753, 1759, 1777, 1783, 1787,
+   1789, 1801, 1811, 1823, 1831, 1847, 1861, 1867, 1871, 1873, 1877, 1879,
+   1889, 1901, 1907, 1913, 1931, 1933, 1949, 1951, 1973, 1979, 1987, 1993,
+   1997, 1999, 2003, 2011, 2017, 2027, 2029, 2039
+};
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+
+//Scratch arena of the current thread
+static MPI_ARENA_THREAD_LOCAL MpiArena mpiArena;
+
+
+/**
+ * @brief Enter a scratch arena scope
+ *
+ * Temporary integers initialized after this call are bump-allocated from the
+ * scratch arena of the current thread. They must be released before the
+ * scope is left, by the same thread
+ *
+ * @param[out] scope Scope descriptor (typically a local variable)
+ **/
+
+void mpiArenaEnter(MpiArenaScope *scope)
+{
+   //The arena is allocated on first use and kept for subsequent operations
+   if(mpiArena.buffer == NULL)
+   {
+      //If the allocation fails, integers are allocated from the heap
+      mpiArena.buffer = cryptoAllocMem(MPI_ARENA_SIZE);
+      mpiArena.offset = 0;
+   }
+
+   //Save the current state of the arena
+   scope->parent = mpiArena.top;
+   scope->offset = mpiArena.offset;
+
+   //Assign a new generation number to the scope (0 is reserved for the
+   //integers initialized outside of any scope)
+   if(++mpiArena.generation == 0)
+   {
+      mpiArena.generation = 1;
+   }
+
+   scope->generation = mpiArena.generation;
+
+   //The new scope becomes the innermost scope
+   mpiArena.top = scope;
+}
+
+
+/**
+ * @brief Leave a scratch arena scope
+ *
+ * All the memory allocated from the arena within the scope is reclaimed at
+ * once. Scopes must be left in reverse order. If an enclosing scope is left
+ * while nested scopes are still active, the nested scopes are left as well,
+ * so that the arena never refers to a stale scope descriptor
+ *
+ * @param[in] scope Scope descriptor
+ **/
+
+void mpiArenaLeave(MpiArenaScope *scope)
+{
+   MpiArenaScope *p;
+
+   //Search the active scopes for the specified scope
+   for(p = mpiArena.top; p != NULL && p != scope; p = p->parent)
+   {
+   }
+
+   //Unknown scope (already left, or entered by another thread)?
+   if(p == NULL)
+   {
+      //Debug message
+      TRACE_ERROR("MPI arena scope left twice or by another thread!\r\n");
+      return;
+   }
+
+   //Scopes must be left in LIFO order
+   if(mpiArena.top != scope)
+   {
+      //Debug message
+      TRACE_ERROR("MPI arena scopes left out of order!\r\n");
+   }
+
+   //Reclaim the memory allocated within the scope and the nested scopes
+   mpiArena.offset = scope->offset;
+   //Restore the enclosing scope
+   mpiArena.top = scope->parent;
+}
+
+
+/**
+ * @brief Release the scratch arena of the current thread
+ *
+ * This function should be called before a thread that performed MPI
+ * operations terminates
+ *
+ **/
+
+void mpiArenaRelease(void)
+{
+   //The arena cannot be released while a scope is active
+   if(mpiArena.top == NULL && mpiArena.buffer != NULL)
+   {
+      //Release memory buffer
+      cryptoFreeMem(mpiArena.buffer);
+
+      //Reset the state of the arena
+      mpiArena.buffer = NULL;
+      mpiArena.offset = 0;
+   }
+}
+
+
+/**
+ * @brief Release the data buffer of a multiple precision integer
+ * @param[in] r Pointer to the multiple precision integer
+ **/
+
+static void mpiArenaFreeData(Mpi *r)
+{
+   //Buffer allocated from the scratch arena?
+   if(r->scratch)
+   {
+      //The last block allocated from the innermost scope of the current
+      //thread can be reclaimed immediately. Other blocks are reclaimed when
+      //the scope is left
+      if(r->arena == &mpiArena && mpiArena.top != NULL &&
+         r->scope == mpiArena.top->generation &&
+         (uint8_t *) (r->data + r->size) == mpiArena.buffer + mpiArena.offset)
+      {
+         mpiArena.offset -= r->size * MPI_INT_SIZE;
+      }
+   }
+   else
+   {
+      //Release memory buffer
+      cryptoFreeMem(r->data);
+   }
+}
+
+
+/**
+ * @brief Grow a multiple precision integer using the scratch arena
+ * @param[in,out] r A multiple precision integer whose size is to be increased
+ * @param[in] size Desired size in words
+ * @return TRUE if the memory was taken from the arena, else FALSE
+ **/
+
+static bool_t mpiArenaGrow(Mpi *r, uint_t size)
+{
+   size_t n;
+   size_t m;
+   uint_t *data;
+
+   //The integer must belong to the innermost scope of the current thread
+   if(mpiArena.top == NULL || mpiArena.buffer == NULL)
+      return FALSE;
+
+   //Generation numbers are only unique within a thread. An integer handed
+   //over to another thread (e.g. to a worker pool) must not be adopted by a
+   //scope of that thread that happens to have the same generation number
+   if(r->arena != &mpiArena)
+      return FALSE;
+
+   //The ownership is checked against the generation number of the scope
+   if(r->scope == 0 || r->scope != mpiArena.top->generation)
+      return FALSE;
+
+   //Current and desired sizes, in bytes
+   m = r->size * MPI_INT_SIZE;
+   n = size * MPI_INT_SIZE;
+
+   //Check whether the current buffer is the last block allocated from
+   //the arena
+   if(r->scratch && (uint8_t *) r->data + m == mpiArena.buffer +
+      mpiArena.offset)
+   {
+      //Not enough room in the arena?
+      if((n - m) > (MPI_ARENA_SIZE - mpiArena.offset))
+         return FALSE;
+
+      //The buffer can be extended in place
+      data = r->data;
+      mpiArena.offset += n - m;
+   }
+   else
+   {
+      //Not enough room in the arena?
+      if(n > (MPI_ARENA_SIZE - mpiArena.offset))
+         return FALSE;
+
+      //Bump-allocate a new buffer
+      data = (uint_t *) (mpiArena.buffer + mpiArena.offset);
+      mpiArena.offset += n;
+
+      //Any data to copy?
+      if(r->size > 0)
+      {
+         //Copy original data
+         osMemcpy(data, r->data, m);
+
+         //Release old memory buffer
+         osMemset(r->data, 0, m);
+         mpiArenaFreeData(r);
+      }
+   }
+
+   //Clear upper words
+   osMemset(data + r->size, 0, n - m);
+
+   //Attach new memory buffer
+   r->data = data;
+   r->size = size;
+   r->scratch = TRUE;
+
+   //The memory was taken from the arena
+   return TRUE;
+}
+
+#endif
+
 
 /**
  * @brief Initialize a multiple precision integer
@@ -53,6 +307,22 @@ void mpiInit(Mpi *r)
 #if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
    r->data = NULL;
 #endif
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //The integer is attached to the innermost scope of the current thread
+   if(mpiArena.top != NULL)
+   {
+      r->arena = &mpiArena;
+      r->scope = mpiArena.top->generation;
+   }
+   else
+   {
+      r->arena = NULL;
+      r->scope = 0;
+   }
+
+   r->scratch = FALSE;
+#endif
 }
 
 
@@ -70,8 +340,13 @@ void mpiFree(Mpi *r)
       //Erase contents
       osMemset(r->data, 0, r->size * MPI_INT_SIZE);
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+      //Release memory buffer
+      mpiArenaFreeData(r);
+#else
       //Release memory buffer
       cryptoFreeMem(r->data);
+#endif
       r->data = NULL;
    }
 #else
@@ -107,6 +382,13 @@ error_t mpiGrow(Mpi *r, uint_t size)
    //Check whether the size of the multiple precision integer must be increased
    if(size > r->size)
    {
+#if (MPI_ARENA_SUPPORT == ENABLED)
+      //Integers initialized within a scope are preferably allocated from the
+      //scratch arena
+      if(mpiArenaGrow(r, size))
+         return NO_ERROR;
+#endif
+
 #if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
       //Allocate a new memory buffer
       data = cryptoAllocMem(size * MPI_INT_SIZE);
@@ -122,13 +404,20 @@ error_t mpiGrow(Mpi *r, uint_t size)
 
             //Release old memory buffer
             osMemset(r->data, 0, r->size * MPI_INT_SIZE);
+#if (MPI_ARENA_SUPPORT == ENABLED)
+            mpiArenaFreeData(r);
+#else
             cryptoFreeMem(r->data);
+#endif
          }
 
          //Clear upper words
          osMemset(data + r->size, 0, (size - r->size) * MPI_INT_SIZE);
          //Attach new memory buffer
          r->data = data;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+         r->scratch = FALSE;
+#endif
          //Update the size of the multiple precision integer
          r->size = size;
       }
@@ -597,97 +886,188 @@ end:
 
 
 /**
- * @brief Test whether a number is probable prime
- * @param[in] a Pointer to a multiple precision integer
- * @return Error code
+ * @brief Compute the remainder of the division of A by a single word
+ * @param[in] a The multiple precision integer (non-negative)
+ * @param[in] p The divisor (nonzero)
+ * @return The remainder A mod p
  **/
 
-__weak_func error_t mpiCheckProbablePrime(const Mpi *a)
+static uint_t mpiModWord(const Mpi *a, uint_t p)
 {
-   //The algorithm is implemented by hardware
-   return ERROR_NOT_IMPLEMENTED;
+   uint_t i;
+   uint64_t r;
+
+   //Horner's method, starting with the most significant word
+   for(r = 0, i = mpiGetLength(a); i > 0; i--)
+   {
+      r = ((r << 32) | a->data[i - 1]) % p;
+   }
+
+   //Return the remainder
+   return (uint_t) r;
 }
 
 
 /**
- * @brief Octet string to integer conversion
+ * @brief Test whether a number is probable prime
  *
- * Converts an octet string to a non-negative integer
+ * Trial division by the small primes is followed by Miller-Rabin rounds. The
+ * number of rounds is taken from FIPS 186-5 (table B.1) and assumes that the
+ * number has been randomly generated. The bases are chosen at random in the
+ * range 2 to a - 2, as required by FIPS 186-5 (section B.3.1)
  *
- * @param[out] r Non-negative integer resulting from the conversion
- * @param[in] data Octet string to be converted
- * @param[in] length Length of the octet string
- * @param[in] format Input format
- * @return Error code
+ * @param[in] a Pointer to a multiple precision integer
+ * @param[in] prngAlgo PRNG algorithm
+ * @param[in] prngContext Pointer to the PRNG context
+ * @return NO_ERROR if the number is a probable prime, ERROR_INVALID_VALUE if
+ *   it is composite, or another error code
  **/
 
-error_t mpiImport(Mpi *r, const uint8_t *data, uint_t length, MpiFormat format)
+__weak_func error_t mpiCheckProbablePrime(const Mpi *a,
+   const PrngAlgo *prngAlgo, void *prngContext)
 {
    error_t error;
    uint_t i;
+   uint_t j;
+   uint_t s;
+   uint_t t;
+   uint_t n;
+   Mpi b;
+   Mpi d;
+   Mpi m;
+   Mpi x;
+#if (MPI_MONT_SUPPORT == ENABLED)
+   MpiMontCache cache;
+#endif
 
-   //Check input format
-   if(format == MPI_FORMAT_LITTLE_ENDIAN)
+   //Check parameters
+   if(a == NULL || prngAlgo == NULL || prngContext == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Negative numbers, 0 and 1 are not prime
+   if(mpiCompInt(a, 2) < 0)
+      return ERROR_INVALID_VALUE;
+
+   //2 is the only even prime
+   if(!mpiIsOdd(a))
+      return (mpiCompInt(a, 2) == 0) ? NO_ERROR : ERROR_INVALID_VALUE;
+
+   //Get the actual length of the number, in bits
+   n = mpiGetBitLength(a);
+
+   //Trial division by the small primes
+   for(i = 0; i < arraysize(mpiSmallPrimes); i++)
    {
-      //Skip trailing zeroes
-      while(length > 0 && data[length - 1] == 0)
+      //Check whether the number is a multiple of the current prime
+      if(mpiModWord(a, mpiSmallPrimes[i]) == 0)
       {
-         length--;
+         return (mpiCompInt(a, mpiSmallPrimes[i]) == 0) ? NO_ERROR :
+            ERROR_INVALID_VALUE;
       }
+   }
 
-      //Ajust the size of the multiple precision integer
-      error = mpiGrow(r, (length + MPI_INT_SIZE - 1) / MPI_INT_SIZE);
-
-      //Check status code
-      if(!error)
-      {
-         //Clear the contents of the multiple precision integer
-         osMemset(r->data, 0, r->size * MPI_INT_SIZE);
-         //Set sign
-         r->sign = 1;
+   //Any number below 2048^2 that has no small factor is prime
+   if(n <= 21)
+      return NO_ERROR;
 
-         //Import data
-         for(i = 0; i < length; i++, data++)
-         {
-            r->data[i / MPI_INT_SIZE] |= *data << ((i % MPI_INT_SIZE) * 8);
-         }
-      }
+   //Select the number of Miller-Rabin rounds
+   if(n >= 1536)
+   {
+      t = 4;
    }
-   else if(format == MPI_FORMAT_BIG_ENDIAN)
+   else if(n >= 1024)
    {
-      //Skip leading zeroes
-      while(length > 1 && *data == 0)
-      {
-         data++;
-         length--;
-      }
+      t = 5;
+   }
+   else if(n >= 512)
+   {
+      t = 7;
+   }
+   else
+   {
+      t = 40;
+   }
 
-      //Ajust the size of the multiple precision integer
-      error = mpiGrow(r, (length + MPI_INT_SIZE - 1) / MPI_INT_SIZE);
+   //Initialize multiple precision integers
+   mpiInit(&b);
+   mpiInit(&d);
+   mpiInit(&m);
+   mpiInit(&x);
 
-      //Check status code
-      if(!error)
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //The Montgomery context is shared by all the rounds
+   mpiMontInitCache(&cache);
+#endif
+
+   //Let m = a - 1
+   MPI_CHECK(mpiSubInt(&m, a, 1));
+
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Precompute the Montgomery context associated with the number
+   MPI_CHECK(mpiMontPrecompute(&cache, a));
+#endif
+
+   //Write a - 1 as 2^s * d, where d is odd
+   for(s = 0; !mpiGetBitValue(&m, s); s++)
+   {
+   }
+
+   MPI_CHECK(mpiCopy(&d, &m));
+   MPI_CHECK(mpiShiftRight(&d, s));
+
+   //Miller-Rabin rounds
+   for(i = 0; i < t && !error; i++)
+   {
+      //Select a random base in the range 2 to a - 2
+      MPI_CHECK(mpiSubInt(&x, &m, 1));
+      MPI_CHECK(mpiRandRange(&b, &x, prngAlgo, prngContext));
+      MPI_CHECK(mpiAddInt(&b, &b, 1));
+
+#if (MPI_MONT_SUPPORT == ENABLED)
+      //Compute x = b ^ d mod a
+      MPI_CHECK(mpiExpModRegularCached(&x, &b, &d, a, &cache));
+#else
+      //Compute x = b ^ d mod a
+      MPI_CHECK(mpiExpModRegular(&x, &b, &d, a));
+#endif
+
+      //The round is passed if x = 1 or x = a - 1
+      if(mpiCompInt(&x, 1) != 0 && mpiComp(&x, &m) != 0)
       {
-         //Clear the contents of the multiple precision integer
-         osMemset(r->data, 0, r->size * MPI_INT_SIZE);
-         //Set sign
-         r->sign = 1;
+         //Square x up to s - 1 times, until x = a - 1
+         for(j = 1; j < s; j++)
+         {
+            //Compute x = x ^ 2 mod a
+            MPI_CHECK(mpiMulMod(&x, &x, &x, a));
 
-         //Start from the least significant byte
-         data += length - 1;
+            //a - 1 has been reached?
+            if(mpiComp(&x, &m) == 0)
+               break;
 
-         //Import data
-         for(i = 0; i < length; i++, data--)
+            //1 cannot be reached without going through a - 1
+            if(mpiCompInt(&x, 1) == 0)
+               j = s;
+         }
+
+         //The number is composite if a - 1 has not been reached
+         if(j >= s)
          {
-            r->data[i / MPI_INT_SIZE] |= *data << ((i % MPI_INT_SIZE) * 8);
+            error = ERROR_INVALID_VALUE;
          }
       }
    }
-   else
-   {
-      //Report an error
-      error = ERROR_INVALID_PARAMETER;
-   }
+
+end:
+   //Release multiple precision integers
+   mpiFree(&b);
+   mpiFree(&d);
+   mpiFree(&m);
+   mpiFree(&x);
+
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Release Montgomery context
+   mpiMontFreeCache(&cache);
+#endif
 
    //Return status code
    return error;
@@ -695,37 +1075,257 @@ error_t mpiImport(Mpi *r, const uint8_t *data, uint_t length, MpiFormat format)
 
 
 /**
- * @brief Integer to octet string conversion
+ * @brief Search for a probable prime in a given range
  *
- * Converts an integer to an octet string of a specified length
+ * The search starts at R and goes through the odd numbers in increasing
+ * order, wrapping around to A when B is exceeded. Candidates are sieved
+ * against the small primes using their residues, so that only a small
+ * fraction of them goes through the Miller-Rabin test
  *
- * @param[in] a Non-negative integer to be converted
- * @param[out] data Octet string resulting from the conversion
- * @param[in] length Intended length of the resulting octet string
- * @param[in] format Output format
+ * @param[in,out] r On entry, the starting point of the search. On exit, the
+ *   resulting probable prime
+ * @param[in] a Lower bound of the range
+ * @param[in] b Upper bound of the range
+ * @param[in] e If greater than 1, candidates such that r mod e = 1 are
+ *   skipped (RSA public exponent)
+ * @param[in] prngAlgo PRNG algorithm (Miller-Rabin bases)
+ * @param[in] prngContext Pointer to the PRNG context
  * @return Error code
  **/
 
-error_t mpiExport(const Mpi *a, uint8_t *data, uint_t length, MpiFormat format)
+error_t mpiSearchProbablePrime(Mpi *r, const Mpi *a, const Mpi *b, uint_t e,
+   const PrngAlgo *prngAlgo, void *prngContext)
 {
+   error_t error;
    uint_t i;
    uint_t n;
-   error_t error;
+   uint_t delta;
+   uint_t re;
+   bool_t wrapped;
+   uint16_t mods[arraysize(mpiSmallPrimes)];
+   Mpi c;
 
-   //Initialize status code
-   error = NO_ERROR;
+   //Check parameters
+   if(mpiCompInt(a, 2) < 0 || mpiComp(a, b) > 0)
+      return ERROR_INVALID_PARAMETER;
 
-   //Check input format
-   if(format == MPI_FORMAT_LITTLE_ENDIAN)
+   //Initialize multiple precision integer
+   mpiInit(&c);
+
+   //The starting point must lie in the range
+   if(mpiComp(r, a) < 0 || mpiComp(r, b) > 0)
    {
-      //Get the actual length in bytes
-      n = mpiGetByteLength(a);
+      MPI_CHECK(mpiCopy(r, a));
+   }
 
-      //Make sure the output buffer is large enough
-      if(n <= length)
-      {
-         //Clear output buffer
-         osMemset(data, 0, length);
+   //Only odd candidates are considered
+   MPI_CHECK(mpiSetBitValue(r, 0, 1));
+
+   //Search for a probable prime
+   for(error = ERROR_INVALID_VALUE, wrapped = FALSE;
+      error == ERROR_INVALID_VALUE; )
+   {
+      //Compute the residues of the current base value
+      for(i = 0; i < arraysize(mpiSmallPrimes); i++)
+      {
+         mods[i] = (uint16_t) mpiModWord(r, mpiSmallPrimes[i]);
+      }
+
+      //Residue modulo the public exponent
+      re = (e > 1) ? mpiModWord(r, e) : 0;
+
+      //A candidate that has a small factor is composite, unless it is
+      //the small prime itself
+      n = (mpiGetBitLength(r) > 11) ? arraysize(mpiSmallPrimes) : 0;
+
+      //Scan the candidates r, r + 2, r + 4...
+      for(delta = 0; delta < MPI_PRIME_SIEVE_RANGE; delta += 2)
+      {
+         //Sieve out the candidates that have a small factor
+         for(i = 0; i < n && ((mods[i] + delta) % mpiSmallPrimes[i]) != 0; i++)
+         {
+         }
+
+         //Candidate rejected by the sieve?
+         if(i < n)
+            continue;
+
+         //Skip the candidates such that c mod e = 1
+         if(e > 1 && ((re + delta) % e) == 1)
+            continue;
+
+         //Let c = r + delta
+         MPI_CHECK(mpiAddInt(&c, r, delta));
+
+         //The upper bound of the range has been exceeded?
+         if(mpiComp(&c, b) > 0)
+            break;
+
+         //Perform Miller-Rabin test
+         error = mpiCheckProbablePrime(&c, prngAlgo, prngContext);
+
+         //Exit immediately if a probable prime has been found
+         if(error != ERROR_INVALID_VALUE)
+            break;
+      }
+
+      //Check status code
+      if(error == ERROR_INVALID_VALUE)
+      {
+         //Range of offsets exhausted?
+         if(delta >= MPI_PRIME_SIEVE_RANGE)
+         {
+            //Continue the search from the next candidate
+            MPI_CHECK(mpiAddInt(r, r, delta));
+         }
+         else if(!wrapped)
+         {
+            //Wrap around to the lower bound of the range
+            MPI_CHECK(mpiCopy(r, a));
+            MPI_CHECK(mpiSetBitValue(r, 0, 1));
+            wrapped = TRUE;
+         }
+         else
+         {
+            //The range does not contain any suitable prime
+            error = ERROR_FAILURE;
+         }
+      }
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Return the resulting probable prime
+      MPI_CHECK(mpiCopy(r, &c));
+   }
+
+end:
+   //Release multiple precision integer
+   mpiFree(&c);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Octet string to integer conversion
+ *
+ * Converts an octet string to a non-negative integer
+ *
+ * @param[out] r Non-negative integer resulting from the conversion
+ * @param[in] data Octet string to be converted
+ * @param[in] length Length of the octet string
+ * @param[in] format Input format
+ * @return Error code
+ **/
+
+error_t mpiImport(Mpi *r, const uint8_t *data, uint_t length, MpiFormat format)
+{
+   error_t error;
+   uint_t i;
+
+   //Check input format
+   if(format == MPI_FORMAT_LITTLE_ENDIAN)
+   {
+      //Skip trailing zeroes
+      while(length > 0 && data[length - 1] == 0)
+      {
+         length--;
+      }
+
+      //Ajust the size of the multiple precision integer
+      error = mpiGrow(r, (length + MPI_INT_SIZE - 1) / MPI_INT_SIZE);
+
+      //Check status code
+      if(!error)
+      {
+         //Clear the contents of the multiple precision integer
+         osMemset(r->data, 0, r->size * MPI_INT_SIZE);
+         //Set sign
+         r->sign = 1;
+
+         //Import data
+         for(i = 0; i < length; i++, data++)
+         {
+            r->data[i / MPI_INT_SIZE] |= *data << ((i % MPI_INT_SIZE) * 8);
+         }
+      }
+   }
+   else if(format == MPI_FORMAT_BIG_ENDIAN)
+   {
+      //Skip leading zeroes
+      while(length > 1 && *data == 0)
+      {
+         data++;
+         length--;
+      }
+
+      //Ajust the size of the multiple precision integer
+      error = mpiGrow(r, (length + MPI_INT_SIZE - 1) / MPI_INT_SIZE);
+
+      //Check status code
+      if(!error)
+      {
+         //Clear the contents of the multiple precision integer
+         osMemset(r->data, 0, r->size * MPI_INT_SIZE);
+         //Set sign
+         r->sign = 1;
+
+         //Start from the least significant byte
+         data += length - 1;
+
+         //Import data
+         for(i = 0; i < length; i++, data--)
+         {
+            r->data[i / MPI_INT_SIZE] |= *data << ((i % MPI_INT_SIZE) * 8);
+         }
+      }
+   }
+   else
+   {
+      //Report an error
+      error = ERROR_INVALID_PARAMETER;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Integer to octet string conversion
+ *
+ * Converts an integer to an octet string of a specified length
+ *
+ * @param[in] a Non-negative integer to be converted
+ * @param[out] data Octet string resulting from the conversion
+ * @param[in] length Intended length of the resulting octet string
+ * @param[in] format Output format
+ * @return Error code
+ **/
+
+error_t mpiExport(const Mpi *a, uint8_t *data, uint_t length, MpiFormat format)
+{
+   uint_t i;
+   uint_t n;
+   error_t error;
+
+   //Initialize status code
+   error = NO_ERROR;
+
+   //Check input format
+   if(format == MPI_FORMAT_LITTLE_ENDIAN)
+   {
+      //Get the actual length in bytes
+      n = mpiGetByteLength(a);
+
+      //Make sure the output buffer is large enough
+      if(n <= length)
+      {
+         //Clear output buffer
+         osMemset(data, 0, length);
 
          //Export data
          for(i = 0; i < n; i++, data++)
@@ -1226,8 +1826,77 @@ error_t mpiShiftRight(Mpi *r, uint_t n)
 }
 
 
+/**
+ * @brief Multiplication of large operands (Karatsuba algorithm)
+ * @param[out] r Resulting integer R = A * B
+ * @param[in] a First operand A
+ * @param[in] b Second operand B
+ * @param[in] n Size of the operands, in words
+ * @return Error code
+ **/
+
+static error_t mpiMulLarge(Mpi *r, const Mpi *a, const Mpi *b, uint_t n)
+{
+   error_t error;
+   uint_t *ta;
+   uint_t *tb;
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   uint_t *buffer;
+#else
+   uint_t buffer[2 * MPI_MAX_INT_SIZE + MPI_MUL_CORE_SCRATCH_SIZE(MPI_MAX_INT_SIZE)];
+#endif
+
+   //Adjust the size of R
+   error = mpiGrow(r, 2 * n);
+   //Any error to report?
+   if(error)
+      return error;
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Allocate a buffer to hold the operands and the scratch area
+   buffer = cryptoAllocMem((2 * n + MPI_MUL_CORE_SCRATCH_SIZE(n)) * MPI_INT_SIZE);
+   //Failed to allocate memory?
+   if(buffer == NULL)
+      return ERROR_OUT_OF_MEMORY;
+#endif
+
+   //Zero-extend A and B to n words
+   ta = buffer;
+   tb = buffer + n;
+   osMemset(buffer, 0, 2 * n * MPI_INT_SIZE);
+   osMemcpy(ta, a->data, mpiGetLength(a) * MPI_INT_SIZE);
+   osMemcpy(tb, b->data, mpiGetLength(b) * MPI_INT_SIZE);
+
+   //Squaring operation?
+   if(a == b)
+   {
+      tb = ta;
+   }
+
+   //Compute R = A * B
+   mpiMulCore(r->data, ta, tb, n, buffer + 2 * n);
+   //Clear upper words
+   osMemset(r->data + 2 * n, 0, (r->size - 2 * n) * MPI_INT_SIZE);
+
+   //Erase temporary values
+   osMemset(buffer, 0, (2 * n + MPI_MUL_CORE_SCRATCH_SIZE(n)) * MPI_INT_SIZE);
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Release previously allocated memory
+   cryptoFreeMem(buffer);
+#endif
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
 /**
  * @brief Multiple precision multiplication
+ *
+ * Squarings (A and B are the same instance) are processed by mpiSqr. Since
+ * the hardware ports override this function, they also handle squarings
+ *
  * @param[out] r Resulting integer R = A * B
  * @param[in] a First operand A
  * @param[in] b Second operand B
@@ -1243,6 +1912,13 @@ __weak_func error_t mpiMul(Mpi *r, const Mpi *a, const Mpi *b)
    Mpi ta;
    Mpi tb;
 
+   //Squaring operation?
+   if(a == b)
+   {
+      //Perform squaring
+      return mpiSqr(r, a);
+   }
+
    //Initialize multiple precision integers
    mpiInit(&ta);
    mpiInit(&tb);
@@ -1269,6 +1945,17 @@ __weak_func error_t mpiMul(Mpi *r, const Mpi *a, const Mpi *b)
    m = mpiGetLength(a);
    n = mpiGetLength(b);
 
+   //Large operands of similar length are processed using Karatsuba algorithm
+   if(MIN(m, n) >= MPI_KARATSUBA_THRESHOLD && MAX(m, n) < (2 * MIN(m, n)))
+   {
+      //Perform multiplication
+      MPI_CHECK(mpiMulLarge(r, a, b, MAX(m, n)));
+      //Set the sign of R
+      r->sign = (a->sign == b->sign) ? 1 : -1;
+      //Exit immediately
+      goto end;
+   }
+
    //Adjust the size of R
    MPI_CHECK(mpiGrow(r, m + n));
    //Set the sign of R
@@ -1303,6 +1990,67 @@ end:
 }
 
 
+/**
+ * @brief Multiple precision squaring
+ *
+ * This function is called by the software implementation of mpiMul. Use
+ * mpiMul(r, a, a) so that the hardware accelerators are used when available
+ *
+ * @param[out] r Resulting integer R = A^2
+ * @param[in] a The operand A
+ * @return Error code
+ **/
+
+error_t mpiSqr(Mpi *r, const Mpi *a)
+{
+   error_t error;
+   uint_t n;
+   Mpi ta;
+
+   //Initialize multiple precision integer
+   mpiInit(&ta);
+
+   //R and A are the same instance?
+   if(r == a)
+   {
+      //Copy A to TA
+      MPI_CHECK(mpiCopy(&ta, a));
+      //Use TA instead of A
+      a = &ta;
+   }
+
+   //Determine the actual length of A
+   n = mpiGetLength(a);
+
+   //Large operands are processed using Karatsuba algorithm
+   if(n >= MPI_KARATSUBA_THRESHOLD)
+   {
+      //Perform squaring
+      MPI_CHECK(mpiMulLarge(r, a, a, n));
+   }
+   else
+   {
+      //Adjust the size of R
+      MPI_CHECK(mpiGrow(r, 2 * n));
+
+      //Clear the contents of the destination integer
+      osMemset(r->data, 0, r->size * MPI_INT_SIZE);
+      //Perform squaring
+      mpiSqrCore(r->data, a->data, n);
+   }
+
+   //The result is always positive
+   r->sign = 1;
+
+end:
+   //Release multiple precision integer
+   mpiFree(&ta);
+
+   //Return status code
+   return error;
+}
+
+
 /**
  * @brief Multiply a multiple precision integer by an integer
  * @param[out] r Resulting integer R = A * B
@@ -1584,6 +2332,14 @@ __weak_func error_t mpiInvMod(Mpi *r, const Mpi *a, const Mpi *p)
    Mpi t;
    Mpi u;
    Mpi v;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
 
    //Initialize multiple precision integers
    mpiInit(&b);
@@ -1636,15 +2392,740 @@ end:
    mpiFree(&u);
    mpiFree(&v);
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
    //Return status code
    return error;
 }
 
-
 /**
- * @brief Modular exponentiation
- * @param[out] r Resulting integer R = A ^ E mod P
- * @param[in] a Pointer to a multiple precision integer
+ * @brief Modular inverse of several integers
+ *
+ * Montgomery's trick is used, so that the whole batch costs a single modular
+ * inversion and 3.(n - 1) modular multiplications
+ *
+ * @param[out] r Resulting integers R[i] = A[i]^-1 mod P (must not overlap A)
+ * @param[in] a Integers A[0], ..., A[n - 1] to be inverted
+ * @param[in] n Number of integers
+ * @param[in] p The modulus P
+ * @return Error code
+ **/
+
+error_t mpiInvModBatch(Mpi *r, const Mpi *a, uint_t n, const Mpi *p)
+{
+   error_t error;
+   uint_t i;
+   Mpi b;
+   Mpi c;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
+
+   //Empty batch?
+   if(n == 0)
+      return NO_ERROR;
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
+
+   //Initialize multiple precision integers
+   mpiInit(&b);
+   mpiInit(&c);
+
+   //Compute the partial products R[i] = A[0] * ... * A[i] mod P
+   MPI_CHECK(mpiMod(&r[0], &a[0], p));
+
+   for(i = 1; i < n; i++)
+   {
+      MPI_CHECK(mpiMulMod(&r[i], &r[i - 1], &a[i], p));
+   }
+
+   //Compute b = 1 / (A[0] * ... * A[n - 1]) mod P. The inversion fails if
+   //one of the integers is not invertible
+   MPI_CHECK(mpiInvModRegular(&b, &r[n - 1], p));
+
+   //Retrieve the inverse of each integer, starting with the last one
+   for(i = n - 1; i > 0; i--)
+   {
+      //Compute c = 1 / A[i] = b * (A[0] * ... * A[i - 1]) mod P
+      MPI_CHECK(mpiMulMod(&c, &b, &r[i - 1], p));
+      //Compute b = 1 / (A[0] * ... * A[i - 1]) mod P
+      MPI_CHECK(mpiMulMod(&b, &b, &a[i], p));
+      //Save the inverse of A[i]
+      MPI_CHECK(mpiCopy(&r[i], &c));
+   }
+
+   //Inverse of the first integer
+   MPI_CHECK(mpiCopy(&r[0], &b));
+
+end:
+   //Release multiple precision integers
+   mpiFree(&b);
+   mpiFree(&c);
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
+   //Return status code
+   return error;
+}
+
+/**
+ * @brief Convert an integer to signed 30-bit limbs
+ * @param[out] r Limbs of the integer, least significant first
+ * @param[in] a Non-negative integer A
+ * @param[in] n Number of limbs
+ **/
+
+static void mpiImportLimbs(int32_t *r, const Mpi *a, uint_t n)
+{
+   uint_t i;
+   uint_t j;
+   uint_t k;
+   uint64_t acc;
+
+   //Repack the words of A, 30 bits at a time
+   for(acc = 0, j = 0, k = 0, i = 0; i < n; i++)
+   {
+      //Make sure the accumulator holds at least 30 bits
+      if(j < MPI_INV_LIMB_BITS && k < a->size)
+      {
+         acc |= (uint64_t) a->data[k++] << j;
+         j += 32;
+      }
+
+      //Extract the next limb
+      r[i] = (int32_t) (acc & MPI_INV_LIMB_MASK);
+      acc >>= MPI_INV_LIMB_BITS;
+      j = (j > MPI_INV_LIMB_BITS) ? j - MPI_INV_LIMB_BITS : 0;
+   }
+}
+
+
+/**
+ * @brief Convert normalized signed 30-bit limbs to an integer
+ * @param[out] r Resulting integer R
+ * @param[in] a Limbs of the integer, all in range [0, 2^30)
+ * @param[in] n Number of limbs
+ * @param[in] size Length of the result, in words
+ * @return Error code
+ **/
+
+static error_t mpiExportLimbs(Mpi *r, const int32_t *a, uint_t n, uint_t size)
+{
+   error_t error;
+   uint_t i;
+   uint_t j;
+   uint_t k;
+   uint64_t acc;
+
+   //Adjust the size of R
+   error = mpiGrow(r, size);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Clear the words of R
+   osMemset(r->data, 0, r->size * MPI_INT_SIZE);
+
+   //Repack the limbs, 32 bits at a time
+   for(acc = 0, j = 0, k = 0, i = 0; i < n; i++)
+   {
+      acc |= (uint64_t) (uint32_t) a[i] << j;
+      j += MPI_INV_LIMB_BITS;
+
+      //Flush the accumulator as soon as a full word is available
+      if(j >= 32)
+      {
+         if(k < size)
+         {
+            r->data[k++] = (uint_t) acc;
+         }
+
+         acc >>= 32;
+         j -= 32;
+      }
+   }
+
+   //Flush the remaining bits
+   if(k < size)
+   {
+      r->data[k] = (uint_t) acc;
+   }
+
+   //The result is always positive
+   r->sign = 1;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Apply 30 divsteps to the least significant limbs of f and g
+ *
+ * The transition matrix t is scaled by 2^30, so that
+ * 2^30.(f', g') = (t[0].f + t[1].g, t[2].f + t[3].g). The sequence of
+ * operations does not depend on the values of f and g
+ *
+ * @param[in] eta Opposite of the delta variable of the divstep function
+ * @param[in] f0 Least significant bits of f (odd)
+ * @param[in] g0 Least significant bits of g
+ * @param[out] t Transition matrix
+ * @return Updated value of eta
+ **/
+
+static int32_t mpiDivsteps(int32_t eta, uint32_t f0, uint32_t g0, int32_t *t)
+{
+   uint_t i;
+   uint32_t f;
+   uint32_t g;
+   uint32_t u;
+   uint32_t v;
+   uint32_t q;
+   uint32_t r;
+   uint32_t c1;
+   uint32_t c2;
+   uint32_t x;
+   uint32_t y;
+   uint32_t z;
+
+   //Start with the identity matrix
+   f = f0;
+   g = g0;
+   u = 1;
+   v = 0;
+   q = 0;
+   r = 1;
+
+   for(i = 0; i < MPI_INV_LIMB_BITS; i++)
+   {
+      //c1 is set when delta > 0, c2 is set when g is odd
+      c1 = (uint32_t) (eta >> 31);
+      c2 = 0U - (g & 1);
+
+      //Compute (x, y, z) = -(f, u, v) if delta > 0, or (f, u, v) otherwise
+      x = (f ^ c1) - c1;
+      y = (u ^ c1) - c1;
+      z = (v ^ c1) - c1;
+
+      //Add (x, y, z) to (g, q, r) if g is odd
+      g += x & c2;
+      q += y & c2;
+      r += z & c2;
+
+      //The operands are swapped if delta > 0 and g is odd
+      c1 &= c2;
+
+      //Compute delta = 1 - delta if swapped, or delta = 1 + delta otherwise
+      eta = (int32_t) (((uint32_t) eta ^ c1) - c1) - 1;
+
+      //Swap by adding the new g to f (f + (g - f) = g)
+      f += g & c1;
+      u += q & c1;
+      v += r & c1;
+
+      //Divide g by 2. The scaled matrix is doubled instead
+      g >>= 1;
+      u <<= 1;
+      v <<= 1;
+   }
+
+   //Save the transition matrix
+   t[0] = (int32_t) u;
+   t[1] = (int32_t) v;
+   t[2] = (int32_t) q;
+   t[3] = (int32_t) r;
+
+   //Return the updated value of eta
+   return eta;
+}
+
+
+/**
+ * @brief Apply a transition matrix to f and g
+ * @param[in,out] f Limbs of f
+ * @param[in,out] g Limbs of g
+ * @param[in] t Transition matrix (scaled by 2^30)
+ * @param[in] n Number of limbs
+ **/
+
+static void mpiUpdateFg(int32_t *f, int32_t *g, const int32_t *t, uint_t n)
+{
+   uint_t i;
+   int64_t cf;
+   int64_t cg;
+
+   //The 30 least significant bits of the products are zero
+   cf = (int64_t) t[0] * f[0] + (int64_t) t[1] * g[0];
+   cg = (int64_t) t[2] * f[0] + (int64_t) t[3] * g[0];
+   cf >>= MPI_INV_LIMB_BITS;
+   cg >>= MPI_INV_LIMB_BITS;
+
+   //Compute the remaining limbs, shifted down by 30 bits
+   for(i = 1; i < n; i++)
+   {
+      cf += (int64_t) t[0] * f[i] + (int64_t) t[1] * g[i];
+      cg += (int64_t) t[2] * f[i] + (int64_t) t[3] * g[i];
+      f[i - 1] = (int32_t) (cf & MPI_INV_LIMB_MASK);
+      g[i - 1] = (int32_t) (cg & MPI_INV_LIMB_MASK);
+      cf >>= MPI_INV_LIMB_BITS;
+      cg >>= MPI_INV_LIMB_BITS;
+   }
+
+   //The most significant limbs carry the sign
+   f[n - 1] = (int32_t) cf;
+   g[n - 1] = (int32_t) cg;
+}
+
+
+/**
+ * @brief Apply a transition matrix to d and e, modulo P
+ *
+ * A multiple of P is added to each product so that it can be divided
+ * by 2^30. d and e remain in range (-2P, P)
+ *
+ * @param[in,out] d Limbs of d
+ * @param[in,out] e Limbs of e
+ * @param[in] t Transition matrix (scaled by 2^30)
+ * @param[in] p Limbs of the modulus P
+ * @param[in] pInv P^-1 mod 2^30
+ * @param[in] n Number of limbs
+ **/
+
+static void mpiUpdateDe(int32_t *d, int32_t *e, const int32_t *t,
+   const int32_t *p, uint32_t pInv, uint_t n)
+{
+   uint_t i;
+   int32_t sd;
+   int32_t se;
+   int32_t md;
+   int32_t me;
+   int64_t cd;
+   int64_t ce;
+
+   //Add P.(t[0], t[2]) if d is negative, and P.(t[1], t[3]) if e is negative
+   sd = d[n - 1] >> 31;
+   se = e[n - 1] >> 31;
+   md = (t[0] & sd) + (t[1] & se);
+   me = (t[2] & sd) + (t[3] & se);
+
+   //Compute the least significant limbs of the products
+   cd = (int64_t) t[0] * d[0] + (int64_t) t[1] * e[0];
+   ce = (int64_t) t[2] * d[0] + (int64_t) t[3] * e[0];
+
+   //Adjust md and me so that the 30 least significant bits become zero
+   md -= (int32_t) ((pInv * (uint32_t) cd + (uint32_t) md) & MPI_INV_LIMB_MASK);
+   me -= (int32_t) ((pInv * (uint32_t) ce + (uint32_t) me) & MPI_INV_LIMB_MASK);
+
+   cd += (int64_t) p[0] * md;
+   ce += (int64_t) p[0] * me;
+   cd >>= MPI_INV_LIMB_BITS;
+   ce >>= MPI_INV_LIMB_BITS;
+
+   //Compute the remaining limbs, shifted down by 30 bits
+   for(i = 1; i < n; i++)
+   {
+      cd += (int64_t) t[0] * d[i] + (int64_t) t[1] * e[i] + (int64_t) p[i] * md;
+      ce += (int64_t) t[2] * d[i] + (int64_t) t[3] * e[i] + (int64_t) p[i] * me;
+      d[i - 1] = (int32_t) (cd & MPI_INV_LIMB_MASK);
+      e[i - 1] = (int32_t) (ce & MPI_INV_LIMB_MASK);
+      cd >>= MPI_INV_LIMB_BITS;
+      ce >>= MPI_INV_LIMB_BITS;
+   }
+
+   //The most significant limbs carry the sign
+   d[n - 1] = (int32_t) cd;
+   e[n - 1] = (int32_t) ce;
+}
+
+
+/**
+ * @brief Bring an integer from range (-2P, P) to range [0, P)
+ * @param[in,out] r Limbs of the integer
+ * @param[in] sign The integer is negated if this value is negative
+ * @param[in] p Limbs of the modulus P
+ * @param[in] n Number of limbs
+ **/
+
+static void mpiNormalizeLimbs(int32_t *r, int32_t sign, const int32_t *p,
+   uint_t n)
+{
+   uint_t i;
+   int32_t c1;
+   int32_t c2;
+
+   //Add P if R is negative, then negate R if requested
+   c1 = r[n - 1] >> 31;
+   c2 = sign >> 31;
+
+   for(i = 0; i < n; i++)
+   {
+      r[i] += p[i] & c1;
+      r[i] = (r[i] ^ c2) - c2;
+   }
+
+   //Propagate the carries
+   for(i = 1; i < n; i++)
+   {
+      r[i] += r[i - 1] >> MPI_INV_LIMB_BITS;
+      r[i - 1] &= MPI_INV_LIMB_MASK;
+   }
+
+   //Add P again if R is still negative
+   c1 = r[n - 1] >> 31;
+
+   for(i = 0; i < n; i++)
+   {
+      r[i] += p[i] & c1;
+   }
+
+   //Propagate the carries
+   for(i = 1; i < n; i++)
+   {
+      r[i] += r[i - 1] >> MPI_INV_LIMB_BITS;
+      r[i - 1] &= MPI_INV_LIMB_MASK;
+   }
+}
+
+
+/**
+ * @brief Regular modular inverse (odd modulus)
+ * @param[out] r Resulting integer R = A^-1 mod P
+ * @param[in] a An integer A such as 0 <= A < P
+ * @param[in] p The modulus P (odd integer)
+ * @return Error code
+ **/
+
+static error_t mpiInvModOdd(Mpi *r, const Mpi *a, const Mpi *p)
+{
+   uint_t i;
+   uint_t k;
+   uint_t m;
+   uint_t n;
+   uint32_t pInv;
+   int32_t eta;
+   int32_t c;
+   int32_t mask;
+   int32_t t[4];
+   int32_t f[MPI_INV_MAX_LIMBS];
+   int32_t g[MPI_INV_MAX_LIMBS];
+   int32_t d[MPI_INV_MAX_LIMBS];
+   int32_t e[MPI_INV_MAX_LIMBS];
+   int32_t q[MPI_INV_MAX_LIMBS];
+
+   //Determine the actual length of the modulus
+   k = mpiGetBitLength(p);
+   //Number of limbs
+   n = k / MPI_INV_LIMB_BITS + 2;
+
+   //Bound on the number of divsteps (Bernstein-Yang, theorem 11.2), that
+   //only depends on the length of the modulus
+   if(k < 46)
+   {
+      m = (49 * k + 80 + 16) / 17;
+   }
+   else
+   {
+      m = (49 * k + 57 + 16) / 17;
+   }
+
+   //Number of iterations of 30 divsteps
+   m = (m + MPI_INV_LIMB_BITS - 1) / MPI_INV_LIMB_BITS;
+
+   //Convert the operands
+   mpiImportLimbs(q, p, n);
+   mpiImportLimbs(g, a, n);
+
+   //Use Newton's method to compute the inverse of P mod 2^30
+   for(pInv = 2 - p->data[0], i = 0; i < 4; i++)
+   {
+      pInv = pInv * (2 - pInv * p->data[0]);
+   }
+
+   pInv &= MPI_INV_LIMB_MASK;
+
+   //Set f = P, g = A, d = 0, e = 1 and delta = 1
+   osMemcpy(f, q, n * sizeof(int32_t));
+   osMemset(d, 0, n * sizeof(int32_t));
+   osMemset(e, 0, n * sizeof(int32_t));
+   e[0] = 1;
+   eta = -1;
+
+   //The number of iterations is fixed, so that the computation time does
+   //not depend on the value of A. g = 0 after the last iteration
+   for(i = 0; i < m; i++)
+   {
+      eta = mpiDivsteps(eta, (uint32_t) f[0], (uint32_t) g[0], t);
+      mpiUpdateDe(d, e, t, q, pInv, n);
+      mpiUpdateFg(f, g, t, n);
+   }
+
+   //f is now equal to +/-GCD(A, P). Check whether |f| = 1
+   c = f[n - 1] >> 31;
+
+   for(mask = 0, i = 0; i < n; i++)
+   {
+      //Compute the limbs of |f|
+      g[i] = (f[i] ^ c) - c;
+
+      if(i > 0)
+      {
+         g[i] += g[i - 1] >> MPI_INV_LIMB_BITS;
+         g[i - 1] &= MPI_INV_LIMB_MASK;
+         mask |= g[i - 1] ^ (i == 1);
+      }
+   }
+
+   mask |= g[n - 1];
+
+   //The inverse does not exist if A and P are not coprime
+   if(mask != 0)
+      return ERROR_FAILURE;
+
+   //d = f / A mod P, hence R = d * sign(f)
+   mpiNormalizeLimbs(d, f[n - 1], q, n);
+
+   //Convert the result
+   return mpiExportLimbs(r, d, n, mpiGetLength(p));
+}
+
+
+/**
+ * @brief Regular modular inverse (even modulus, single-word operand)
+ * @param[out] r Resulting integer R = A^-1 mod P
+ * @param[in] a An odd integer A such as 1 < A < 2^32
+ * @param[in] p The modulus P (even integer)
+ * @return Error code
+ **/
+
+static error_t mpiInvModWord(Mpi *r, const Mpi *a, const Mpi *p)
+{
+   error_t error;
+   uint_t i;
+   uint_t n;
+   uint_t d;
+   uint64_t t;
+   Mpi x;
+
+   //Initialize multiple precision integer
+   mpiInit(&x);
+
+   //The loops below run over all the words of P, whatever their value
+   n = mpiGetLength(p);
+
+   //Compute c = P mod A, starting from the most significant word
+   for(t = 0, i = n; i > 0; i--)
+   {
+      t = ((t << 32) | p->data[i - 1]) % a->data[0];
+   }
+
+   //Compute c = P^-1 mod A
+   MPI_CHECK(mpiCopy(&x, a));
+   x.data[0] = (uint_t) t;
+   MPI_CHECK(mpiInvModOdd(&x, &x, a));
+
+   //Compute d = A - c
+   d = a->data[0] - x.data[0];
+
+   //Compute X = 1 + P.d
+   MPI_CHECK(mpiGrow(&x, n + 1));
+
+   for(t = 1, i = 0; i < n; i++)
+   {
+      t += (uint64_t) p->data[i] * d;
+      x.data[i] = (uint_t) t;
+      t >>= 32;
+   }
+
+   x.data[n] = (uint_t) t;
+
+   //A.R = X, hence R = X / A (exact division). Since d < A, R < P
+   for(t = 0, i = n + 1; i > 0; i--)
+   {
+      t = (t << 32) | x.data[i - 1];
+      x.data[i - 1] = (uint_t) (t / a->data[0]);
+      t %= a->data[0];
+   }
+
+   //Copy the result
+   MPI_CHECK(mpiCopy(r, &x));
+
+end:
+   //Release multiple precision integer
+   mpiFree(&x);
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Regular modular inverse
+ *
+ * The Bernstein-Yang safegcd algorithm is used when the modulus is odd. The
+ * number of iterations only depends on the length of the modulus, and no
+ * secret-dependent branches or memory accesses are made, so that the
+ * computation time does not depend on the value of A.
+ *
+ * Even moduli are handled by inverting P modulo A, followed by an exact
+ * division by A. When A fits in a single word (the public exponent of an
+ * RSA key, inverted modulo phi), both the reduction and the division are
+ * fixed-length loops over the words of P. Otherwise, that path relies on
+ * mpiMod and mpiDiv, hence it is not constant-time and must not be used
+ * with secret values
+ *
+ * @param[out] r Resulting integer R = A^-1 mod P
+ * @param[in] a The multiple precision integer A
+ * @param[in] p The modulus P
+ * @return Error code
+ **/
+
+__weak_func error_t mpiInvModRegular(Mpi *r, const Mpi *a, const Mpi *p)
+{
+   error_t error;
+   Mpi b;
+   Mpi c;
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
+
+   //Make sure the modulus is positive
+   if(mpiCompInt(p, 0) <= 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //The modulus must fit in the fixed-size buffers (refer to mpiInvModOdd)
+   if((mpiGetBitLength(p) / MPI_INV_LIMB_BITS + 2) > MPI_INV_MAX_LIMBS)
+      return mpiInvMod(r, a, p);
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
+
+   //Initialize multiple precision integers
+   mpiInit(&b);
+   mpiInit(&c);
+
+   //Reduce A modulo P if necessary
+   if(mpiCompInt(a, 0) < 0 || mpiComp(a, p) >= 0)
+   {
+      MPI_CHECK(mpiMod(&b, a, p));
+   }
+   else
+   {
+      MPI_CHECK(mpiCopy(&b, a));
+   }
+
+   //Odd modulus?
+   if(mpiIsOdd(p))
+   {
+      //Compute R = A^-1 mod P
+      MPI_CHECK(mpiInvModOdd(r, &b, p));
+   }
+   else
+   {
+      //A must be odd, otherwise A and P are not coprime
+      if(mpiIsEven(&b))
+      {
+         MPI_CHECK(ERROR_FAILURE);
+      }
+
+      //Single-word operand?
+      if(mpiGetLength(&b) == 1 && b.data[0] > 1)
+      {
+         //Compute R = A^-1 mod P using fixed-length word loops
+         MPI_CHECK(mpiInvModWord(r, &b, p));
+      }
+      else
+      {
+         //The computation below is not constant-time (variable-time
+         //division and reduction). Compute c = P^-1 mod A
+         MPI_CHECK(mpiMod(&c, p, &b));
+         MPI_CHECK(mpiInvModOdd(&c, &c, &b));
+
+         //A.R = 1 + P.(A - c), hence R = (1 + P.(A - c)) / A
+         MPI_CHECK(mpiSub(&c, &b, &c));
+         MPI_CHECK(mpiMul(&c, &c, p));
+         MPI_CHECK(mpiAddInt(&c, &c, 1));
+         MPI_CHECK(mpiDiv(&c, NULL, &c, &b));
+         MPI_CHECK(mpiMod(r, &c, p));
+      }
+   }
+
+end:
+   //Release multiple precision integers
+   mpiFree(&b);
+   mpiFree(&c);
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
+   //Return status code
+   return error;
+}
+
+
+
+#if (MPI_MONT_SUPPORT == ENABLED)
+
+/**
+ * @brief Modular exponentiation using fixed-size Montgomery arithmetic
+ * @param[out] r Resulting integer R = A ^ E mod P
+ * @param[in] a Pointer to a multiple precision integer
+ * @param[in] e Exponent
+ * @param[in] p Modulus (odd integer)
+ * @return Error code
+ **/
+
+static error_t mpiExpModMont(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p)
+{
+   error_t error;
+   Mpi t;
+   MpiMontContext context;
+
+   //Initialize multiple precision integer
+   mpiInit(&t);
+
+   //Initialize Montgomery context
+   MPI_CHECK(mpiMontInit(&context, p));
+
+   //Negative or very large integers must be reduced first
+   if(a->sign < 0 || mpiGetLength(a) > (2 * context.n))
+   {
+      MPI_CHECK(mpiMod(&t, a, p));
+      a = &t;
+   }
+
+   //Perform modular exponentiation (regular calculation)
+   MPI_CHECK(mpiMontExpRegular(&context, r, a, e));
+
+end:
+   //Release Montgomery context
+   mpiMontFree(&context);
+   //Release multiple precision integer
+   mpiFree(&t);
+
+   //Return status code
+   return error;
+}
+
+#endif
+
+
+/**
+ * @brief Modular exponentiation
+ * @param[out] r Resulting integer R = A ^ E mod P
+ * @param[in] a Pointer to a multiple precision integer
  * @param[in] e Exponent
  * @param[in] p Modulus
  * @return Error code
@@ -1663,6 +3144,25 @@ __weak_func error_t mpiExpMod(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p)
    Mpi c2;
    Mpi t;
    Mpi s[8];
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
+
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Odd moduli are processed with fixed-size Montgomery arithmetic, which
+   //does not require any dynamic memory allocation. This function serves
+   //both mpiExpModFast and mpiExpModRegular, hence the regular algorithm
+   //is used
+   if(p->sign > 0 && mpiIsOdd(p) && mpiGetLength(p) <= MPI_MONT_MAX_INT_SIZE)
+   {
+      return mpiExpModMont(r, a, e, p);
+   }
+#endif
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
 
    //Initialize multiple precision integers
    mpiInit(&b);
@@ -1757,109 +3257,381 @@ __weak_func error_t mpiExpMod(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p)
       }
 
       //Let R = B^2 * C^-1 mod P
-      MPI_CHECK(mpiMontgomeryMul(r, &b, &b, k, p, &t));
+      MPI_CHECK(mpiMontgomerySqr(r, &b, k, p, &t));
       //Let S[0] = B
       MPI_CHECK(mpiCopy(&s[0], &b));
 
       //Precompute S[i] = B^(2 * i + 1) * C^-1 mod P
       for(i = 1; i < (1 << (d - 1)); i++)
       {
-         MPI_CHECK(mpiMontgomeryMul(&s[i], &s[i - 1], r, k, p, &t));
+         MPI_CHECK(mpiMontgomeryMul(&s[i], &s[i - 1], r, k, p, &t));
+      }
+
+      //Let R = C mod P
+      MPI_CHECK(mpiCopy(r, &c2));
+      MPI_CHECK(mpiMontgomeryRed(r, r, k, p, &t));
+
+      //The exponent is processed in a left-to-right fashion
+      i = mpiGetBitLength(e) - 1;
+
+      //Perform sliding window exponentiation
+      while(i >= 0)
+      {
+         //The sliding window exponentiation algorithm decomposes E
+         //into zero and nonzero windows
+         if(!mpiGetBitValue(e, i))
+         {
+            //Compute R = R^2 * C^-1 mod P
+            MPI_CHECK(mpiMontgomerySqr(r, r, k, p, &t));
+            //Next bit to be processed
+            i--;
+         }
+         else
+         {
+            //Find the longest window
+            n = MAX(i - d + 1, 0);
+
+            //The least significant bit of the window must be equal to 1
+            while(!mpiGetBitValue(e, n)) n++;
+
+            //The algorithm processes more than one bit per iteration
+            for(u = 0, j = i; j >= n; j--)
+            {
+               //Compute R = R^2 * C^-1 mod P
+               MPI_CHECK(mpiMontgomerySqr(r, r, k, p, &t));
+               //Compute the relevant index to be used in the precomputed table
+               u = (u << 1) | mpiGetBitValue(e, j);
+            }
+
+            //Compute R = R * T[u/2] * C^-1 mod P
+            MPI_CHECK(mpiMontgomeryMul(r, r, &s[u >> 1], k, p, &t));
+            //Next bit to be processed
+            i = n - 1;
+         }
+      }
+
+      //Compute R = R * C^-1 mod P
+      MPI_CHECK(mpiMontgomeryRed(r, r, k, p, &t));
+   }
+
+end:
+   //Release multiple precision integers
+   mpiFree(&b);
+   mpiFree(&c2);
+   mpiFree(&t);
+
+   //Release precomputed values
+   for(i = 0; (uint_t) i < arraysize(s); i++)
+   {
+      mpiFree(&s[i]);
+   }
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Modular exponentiation (fast calculation)
+ * @param[out] r Resulting integer R = A ^ E mod P
+ * @param[in] a Pointer to a multiple precision integer
+ * @param[in] e Exponent
+ * @param[in] p Modulus
+ * @return Error code
+ **/
+
+__weak_func error_t mpiExpModFast(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p)
+{
+   //Perform modular exponentiation
+   return mpiExpMod(r, a, e, p);
+}
+
+
+/**
+ * @brief Modular exponentiation (regular calculation)
+ * @param[out] r Resulting integer R = A ^ E mod P
+ * @param[in] a Pointer to a multiple precision integer
+ * @param[in] e Exponent
+ * @param[in] p Modulus
+ * @return Error code
+ **/
+
+__weak_func error_t mpiExpModRegular(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p)
+{
+   //Perform modular exponentiation
+   return mpiExpMod(r, a, e, p);
+}
+
+
+/**
+ * @brief Interleaved sliding window exponentiation (odd modulus)
+ *
+ * Both exponents are scanned together, so that a single chain of Montgomery
+ * squarings is shared between the two exponentiations. The sequence of
+ * operations depends on the exponents, which must be public
+ *
+ * @param[out] r Resulting integer R = A1 ^ E1 * A2 ^ E2 mod P
+ * @param[in] a1 First base
+ * @param[in] e1 First exponent
+ * @param[in] a2 Second base
+ * @param[in] e2 Second exponent
+ * @param[in] p Odd modulus
+ * @return Error code
+ **/
+
+static error_t mpiMontgomeryExp2(Mpi *r, const Mpi *a1, const Mpi *e1,
+   const Mpi *a2, const Mpi *e2, const Mpi *p)
+{
+   error_t error;
+   int_t i;
+   int_t j;
+   int_t k;
+   int_t n[2];
+   uint_t d;
+   uint_t m;
+   uint_t u[2];
+   const Mpi *a[2];
+   const Mpi *e[2];
+   Mpi b;
+   Mpi c2;
+   Mpi t;
+   Mpi x;
+   Mpi s[2][4];
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
+
+   //Initialize multiple precision integers
+   mpiInit(&b);
+   mpiInit(&c2);
+   mpiInit(&t);
+   mpiInit(&x);
+
+   //Initialize precomputed values
+   for(k = 0; k < 2; k++)
+   {
+      for(j = 0; j < 4; j++)
+      {
+         mpiInit(&s[k][j]);
+      }
+   }
+
+   //Point to the bases and to the exponents
+   a[0] = a1;
+   a[1] = a2;
+   e[0] = e1;
+   e[1] = e2;
+
+   //The exponents are processed in a left-to-right fashion
+   i = MAX(mpiGetBitLength(e1), mpiGetBitLength(e2)) - 1;
+
+   //Very small exponents are often selected with low Hamming weight.
+   //The sliding window mechanism should be disabled in that case
+   d = (i < 32) ? 1 : 3;
+
+   //Compute the smaller C = (2^32)^m such as C > P
+   m = mpiGetLength(p);
+
+   //Compute C^2 mod P
+   MPI_CHECK(mpiSetValue(&c2, 1));
+   MPI_CHECK(mpiShiftLeft(&c2, 2 * m * (MPI_INT_SIZE * 8)));
+   MPI_CHECK(mpiMod(&c2, &c2, p));
+
+   //Precompute the odd powers of both bases
+   for(k = 0; k < 2; k++)
+   {
+      //Let S[k][0] = A * C mod P
+      if(a[k]->sign < 0 || mpiComp(a[k], p) >= 0)
+      {
+         MPI_CHECK(mpiMod(&b, a[k], p));
+         MPI_CHECK(mpiMontgomeryMul(&s[k][0], &b, &c2, m, p, &t));
+      }
+      else
+      {
+         MPI_CHECK(mpiMontgomeryMul(&s[k][0], a[k], &c2, m, p, &t));
+      }
+
+      //Let B = A^2 * C mod P
+      MPI_CHECK(mpiMontgomerySqr(&b, &s[k][0], m, p, &t));
+
+      //Precompute S[k][i] = A^(2 * i + 1) * C mod P
+      for(j = 1; j < (1 << (d - 1)); j++)
+      {
+         MPI_CHECK(mpiMontgomeryMul(&s[k][j], &s[k][j - 1], &b, m, p, &t));
       }
+   }
 
-      //Let R = C mod P
-      MPI_CHECK(mpiCopy(r, &c2));
-      MPI_CHECK(mpiMontgomeryRed(r, r, k, p, &t));
+   //Let X = C mod P
+   MPI_CHECK(mpiCopy(&x, &c2));
+   MPI_CHECK(mpiMontgomeryRed(&x, &x, m, p, &t));
 
-      //The exponent is processed in a left-to-right fashion
-      i = mpiGetBitLength(e) - 1;
+   //No window has been started yet
+   n[0] = -1;
+   n[1] = -1;
+   u[0] = 0;
+   u[1] = 0;
 
-      //Perform sliding window exponentiation
-      while(i >= 0)
+   //Perform interleaved sliding window exponentiation
+   for(; i >= 0; i--)
+   {
+      //Compute X = X^2 * C^-1 mod P
+      MPI_CHECK(mpiMontgomerySqr(&x, &x, m, p, &t));
+
+      //Process each exponent in turn
+      for(k = 0; k < 2; k++)
       {
-         //The sliding window exponentiation algorithm decomposes E
-         //into zero and nonzero windows
-         if(!mpiGetBitValue(e, i))
-         {
-            //Compute R = R^2 * C^-1 mod P
-            MPI_CHECK(mpiMontgomeryMul(r, r, r, k, p, &t));
-            //Next bit to be processed
-            i--;
-         }
-         else
+         //A new window starts at each nonzero bit that does not belong to
+         //the current window
+         if(n[k] < 0 && mpiGetBitValue(e[k], i))
          {
             //Find the longest window
-            n = MAX(i - d + 1, 0);
+            n[k] = MAX(i - (int_t) d + 1, 0);
 
             //The least significant bit of the window must be equal to 1
-            while(!mpiGetBitValue(e, n)) n++;
+            while(!mpiGetBitValue(e[k], n[k])) n[k]++;
 
-            //The algorithm processes more than one bit per iteration
-            for(u = 0, j = i; j >= n; j--)
+            //Compute the relevant index to be used in the precomputed table
+            for(u[k] = 0, j = i; j >= n[k]; j--)
             {
-               //Compute R = R^2 * C^-1 mod P
-               MPI_CHECK(mpiMontgomeryMul(r, r, r, k, p, &t));
-               //Compute the relevant index to be used in the precomputed table
-               u = (u << 1) | mpiGetBitValue(e, j);
+               u[k] = (u[k] << 1) | mpiGetBitValue(e[k], j);
             }
+         }
 
-            //Compute R = R * T[u/2] * C^-1 mod P
-            MPI_CHECK(mpiMontgomeryMul(r, r, &s[u >> 1], k, p, &t));
-            //Next bit to be processed
-            i = n - 1;
+         //The multiplication is performed at the end of the window
+         if(n[k] == i)
+         {
+            //Compute X = X * S[k][u/2] * C^-1 mod P
+            MPI_CHECK(mpiMontgomeryMul(&x, &x, &s[k][u[k] >> 1], m, p, &t));
+            //The window is complete
+            n[k] = -1;
          }
       }
-
-      //Compute R = R * C^-1 mod P
-      MPI_CHECK(mpiMontgomeryRed(r, r, k, p, &t));
    }
 
+   //Compute R = X * C^-1 mod P
+   MPI_CHECK(mpiMontgomeryRed(r, &x, m, p, &t));
+
 end:
    //Release multiple precision integers
    mpiFree(&b);
    mpiFree(&c2);
    mpiFree(&t);
+   mpiFree(&x);
 
    //Release precomputed values
-   for(i = 0; (uint_t) i < arraysize(s); i++)
+   for(k = 0; k < 2; k++)
    {
-      mpiFree(&s[i]);
+      for(j = 0; j < 4; j++)
+      {
+         mpiFree(&s[k][j]);
+      }
    }
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
+
    //Return status code
    return error;
 }
 
 
 /**
- * @brief Modular exponentiation (fast calculation)
- * @param[out] r Resulting integer R = A ^ E mod P
- * @param[in] a Pointer to a multiple precision integer
- * @param[in] e Exponent
+ * @brief Simultaneous modular exponentiation
+ *
+ * Odd moduli share a single chain of squarings between both exponentiations,
+ * with or without MPI_MONT_SUPPORT. Even moduli fall back to two separate
+ * exponentiations. This function must only be used with public exponents
+ *
+ * @param[out] r Resulting integer R = A1 ^ E1 * A2 ^ E2 mod P
+ * @param[in] a1 First base
+ * @param[in] e1 First exponent
+ * @param[in] a2 Second base
+ * @param[in] e2 Second exponent
  * @param[in] p Modulus
  * @return Error code
  **/
 
-__weak_func error_t mpiExpModFast(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p)
+error_t mpiExpMod2(Mpi *r, const Mpi *a1, const Mpi *e1, const Mpi *a2,
+   const Mpi *e2, const Mpi *p)
 {
-   //Perform modular exponentiation
-   return mpiExpMod(r, a, e, p);
-}
+   error_t error;
+   Mpi t1;
+   Mpi t2;
+#if (MPI_MONT_SUPPORT == ENABLED)
+   MpiMontContext context;
+#endif
 
+   //Initialize multiple precision integers
+   mpiInit(&t1);
+   mpiInit(&t2);
 
-/**
- * @brief Modular exponentiation (regular calculation)
- * @param[out] r Resulting integer R = A ^ E mod P
- * @param[in] a Pointer to a multiple precision integer
- * @param[in] e Exponent
- * @param[in] p Modulus
- * @return Error code
- **/
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Odd moduli are processed with fixed-size Montgomery arithmetic
+   if(p->sign > 0 && mpiIsOdd(p) && mpiGetLength(p) <= MPI_MONT_MAX_INT_SIZE)
+   {
+      //Initialize Montgomery context
+      MPI_CHECK(mpiMontInit(&context, p));
 
-__weak_func error_t mpiExpModRegular(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p)
-{
-   //Perform modular exponentiation
-   return mpiExpMod(r, a, e, p);
+      //Negative or very large integers must be reduced first
+      if(a1->sign < 0 || mpiGetLength(a1) > (2 * context.n))
+      {
+         MPI_CHECK(mpiMod(&t1, a1, p));
+         a1 = &t1;
+      }
+
+      //Negative or very large integers must be reduced first
+      if(a2->sign < 0 || mpiGetLength(a2) > (2 * context.n))
+      {
+         MPI_CHECK(mpiMod(&t2, a2, p));
+         a2 = &t2;
+      }
+
+      //Perform simultaneous modular exponentiation
+      MPI_CHECK(mpiMontExp2(&context, r, a1, e1, a2, e2));
+   }
+   else
+#endif
+   //Odd modulus?
+   if(p->sign > 0 && mpiIsOdd(p))
+   {
+      //Perform simultaneous modular exponentiation
+      MPI_CHECK(mpiMontgomeryExp2(r, a1, e1, a2, e2, p));
+   }
+   else
+   {
+      //Compute T1 = A1 ^ E1 mod P (even moduli are processed with two
+      //separate exponentiations)
+      MPI_CHECK(mpiExpModFast(&t1, a1, e1, p));
+      //Compute T2 = A2 ^ E2 mod P
+      MPI_CHECK(mpiExpModFast(&t2, a2, e2, p));
+      //Compute R = T1 * T2 mod P
+      MPI_CHECK(mpiMulMod(r, &t1, &t2, p));
+   }
+
+end:
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Release Montgomery context
+   mpiMontFree(&context);
+#endif
+
+   //Release multiple precision integers
+   mpiFree(&t1);
+   mpiFree(&t2);
+
+   //Return status code
+   return error;
 }
 
 
@@ -1937,6 +3709,69 @@ end:
 }
 
 
+/**
+ * @brief Montgomery squaring
+ * @param[out] r Resulting integer R = A^2 / 2^k mod P
+ * @param[in] a An integer A such as 0 <= A < 2^k
+ * @param[in] k An integer k such as P < 2^k
+ * @param[in] p Modulus P
+ * @param[in] t An preallocated integer T (for internal operation)
+ * @return Error code
+ **/
+
+error_t mpiMontgomerySqr(Mpi *r, const Mpi *a, uint_t k, const Mpi *p, Mpi *t)
+{
+   error_t error;
+   uint_t i;
+   uint_t m;
+   uint_t n;
+   uint_t q;
+
+   //Use Newton's method to compute the inverse of P[0] mod 2^32
+   for(m = 2 - p->data[0], i = 0; i < 4; i++)
+   {
+      m = m * (2 - m * p->data[0]);
+   }
+
+   //Precompute -1/P[0] mod 2^32;
+   m = ~m + 1;
+
+   //We assume that A is always less than 2^k
+   n = MIN(a->size, k);
+
+   //Make sure T is large enough
+   MPI_CHECK(mpiGrow(t, 2 * k + 1));
+   //Let T = 0
+   MPI_CHECK(mpiSetValue(t, 0));
+
+   //Compute T = A^2
+   mpiSqrCore(t->data, a->data, n);
+
+   //Perform Montgomery reduction
+   for(i = 0; i < k; i++)
+   {
+      //Compute q = (T[i] * m) mod 2^32
+      q = t->data[i] * m;
+      //Compute T = T + q * P
+      mpiMulAccCore(t->data + i, p->data, k, q);
+   }
+
+   //Compute R = T / 2^(32 * k)
+   MPI_CHECK(mpiShiftRight(t, k * (MPI_INT_SIZE * 8)));
+   MPI_CHECK(mpiCopy(r, t));
+
+   //A final subtraction is required
+   if(mpiComp(r, p) >= 0)
+   {
+      MPI_CHECK(mpiSub(r, r, p));
+   }
+
+end:
+   //Return status code
+   return error;
+}
+
+
 /**
  * @brief Montgomery reduction
  * @param[out] r Resulting integer R = A / 2^k mod P
@@ -1967,7 +3802,253 @@ error_t mpiMontgomeryRed(Mpi *r, const Mpi *a, uint_t k, const Mpi *p, Mpi *t)
 }
 
 
-#if (MPI_ASM_SUPPORT == DISABLED)
+/**
+ * @brief Add a word array to another one
+ * @param[in,out] r Integer R of m words (R = R + A)
+ * @param[in] m Size of R in words
+ * @param[in] a Integer A of n words (n <= m)
+ * @param[in] n Size of A in words
+ **/
+
+static void mpiAddAccCore(uint_t *r, uint_t m, const uint_t *a, uint_t n)
+{
+   uint_t i;
+   uint_t c;
+   uint64_t temp;
+
+   //Compute R = R + A
+   for(c = 0, i = 0; i < n; i++)
+   {
+      temp = (uint64_t) r[i] + a[i] + c;
+      r[i] = (uint_t) temp;
+      c = (uint_t) (temp >> 32);
+   }
+
+   //Propagate carry
+   for(; c != 0 && i < m; i++)
+   {
+      r[i] += c;
+      c = (r[i] < c);
+   }
+}
+
+
+/**
+ * @brief Subtract a word array from another one
+ * @param[in,out] r Integer R of m words (R = R - A)
+ * @param[in] m Size of R in words
+ * @param[in] a Integer A of n words (n <= m)
+ * @param[in] n Size of A in words
+ **/
+
+static void mpiSubAccCore(uint_t *r, uint_t m, const uint_t *a, uint_t n)
+{
+   uint_t i;
+   uint_t b;
+   uint64_t temp;
+
+   //Compute R = R - A
+   for(b = 0, i = 0; i < n; i++)
+   {
+      temp = (uint64_t) r[i] - a[i] - b;
+      r[i] = (uint_t) temp;
+      b = (temp >> 32) & 1;
+   }
+
+   //Propagate borrow
+   for(; b != 0 && i < m; i++)
+   {
+      b = (r[i] == 0);
+      r[i]--;
+   }
+}
+
+
+/**
+ * @brief Multiplication of two n-word integers
+ *
+ * Karatsuba algorithm is used as long as the size of the operands is at
+ * least MPI_KARATSUBA_THRESHOLD words. A squaring is performed when both
+ * operands point to the same array
+ *
+ * @param[out] r Resulting integer R = A * B (2 * n words)
+ * @param[in] a First operand A (n words)
+ * @param[in] b Second operand B (n words)
+ * @param[in] n Size of the operands in words
+ * @param[in] t Scratch area of MPI_MUL_CORE_SCRATCH_SIZE(n) words
+ **/
+
+void mpiMulCore(uint_t *r, const uint_t *a, const uint_t *b, uint_t n,
+   uint_t *t)
+{
+   uint_t i;
+   uint_t h;
+   uint_t *sa;
+   uint_t *sb;
+   uint_t *z1;
+
+   //Small operands?
+   if(n < MPI_KARATSUBA_THRESHOLD)
+   {
+      //Squaring operation?
+      if(a == b)
+      {
+         //Compute R = A^2
+         mpiSqrCore(r, a, n);
+      }
+      else
+      {
+         //Let R = 0
+         osMemset(r, 0, 2 * n * MPI_INT_SIZE);
+
+         //Compute R = A * B
+         for(i = 0; i < n; i++)
+         {
+            mpiMulAccCore(r + i, b, n, a[i]);
+         }
+      }
+   }
+   else
+   {
+      //Split the operands as A = AH * 2^(32 * h) + AL, B = BH * 2^(32 * h) + BL
+      h = (n + 1) / 2;
+
+      //Allocate temporary values from the scratch area
+      sa = t;
+      sb = t + h + 1;
+      z1 = t + 2 * h + 2;
+      t += 4 * h + 4;
+
+      //Compute SA = AL + AH
+      osMemcpy(sa, a, h * MPI_INT_SIZE);
+      sa[h] = 0;
+      mpiAddAccCore(sa, h + 1, a + h, n - h);
+
+      //Squaring operation?
+      if(a == b)
+      {
+         sb = sa;
+      }
+      else
+      {
+         //Compute SB = BL + BH
+         osMemcpy(sb, b, h * MPI_INT_SIZE);
+         sb[h] = 0;
+         mpiAddAccCore(sb, h + 1, b + h, n - h);
+      }
+
+      //Compute Z0 = AL * BL and Z2 = AH * BH
+      mpiMulCore(r, a, b, h, t);
+      mpiMulCore(r + 2 * h, a + h, b + h, n - h, t);
+
+      //Compute Z1 = SA * SB - Z0 - Z2 = AL * BH + AH * BL
+      mpiMulCore(z1, sa, sb, h + 1, t);
+      mpiSubAccCore(z1, 2 * h + 2, r, 2 * h);
+      mpiSubAccCore(z1, 2 * h + 2, r + 2 * h, 2 * (n - h));
+
+      //Compute R = Z2 * 2^(64 * h) + Z1 * 2^(32 * h) + Z0
+      mpiAddAccCore(r + h, 2 * n - h, z1, MIN(2 * h + 2, 2 * n - h));
+   }
+}
+
+
+/**
+ * @brief Squaring of a n-word integer
+ * @param[out] r Resulting integer R = A^2 (2 * n words)
+ * @param[in] a The operand A (n words)
+ * @param[in] n Size of A in words
+ **/
+
+void mpiSqrCore(uint_t *r, const uint_t *a, uint_t n)
+{
+   uint_t i;
+   uint_t c;
+   uint_t v;
+   uint64_t p;
+   uint64_t temp;
+
+   //Let R = 0
+   osMemset(r, 0, 2 * n * MPI_INT_SIZE);
+
+   //Compute the cross products A[i] * A[j], for i < j
+   for(i = 1; i < n; i++)
+   {
+      mpiMulAccCore(r + 2 * i - 1, a + i, n - i, a[i - 1]);
+   }
+
+   //Double the cross products
+   for(c = 0, i = 0; i < (2 * n); i++)
+   {
+      v = r[i];
+      r[i] = (v << 1) | c;
+      c = v >> 31;
+   }
+
+   //Add the squares A[i]^2
+   for(c = 0, i = 0; i < n; i++)
+   {
+      p = (uint64_t) a[i] * a[i];
+
+      temp = (uint64_t) r[2 * i] + (uint32_t) p + c;
+      r[2 * i] = (uint_t) temp;
+
+      temp = (uint64_t) r[2 * i + 1] + (p >> 32) + (temp >> 32);
+      r[2 * i + 1] = (uint_t) temp;
+
+      c = (uint_t) (temp >> 32);
+   }
+}
+
+
+#if (MPI_ASM_X86_64_SUPPORT == ENABLED)
+
+/**
+ * @brief Check whether the CPU supports the BMI2 and ADX extensions
+ *
+ * The CPUID instruction is only executed once. The result is cached with
+ * relaxed atomic accesses, since every thread computes the same value
+ *
+ * @return TRUE if the x86-64 assembly routines can be used, else FALSE
+ **/
+
+bool_t mpiAdxSupported(void)
+{
+   int_t status;
+   unsigned int eax;
+   unsigned int ebx;
+   unsigned int ecx;
+   unsigned int edx;
+   static int_t cache = 0;
+
+   //Cached value (0 = unknown, 1 = not supported, 2 = supported)
+   status = __atomic_load_n(&cache, __ATOMIC_RELAXED);
+
+   //First call?
+   if(status == 0)
+   {
+      //Query structured extended feature flags (leaf 7, sub-leaf 0)
+      if(__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) &&
+         (ebx & bit_BMI2) != 0 && (ebx & bit_ADX) != 0)
+      {
+         status = 2;
+      }
+      else
+      {
+         status = 1;
+      }
+
+      //Save the result
+      __atomic_store_n(&cache, status, __ATOMIC_RELAXED);
+   }
+
+   //Return TRUE if both extensions are available
+   return (status == 2) ? TRUE : FALSE;
+}
+
+#endif
+
+
+#if (MPI_ASM_SUPPORT == DISABLED || MPI_ASM_X86_64_SUPPORT == ENABLED)
 
 /**
  * @brief Multiply-accumulate operation
@@ -1985,6 +4066,15 @@ void mpiMulAccCore(uint_t *r, const uint_t *a, int_t m, const uint_t b)
    uint32_t v;
    uint64_t p;
 
+#if (MPI_ASM_X86_64_SUPPORT == ENABLED)
+   //Use the assembly routine when the CPU supports BMI2 and ADX
+   if(mpiAdxSupported())
+   {
+      mpiMulAccCoreAdx(r, a, m, b);
+      return;
+   }
+#endif
+
    //Clear variables
    c = 0;
    u = 0;
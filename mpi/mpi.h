@@ -42,12 +42,64 @@
    #error MPI_MAX_BIT_SIZE parameter is not valid
 #endif
 
+//Size, in words, above which Karatsuba multiplication is used
+#ifndef MPI_KARATSUBA_THRESHOLD
+   #define MPI_KARATSUBA_THRESHOLD 32
+#elif (MPI_KARATSUBA_THRESHOLD < 4)
+   #error MPI_KARATSUBA_THRESHOLD parameter is not valid
+#endif
+
+//Range of offsets covered by one sieve pass (prime search)
+#ifndef MPI_PRIME_SIEVE_RANGE
+   #define MPI_PRIME_SIEVE_RANGE 16384
+#elif (MPI_PRIME_SIEVE_RANGE < 2 || MPI_PRIME_SIEVE_RANGE > 65536)
+   #error MPI_PRIME_SIEVE_RANGE parameter is not valid
+#endif
+
+//Scratch arena support (MPI temporaries)
+#ifndef MPI_ARENA_SUPPORT
+   #define MPI_ARENA_SUPPORT DISABLED
+#elif (MPI_ARENA_SUPPORT != ENABLED && MPI_ARENA_SUPPORT != DISABLED)
+   #error MPI_ARENA_SUPPORT parameter is not valid
+#elif (MPI_ARENA_SUPPORT == ENABLED && CRYPTO_STATIC_MEM_SUPPORT == ENABLED)
+   #error MPI_ARENA_SUPPORT requires dynamic memory allocation
+#endif
+
+//Size, in bytes, of the scratch arena attached to each thread
+#ifndef MPI_ARENA_SIZE
+   #define MPI_ARENA_SIZE 16384
+#elif (MPI_ARENA_SIZE < 256)
+   #error MPI_ARENA_SIZE parameter is not valid
+#endif
+
+//Storage class of the per-thread scratch arena
+#ifndef MPI_ARENA_THREAD_LOCAL
+   #define MPI_ARENA_THREAD_LOCAL _Thread_local
+#endif
+
+//x86-64 assembly routines (selected at runtime, BMI2 and ADX required)
+#if (MPI_ASM_SUPPORT == ENABLED && defined(__GNUC__) && defined(__x86_64__))
+   #define MPI_ASM_X86_64_SUPPORT ENABLED
+#else
+   #define MPI_ASM_X86_64_SUPPORT DISABLED
+#endif
+
 //Size of the sub data type
 #define MPI_INT_SIZE sizeof(uint_t)
 
 //Maximum size, in words, of a multiple precision integer
 #define MPI_MAX_INT_SIZE ((MPI_MAX_BIT_SIZE + (MPI_INT_SIZE * 8) - 1) / (MPI_INT_SIZE * 8))
 
+//Size, in bits, of the limbs used by the regular modular inversion
+#define MPI_INV_LIMB_BITS 30
+#define MPI_INV_LIMB_MASK 0x3FFFFFFF
+
+//Maximum number of limbs used by the regular modular inversion
+#define MPI_INV_MAX_LIMBS (MPI_MAX_BIT_SIZE / MPI_INV_LIMB_BITS + 3)
+
+//Size, in words, of the scratch area required by mpiMulCore
+#define MPI_MUL_CORE_SCRATCH_SIZE(n) (4 * (n) + 160)
+
 //Error code checking
 #define MPI_CHECK(f) if((error = f) != NO_ERROR) goto end
 
@@ -72,6 +124,39 @@ typedef enum
 } MpiFormat;
 
 
+/**
+ * @brief Scratch arena scope
+ *
+ * Integers initialized while a scope is active draw their memory from the
+ * scratch arena of the current thread. All that memory is reclaimed at once
+ * when the scope is left. Each scope is identified by a generation number,
+ * so that a scope descriptor reused at the same address is never mistaken
+ * for a previous one. Generation numbers are only unique within a thread,
+ * hence the owning arena is recorded along with them
+ *
+ **/
+
+typedef struct _MpiArenaScope
+{
+   struct _MpiArenaScope *parent; ///<Enclosing scope
+   size_t offset;                 ///<Offset of the arena when entering the scope
+   uint_t generation;             ///<Generation number of the scope
+} MpiArenaScope;
+
+
+/**
+ * @brief Scratch arena attached to a thread
+ **/
+
+typedef struct
+{
+   uint8_t *buffer;    ///<Memory buffer (allocated on first use)
+   size_t offset;      ///<Offset of the first free byte
+   MpiArenaScope *top; ///<Innermost active scope
+   uint_t generation;  ///<Generation number of the last scope entered
+} MpiArena;
+
+
 /**
  * @brief Arbitrary precision integer
  **/
@@ -85,6 +170,11 @@ typedef struct
 #else
    uint_t data[MPI_MAX_INT_SIZE];
 #endif
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArena *arena; ///<Scratch arena of the thread that initialized the integer
+   uint_t scope;    ///<Generation of the scope in which the integer was initialized
+   bool_t scratch;  ///<The data buffer lies in the scratch arena
+#endif
 } Mpi;
 
 
@@ -94,6 +184,10 @@ void mpiFree(Mpi *r);
 
 error_t mpiGrow(Mpi *r, uint_t size);
 
+void mpiArenaEnter(MpiArenaScope *scope);
+void mpiArenaLeave(MpiArenaScope *scope);
+void mpiArenaRelease(void);
+
 uint_t mpiGetLength(const Mpi *a);
 uint_t mpiGetByteLength(const Mpi *a);
 uint_t mpiGetBitLength(const Mpi *a);
@@ -114,7 +208,11 @@ error_t mpiRand(Mpi *r, uint_t length, const PrngAlgo *prngAlgo,
 error_t mpiRandRange(Mpi *r, const Mpi *p, const PrngAlgo *prngAlgo,
    void *prngContext);
 
-error_t mpiCheckProbablePrime(const Mpi *a);
+error_t mpiCheckProbablePrime(const Mpi *a, const PrngAlgo *prngAlgo,
+   void *prngContext);
+
+error_t mpiSearchProbablePrime(Mpi *r, const Mpi *a, const Mpi *b, uint_t e,
+   const PrngAlgo *prngAlgo, void *prngContext);
 
 error_t mpiImport(Mpi *r, const uint8_t *data, uint_t length, MpiFormat format);
 error_t mpiExport(const Mpi *a, uint8_t *data, uint_t length, MpiFormat format);
@@ -133,6 +231,7 @@ error_t mpiShiftRight(Mpi *r, uint_t n);
 
 error_t mpiMul(Mpi *r, const Mpi *a, const Mpi *b);
 error_t mpiMulInt(Mpi *r, const Mpi *a, int_t b);
+error_t mpiSqr(Mpi *r, const Mpi *a);
 
 error_t mpiDiv(Mpi *q, Mpi *r, const Mpi *a, const Mpi *b);
 error_t mpiDivInt(Mpi *q, Mpi *r, const Mpi *a, int_t b);
@@ -142,18 +241,39 @@ error_t mpiAddMod(Mpi *r, const Mpi *a, const Mpi *b, const Mpi *p);
 error_t mpiSubMod(Mpi *r, const Mpi *a, const Mpi *b, const Mpi *p);
 error_t mpiMulMod(Mpi *r, const Mpi *a, const Mpi *b, const Mpi *p);
 error_t mpiInvMod(Mpi *r, const Mpi *a, const Mpi *p);
+error_t mpiInvModBatch(Mpi *r, const Mpi *a, uint_t n, const Mpi *p);
+error_t mpiInvModRegular(Mpi *r, const Mpi *a, const Mpi *p);
 
 error_t mpiExpMod(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p);
 error_t mpiExpModFast(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p);
 error_t mpiExpModRegular(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p);
 
+error_t mpiExpMod2(Mpi *r, const Mpi *a1, const Mpi *e1, const Mpi *a2,
+   const Mpi *e2, const Mpi *p);
+
 error_t mpiMontgomeryMul(Mpi *r, const Mpi *a, const Mpi *b, uint_t k,
    const Mpi *p, Mpi *t);
 
+error_t mpiMontgomerySqr(Mpi *r, const Mpi *a, uint_t k, const Mpi *p, Mpi *t);
 error_t mpiMontgomeryRed(Mpi *r, const Mpi *a, uint_t k, const Mpi *p, Mpi *t);
 
+void mpiMulCore(uint_t *r, const uint_t *a, const uint_t *b, uint_t n,
+   uint_t *t);
+
+void mpiSqrCore(uint_t *r, const uint_t *a, uint_t n);
 void mpiMulAccCore(uint_t *r, const uint_t *a, int_t m, const uint_t b);
 
+#if (MPI_ASM_X86_64_SUPPORT == ENABLED)
+
+bool_t mpiAdxSupported(void);
+
+void mpiMulAccCoreAdx(uint_t *r, const uint_t *a, int_t m, const uint_t b);
+
+void mpiMulAdx(uint_t *r, const uint_t *a, const uint_t *b, uint_t n);
+uint_t mpiMontRedAdx(uint_t *t, const uint_t *p, uint_t n, uint64_t m);
+
+#endif
+
 void mpiDump(FILE *stream, const char_t *prepend, const Mpi *a);
 
 //C++ guard
@@ -0,0 +1,1116 @@
+/**
+ * @file mpi_mont.c
+ * @brief Fixed-size Montgomery arithmetic
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @section Description
+ *
+ * The generic MPI routines resize their operands on demand, which implies
+ * a memory allocation each time a temporary integer grows. This module
+ * implements Montgomery arithmetic on fixed-size word arrays whose length
+ * is bounded at compile time (MPI_MONT_MAX_BIT_SIZE), so that a complete
+ * modular exponentiation runs on the stack without any dynamic allocation
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+//Switch to the appropriate trace level
+#define TRACE_LEVEL CRYPTO_TRACE_LEVEL
+
+//Dependencies
+#include "core/crypto.h"
+#include "mpi/mpi.h"
+#include "mpi/mpi_mont.h"
+#include "debug.h"
+
+//Check crypto library configuration
+#if (MPI_SUPPORT == ENABLED && MPI_MONT_SUPPORT == ENABLED)
+
+
+/**
+ * @brief Conditional subtraction of the modulus
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting integer R = A - P if A + C * R >= P, else R = A
+ * @param[in] a An integer A such as 0 <= A + C * R < 2 * P
+ * @param[in] c Carry bit C
+ **/
+
+static void mpiMontCondSub(const MpiMontContext *context, uint_t *r,
+   const uint_t *a, uint_t c)
+{
+   uint_t i;
+   uint_t n;
+   uint_t mask;
+   uint_t borrow;
+   uint64_t temp;
+   uint_t d[MPI_MONT_MAX_INT_SIZE];
+
+   //Retrieve the length of the modulus
+   n = context->n;
+
+   //Compute D = A - P
+   for(borrow = 0, i = 0; i < n; i++)
+   {
+      temp = (uint64_t) a[i] - context->p[i] - borrow;
+      d[i] = (uint_t) temp;
+      borrow = (temp >> 32) & 1;
+   }
+
+   //The subtraction is required if there is a carry or no borrow
+   mask = 0 - ((c | (borrow ^ 1)) & 1);
+
+   //Select the relevant value in constant time
+   for(i = 0; i < n; i++)
+   {
+      r[i] = (d[i] & mask) | (a[i] & ~mask);
+   }
+}
+
+
+/**
+ * @brief Compute the Montgomery representation of 1
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting integer R = 2^(32 * n) mod P
+ **/
+
+static void mpiMontSetOne(const MpiMontContext *context, uint_t *r)
+{
+   uint_t n;
+   uint_t t[2 * MPI_MONT_MAX_INT_SIZE + 1];
+
+   //Retrieve the length of the modulus
+   n = context->n;
+
+   //Reduce R^2 mod P
+   osMemset(t, 0, (2 * n + 1) * MPI_INT_SIZE);
+   osMemcpy(t, context->r2, n * MPI_INT_SIZE);
+   mpiMontRed(context, r, t);
+}
+
+
+/**
+ * @brief Initialize a Montgomery context
+ * @param[out] context Pointer to the Montgomery context
+ * @param[in] p Modulus P (odd integer)
+ * @return Error code
+ **/
+
+error_t mpiMontInit(MpiMontContext *context, const Mpi *p)
+{
+   uint_t i;
+   uint_t k;
+   uint_t m;
+   uint_t n;
+   uint_t s;
+#if (MPI_ASM_X86_64_SUPPORT == ENABLED)
+   uint64_t q;
+   uint64_t v;
+#endif
+
+   //Check parameters
+   if(context == NULL || p == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Montgomery arithmetic requires a positive odd modulus
+   if(p->sign < 0 || mpiIsEven(p))
+      return ERROR_INVALID_PARAMETER;
+
+   //Determine the actual length of the modulus
+   n = mpiGetLength(p);
+
+   //Check the length of the modulus
+   if(n > MPI_MONT_MAX_INT_SIZE)
+      return ERROR_INVALID_LENGTH;
+
+   //Save the modulus
+   context->n = n;
+   osMemcpy(context->p, p->data, n * MPI_INT_SIZE);
+
+   //Use Newton's method to compute the inverse of P[0] mod 2^32
+   for(m = 2 - p->data[0], i = 0; i < 4; i++)
+   {
+      m = m * (2 - m * p->data[0]);
+   }
+
+   //Precompute -1/P[0] mod 2^32
+   context->m = ~m + 1;
+
+#if (MPI_ASM_X86_64_SUPPORT == ENABLED)
+   //The 64-bit routines require -1/P mod 2^64. Each Newton iteration
+   //doubles the number of correct bits
+   if(n > 1)
+   {
+      q = p->data[0] | ((uint64_t) p->data[1] << 32);
+
+      for(v = q, i = 0; i < 5; i++)
+      {
+         v = v * (2 - v * q);
+      }
+
+      context->m64 = ~v + 1;
+   }
+#endif
+
+   //Determine the actual length of the modulus, in bits
+   k = mpiGetBitLength(p);
+
+   //Let X = 2^(k - 1), which is less than P
+   osMemset(context->r2, 0, n * MPI_INT_SIZE);
+
+   if(k > 1)
+   {
+      context->r2[(k - 1) / 32] = 1U << ((k - 1) % 32);
+   }
+
+   //Compute X = R mod P by successive doublings
+   for(i = k - 1; i < (32 * n); i++)
+   {
+      mpiMontAdd(context, context->r2, context->r2, context->r2);
+   }
+
+   //Decompose 32 * n as k * 2^s, where k is odd
+   for(k = 32 * n, s = 0; (k & 1) == 0; s++)
+   {
+      k >>= 1;
+   }
+
+   //Compute X = 2^k * R mod P
+   for(i = 0; i < k; i++)
+   {
+      mpiMontAdd(context, context->r2, context->r2, context->r2);
+   }
+
+   //Each Montgomery squaring doubles the exponent of 2, so that
+   //X = 2^(32 * n) * R mod P = R^2 mod P after s iterations
+   for(i = 0; i < s; i++)
+   {
+      mpiMontSqr(context, context->r2, context->r2);
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Release a Montgomery context
+ * @param[in] context Pointer to the Montgomery context
+ **/
+
+void mpiMontFree(MpiMontContext *context)
+{
+   //Clear Montgomery context
+   osMemset(context, 0, sizeof(MpiMontContext));
+}
+
+
+/**
+ * @brief Convert an integer to Montgomery representation
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting integer R = A * 2^(32 * n) mod P
+ * @param[in] a An integer A such as 0 <= A < 2^(64 * n)
+ * @return Error code
+ **/
+
+error_t mpiMontImport(const MpiMontContext *context, uint_t *r, const Mpi *a)
+{
+   uint_t m;
+   uint_t n;
+   uint_t t[MPI_MONT_MAX_INT_SIZE];
+
+   //Retrieve the length of the modulus
+   n = context->n;
+   //Determine the actual length of A
+   m = mpiGetLength(a);
+
+   //Check the value of A
+   if(a->sign < 0 || m > (2 * n))
+      return ERROR_OUT_OF_RANGE;
+
+   //Split A as AH * 2^(32 * n) + AL
+   osMemset(t, 0, n * MPI_INT_SIZE);
+   osMemcpy(t, a->data, MIN(m, n) * MPI_INT_SIZE);
+
+   //Compute R = AL * R mod P
+   mpiMontMul(context, r, t, context->r2);
+
+   //Any high part?
+   if(m > n)
+   {
+      osMemset(t, 0, n * MPI_INT_SIZE);
+      osMemcpy(t, a->data + n, (m - n) * MPI_INT_SIZE);
+
+      //Compute T = AH * R^2 mod P
+      mpiMontMul(context, t, t, context->r2);
+      mpiMontMul(context, t, t, context->r2);
+
+      //Compute R = (AH * R + AL) * R mod P
+      mpiMontAdd(context, r, r, t);
+   }
+
+   //Erase temporary value
+   osMemset(t, 0, n * MPI_INT_SIZE);
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Convert an integer from Montgomery representation
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting integer R = A / 2^(32 * n) mod P
+ * @param[in] a An integer A such as 0 <= A < P
+ * @return Error code
+ **/
+
+error_t mpiMontExport(const MpiMontContext *context, Mpi *r, const uint_t *a)
+{
+   error_t error;
+   uint_t n;
+   uint_t t[2 * MPI_MONT_MAX_INT_SIZE + 1];
+
+   //Retrieve the length of the modulus
+   n = context->n;
+
+   //Adjust the size of R
+   error = mpiGrow(r, n);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Compute R = A / 2^(32 * n) mod P
+   osMemset(t, 0, (2 * n + 1) * MPI_INT_SIZE);
+   osMemcpy(t, a, n * MPI_INT_SIZE);
+   mpiMontRed(context, r->data, t);
+
+   //Clear upper words
+   osMemset(r->data + n, 0, (r->size - n) * MPI_INT_SIZE);
+   //The result is always positive
+   r->sign = 1;
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Modular addition
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting integer R = A + B mod P
+ * @param[in] a An integer A such as 0 <= A < P
+ * @param[in] b An integer B such as 0 <= B < P
+ **/
+
+void mpiMontAdd(const MpiMontContext *context, uint_t *r, const uint_t *a,
+   const uint_t *b)
+{
+   uint_t i;
+   uint_t c;
+   uint64_t temp;
+
+   //Compute R = A + B
+   for(c = 0, i = 0; i < context->n; i++)
+   {
+      temp = (uint64_t) a[i] + b[i] + c;
+      r[i] = (uint_t) temp;
+      c = (uint_t) (temp >> 32);
+   }
+
+   //Compute R = A + B mod P
+   mpiMontCondSub(context, r, r, c);
+}
+
+
+/**
+ * @brief Montgomery multiplication
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting integer R = A * B / 2^(32 * n) mod P
+ * @param[in] a An integer A such as 0 <= A < P
+ * @param[in] b An integer B such as 0 <= B < P
+ **/
+
+void mpiMontMul(const MpiMontContext *context, uint_t *r, const uint_t *a,
+   const uint_t *b)
+{
+   uint_t n;
+   uint_t t[2 * MPI_MONT_MAX_INT_SIZE + 1];
+   uint_t s[MPI_MUL_CORE_SCRATCH_SIZE(MPI_MONT_MAX_INT_SIZE)];
+
+   //Retrieve the length of the modulus
+   n = context->n;
+
+#if (MPI_ASM_X86_64_SUPPORT == ENABLED)
+   //Operands made of 64-bit limbs can be processed by the assembly routine
+   if((n % 2) == 0 && mpiAdxSupported())
+   {
+      //Compute T = A * B
+      mpiMulAdx(t, a, b, n);
+   }
+   else
+#endif
+   {
+      //Compute T = A * B (a squaring is performed when A and B are the
+      //same array)
+      mpiMulCore(t, a, b, n, s);
+   }
+
+   t[2 * n] = 0;
+
+   //Compute R = T / 2^(32 * n) mod P
+   mpiMontRed(context, r, t);
+}
+
+
+/**
+ * @brief Montgomery squaring
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting integer R = A^2 / 2^(32 * n) mod P
+ * @param[in] a An integer A such as 0 <= A < P
+ **/
+
+void mpiMontSqr(const MpiMontContext *context, uint_t *r, const uint_t *a)
+{
+   //Compute R = A^2 / 2^(32 * n) mod P
+   mpiMontMul(context, r, a, a);
+}
+
+
+/**
+ * @brief Montgomery reduction
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting integer R = T / 2^(32 * n) mod P
+ * @param[in,out] t An integer T of 2 * n + 1 words such as 0 <= T < P * R
+ *   (the contents of T are destroyed)
+ **/
+
+void mpiMontRed(const MpiMontContext *context, uint_t *r, uint_t *t)
+{
+   uint_t i;
+   uint_t n;
+   uint_t q;
+
+   //Retrieve the length of the modulus
+   n = context->n;
+
+#if (MPI_ASM_X86_64_SUPPORT == ENABLED)
+   //Operands made of 64-bit limbs can be processed by the assembly routine
+   if((n % 2) == 0 && mpiAdxSupported())
+   {
+      //Compute T = T + Q * P, one 64-bit limb at a time (the carry out of
+      //the 2 * n lower words is added to the most significant word)
+      t[2 * n] += mpiMontRedAdx(t, context->p, n, context->m64);
+   }
+   else
+#endif
+   {
+      //Perform Montgomery reduction
+      for(i = 0; i < n; i++)
+      {
+         //Compute q = (T[i] * m) mod 2^32
+         q = t[i] * context->m;
+         //Compute T = T + q * P * 2^(32 * i)
+         mpiMulAccCore(t + i, context->p, n, q);
+      }
+   }
+
+   //A final subtraction may be required
+   mpiMontCondSub(context, r, t + n, t[2 * n]);
+}
+
+
+/**
+ * @brief Modular exponentiation
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting integer R = A ^ E mod P
+ * @param[in] a An integer A such as 0 <= A < 2^(64 * n)
+ * @param[in] e Exponent
+ * @return Error code
+ **/
+
+error_t mpiMontExp(const MpiMontContext *context, Mpi *r, const Mpi *a,
+   const Mpi *e)
+{
+   error_t error;
+   int_t i;
+   int_t j;
+   int_t n;
+   uint_t d;
+   uint_t u;
+   uint_t b[MPI_MONT_MAX_INT_SIZE];
+   uint_t x[MPI_MONT_MAX_INT_SIZE];
+   uint_t s[8][MPI_MONT_MAX_INT_SIZE];
+
+   //Very small exponents are often selected with low Hamming weight.
+   //The sliding window mechanism should be disabled in that case
+   d = (mpiGetBitLength(e) <= 32) ? 1 : 4;
+
+   //Let S[0] = A * R mod P
+   error = mpiMontImport(context, s[0], a);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Let B = A^2 * R mod P
+   mpiMontSqr(context, b, s[0]);
+
+   //Precompute S[i] = A^(2 * i + 1) * R mod P
+   for(i = 1; i < (1 << (d - 1)); i++)
+   {
+      mpiMontMul(context, s[i], s[i - 1], b);
+   }
+
+   //Let X = R mod P
+   mpiMontSetOne(context, x);
+
+   //The exponent is processed in a left-to-right fashion
+   i = mpiGetBitLength(e) - 1;
+
+   //Perform sliding window exponentiation
+   while(i >= 0)
+   {
+      //The sliding window exponentiation algorithm decomposes E
+      //into zero and nonzero windows
+      if(!mpiGetBitValue(e, i))
+      {
+         //Compute X = X^2 / R mod P
+         mpiMontSqr(context, x, x);
+         //Next bit to be processed
+         i--;
+      }
+      else
+      {
+         //Find the longest window
+         n = MAX(i - d + 1, 0);
+
+         //The least significant bit of the window must be equal to 1
+         while(!mpiGetBitValue(e, n)) n++;
+
+         //The algorithm processes more than one bit per iteration
+         for(u = 0, j = i; j >= n; j--)
+         {
+            //Compute X = X^2 / R mod P
+            mpiMontSqr(context, x, x);
+            //Compute the relevant index to be used in the precomputed table
+            u = (u << 1) | mpiGetBitValue(e, j);
+         }
+
+         //Compute X = X * S[u/2] / R mod P
+         mpiMontMul(context, x, x, s[u >> 1]);
+         //Next bit to be processed
+         i = n - 1;
+      }
+   }
+
+   //Compute R = X / R mod P
+   error = mpiMontExport(context, r, x);
+
+   //Erase temporary values
+   osMemset(b, 0, sizeof(b));
+   osMemset(x, 0, sizeof(x));
+   osMemset(s, 0, sizeof(s));
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Modular exponentiation with a single-word exponent
+ *
+ * The exponent is processed bit by bit, without any precomputed table. This
+ * is the fastest method for public exponents such as 65537, which only
+ * require 16 squarings and one multiplication
+ *
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting integer R = A ^ E mod P
+ * @param[in] a Pointer to a multiple precision integer
+ * @param[in] e Exponent
+ * @return Error code
+ **/
+
+error_t mpiMontExpInt(const MpiMontContext *context, Mpi *r, const Mpi *a,
+   uint_t e)
+{
+   error_t error;
+   int_t i;
+   uint_t s[MPI_MONT_MAX_INT_SIZE];
+   uint_t x[MPI_MONT_MAX_INT_SIZE];
+
+   //Let S = A * R mod P
+   error = mpiMontImport(context, s, a);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Zero exponent?
+   if(e == 0)
+   {
+      //Let X = R mod P
+      mpiMontSetOne(context, x);
+   }
+   else
+   {
+      //Skip the leading zero bits of the exponent
+      for(i = (MPI_INT_SIZE * 8) - 1; ((e >> i) & 1) == 0; i--)
+      {
+      }
+
+      //The most significant bit is always set
+      osMemcpy(x, s, context->n * MPI_INT_SIZE);
+
+      //Process the remaining bits in a left-to-right fashion
+      for(i--; i >= 0; i--)
+      {
+         //Compute X = X^2 / R mod P
+         mpiMontSqr(context, x, x);
+
+         //Check the value of the current bit
+         if(((e >> i) & 1) != 0)
+         {
+            //Compute X = X * S / R mod P
+            mpiMontMul(context, x, x, s);
+         }
+      }
+   }
+
+   //Compute R = X / R mod P
+   return mpiMontExport(context, r, x);
+}
+
+
+/**
+ * @brief Simultaneous modular exponentiation
+ *
+ * The two exponents are processed with interleaved sliding windows, so that
+ * a single chain of squarings is shared by both bases (Straus-Shamir trick).
+ * A 3-bit window keeps the table of odd powers small. This function is not
+ * constant-time and must only be used with public exponents
+ *
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting integer R = A1 ^ E1 * A2 ^ E2 mod P
+ * @param[in] a1 First base
+ * @param[in] e1 First exponent
+ * @param[in] a2 Second base
+ * @param[in] e2 Second exponent
+ * @return Error code
+ **/
+
+error_t mpiMontExp2(const MpiMontContext *context, Mpi *r, const Mpi *a1,
+   const Mpi *e1, const Mpi *a2, const Mpi *e2)
+{
+   error_t error;
+   int_t i;
+   int_t j;
+   int_t k;
+   int_t n[2];
+   uint_t d;
+   uint_t u[2];
+   const Mpi *e[2];
+   uint_t b[MPI_MONT_MAX_INT_SIZE];
+   uint_t x[MPI_MONT_MAX_INT_SIZE];
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   uint_t (*s)[4][MPI_MONT_MAX_INT_SIZE];
+#else
+   uint_t s[2][4][MPI_MONT_MAX_INT_SIZE];
+#endif
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Allocate a memory buffer to hold the odd powers of both bases
+   s = cryptoAllocMem(2 * sizeof(*s));
+   //Failed to allocate memory?
+   if(s == NULL)
+      return ERROR_OUT_OF_MEMORY;
+#endif
+
+   //Point to the exponents
+   e[0] = e1;
+   e[1] = e2;
+
+   //The exponents are processed in a left-to-right fashion
+   i = MAX(mpiGetBitLength(e1), mpiGetBitLength(e2)) - 1;
+
+   //Very small exponents are often selected with low Hamming weight.
+   //The sliding window mechanism should be disabled in that case
+   d = (i < 32) ? 1 : 3;
+
+   //Let S[0][0] = A1 * R mod P
+   error = mpiMontImport(context, s[0][0], a1);
+
+   //Check status code
+   if(!error)
+   {
+      //Let S[1][0] = A2 * R mod P
+      error = mpiMontImport(context, s[1][0], a2);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Precompute the odd powers of both bases
+      for(k = 0; k < 2; k++)
+      {
+         //Let B = A^2 * R mod P
+         mpiMontSqr(context, b, s[k][0]);
+
+         //Precompute S[k][i] = A^(2 * i + 1) * R mod P
+         for(j = 1; j < (1 << (d - 1)); j++)
+         {
+            mpiMontMul(context, s[k][j], s[k][j - 1], b);
+         }
+      }
+
+      //Let X = R mod P
+      mpiMontSetOne(context, x);
+
+      //No window has been started yet
+      n[0] = -1;
+      n[1] = -1;
+      u[0] = 0;
+      u[1] = 0;
+
+      //Perform interleaved sliding window exponentiation
+      for(; i >= 0; i--)
+      {
+         //Compute X = X^2 / R mod P
+         mpiMontSqr(context, x, x);
+
+         //Process each exponent in turn
+         for(k = 0; k < 2; k++)
+         {
+            //A new window starts at each nonzero bit that does not belong to
+            //the current window
+            if(n[k] < 0 && mpiGetBitValue(e[k], i))
+            {
+               //Find the longest window
+               n[k] = MAX(i - (int_t) d + 1, 0);
+
+               //The least significant bit of the window must be equal to 1
+               while(!mpiGetBitValue(e[k], n[k])) n[k]++;
+
+               //Compute the relevant index to be used in the precomputed table
+               for(u[k] = 0, j = i; j >= n[k]; j--)
+               {
+                  u[k] = (u[k] << 1) | mpiGetBitValue(e[k], j);
+               }
+            }
+
+            //The multiplication is performed at the end of the window
+            if(n[k] == i)
+            {
+               //Compute X = X * S[k][u/2] / R mod P
+               mpiMontMul(context, x, x, s[k][u[k] >> 1]);
+               //The window is complete
+               n[k] = -1;
+            }
+         }
+      }
+
+      //Compute R = X / R mod P
+      error = mpiMontExport(context, r, x);
+   }
+
+   //Erase temporary values
+   osMemset(b, 0, sizeof(b));
+   osMemset(x, 0, sizeof(x));
+   osMemset(s, 0, 2 * sizeof(*s));
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Release previously allocated memory
+   cryptoFreeMem(s);
+#endif
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Modular exponentiation (regular calculation)
+ *
+ * The exponent is processed with a fixed 4-bit window. One multiplication
+ * is performed per window and the precomputed values are fetched in
+ * constant time, so that the sequence of operations does not depend on
+ * the value of the exponent
+ *
+ * @param[in] context Pointer to the Montgomery context
+ * @param[out] r Resulting integer R = A ^ E mod P
+ * @param[in] a An integer A such as 0 <= A < 2^(64 * n)
+ * @param[in] e Exponent
+ * @return Error code
+ **/
+
+error_t mpiMontExpRegular(const MpiMontContext *context, Mpi *r,
+   const Mpi *a, const Mpi *e)
+{
+   error_t error;
+   int_t i;
+   uint_t j;
+   uint_t k;
+   uint_t u;
+   uint_t mask;
+   uint_t b[MPI_MONT_MAX_INT_SIZE];
+   uint_t x[MPI_MONT_MAX_INT_SIZE];
+   uint_t s[16][MPI_MONT_MAX_INT_SIZE];
+
+   //Let S[1] = A * R mod P
+   error = mpiMontImport(context, s[1], a);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Let S[0] = R mod P
+   mpiMontSetOne(context, s[0]);
+
+   //Precompute S[i] = A^i * R mod P
+   for(j = 2; j < 16; j++)
+   {
+      mpiMontMul(context, s[j], s[j - 1], s[1]);
+   }
+
+   //Let X = R mod P
+   osMemcpy(x, s[0], context->n * MPI_INT_SIZE);
+
+   //The exponent is processed in a left-to-right fashion
+   for(i = (mpiGetBitLength(e) + 3) / 4 - 1; i >= 0; i--)
+   {
+      //Compute X = X^16 / R mod P
+      for(j = 0; j < 4; j++)
+      {
+         mpiMontSqr(context, x, x);
+      }
+
+      //Extract the current 4-bit window
+      u = (e->data[(4 * i) / 32] >> ((4 * i) % 32)) & 0x0F;
+
+      //Fetch B = S[u] in constant time
+      osMemset(b, 0, context->n * MPI_INT_SIZE);
+
+      for(j = 0; j < 16; j++)
+      {
+         mask = 0 - (((j ^ u) - 1) >> 31);
+
+         for(k = 0; k < context->n; k++)
+         {
+            b[k] |= s[j][k] & mask;
+         }
+      }
+
+      //Compute X = X * B / R mod P
+      mpiMontMul(context, x, x, b);
+   }
+
+   //Compute R = X / R mod P
+   error = mpiMontExport(context, r, x);
+
+   //Erase temporary values
+   osMemset(b, 0, sizeof(b));
+   osMemset(x, 0, sizeof(x));
+   osMemset(s, 0, sizeof(s));
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Initialize a Montgomery context cache
+ * @param[out] cache Pointer to the cache
+ **/
+
+void mpiMontInitCache(MpiMontCache *cache)
+{
+   //The cache is initially empty
+   cache->ready = FALSE;
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   cache->context = NULL;
+#endif
+}
+
+
+/**
+ * @brief Release a Montgomery context cache
+ * @param[in] cache Pointer to the cache
+ **/
+
+void mpiMontFreeCache(MpiMontCache *cache)
+{
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Any Montgomery context previously allocated?
+   if(cache->context != NULL)
+   {
+      //Erase contents
+      mpiMontFree(cache->context);
+
+      //Release memory buffer
+      cryptoFreeMem(cache->context);
+      cache->context = NULL;
+   }
+#else
+   //Erase contents
+   mpiMontFree(&cache->context);
+#endif
+
+   //Invalidate the cache
+   cache->ready = FALSE;
+}
+
+
+/**
+ * @brief Precompute the Montgomery context associated with a given modulus
+ *
+ * This function must be called when the key is imported or generated,
+ * before it is shared between several tasks. The context is never updated
+ * afterwards, so that concurrent operations only read it
+ *
+ * @param[in,out] cache Pointer to the cache
+ * @param[in] p Modulus P
+ * @return Error code
+ **/
+
+error_t mpiMontPrecompute(MpiMontCache *cache, const Mpi *p)
+{
+   error_t error;
+   MpiMontContext *context;
+
+   //Check parameters
+   if(cache == NULL || p == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Invalidate the cache
+   cache->ready = FALSE;
+
+   //Even moduli and large moduli are not supported by the fixed-size
+   //engine. The generic implementation is used in that case
+   if(p->sign < 0 || mpiIsEven(p) || mpiGetLength(p) > MPI_MONT_MAX_INT_SIZE)
+      return NO_ERROR;
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Allocate a memory buffer to hold the Montgomery context, if necessary
+   if(cache->context == NULL)
+   {
+      cache->context = cryptoAllocMem(sizeof(MpiMontContext));
+      //Failed to allocate memory?
+      if(cache->context == NULL)
+         return ERROR_OUT_OF_MEMORY;
+   }
+
+   //Point to the Montgomery context
+   context = cache->context;
+#else
+   //Point to the Montgomery context
+   context = &cache->context;
+#endif
+
+   //Precompute the Montgomery constants
+   error = mpiMontInit(context, p);
+
+   //Check status code
+   if(!error)
+   {
+      //The cache is now valid
+      cache->ready = TRUE;
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Retrieve the Montgomery context associated with a given modulus
+ *
+ * The cache is only read. The context is ignored if it has not been
+ * precomputed (refer to mpiMontPrecompute) or if the modulus has been
+ * modified since then
+ *
+ * @param[in] cache Pointer to the cache
+ * @param[in] p Modulus P
+ * @return Pointer to the Montgomery context, or NULL if no valid context is
+ *   available
+ **/
+
+const MpiMontContext *mpiMontGetCachedContext(const MpiMontCache *cache,
+   const Mpi *p)
+{
+   uint_t n;
+   const MpiMontContext *context;
+
+   //The context is only available once it has been precomputed
+   if(!cache->ready)
+      return NULL;
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Point to the Montgomery context
+   context = cache->context;
+#else
+   //Point to the Montgomery context
+   context = &cache->context;
+#endif
+
+   //Determine the actual length of the modulus
+   n = mpiGetLength(p);
+
+   //Make sure the context was computed for the same modulus
+   if(p->sign < 0 || context->n != n ||
+      osMemcmp(context->p, p->data, n * MPI_INT_SIZE) != 0)
+   {
+      return NULL;
+   }
+
+   //Return a pointer to the Montgomery context
+   return context;
+}
+
+
+/**
+ * @brief Modular exponentiation using a cached Montgomery context
+ * @param[out] r Resulting integer R = A ^ E mod P
+ * @param[in] a Pointer to a multiple precision integer
+ * @param[in] e Exponent
+ * @param[in] p Modulus
+ * @param[in] cache Montgomery context cache associated with P
+ * @param[in] regular Regular calculation
+ * @return Error code
+ **/
+
+static error_t mpiExpModCached(Mpi *r, const Mpi *a, const Mpi *e,
+   const Mpi *p, const MpiMontCache *cache, bool_t regular)
+{
+   error_t error;
+   const MpiMontContext *context;
+
+   //Retrieve the Montgomery context associated with the modulus
+   context = mpiMontGetCachedContext(cache, p);
+
+   //Check whether the fixed-size engine can be used
+   if(context != NULL && a->sign >= 0 && mpiGetLength(a) <= (2 * context->n))
+   {
+      //Perform modular exponentiation
+      if(regular)
+      {
+         error = mpiMontExpRegular(context, r, a, e);
+      }
+      else
+      {
+         error = mpiMontExp(context, r, a, e);
+      }
+   }
+   else
+   {
+      //Fall back to the generic implementation
+      if(regular)
+      {
+         error = mpiExpModRegular(r, a, e, p);
+      }
+      else
+      {
+         error = mpiExpModFast(r, a, e, p);
+      }
+   }
+
+   //Return status code
+   return error;
+}
+
+
+/**
+ * @brief Modular exponentiation using a cached Montgomery context (fast
+ *   calculation)
+ * @param[out] r Resulting integer R = A ^ E mod P
+ * @param[in] a Pointer to a multiple precision integer
+ * @param[in] e Exponent
+ * @param[in] p Modulus
+ * @param[in] cache Montgomery context cache associated with P
+ * @return Error code
+ **/
+
+error_t mpiExpModFastCached(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p,
+   const MpiMontCache *cache)
+{
+   //Perform modular exponentiation
+   return mpiExpModCached(r, a, e, p, cache, FALSE);
+}
+
+
+/**
+ * @brief Modular exponentiation using a cached Montgomery context (regular
+ *   calculation)
+ * @param[out] r Resulting integer R = A ^ E mod P
+ * @param[in] a Pointer to a multiple precision integer
+ * @param[in] e Exponent
+ * @param[in] p Modulus
+ * @param[in] cache Montgomery context cache associated with P
+ * @return Error code
+ **/
+
+error_t mpiExpModRegularCached(Mpi *r, const Mpi *a, const Mpi *e,
+   const Mpi *p, const MpiMontCache *cache)
+{
+   //Perform modular exponentiation
+   return mpiExpModCached(r, a, e, p, cache, TRUE);
+}
+
+/**
+ * @brief Simultaneous modular exponentiation using a cached Montgomery
+ *   context
+ * @param[out] r Resulting integer R = A1 ^ E1 * A2 ^ E2 mod P
+ * @param[in] a1 First base
+ * @param[in] e1 First exponent
+ * @param[in] a2 Second base
+ * @param[in] e2 Second exponent
+ * @param[in] p Modulus
+ * @param[in] cache Montgomery context cache associated with P
+ * @return Error code
+ **/
+
+error_t mpiExpMod2Cached(Mpi *r, const Mpi *a1, const Mpi *e1, const Mpi *a2,
+   const Mpi *e2, const Mpi *p, const MpiMontCache *cache)
+{
+   error_t error;
+   const MpiMontContext *context;
+
+   //Retrieve the Montgomery context associated with the modulus
+   context = mpiMontGetCachedContext(cache, p);
+
+   //Check whether the fixed-size engine can be used
+   if(context != NULL && a1->sign >= 0 && a2->sign >= 0 &&
+      mpiGetLength(a1) <= (2 * context->n) &&
+      mpiGetLength(a2) <= (2 * context->n))
+   {
+      //Perform simultaneous modular exponentiation
+      error = mpiMontExp2(context, r, a1, e1, a2, e2);
+   }
+   else
+   {
+      //Fall back to the generic implementation
+      error = mpiExpMod2(r, a1, e1, a2, e2, p);
+   }
+
+   //Return status code
+   return error;
+}
+
+#endif
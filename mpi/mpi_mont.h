@@ -0,0 +1,153 @@
+/**
+ * @file mpi_mont.h
+ * @brief Fixed-size Montgomery arithmetic
+ *
+ * @section License
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later
+ *
+ * Copyright (C) 2010-2024 Oryx Embedded SARL. All rights reserved.
+ *
+ * This file is part of CycloneCRYPTO Open.
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301, USA.
+ *
+ * @author Oryx Embedded SARL (www.oryx-embedded.com)
+ * @version 2.4.0
+ **/
+
+#ifndef _MPI_MONT_H
+#define _MPI_MONT_H
+
+//Dependencies
+#include "core/crypto.h"
+#include "mpi/mpi.h"
+
+//Fixed-size Montgomery arithmetic support. The engine keeps its operands
+//on the stack (more than 11 KB for 4096-bit moduli) and the exponentiations
+//that use a precomputed context do not go through mpiExpMod, hence it must
+//not be enabled when a hardware accelerator provides mpiExpMod
+#ifndef MPI_MONT_SUPPORT
+   #define MPI_MONT_SUPPORT DISABLED
+#elif (MPI_MONT_SUPPORT != ENABLED && MPI_MONT_SUPPORT != DISABLED)
+   #error MPI_MONT_SUPPORT parameter is not valid
+#endif
+
+//Maximum size, in bits, of a modulus handled by the fixed-size engine
+#ifndef MPI_MONT_MAX_BIT_SIZE
+   #define MPI_MONT_MAX_BIT_SIZE 4096
+#elif (MPI_MONT_MAX_BIT_SIZE < 32)
+   #error MPI_MONT_MAX_BIT_SIZE parameter is not valid
+#endif
+
+//Maximum size, in words, of a modulus handled by the fixed-size engine
+#define MPI_MONT_MAX_INT_SIZE ((MPI_MONT_MAX_BIT_SIZE + (MPI_INT_SIZE * 8) - 1) / (MPI_INT_SIZE * 8))
+
+//C++ guard
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**
+ * @brief Montgomery context
+ *
+ * Integers are stored as arrays of exactly n words, so that the whole
+ * computation can be carried out on the stack
+ *
+ **/
+
+typedef struct
+{
+   uint_t n;                         ///<Length of the modulus, in words
+   uint_t m;                         ///<-1/P mod 2^32
+#if (MPI_ASM_X86_64_SUPPORT == ENABLED)
+   uint64_t m64;                     ///<-1/P mod 2^64
+#endif
+   uint_t p[MPI_MONT_MAX_INT_SIZE];  ///<Modulus P
+   uint_t r2[MPI_MONT_MAX_INT_SIZE]; ///<R^2 mod P, where R = 2^(32 * n)
+} MpiMontContext;
+
+
+/**
+ * @brief Precomputed Montgomery context attached to a long-term key
+ *
+ * The context is precomputed when the key is imported or generated and is
+ * only read afterwards, so that the key can be shared between several tasks
+ *
+ **/
+
+typedef struct
+{
+   bool_t ready;                    ///<The cached context is valid
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   MpiMontContext *context;         ///<Montgomery context
+#else
+   MpiMontContext context;          ///<Montgomery context
+#endif
+} MpiMontCache;
+
+
+//Fixed-size Montgomery arithmetic related functions
+error_t mpiMontInit(MpiMontContext *context, const Mpi *p);
+void mpiMontFree(MpiMontContext *context);
+
+error_t mpiMontImport(const MpiMontContext *context, uint_t *r, const Mpi *a);
+error_t mpiMontExport(const MpiMontContext *context, Mpi *r, const uint_t *a);
+
+void mpiMontAdd(const MpiMontContext *context, uint_t *r, const uint_t *a,
+   const uint_t *b);
+
+void mpiMontMul(const MpiMontContext *context, uint_t *r, const uint_t *a,
+   const uint_t *b);
+
+void mpiMontSqr(const MpiMontContext *context, uint_t *r, const uint_t *a);
+void mpiMontRed(const MpiMontContext *context, uint_t *r, uint_t *t);
+
+error_t mpiMontExp(const MpiMontContext *context, Mpi *r, const Mpi *a,
+   const Mpi *e);
+
+error_t mpiMontExpRegular(const MpiMontContext *context, Mpi *r,
+   const Mpi *a, const Mpi *e);
+
+error_t mpiMontExpInt(const MpiMontContext *context, Mpi *r, const Mpi *a,
+   uint_t e);
+
+error_t mpiMontExp2(const MpiMontContext *context, Mpi *r, const Mpi *a1,
+   const Mpi *e1, const Mpi *a2, const Mpi *e2);
+
+void mpiMontInitCache(MpiMontCache *cache);
+void mpiMontFreeCache(MpiMontCache *cache);
+
+error_t mpiMontPrecompute(MpiMontCache *cache, const Mpi *p);
+
+const MpiMontContext *mpiMontGetCachedContext(const MpiMontCache *cache,
+   const Mpi *p);
+
+error_t mpiExpModFastCached(Mpi *r, const Mpi *a, const Mpi *e, const Mpi *p,
+   const MpiMontCache *cache);
+
+error_t mpiExpModRegularCached(Mpi *r, const Mpi *a, const Mpi *e,
+   const Mpi *p, const MpiMontCache *cache);
+
+error_t mpiExpMod2Cached(Mpi *r, const Mpi *a1, const Mpi *e1, const Mpi *a2,
+   const Mpi *e2, const Mpi *p, const MpiMontCache *cache);
+
+//C++ guard
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -91,6 +91,13 @@ void dhInitParameters(DhParameters *params)
    mpiInit(&params->p);
    //Initialize generator
    mpiInit(&params->g);
+   //Initialize subgroup order
+   mpiInit(&params->q);
+
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Initialize precomputed Montgomery context
+   mpiMontInitCache(&params->pMont);
+#endif
 }
 
 
@@ -105,6 +112,39 @@ void dhFreeParameters(DhParameters *params)
    mpiFree(&params->p);
    //Release generator
    mpiFree(&params->g);
+   //Release subgroup order
+   mpiFree(&params->q);
+
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Release precomputed Montgomery context
+   mpiMontFreeCache(&params->pMont);
+#endif
+}
+
+
+/**
+ * @brief Precompute the Montgomery context attached to Diffie-Hellman parameters
+ *
+ * This function is called when the parameters are loaded. The context is
+ * only read by subsequent operations
+ *
+ * @param[in,out] params Pointer to the Diffie-Hellman parameters
+ * @return Error code
+ **/
+
+error_t dhPrecomputeParameters(DhParameters *params)
+{
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Check parameters
+   if(params == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Precompute the Montgomery context associated with the prime modulus
+   return mpiMontPrecompute(&params->pMont, &params->p);
+#else
+   //Not implemented
+   return NO_ERROR;
+#endif
 }
 
 
@@ -131,6 +171,13 @@ error_t dhGenerateKeyPair(DhContext *context, const PrngAlgo *prngAlgo,
    if(k == 0)
       return ERROR_INVALID_PARAMETER;
 
+   //The Diffie-Hellman context is owned by the caller, hence the Montgomery
+   //context attached to the parameters can be computed at this point
+   error = dhPrecomputeParameters(&context->params);
+   //Any error to report?
+   if(error)
+      return error;
+
    //The private value shall be randomly generated
    error = mpiRand(&context->xa, k, prngAlgo, prngContext);
    //Any error to report?
@@ -152,8 +199,13 @@ error_t dhGenerateKeyPair(DhContext *context, const PrngAlgo *prngAlgo,
    TRACE_DEBUG_MPI("    ", &context->xa);
 
    //Calculate the corresponding public value (ya = g ^ xa mod p)
+#if (MPI_MONT_SUPPORT == ENABLED)
+   error = mpiExpModRegularCached(&context->ya, &context->params.g,
+      &context->xa, &context->params.p, &context->params.pMont);
+#else
    error = mpiExpModRegular(&context->ya, &context->params.g, &context->xa,
       &context->params.p);
+#endif
    //Any error to report?
    if(error)
       return error;
@@ -175,6 +227,10 @@ error_t dhGenerateKeyPair(DhContext *context, const PrngAlgo *prngAlgo,
 
 /**
  * @brief Check Diffie-Hellman public value
+ *
+ * The public value is range-checked. When the order q of the subgroup is
+ * part of the parameters, a full subgroup membership test is also performed
+ *
  * @param[in] params Pointer to the Diffie-Hellman parameters
  * @param[in] publicKey Public value to be checked
  * @return Error code
@@ -204,6 +260,28 @@ error_t dhCheckPublicKey(DhParameters *params, const Mpi *publicKey)
       }
    }
 
+   //When the order of the subgroup is known, the public value must also
+   //belong to that subgroup (y ^ q = 1 mod p)
+   if(!error && mpiGetLength(&params->q) > 0)
+   {
+#if (MPI_MONT_SUPPORT == ENABLED)
+      error = mpiExpModFastCached(&a, publicKey, &params->q, &params->p,
+         &params->pMont);
+#else
+      error = mpiExpModFast(&a, publicKey, &params->q, &params->p);
+#endif
+
+      //Check status
+      if(!error)
+      {
+         //Reject public values that lie outside the subgroup
+         if(mpiCompInt(&a, 1) != 0)
+         {
+            error = ERROR_ILLEGAL_PARAMETER;
+         }
+      }
+   }
+
    //Free previously allocated resources
    mpiFree(&a);
    //Return status code
@@ -244,8 +322,13 @@ error_t dhComputeSharedSecret(DhContext *context, uint8_t *output,
    do
    {
       //Calculate the shared secret key (k = yb ^ xa mod p)
+#if (MPI_MONT_SUPPORT == ENABLED)
+      error = mpiExpModRegularCached(&z, &context->yb, &context->xa,
+         &context->params.p, &context->params.pMont);
+#else
       error = mpiExpModRegular(&z, &context->yb, &context->xa,
          &context->params.p);
+#endif
       //Any error to report?
       if(error)
          break;
@@ -34,6 +34,7 @@
 //Dependencies
 #include "core/crypto.h"
 #include "mpi/mpi.h"
+#include "mpi/mpi_mont.h"
 
 //C++ guard
 #ifdef __cplusplus
@@ -47,8 +48,12 @@ extern "C" {
 
 typedef struct
 {
-   Mpi p; ///<Prime modulus
-   Mpi g; ///<Generator
+   Mpi p;               ///<Prime modulus
+   Mpi g;               ///<Generator
+   Mpi q;               ///<Order of the subgroup generated by g (optional)
+#if (MPI_MONT_SUPPORT == ENABLED)
+   MpiMontCache pMont;  ///<Precomputed Montgomery context
+#endif
 } DhParameters;
 
 
@@ -72,6 +77,8 @@ void dhFree(DhContext *context);
 void dhInitParameters(DhParameters *params);
 void dhFreeParameters(DhParameters *params);
 
+error_t dhPrecomputeParameters(DhParameters *params);
+
 error_t dhGenerateKeyPair(DhContext *context, const PrngAlgo *prngAlgo,
    void *prngContext);
 
@@ -80,6 +80,11 @@ void dsaInitDomainParameters(DsaDomainParameters *params)
    mpiInit(&params->p);
    mpiInit(&params->q);
    mpiInit(&params->g);
+
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Initialize precomputed Montgomery context
+   mpiMontInitCache(&params->pMont);
+#endif
 }
 
 
@@ -94,6 +99,38 @@ void dsaFreeDomainParameters(DsaDomainParameters *params)
    mpiFree(&params->p);
    mpiFree(&params->q);
    mpiFree(&params->g);
+
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Release precomputed Montgomery context
+   mpiMontFreeCache(&params->pMont);
+#endif
+}
+
+
+/**
+ * @brief Precompute the Montgomery context attached to DSA domain parameters
+ *
+ * This function is called when the domain parameters are imported. The
+ * context is only read by subsequent operations, so that the key can be
+ * shared between several tasks
+ *
+ * @param[in,out] params Pointer to the DSA domain parameters
+ * @return Error code
+ **/
+
+error_t dsaPrecomputeDomainParameters(DsaDomainParameters *params)
+{
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Check parameters
+   if(params == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Precompute the Montgomery context associated with the prime modulus
+   return mpiMontPrecompute(&params->pMont, &params->p);
+#else
+   //Not implemented
+   return NO_ERROR;
+#endif
 }
 
 
@@ -537,7 +574,12 @@ error_t dsaGenerateSignature(const PrngAlgo *prngAlgo, void *prngContext,
    TRACE_DEBUG_MPI("    ", &z);
 
    //Compute r = (g ^ k mod p) mod q
+#if (MPI_MONT_SUPPORT == ENABLED)
+   MPI_CHECK(mpiExpModRegularCached(&signature->r, &key->params.g, &k,
+      &key->params.p, &key->params.pMont));
+#else
    MPI_CHECK(mpiExpModRegular(&signature->r, &key->params.g, &k, &key->params.p));
+#endif
    MPI_CHECK(mpiMod(&signature->r, &signature->r, &key->params.q));
 
    //Compute k ^ -1 mod q
@@ -658,10 +700,15 @@ error_t dsaVerifySignature(const DsaPublicKey *key,
    //Compute u2 = r * w mod q
    MPI_CHECK(mpiMulMod(&u2, &signature->r, &w, &key->params.q));
 
-   //Compute v = ((g ^ u1) * (y ^ u2) mod p) mod q
-   MPI_CHECK(mpiExpModFast(&v, &key->params.g, &u1, &key->params.p));
-   MPI_CHECK(mpiExpModFast(&w, &key->y, &u2, &key->params.p));
-   MPI_CHECK(mpiMulMod(&v, &v, &w, &key->params.p));
+   //Compute v = ((g ^ u1) * (y ^ u2) mod p) mod q. Both exponentiations
+   //share the same chain of squarings
+#if (MPI_MONT_SUPPORT == ENABLED)
+   MPI_CHECK(mpiExpMod2Cached(&v, &key->params.g, &u1, &key->y, &u2,
+      &key->params.p, &key->params.pMont));
+#else
+   MPI_CHECK(mpiExpMod2(&v, &key->params.g, &u1, &key->y, &u2,
+      &key->params.p));
+#endif
    MPI_CHECK(mpiMod(&v, &v, &key->params.q));
 
    //Debug message
@@ -34,6 +34,7 @@
 //Dependencies
 #include "core/crypto.h"
 #include "mpi/mpi.h"
+#include "mpi/mpi_mont.h"
 
 //C++ guard
 #ifdef __cplusplus
@@ -47,9 +48,12 @@ extern "C" {
 
 typedef struct
 {
-   Mpi p; ///<Prime modulus
-   Mpi q; ///<Group order
-   Mpi g; ///<Group generator
+   Mpi p;               ///<Prime modulus
+   Mpi q;               ///<Group order
+   Mpi g;               ///<Group generator
+#if (MPI_MONT_SUPPORT == ENABLED)
+   MpiMontCache pMont;  ///<Precomputed Montgomery context
+#endif
 } DsaDomainParameters;
 
 
@@ -102,6 +106,7 @@ extern const uint8_t DSA_WITH_SHA3_512_OID[9];
 //DSA related functions
 void dsaInitDomainParameters(DsaDomainParameters *params);
 void dsaFreeDomainParameters(DsaDomainParameters *params);
+error_t dsaPrecomputeDomainParameters(DsaDomainParameters *params);
 
 void dsaInitPublicKey(DsaPublicKey *key);
 void dsaFreePublicKey(DsaPublicKey *key);
@@ -96,6 +96,46 @@ static const uint8_t padding[] =
    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
+//Lower bound of the prime factors, ceil(2^(16 - 1/u)) for u = 2 to 16
+static const uint16_t rsaPrimeBounds[15] =
+{
+   46341, 52016, 55109, 57053, 58386, 59358, 60097, 60679,
+   61148, 61534, 61858, 62134, 62371, 62577, 62758
+};
+
+
+/**
+ * @brief RSA CRT exponentiation task parameters
+ **/
+
+typedef struct
+{
+   const Mpi *c;              ///<Ciphertext representative
+   const Mpi *d;              ///<CRT exponent
+   const Mpi *p;              ///<Prime factor
+#if (MPI_MONT_SUPPORT == ENABLED)
+   const MpiMontCache *cache; ///<Precomputed Montgomery context
+#endif
+   Mpi m;                     ///<Resulting value c ^ d mod p
+   error_t error;             ///<Status code
+} RsaCrtTask;
+
+
+/**
+ * @brief RSA prime factor search task parameters
+ **/
+
+typedef struct
+{
+   Mpi *r;                   ///<Resulting prime factor (starting point of the search)
+   Mpi a;                    ///<Lower bound of the range
+   Mpi b;                    ///<Upper bound of the range
+   uint_t e;                 ///<Public exponent
+   const PrngAlgo *prngAlgo; ///<PRNG algorithm (Miller-Rabin bases)
+   void *prngContext;        ///<Pointer to the PRNG context
+   error_t error;            ///<Status code
+} RsaPrimeTask;
+
 
 /**
  * @brief Initialize an RSA public key
@@ -107,6 +147,11 @@ void rsaInitPublicKey(RsaPublicKey *key)
    //Initialize multiple precision integers
    mpiInit(&key->n);
    mpiInit(&key->e);
+
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Initialize precomputed Montgomery context
+   mpiMontInitCache(&key->nMont);
+#endif
 }
 
 
@@ -120,6 +165,11 @@ void rsaFreePublicKey(RsaPublicKey *key)
    //Free multiple precision integers
    mpiFree(&key->n);
    mpiFree(&key->e);
+
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Release precomputed Montgomery context
+   mpiMontFreeCache(&key->nMont);
+#endif
 }
 
 
@@ -130,6 +180,10 @@ void rsaFreePublicKey(RsaPublicKey *key)
 
 void rsaInitPrivateKey(RsaPrivateKey *key)
 {
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   uint_t i;
+#endif
+
    //Initialize multiple precision integers
    mpiInit(&key->n);
    mpiInit(&key->e);
@@ -140,8 +194,35 @@ void rsaInitPrivateKey(RsaPrivateKey *key)
    mpiInit(&key->dq);
    mpiInit(&key->qinv);
 
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   //Initialize additional prime factors
+   for(i = 0; i < arraysize(key->otherPrimes); i++)
+   {
+      mpiInit(&key->otherPrimes[i].r);
+      mpiInit(&key->otherPrimes[i].d);
+      mpiInit(&key->otherPrimes[i].t);
+#if (MPI_MONT_SUPPORT == ENABLED)
+      mpiMontInitCache(&key->otherPrimes[i].rMont);
+#endif
+   }
+
+   //The key has two prime factors by default
+   key->numOtherPrimes = 0;
+#endif
+
    //Initialize private key slot
    key->slot = -1;
+
+   //CRT computation is sequential by default
+   key->workerPool = NULL;
+   key->workerPoolContext = NULL;
+
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Initialize precomputed Montgomery contexts
+   mpiMontInitCache(&key->nMont);
+   mpiMontInitCache(&key->pMont);
+   mpiMontInitCache(&key->qMont);
+#endif
 }
 
 
@@ -152,6 +233,10 @@ void rsaInitPrivateKey(RsaPrivateKey *key)
 
 void rsaFreePrivateKey(RsaPrivateKey *key)
 {
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   uint_t i;
+#endif
+
    //Free multiple precision integers
    mpiFree(&key->n);
    mpiFree(&key->e);
@@ -161,6 +246,137 @@ void rsaFreePrivateKey(RsaPrivateKey *key)
    mpiFree(&key->dp);
    mpiFree(&key->dq);
    mpiFree(&key->qinv);
+
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   //Release additional prime factors
+   for(i = 0; i < arraysize(key->otherPrimes); i++)
+   {
+      mpiFree(&key->otherPrimes[i].r);
+      mpiFree(&key->otherPrimes[i].d);
+      mpiFree(&key->otherPrimes[i].t);
+#if (MPI_MONT_SUPPORT == ENABLED)
+      mpiMontFreeCache(&key->otherPrimes[i].rMont);
+#endif
+   }
+
+   //Reset the number of additional prime factors
+   key->numOtherPrimes = 0;
+#endif
+
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Release precomputed Montgomery contexts
+   mpiMontFreeCache(&key->nMont);
+   mpiMontFreeCache(&key->pMont);
+   mpiMontFreeCache(&key->qMont);
+#endif
+}
+
+
+/**
+ * @brief Attach a worker pool to an RSA private key
+ *
+ * When a worker pool is attached, the exponentiations modulo each prime
+ * factor of the CRT computation are run concurrently. The same applies to
+ * the search for the prime factors when a new key is generated, in which
+ * case the PRNG must support concurrent access
+ *
+ * @param[in] key Pointer to the RSA private key
+ * @param[in] workerPool Worker pool (NULL for sequential computation)
+ * @param[in] workerPoolContext Pointer to the worker pool context
+ **/
+
+void rsaSetWorkerPool(RsaPrivateKey *key, const WorkerPool *workerPool,
+   void *workerPoolContext)
+{
+   //Save the worker pool
+   key->workerPool = workerPool;
+   key->workerPoolContext = workerPoolContext;
+}
+
+
+/**
+ * @brief Precompute the Montgomery context attached to an RSA public key
+ *
+ * This function is called when the key is imported or generated. The
+ * context is only read by subsequent operations, so that the key can be
+ * shared between several tasks
+ *
+ * @param[in,out] key Pointer to the RSA public key
+ * @return Error code
+ **/
+
+error_t rsaPrecomputePublicKey(RsaPublicKey *key)
+{
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Check parameters
+   if(key == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Precompute the Montgomery context associated with the modulus
+   return mpiMontPrecompute(&key->nMont, &key->n);
+#else
+   //Not implemented
+   return NO_ERROR;
+#endif
+}
+
+
+/**
+ * @brief Precompute the Montgomery contexts attached to an RSA private key
+ *
+ * This function is called when the key is imported or generated. The
+ * contexts are only read by subsequent operations, so that the key can be
+ * shared between several tasks
+ *
+ * @param[in,out] key Pointer to the RSA private key
+ * @return Error code
+ **/
+
+error_t rsaPrecomputePrivateKey(RsaPrivateKey *key)
+{
+#if (MPI_MONT_SUPPORT == ENABLED)
+   error_t error;
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   uint_t i;
+#endif
+
+   //Check parameters
+   if(key == NULL)
+      return ERROR_INVALID_PARAMETER;
+
+   //Precompute the Montgomery context associated with the modulus
+   error = mpiMontPrecompute(&key->nMont, &key->n);
+
+   //Check status code
+   if(!error)
+   {
+      //Precompute the Montgomery context associated with the first factor
+      error = mpiMontPrecompute(&key->pMont, &key->p);
+   }
+
+   //Check status code
+   if(!error)
+   {
+      //Precompute the Montgomery context associated with the second factor
+      error = mpiMontPrecompute(&key->qMont, &key->q);
+   }
+
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   //Loop through the additional prime factors
+   for(i = 0; i < key->numOtherPrimes && !error; i++)
+   {
+      //Precompute the Montgomery context associated with the prime factor
+      error = mpiMontPrecompute(&key->otherPrimes[i].rMont,
+         &key->otherPrimes[i].r);
+   }
+#endif
+
+   //Return status code
+   return error;
+#else
+   //Not implemented
+   return NO_ERROR;
+#endif
 }
 
 
@@ -1190,11 +1406,225 @@ error_t rsassaPssVerify(const RsaPublicKey *key, const HashAlgo *hash,
 }
 
 
+/**
+ * @brief Verify a batch of signatures generated with the same RSA key
+ *
+ * The signatures are verified one after the other with rsavp1. When
+ * MPI_MONT_SUPPORT is enabled, all of them use the Montgomery context
+ * attached to the key. Otherwise, each verification computes its own
+ * Montgomery constant, exactly as a single call to rsassaPkcs1v15Verify or
+ * rsassaPssVerify does, so that the hardware ports overriding rsaep or
+ * mpiExpModFast keep using their accelerator. Only the buffers are shared
+ *
+ * @param[in] key Signer's RSA public key
+ * @param[in] hash Hash function used to digest the messages
+ * @param[in] pss Signature scheme (TRUE for RSASSA-PSS, FALSE for
+ *   RSASSA-PKCS1-v1_5)
+ * @param[in] saltLen Length of the salt, in bytes (RSASSA-PSS only)
+ * @param[in,out] items Signatures to be verified
+ * @param[in] numItems Number of signatures in the batch
+ * @return Error code
+ **/
+
+static error_t rsassaVerifyBatch(const RsaPublicKey *key,
+   const HashAlgo *hash, bool_t pss, size_t saltLen, RsaVerifyItem *items,
+   uint_t numItems)
+{
+   error_t error;
+   error_t status;
+   uint_t i;
+   uint_t k;
+   uint_t emLen;
+   uint_t modBits;
+   Mpi s;
+   Mpi m;
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   uint8_t *em;
+#else
+   uint8_t em[RSA_MAX_MODULUS_SIZE / 8];
+#endif
+
+   //Check parameters
+   if(key == NULL || hash == NULL || (items == NULL && numItems != 0))
+      return ERROR_INVALID_PARAMETER;
+
+   //Debug message
+   TRACE_DEBUG("RSA batch signature verification (%u signatures)...\r\n",
+      numItems);
+
+   //modBits is the length in bits of the modulus n
+   modBits = mpiGetBitLength(&key->n);
+
+   //Make sure the modulus is valid
+   if(modBits == 0)
+      return ERROR_INVALID_PARAMETER;
+
+   //Calculate the length in octets of the modulus n
+   k = (modBits + 7) / 8;
+
+   //The length of the encoded message depends on the signature scheme
+   if(pss)
+   {
+      emLen = (modBits + 6) / 8;
+   }
+   else
+   {
+      emLen = k;
+   }
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Allocate a buffer to store the encoded messages
+   em = cryptoAllocMem(k);
+   //Failed to allocate memory?
+   if(em == NULL)
+      return ERROR_OUT_OF_MEMORY;
+#else
+   //Check the length of the modulus
+   if(k > sizeof(em))
+      return ERROR_BUFFER_OVERFLOW;
+#endif
+
+   //Initialize multiple-precision integers
+   mpiInit(&s);
+   mpiInit(&m);
+
+   //The same buffers are used for all the signatures of the batch (and the
+   //same Montgomery context, when MPI_MONT_SUPPORT is enabled)
+   status = NO_ERROR;
+
+   //Loop through the signatures
+   for(i = 0; i < numItems; i++)
+   {
+      //Check the length of the signature
+      if(items[i].digest == NULL || items[i].signature == NULL ||
+         items[i].signatureLen != k)
+      {
+         error = ERROR_INVALID_SIGNATURE;
+      }
+      else
+      {
+         //Convert the signature to an integer signature representative s
+         error = mpiReadRaw(&s, items[i].signature, items[i].signatureLen);
+
+         //Check status code
+         if(!error)
+         {
+            //Apply the RSAVP1 verification primitive
+            error = rsavp1(key, &s, &m);
+         }
+
+         //Check status code
+         if(!error)
+         {
+            //Convert the message representative m to an encoded message EM
+            error = mpiWriteRaw(&m, em, emLen);
+         }
+
+         //Check status code
+         if(!error)
+         {
+            //Verify the encoded message EM
+            if(pss)
+            {
+               error = emsaPssVerify(hash, saltLen, items[i].digest, em,
+                  modBits - 1);
+            }
+            else
+            {
+               error = emsaPkcs1v15Verify(hash, items[i].digest, em, emLen);
+            }
+
+            //Any error to report?
+            if(error)
+            {
+               //The signature is not valid
+               error = ERROR_INVALID_SIGNATURE;
+            }
+         }
+      }
+
+      //Save the result of the verification
+      items[i].error = error;
+
+      //The batch is valid only if all the signatures are valid
+      if(error)
+      {
+         status = ERROR_INVALID_SIGNATURE;
+      }
+   }
+
+#if (CRYPTO_STATIC_MEM_SUPPORT == DISABLED)
+   //Release the encoded message
+   cryptoFreeMem(em);
+#endif
+
+   //Release multiple precision integers
+   mpiFree(&s);
+   mpiFree(&m);
+
+   //Return status code
+   return status;
+}
+
+
+/**
+ * @brief RSASSA-PKCS1-v1_5 batch signature verification
+ *
+ * All the signatures must have been generated with the same RSA key. The
+ * result of each individual verification is stored in the corresponding
+ * item of the batch. The Montgomery setup is only shared across the batch
+ * when MPI_MONT_SUPPORT is enabled
+ *
+ * @param[in] key Signer's RSA public key
+ * @param[in] hash Hash function used to digest the messages
+ * @param[in,out] items Signatures to be verified
+ * @param[in] numItems Number of signatures in the batch
+ * @return Error code (ERROR_INVALID_SIGNATURE if at least one signature is
+ *   not valid)
+ **/
+
+error_t rsassaPkcs1v15VerifyBatch(const RsaPublicKey *key,
+   const HashAlgo *hash, RsaVerifyItem *items, uint_t numItems)
+{
+   //Verify the signatures
+   return rsassaVerifyBatch(key, hash, FALSE, 0, items, numItems);
+}
+
+
+/**
+ * @brief RSASSA-PSS batch signature verification
+ *
+ * All the signatures must have been generated with the same RSA key and the
+ * same salt length. The result of each individual verification is stored in
+ * the corresponding item of the batch. The Montgomery setup is only shared
+ * across the batch when MPI_MONT_SUPPORT is enabled
+ *
+ * @param[in] key Signer's RSA public key
+ * @param[in] hash Hash function used to digest the messages
+ * @param[in] saltLen Length of the salt, in bytes
+ * @param[in,out] items Signatures to be verified
+ * @param[in] numItems Number of signatures in the batch
+ * @return Error code (ERROR_INVALID_SIGNATURE if at least one signature is
+ *   not valid)
+ **/
+
+error_t rsassaPssVerifyBatch(const RsaPublicKey *key, const HashAlgo *hash,
+   size_t saltLen, RsaVerifyItem *items, uint_t numItems)
+{
+   //Verify the signatures
+   return rsassaVerifyBatch(key, hash, TRUE, saltLen, items, numItems);
+}
+
+
 /**
  * @brief RSA encryption primitive
  *
  * The RSA encryption primitive produces a ciphertext representative from
- * a message representative under the control of a public key
+ * a message representative under the control of a public key. When
+ * MPI_MONT_SUPPORT is enabled, a single-word public exponent is processed
+ * bit by bit with the Montgomery context attached to the key. Otherwise
+ * mpiExpModFast is called, which already disables the sliding window for
+ * exponents of 32 bits or less
  *
  * @param[in] key RSA public key
  * @param[in] m Message representative
@@ -1204,6 +1634,10 @@ error_t rsassaPssVerify(const RsaPublicKey *key, const HashAlgo *hash,
 
 __weak_func error_t rsaep(const RsaPublicKey *key, const Mpi *m, Mpi *c)
 {
+#if (MPI_MONT_SUPPORT == ENABLED)
+   const MpiMontContext *context;
+#endif
+
    //Ensure the RSA public key is valid
    if(!key->n.size || !key->e.size)
       return ERROR_INVALID_PARAMETER;
@@ -1212,8 +1646,50 @@ __weak_func error_t rsaep(const RsaPublicKey *key, const Mpi *m, Mpi *c)
    if(mpiCompInt(m, 0) < 0 || mpiComp(m, &key->n) >= 0)
       return ERROR_OUT_OF_RANGE;
 
+#if (MPI_MONT_SUPPORT == ENABLED)
+   //Small public exponent (such as 65537)?
+   if(mpiGetLength(&key->e) == 1)
+   {
+      //Retrieve the Montgomery context attached to the key
+      context = mpiMontGetCachedContext(&key->nMont, &key->n);
+
+      //The exponent is processed bit by bit, without any window
+      if(context != NULL)
+      {
+         return mpiMontExpInt(context, c, m, key->e.data[0]);
+      }
+   }
+
+   //Perform modular exponentiation (c = m ^ e mod n) using the Montgomery
+   //context precomputed when the key was loaded
+   return mpiExpModFastCached(c, m, &key->e, &key->n, &key->nMont);
+#else
    //Perform modular exponentiation (c = m ^ e mod n)
    return mpiExpModFast(c, m, &key->e, &key->n);
+#endif
+}
+
+
+/**
+ * @brief RSA CRT exponentiation task (executed by a worker)
+ * @param[in] param Pointer to the task parameters
+ **/
+
+static void rsaCrtTask(void *param)
+{
+   RsaCrtTask *task;
+
+   //Point to the task parameters
+   task = (RsaCrtTask *) param;
+
+   //Compute m = c ^ d mod p (the modular exponentiation takes care of
+   //reducing c modulo p)
+#if (MPI_MONT_SUPPORT == ENABLED)
+   task->error = mpiExpModRegularCached(&task->m, task->c, task->d, task->p,
+      task->cache);
+#else
+   task->error = mpiExpModRegular(&task->m, task->c, task->d, task->p);
+#endif
 }
 
 
@@ -1232,42 +1708,171 @@ __weak_func error_t rsaep(const RsaPublicKey *key, const Mpi *m, Mpi *c)
 __weak_func error_t rsadp(const RsaPrivateKey *key, const Mpi *c, Mpi *m)
 {
    error_t error;
-   Mpi m1;
-   Mpi m2;
+   uint_t i;
+   uint_t numTasks;
+   bool_t crt;
    Mpi h;
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   Mpi r;
+   RsaCrtTask tasks[RSA_MAX_PRIMES];
+#else
+   RsaCrtTask tasks[2];
+#endif
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   MpiArenaScope scope;
+#endif
 
    //The ciphertext representative c shall be between 0 and n - 1
    if(mpiCompInt(c, 0) < 0 || mpiComp(c, &key->n) >= 0)
       return ERROR_OUT_OF_RANGE;
 
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Temporary integers are allocated from the scratch arena
+   mpiArenaEnter(&scope);
+#endif
+
    //Initialize multiple-precision integers
-   mpiInit(&m1);
-   mpiInit(&m2);
+   for(i = 0; i < arraysize(tasks); i++)
+   {
+      mpiInit(&tasks[i].m);
+   }
+
    mpiInit(&h);
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   mpiInit(&r);
+#endif
 
-   //Use the Chinese remainder algorithm?
-   if(mpiGetLength(&key->n) > 0 && mpiGetLength(&key->p) > 0 &&
+   //Check whether the CRT form of the private key is available
+   crt = mpiGetLength(&key->n) > 0 && mpiGetLength(&key->p) > 0 &&
       mpiGetLength(&key->q) > 0 && mpiGetLength(&key->dp) > 0 &&
-      mpiGetLength(&key->dq) > 0 && mpiGetLength(&key->qinv) > 0)
+      mpiGetLength(&key->dq) > 0 && mpiGetLength(&key->qinv) > 0;
+
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   //Check the additional prime factors, if any
+   if(key->numOtherPrimes > arraysize(key->otherPrimes))
+   {
+      crt = FALSE;
+   }
+   else
+   {
+      for(i = 0; i < key->numOtherPrimes; i++)
+      {
+         if(mpiGetLength(&key->otherPrimes[i].r) == 0 ||
+            mpiGetLength(&key->otherPrimes[i].d) == 0 ||
+            mpiGetLength(&key->otherPrimes[i].t) == 0)
+         {
+            crt = FALSE;
+         }
+      }
+   }
+#endif
+
+   //Use the Chinese remainder algorithm?
+   if(crt)
    {
-      //Compute m1 = c ^ dP mod p
-      MPI_CHECK(mpiMod(&m1, c, &key->p));
-      MPI_CHECK(mpiExpModRegular(&m1, &m1, &key->dp, &key->p));
-      //Compute m2 = c ^ dQ mod q
-      MPI_CHECK(mpiMod(&m2, c, &key->q));
-      MPI_CHECK(mpiExpModRegular(&m2, &m2, &key->dq, &key->q));
+      //The first task computes m1 = c ^ dP mod p
+      tasks[0].c = c;
+      tasks[0].d = &key->dp;
+      tasks[0].p = &key->p;
+#if (MPI_MONT_SUPPORT == ENABLED)
+      tasks[0].cache = &key->pMont;
+#endif
+      tasks[0].error = ERROR_FAILURE;
+
+      //The second task computes m2 = c ^ dQ mod q
+      tasks[1].c = c;
+      tasks[1].d = &key->dq;
+      tasks[1].p = &key->q;
+#if (MPI_MONT_SUPPORT == ENABLED)
+      tasks[1].cache = &key->qMont;
+#endif
+      tasks[1].error = ERROR_FAILURE;
+
+      //Number of prime factors
+      numTasks = 2;
+
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+      //Each additional prime factor computes mi = c ^ di mod ri
+      for(i = 0; i < key->numOtherPrimes; i++, numTasks++)
+      {
+         tasks[numTasks].c = c;
+         tasks[numTasks].d = &key->otherPrimes[i].d;
+         tasks[numTasks].p = &key->otherPrimes[i].r;
+#if (MPI_MONT_SUPPORT == ENABLED)
+         tasks[numTasks].cache = &key->otherPrimes[i].rMont;
+#endif
+         tasks[numTasks].error = ERROR_FAILURE;
+      }
+#endif
+
+      //All the exponentiations are independent
+      if(key->workerPool != NULL)
+      {
+         //Run the tasks concurrently
+         MPI_CHECK(key->workerPool->run(key->workerPoolContext, rsaCrtTask,
+            tasks, sizeof(RsaCrtTask), numTasks));
+      }
+      else
+      {
+         //Run the tasks sequentially
+         for(i = 0; i < numTasks; i++)
+         {
+            rsaCrtTask(&tasks[i]);
+         }
+      }
+
+      //Check the status of each task
+      for(i = 0; i < numTasks; i++)
+      {
+         MPI_CHECK(tasks[i].error);
+      }
+
       //Let h = (m1 - m2) * qInv mod p
-      MPI_CHECK(mpiSub(&h, &m1, &m2));
+      MPI_CHECK(mpiSub(&h, &tasks[0].m, &tasks[1].m));
       MPI_CHECK(mpiMulMod(&h, &h, &key->qinv, &key->p));
       //Let m = m2 + q * h
       MPI_CHECK(mpiMul(m, &key->q, &h));
-      MPI_CHECK(mpiAdd(m, m, &m2));
+      MPI_CHECK(mpiAdd(m, m, &tasks[1].m));
+
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+      //Garner's algorithm is applied to the additional prime factors (refer
+      //to RFC 8017, section 5.1.2)
+      if(key->numOtherPrimes > 0)
+      {
+         //Let R = p * q
+         MPI_CHECK(mpiMul(&r, &key->p, &key->q));
+
+         //Loop through the additional prime factors
+         for(i = 0; i < key->numOtherPrimes; i++)
+         {
+            //Let h = (mi - m) * ti mod ri
+            MPI_CHECK(mpiSub(&h, &tasks[i + 2].m, m));
+            MPI_CHECK(mpiMulMod(&h, &h, &key->otherPrimes[i].t,
+               &key->otherPrimes[i].r));
+
+            //Let m = m + R * h
+            MPI_CHECK(mpiMul(&h, &r, &h));
+            MPI_CHECK(mpiAdd(m, m, &h));
+
+            //Let R = R * ri
+            if((i + 1) < key->numOtherPrimes)
+            {
+               MPI_CHECK(mpiMul(&r, &r, &key->otherPrimes[i].r));
+            }
+         }
+      }
+#endif
    }
    //Use modular exponentiation?
    else if(mpiGetLength(&key->n) > 0 && mpiGetLength(&key->d) > 0)
    {
+#if (MPI_MONT_SUPPORT == ENABLED)
+      //Let m = c ^ d mod n
+      error = mpiExpModRegularCached(m, c, &key->d, &key->n, &key->nMont);
+#else
       //Let m = c ^ d mod n
       error = mpiExpModRegular(m, c, &key->d, &key->n);
+#endif
    }
    //Invalid parameters?
    else
@@ -1278,9 +1883,20 @@ __weak_func error_t rsadp(const RsaPrivateKey *key, const Mpi *c, Mpi *m)
 
 end:
    //Free previously allocated memory
-   mpiFree(&m1);
-   mpiFree(&m2);
+   for(i = 0; i < arraysize(tasks); i++)
+   {
+      mpiFree(&tasks[i].m);
+   }
+
    mpiFree(&h);
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   mpiFree(&r);
+#endif
+
+#if (MPI_ARENA_SUPPORT == ENABLED)
+   //Reclaim the memory used by temporary integers
+   mpiArenaLeave(&scope);
+#endif
 
    //Return status code
    return error;
@@ -2064,18 +2680,76 @@ error_t rsaGenerateKeyPair(const PrngAlgo *prngAlgo, void *prngContext,
 
 __weak_func error_t rsaGeneratePrivateKey(const PrngAlgo *prngAlgo, void *prngContext,
    size_t k, uint_t e, RsaPrivateKey *privateKey)
+{
+   //Generate a two-prime RSA private key
+   return rsaGenerateMultiPrimePrivateKey(prngAlgo, prngContext, k, e, 2,
+      privateKey);
+}
+
+
+/**
+ * @brief Prime factor search task (executed by a worker)
+ * @param[in] param Pointer to the task parameters
+ **/
+
+static void rsaPrimeTask(void *param)
+{
+   RsaPrimeTask *task;
+
+   //Point to the task parameters
+   task = (RsaPrimeTask *) param;
+
+   //Search for a probable prime, starting from a random point of the range
+   task->error = mpiSearchProbablePrime(task->r, &task->a, &task->b, task->e,
+      task->prngAlgo, task->prngContext);
+}
+
+
+/**
+ * @brief Multi-prime RSA private key generation
+ *
+ * The modulus n is the product of u distinct primes of roughly the same bit
+ * length (refer to RFC 8017, section 3.2). The CRT computation then involves
+ * u exponentiations of size k/u. If a worker pool is attached to the key, the
+ * prime factors are searched concurrently
+ *
+ * @param[in] prngAlgo PRNG algorithm
+ * @param[in] prngContext Pointer to the PRNG context
+ * @param[in] k Required bit length of the modulus n
+ * @param[in] e Public exponent (3, 5, 17, 257 or 65537)
+ * @param[in] u Number of prime factors (2 to RSA_MAX_PRIMES)
+ * @param[out] privateKey RSA private key
+ * @return Error code
+ **/
+
+error_t rsaGenerateMultiPrimePrivateKey(const PrngAlgo *prngAlgo,
+   void *prngContext, size_t k, uint_t e, uint_t u, RsaPrivateKey *privateKey)
 {
    error_t error;
-   Mpi t1;
-   Mpi t2;
+   uint_t i;
+   uint_t j;
+   uint_t n;
+   bool_t distinct;
+   Mpi t;
    Mpi phy;
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   Mpi *d[RSA_MAX_PRIMES];
+   RsaPrimeTask tasks[RSA_MAX_PRIMES];
+#else
+   Mpi *d[2];
+   RsaPrimeTask tasks[2];
+#endif
 
    //Check parameters
    if(prngAlgo == NULL || prngContext == NULL || privateKey == NULL)
       return ERROR_INVALID_PARAMETER;
 
+   //Check the number of prime factors
+   if(u < 2 || u > arraysize(tasks))
+      return ERROR_INVALID_PARAMETER;
+
    //Check the length of the modulus
-   if(k < 8)
+   if((k / u) < 16)
       return ERROR_INVALID_PARAMETER;
 
    //Check the value of the public exponent
@@ -2083,73 +2757,121 @@ __weak_func error_t rsaGeneratePrivateKey(const PrngAlgo *prngAlgo, void *prngCo
       return ERROR_INVALID_PARAMETER;
 
    //Initialize multiple precision integers
-   mpiInit(&t1);
-   mpiInit(&t2);
+   mpiInit(&t);
    mpiInit(&phy);
 
-   //Save public exponent
-   MPI_CHECK(mpiSetValue(&privateKey->e, e));
-
-   //Generate a large random prime p
-   do
+   for(i = 0; i < arraysize(tasks); i++)
    {
-      do
-      {
-         //Generate a random number of bit length k/2
-         MPI_CHECK(mpiRand(&privateKey->p, k / 2, prngAlgo, prngContext));
-         //Set the low bit (this ensures the number is odd)
-         MPI_CHECK(mpiSetBitValue(&privateKey->p, 0, 1));
-         //Set the two highest bits (this ensures that the high bit of n is also set)
-         MPI_CHECK(mpiSetBitValue(&privateKey->p, k / 2 - 1, 1));
-         MPI_CHECK(mpiSetBitValue(&privateKey->p, k / 2 - 2, 1));
+      mpiInit(&tasks[i].a);
+      mpiInit(&tasks[i].b);
+   }
 
-         //Test whether p is a probable prime
-         error = mpiCheckProbablePrime(&privateKey->p);
+   //Point to the prime factors and their CRT exponents
+   tasks[0].r = &privateKey->p;
+   d[0] = &privateKey->dp;
+   tasks[1].r = &privateKey->q;
+   d[1] = &privateKey->dq;
 
-         //Repeat until an acceptable value is found
-      } while(error == ERROR_INVALID_VALUE);
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   //Additional prime factors
+   for(i = 2; i < u; i++)
+   {
+      tasks[i].r = &privateKey->otherPrimes[i - 2].r;
+      d[i] = &privateKey->otherPrimes[i - 2].d;
+   }
 
-      //Check status code
-      MPI_CHECK(error);
+   //Save the number of additional prime factors
+   privateKey->numOtherPrimes = u - 2;
+#endif
 
-      //Compute p mod e
-      MPI_CHECK(mpiMod(&t1, &privateKey->p, &privateKey->e));
+   //Save public exponent
+   MPI_CHECK(mpiSetValue(&privateKey->e, e));
 
-      //Repeat as long as p mod e = 1
-   } while(mpiCompInt(&t1, 1) == 0);
+   //Determine the range of each prime factor
+   for(i = 0; i < u; i++)
+   {
+      //The bit lengths of the prime factors add up to k
+      n = (k + i) / u;
+
+      //The lower bound of the range is 2^(n - 1/u), rounded up, so that the
+      //modulus n is at least 2^(k-1)
+      MPI_CHECK(mpiSetValue(&tasks[i].a, rsaPrimeBounds[u - 2]));
+      MPI_CHECK(mpiShiftLeft(&tasks[i].a, n));
+      MPI_CHECK(mpiAddInt(&tasks[i].a, &tasks[i].a, 0xFFFF));
+      MPI_CHECK(mpiShiftRight(&tasks[i].a, 16));
+
+      //The upper bound of the range is 2^n - 1
+      MPI_CHECK(mpiSetValue(&tasks[i].b, 1));
+      MPI_CHECK(mpiShiftLeft(&tasks[i].b, n));
+      MPI_CHECK(mpiSubInt(&tasks[i].b, &tasks[i].b, 1));
+
+      //Candidates such that r mod e = 1 are discarded
+      tasks[i].e = e;
+   }
 
-   //Generate a large random prime q
+   //Generate the prime factors
    do
    {
-      do
+      //Select a random starting point in each range
+      for(i = 0; i < u; i++)
       {
-         //Generate random number of bit length k - k/2
-         MPI_CHECK(mpiRand(&privateKey->q, k - (k / 2), prngAlgo, prngContext));
-         //Set the low bit (this ensures the number is odd)
-         MPI_CHECK(mpiSetBitValue(&privateKey->q, 0, 1));
-         //Set the two highest bits (this ensures that the high bit of n is also set)
-         MPI_CHECK(mpiSetBitValue(&privateKey->q, k - (k / 2) - 1, 1));
-         MPI_CHECK(mpiSetBitValue(&privateKey->q, k - (k / 2) - 2, 1));
+         MPI_CHECK(mpiSub(&t, &tasks[i].b, &tasks[i].a));
+         MPI_CHECK(mpiAddInt(&t, &t, 2));
+         MPI_CHECK(mpiRandRange(tasks[i].r, &t, prngAlgo, prngContext));
+         MPI_CHECK(mpiAdd(tasks[i].r, tasks[i].r, &tasks[i].a));
+         MPI_CHECK(mpiSubInt(tasks[i].r, tasks[i].r, 1));
+
+         //The Miller-Rabin bases are drawn from the same PRNG. When a worker
+         //pool is attached, the PRNG must support concurrent access (as is
+         //the case of Yarrow)
+         tasks[i].prngAlgo = prngAlgo;
+         tasks[i].prngContext = prngContext;
+         tasks[i].error = ERROR_FAILURE;
+      }
 
-         //Test whether q is a probable prime
-         error = mpiCheckProbablePrime(&privateKey->q);
+      //The searches are independent
+      if(privateKey->workerPool != NULL)
+      {
+         //Run the tasks concurrently
+         MPI_CHECK(privateKey->workerPool->run(privateKey->workerPoolContext,
+            rsaPrimeTask, tasks, sizeof(RsaPrimeTask), u));
+      }
+      else
+      {
+         //Run the tasks sequentially
+         for(i = 0; i < u; i++)
+         {
+            rsaPrimeTask(&tasks[i]);
+         }
+      }
 
-         //Repeat until an acceptable value is found
-      } while(error == ERROR_INVALID_VALUE);
+      //Check the status of each task
+      for(i = 0; i < u; i++)
+      {
+         MPI_CHECK(tasks[i].error);
+      }
 
-      //Check status code
-      MPI_CHECK(error);
+      //Make sure the prime factors are distinct
+      for(distinct = TRUE, i = 1; i < u; i++)
+      {
+         for(j = 0; j < i; j++)
+         {
+            if(mpiComp(tasks[i].r, tasks[j].r) == 0)
+            {
+               distinct = FALSE;
+            }
+         }
+      }
 
-      //Compute q mod e
-      MPI_CHECK(mpiMod(&t2, &privateKey->q, &privateKey->e));
+      //Repeat as long as two prime factors are equal
+   } while(!distinct);
 
-      //Repeat as long as p mod e = 1
-   } while(mpiCompInt(&t2, 1) == 0);
+   //Compute the modulus n = r1 * r2 * ... * ru
+   MPI_CHECK(mpiSetValue(&privateKey->n, 1));
 
-   //Make sure p an q are distinct
-   if(mpiComp(&privateKey->p, &privateKey->q) == 0)
+   for(i = 0; i < u; i++)
    {
-      MPI_CHECK(ERROR_FAILURE);
+      MPI_CHECK(mpiMul(&privateKey->n, &privateKey->n, tasks[i].r));
    }
 
    //If p < q, then swap p and q (this only matters if the CRT form of
@@ -2157,27 +2879,51 @@ __weak_func error_t rsaGeneratePrivateKey(const PrngAlgo *prngAlgo, void *prngCo
    if(mpiComp(&privateKey->p, &privateKey->q) < 0)
    {
       //Swap primes
-      mpiCopy(&t1, &privateKey->p);
+      mpiCopy(&t, &privateKey->p);
       mpiCopy(&privateKey->p, &privateKey->q);
-      mpiCopy(&privateKey->q, &t1);
+      mpiCopy(&privateKey->q, &t);
    }
 
-   //Compute the modulus n = pq
-   MPI_CHECK(mpiMul(&privateKey->n, &privateKey->p, &privateKey->q));
+   //Compute phy = (r1 - 1)(r2 - 1)...(ru - 1)
+   MPI_CHECK(mpiSetValue(&phy, 1));
 
-   //Compute phy = (p-1)(q-1)
-   MPI_CHECK(mpiSubInt(&t1, &privateKey->p, 1));
-   MPI_CHECK(mpiSubInt(&t2, &privateKey->q, 1));
-   MPI_CHECK(mpiMul(&phy, &t1, &t2));
+   for(i = 0; i < u; i++)
+   {
+      MPI_CHECK(mpiSubInt(&t, tasks[i].r, 1));
+      MPI_CHECK(mpiMul(&phy, &phy, &t));
+   }
 
    //Compute d = e^-1 mod phy
-   MPI_CHECK(mpiInvMod(&privateKey->d, &privateKey->e, &phy));
-   //Compute dP = d mod (p-1)
-   MPI_CHECK(mpiMod(&privateKey->dp, &privateKey->d, &t1));
-   //Compute dQ = d mod (q-1)
-   MPI_CHECK(mpiMod(&privateKey->dq, &privateKey->d, &t2));
+   MPI_CHECK(mpiInvModRegular(&privateKey->d, &privateKey->e, &phy));
+
+   //Compute the CRT exponents di = d mod (ri - 1)
+   for(i = 0; i < u; i++)
+   {
+      MPI_CHECK(mpiSubInt(&t, tasks[i].r, 1));
+      MPI_CHECK(mpiMod(d[i], &privateKey->d, &t));
+   }
+
    //Compute qInv = q^-1 mod p
-   MPI_CHECK(mpiInvMod(&privateKey->qinv, &privateKey->q, &privateKey->p));
+   MPI_CHECK(mpiInvModRegular(&privateKey->qinv, &privateKey->q,
+      &privateKey->p));
+
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   //Let R = p * q (phy is no longer needed)
+   MPI_CHECK(mpiMul(&phy, &privateKey->p, &privateKey->q));
+
+   //Compute the CRT coefficients ti = R^-1 mod ri, where R is the product
+   //of the preceding prime factors
+   for(i = 2; i < u; i++)
+   {
+      MPI_CHECK(mpiMod(&t, &phy, tasks[i].r));
+      MPI_CHECK(mpiInvModRegular(&privateKey->otherPrimes[i - 2].t, &t,
+         tasks[i].r));
+      MPI_CHECK(mpiMul(&phy, &phy, tasks[i].r));
+   }
+#endif
+
+   //Precompute the Montgomery contexts attached to the key
+   MPI_CHECK(rsaPrecomputePrivateKey(privateKey));
 
    //Debug message
    TRACE_DEBUG("RSA private key:\r\n");
@@ -2198,12 +2944,30 @@ __weak_func error_t rsaGeneratePrivateKey(const PrngAlgo *prngAlgo, void *prngCo
    TRACE_DEBUG("  Coefficient:\r\n");
    TRACE_DEBUG_MPI("    ", &privateKey->qinv);
 
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   //Additional prime factors
+   for(i = 0; i < privateKey->numOtherPrimes; i++)
+   {
+      TRACE_DEBUG("  Prime %u:\r\n", i + 3);
+      TRACE_DEBUG_MPI("    ", &privateKey->otherPrimes[i].r);
+      TRACE_DEBUG("  Prime exponent %u:\r\n", i + 3);
+      TRACE_DEBUG_MPI("    ", &privateKey->otherPrimes[i].d);
+      TRACE_DEBUG("  Coefficient %u:\r\n", i + 3);
+      TRACE_DEBUG_MPI("    ", &privateKey->otherPrimes[i].t);
+   }
+#endif
+
 end:
    //Release multiple precision integers
-   mpiFree(&t1);
-   mpiFree(&t2);
+   mpiFree(&t);
    mpiFree(&phy);
 
+   for(i = 0; i < arraysize(tasks); i++)
+   {
+      mpiFree(&tasks[i].a);
+      mpiFree(&tasks[i].b);
+   }
+
    //Any error to report?
    if(error)
    {
@@ -2236,6 +3000,9 @@ error_t rsaGeneratePublicKey(const RsaPrivateKey *privateKey,
    MPI_CHECK(mpiCopy(&publicKey->n, &privateKey->n));
    MPI_CHECK(mpiCopy(&publicKey->e, &privateKey->e));
 
+   //Precompute the Montgomery context attached to the key
+   MPI_CHECK(rsaPrecomputePublicKey(publicKey));
+
    //Debug message
    TRACE_DEBUG("RSA public key:\r\n");
    TRACE_DEBUG("  Modulus:\r\n");
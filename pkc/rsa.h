@@ -35,6 +35,7 @@
 #include "core/crypto.h"
 #include "hash/hash_algorithms.h"
 #include "mpi/mpi.h"
+#include "mpi/mpi_mont.h"
 
 //Maximum acceptable size for RSA modulus
 #ifndef RSA_MAX_MODULUS_SIZE
@@ -43,6 +44,20 @@
    #error RSA_MAX_MODULUS_SIZE parameter is not valid
 #endif
 
+//Multi-prime RSA support
+#ifndef RSA_MULTI_PRIME_SUPPORT
+   #define RSA_MULTI_PRIME_SUPPORT ENABLED
+#elif (RSA_MULTI_PRIME_SUPPORT != ENABLED && RSA_MULTI_PRIME_SUPPORT != DISABLED)
+   #error RSA_MULTI_PRIME_SUPPORT parameter is not valid
+#endif
+
+//Maximum number of prime factors of the RSA modulus
+#ifndef RSA_MAX_PRIMES
+   #define RSA_MAX_PRIMES 3
+#elif (RSA_MAX_PRIMES < 3 || RSA_MAX_PRIMES > 16)
+   #error RSA_MAX_PRIMES parameter is not valid
+#endif
+
 //C++ guard
 #ifdef __cplusplus
 extern "C" {
@@ -55,11 +70,29 @@ extern "C" {
 
 typedef struct
 {
-   Mpi n; ///<Modulus
-   Mpi e; ///<Public exponent
+   Mpi n;               ///<Modulus
+   Mpi e;               ///<Public exponent
+#if (MPI_MONT_SUPPORT == ENABLED)
+   MpiMontCache nMont;  ///<Precomputed Montgomery context (modulus)
+#endif
 } RsaPublicKey;
 
 
+/**
+ * @brief Additional prime factor of a multi-prime RSA key
+ **/
+
+typedef struct
+{
+   Mpi r;               ///<Prime factor
+   Mpi d;               ///<Factor's CRT exponent
+   Mpi t;               ///<Factor's CRT coefficient
+#if (MPI_MONT_SUPPORT == ENABLED)
+   MpiMontCache rMont;  ///<Precomputed Montgomery context (prime factor)
+#endif
+} RsaOtherPrimeInfo;
+
+
 /**
  * @brief RSA private key
  **/
@@ -74,10 +107,34 @@ typedef struct
    Mpi dp;     ///<First factor's CRT exponent
    Mpi dq;     ///<Second factor's CRT exponent
    Mpi qinv;   ///<CRT coefficient
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   uint_t numOtherPrimes;                            ///<Number of additional prime factors
+   RsaOtherPrimeInfo otherPrimes[RSA_MAX_PRIMES - 2]; ///<Additional prime factors
+#endif
    int_t slot; ///<Private key slot
+   const WorkerPool *workerPool; ///<Worker pool used for CRT computation
+   void *workerPoolContext;      ///<Worker pool context
+#if (MPI_MONT_SUPPORT == ENABLED)
+   MpiMontCache nMont; ///<Precomputed Montgomery context (modulus)
+   MpiMontCache pMont; ///<Precomputed Montgomery context (first factor)
+   MpiMontCache qMont; ///<Precomputed Montgomery context (second factor)
+#endif
 } RsaPrivateKey;
 
 
+/**
+ * @brief Signature to be verified as part of a batch
+ **/
+
+typedef struct
+{
+   const uint8_t *digest;    ///<Digest of the message
+   const uint8_t *signature; ///<Signature to be verified
+   size_t signatureLen;      ///<Length of the signature
+   error_t error;            ///<Result of the verification
+} RsaVerifyItem;
+
+
 //RSA related constants
 extern const uint8_t PKCS1_OID[8];
 extern const uint8_t RSA_ENCRYPTION_OID[9];
@@ -103,6 +160,12 @@ void rsaFreePublicKey(RsaPublicKey *key);
 void rsaInitPrivateKey(RsaPrivateKey *key);
 void rsaFreePrivateKey(RsaPrivateKey *key);
 
+void rsaSetWorkerPool(RsaPrivateKey *key, const WorkerPool *workerPool,
+   void *workerPoolContext);
+
+error_t rsaPrecomputePublicKey(RsaPublicKey *key);
+error_t rsaPrecomputePrivateKey(RsaPrivateKey *key);
+
 error_t rsaesPkcs1v15Encrypt(const PrngAlgo *prngAlgo, void *prngContext,
    const RsaPublicKey *key, const uint8_t *message, size_t messageLen,
    uint8_t *ciphertext, size_t *ciphertextLen);
@@ -134,6 +197,12 @@ error_t rsassaPssVerify(const RsaPublicKey *key, const HashAlgo *hash,
    size_t saltLen, const uint8_t *digest, const uint8_t *signature,
    size_t signatureLen);
 
+error_t rsassaPkcs1v15VerifyBatch(const RsaPublicKey *key,
+   const HashAlgo *hash, RsaVerifyItem *items, uint_t numItems);
+
+error_t rsassaPssVerifyBatch(const RsaPublicKey *key, const HashAlgo *hash,
+   size_t saltLen, RsaVerifyItem *items, uint_t numItems);
+
 error_t rsaep(const RsaPublicKey *key, const Mpi *m, Mpi *c);
 error_t rsadp(const RsaPrivateKey *key, const Mpi *c, Mpi *m);
 
@@ -174,6 +243,9 @@ error_t rsaGenerateKeyPair(const PrngAlgo *prngAlgo, void *prngContext,
 error_t rsaGeneratePrivateKey(const PrngAlgo *prngAlgo, void *prngContext,
    size_t k, uint_t e, RsaPrivateKey *privateKey);
 
+error_t rsaGenerateMultiPrimePrivateKey(const PrngAlgo *prngAlgo,
+   void *prngContext, size_t k, uint_t e, uint_t u, RsaPrivateKey *privateKey);
+
 error_t rsaGeneratePublicKey(const RsaPrivateKey *privateKey,
    RsaPublicKey *publicKey);
 
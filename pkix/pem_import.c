@@ -140,6 +140,12 @@ error_t pemImportCsr(const char_t *input, size_t inputLen,
 
 /**
  * @brief Decode a PEM file containing Diffie-Hellman parameters
+ *
+ * Both PKCS #3 parameters ("DH PARAMETERS" label) and X9.42 domain
+ * parameters ("X9.42 DH PARAMETERS" label) are supported. The latter also
+ * provide the order q of the subgroup, so that the public values can be
+ * fully validated
+ *
  * @param[in] input Pointer to the PEM encoding
  * @param[in] length Length of the PEM encoding
  * @param[out] params Diffie-Hellman parameters resulting from the parsing process
@@ -154,6 +160,7 @@ error_t pemImportDhParameters(const char_t *input, size_t length,
    size_t n;
    uint8_t *buffer;
    const uint8_t *p;
+   const char_t *label;
    Asn1Tag tag;
 
    //Check parameters
@@ -166,8 +173,26 @@ error_t pemImportDhParameters(const char_t *input, size_t length,
    p = NULL;
    n = 0;
 
-   //Diffie-Hellman parameters are encoded using the "DH PARAMETERS" label
-   error = pemDecodeFile(input, length, "DH PARAMETERS", NULL, &n, NULL, NULL);
+   //PKCS #3 parameters are encoded using the "DH PARAMETERS" label, whereas
+   //X9.42 domain parameters use the "X9.42 DH PARAMETERS" label
+   if(pemDecodeFile(input, length, "DH PARAMETERS", NULL, &n, NULL,
+      NULL) == NO_ERROR)
+   {
+      label = "DH PARAMETERS";
+      error = NO_ERROR;
+   }
+   else if(pemDecodeFile(input, length, "X9.42 DH PARAMETERS", NULL, &n, NULL,
+      NULL) == NO_ERROR)
+   {
+      label = "X9.42 DH PARAMETERS";
+      error = NO_ERROR;
+   }
+   else
+   {
+      //The PEM file does not contain valid Diffie-Hellman parameters
+      label = NULL;
+      error = ERROR_END_OF_FILE;
+   }
 
    //Check status code
    if(!error)
@@ -179,8 +204,7 @@ error_t pemImportDhParameters(const char_t *input, size_t length,
       if(buffer != NULL)
       {
          //Decode the content of the PEM container
-         error = pemDecodeFile(input, length, "DH PARAMETERS", buffer, &n,
-            NULL, NULL);
+         error = pemDecodeFile(input, length, label, buffer, &n, NULL, NULL);
 
          //Check status code
          if(!error)
@@ -211,6 +235,25 @@ error_t pemImportDhParameters(const char_t *input, size_t length,
             error = asn1ReadMpi(p, n, &tag, &params->g);
          }
 
+         //X9.42 domain parameters?
+         if(!error && !osStrcmp(label, "X9.42 DH PARAMETERS"))
+         {
+            //Point to the next field
+            p += tag.totalLength;
+            n -= tag.totalLength;
+
+            //Read the order of the subgroup (the optional fields j and
+            //validationParms are ignored)
+            error = asn1ReadMpi(p, n, &tag, &params->q);
+         }
+
+         //Check status code
+         if(!error)
+         {
+            //Precompute the Montgomery context attached to the parameters
+            error = dhPrecomputeParameters(params);
+         }
+
          //Check status code
          if(!error)
          {
@@ -220,6 +263,8 @@ error_t pemImportDhParameters(const char_t *input, size_t length,
             TRACE_DEBUG_MPI("    ", &params->p);
             TRACE_DEBUG("  Generator:\r\n");
             TRACE_DEBUG_MPI("    ", &params->g);
+            TRACE_DEBUG("  Subgroup order:\r\n");
+            TRACE_DEBUG_MPI("    ", &params->q);
          }
 
          //Release previously allocated memory
@@ -238,6 +283,7 @@ error_t pemImportDhParameters(const char_t *input, size_t length,
       //Clean up side effects
       mpiFree(&params->p);
       mpiFree(&params->g);
+      mpiFree(&params->q);
    }
 
    //Return status code
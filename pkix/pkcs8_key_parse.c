@@ -473,10 +473,183 @@ error_t pkcs8ParseRsaPrivateKey(const uint8_t *data, size_t length,
    rsaPrivateKey->qinv.value = tag.value;
    rsaPrivateKey->qinv.length = tag.length;
 
+   //Point to the next field
+   data += tag.totalLength;
+   length -= tag.totalLength;
+
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   //Two-prime key by default
+   rsaPrivateKey->numOtherPrimes = 0;
+
+   //The OtherPrimeInfos field is present if and only if the version is 1
+   //(refer to RFC 8017, appendix A.1.2)
+   if(rsaPrivateKey->version == PKCS1_VERSION_2)
+   {
+      //Parse OtherPrimeInfos field
+      error = pkcs8ParseRsaOtherPrimeInfos(data, length, rsaPrivateKey);
+      //Any error to report?
+      if(error)
+         return error;
+   }
+#else
+   //Multi-prime RSA keys are not supported
+   if(rsaPrivateKey->version == PKCS1_VERSION_2)
+      return ERROR_INVALID_VERSION;
+#endif
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+
+/**
+ * @brief Parse OtherPrimeInfos structure
+ * @param[in] data Pointer to the ASN.1 structure to parse
+ * @param[in] length Length of the ASN.1 structure
+ * @param[out] rsaPrivateKey Information resulting from the parsing process
+ * @return Error code
+ **/
+
+error_t pkcs8ParseRsaOtherPrimeInfos(const uint8_t *data, size_t length,
+   Pkcs8RsaPrivateKey *rsaPrivateKey)
+{
+   error_t error;
+   size_t n;
+   Asn1Tag tag;
+
+   //Read OtherPrimeInfos structure
+   error = asn1ReadSequence(data, length, &tag);
+   //Failed to decode ASN.1 tag?
+   if(error)
+      return error;
+
+   //Point to the first item of the sequence
+   data = tag.value;
+   length = tag.length;
+
+   //The sequence must contain at least one item
+   if(length == 0)
+      return ERROR_INVALID_SYNTAX;
+
+   //Loop through the additional prime factors
+   while(length > 0)
+   {
+      //Make sure the key does not exceed the maximum number of primes
+      if(rsaPrivateKey->numOtherPrimes >= arraysize(rsaPrivateKey->otherPrimes))
+         return ERROR_INVALID_SYNTAX;
+
+      //Parse OtherPrimeInfo structure
+      error = pkcs8ParseRsaOtherPrimeInfo(data, length, &n,
+         &rsaPrivateKey->otherPrimes[rsaPrivateKey->numOtherPrimes]);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //Update the number of additional prime factors
+      rsaPrivateKey->numOtherPrimes++;
+
+      //Next item
+      data += n;
+      length -= n;
+   }
+
+   //Successful processing
+   return NO_ERROR;
+}
+
+
+/**
+ * @brief Parse OtherPrimeInfo structure
+ * @param[in] data Pointer to the ASN.1 structure to parse
+ * @param[in] length Length of the ASN.1 structure
+ * @param[out] totalLength Number of bytes that have been parsed
+ * @param[out] otherPrimeInfo Information resulting from the parsing process
+ * @return Error code
+ **/
+
+error_t pkcs8ParseRsaOtherPrimeInfo(const uint8_t *data, size_t length,
+   size_t *totalLength, Pkcs8RsaOtherPrimeInfo *otherPrimeInfo)
+{
+   error_t error;
+   Asn1Tag tag;
+
+   //Read OtherPrimeInfo structure
+   error = asn1ReadSequence(data, length, &tag);
+   //Failed to decode ASN.1 tag?
+   if(error)
+      return error;
+
+   //Save the total length of the structure
+   *totalLength = tag.totalLength;
+
+   //Point to the first field
+   data = tag.value;
+   length = tag.length;
+
+   //Read Prime field
+   error = asn1ReadTag(data, length, &tag);
+   //Failed to decode ASN.1 tag?
+   if(error)
+      return error;
+
+   //Enforce encoding, class and type
+   error = asn1CheckTag(&tag, FALSE, ASN1_CLASS_UNIVERSAL, ASN1_TYPE_INTEGER);
+   //Invalid tag?
+   if(error)
+      return error;
+
+   //Save the prime factor
+   otherPrimeInfo->r.value = tag.value;
+   otherPrimeInfo->r.length = tag.length;
+
+   //Point to the next field
+   data += tag.totalLength;
+   length -= tag.totalLength;
+
+   //Read Exponent field
+   error = asn1ReadTag(data, length, &tag);
+   //Failed to decode ASN.1 tag?
+   if(error)
+      return error;
+
+   //Enforce encoding, class and type
+   error = asn1CheckTag(&tag, FALSE, ASN1_CLASS_UNIVERSAL, ASN1_TYPE_INTEGER);
+   //Invalid tag?
+   if(error)
+      return error;
+
+   //Save the exponent
+   otherPrimeInfo->d.value = tag.value;
+   otherPrimeInfo->d.length = tag.length;
+
+   //Point to the next field
+   data += tag.totalLength;
+   length -= tag.totalLength;
+
+   //Read Coefficient field
+   error = asn1ReadTag(data, length, &tag);
+   //Failed to decode ASN.1 tag?
+   if(error)
+      return error;
+
+   //Enforce encoding, class and type
+   error = asn1CheckTag(&tag, FALSE, ASN1_CLASS_UNIVERSAL, ASN1_TYPE_INTEGER);
+   //Invalid tag?
+   if(error)
+      return error;
+
+   //Save the coefficient
+   otherPrimeInfo->t.value = tag.value;
+   otherPrimeInfo->t.length = tag.length;
+
    //Successful processing
    return NO_ERROR;
 }
 
+#endif
+
 
 /**
  * @brief Parse DSAPrivateKey structure
@@ -848,6 +1021,10 @@ error_t pkcs8ImportRsaPrivateKey(const Pkcs8PrivateKeyInfo *privateKeyInfo,
 #if (RSA_SUPPORT == ENABLED)
    const uint8_t *oid;
    size_t oidLen;
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   uint_t i;
+   const Pkcs8RsaOtherPrimeInfo *otherPrimeInfo;
+#endif
 
    //Get the private key algorithm identifier
    oid = privateKeyInfo->oid.value;
@@ -927,6 +1104,49 @@ error_t pkcs8ImportRsaPrivateKey(const Pkcs8PrivateKeyInfo *privateKeyInfo,
                privateKeyInfo->rsaPrivateKey.qinv.length, MPI_FORMAT_BIG_ENDIAN);
          }
 
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+         //Loop through the additional prime factors
+         for(i = 0; i < privateKeyInfo->rsaPrivateKey.numOtherPrimes &&
+            !error; i++)
+         {
+            //Point to the current prime factor
+            otherPrimeInfo = &privateKeyInfo->rsaPrivateKey.otherPrimes[i];
+
+            //Read prime factor
+            error = mpiImport(&privateKey->otherPrimes[i].r,
+               otherPrimeInfo->r.value, otherPrimeInfo->r.length,
+               MPI_FORMAT_BIG_ENDIAN);
+
+            //Check status code
+            if(!error)
+            {
+               //Read exponent
+               error = mpiImport(&privateKey->otherPrimes[i].d,
+                  otherPrimeInfo->d.value, otherPrimeInfo->d.length,
+                  MPI_FORMAT_BIG_ENDIAN);
+            }
+
+            //Check status code
+            if(!error)
+            {
+               //Read coefficient
+               error = mpiImport(&privateKey->otherPrimes[i].t,
+                  otherPrimeInfo->t.value, otherPrimeInfo->t.length,
+                  MPI_FORMAT_BIG_ENDIAN);
+            }
+         }
+
+         //Save the number of additional prime factors
+         privateKey->numOtherPrimes = privateKeyInfo->rsaPrivateKey.numOtherPrimes;
+#endif
+
+         //Check status code
+         if(!error)
+         {
+            //Precompute the Montgomery contexts attached to the key
+            error = rsaPrecomputePrivateKey(privateKey);
+         }
+
          //Check status code
          if(!error)
          {
@@ -948,6 +1168,19 @@ error_t pkcs8ImportRsaPrivateKey(const Pkcs8PrivateKeyInfo *privateKeyInfo,
             TRACE_DEBUG_MPI("    ", &privateKey->dq);
             TRACE_DEBUG("  Coefficient:\r\n");
             TRACE_DEBUG_MPI("    ", &privateKey->qinv);
+
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+            //Additional prime factors
+            for(i = 0; i < privateKey->numOtherPrimes; i++)
+            {
+               TRACE_DEBUG("  Prime %u:\r\n", i + 3);
+               TRACE_DEBUG_MPI("    ", &privateKey->otherPrimes[i].r);
+               TRACE_DEBUG("  Prime exponent %u:\r\n", i + 3);
+               TRACE_DEBUG_MPI("    ", &privateKey->otherPrimes[i].d);
+               TRACE_DEBUG("  Coefficient %u:\r\n", i + 3);
+               TRACE_DEBUG_MPI("    ", &privateKey->otherPrimes[i].t);
+            }
+#endif
          }
       }
       else
@@ -1020,6 +1253,13 @@ error_t pkcs8ImportDsaPrivateKey(const Pkcs8PrivateKeyInfo *privateKeyInfo,
                privateKeyInfo->dsaPrivateKey.x.length, MPI_FORMAT_BIG_ENDIAN);
          }
 
+         //Check status code
+         if(!error)
+         {
+            //Precompute the Montgomery context attached to the key
+            error = dsaPrecomputeDomainParameters(&privateKey->params);
+         }
+
          //Check status code
          if(!error)
          {
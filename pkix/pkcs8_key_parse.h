@@ -41,6 +41,18 @@ extern "C" {
 #endif
 
 
+/**
+ * @brief Additional prime factor (multi-prime RSA)
+ **/
+
+typedef struct
+{
+   X509OctetString r;
+   X509OctetString d;
+   X509OctetString t;
+} Pkcs8RsaOtherPrimeInfo;
+
+
 /**
  * @brief RSA private key
  **/
@@ -56,6 +68,10 @@ typedef struct
    X509OctetString dp;
    X509OctetString dq;
    X509OctetString qinv;
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   uint_t numOtherPrimes;
+   Pkcs8RsaOtherPrimeInfo otherPrimes[RSA_MAX_PRIMES - 2];
+#endif
 } Pkcs8RsaPrivateKey;
 
 
@@ -136,6 +152,12 @@ error_t pkcs8ParsePrivateKeyAlgo(const uint8_t *data, size_t length,
 error_t pkcs8ParseRsaPrivateKey(const uint8_t *data, size_t length,
    Pkcs8RsaPrivateKey *rsaPrivateKey);
 
+error_t pkcs8ParseRsaOtherPrimeInfos(const uint8_t *data, size_t length,
+   Pkcs8RsaPrivateKey *rsaPrivateKey);
+
+error_t pkcs8ParseRsaOtherPrimeInfo(const uint8_t *data, size_t length,
+   size_t *totalLength, Pkcs8RsaOtherPrimeInfo *otherPrimeInfo);
+
 error_t pkcs8ParseDsaPrivateKey(const uint8_t *data, size_t length,
    X509DsaParameters *dsaParams, Pkcs8DsaPrivateKey *dsaPrivateKey);
 
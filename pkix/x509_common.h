@@ -435,7 +435,8 @@ extern "C" {
 
 typedef enum
 {
-   PKCS1_VERSION_1 = 0
+   PKCS1_VERSION_1 = 0,
+   PKCS1_VERSION_2 = 1
 } Pkcs1Version;
 
 
@@ -761,6 +761,7 @@ error_t x509ExportRsaPrivateKey(const RsaPrivateKey *privateKey,
    uint8_t *output, size_t *written)
 {
    error_t error;
+   int32_t version;
    size_t n;
    size_t length;
    uint8_t *p;
@@ -771,8 +772,20 @@ error_t x509ExportRsaPrivateKey(const RsaPrivateKey *privateKey,
    //Length of the ASN.1 structure
    length = 0;
 
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   //The version shall be 1 if the key has more than two prime factors
+   if(privateKey->numOtherPrimes > 0)
+   {
+      version = PKCS1_VERSION_2;
+   }
+   else
+#endif
+   {
+      version = PKCS1_VERSION_1;
+   }
+
    //Write Version field
-   error = asn1WriteInt32(PKCS1_VERSION_1, FALSE, p, &n);
+   error = asn1WriteInt32(version, FALSE, p, &n);
    //Any error to report?
    if(error)
       return error;
@@ -906,6 +919,27 @@ error_t x509ExportRsaPrivateKey(const RsaPrivateKey *privateKey,
       p += n;
    }
 
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   //Multi-prime RSA key?
+   if(privateKey->numOtherPrimes > 0)
+   {
+      //Write OtherPrimeInfos field
+      error = x509ExportRsaOtherPrimeInfos(privateKey, p, &n);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //Update the length of the RSAPrivateKey structure
+      length += n;
+
+      //Advance data pointer
+      if(output != NULL)
+      {
+         p += n;
+      }
+   }
+#endif
+
    //The private key is encapsulated within a sequence
    tag.constructed = TRUE;
    tag.objClass = ASN1_CLASS_UNIVERSAL;
@@ -927,6 +961,126 @@ error_t x509ExportRsaPrivateKey(const RsaPrivateKey *privateKey,
 }
 
 
+/**
+ * @brief Export the additional prime factors of an RSA private key
+ * @param[in] privateKey Pointer to the RSA private key
+ * @param[out] output Buffer where to store the ASN.1 structure
+ * @param[out] written Length of the resulting ASN.1 structure
+ * @return Error code
+ **/
+
+error_t x509ExportRsaOtherPrimeInfos(const RsaPrivateKey *privateKey,
+   uint8_t *output, size_t *written)
+{
+#if (RSA_MULTI_PRIME_SUPPORT == ENABLED)
+   error_t error;
+   uint_t i;
+   size_t n;
+   size_t length;
+   size_t itemLen;
+   uint8_t *p;
+   uint8_t *item;
+   Asn1Tag tag;
+
+   //Point to the buffer where to write the ASN.1 structure
+   p = output;
+   //Length of the ASN.1 structure
+   length = 0;
+
+   //Loop through the additional prime factors
+   for(i = 0; i < privateKey->numOtherPrimes; i++)
+   {
+      //Point to the OtherPrimeInfo structure
+      item = p;
+      itemLen = 0;
+
+      //Write Prime field
+      error = asn1WriteMpi(&privateKey->otherPrimes[i].r, FALSE, p, &n);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //Update the length of the OtherPrimeInfo structure
+      itemLen += n;
+
+      //Advance data pointer
+      if(output != NULL)
+      {
+         p += n;
+      }
+
+      //Write Exponent field
+      error = asn1WriteMpi(&privateKey->otherPrimes[i].d, FALSE, p, &n);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //Update the length of the OtherPrimeInfo structure
+      itemLen += n;
+
+      //Advance data pointer
+      if(output != NULL)
+      {
+         p += n;
+      }
+
+      //Write Coefficient field
+      error = asn1WriteMpi(&privateKey->otherPrimes[i].t, FALSE, p, &n);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //Update the length of the OtherPrimeInfo structure
+      itemLen += n;
+
+      //Each additional prime factor is encapsulated within a sequence
+      tag.constructed = TRUE;
+      tag.objClass = ASN1_CLASS_UNIVERSAL;
+      tag.objType = ASN1_TYPE_SEQUENCE;
+      tag.length = itemLen;
+      tag.value = item;
+
+      //Write OtherPrimeInfo structure
+      error = asn1WriteTag(&tag, FALSE, item, &n);
+      //Any error to report?
+      if(error)
+         return error;
+
+      //Update the length of the OtherPrimeInfos structure
+      length += tag.totalLength;
+
+      //Advance data pointer
+      if(output != NULL)
+      {
+         p = item + tag.totalLength;
+      }
+   }
+
+   //The OtherPrimeInfos structure is a sequence of OtherPrimeInfo items
+   tag.constructed = TRUE;
+   tag.objClass = ASN1_CLASS_UNIVERSAL;
+   tag.objType = ASN1_TYPE_SEQUENCE;
+   tag.length = length;
+   tag.value = output;
+
+   //Write OtherPrimeInfos structure
+   error = asn1WriteTag(&tag, FALSE, output, &n);
+   //Any error to report?
+   if(error)
+      return error;
+
+   //Total number of bytes that have been written
+   *written = tag.totalLength;
+
+   //Successful processing
+   return NO_ERROR;
+#else
+   //Multi-prime RSA keys are not supported
+   return ERROR_NOT_IMPLEMENTED;
+#endif
+}
+
+
 /**
  * @brief Export a DSA public key to ASN.1 format
  * @param[in] publicKey Pointer to the DSA public key
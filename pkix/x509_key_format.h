@@ -68,6 +68,9 @@ error_t x509ExportRsaPublicKey(const RsaPublicKey *publicKey,
 error_t x509ExportRsaPrivateKey(const RsaPrivateKey *privateKey,
    uint8_t *output, size_t *written);
 
+error_t x509ExportRsaOtherPrimeInfos(const RsaPrivateKey *privateKey,
+   uint8_t *output, size_t *written);
+
 error_t x509ExportDsaPublicKey(const DsaPublicKey *publicKey,
    uint8_t *output, size_t *written);
 
@@ -593,6 +593,13 @@ error_t x509ImportRsaPublicKey(const X509SubjectPublicKeyInfo *publicKeyInfo,
                publicKeyInfo->rsaPublicKey.e.length, MPI_FORMAT_BIG_ENDIAN);
          }
 
+         //Check status code
+         if(!error)
+         {
+            //Precompute the Montgomery context attached to the key
+            error = rsaPrecomputePublicKey(publicKey);
+         }
+
          //Check status code
          if(!error)
          {
@@ -674,6 +681,13 @@ error_t x509ImportDsaPublicKey(const X509SubjectPublicKeyInfo *publicKeyInfo,
                publicKeyInfo->dsaPublicKey.y.length, MPI_FORMAT_BIG_ENDIAN);
          }
 
+         //Check status code
+         if(!error)
+         {
+            //Precompute the Montgomery context attached to the key
+            error = dsaPrecomputeDomainParameters(&publicKey->params);
+         }
+
          //Check status code
          if(!error)
          {
@@ -722,7 +736,8 @@ error_t x509ImportEcPublicKey(const X509SubjectPublicKeyInfo *publicKeyInfo,
 
 #if (EC_SUPPORT == ENABLED)
    const EcCurveInfo *curveInfo;
-   EcDomainParameters params;
+   const EcDomainParameters *params;
+   EcDomainParameters ecParams;
 
    //EC public key identifier?
    if(!oidComp(publicKeyInfo->oid.value, publicKeyInfo->oid.length,
@@ -733,7 +748,7 @@ error_t x509ImportEcPublicKey(const X509SubjectPublicKeyInfo *publicKeyInfo,
          publicKeyInfo->ecPublicKey.q.value != NULL)
       {
          //Initialize EC domain parameters
-         ecInitDomainParameters(&params);
+         ecInitDomainParameters(&ecParams);
 
          //Retrieve EC domain parameters
          curveInfo = x509GetCurveInfo(publicKeyInfo->ecParams.namedCurve.value,
@@ -742,8 +757,8 @@ error_t x509ImportEcPublicKey(const X509SubjectPublicKeyInfo *publicKeyInfo,
          //Make sure the specified elliptic curve is supported
          if(curveInfo != NULL)
          {
-            //Load EC domain parameters
-            error = ecLoadDomainParameters(&params, curveInfo);
+            //Use the preloaded EC domain parameters, if available
+            error = ecRetrieveDomainParameters(curveInfo, &ecParams, &params);
          }
          else
          {
@@ -755,7 +770,7 @@ error_t x509ImportEcPublicKey(const X509SubjectPublicKeyInfo *publicKeyInfo,
          if(!error)
          {
             //Read the EC public key
-            error = ecImport(&params, &publicKey->q,
+            error = ecImport(params, &publicKey->q,
                publicKeyInfo->ecPublicKey.q.value,
                publicKeyInfo->ecPublicKey.q.length);
          }
@@ -771,7 +786,7 @@ error_t x509ImportEcPublicKey(const X509SubjectPublicKeyInfo *publicKeyInfo,
          }
 
          //Release EC domain parameters
-         ecFreeDomainParameters(&params);
+         ecFreeDomainParameters(&ecParams);
       }
       else
       {
@@ -419,6 +419,7 @@ error_t x509VerifyEcdsaSignature(const X509OctetString *tbsData,
 #if (X509_ECDSA_SUPPORT == ENABLED && ECDSA_SUPPORT == ENABLED)
    error_t error;
    const EcCurveInfo *curveInfo;
+   const EcDomainParameters *params;
    EcDomainParameters ecParams;
    EcPublicKey ecPublicKey;
    EcdsaSignature ecdsaSignature;
@@ -438,8 +439,8 @@ error_t x509VerifyEcdsaSignature(const X509OctetString *tbsData,
    //Make sure the specified elliptic curve is supported
    if(curveInfo != NULL)
    {
-      //Load EC domain parameters
-      error = ecLoadDomainParameters(&ecParams, curveInfo);
+      //Use the preloaded EC domain parameters, if available
+      error = ecRetrieveDomainParameters(curveInfo, &ecParams, &params);
    }
    else
    {
@@ -458,7 +459,7 @@ error_t x509VerifyEcdsaSignature(const X509OctetString *tbsData,
    if(!error)
    {
       //Retrieve the EC public key
-      error = ecImport(&ecParams, &ecPublicKey.q,
+      error = ecImport(params, &ecPublicKey.q,
          publicKeyInfo->ecPublicKey.q.value,
          publicKeyInfo->ecPublicKey.q.length);
    }
@@ -475,7 +476,7 @@ error_t x509VerifyEcdsaSignature(const X509OctetString *tbsData,
    if(!error)
    {
       //Verify ECDSA signature
-      error = ecdsaVerifySignature(&ecParams, &ecPublicKey, digest,
+      error = ecdsaVerifySignature(params, &ecPublicKey, digest,
          hashAlgo->digestSize, &ecdsaSignature);
    }
 
@@ -508,6 +509,7 @@ error_t x509VerifySm2Signature(const X509OctetString *tbsData,
 {
 #if (X509_SM2_SUPPORT == ENABLED && SM2_SUPPORT == ENABLED)
    error_t error;
+   const EcDomainParameters *params;
    EcDomainParameters ecParams;
    EcPublicKey ecPublicKey;
    EcdsaSignature sm2Signature;
@@ -519,14 +521,14 @@ error_t x509VerifySm2Signature(const X509OctetString *tbsData,
    //Initialize SM2 signature
    ecdsaInitSignature(&sm2Signature);
 
-   //Load EC domain parameters
-   error = ecLoadDomainParameters(&ecParams, SM2_CURVE);
+   //Use the preloaded EC domain parameters, if available
+   error = ecRetrieveDomainParameters(SM2_CURVE, &ecParams, &params);
 
    //Check status code
    if(!error)
    {
       //Retrieve the EC public key
-      error = ecImport(&ecParams, &ecPublicKey.q,
+      error = ecImport(params, &ecPublicKey.q,
          publicKeyInfo->ecPublicKey.q.value,
          publicKeyInfo->ecPublicKey.q.length);
    }
@@ -543,7 +545,7 @@ error_t x509VerifySm2Signature(const X509OctetString *tbsData,
    if(!error)
    {
       //Verify SM2 signature
-      error = sm2VerifySignature(&ecParams, &ecPublicKey, hashAlgo,
+      error = sm2VerifySignature(params, &ecPublicKey, hashAlgo,
          SM2_DEFAULT_ID, osStrlen(SM2_DEFAULT_ID), tbsData->value,
          tbsData->length, &sm2Signature);
    }